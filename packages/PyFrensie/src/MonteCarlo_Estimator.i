@@ -17,6 +17,8 @@
 #include "Utility_SampleMomentHistogram.hpp"
 #include "Utility_Mesh.hpp"
 #include "Utility_StructuredHexMesh.hpp"
+#include "Utility_StructuredCylindricalMesh.hpp"
+#include "Utility_StructuredSphericalMesh.hpp"
 #include "Utility_TetMesh.hpp"
 
 #include "MonteCarlo_EstimatorContributionMultiplierPolicy.hpp"
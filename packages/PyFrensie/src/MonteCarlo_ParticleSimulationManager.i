@@ -23,6 +23,8 @@
 #include "MonteCarlo_FilledGeometryModel.hpp"
 #include "MonteCarlo_EventHandler.hpp"
 #include "MonteCarlo_ParticleSource.hpp"
+#include "MonteCarlo_PopulationControl.hpp"
+#include "MonteCarlo_WeightWindowMeshGenerator.hpp"
 #include "Utility_Communicator.hpp"
 #include "Utility_GlobalMPISession.hpp"
 #include "Utility_OpenMPProperties.hpp"
@@ -73,6 +75,8 @@ typedef unsigned long int uint64_t;
 %import "MonteCarlo_EventHandler.hpp"
 %import "MonteCarlo_ParticleSource.hpp"
 %import "MonteCarlo_CollisionForcer.hpp"
+%import "MonteCarlo_PopulationControl.hpp"
+%import "MonteCarlo_WeightWindowMeshGenerator.hpp"
 
 %shared_ptr(MonteCarlo::FilledGeometryModel);
 %shared_ptr(MonteCarlo::ParticleSource);
@@ -80,6 +84,8 @@ typedef unsigned long int uint64_t;
 %shared_ptr(MonteCarlo::SimulationGeneralProperties);
 %shared_ptr(MonteCarlo::SimulationProperties);
 %shared_ptr(MonteCarlo::CollisionForcer);
+%shared_ptr(MonteCarlo::PopulationControl);
+%shared_ptr(MonteCarlo::WeightWindowMeshGenerator);
 
 // ---------------------------------------------------------------------------//
 // Add ParticleSimulationManager support
@@ -0,0 +1,150 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_PopulationControl.i
+//! \author Alex Robinson
+//! \brief  The population control classes interface file
+//!
+//---------------------------------------------------------------------------//
+
+%{
+// FRENSIE Includes
+#include "PyFrensie_PythonTypeTraits.hpp"
+
+#include "Utility_Mesh.hpp"
+#include "MonteCarlo_Estimator.hpp"
+#include "MonteCarlo_PopulationControl.hpp"
+#include "MonteCarlo_WeightWindow.hpp"
+#include "MonteCarlo_WeightWindowMesh.hpp"
+#include "MonteCarlo_WeightWindowMeshGenerator.hpp"
+#include "MonteCarlo_Importance.hpp"
+#include "MonteCarlo_ImportanceMesh.hpp"
+#include "MonteCarlo_ParticleDistribution.hpp"
+#include "MonteCarlo_CADISParticleDistribution.hpp"
+#include "MonteCarlo_CADISGenerator.hpp"
+
+using namespace MonteCarlo;
+%}
+
+// C++ STL support
+%include <stl.i>
+%include <std_string.i>
+%include <std_shared_ptr.i>
+
+// Include typemaps support
+%include <typemaps.i>
+
+// Add typemaps for converting file_path to and from Python string
+%typemap(in) const boost::filesystem::path& ( boost::filesystem::path temp ){
+  temp = PyString_AsString( $input );
+  $1 = &temp;
+}
+
+%typemap(typecheck, precedence=1140) (const boost::filesystem::path&) {
+  $1 = (PyString_Check($input)) ? 1 : 0;
+}
+
+//---------------------------------------------------------------------------//
+// Add PopulationControl support
+//---------------------------------------------------------------------------//
+
+%ignore *::checkParticleWithPopulationController;
+%ignore *::splitParticle;
+%ignore *::terminateParticle;
+%ignore *::pushSplitParticlesToBank;
+
+%shared_ptr( MonteCarlo::PopulationControl )
+%include "MonteCarlo_PopulationControl.hpp"
+
+//---------------------------------------------------------------------------//
+// Add WeightWindowMesh support
+//---------------------------------------------------------------------------//
+
+%ignore MonteCarlo::WeightWindow;
+%ignore *::getWeightWindow;
+%ignore *::isParticleInWeightWindowDiscretization;
+%ignore *::setWeightWindowMap;
+%ignore *::getWeightWindowMap;
+
+%shared_ptr( MonteCarlo::WeightWindowBase )
+%include "MonteCarlo_WeightWindow.hpp"
+
+%shared_ptr( MonteCarlo::WeightWindowMesh )
+%include "MonteCarlo_WeightWindowMesh.hpp"
+
+//---------------------------------------------------------------------------//
+// Add WeightWindowMeshGenerator support
+//---------------------------------------------------------------------------//
+
+%ignore *::broadcastWeightWindows;
+%ignore *::getMeshFluxEstimator;
+
+%shared_ptr( MonteCarlo::WeightWindowMeshGenerator )
+%include "MonteCarlo_WeightWindowMeshGenerator.hpp"
+
+//---------------------------------------------------------------------------//
+// Add ImportanceMesh support
+//---------------------------------------------------------------------------//
+
+%ignore *::getImportance;
+%ignore *::isParticleInImportanceDiscretization;
+%ignore *::setImportanceMap;
+%ignore *::getImportanceMap;
+
+%shared_ptr( MonteCarlo::Importance )
+%include "MonteCarlo_Importance.hpp"
+
+%shared_ptr( MonteCarlo::ImportanceMesh )
+%include "MonteCarlo_ImportanceMesh.hpp"
+
+//---------------------------------------------------------------------------//
+// Add CADISGenerator support
+//---------------------------------------------------------------------------//
+
+// Import the MonteCarlo_ParticleDistribution.hpp
+%shared_ptr( MonteCarlo::ParticleDistribution )
+%import "MonteCarlo_ParticleDistribution.hpp"
+
+// Add typemaps for converting a Python dictionary of mesh element bin values
+%typemap(in) const MonteCarlo::CADISGenerator::MeshElementBinValueMap& ( MonteCarlo::CADISGenerator::MeshElementBinValueMap temp ){
+  temp = PyFrensie::convertFromPython<MonteCarlo::CADISGenerator::MeshElementBinValueMap>( $input );
+  $1 = &temp;
+}
+
+%typemap(typecheck, precedence=1140) (const MonteCarlo::CADISGenerator::MeshElementBinValueMap&) {
+  $1 = (PyFrensie::PythonTypeTraits<MonteCarlo::CADISGenerator::MeshElementBinValueMap>::isConvertable( $input )) ? 1 : 0;
+}
+
+%apply const MonteCarlo::CADISGenerator::MeshElementBinValueMap& {
+  const MonteCarlo::CADISParticleDistribution::MeshElementBinValueMap& }
+
+// Return the mesh element bin values as a Python dictionary
+%typemap(out) const MonteCarlo::CADISGenerator::MeshElementBinValueMap& {
+  $result = PyFrensie::convertToPython( *$1 );
+}
+
+%typemap(in,numinputs=0) MonteCarlo::CADISGenerator::MeshElementBinValueMap& biased_source_strengths (MonteCarlo::CADISGenerator::MeshElementBinValueMap temp) "$1 = &temp;"
+
+%typemap(argout) MonteCarlo::CADISGenerator::MeshElementBinValueMap& biased_source_strengths {
+  %append_output(PyFrensie::convertToPython( *$1 ) );
+}
+
+%typemap(in,numinputs=0) MonteCarlo::CADISGenerator::MeshElementBinValueMap& adjoint_source_strengths (MonteCarlo::CADISGenerator::MeshElementBinValueMap temp) "$1 = &temp;"
+
+%typemap(argout) MonteCarlo::CADISGenerator::MeshElementBinValueMap& adjoint_source_strengths {
+  %append_output(PyFrensie::convertToPython( *$1 ) );
+}
+
+// Ignore the functions that use DimensionCounterMap
+%ignore *::initializeDimensionCounters;
+%ignore *::sampleAndRecordTrials;
+%ignore *::sampleWithDimensionValueAndRecordTrials;
+
+%shared_ptr( MonteCarlo::CADISParticleDistribution )
+%include "MonteCarlo_CADISParticleDistribution.hpp"
+
+%shared_ptr( MonteCarlo::CADISGenerator )
+%include "MonteCarlo_CADISGenerator.hpp"
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_PopulationControl.i
+//---------------------------------------------------------------------------//
@@ -52,6 +52,35 @@ MonteCarlo::PROPERTIES::setImplicitCaptureModeOn;
 %feature("autodoc", "isImplicitCaptureModeOn(PROPERTIES self) -> bool")
 MonteCarlo::PROPERTIES::isImplicitCaptureModeOn;
 
+// Set k-eigenvalue mode on/off
+%feature("autodoc", "setKEigenvalueModeOn(PROPERTIES self) -> void")
+MonteCarlo::PROPERTIES::setKEigenvalueModeOn;
+
+%feature("autodoc", "setFixedSourceModeOn(PROPERTIES self) -> void")
+MonteCarlo::PROPERTIES::setFixedSourceModeOn;
+
+%feature("autodoc", "isKEigenvalueModeOn(PROPERTIES self) -> bool")
+MonteCarlo::PROPERTIES::isKEigenvalueModeOn;
+
+// Set/get the k-eigenvalue cycle parameters
+%feature("autodoc", "setNumberOfHistoriesPerCycle(PROPERTIES self, const unsigned histories_per_cycle) -> void")
+MonteCarlo::PROPERTIES::setNumberOfHistoriesPerCycle;
+
+%feature("autodoc", "getNumberOfHistoriesPerCycle(PROPERTIES self) -> unsigned")
+MonteCarlo::PROPERTIES::getNumberOfHistoriesPerCycle;
+
+%feature("autodoc", "setNumberOfInactiveCycles(PROPERTIES self, const unsigned inactive_cycles) -> void")
+MonteCarlo::PROPERTIES::setNumberOfInactiveCycles;
+
+%feature("autodoc", "getNumberOfInactiveCycles(PROPERTIES self) -> unsigned")
+MonteCarlo::PROPERTIES::getNumberOfInactiveCycles;
+
+%feature("autodoc", "setNumberOfActiveCycles(PROPERTIES self, const unsigned active_cycles) -> void")
+MonteCarlo::PROPERTIES::setNumberOfActiveCycles;
+
+%feature("autodoc", "getNumberOfActiveCycles(PROPERTIES self) -> unsigned")
+MonteCarlo::PROPERTIES::getNumberOfActiveCycles;
+
 // Set/get max energy
 %feature("autodoc", "setNumberOfBatchesPerProcessor(PROPERTIES self, const unsigned batches_per_processor) -> void")
 MonteCarlo::PROPERTIES::setNumberOfBatchesPerProcessor;
@@ -59,6 +88,23 @@ MonteCarlo::PROPERTIES::setNumberOfBatchesPerProcessor;
 %feature("autodoc", "getNumberOfBatchesPerProcessor(PROPERTIES self) -> unsigned")
 MonteCarlo::PROPERTIES::getNumberOfBatchesPerProcessor;
 
+// Set/get max number of snapshots
+%feature("autodoc", "setMaxNumberOfSnapshots(PROPERTIES self, const uint64_t max_number_of_snapshots) -> void")
+MonteCarlo::PROPERTIES::setMaxNumberOfSnapshots;
+
+%feature("autodoc", "getMaxNumberOfSnapshots(PROPERTIES self) -> uint64_t")
+MonteCarlo::PROPERTIES::getMaxNumberOfSnapshots;
+
+// Set discard oldest snapshots/thin snapshots mode
+%feature("autodoc", "setDiscardOldestSnapshotsModeOn(PROPERTIES self) -> void")
+MonteCarlo::PROPERTIES::setDiscardOldestSnapshotsModeOn;
+
+%feature("autodoc", "setThinSnapshotsModeOn(PROPERTIES self) -> void")
+MonteCarlo::PROPERTIES::setThinSnapshotsModeOn;
+
+%feature("autodoc", "isDiscardOldestSnapshotsModeOn(PROPERTIES self) -> bool")
+MonteCarlo::PROPERTIES::isDiscardOldestSnapshotsModeOn;
+
 
 %enddef
 
@@ -150,6 +196,13 @@ MonteCarlo::PROPERTIES::setIncoherentModelType;
 %feature("autodoc", "getIncoherentModelType(PROPERTIES self) -> IncoherentModelType")
 MonteCarlo::PROPERTIES::getIncoherentModelType;
 
+// Set/get photon scattering angle table tolerance
+%feature("autodoc", "setPhotonScatteringAngleTableTolerance(PROPERTIES self, const double tol) -> void")
+MonteCarlo::PROPERTIES::setPhotonScatteringAngleTableTolerance;
+
+%feature("autodoc", "getPhotonScatteringAngleTableTolerance(PROPERTIES self) -> double")
+MonteCarlo::PROPERTIES::getPhotonScatteringAngleTableTolerance;
+
 // Set detailed pair production mode On/Off
 %feature("autodoc", "setDetailedPairProductionModeOn(PROPERTIES self) -> void")
 MonteCarlo::PROPERTIES::setDetailedPairProductionModeOn;
@@ -221,6 +274,13 @@ MonteCarlo::PROPERTIES::setElectronEvaluationTolerance;
 %feature("autodoc", "getElectronEvaluationTolerance(PROPERTIES self) -> double")
 MonteCarlo::PROPERTIES::getElectronEvaluationTolerance;
 
+// Set/get Inverse CDF Table Tolerance
+%feature("autodoc", "setElectronInverseCDFTableTolerance(PROPERTIES self, const double tol) -> void")
+MonteCarlo::PROPERTIES::setElectronInverseCDFTableTolerance;
+
+%feature("autodoc", "getElectronInverseCDFTableTolerance(PROPERTIES self) -> double")
+MonteCarlo::PROPERTIES::getElectronInverseCDFTableTolerance;
+
 // Set Elastic Mode On/Off
 %feature("autodoc", "setElasticModeOn(PROPERTIES self) -> void")
 MonteCarlo::PROPERTIES::setElasticModeOn;
@@ -279,6 +339,13 @@ MonteCarlo::PROPERTIES::setBremsstrahlungAngularDistributionFunction;
 %feature("autodoc", "getBremsstrahlungAngularDistributionFunction(PROPERTIES self) -> BremsstrahlungAngularDistributionType")
 MonteCarlo::PROPERTIES::getBremsstrahlungAngularDistributionFunction;
 
+// Set/get Bremsstrahlung 2BS Photon Angle Table Tolerance
+%feature("autodoc", "setBremsstrahlungPhotonAngleTableTolerance(PROPERTIES self, const double tol) -> void")
+MonteCarlo::PROPERTIES::setBremsstrahlungPhotonAngleTableTolerance;
+
+%feature("autodoc", "getBremsstrahlungPhotonAngleTableTolerance(PROPERTIES self) -> double")
+MonteCarlo::PROPERTIES::getBremsstrahlungPhotonAngleTableTolerance;
+
 // Set Atomic Excitation mode On/Off
 %feature("autodoc", "setAtomicExcitationModeOn(PROPERTIES self) -> void")
 MonteCarlo::PROPERTIES::setAtomicExcitationModeOn;
@@ -27,6 +27,8 @@ conversion policies that can be used in FRENSIE and PyFrensie.
 
 #include "Utility_Mesh.hpp"
 #include "Utility_StructuredHexMesh.hpp"
+#include "Utility_StructuredCylindricalMesh.hpp"
+#include "Utility_StructuredSphericalMesh.hpp"
 #include "Utility_TetMesh.hpp"
 
 // Add the Utility namespace to the global lookup scope
@@ -165,6 +167,46 @@ typedef unsigned long int uint64_t;
 %shared_ptr(Utility::StructuredHexMesh)
 %include "Utility_StructuredHexMesh.hpp"
 
+// ---------------------------------------------------------------------------//
+// Add StructuredCylindricalMesh support
+// ---------------------------------------------------------------------------//
+
+// Extend Mesh classes to return the mesh element list as a vector
+%extend Utility::StructuredCylindricalMesh
+{
+  // Return the mesh element list
+  void getElementHandles( std::vector<Utility::Mesh::ElementHandle>& element_handles ) const
+  {
+    std::vector<Utility::Mesh::ElementHandle>::const_iterator begin = $self->getStartElementHandleIterator();
+    std::vector<Utility::Mesh::ElementHandle>::const_iterator end = $self->getEndElementHandleIterator();
+
+    element_handles.insert( element_handles.begin(), begin, end );
+  }
+};
+
+%shared_ptr(Utility::StructuredCylindricalMesh)
+%include "Utility_StructuredCylindricalMesh.hpp"
+
+// ---------------------------------------------------------------------------//
+// Add StructuredSphericalMesh support
+// ---------------------------------------------------------------------------//
+
+// Extend Mesh classes to return the mesh element list as a vector
+%extend Utility::StructuredSphericalMesh
+{
+  // Return the mesh element list
+  void getElementHandles( std::vector<Utility::Mesh::ElementHandle>& element_handles ) const
+  {
+    std::vector<Utility::Mesh::ElementHandle>::const_iterator begin = $self->getStartElementHandleIterator();
+    std::vector<Utility::Mesh::ElementHandle>::const_iterator end = $self->getEndElementHandleIterator();
+
+    element_handles.insert( element_handles.begin(), begin, end );
+  }
+};
+
+%shared_ptr(Utility::StructuredSphericalMesh)
+%include "Utility_StructuredSphericalMesh.hpp"
+
 // ---------------------------------------------------------------------------//
 // Add TetMesh support
 // ---------------------------------------------------------------------------//
@@ -0,0 +1,39 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Data_SabSecondaryEnergyMode.cpp
+//! \author Alex Robinson
+//! \brief  S(a,b) inelastic secondary energy mode enumeration helper functions
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <stdexcept>
+#include <sstream>
+
+// FRENSIE Includes
+#include "Data_SabSecondaryEnergyMode.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+
+namespace Data{
+
+// Convert an unsigned int to a SabSecondaryEnergyMode
+SabSecondaryEnergyMode convertUnsignedToSabSecondaryEnergyMode(
+                                                         const unsigned mode )
+{
+  switch( mode )
+  {
+  case 0u: return EQUIPROBABLE_SECONDARY_ENERGY_MODE;
+  case 1u: return SKEWED_SECONDARY_ENERGY_MODE;
+  case 2u: return CONTINUOUS_SECONDARY_ENERGY_MODE;
+  default:
+    THROW_EXCEPTION( std::runtime_error,
+		     "Error: S(a,b) secondary energy mode " << mode <<
+		     " is not supported.\n" );
+  }
+}
+
+} // end Data namespace
+
+//---------------------------------------------------------------------------//
+// end Data_SabSecondaryEnergyMode.cpp
+//---------------------------------------------------------------------------//
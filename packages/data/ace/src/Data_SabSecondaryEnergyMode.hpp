@@ -0,0 +1,32 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Data_SabSecondaryEnergyMode.hpp
+//! \author Alex Robinson
+//! \brief  The S(a,b) inelastic secondary energy mode enumeration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef DATA_SAB_SECONDARY_ENERGY_MODE_HPP
+#define DATA_SAB_SECONDARY_ENERGY_MODE_HPP
+
+namespace Data{
+
+//! The S(a,b) inelastic secondary energy mode enumeration
+enum SabSecondaryEnergyMode
+{
+  EQUIPROBABLE_SECONDARY_ENERGY_MODE = 0,
+  SKEWED_SECONDARY_ENERGY_MODE = 1,
+  CONTINUOUS_SECONDARY_ENERGY_MODE = 2
+};
+
+//! Convert an unsigned int to a SabSecondaryEnergyMode
+SabSecondaryEnergyMode convertUnsignedToSabSecondaryEnergyMode(
+                                                        const unsigned mode );
+
+} // end Data namespace
+
+#endif // end DATA_SAB_SECONDARY_ENERGY_MODE_HPP
+
+//---------------------------------------------------------------------------//
+// end Data_SabSecondaryEnergyMode.hpp
+//---------------------------------------------------------------------------//
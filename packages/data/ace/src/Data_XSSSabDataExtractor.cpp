@@ -99,6 +99,46 @@ SabElasticMode XSSSabDataExtractor::getElasticScatteringMode() const
 }
 
 // Extract the ITIE block from the XSS array
+// Return the inelastic secondary energy mode
+SabSecondaryEnergyMode
+XSSSabDataExtractor::getInelasticSecondaryEnergyMode() const
+{
+  try{
+    return convertUnsignedToSabSecondaryEnergyMode( d_nxs[6] );
+  }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error,
+			   "Error: invalid secondary energy mode found "
+			   "while parsing nxs array.\n" );
+}
+
+// Return the number of outgoing energies per inelastic incoming energy
+/*! \details This value is only meaningful when the secondary energy mode is
+ * not continuous (with the continuous mode the number of outgoing energies
+ * varies with the incoming energy).
+ */
+size_t XSSSabDataExtractor::getNumberOfInelasticOutgoingEnergies() const
+{
+  return d_nxs[3];
+}
+
+// Return the number of inelastic scattering angle cosines
+size_t XSSSabDataExtractor::getNumberOfInelasticScatteringAngleCosines() const
+{
+  return d_nxs[2] + 1;
+}
+
+// Return the number of elastic scattering angle cosines
+/*! \details If there is no elastic angular distribution data 0 will be
+ * returned.
+ */
+size_t XSSSabDataExtractor::getNumberOfElasticScatteringAngleCosines() const
+{
+  if( this->hasElasticScatteringAngularDistributionData() )
+    return d_nxs[5] + 1;
+  else
+    return 0;
+}
+
 Utility::ArrayView<const double> XSSSabDataExtractor::extractITIEBlock() const
 {
   return d_itie_block;
@@ -23,6 +23,7 @@
 // FRENSIE Includes
 #include "Data_SabInelasticMode.hpp"
 #include "Data_SabElasticMode.hpp"
+#include "Data_SabSecondaryEnergyMode.hpp"
 
 /*! \defgroup neutron_sab_table Neutron S(a,b) Table
  * \ingroup ace_table
@@ -76,6 +77,18 @@ public:
   //! Return the elastic scattering mode
   SabElasticMode getElasticScatteringMode() const;
 
+  //! Return the inelastic secondary energy mode
+  SabSecondaryEnergyMode getInelasticSecondaryEnergyMode() const;
+
+  //! Return the number of outgoing energies per inelastic incoming energy
+  size_t getNumberOfInelasticOutgoingEnergies() const;
+
+  //! Return the number of inelastic scattering angle cosines
+  size_t getNumberOfInelasticScatteringAngleCosines() const;
+
+  //! Return the number of elastic scattering angle cosines
+  size_t getNumberOfElasticScatteringAngleCosines() const;
+
   //! Extract the ITIE block from the XSS array
   Utility::ArrayView<const double> extractITIEBlock() const;
 
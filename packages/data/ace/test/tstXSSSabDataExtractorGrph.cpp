@@ -205,6 +205,34 @@ FRENSIE_UNIT_TEST( XSSSabDataExtractor,
   FRENSIE_CHECK_EQUAL( itca_block.size(), 0 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the XSSSabDataExtractor can return the inelastic outgoing
+// energy and scattering angle cosine table dimensions
+FRENSIE_UNIT_TEST( XSSSabDataExtractor,
+                   getInelasticTableDimensions_grph )
+{
+  FRENSIE_CHECK( xss_data_extractor_grph->getInelasticSecondaryEnergyMode() !=
+                 Data::CONTINUOUS_SECONDARY_ENERGY_MODE );
+  FRENSIE_CHECK( xss_data_extractor_grph->getNumberOfInelasticOutgoingEnergies() > 0 );
+  FRENSIE_CHECK( xss_data_extractor_grph->getNumberOfInelasticScatteringAngleCosines() > 0 );
+
+  // Each incoming energy has a table of outgoing energies and cosines
+  FRENSIE_CHECK_EQUAL( xss_data_extractor_grph->extractITXEBlock().size(),
+                       xss_data_extractor_grph->extractInelasticEnergyGrid().size()*
+                       xss_data_extractor_grph->getNumberOfInelasticOutgoingEnergies()*
+                       (xss_data_extractor_grph->getNumberOfInelasticScatteringAngleCosines()+1) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the XSSSabDataExtractor can return the number of elastic
+// scattering angle cosines
+FRENSIE_UNIT_TEST( XSSSabDataExtractor,
+                   getNumberOfElasticScatteringAngleCosines_grph )
+{
+  FRENSIE_CHECK_EQUAL( xss_data_extractor_grph->getNumberOfElasticScatteringAngleCosines(),
+                       0 );
+}
+
 //---------------------------------------------------------------------------//
 // Custom setup
 //---------------------------------------------------------------------------//
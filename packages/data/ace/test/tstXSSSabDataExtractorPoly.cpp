@@ -200,6 +200,37 @@ FRENSIE_UNIT_TEST( XSSSabDataExtractor, extractITCABlock_poly )
   FRENSIE_CHECK_EQUAL( itca_block.back(), 9.99961210000e-01 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the XSSSabDataExtractor can return the inelastic outgoing
+// energy and scattering angle cosine table dimensions
+FRENSIE_UNIT_TEST( XSSSabDataExtractor,
+                   getInelasticTableDimensions_poly )
+{
+  FRENSIE_CHECK( xss_data_extractor_poly->getInelasticSecondaryEnergyMode() !=
+                 Data::CONTINUOUS_SECONDARY_ENERGY_MODE );
+  FRENSIE_CHECK( xss_data_extractor_poly->getNumberOfInelasticOutgoingEnergies() > 0 );
+  FRENSIE_CHECK( xss_data_extractor_poly->getNumberOfInelasticScatteringAngleCosines() > 0 );
+
+  // Each incoming energy has a table of outgoing energies and cosines
+  FRENSIE_CHECK_EQUAL( xss_data_extractor_poly->extractITXEBlock().size(),
+                       xss_data_extractor_poly->extractInelasticEnergyGrid().size()*
+                       xss_data_extractor_poly->getNumberOfInelasticOutgoingEnergies()*
+                       (xss_data_extractor_poly->getNumberOfInelasticScatteringAngleCosines()+1) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the XSSSabDataExtractor can return the number of elastic
+// scattering angle cosines
+FRENSIE_UNIT_TEST( XSSSabDataExtractor,
+                   getNumberOfElasticScatteringAngleCosines_poly )
+{
+  FRENSIE_CHECK_EQUAL( xss_data_extractor_poly->getNumberOfElasticScatteringAngleCosines(),
+                       20 );
+  FRENSIE_CHECK_EQUAL( xss_data_extractor_poly->extractITCABlock().size(),
+                       xss_data_extractor_poly->extractElasticEnergyGrid().size()*
+                       xss_data_extractor_poly->getNumberOfElasticScatteringAngleCosines() );
+}
+
 //---------------------------------------------------------------------------//
 // Custom setup
 //---------------------------------------------------------------------------//
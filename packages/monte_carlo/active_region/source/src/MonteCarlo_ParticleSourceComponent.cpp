@@ -9,7 +9,6 @@
 // Std Lib Includes
 #include <sstream>
 #include <functional>
-#include <numeric>
 #include <limits>
 
 // FRENSIE Includes
@@ -109,11 +108,8 @@ void ParticleSourceComponent::resetData()
   // Make sure only the root process calls this function
   testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
 
-  for( size_t i = 0; i < d_number_of_trials.size(); ++i )
-  {
-    d_number_of_trials[i] = 0;
-    d_number_of_samples[i] = 0;
-  }
+  d_number_of_trials.fill( 0 );
+  d_number_of_samples.fill( 0 );
 
   // Reset the derived class data
   this->resetDataImpl();
@@ -183,25 +179,18 @@ void ParticleSourceComponent::sampleParticleState(
                     d_number_of_samples.size() );
 
   // Just-in-time initialization of the navigator
-  if( !d_navigator[Utility::OpenMPProperties::getThreadId()].get() )
-  {
-    d_navigator[Utility::OpenMPProperties::getThreadId()] =
-      d_model->createNavigator();
-  }
+  if( !d_navigator.local().get() )
+    d_navigator.local() = d_model->createNavigator();
 
   // Cache some data for this thread in case they need to be
   // accessed multiple times
-  const Geometry::Navigator& navigator =
-    *d_navigator[Utility::OpenMPProperties::getThreadId()];
+  const Geometry::Navigator& navigator = *d_navigator.local();
 
-  Counter& trial_counter =
-    d_number_of_trials[Utility::OpenMPProperties::getThreadId()];
+  Counter& trial_counter = d_number_of_trials.local();
 
-  Counter& sample_counter =
-    d_number_of_samples[Utility::OpenMPProperties::getThreadId()];
+  Counter& sample_counter = d_number_of_samples.local();
 
-  CellIdSet& start_cell_cache =
-    d_start_cell_cache[Utility::OpenMPProperties::getThreadId()];
+  CellIdSet& start_cell_cache = d_start_cell_cache.local();
 
   // Determine the number of samples that must be made
   unsigned long long number_of_samples =
@@ -428,8 +417,7 @@ void ParticleSourceComponent::mergeStartingCells(
   }
 
   // Distribute the merged cache to all threads
-  for( size_t i = 0; i < d_start_cell_cache.size(); ++i )
-    d_start_cell_cache[i] = start_cell_cache;
+  d_start_cell_cache.fill( start_cell_cache );
 }
 
 // Merge the local starting cells
@@ -464,15 +452,28 @@ void ParticleSourceComponent::reduceTrialCounters(
 }
 
 // Reduce the counters on the root process
-void ParticleSourceComponent::reduceCounters( std::vector<Counter>& counters,
-                                              const Utility::Communicator& comm,
-                                              const int root_process )
+/*! \details The reduced count will be stored in the master thread counter
+ * of the root process. All other counters will be reset.
+ */
+void ParticleSourceComponent::reduceCounters(
+                                          Utility::PerThread<Counter>& counters,
+                                          const Utility::Communicator& comm,
+                                          const int root_process )
 {
+  const Counter local_count = counters.reduce( 0ull, std::plus<Counter>() );
+
   try{
     if( comm.rank() != root_process )
-      Utility::reduce( comm, counters, std::plus<Counter>(), root_process );
+      Utility::reduce( comm, local_count, std::plus<Counter>(), root_process );
     else
-      Utility::reduce( comm, std::vector<Counter>(counters), counters, std::plus<Counter>(), root_process );
+    {
+      Counter reduced_count = 0ull;
+
+      Utility::reduce( comm, local_count, reduced_count, std::plus<Counter>(), root_process );
+
+      counters.fill( 0ull );
+      counters.front() = reduced_count;
+    }
   }
   EXCEPTION_CATCH_RETHROW( std::runtime_error,
                            "unable to reduce the counters!" );
@@ -481,17 +482,13 @@ void ParticleSourceComponent::reduceCounters( std::vector<Counter>& counters,
 // Reduce the local samples counters
 auto ParticleSourceComponent::reduceLocalSampleCounters() const -> Counter
 {
-  return std::accumulate( d_number_of_samples.begin(),
-                          d_number_of_samples.end(),
-                          0ull );
+  return d_number_of_samples.reduce( 0ull, std::plus<Counter>() );
 }
 
 // Reduce the local trials counters
 auto ParticleSourceComponent::reduceLocalTrialCounters() const -> Counter
 {
-  return std::accumulate( d_number_of_trials.begin(),
-                          d_number_of_trials.end(),
-                          0ull );
+  return d_number_of_trials.reduce( 0ull, std::plus<Counter>() );
 }
 
 // Check if the sampled particle position is valid
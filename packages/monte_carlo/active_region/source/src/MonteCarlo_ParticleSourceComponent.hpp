@@ -26,6 +26,7 @@
 #include "Geometry_Model.hpp"
 #include "Geometry_Navigator.hpp"
 #include "Utility_Communicator.hpp"
+#include "Utility_PerThread.hpp"
 #include "Utility_DistributionTraits.hpp"
 #include "Utility_TypeNameTraits.hpp"
 #include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
@@ -190,7 +191,7 @@ private:
                             const int root_process );
 
   // Reduce the counters on the root process
-  static void reduceCounters( std::vector<Counter>& counters,
+  static void reduceCounters( Utility::PerThread<Counter>& counters,
                               const Utility::Communicator& comm,
                               const int root_process );
 
@@ -230,16 +231,16 @@ private:
   std::shared_ptr<const Geometry::Model> d_model;
 
   // The navigator for the model that the source is embedded in
-  std::vector<std::shared_ptr<const Geometry::Navigator> > d_navigator;
+  Utility::PerThread<std::shared_ptr<const Geometry::Navigator> > d_navigator;
 
   // The start cell cache
-  std::vector<CellIdSet> d_start_cell_cache;
+  Utility::PerThread<CellIdSet> d_start_cell_cache;
 
   // The number of trials
-  std::vector<Counter> d_number_of_trials;
+  Utility::PerThread<Counter> d_number_of_trials;
 
   // The number of valid samples
-  std::vector<Counter> d_number_of_samples;
+  Utility::PerThread<Counter> d_number_of_samples;
 };
 
 // Save the data to an archive
@@ -19,6 +19,7 @@
 #include "MonteCarlo_PhotonState.hpp"
 #include "MonteCarlo_ElectronState.hpp"
 #include "MonteCarlo_PositronState.hpp"
+#include "Utility_PerThread.hpp"
 
 namespace MonteCarlo{
 
@@ -90,6 +91,9 @@ protected:
   //! Typedef for the dimension trial counter map
   typedef ParticleDistribution::DimensionCounterMap DimensionCounterMap;
 
+  //! Typedef for the thread dimension counter maps
+  typedef Utility::PerThread<DimensionCounterMap> ThreadDimensionCounterMaps;
+
   //! Default Constructor
   StandardParticleSourceComponent();
 
@@ -145,7 +149,7 @@ private:
 
   // Reduce the dimension counters on the comm
   static void reduceDimensionCounters(
-                          std::vector<DimensionCounterMap>& dimension_counters,
+                          ThreadDimensionCounterMaps& dimension_counters,
                           const Utility::Communicator& comm,
                           const int root_process );
 
@@ -158,9 +162,10 @@ private:
                          DimensionCounterMap& dimension_trial_counters ) const;
 
   // Reduce the dimension counters
+  template<typename DimensionCounterMapContainer>
   static void reduceAllDimensionCounters(
            DimensionCounterMap& dimension_counters,
-           const std::vector<DimensionCounterMap>& all_dimension_counters );
+           const DimensionCounterMapContainer& all_dimension_counters );
 
   // Reduce the local dimension sample counters
   Counter reduceLocalDimensionSampleCounters(
@@ -173,7 +178,7 @@ private:
   // Reduce the dimension counter
   static Counter reduceDimensionCounters(
                const PhaseSpaceDimension dimension,
-               const std::vector<DimensionCounterMap>& dimension_counters );
+               const ThreadDimensionCounterMaps& dimension_counters );
 
   // Initialize the dimension sample counters
   void initializeDimensionSampleCounters();
@@ -183,11 +188,7 @@ private:
 
   // Initialize the dimension counters
   void initializeDimensionCounters(
-                     std::vector<DimensionCounterMap>& dimension_counters );
-
-  // Initialize the dimension counters
-  void initializeDimensionCounters(
-           const Utility::ArrayView<DimensionCounterMap>& dimension_counters );
+                              ThreadDimensionCounterMaps& dimension_counters );
 
   // Save the data to an archive
   template<typename Archive>
@@ -206,10 +207,10 @@ private:
   std::shared_ptr<const ParticleDistribution> d_particle_distribution;
 
   // The dimension trial counters
-  std::vector<DimensionCounterMap> d_dimension_trial_counters;
+  ThreadDimensionCounterMaps d_dimension_trial_counters;
 
   // The dimension samples counters
-  std::vector<DimensionCounterMap> d_dimension_sample_counters;
+  ThreadDimensionCounterMaps d_dimension_sample_counters;
 };
 
 //! The standard neutron source component
@@ -187,25 +187,16 @@ void StandardParticleSourceComponent<ParticleStateType>::enableThreadSupportImpl
   // Make sure a valid number of threads has been requested
   testPrecondition( threads > 0 );
 
-  // Determine the number of new thread to support
-  int number_of_threads = d_dimension_trial_counters.size();
-  int number_of_new_threads = threads - number_of_threads;
-
-  if( number_of_new_threads > 0 )
+  if( threads > d_dimension_trial_counters.size() )
   {
-    d_dimension_trial_counters.resize( threads );
-    d_dimension_sample_counters.resize( threads );
-
-    // Initialize the dimension counters
-    this->initializeDimensionCounters(
-            Utility::ArrayView<DimensionCounterMap>(
-                           d_dimension_trial_counters.data()+number_of_threads,
-                           number_of_new_threads ) );
-
-    this->initializeDimensionCounters(
-            Utility::ArrayView<DimensionCounterMap>(
-                          d_dimension_sample_counters.data()+number_of_threads,
-                          number_of_new_threads ) );
+    // The new thread dimension counters will be constructed by their threads
+    DimensionCounterMap initial_dimension_counters;
+
+    d_particle_distribution->initializeDimensionCounters(
+                                                  initial_dimension_counters );
+
+    d_dimension_trial_counters.resize( threads, initial_dimension_counters );
+    d_dimension_sample_counters.resize( threads, initial_dimension_counters );
   }
 }
 
@@ -292,10 +283,10 @@ bool StandardParticleSourceComponent<ParticleStateType>::sampleParticleStateImpl
   testPrecondition( history_state_id < this->getNumberOfParticleStateSamples(particle->getHistoryNumber()) );
 
   DimensionCounterMap& dimension_trial_counters =
-    d_dimension_trial_counters[Utility::OpenMPProperties::getThreadId()];
+    d_dimension_trial_counters.local();
 
   DimensionCounterMap& dimension_sample_counters =
-    d_dimension_sample_counters[Utility::OpenMPProperties::getThreadId()];
+    d_dimension_sample_counters.local();
 
   d_particle_distribution->sampleAndRecordTrials( *particle, dimension_trial_counters );
 
@@ -332,7 +323,7 @@ void StandardParticleSourceComponent<ParticleStateType>::reduceDimensionTrialCou
 // Reduce the dimension counters on the comm
 template<typename ParticleStateType>
 void StandardParticleSourceComponent<ParticleStateType>::reduceDimensionCounters(
-            std::vector<DimensionCounterMap>& dimension_counters,
+            ThreadDimensionCounterMaps& dimension_counters,
             const Utility::Communicator& comm,
             const int root_process )
 {
@@ -383,9 +374,10 @@ void StandardParticleSourceComponent<ParticleStateType>::reduceAllLocalDimension
 
 // Reduce the dimension counters
 template<typename ParticleStateType>
+template<typename DimensionCounterMapContainer>
 void StandardParticleSourceComponent<ParticleStateType>::reduceAllDimensionCounters(
                DimensionCounterMap& dimension_counters,
-               const std::vector<DimensionCounterMap>& all_dimension_counters )
+               const DimensionCounterMapContainer& all_dimension_counters )
 {
   for( size_t i = 0; i < all_dimension_counters.size(); ++i )
   {
@@ -432,7 +424,7 @@ auto StandardParticleSourceComponent<ParticleStateType>::reduceLocalDimensionTri
 template<typename ParticleStateType>
 auto StandardParticleSourceComponent<ParticleStateType>::reduceDimensionCounters(
         const PhaseSpaceDimension dimension,
-        const std::vector<DimensionCounterMap>& dimension_counters ) -> Counter
+        const ThreadDimensionCounterMaps& dimension_counters ) -> Counter
 {
   Counter counter = 0;
 
@@ -460,18 +452,10 @@ void StandardParticleSourceComponent<ParticleStateType>::initializeDimensionTria
   this->initializeDimensionCounters( d_dimension_trial_counters );
 }
 
-// Initialize the dimension counters
-template<typename ParticleStateType>
-inline void StandardParticleSourceComponent<ParticleStateType>::initializeDimensionCounters(
-                         std::vector<DimensionCounterMap>& dimension_counters )
-{
-  this->initializeDimensionCounters( Utility::arrayView(dimension_counters) );
-}
-
 // Initialize the dimension counters
 template<typename ParticleStateType>
 void StandardParticleSourceComponent<ParticleStateType>::initializeDimensionCounters(
-            const Utility::ArrayView<DimensionCounterMap>& dimension_counters )
+                               ThreadDimensionCounterMaps& dimension_counters )
 {
   for( size_t i = 0; i < dimension_counters.size(); ++i )
     d_particle_distribution->initializeDimensionCounters( dimension_counters[i] );
@@ -481,14 +465,14 @@ void StandardParticleSourceComponent<ParticleStateType>::initializeDimensionCoun
 template<typename ParticleStateType>
 auto StandardParticleSourceComponent<ParticleStateType>::getDimensionTrialCounterMap() -> DimensionCounterMap&
 {
-  return d_dimension_trial_counters[Utility::OpenMPProperties::getThreadId()];
+  return d_dimension_trial_counters.local();
 }
 
 // Get the dimension sample counters
 template<typename ParticleStateType>
 auto StandardParticleSourceComponent<ParticleStateType>::getDimensionSampleCounterMap() -> DimensionCounterMap&
 {
-  return d_dimension_sample_counters[Utility::OpenMPProperties::getThreadId()];
+  return d_dimension_sample_counters.local();
 }
 
 // Increment the dimension counters
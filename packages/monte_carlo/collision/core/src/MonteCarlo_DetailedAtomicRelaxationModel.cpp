@@ -8,6 +8,7 @@
 
 // FRENSIE Includes
 #include "MonteCarlo_DetailedAtomicRelaxationModel.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_DesignByContract.hpp"
 
 namespace MonteCarlo{
@@ -17,6 +18,9 @@ namespace MonteCarlo{
  * info
  */
 DetailedAtomicRelaxationModel::DetailedAtomicRelaxationModel()
+  : d_subshell_relaxation_models(),
+    d_min_photon_energy( 0.0 ),
+    d_min_electron_energy( 0.0 )
 { /* ... */ }
 
 // Constructor
@@ -41,14 +45,23 @@ DetailedAtomicRelaxationModel::DetailedAtomicRelaxationModel(
     const std::shared_ptr<const SubshellRelaxationModel>& model =
       subshell_relaxation_models[i];
 
+    const size_t subshell_index = model->getVacancySubshell();
+
+    if( subshell_index >= d_subshell_relaxation_models.size() )
+      d_subshell_relaxation_models.resize( subshell_index+1 );
+
     // Neglect duplicate models
-    if( d_subshell_relaxation_models.find( model->getVacancySubshell() ) ==
-	d_subshell_relaxation_models.end() )
-      d_subshell_relaxation_models[model->getVacancySubshell()] = model;
+    if( !d_subshell_relaxation_models[subshell_index] )
+      d_subshell_relaxation_models[subshell_index] = model;
   }
 }
 
 // Relax the atom
+/*! \details The vacancies are relaxed in the same order that a recursive
+ * relaxation would relax them (the primary vacancy created in a transition
+ * and all of its subsequent vacancies are relaxed before the secondary
+ * vacancy).
+ */
 void
 DetailedAtomicRelaxationModel::relaxAtom(
                                         const Data::SubshellType vacancy_shell,
@@ -56,14 +69,24 @@ DetailedAtomicRelaxationModel::relaxAtom(
                                         ParticleBank& bank ) const
 {
   // Check if the vacancy shell has relaxation data
-  if( d_subshell_relaxation_models.find( vacancy_shell ) !=
-      d_subshell_relaxation_models.end() )
+  if( !this->getSubshellRelaxationModel( vacancy_shell ) )
+    return;
+
+  Data::SubshellType pending_vacancy_shells[s_max_number_of_pending_vacancies];
+  size_t number_of_pending_vacancies = 0;
+
+  pending_vacancy_shells[number_of_pending_vacancies++] = vacancy_shell;
+
+  while( number_of_pending_vacancies > 0 )
   {
-    // Recursively relax subshells
-    Data::SubshellType primary_vacancy_shell, secondary_vacancy_shell;
+    const SubshellRelaxationModel* model = this->getSubshellRelaxationModel(
+            pending_vacancy_shells[--number_of_pending_vacancies] );
 
-    const std::shared_ptr<const SubshellRelaxationModel>& model =
-      d_subshell_relaxation_models.find( vacancy_shell )->second;
+    // Vacancies in subshells without relaxation data are ignored
+    if( !model )
+      continue;
+
+    Data::SubshellType primary_vacancy_shell, secondary_vacancy_shell;
 
     model->relaxSubshell( particle,
                           d_min_photon_energy,
@@ -72,11 +95,27 @@ DetailedAtomicRelaxationModel::relaxAtom(
 			  primary_vacancy_shell,
 			  secondary_vacancy_shell );
 
-    // Relax the new vacancy
-    this->relaxAtom( primary_vacancy_shell, particle, bank );
+    // The vacancies must move to less tightly bound subshells
+    TEST_FOR_EXCEPTION( number_of_pending_vacancies + 2 >
+                        s_max_number_of_pending_vacancies,
+                        std::runtime_error,
+                        "The relaxation cascade that started with a vacancy "
+                        "in subshell " << vacancy_shell << " has too many "
+                        "pending vacancies - the relaxation data is "
+                        "invalid!" );
+
+    // Relax the secondary vacancy after the new vacancy
+    if( this->getSubshellRelaxationModel( secondary_vacancy_shell ) )
+    {
+      pending_vacancy_shells[number_of_pending_vacancies++] =
+        secondary_vacancy_shell;
+    }
 
-    // Relax the secondary vacancy
-    this->relaxAtom( secondary_vacancy_shell, particle, bank );
+    if( this->getSubshellRelaxationModel( primary_vacancy_shell ) )
+    {
+      pending_vacancy_shells[number_of_pending_vacancies++] =
+        primary_vacancy_shell;
+    }
   }
 }
 
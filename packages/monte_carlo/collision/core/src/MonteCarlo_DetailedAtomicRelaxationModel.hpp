@@ -11,7 +11,6 @@
 
 // Std Lib Includes
 #include <memory>
-#include <unordered_map>
 
 // FRENSIE Includes
 #include "MonteCarlo_AtomicRelaxationModel.hpp"
@@ -23,7 +22,13 @@ namespace MonteCarlo{
 /*! The detailed atomic relaxation model
  * \details This model accounts for all possible transitions to fill an
  * initial vacancy. It will also follow subsequent vacancies until the atom
- * has relaxed back to its ground state.
+ * has relaxed back to its ground state. The subshell relaxation models are
+ * stored in a table that is indexed by the subshell type and the vacancies
+ * are followed using a fixed size vacancy stack (no recursion or heap
+ * allocation is required). Since the vacancies created in a transition
+ * are always in less tightly bound subshells than the vacancy that was
+ * filled, the number of pending vacancies can never exceed the number of
+ * subshell types.
  */
 class DetailedAtomicRelaxationModel : public AtomicRelaxationModel
 {
@@ -51,8 +56,16 @@ public:
 
 private:
 
-  // The map of subshells and their relaxation data
-  std::unordered_map<Data::SubshellType,std::shared_ptr<const SubshellRelaxationModel> >
+  // Return the subshell relaxation model for a vacancy subshell (if any)
+  const SubshellRelaxationModel* getSubshellRelaxationModel(
+                               const Data::SubshellType vacancy_shell ) const;
+
+  // The max number of vacancies that can be pending in a cascade
+  static const size_t s_max_number_of_pending_vacancies =
+    Data::Q3_SUBSHELL + 1;
+
+  // The subshell relaxation models (indexed by subshell type)
+  std::vector<std::shared_ptr<const SubshellRelaxationModel> >
   d_subshell_relaxation_models;
 
   // The min photon energy
@@ -62,6 +75,19 @@ private:
   double d_min_electron_energy;
 };
 
+// Return the subshell relaxation model for a vacancy subshell (if any)
+inline const SubshellRelaxationModel*
+DetailedAtomicRelaxationModel::getSubshellRelaxationModel(
+                                const Data::SubshellType vacancy_shell ) const
+{
+  // Note: The INVALID_SUBSHELL and UNKNOWN_SUBSHELL never have data
+  if( vacancy_shell > Data::UNKNOWN_SUBSHELL &&
+      vacancy_shell < d_subshell_relaxation_models.size() )
+    return d_subshell_relaxation_models[vacancy_shell].get();
+  else
+    return NULL;
+}
+
 } // end MonteCarlo namespace
 
 #endif // end MONTE_CARLO_DETAILED_ATOMIC_RELAXATION_MODEL_HPP
@@ -86,6 +86,12 @@ public:
                                        const double energy,
                                        const ReactionEnumType reaction ) const;
 
+  //! Return the macroscopic differential scattering cross sections (1/cm)
+  void getMacroscopicDifferentialScatteringCrossSections(
+           const double energy,
+           const double scattering_angle_cosine,
+           std::vector<std::pair<double,double> >& cross_sections ) const;
+
   //! Get the absorption reaction types
   void getAbsorptionReactionTypes( ReactionEnumTypeSet& reaction_types ) const;
 
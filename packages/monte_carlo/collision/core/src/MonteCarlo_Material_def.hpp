@@ -235,6 +235,40 @@ double Material<ScatteringCenter>::getMacroscopicCrossSection(
   return cross_section;
 }
 
+// Return the macroscopic differential scattering cross sections (1/cm)
+/*! \details The outgoing energy and the macroscopic cross section
+ * differential in the scattering angle cosine of every scattering reaction
+ * of every scattering center will be stored in the cross sections array
+ * (any previous contents will be removed). The scattering center type must
+ * have a getDifferentialScatteringCrossSections method.
+ */
+template<typename ScatteringCenter>
+void Material<ScatteringCenter>::getMacroscopicDifferentialScatteringCrossSections(
+           const double energy,
+           const double scattering_angle_cosine,
+           std::vector<std::pair<double,double> >& cross_sections ) const
+{
+  // Make sure the energy is valid
+  testPrecondition( !QT::isnaninf( energy ) );
+  testPrecondition( energy > 0.0 );
+  // Make sure the scattering angle cosine is valid
+  testPrecondition( scattering_angle_cosine >= -1.0 );
+  testPrecondition( scattering_angle_cosine <= 1.0 );
+
+  cross_sections.clear();
+
+  for( size_t i = 0u; i < d_scattering_centers.size(); ++i )
+  {
+    const size_t start_index = cross_sections.size();
+
+    Utility::get<1>( d_scattering_centers[i] )->getDifferentialScatteringCrossSections( energy, scattering_angle_cosine, cross_sections );
+
+    // Convert the microscopic cross sections to macroscopic cross sections
+    for( size_t j = start_index; j < cross_sections.size(); ++j )
+      cross_sections[j].second *= Utility::get<0>( d_scattering_centers[i] );
+  }
+}
+
 // Return the survival probability
 template<typename ScatteringCenter>
 double Material<ScatteringCenter>::getSurvivalProbability( const double energy ) const
@@ -88,6 +88,12 @@ public:
   //! Sample an outgoing particle state given an incoming particle state
   void scatterParticle( ParticleType& particle ) const;
 
+  //! Evaluate the lab scattering angle cosine PDF
+  virtual double evaluateLabScatteringAnglePDF(
+                                          const double incoming_energy,
+                                          const double scattering_angle_cosine,
+                                          double& outgoing_energy ) const;
+
 protected:
 
   //! Return the atomic weight ratio
@@ -125,6 +131,23 @@ inline void NuclearScatteringDistribution<ParticleType,ParticleType>::scatterPar
   this->scatterParticle( particle, 0.0 );
 }
 
+// Evaluate the lab scattering angle cosine PDF
+/*! \details By default the outgoing particle is assumed to be emitted
+ * isotropically in the lab frame with the incoming energy. Distributions
+ * that can evaluate their lab scattering angle cosine PDF exactly should
+ * override this method.
+ */
+template<typename ParticleType>
+inline double NuclearScatteringDistribution<ParticleType,ParticleType>::evaluateLabScatteringAnglePDF(
+                                          const double incoming_energy,
+                                          const double,
+                                          double& outgoing_energy ) const
+{
+  outgoing_energy = incoming_energy;
+
+  return 0.5;
+}
+
 // Return the atomic weight ratio
 template<typename IncomingParticleType, typename OutgoingParticleType>
 inline double
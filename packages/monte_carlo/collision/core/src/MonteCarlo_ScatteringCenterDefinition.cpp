@@ -303,6 +303,7 @@ void ScatteringCenterDefinition::setNuclearDataProperties(
                                 "nuclear data properties" );
 
     d_nuclear_data_properties = properties;
+    d_upper_nuclear_data_properties.reset();
   }
 }
 
@@ -332,6 +333,101 @@ const Data::NuclearDataProperties& ScatteringCenterDefinition::getNuclearDataPro
   return *d_nuclear_data_properties;
 }
 
+// Check if the nuclear data will be interpolated in temperature
+bool ScatteringCenterDefinition::hasTemperatureInterpolatedNuclearDataProperties() const
+{
+  return (bool)d_upper_nuclear_data_properties;
+}
+
+// Set the nuclear data properties that bracket the desired temperature
+/*! \details Only the two bracketing nuclear data tables will be loaded. The
+ * nuclide will be treated as a mixture of the two tables with fractions
+ * chosen so that the cross sections are linearly interpolated in
+ * temperature. Since the tables are shared by every scattering center that
+ * uses them, the loaded data will scale with the number of unique tables
+ * instead of with the number of unique nuclide temperatures.
+ */
+void ScatteringCenterDefinition::setTemperatureInterpolatedNuclearDataProperties(
+     const std::shared_ptr<const Data::NuclearDataProperties>& lower_properties,
+     const std::shared_ptr<const Data::NuclearDataProperties>& upper_properties,
+     const Data::NuclearDataProperties::Energy temperature )
+{
+  TEST_FOR_EXCEPTION( !lower_properties || !upper_properties,
+                      std::runtime_error,
+                      "The bracketing nuclear data properties must be "
+                      "set!" );
+
+  TEST_FOR_EXCEPTION( lower_properties->zaid() != upper_properties->zaid(),
+                      std::runtime_error,
+                      "The bracketing nuclear data properties must describe "
+                      "the same nuclide (" << lower_properties->zaid() <<
+                      " != " << upper_properties->zaid() << ")!" );
+
+  TEST_FOR_EXCEPTION( lower_properties->evaluationTemperatureInMeV() >=
+                      upper_properties->evaluationTemperatureInMeV(),
+                      std::runtime_error,
+                      "The lower bracketing nuclear data properties must "
+                      "describe an evaluation at a lower temperature than "
+                      "the upper bracketing nuclear data properties!" );
+
+  TEST_FOR_EXCEPTION( temperature <
+                      lower_properties->evaluationTemperatureInMeV() ||
+                      temperature >
+                      upper_properties->evaluationTemperatureInMeV(),
+                      std::runtime_error,
+                      "The temperature " << temperature << " is not "
+                      "bracketed by the nuclear data properties ("
+                      << lower_properties->evaluationTemperatureInMeV() <<
+                      ", " << upper_properties->evaluationTemperatureInMeV()
+                      << ")!" );
+
+  this->verifyConsistentZaid( lower_properties->zaid(),
+                              "nuclear data properties" );
+  this->verifyConsistentTemp( temperature, "nuclear data properties" );
+
+  d_nuclear_data_properties = lower_properties;
+  d_upper_nuclear_data_properties = upper_properties;
+}
+
+// Get the upper bracketing nuclear data properties
+const Data::NuclearDataProperties& ScatteringCenterDefinition::getUpperNuclearDataProperties(
+                                            double* atomic_weight_ratio ) const
+{
+  TEST_FOR_EXCEPTION( d_upper_nuclear_data_properties.get() == NULL,
+                      std::logic_error,
+                      "The upper bracketing nuclear data properties have not "
+                      "been set!" );
+
+  // Get the atomic weight ratio
+  if( atomic_weight_ratio )
+  {
+    *atomic_weight_ratio =
+      this->getAtomicWeightRatio( *d_upper_nuclear_data_properties );
+  }
+
+  return *d_upper_nuclear_data_properties;
+}
+
+// Get the nuclear data temperature interpolation fraction
+/*! \details The fraction is the weight of the upper bracketing nuclear data
+ * table (the lower table has a weight of one minus the fraction). If the
+ * nuclear data is not interpolated in temperature, zero will be returned.
+ */
+double ScatteringCenterDefinition::getNuclearDataTemperatureInterpolationFraction() const
+{
+  if( !d_upper_nuclear_data_properties )
+    return 0.0;
+
+  const Data::NuclearDataProperties::Energy lower_temp =
+    d_nuclear_data_properties->evaluationTemperatureInMeV();
+
+  const Data::NuclearDataProperties::Energy upper_temp =
+    d_upper_nuclear_data_properties->evaluationTemperatureInMeV();
+
+  return (d_temperature.value().value() - lower_temp.value())/
+    (upper_temp.value() - lower_temp.value());
+}
+
 // Check if there are thermal nuclear data properties
 bool ScatteringCenterDefinition::hasThermalNuclearDataProperties() const
 {
@@ -761,6 +857,14 @@ void ScatteringCenterDefinition::toStream( std::ostream& os ) const
   Details::atomicDataPropertiesToStreamImpl( os, "adjoint electroatomic data", indent, d_zaid, d_adjoint_electroatomic_data_properties );
 
   Details::nuclearDataPropertiesToStreamImpl( os, "nuclear data", indent, d_zaid, d_nuclear_data_properties );
+
+  if( d_upper_nuclear_data_properties )
+  {
+    Details::nuclearDataPropertiesToStreamImpl( os, "upper nuclear data", indent, d_zaid, d_upper_nuclear_data_properties );
+
+    os << indent << "nuclear data temperature: " << d_temperature.value()
+       << "\n";
+  }
   Details::thermalNuclearDataPropertiesToStreamImpl( os, "thermal nuclear data", indent, d_zaid, d_thermal_nuclear_data_properties );
   Details::nuclearDataPropertiesToStreamImpl( os, "adjoint nuclear data", indent, d_zaid, d_adjoint_nuclear_data_properties );
   Details::thermalNuclearDataPropertiesToStreamImpl( os, "adjoint thermal nuclear data", indent, d_zaid, d_adjoint_thermal_nuclear_data_properties );
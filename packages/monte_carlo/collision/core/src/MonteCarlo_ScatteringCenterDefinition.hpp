@@ -135,6 +135,22 @@ public:
   const Data::NuclearDataProperties& getNuclearDataProperties(
                                     double* atomic_weight_ratio = NULL ) const;
 
+  //! Check if the nuclear data will be interpolated in temperature
+  bool hasTemperatureInterpolatedNuclearDataProperties() const;
+
+  //! Set the nuclear data properties that bracket the desired temperature
+  void setTemperatureInterpolatedNuclearDataProperties(
+     const std::shared_ptr<const Data::NuclearDataProperties>& lower_properties,
+     const std::shared_ptr<const Data::NuclearDataProperties>& upper_properties,
+     const Data::NuclearDataProperties::Energy temperature );
+
+  //! Get the upper bracketing nuclear data properties
+  const Data::NuclearDataProperties& getUpperNuclearDataProperties(
+                                    double* atomic_weight_ratio = NULL ) const;
+
+  //! Get the nuclear data temperature interpolation fraction
+  double getNuclearDataTemperatureInterpolationFraction() const;
+
   //! Check if there are thermal nuclear data properties
   bool hasThermalNuclearDataProperties() const;
 
@@ -271,6 +287,9 @@ private:
   // The nuclear data properties
   std::shared_ptr<const Data::NuclearDataProperties> d_nuclear_data_properties;
 
+  // The upper bracketing nuclear data properties (temperature interpolation)
+  std::shared_ptr<const Data::NuclearDataProperties> d_upper_nuclear_data_properties;
+
   // The thermal nuclear data properties
   std::shared_ptr<const Data::ThermalNuclearDataProperties> d_thermal_nuclear_data_properties;
 
@@ -330,6 +349,7 @@ void ScatteringCenterDefinition::save( Archive& ar,
   ar & BOOST_SERIALIZATION_NVP( d_adjoint_thermal_nuclear_data_properties );
   ar & BOOST_SERIALIZATION_NVP( d_photonuclear_data_properties );
   ar & BOOST_SERIALIZATION_NVP( d_adjoint_photonuclear_data_properties );
+  ar & BOOST_SERIALIZATION_NVP( d_upper_nuclear_data_properties );
 }
 
 // Load the object from an archive
@@ -351,11 +371,16 @@ void ScatteringCenterDefinition::load( Archive& ar,
   ar & BOOST_SERIALIZATION_NVP( d_adjoint_thermal_nuclear_data_properties );
   ar & BOOST_SERIALIZATION_NVP( d_photonuclear_data_properties );
   ar & BOOST_SERIALIZATION_NVP( d_adjoint_photonuclear_data_properties );
+
+  if( version > 0 )
+    ar & BOOST_SERIALIZATION_NVP( d_upper_nuclear_data_properties );
+  else
+    d_upper_nuclear_data_properties.reset();
 }
 
 } // end MonteCarlo namespace
 
-BOOST_SERIALIZATION_CLASS_VERSION( ScatteringCenterDefinition, MonteCarlo, 0 );
+BOOST_SERIALIZATION_CLASS_VERSION( ScatteringCenterDefinition, MonteCarlo, 1 );
 EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo, ScatteringCenterDefinition );
 
 #endif // end MONTE_CARLO_SCATTERING_CENTER_DEFINITION_HPP
@@ -80,6 +80,9 @@ protected:
   //! Return the head of the energy grid
   const double* getEnergyGridHead() const final override;
 
+  //! Return the index of the energy grid bin that contains the energy
+  size_t findEnergyGridBinIndex( const double energy ) const;
+
   //! Return the cross section at the given energy
   double getCrossSectionImpl( const std::vector<double>& cross_section,
                               const double energy,
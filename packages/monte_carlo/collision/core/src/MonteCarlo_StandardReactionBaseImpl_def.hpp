@@ -464,6 +464,18 @@ const double* StandardReactionBaseImpl<ReactionBase,InterpPolicy,processed_cross
   return d_incoming_energy_grid->data();
 }
 
+// Return the index of the energy grid bin that contains the energy
+template<typename ReactionBase,
+         typename InterpPolicy,
+         bool processed_cross_section>
+inline size_t StandardReactionBaseImpl<ReactionBase,InterpPolicy,processed_cross_section>::findEnergyGridBinIndex( const double energy ) const
+{
+  // Make sure the energy is valid
+  testPrecondition( this->isEnergyWithinEnergyGrid( energy ) );
+
+  return d_grid_searcher->findLowerBinIndex( energy );
+}
+
 // Set the max energy index
 template<typename ReactionBase,
          typename InterpPolicy,
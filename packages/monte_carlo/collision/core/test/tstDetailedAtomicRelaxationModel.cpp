@@ -92,6 +92,36 @@ FRENSIE_UNIT_TEST( DetailedAtomicRelaxationModel, relaxAtom )
   Utility::RandomNumberGenerator::unsetFakeStream();
 }
 
+//---------------------------------------------------------------------------//
+// Check that vacancies in subshells without relaxation data are ignored
+FRENSIE_UNIT_TEST( DetailedAtomicRelaxationModel, relaxAtom_no_data )
+{
+  MonteCarlo::PhotonState photon( 1 );
+  photon.setEnergy( 1.0 );
+  photon.setDirection( 0.0, 0.0, 1.0 );
+  photon.setPosition( 1.0, 1.0, 1.0 );
+
+  MonteCarlo::ParticleBank bank;
+
+  detailed_atomic_relaxation_model->relaxAtom( Data::INVALID_SUBSHELL,
+                                               photon,
+                                               bank );
+
+  FRENSIE_CHECK_EQUAL( bank.size(), 0 );
+
+  detailed_atomic_relaxation_model->relaxAtom( Data::UNKNOWN_SUBSHELL,
+                                               photon,
+                                               bank );
+
+  FRENSIE_CHECK_EQUAL( bank.size(), 0 );
+
+  detailed_atomic_relaxation_model->relaxAtom( Data::Q3_SUBSHELL,
+                                               photon,
+                                               bank );
+
+  FRENSIE_CHECK_EQUAL( bank.size(), 0 );
+}
+
 //---------------------------------------------------------------------------//
 // Custom Setup
 //---------------------------------------------------------------------------//
@@ -710,6 +710,71 @@ FRENSIE_UNIT_TEST( ScatteringCenterDefinition, setNuclearDataProperties )
   FRENSIE_CHECK( properties.get() == &definition.getNuclearDataProperties() );
 }
 
+//---------------------------------------------------------------------------//
+// Check that temperature interpolated nuclear data properties can be set
+FRENSIE_UNIT_TEST( ScatteringCenterDefinition,
+                   setTemperatureInterpolatedNuclearDataProperties )
+{
+  MonteCarlo::ScatteringCenterDefinition definition( "H1-450K", 1001 );
+
+  FRENSIE_CHECK( !definition.hasTemperatureInterpolatedNuclearDataProperties() );
+  FRENSIE_CHECK_EQUAL( definition.getNuclearDataTemperatureInterpolationFraction(), 0.0 );
+
+  std::shared_ptr<const Data::NuclearDataProperties> lower_properties(
+               new Data::ACENuclearDataProperties(
+                                             1.0,
+                                             2.52574e-8*MeV,
+                                             boost::filesystem::current_path(),
+                                             0,
+                                             "1001.71c" ) );
+
+  std::shared_ptr<const Data::NuclearDataProperties> upper_properties(
+               new Data::ACENuclearDataProperties(
+                                             1.0,
+                                             5.17043e-8*MeV,
+                                             boost::filesystem::current_path(),
+                                             0,
+                                             "1001.72c" ) );
+
+  // The temperature must be bracketed
+  FRENSIE_CHECK_THROW( definition.setTemperatureInterpolatedNuclearDataProperties( lower_properties, upper_properties, 6e-8*MeV ),
+                       std::runtime_error );
+
+  // The bracketing properties must be ordered
+  FRENSIE_CHECK_THROW( definition.setTemperatureInterpolatedNuclearDataProperties( upper_properties, lower_properties, 3e-8*MeV ),
+                       std::runtime_error );
+
+  FRENSIE_CHECK( !definition.hasNuclearDataProperties() );
+
+  definition.setTemperatureInterpolatedNuclearDataProperties(
+                                                         lower_properties,
+                                                         upper_properties,
+                                                         3.877985e-8*MeV );
+
+  FRENSIE_CHECK( definition.hasNuclearDataProperties() );
+  FRENSIE_CHECK( definition.hasTemperatureInterpolatedNuclearDataProperties() );
+  FRENSIE_CHECK( lower_properties.get() ==
+                 &definition.getNuclearDataProperties() );
+  FRENSIE_CHECK( upper_properties.get() ==
+                 &definition.getUpperNuclearDataProperties() );
+  FRENSIE_CHECK_FLOATING_EQUALITY( definition.getNuclearDataTemperatureInterpolationFraction(),
+                                   0.5,
+                                   1e-12 );
+
+  double atomic_weight_ratio;
+
+  definition.getUpperNuclearDataProperties( &atomic_weight_ratio );
+
+  FRENSIE_CHECK_EQUAL( atomic_weight_ratio, 1.0 );
+
+  // Setting single temperature properties removes the interpolation
+  definition.setNuclearDataProperties( lower_properties );
+
+  FRENSIE_CHECK( !definition.hasTemperatureInterpolatedNuclearDataProperties() );
+  FRENSIE_CHECK_THROW( definition.getUpperNuclearDataProperties(),
+                       std::logic_error );
+}
+
 //---------------------------------------------------------------------------//
 // Check that adjoint nuclear data properties can be set
 FRENSIE_UNIT_TEST( ScatteringCenterDefinition,
@@ -1452,6 +1517,7 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( ScatteringCenterDefinition,
   FRENSIE_REQUIRE( h1_definition.hasElectroatomicDataProperties() );
   FRENSIE_REQUIRE( h1_definition.hasAdjointElectroatomicDataProperties() );
   FRENSIE_CHECK( h1_definition.hasNuclearDataProperties() );
+  FRENSIE_CHECK( !h1_definition.hasTemperatureInterpolatedNuclearDataProperties() );
   FRENSIE_CHECK( h1_definition.hasAdjointNuclearDataProperties() );
   FRENSIE_CHECK( h1_definition.hasThermalNuclearDataProperties() );
   FRENSIE_CHECK( h1_definition.hasAdjointThermalNuclearDataProperties() );
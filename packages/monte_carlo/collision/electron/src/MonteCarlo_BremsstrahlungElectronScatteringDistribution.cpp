@@ -10,8 +10,13 @@
 #include "MonteCarlo_BremsstrahlungElectronScatteringDistribution.hpp"
 #include "MonteCarlo_PhotonState.hpp"
 #include "MonteCarlo_KinematicHelpers.hpp"
+#include "Utility_TabularDistribution.hpp"
+#include "Utility_GridGenerator.hpp"
+#include "Utility_SearchAlgorithms.hpp"
+#include "Utility_SortAlgorithms.hpp"
 #include "Utility_RandomNumberGenerator.hpp"
 #include "Utility_PhysicalConstants.hpp"
+#include "Utility_DesignByContract.hpp"
 
 namespace MonteCarlo{
 
@@ -19,7 +24,8 @@ namespace MonteCarlo{
 BremsstrahlungElectronScatteringDistribution::BremsstrahlungElectronScatteringDistribution(
     const std::shared_ptr<const BasicBivariateDist>& bremsstrahlung_scattering_distribution,
     const bool bank_secondary_particles )
-  : d_bremsstrahlung_scattering_distribution( bremsstrahlung_scattering_distribution ),
+  : d_atomic_number( 0.0 ),
+    d_bremsstrahlung_scattering_distribution( bremsstrahlung_scattering_distribution ),
     d_bank_secondary_particles( bank_secondary_particles )
 {
   // Make sure the array is valid
@@ -296,12 +302,125 @@ double BremsstrahlungElectronScatteringDistribution::SampleDipoleAngle(
   return photon_angle_cosine;
 }
 
+// Create the 2BS angular sampling table (direct sampling)
+/*! \details The 2BS rejection routine samples the photon angle by accepting a
+ * random number, u, with probability a(u) (the normalized rejection function).
+ * The accepted random numbers are distributed according to a(u) on [0,1],
+ * which is tabulated (lin-lin) at every electron energy and photon energy
+ * fraction grid point. The convergence tolerance controls the interpolation
+ * error of the tabulated distributions. The photon angle will be sampled
+ * directly from the table at electron energies and photon energy fractions
+ * that are covered by the grids. The photon energy fractions must be in
+ * (0,1) and the distribution must have been constructed with the detailed
+ * 2BS photon angular distribution.
+ */
+void BremsstrahlungElectronScatteringDistribution::createTwoBSAngularSamplingTable(
+                   const std::vector<double>& electron_energy_grid,
+                   const std::vector<double>& photon_energy_fraction_grid,
+                   const double convergence_tolerance )
+{
+  // Make sure the detailed 2BS photon angular distribution is used
+  testPrecondition( d_atomic_number > 0.0 );
+  // Make sure the grids are valid
+  testPrecondition( electron_energy_grid.size() > 1 );
+  testPrecondition( electron_energy_grid.front() > 0.0 );
+  testPrecondition( Utility::Sort::isSortedAscending(
+                                              electron_energy_grid.begin(),
+                                              electron_energy_grid.end() ) );
+  testPrecondition( photon_energy_fraction_grid.size() > 1 );
+  testPrecondition( photon_energy_fraction_grid.front() > 0.0 );
+  testPrecondition( photon_energy_fraction_grid.back() < 1.0 );
+  testPrecondition( Utility::Sort::isSortedAscending(
+                                       photon_energy_fraction_grid.begin(),
+                                       photon_energy_fraction_grid.end() ) );
+  // Make sure the convergence tolerance is valid
+  testPrecondition( convergence_tolerance > 0.0 );
+  testPrecondition( convergence_tolerance <= 1.0 );
+
+  const std::vector<double> initial_grid( {0.0, 0.25, 0.5, 0.75, 1.0} );
+
+  Utility::GridGenerator<Utility::LinLin>
+    grid_generator( convergence_tolerance, 1e-12, 1e-14 );
+
+  std::vector<std::shared_ptr<const Utility::TabularUnivariateDistribution> >
+    angular_sampling_tables( electron_energy_grid.size()*
+                             photon_energy_fraction_grid.size() );
+
+  for( size_t i = 0; i < electron_energy_grid.size(); ++i )
+  {
+    const double electron_energy = electron_energy_grid[i];
+
+    for( size_t j = 0; j < photon_energy_fraction_grid.size(); ++j )
+    {
+      const double photon_energy =
+        photon_energy_fraction_grid[j]*electron_energy;
+
+      std::vector<double> random_numbers, acceptance_probabilities;
+
+      grid_generator.generateAndEvaluate(
+              random_numbers,
+              acceptance_probabilities,
+              initial_grid,
+              [this, electron_energy, photon_energy]( const double u ){
+                return this->Calculate2BSAcceptanceProbability( electron_energy,
+                                                                photon_energy,
+                                                                u );
+              } );
+
+      angular_sampling_tables[i*photon_energy_fraction_grid.size()+j].reset(
+              new Utility::TabularDistribution<Utility::LinLin>(
+                                                   random_numbers,
+                                                   acceptance_probabilities ) );
+    }
+  }
+
+  d_twobs_electron_energy_grid = electron_energy_grid;
+  d_twobs_photon_energy_fraction_grid = photon_energy_fraction_grid;
+  d_twobs_angular_sampling_tables.swap( angular_sampling_tables );
+}
+
+// Check if a 2BS angular sampling table has been created
+bool BremsstrahlungElectronScatteringDistribution::hasTwoBSAngularSamplingTable() const
+{
+  return !d_twobs_angular_sampling_tables.empty();
+}
+
 /* Sample the outgoing photon direction using the 2BS sampling routine of
  * Kock and Motz
  */
+/*! \details If a 2BS angular sampling table has been created and it covers
+ * the electron energy and photon energy fraction, the photon angle will be
+ * sampled directly from the table. Otherwise the rejection routine is used.
+ */
 double BremsstrahlungElectronScatteringDistribution::Sample2BSAngle(
                                         const double incoming_electron_energy,
                                         const double photon_energy ) const
+{
+  if( this->hasTwoBSAngularSamplingTable() &&
+      incoming_electron_energy >= d_twobs_electron_energy_grid.front() &&
+      incoming_electron_energy <= d_twobs_electron_energy_grid.back() )
+  {
+    const double photon_energy_fraction =
+      photon_energy/incoming_electron_energy;
+
+    if( photon_energy_fraction >= d_twobs_photon_energy_fraction_grid.front() &&
+        photon_energy_fraction <= d_twobs_photon_energy_fraction_grid.back() )
+    {
+      return this->Sample2BSAngleFromTable( incoming_electron_energy,
+                                            photon_energy );
+    }
+  }
+
+  return this->Sample2BSAngleWithRejection( incoming_electron_energy,
+                                            photon_energy );
+}
+
+/* Sample the outgoing photon direction using the 2BS rejection routine of
+ * Kock and Motz
+ */
+double BremsstrahlungElectronScatteringDistribution::Sample2BSAngleWithRejection(
+                                        const double incoming_electron_energy,
+                                        const double photon_energy ) const
 {
   // Make sure the energies are valid
   testPrecondition( photon_energy > 0.0 );
@@ -341,8 +460,7 @@ double BremsstrahlungElectronScatteringDistribution::Sample2BSAngle(
     rand = Utility::RandomNumberGenerator::getRandomNumber<double>();
 
     // sample for theta
-    double theta = sqrt( rand/( 1.0 - rand + 1.0/x_max ) )/
-                   incoming_electron_energy;
+    double theta = Calculate2BSAngle( incoming_electron_energy, rand );
 
     double x = sqrt( incoming_electron_energy*theta );
 
@@ -368,6 +486,137 @@ double BremsstrahlungElectronScatteringDistribution::Sample2BSAngle(
   }
 }
 
+// Sample the outgoing photon direction using the 2BS angular sampling table
+/*! \details The table that will be sampled is selected using stochastic
+ * mixing (log interpolation weights on the electron energy grid and lin
+ * interpolation weights on the photon energy fraction grid). The sampled
+ * random number is converted to a photon angle at the incoming electron
+ * energy so exactly three random numbers are used.
+ */
+double BremsstrahlungElectronScatteringDistribution::Sample2BSAngleFromTable(
+                                        const double incoming_electron_energy,
+                                        const double photon_energy ) const
+{
+  // Make sure the energies are valid
+  testPrecondition( photon_energy > 0.0 );
+  testPrecondition( photon_energy <= incoming_electron_energy );
+
+  // Select the electron energy grid point
+  size_t energy_index =
+    Utility::Search::binaryLowerBoundIndex(
+                                       d_twobs_electron_energy_grid.begin(),
+                                       d_twobs_electron_energy_grid.end(),
+                                       incoming_electron_energy );
+
+  if( energy_index == d_twobs_electron_energy_grid.size() - 1 )
+    --energy_index;
+
+  const double energy_interp_fraction =
+    std::log( incoming_electron_energy/
+              d_twobs_electron_energy_grid[energy_index] )/
+    std::log( d_twobs_electron_energy_grid[energy_index+1]/
+              d_twobs_electron_energy_grid[energy_index] );
+
+  if( Utility::RandomNumberGenerator::getRandomNumber<double>() <
+      energy_interp_fraction )
+    ++energy_index;
+
+  // Select the photon energy fraction grid point
+  const double photon_energy_fraction =
+    photon_energy/incoming_electron_energy;
+
+  size_t fraction_index =
+    Utility::Search::binaryLowerBoundIndex(
+                                d_twobs_photon_energy_fraction_grid.begin(),
+                                d_twobs_photon_energy_fraction_grid.end(),
+                                photon_energy_fraction );
+
+  if( fraction_index == d_twobs_photon_energy_fraction_grid.size() - 1 )
+    --fraction_index;
+
+  const double fraction_interp_fraction =
+    ( photon_energy_fraction -
+      d_twobs_photon_energy_fraction_grid[fraction_index] )/
+    ( d_twobs_photon_energy_fraction_grid[fraction_index+1] -
+      d_twobs_photon_energy_fraction_grid[fraction_index] );
+
+  if( Utility::RandomNumberGenerator::getRandomNumber<double>() <
+      fraction_interp_fraction )
+    ++fraction_index;
+
+  // Sample the accepted random number and convert it to a photon angle
+  const double random_number =
+    d_twobs_angular_sampling_tables[energy_index*d_twobs_photon_energy_fraction_grid.size()+fraction_index]->sample();
+
+  double photon_angle_cosine =
+    cos( Calculate2BSAngle( incoming_electron_energy, random_number ) );
+
+  // Check for roundoff error
+  if( photon_angle_cosine < -1.0 )
+    photon_angle_cosine = -1.0;
+
+  testPostcondition( photon_angle_cosine <= 1.0 );
+  testPostcondition( photon_angle_cosine >= -1.0 );
+
+  return photon_angle_cosine;
+}
+
+// Calculate the outgoing photon angle for the 2BS sampling routine
+double BremsstrahlungElectronScatteringDistribution::Calculate2BSAngle(
+                                        const double incoming_electron_energy,
+                                        const double random_number )
+{
+  double x_max = Utility::PhysicalConstants::pi*Utility::PhysicalConstants::pi*
+                 incoming_electron_energy*incoming_electron_energy;
+
+  return sqrt( random_number/( 1.0 - random_number + 1.0/x_max ) )/
+    incoming_electron_energy;
+}
+
+// Calculate the acceptance probability for the 2BS sampling routine
+/*! \details This is the probability that the 2BS rejection routine will
+ * accept the random number that is used to sample the photon angle.
+ */
+double BremsstrahlungElectronScatteringDistribution::Calculate2BSAcceptanceProbability(
+                                        const double incoming_electron_energy,
+                                        const double photon_energy,
+                                        const double random_number ) const
+{
+  double outgoing_electron_energy = incoming_electron_energy - photon_energy;
+  double ratio = outgoing_electron_energy/incoming_electron_energy;
+  double two_ratio = 2.0*ratio;
+  double parameter = ( 1.0 + ratio*ratio );
+
+  double x_max = Utility::PhysicalConstants::pi*Utility::PhysicalConstants::pi*
+                 incoming_electron_energy*incoming_electron_energy;
+
+  // Calculate the normalization of the rejection function
+  double g_norm = std::max(
+        std::max( Calculate2BSRejection( outgoing_electron_energy,
+                                         two_ratio,
+                                         parameter,
+                                         0.0 ),
+                  Calculate2BSRejection( outgoing_electron_energy,
+                                         two_ratio,
+                                         parameter,
+                                         x_max ) ),
+        Calculate2BSRejection( outgoing_electron_energy,
+                               two_ratio,
+                               parameter,
+                               1.0 ) );
+
+  double theta = Calculate2BSAngle( incoming_electron_energy, random_number );
+
+  double x = sqrt( incoming_electron_energy*theta );
+
+  double g = Calculate2BSRejection( outgoing_electron_energy,
+                                    two_ratio,
+                                    parameter,
+                                    x )/g_norm;
+
+  return std::min( std::max( g, 0.0 ), 1.0 );
+}
+
 // Calculate the rejection function for the 2BS sampling routine
 double BremsstrahlungElectronScatteringDistribution::Calculate2BSRejection(
                                           const double outgoing_electron_energy,
@@ -14,10 +14,16 @@
 #include "MonteCarlo_PositronScatteringDistribution.hpp"
 #include "MonteCarlo_BremsstrahlungAngularDistributionType.hpp"
 #include "Utility_InterpolatedFullyTabularBasicBivariateDistribution.hpp"
+#include "Utility_TabularUnivariateDistribution.hpp"
 
 namespace MonteCarlo{
 
-//! The scattering distribution base class
+/*! The scattering distribution base class
+ * \details The detailed 2BS photon angle is sampled by rejection by default.
+ * A 2BS angular sampling table can optionally be created so that the photon
+ * angle can be sampled directly at electron energies and photon energy
+ * fractions that are covered by the table.
+ */
 class BremsstrahlungElectronScatteringDistribution : public ElectronScatteringDistribution,
                                                      public PositronScatteringDistribution
 {
@@ -97,6 +103,15 @@ public:
                         MonteCarlo::ParticleBank& bank,
                         Data::SubshellType& shell_of_interaction ) const override;
 
+  //! Create the 2BS angular sampling table (direct sampling)
+  void createTwoBSAngularSamplingTable(
+                   const std::vector<double>& electron_energy_grid,
+                   const std::vector<double>& photon_energy_fraction_grid,
+                   const double convergence_tolerance = 1e-3 );
+
+  //! Check if a 2BS angular sampling table has been created
+  bool hasTwoBSAngularSamplingTable() const;
+
 private:
 
   // Sample the outgoing photon angle from a dipole distribution
@@ -107,6 +122,24 @@ private:
   double Sample2BSAngle(  const double incoming_electron_energy,
                           const double photon_energy ) const ;
 
+  // Sample the outgoing photon angle using the 2BS rejection routine
+  double Sample2BSAngleWithRejection( const double incoming_electron_energy,
+                                      const double photon_energy ) const;
+
+  // Sample the outgoing photon angle using the 2BS angular sampling table
+  double Sample2BSAngleFromTable( const double incoming_electron_energy,
+                                  const double photon_energy ) const;
+
+  // Calculate the outgoing photon angle for the 2BS sampling routine
+  static double Calculate2BSAngle( const double incoming_electron_energy,
+                                   const double random_number );
+
+  // Calculate the acceptance probability for the 2BS sampling routine
+  double Calculate2BSAcceptanceProbability(
+                                        const double incoming_electron_energy,
+                                        const double photon_energy,
+                                        const double random_number ) const;
+
   // Calculate the rejection function for the 2BS sampling routine
   double Calculate2BSRejection( const double outgoing_electron_energy,
                                 const double two_ratio,
@@ -125,6 +158,16 @@ private:
 
   // Turn secondary particle on/off
   bool d_bank_secondary_particles;
+
+  // The 2BS angular sampling table electron energy grid
+  std::vector<double> d_twobs_electron_energy_grid;
+
+  // The 2BS angular sampling table photon energy fraction grid
+  std::vector<double> d_twobs_photon_energy_fraction_grid;
+
+  // The 2BS angular sampling tables (electron energy major order)
+  std::vector<std::shared_ptr<const Utility::TabularUnivariateDistribution> >
+  d_twobs_angular_sampling_tables;
 };
 
 } // end MonteCarlo namespace
@@ -32,7 +32,8 @@ public:
     std::shared_ptr<const BremsstrahlungElectronScatteringDistribution>&
         scattering_distribution,
     const double evaluation_tol = 1e-7,
-    const unsigned max_number_of_iterations = 500 );
+    const unsigned max_number_of_iterations = 500,
+    const double inverse_cdf_table_tol = 0.0 );
 
   //! Create a simple dipole bremsstrahlung distribution
   template <typename TwoDInterpPolicy = Utility::LogLogLog,
@@ -44,7 +45,8 @@ public:
     std::shared_ptr<const BremsstrahlungElectronScatteringDistribution>&
         scattering_distribution,
     const double evaluation_tol = 1e-7,
-    const unsigned max_number_of_iterations = 500 );
+    const unsigned max_number_of_iterations = 500,
+    const double inverse_cdf_table_tol = 0.0 );
 
   //! Create a detailed 2BS bremsstrahlung distribution
   template <typename TwoDInterpPolicy = Utility::LogLogLog,
@@ -55,7 +57,9 @@ public:
     std::shared_ptr<const BremsstrahlungElectronScatteringDistribution>&
         scattering_distribution,
     const double evaluation_tol = 1e-7,
-    const unsigned max_number_of_iterations = 500 );
+    const unsigned max_number_of_iterations = 500,
+    const double inverse_cdf_table_tol = 0.0,
+    const double twobs_angle_table_tol = 0.0 );
 
   //! Create a detailed 2BS bremsstrahlung distribution
   template <typename TwoDInterpPolicy = Utility::LogLogLog,
@@ -68,7 +72,9 @@ public:
     std::shared_ptr<const BremsstrahlungElectronScatteringDistribution>&
         scattering_distribution,
     const double evaluation_tol = 1e-7,
-    const unsigned max_number_of_iterations = 500 );
+    const unsigned max_number_of_iterations = 500,
+    const double inverse_cdf_table_tol = 0.0,
+    const double twobs_angle_table_tol = 0.0 );
 
   //! Create the energy loss function
   template <typename TwoDInterpPolicy = Utility::LogLogLog,
@@ -79,7 +85,8 @@ public:
     const std::vector<double>& energy_grid,
     std::shared_ptr<const Utility::FullyTabularBasicBivariateDistribution>& energy_loss_function,
     const double evaluation_tol,
-    const unsigned max_number_of_iterations );
+    const unsigned max_number_of_iterations,
+    const double inverse_cdf_table_tol = 0.0 );
 };
 
 } // end MonteCarlo namespace
@@ -21,7 +21,8 @@ void BremsstrahlungElectronScatteringDistributionNativeFactory::createBremsstrah
     std::shared_ptr<const BremsstrahlungElectronScatteringDistribution>&
         scattering_distribution,
     const double evaluation_tol,
-    const unsigned max_number_of_iterations )
+    const unsigned max_number_of_iterations,
+    const double inverse_cdf_table_tol )
 {
   // Make sure the evaluation tol is valid
   testPrecondition( evaluation_tol > 0.0 );
@@ -34,7 +35,8 @@ void BremsstrahlungElectronScatteringDistributionNativeFactory::createBremsstrah
     raw_electroatom_data.getBremsstrahlungEnergyGrid(),
     scattering_distribution,
     evaluation_tol,
-    max_number_of_iterations );
+    max_number_of_iterations,
+    inverse_cdf_table_tol );
 }
 
 // Create a simple dipole bremsstrahlung distribution
@@ -46,7 +48,8 @@ void BremsstrahlungElectronScatteringDistributionNativeFactory::createBremsstrah
     std::shared_ptr<const BremsstrahlungElectronScatteringDistribution>&
         scattering_distribution,
     const double evaluation_tol,
-    const unsigned max_number_of_iterations )
+    const unsigned max_number_of_iterations,
+    const double inverse_cdf_table_tol )
 {
   // Make sure the evaluation tol is valid
   testPrecondition( evaluation_tol > 0.0 );
@@ -63,7 +66,8 @@ void BremsstrahlungElectronScatteringDistributionNativeFactory::createBremsstrah
     energy_grid,
     energy_loss_function,
     evaluation_tol,
-    max_number_of_iterations );
+    max_number_of_iterations,
+    inverse_cdf_table_tol );
 
   scattering_distribution.reset(
    new BremsstrahlungElectronScatteringDistribution( energy_loss_function ) );
@@ -77,7 +81,9 @@ void BremsstrahlungElectronScatteringDistributionNativeFactory::createBremsstrah
     std::shared_ptr<const BremsstrahlungElectronScatteringDistribution>&
         scattering_distribution,
     const double evaluation_tol,
-    const unsigned max_number_of_iterations )
+    const unsigned max_number_of_iterations,
+    const double inverse_cdf_table_tol,
+    const double twobs_angle_table_tol )
 {
   // Make sure the evaluation tol is valid
   testPrecondition( evaluation_tol > 0.0 );
@@ -91,7 +97,9 @@ void BremsstrahlungElectronScatteringDistributionNativeFactory::createBremsstrah
     atomic_number,
     scattering_distribution,
     evaluation_tol,
-    max_number_of_iterations );
+    max_number_of_iterations,
+    inverse_cdf_table_tol,
+    twobs_angle_table_tol );
 }
 
 // Create a detailed 2BS bremsstrahlung distribution
@@ -104,7 +112,9 @@ void BremsstrahlungElectronScatteringDistributionNativeFactory::createBremsstrah
     std::shared_ptr<const BremsstrahlungElectronScatteringDistribution>&
         scattering_distribution,
     const double evaluation_tol,
-    const unsigned max_number_of_iterations )
+    const unsigned max_number_of_iterations,
+    const double inverse_cdf_table_tol,
+    const double twobs_angle_table_tol )
 {
   // Make sure the evaluation tol is valid
   testPrecondition( evaluation_tol > 0.0 );
@@ -121,11 +131,26 @@ void BremsstrahlungElectronScatteringDistributionNativeFactory::createBremsstrah
     energy_grid,
     energy_loss_function,
     evaluation_tol,
-    max_number_of_iterations );
+    max_number_of_iterations,
+    inverse_cdf_table_tol );
 
-  scattering_distribution.reset(
+  std::shared_ptr<BremsstrahlungElectronScatteringDistribution> distribution(
    new BremsstrahlungElectronScatteringDistribution( atomic_number,
                                                      energy_loss_function ) );
+
+  // Precompute the 2BS photon angle sampling table on the incoming energy grid
+  if( twobs_angle_table_tol > 0.0 )
+  {
+    const std::vector<double> photon_energy_fraction_grid(
+             {1e-6, 1e-4, 1e-3, 1e-2, 0.05, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6,
+              0.7, 0.8, 0.9, 0.95, 0.99, 0.999} );
+
+    distribution->createTwoBSAngularSamplingTable( energy_grid,
+                                                   photon_energy_fraction_grid,
+                                                   twobs_angle_table_tol );
+  }
+
+  scattering_distribution = distribution;
 }
 
 // Create the energy loss function
@@ -136,7 +161,8 @@ void BremsstrahlungElectronScatteringDistributionNativeFactory::createEnergyLoss
     const std::vector<double>& energy_grid,
     std::shared_ptr<const Utility::FullyTabularBasicBivariateDistribution>& energy_loss_function,
     const double evaluation_tol,
-    const unsigned max_number_of_iterations )
+    const unsigned max_number_of_iterations,
+    const double inverse_cdf_table_tol )
 {
   // Make sure the evaluation tol is valid
   testPrecondition( evaluation_tol > 0.0 );
@@ -156,14 +182,25 @@ void BremsstrahlungElectronScatteringDistributionNativeFactory::createEnergyLoss
   }
 
   // Create the scattering function
-  energy_loss_function.reset(
-    new Utility::InterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy<TwoDInterpPolicy> >(
+  std::shared_ptr<Utility::InterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy<TwoDInterpPolicy> > >
+    interpolated_energy_loss_function(
+      new Utility::InterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy<TwoDInterpPolicy> >(
             energy_grid,
             secondary_dists,
             1e-6,
             evaluation_tol,
             1e-16,
             max_number_of_iterations ) );
+
+  // Precompute the inverse CDF tables used for sampling
+  if( inverse_cdf_table_tol > 0.0 &&
+      interpolated_energy_loss_function->canUseInverseCDFTables() )
+  {
+    interpolated_energy_loss_function->precomputeInverseCDFTables(
+                                                      inverse_cdf_table_tol );
+  }
+
+  energy_loss_function = interpolated_energy_loss_function;
 }
 
 } // end MonteCarlo namespace
@@ -153,7 +153,9 @@ void ElectroatomNativeFactory::createElectroatomCore(
                   grid_searcher,
                   reaction_pointer,
                   properties.getBremsstrahlungAngularDistributionFunction(),
-                  properties.getElectronEvaluationTolerance() );
+                  properties.getElectronEvaluationTolerance(),
+                  properties.getElectronInverseCDFTableTolerance(),
+                  properties.getBremsstrahlungPhotonAngleTableTolerance() );
   }
 
   // Create the atomic excitation scattering reaction
@@ -180,7 +182,8 @@ void ElectroatomNativeFactory::createElectroatomCore(
                       grid_searcher,
                       reaction_pointers,
                       properties.getElectroionizationSamplingMode(),
-                      properties.getElectronEvaluationTolerance() );
+                      properties.getElectronEvaluationTolerance(),
+                      properties.getElectronInverseCDFTableTolerance() );
 
     for( size_t i = 0; i < reaction_pointers.size(); ++i )
     {
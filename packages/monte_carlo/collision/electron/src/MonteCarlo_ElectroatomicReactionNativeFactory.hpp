@@ -135,7 +135,8 @@ public:
     const unsigned subshell,
     std::shared_ptr<const ReactionType>& electroionization_subshell_reaction,
     const ElectroionizationSamplingType sampling_type,
-    const double evaluation_tol );
+    const double evaluation_tol,
+    const double inverse_cdf_table_tol = 0.0 );
 
   //! Create the subshell electroionization electroatomic reactions
   template< typename TwoDInterpPolicy = Utility::LogLogLog,
@@ -148,7 +149,8 @@ public:
     std::vector<std::shared_ptr<const ReactionType> >&
         electroionization_subshell_reactions,
     const ElectroionizationSamplingType sampling_type,
-    const double evaluation_tol );
+    const double evaluation_tol,
+    const double inverse_cdf_table_tol = 0.0 );
 
   //! Create the bremsstrahlung electroatomic reaction
   template< typename TwoDInterpPolicy = Utility::LogLogLog,
@@ -160,7 +162,9 @@ public:
     const std::shared_ptr<const Utility::HashBasedGridSearcher<double>>& grid_searcher,
     std::shared_ptr<const ReactionType>& bremsstrahlung_reaction,
     BremsstrahlungAngularDistributionType photon_distribution_function,
-    const double evaluation_tol );
+    const double evaluation_tol,
+    const double inverse_cdf_table_tol = 0.0,
+    const double twobs_angle_table_tol = 0.0 );
 
   //! Create a void absorption electroatomic reaction
   static void createVoidAbsorptionReaction(
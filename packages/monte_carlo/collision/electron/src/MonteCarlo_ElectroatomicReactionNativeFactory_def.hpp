@@ -355,7 +355,8 @@ void ElectroatomicReactionNativeFactory::createSubshellElectroionizationReaction
     const unsigned subshell,
     std::shared_ptr<const ReactionType>& electroionization_subshell_reaction,
     const ElectroionizationSamplingType sampling_type,
-    const double evaluation_tol )
+    const double evaluation_tol,
+    const double inverse_cdf_table_tol )
 {
   // Convert subshell number to enum
   Data::SubshellType subshell_type =
@@ -384,7 +385,10 @@ void ElectroatomicReactionNativeFactory::createSubshellElectroionizationReaction
       raw_electroatom_data.getSubshellBindingEnergy( subshell ),
       electroionization_subshell_distribution,
       sampling_type,
-      evaluation_tol );
+      evaluation_tol,
+      500,
+      false,
+      inverse_cdf_table_tol );
 
 
   // Create the subshell electroelectric reaction
@@ -409,7 +413,8 @@ void ElectroatomicReactionNativeFactory::createSubshellElectroionizationReaction
     std::vector<std::shared_ptr<const ReactionType> >&
     electroionization_subshell_reactions,
     const ElectroionizationSamplingType sampling_type,
-    const double evaluation_tol )
+    const double evaluation_tol,
+    const double inverse_cdf_table_tol )
 {
   electroionization_subshell_reactions.clear();
 
@@ -429,7 +434,8 @@ void ElectroatomicReactionNativeFactory::createSubshellElectroionizationReaction
       *shell,
       electroionization_subshell_reaction,
       sampling_type,
-      evaluation_tol );
+      evaluation_tol,
+      inverse_cdf_table_tol );
 
     electroionization_subshell_reactions.push_back(
                       electroionization_subshell_reaction );
@@ -449,7 +455,9 @@ void ElectroatomicReactionNativeFactory::createBremsstrahlungReaction(
     const std::shared_ptr<const Utility::HashBasedGridSearcher<double>>& grid_searcher,
     std::shared_ptr<const ReactionType>& bremsstrahlung_reaction,
     BremsstrahlungAngularDistributionType photon_distribution_function,
-    const double evaluation_tol )
+    const double evaluation_tol,
+    const double inverse_cdf_table_tol,
+    const double twobs_angle_table_tol )
 {
   // Make sure the energy grid is valid
   testPrecondition( raw_electroatom_data.getElectronEnergyGrid().size() ==
@@ -472,26 +480,31 @@ void ElectroatomicReactionNativeFactory::createBremsstrahlungReaction(
   std::shared_ptr<const BremsstrahlungElectronScatteringDistribution>
     bremsstrahlung_distribution;
 
-  if( photon_distribution_function = DIPOLE_DISTRIBUTION )
+  if( photon_distribution_function == DIPOLE_DISTRIBUTION )
   {
     BremsstrahlungFactory::createBremsstrahlungDistribution<TwoDInterpPolicy,TwoDGridPolicy>(
       raw_electroatom_data,
       bremsstrahlung_distribution,
-      evaluation_tol );
+      evaluation_tol,
+      500,
+      inverse_cdf_table_tol );
 
   }
-  else if( photon_distribution_function = TABULAR_DISTRIBUTION )
+  else if( photon_distribution_function == TABULAR_DISTRIBUTION )
   {
   THROW_EXCEPTION( std::logic_error,
           "The detailed bremsstrahlung reaction has not been implemented");
   }
-  else if( photon_distribution_function = TWOBS_DISTRIBUTION )
+  else if( photon_distribution_function == TWOBS_DISTRIBUTION )
   {
     BremsstrahlungFactory::createBremsstrahlungDistribution<TwoDInterpPolicy,TwoDGridPolicy>(
       raw_electroatom_data,
       raw_electroatom_data.getAtomicNumber(),
       bremsstrahlung_distribution,
-      evaluation_tol );
+      evaluation_tol,
+      500,
+      inverse_cdf_table_tol,
+      twobs_angle_table_tol );
   }
 
   // Create the bremsstrahlung reaction
@@ -17,7 +17,11 @@ namespace MonteCarlo{
 
 /*! The electroionization electroatomic reaction class
 * \details This class should be used to represent the total electroionization
-* reaction and not the reaction with individual subshells.
+* reaction and not the reaction with individual subshells. The subshell
+* reactions must use the same energy grid and interpolation policy as this
+* reaction. The cumulative subshell cross sections are cached at every
+* energy grid point so that a subshell reaction can be sampled without
+* evaluating the subshell reaction cross sections.
 */
 
 template<typename InterpPolicy, bool processed_cross_section = false>
@@ -74,9 +78,24 @@ public:
 
 private:
 
+  // Initialize the cumulative subshell cross sections
+  void initializeCumulativeSubshellCrossSections(
+                       const std::vector<double>& incoming_energy_grid,
+                       const size_t threshold_energy_index );
+
+  // Sample the subshell reaction that will occur at the energy
+  size_t sampleSubshellReaction( const double energy ) const;
+
   // Electroionization subshell reactions
   std::vector<std::shared_ptr<const ElectroatomicReaction> >
         d_subshell_reactions;
+
+  // The threshold energy index
+  size_t d_threshold_energy_index;
+
+  // The cumulative subshell cross sections at each energy grid point above
+  // the threshold (energy grid index major)
+  std::vector<double> d_cumulative_subshell_cross_sections;
 };
 
 } // end MonteCarlo namespace
@@ -9,6 +9,9 @@
 #ifndef MONTE_CARLO_ELECTROIONIZATION_ELECTROATOMIC_REACTION_DEF_HPP
 #define MONTE_CARLO_ELECTROIONIZATION_ELECTROATOMIC_REACTION_DEF_HPP
 
+// Std Lib Includes
+#include <type_traits>
+
 // FRENSIE Includes
 #include "Utility_DesignByContract.hpp"
 #include "Utility_ExplicitTemplateInstantiationMacros.hpp"
@@ -26,8 +29,16 @@ ElectroionizationElectroatomicReaction<InterpPolicy,processed_cross_section>::El
   : BaseType( incoming_energy_grid,
               cross_section,
               threshold_energy_index ),
-    d_subshell_reactions( subshell_reactions )
-{ /* ... */ }
+    d_subshell_reactions( subshell_reactions ),
+    d_threshold_energy_index( threshold_energy_index ),
+    d_cumulative_subshell_cross_sections()
+{
+  // Make sure there is at least one subshell reaction
+  testPrecondition( subshell_reactions.size() > 0 );
+
+  this->initializeCumulativeSubshellCrossSections( *incoming_energy_grid,
+                                                   threshold_energy_index );
+}
 
 // Constructor
 template<typename InterpPolicy, bool processed_cross_section>
@@ -41,8 +52,16 @@ ElectroionizationElectroatomicReaction<InterpPolicy,processed_cross_section>::El
               cross_section,
               threshold_energy_index,
               grid_searcher ),
-    d_subshell_reactions( subshell_reactions )
-{ /* ... */ }
+    d_subshell_reactions( subshell_reactions ),
+    d_threshold_energy_index( threshold_energy_index ),
+    d_cumulative_subshell_cross_sections()
+{
+  // Make sure there is at least one subshell reaction
+  testPrecondition( subshell_reactions.size() > 0 );
+
+  this->initializeCumulativeSubshellCrossSections( *incoming_energy_grid,
+                                                   threshold_energy_index );
+}
 
 // Return the number of photons emitted from the rxn at the given energy
 /*! \details This does not include photons from atomic relaxation.
@@ -90,36 +109,163 @@ ElectroatomicReactionType ElectroionizationElectroatomicReaction<InterpPolicy,pr
   return TOTAL_ELECTROIONIZATION_ELECTROATOMIC_REACTION;
 }
 
-// Simulate the reaction
+// Initialize the cumulative subshell cross sections
 template<typename InterpPolicy, bool processed_cross_section>
-void ElectroionizationElectroatomicReaction<InterpPolicy,processed_cross_section>::react(
-                     ElectronState& electron,
-                     ParticleBank& bank,
-                     Data::SubshellType& shell_of_interaction ) const
+void ElectroionizationElectroatomicReaction<InterpPolicy,processed_cross_section>::initializeCumulativeSubshellCrossSections(
+                       const std::vector<double>& incoming_energy_grid,
+                       const size_t threshold_energy_index )
 {
-  // Sum cross section over all subshells
-  std::vector<double> cumulative_cross_section( d_subshell_reactions.size() );
-  cumulative_cross_section[0] =
-        d_subshell_reactions[0]->getCrossSection( electron.getEnergy() );
+  typedef Details::StandardReactionBaseImplInterpPolicyHelper<InterpPolicy,processed_cross_section> InterpPolicyHelper;
 
-  for ( unsigned i = 1; i < d_subshell_reactions.size(); ++i )
+  const size_t number_of_subshells = d_subshell_reactions.size();
+
+  d_cumulative_subshell_cross_sections.resize(
+      (incoming_energy_grid.size() - threshold_energy_index)*number_of_subshells );
+
+  for( size_t k = threshold_energy_index; k < incoming_energy_grid.size(); ++k )
   {
-    cumulative_cross_section[i] = cumulative_cross_section[i-1] +
-        d_subshell_reactions[i]->getCrossSection( electron.getEnergy() );
+    const double energy =
+      InterpPolicyHelper::returnEnergyOfInterest( incoming_energy_grid[k] );
+
+    double* cumulative_cross_section =
+      &d_cumulative_subshell_cross_sections[(k - threshold_energy_index)*number_of_subshells];
+
+    double cross_section_sum = 0.0;
+
+    for( size_t i = 0; i < number_of_subshells; ++i )
+    {
+      cross_section_sum += d_subshell_reactions[i]->getCrossSection( energy );
+
+      cumulative_cross_section[i] = cross_section_sum;
+    }
   }
+}
 
-  // Sample the subshell reaction
-  double scaled_random_number = cumulative_cross_section.back()*
-            Utility::RandomNumberGenerator::getRandomNumber<double>();
+// Sample the subshell reaction that will occur at the energy
+/*! \details The energy grid bin is only searched for once. When the
+ * interpolation policy uses a linear dependent variable the cumulative
+ * subshell cross sections can be interpolated directly and a binary search
+ * is used to sample the subshell reaction. Otherwise each subshell cross
+ * section is interpolated from the cached cumulative subshell cross
+ * sections (using the same special cases for zero cross section values
+ * as the subshell reactions).
+ */
+template<typename InterpPolicy, bool processed_cross_section>
+size_t ElectroionizationElectroatomicReaction<InterpPolicy,processed_cross_section>::sampleSubshellReaction( const double energy ) const
+{
+  typedef Details::StandardReactionBaseImplInterpPolicyHelper<InterpPolicy,processed_cross_section> InterpPolicyHelper;
+
+  // Make sure the energy is valid
+  testPrecondition( energy >= this->getThresholdEnergy() );
+
+  const size_t number_of_subshells = d_subshell_reactions.size();
+
+  const size_t bin_index = this->findEnergyGridBinIndex( energy );
+
+  const double energy_0 = InterpPolicyHelper::returnEnergyOfInterest(
+                                         this->getEnergyGridHead()[bin_index] );
+  const double energy_1 = InterpPolicyHelper::returnEnergyOfInterest(
+                                       this->getEnergyGridHead()[bin_index+1] );
+
+  const double* cumulative_cross_section_0 =
+    &d_cumulative_subshell_cross_sections[(bin_index - d_threshold_energy_index)*number_of_subshells];
+
+  const double* cumulative_cross_section_1 =
+    cumulative_cross_section_0 + number_of_subshells;
+
+  const double random_number =
+    Utility::RandomNumberGenerator::getRandomNumber<double>();
 
-  for ( unsigned i = 0; i < d_subshell_reactions.size(); ++i )
+  if( std::is_same<typename InterpPolicy::DepVarProcessingTag,Utility::LinDepVarProcessingTag>::value )
   {
-    if ( scaled_random_number <= cumulative_cross_section[i] )
+    const double weight =
+      InterpPolicy::interpolate( energy_0, energy_1, energy, 0.0, 1.0 );
+
+    const double scaled_random_number = random_number*
+      (cumulative_cross_section_0[number_of_subshells-1] +
+       weight*(cumulative_cross_section_1[number_of_subshells-1] -
+               cumulative_cross_section_0[number_of_subshells-1]));
+
+    // Find the first subshell with a cumulative cross section that is
+    // greater than or equal to the scaled random number
+    size_t lower_index = 0;
+    size_t upper_index = number_of_subshells-1;
+
+    while( lower_index < upper_index )
     {
-      d_subshell_reactions[i]->react( electron, bank, shell_of_interaction );
-      break;
+      const size_t mid_index = lower_index + (upper_index - lower_index)/2;
+
+      const double cumulative_cross_section =
+        cumulative_cross_section_0[mid_index] +
+        weight*(cumulative_cross_section_1[mid_index] -
+                cumulative_cross_section_0[mid_index]);
+
+      if( scaled_random_number <= cumulative_cross_section )
+        upper_index = mid_index;
+      else
+        lower_index = mid_index + 1;
     }
+
+    return lower_index;
   }
+  else
+  {
+    // Interpolate the subshell cross section at the energy
+    auto interpolate_subshell_cross_section =
+      [&]( const size_t i ) -> double
+      {
+        const double cross_section_0 = (i == 0 ? cumulative_cross_section_0[0] :
+                                        cumulative_cross_section_0[i] -
+                                        cumulative_cross_section_0[i-1]);
+
+        const double cross_section_1 = (i == 0 ? cumulative_cross_section_1[0] :
+                                        cumulative_cross_section_1[i] -
+                                        cumulative_cross_section_1[i-1]);
+
+        // Zero cross sections can occur at and below the subshell threshold
+        return Details::StandardReactionBaseImplGetCrossSectionHelper<InterpPolicy>:: template getCrossSectionImplFirstBin<false>(
+                                                             energy_0,
+                                                             energy_1,
+                                                             energy,
+                                                             cross_section_0,
+                                                             cross_section_1 );
+      };
+
+    double total_cross_section = 0.0;
+
+    for( size_t i = 0; i < number_of_subshells; ++i )
+      total_cross_section += interpolate_subshell_cross_section( i );
+
+    const double scaled_random_number = random_number*total_cross_section;
+
+    double cumulative_cross_section = 0.0;
+
+    for( size_t i = 0; i < number_of_subshells; ++i )
+    {
+      cumulative_cross_section += interpolate_subshell_cross_section( i );
+
+      if( scaled_random_number <= cumulative_cross_section )
+        return i;
+    }
+
+    return number_of_subshells-1;
+  }
+}
+
+// Simulate the reaction
+template<typename InterpPolicy, bool processed_cross_section>
+void ElectroionizationElectroatomicReaction<InterpPolicy,processed_cross_section>::react(
+                     ElectronState& electron,
+                     ParticleBank& bank,
+                     Data::SubshellType& shell_of_interaction ) const
+{
+  // Sample the subshell reaction
+  const size_t subshell_index =
+    this->sampleSubshellReaction( electron.getEnergy() );
+
+  d_subshell_reactions[subshell_index]->react( electron,
+                                               bank,
+                                               shell_of_interaction );
 }
 
 EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( ElectroionizationElectroatomicReaction<Utility::LinLin,false> );
@@ -36,7 +36,8 @@ public:
     const ElectroionizationSamplingType sampling_type,
     const double evaluation_tol = 1e-7,
     const unsigned max_number_of_iterations = 500,
-    const bool renormalize_max_knock_on_energy = false );
+    const bool renormalize_max_knock_on_energy = false,
+    const double inverse_cdf_table_tol = 0.0 );
 
   //! Create a electroionization subshell distribution
   template <typename TwoDInterpPolicy = Utility::LogLogLog,
@@ -51,7 +52,8 @@ public:
     const ElectroionizationSamplingType sampling_type,
     const double evaluation_tol = 1e-7,
     const unsigned max_number_of_iterations = 500,
-    const bool renormalize_max_knock_on_energy = false );
+    const bool renormalize_max_knock_on_energy = false,
+    const double inverse_cdf_table_tol = 0.0 );
 
 //protected:
 
@@ -67,7 +69,8 @@ public:
         subshell_distribution,
     const double evaluation_tol,
     const unsigned max_number_of_iterations,
-    const bool renormalize_max_knock_on_energy = false );
+    const bool renormalize_max_knock_on_energy = false,
+    const double inverse_cdf_table_tol = 0.0 );
 
   //! Create the electroionization subshell distribution function
   template <typename TwoDInterpPolicy = Utility::LogLogLog,
@@ -80,7 +83,8 @@ public:
     std::shared_ptr<const Utility::FullyTabularBasicBivariateDistribution>&
         subshell_distribution,
     const double evaluation_tol,
-    const unsigned max_number_of_iterations );
+    const unsigned max_number_of_iterations,
+    const double inverse_cdf_table_tol = 0.0 );
 
   //! Create the electroionization subshell distribution function
   template <typename TwoDInterpPolicy = Utility::LogLogLog,
@@ -93,7 +97,8 @@ public:
     std::shared_ptr<const Utility::FullyTabularBasicBivariateDistribution>&
         subshell_distribution,
     const double evaluation_tol,
-    const unsigned max_number_of_iterations );
+    const unsigned max_number_of_iterations,
+    const double inverse_cdf_table_tol = 0.0 );
 
   // Calculate full outgoing energy bins and pdf from recoil energy
   static void calculateOutgoingEnergyAndPDFBins(
@@ -28,7 +28,8 @@ void ElectroionizationSubshellElectronScatteringDistributionNativeFactory::creat
     const ElectroionizationSamplingType sampling_type,
     const double evaluation_tol,
     const unsigned max_number_of_iterations,
-    const bool renormalize_max_knock_on_energy )
+    const bool renormalize_max_knock_on_energy,
+    const double inverse_cdf_table_tol )
 {
   // Make sure the subshell is valid
   testPrecondition( subshell >= 0 );
@@ -49,7 +50,8 @@ void ElectroionizationSubshellElectronScatteringDistributionNativeFactory::creat
       sampling_type,
       evaluation_tol,
       max_number_of_iterations,
-      renormalize_max_knock_on_energy );
+      renormalize_max_knock_on_energy,
+      inverse_cdf_table_tol );
   }
   else if( sampling_type == OUTGOING_ENERGY_SAMPLING )
   {
@@ -65,7 +67,8 @@ void ElectroionizationSubshellElectronScatteringDistributionNativeFactory::creat
       binding_energy,
       subshell_distribution,
       evaluation_tol,
-      max_number_of_iterations );
+      max_number_of_iterations,
+      inverse_cdf_table_tol );
 
     electroionization_subshell_distribution.reset(
       new ElectroionizationSubshellElectronScatteringDistribution(
@@ -87,7 +90,8 @@ void ElectroionizationSubshellElectronScatteringDistributionNativeFactory::creat
       binding_energy,
       subshell_distribution,
       evaluation_tol,
-      max_number_of_iterations );
+      max_number_of_iterations,
+      inverse_cdf_table_tol );
 
     electroionization_subshell_distribution.reset(
       new ElectroionizationSubshellElectronScatteringDistribution(
@@ -117,7 +121,8 @@ void ElectroionizationSubshellElectronScatteringDistributionNativeFactory::creat
     const ElectroionizationSamplingType sampling_type,
     const double evaluation_tol,
     const unsigned max_number_of_iterations,
-    const bool renormalize_max_knock_on_energy )
+    const bool renormalize_max_knock_on_energy,
+    const double inverse_cdf_table_tol )
 {
   // Make sure the energy_grid is valid
   testPrecondition( energy_grid.size() > 1 );
@@ -144,7 +149,8 @@ void ElectroionizationSubshellElectronScatteringDistributionNativeFactory::creat
               subshell_distribution,
               evaluation_tol,
               max_number_of_iterations,
-              renormalize_max_knock_on_energy );
+              renormalize_max_knock_on_energy,
+              inverse_cdf_table_tol );
   }
   else
   {
@@ -172,7 +178,8 @@ void ElectroionizationSubshellElectronScatteringDistributionNativeFactory::creat
               binding_energy,
               subshell_distribution,
               evaluation_tol,
-              max_number_of_iterations );
+              max_number_of_iterations,
+              inverse_cdf_table_tol );
     }
     else if( sampling_type == OUTGOING_ENERGY_RATIO_SAMPLING )
     {
@@ -184,7 +191,8 @@ void ElectroionizationSubshellElectronScatteringDistributionNativeFactory::creat
               binding_energy,
               subshell_distribution,
               evaluation_tol,
-              max_number_of_iterations );
+              max_number_of_iterations,
+              inverse_cdf_table_tol );
     }
     else
     {
@@ -214,7 +222,8 @@ void ElectroionizationSubshellElectronScatteringDistributionNativeFactory::creat
         subshell_distribution,
     const double evaluation_tol,
     const unsigned max_number_of_iterations,
-    const bool renormalize_max_knock_on_energy )
+    const bool renormalize_max_knock_on_energy,
+    const double inverse_cdf_table_tol )
 {
   // Make sure the energy_grid is valid
   testPrecondition( energy_grid.size() > 1 );
@@ -253,14 +262,25 @@ void ElectroionizationSubshellElectronScatteringDistributionNativeFactory::creat
   }
 
   // Create the scattering function
-  subshell_distribution.reset(
-    new Utility::InterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy<TwoDInterpPolicy> >(
+  std::shared_ptr<Utility::InterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy<TwoDInterpPolicy> > >
+    interpolated_subshell_distribution(
+      new Utility::InterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy<TwoDInterpPolicy> >(
             primary_grid,
             secondary_dists,
             1e-6,
             evaluation_tol,
             1e-16,
             max_number_of_iterations ) );
+
+  // Precompute the inverse CDF tables used for sampling
+  if( inverse_cdf_table_tol > 0.0 &&
+      interpolated_subshell_distribution->canUseInverseCDFTables() )
+  {
+    interpolated_subshell_distribution->precomputeInverseCDFTables(
+                                                      inverse_cdf_table_tol );
+  }
+
+  subshell_distribution = interpolated_subshell_distribution;
 }
 
 // Create the subshell outgoing energy distribution
@@ -274,7 +294,8 @@ void ElectroionizationSubshellElectronScatteringDistributionNativeFactory::creat
     std::shared_ptr<const Utility::FullyTabularBasicBivariateDistribution>&
         subshell_distribution,
     const double evaluation_tol,
-    const unsigned max_number_of_iterations )
+    const unsigned max_number_of_iterations,
+    const double inverse_cdf_table_tol )
 {
   // Make sure the energy_grid is valid
   testPrecondition( processed_energy_grid.size() > 1 );
@@ -297,14 +318,25 @@ void ElectroionizationSubshellElectronScatteringDistributionNativeFactory::creat
   }
 
   // Create the scattering function
-  subshell_distribution.reset(
-    new Utility::InterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy<TwoDInterpPolicy> >(
+  std::shared_ptr<Utility::InterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy<TwoDInterpPolicy> > >
+    interpolated_subshell_distribution(
+      new Utility::InterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy<TwoDInterpPolicy> >(
             processed_energy_grid,
             secondary_dists,
             1e-6,
             evaluation_tol,
             1e-16,
             max_number_of_iterations ) );
+
+  // Precompute the inverse CDF tables used for sampling
+  if( inverse_cdf_table_tol > 0.0 &&
+      interpolated_subshell_distribution->canUseInverseCDFTables() )
+  {
+    interpolated_subshell_distribution->precomputeInverseCDFTables(
+                                                      inverse_cdf_table_tol );
+  }
+
+  subshell_distribution = interpolated_subshell_distribution;
 }
 
 // Create the subshell outgoing energy ratio distribution
@@ -318,7 +350,8 @@ void ElectroionizationSubshellElectronScatteringDistributionNativeFactory::creat
     std::shared_ptr<const Utility::FullyTabularBasicBivariateDistribution>&
         subshell_distribution,
     const double evaluation_tol,
-    const unsigned max_number_of_iterations )
+    const unsigned max_number_of_iterations,
+    const double inverse_cdf_table_tol )
 {
   // Make sure the energy_grid is valid
   testPrecondition( processed_energy_grid.size() > 1 );
@@ -348,14 +381,25 @@ void ElectroionizationSubshellElectronScatteringDistributionNativeFactory::creat
   }
 
   // Create the scattering function
-  subshell_distribution.reset(
-    new Utility::InterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy<TwoDInterpPolicy> >(
+  std::shared_ptr<Utility::InterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy<TwoDInterpPolicy> > >
+    interpolated_subshell_distribution(
+      new Utility::InterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy<TwoDInterpPolicy> >(
             processed_energy_grid,
             secondary_dists,
             1e-6,
             evaluation_tol,
             1e-16,
             max_number_of_iterations ) );
+
+  // Precompute the inverse CDF tables used for sampling
+  if( inverse_cdf_table_tol > 0.0 &&
+      interpolated_subshell_distribution->canUseInverseCDFTables() )
+  {
+    interpolated_subshell_distribution->precomputeInverseCDFTables(
+                                                      inverse_cdf_table_tol );
+  }
+
+  subshell_distribution = interpolated_subshell_distribution;
 }
 
 } // end MonteCarlo namespace
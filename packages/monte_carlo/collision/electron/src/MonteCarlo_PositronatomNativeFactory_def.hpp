@@ -154,7 +154,9 @@ void PositronatomNativeFactory::createPositronatomCore(
                   grid_searcher,
                   reaction_pointer,
                   properties.getBremsstrahlungAngularDistributionFunction(),
-                  properties.getElectronEvaluationTolerance() );
+                  properties.getElectronEvaluationTolerance(),
+                  properties.getElectronInverseCDFTableTolerance(),
+                  properties.getBremsstrahlungPhotonAngleTableTolerance() );
   }
 
   // Create the atomic excitation scattering reaction
@@ -181,7 +183,8 @@ void PositronatomNativeFactory::createPositronatomCore(
                       grid_searcher,
                       reaction_pointers,
                       properties.getElectroionizationSamplingMode(),
-                      properties.getElectronEvaluationTolerance() );
+                      properties.getElectronEvaluationTolerance(),
+                      properties.getElectronInverseCDFTableTolerance() );
 
     for( unsigned i = 0; i < reaction_pointers.size(); ++i )
     {
@@ -365,7 +365,8 @@ void PositronatomicReactionNativeFactory::createSubshellPositronionizationReacti
     const unsigned subshell,
     std::shared_ptr<const ReactionType>& electroionization_subshell_reaction,
     const ElectroionizationSamplingType sampling_type,
-    const double evaluation_tol )
+    const double evaluation_tol,
+    const double inverse_cdf_table_tol )
 {
   // Convert subshell number to enum
   Data::SubshellType subshell_type =
@@ -392,7 +393,10 @@ void PositronatomicReactionNativeFactory::createSubshellPositronionizationReacti
       raw_positronatom_data.getSubshellBindingEnergy( subshell ),
       electroionization_subshell_distribution,
       sampling_type,
-      evaluation_tol );
+      evaluation_tol,
+      500,
+      false,
+      inverse_cdf_table_tol );
 
 
   // Create the subshell electroelectric reaction
@@ -417,7 +421,8 @@ void PositronatomicReactionNativeFactory::createSubshellPositronionizationReacti
     std::vector<std::shared_ptr<const ReactionType> >&
     electroionization_subshell_reactions,
     const ElectroionizationSamplingType sampling_type,
-    const double evaluation_tol )
+    const double evaluation_tol,
+    const double inverse_cdf_table_tol )
 {
   electroionization_subshell_reactions.clear();
 
@@ -438,7 +443,8 @@ void PositronatomicReactionNativeFactory::createSubshellPositronionizationReacti
       *shell,
       electroionization_subshell_reaction,
       sampling_type,
-      evaluation_tol );
+      evaluation_tol,
+      inverse_cdf_table_tol );
 
     electroionization_subshell_reactions.push_back(
                       electroionization_subshell_reaction );
@@ -458,7 +464,9 @@ void PositronatomicReactionNativeFactory::createBremsstrahlungReaction(
     const std::shared_ptr<const Utility::HashBasedGridSearcher<double>>& grid_searcher,
     std::shared_ptr<const ReactionType>& bremsstrahlung_reaction,
     BremsstrahlungAngularDistributionType photon_distribution_function,
-    const double evaluation_tol )
+    const double evaluation_tol,
+    const double inverse_cdf_table_tol,
+    const double twobs_angle_table_tol )
 {
   // Make sure the energy grid is valid
   testPrecondition( raw_positronatom_data.getElectronEnergyGrid().size() ==
@@ -479,26 +487,31 @@ void PositronatomicReactionNativeFactory::createBremsstrahlungReaction(
   std::shared_ptr<const BremsstrahlungElectronScatteringDistribution>
     bremsstrahlung_distribution;
 
-  if( photon_distribution_function = DIPOLE_DISTRIBUTION )
+  if( photon_distribution_function == DIPOLE_DISTRIBUTION )
   {
     BremsstrahlungFactory::createBremsstrahlungDistribution<TwoDInterpPolicy,TwoDGridPolicy>(
       raw_positronatom_data,
       bremsstrahlung_distribution,
-      evaluation_tol );
+      evaluation_tol,
+      500,
+      inverse_cdf_table_tol );
 
   }
-  else if( photon_distribution_function = TABULAR_DISTRIBUTION )
+  else if( photon_distribution_function == TABULAR_DISTRIBUTION )
   {
   THROW_EXCEPTION( std::logic_error,
           "The detailed bremsstrahlung reaction has not been implemented");
   }
-  else if( photon_distribution_function = TWOBS_DISTRIBUTION )
+  else if( photon_distribution_function == TWOBS_DISTRIBUTION )
   {
     BremsstrahlungFactory::createBremsstrahlungDistribution<TwoDInterpPolicy,TwoDGridPolicy>(
       raw_positronatom_data,
       raw_positronatom_data.getAtomicNumber(),
       bremsstrahlung_distribution,
-      evaluation_tol );
+      evaluation_tol,
+      500,
+      inverse_cdf_table_tol,
+      twobs_angle_table_tol );
   }
 
   // Create the bremsstrahlung reaction
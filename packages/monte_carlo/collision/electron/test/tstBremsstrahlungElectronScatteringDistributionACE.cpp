@@ -25,7 +25,7 @@
 //---------------------------------------------------------------------------//
 
 std::shared_ptr<MonteCarlo::BremsstrahlungElectronScatteringDistribution>
-  ace_dipole_brem_dist, twobs_brem_dist;
+  ace_dipole_brem_dist, twobs_brem_dist, twobs_table_brem_dist;
 
 //---------------------------------------------------------------------------//
 // Tests.
@@ -290,6 +290,59 @@ FRENSIE_UNIT_TEST( BremsstrahlungElectronScatteringDistribution,
 
 }
 
+//---------------------------------------------------------------------------//
+// Check if a 2BS angular sampling table has been created
+FRENSIE_UNIT_TEST( BremsstrahlungElectronScatteringDistribution,
+                   hasTwoBSAngularSamplingTable )
+{
+  FRENSIE_CHECK( !ace_dipole_brem_dist->hasTwoBSAngularSamplingTable() );
+  FRENSIE_CHECK( !twobs_brem_dist->hasTwoBSAngularSamplingTable() );
+  FRENSIE_CHECK( twobs_table_brem_dist->hasTwoBSAngularSamplingTable() );
+}
+
+//---------------------------------------------------------------------------//
+/* Check that the 2BS photon angles sampled from the angular sampling table
+ * are distributed like the photon angles sampled with rejection
+ */
+FRENSIE_UNIT_TEST( BremsstrahlungElectronScatteringDistribution,
+                   sample_2BS_bremsstrahlung_table )
+{
+  const double incoming_energy = 1.0;
+  const size_t number_of_samples = 100000;
+
+  double photon_energy, photon_angle_cosine;
+
+  double rejection_mean = 0.0, rejection_second_moment = 0.0;
+  double table_mean = 0.0, table_second_moment = 0.0;
+
+  for( size_t i = 0; i < number_of_samples; ++i )
+  {
+    twobs_brem_dist->sample( incoming_energy,
+                             photon_energy,
+                             photon_angle_cosine );
+
+    rejection_mean += photon_angle_cosine;
+    rejection_second_moment += photon_angle_cosine*photon_angle_cosine;
+
+    twobs_table_brem_dist->sample( incoming_energy,
+                                   photon_energy,
+                                   photon_angle_cosine );
+
+    FRENSIE_REQUIRE( photon_angle_cosine >= -1.0 );
+    FRENSIE_REQUIRE( photon_angle_cosine <= 1.0 );
+
+    table_mean += photon_angle_cosine;
+    table_second_moment += photon_angle_cosine*photon_angle_cosine;
+  }
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( table_mean/number_of_samples,
+                                   rejection_mean/number_of_samples,
+                                   2e-2 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( table_second_moment/number_of_samples,
+                                   rejection_second_moment/number_of_samples,
+                                   2e-2 );
+}
+
 //---------------------------------------------------------------------------//
 /* Check that an positron can be bremsstrahlung scattered and a simple
  * (dipole distribution) photon is generated
@@ -456,6 +509,15 @@ FRENSIE_CUSTOM_UNIT_TEST_INIT()
           xss_data_extractor->extractAtomicNumber(),
           scattering_distribution ) );
 
+  twobs_table_brem_dist.reset(
+      new MonteCarlo::BremsstrahlungElectronScatteringDistribution(
+          xss_data_extractor->extractAtomicNumber(),
+          scattering_distribution ) );
+
+  twobs_table_brem_dist->createTwoBSAngularSamplingTable(
+                  {0.1, 1.0, 10.0},
+                  {1e-6, 1e-4, 1e-2, 0.1, 0.3, 0.5, 0.7, 0.9, 0.99} );
+
   // Clear setup data
   ace_file_handler.reset();
   xss_data_extractor.reset();
@@ -122,6 +122,41 @@ FRENSIE_UNIT_TEST( BremsstrahlungElectronScatteringDistributionNativeFactory,
   FRENSIE_CHECK_FLOATING_EQUALITY( photon_angle_cosine, 0.0592724905908, 1e-12 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the sample() function for a dipole distribution with inverse
+// CDF tables
+FRENSIE_UNIT_TEST( BremsstrahlungElectronScatteringDistributionNativeFactory,
+                   sample_LogLogLog_direct_inverse_cdf_tables )
+{
+  MonteCarlo::BremsstrahlungElectronScatteringDistributionNativeFactory::createBremsstrahlungDistribution<Utility::LogLogLog,Utility::Correlated>(
+                                                 *data_container,
+                                                 dipole_distribution,
+                                                 1e-7,
+                                                 500,
+                                                 1e-6 );
+
+  // Set up the random number stream
+  std::vector<double> fake_stream( 2 );
+  fake_stream[0] = 0.5; // Correlated sample the 7.94968E-04 MeV and 1.18921E-02 MeV inverse CDF tables
+  fake_stream[1] = 0.5; // Sample angle 0.0592724905908 (0.0557151835328) from analytical function
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  double incoming_energy = 0.0009;
+  double photon_energy, photon_angle_cosine;
+
+  // sample dipole_distribution
+  dipole_distribution->sample( incoming_energy,
+                               photon_energy,
+                               photon_angle_cosine );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+
+  // Test (the tabulated inverse CDFs are only approximate)
+  FRENSIE_CHECK_FLOATING_EQUALITY( photon_energy, 1.561053962145298170e-05, 1e-3 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( photon_angle_cosine, 0.0592724905908, 1e-12 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the sample() function for a dipole distribution
 FRENSIE_UNIT_TEST( BremsstrahlungElectronScatteringDistributionNativeFactory,
@@ -256,6 +291,49 @@ FRENSIE_UNIT_TEST( BremsstrahlungElectronScatteringDistributionNativeFactory,
   FRENSIE_CHECK_EQUAL( trials, 1.0 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the sample() function using a detailed 2BS angle table
+FRENSIE_UNIT_TEST( BremsstrahlungElectronScatteringDistributionNativeFactory,
+                   sample_TwoBSBremsstrahlung_angle_table_LinLinLog )
+{
+  MonteCarlo::BremsstrahlungElectronScatteringDistributionNativeFactory::createBremsstrahlungDistribution<Utility::LinLinLog,Utility::UnitBaseCorrelated>(
+                    *data_container,
+                    data_container->getAtomicNumber(),
+                    twobs_distribution,
+                    1e-7,
+                    500,
+                    0.0,
+                    1e-3 );
+
+  FRENSIE_CHECK( twobs_distribution->hasTwoBSAngularSamplingTable() );
+
+  // Set up the random number stream
+  std::vector<double> fake_stream( 5 );
+  fake_stream[0] = 0.5; // Correlated sample the 3.1622800E-01 MeV and 2.0 MeV distributions
+  fake_stream[1] = 0.5; // Sample the photon angle from the table
+  fake_stream[2] = 0.5;
+  fake_stream[3] = 0.5;
+  fake_stream[4] = 0.5;
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  MonteCarlo::ElectronScatteringDistribution::Counter trials = 0.0;
+  double incoming_energy = 1.0;
+  double photon_energy, photon_angle_cosine;
+
+  twobs_distribution->sampleAndRecordTrials( incoming_energy,
+                                             photon_energy,
+                                             photon_angle_cosine,
+                                             trials );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( photon_energy, 2.07132641637312E-04, 1e-12 );
+  FRENSIE_CHECK_GREATER_OR_EQUAL( photon_angle_cosine, -1.0 );
+  FRENSIE_CHECK_LESS_OR_EQUAL( photon_angle_cosine, 1.0 );
+  FRENSIE_CHECK_EQUAL( trials, 1.0 );
+}
+
 
 //---------------------------------------------------------------------------//
 // Custom setup
@@ -25,6 +25,9 @@
 
 std::shared_ptr<const MonteCarlo::ElectroatomicReaction> ace_total_reaction;
 
+std::vector<std::shared_ptr<const MonteCarlo::ElectroatomicReaction> >
+ace_subshell_reactions;
+
 //---------------------------------------------------------------------------//
 // Tests
 //---------------------------------------------------------------------------//
@@ -163,6 +166,78 @@ FRENSIE_UNIT_TEST( ElectroionizationElectroatomicReaction, react_ace )
   }
 }
 
+//---------------------------------------------------------------------------//
+// Check that the subshell reaction is sampled using the subshell cross
+// sections
+FRENSIE_UNIT_TEST( ElectroionizationElectroatomicReaction,
+                   react_subshell_sampling_ace )
+{
+  const double energies[3] = {1e-1, 1.58489e-1, 1.0};
+
+  for( size_t j = 0; j < 3; ++j )
+  {
+    double total_cross_section = 0.0;
+
+    for( size_t i = 0; i < ace_subshell_reactions.size(); ++i )
+    {
+      total_cross_section +=
+        ace_subshell_reactions[i]->getCrossSection( energies[j] );
+    }
+
+    const double k_shell_probability =
+      ace_subshell_reactions[0]->getCrossSection( energies[j] )/
+      total_cross_section;
+
+    {
+      MonteCarlo::ElectronState electron( 0 );
+      electron.setEnergy( energies[j] );
+      electron.setDirection( 0.0, 0.0, 1.0 );
+
+      MonteCarlo::ParticleBank bank;
+
+      Data::SubshellType shell_of_interaction;
+
+      // Set up the random number stream
+      std::vector<double> fake_stream( 3 );
+      fake_stream[0] = k_shell_probability*(1.0-1e-9); // select the k subshell
+      fake_stream[1] = 0.5;
+      fake_stream[2] = 0.5;
+
+      Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+      ace_total_reaction->react( electron, bank, shell_of_interaction );
+
+      FRENSIE_CHECK_EQUAL( shell_of_interaction, Data::K_SUBSHELL );
+
+      Utility::RandomNumberGenerator::unsetFakeStream();
+    }
+
+    {
+      MonteCarlo::ElectronState electron( 0 );
+      electron.setEnergy( energies[j] );
+      electron.setDirection( 0.0, 0.0, 1.0 );
+
+      MonteCarlo::ParticleBank bank;
+
+      Data::SubshellType shell_of_interaction;
+
+      // Set up the random number stream
+      std::vector<double> fake_stream( 3 );
+      fake_stream[0] = k_shell_probability*(1.0+1e-9); // select the l1 subshell
+      fake_stream[1] = 0.5;
+      fake_stream[2] = 0.5;
+
+      Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+      ace_total_reaction->react( electron, bank, shell_of_interaction );
+
+      FRENSIE_CHECK_EQUAL( shell_of_interaction, Data::L1_SUBSHELL );
+
+      Utility::RandomNumberGenerator::unsetFakeStream();
+    }
+  }
+}
+
 //---------------------------------------------------------------------------//
 // Check that the hydrogen differential cross section can be evaluated
 FRENSIE_UNIT_TEST( ElectroionizationElectroatomicReaction,
@@ -226,6 +301,12 @@ FRENSIE_CUSTOM_UNIT_TEST_INIT()
         grid_searcher,
         ace_total_reaction );
 
+  MonteCarlo::ElectroatomicReactionACEFactory::createSubshellElectroionizationReactions(
+        *xss_data_extractor,
+        energy_grid,
+        grid_searcher,
+        ace_subshell_reactions );
+
   // Clear setup data
   ace_file_handler.reset();
   xss_data_extractor.reset();
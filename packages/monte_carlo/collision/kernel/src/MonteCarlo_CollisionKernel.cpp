@@ -16,8 +16,8 @@ namespace MonteCarlo{
 CollisionKernel::CollisionKernel(
               const std::shared_ptr<const FilledGeometryModel>& geometry_model,
               const SimulationProperties& properties )
-  : NeutronCollisionKernel( geometry_model, properties.isImplicitCaptureModeOn() ? false : true ),
-    PhotonCollisionKernel( geometry_model, properties.isImplicitCaptureModeOn() ? false : true ),
+  : NeutronCollisionKernel( geometry_model, properties.isImplicitCaptureModeOn( NEUTRON ) ? false : true ),
+    PhotonCollisionKernel( geometry_model, properties.isImplicitCaptureModeOn( PHOTON ) ? false : true ),
     AdjointPhotonCollisionKernel( geometry_model, properties.isImplicitCaptureModeOn() ? false : true ),
     ElectronCollisionKernel( geometry_model, properties.isImplicitCaptureModeOn() ? false : true ),
     AdjointElectronCollisionKernel( geometry_model, properties.isImplicitCaptureModeOn() ? false : true ),
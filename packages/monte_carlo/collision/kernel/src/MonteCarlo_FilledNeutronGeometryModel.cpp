@@ -32,6 +32,68 @@ void FilledNeutronGeometryModel::loadScatteringCenters(
 
   nuclide_factory.createNuclideMap( scattering_center_name_map );
 }
+
+// Process the scattering centers and fractions of a material
+/*! \details Each temperature interpolated nuclide is replaced by the
+ * nuclides of its bracketing tables. The fraction of the nuclide is split
+ * between the two tables using the interpolation fraction. The material
+ * macroscopic cross section will therefore be the linear interpolation of
+ * the table cross sections in temperature and the table used at each
+ * collision will be sampled with the interpolation fraction.
+ */
+void FilledNeutronGeometryModel::processMaterialScatteringCenters(
+       const ScatteringCenterDefinitionDatabase& scattering_center_definitions,
+       std::vector<std::string>& scattering_center_names,
+       std::vector<double>& scattering_center_fractions ) const
+{
+  std::vector<std::string> processed_names;
+  std::vector<double> processed_fractions;
+
+  processed_names.reserve( scattering_center_names.size() );
+  processed_fractions.reserve( scattering_center_fractions.size() );
+
+  for( size_t i = 0; i < scattering_center_names.size(); ++i )
+  {
+    const ScatteringCenterDefinition& nuclide_definition =
+      scattering_center_definitions.getDefinition( scattering_center_names[i] );
+
+    if( nuclide_definition.hasTemperatureInterpolatedNuclearDataProperties() )
+    {
+      const double interp_fraction =
+        nuclide_definition.getNuclearDataTemperatureInterpolationFraction();
+
+      if( interp_fraction < 1.0 )
+      {
+        processed_names.push_back(
+          NuclideFactory::getTemperatureTableNuclideName(
+                scattering_center_names[i],
+                nuclide_definition.getNuclearDataProperties().tableName() ) );
+        
+        processed_fractions.push_back(
+                      scattering_center_fractions[i]*(1.0 - interp_fraction) );
+      }
+
+      if( interp_fraction > 0.0 )
+      {
+        processed_names.push_back(
+          NuclideFactory::getTemperatureTableNuclideName(
+           scattering_center_names[i],
+           nuclide_definition.getUpperNuclearDataProperties().tableName() ) );
+
+        processed_fractions.push_back(
+                              scattering_center_fractions[i]*interp_fraction );
+      }
+    }
+    else
+    {
+      processed_names.push_back( scattering_center_names[i] );
+      processed_fractions.push_back( scattering_center_fractions[i] );
+    }
+  }
+
+  scattering_center_names.swap( processed_names );
+  scattering_center_fractions.swap( processed_fractions );
+}
   
 } // end MonteCarlo namespace
 
@@ -58,6 +58,12 @@ protected:
        const SimulationProperties& properties,
        const bool verbose,                  
        ScatteringCenterNameMap& scattering_center_name_map ) const final override;
+
+  //! Process the scattering centers and fractions of a material
+  void processMaterialScatteringCenters(
+       const ScatteringCenterDefinitionDatabase& scattering_center_definitions,
+       std::vector<std::string>& scattering_center_names,
+       std::vector<double>& scattering_center_fractions ) const final override;
 };
   
 } // end MonteCarlo namespace
@@ -0,0 +1,106 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ModelRayTracer.cpp
+//! \author Alex Robinson
+//! \brief  Model ray tracer class definition
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "MonteCarlo_ModelRayTracer.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+ModelRayTracer::ModelRayTracer()
+  : d_navigator(),
+    d_ray_segments()
+{ /* ... */ }
+
+// Copy constructor
+ModelRayTracer::ModelRayTracer( const ModelRayTracer& )
+  : ModelRayTracer()
+{ /* ... */ }
+
+// Assignment operator
+ModelRayTracer& ModelRayTracer::operator=( const ModelRayTracer& )
+{
+  return *this;
+}
+
+// Trace a ray (false if the ray cannot reach the end point)
+/*! \details The ray cannot reach the end point if it leaves the model or
+ * hits a reflecting surface. A std::runtime_error will be thrown if the
+ * navigator cannot trace the ray.
+ */
+bool ModelRayTracer::traceRay( const FilledGeometryModel& model,
+                               const double position[3],
+                               const double direction[3],
+                               const CellIdType start_cell,
+                               const double distance )
+{
+  // Make sure that the distance is valid
+  testPrecondition( distance >= 0.0 );
+
+  d_ray_segments.clear();
+
+  if( !d_navigator )
+    d_navigator.reset( model.getUnfilledModel().createNavigatorAdvanced() );
+
+  d_navigator->setState( Geometry::Navigator::Length::from_value( position[0] ),
+                         Geometry::Navigator::Length::from_value( position[1] ),
+                         Geometry::Navigator::Length::from_value( position[2] ),
+                         direction[0],
+                         direction[1],
+                         direction[2],
+                         start_cell );
+
+  double remaining_distance = distance;
+
+  while( true )
+  {
+    const CellIdType cell = d_navigator->getCurrentCell();
+
+    if( model.isTerminationCell( cell ) )
+      return false;
+
+    const double distance_to_boundary = d_navigator->fireRay().value();
+
+    if( distance_to_boundary >= remaining_distance )
+    {
+      d_ray_segments.push_back( std::make_pair( cell, remaining_distance ) );
+
+      return true;
+    }
+
+    d_ray_segments.push_back( std::make_pair( cell, distance_to_boundary ) );
+
+    remaining_distance -= distance_to_boundary;
+
+    // The ray cannot pass through a reflecting surface
+    if( d_navigator->advanceToCellBoundary() )
+      return false;
+  }
+}
+
+// Return the segments of the traced ray
+auto ModelRayTracer::getRaySegments() const -> const std::vector<RaySegment>&
+{
+  return d_ray_segments;
+}
+
+// Return the cell that contains the end point of the traced ray
+auto ModelRayTracer::getEndCell() const -> CellIdType
+{
+  // Make sure that a ray has been traced
+  testPrecondition( !d_ray_segments.empty() );
+
+  return d_ray_segments.back().first;
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ModelRayTracer.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,133 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ModelRayTracer.hpp
+//! \author Alex Robinson
+//! \brief  Model ray tracer class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_MODEL_RAY_TRACER_HPP
+#define MONTE_CARLO_MODEL_RAY_TRACER_HPP
+
+// Std Lib Includes
+#include <memory>
+
+// FRENSIE Includes
+#include "MonteCarlo_FilledGeometryModel.hpp"
+#include "Geometry_Navigator.hpp"
+#include "Utility_Vector.hpp"
+
+namespace MonteCarlo{
+
+/*! The model ray tracer class
+ * \details A ray of a fixed length is traced from a point through a filled
+ * geometry model with a navigator (created on the first trace and then
+ * reused). The cells that are crossed and the track length in each cell are
+ * recorded so that the optical depth along the ray can be calculated at any
+ * number of energies without tracing the ray again. A copy of a ray tracer
+ * does not copy the navigator or the traced ray, which allows each thread
+ * to own a ray tracer (e.g. in a Utility::PerThread object).
+ */
+class ModelRayTracer
+{
+
+public:
+
+  //! The cell id type
+  typedef Geometry::Model::EntityId CellIdType;
+
+  //! The ray segment type (cell, track length)
+  typedef std::pair<CellIdType,double> RaySegment;
+
+  //! Constructor
+  ModelRayTracer();
+
+  //! Copy constructor (the navigator and the traced ray are not copied)
+  ModelRayTracer( const ModelRayTracer& );
+
+  //! Assignment operator (the navigator and the traced ray are not copied)
+  ModelRayTracer& operator=( const ModelRayTracer& );
+
+  //! Destructor
+  ~ModelRayTracer()
+  { /* ... */ }
+
+  //! Trace a ray (false if the ray cannot reach the end point)
+  bool traceRay( const FilledGeometryModel& model,
+                 const double position[3],
+                 const double direction[3],
+                 const CellIdType start_cell,
+                 const double distance );
+
+  //! Return the segments of the traced ray
+  const std::vector<RaySegment>& getRaySegments() const;
+
+  //! Return the cell that contains the end point of the traced ray
+  CellIdType getEndCell() const;
+
+  //! Calculate the optical depth along the traced ray
+  template<typename StateType>
+  double calculateOpticalDepth( const FilledGeometryModel& model,
+                                const double energy ) const;
+
+  //! Calculate the optical depth along the traced ray
+  template<typename CellCrossSectionFunctor>
+  double calculateOpticalDepth(
+                        const CellCrossSectionFunctor& cell_cross_section ) const;
+
+private:
+
+  // The navigator used to trace rays through the model
+  std::unique_ptr<Geometry::Navigator> d_navigator;
+
+  // The cells and track lengths along the traced ray
+  std::vector<RaySegment> d_ray_segments;
+};
+
+// Calculate the optical depth along the traced ray
+/*! \details The total macroscopic cross sections of the cells that are
+ * crossed are evaluated at the requested energy (void cells do not
+ * contribute).
+ */
+template<typename StateType>
+inline double ModelRayTracer::calculateOpticalDepth(
+                                           const FilledGeometryModel& model,
+                                           const double energy ) const
+{
+  return this->calculateOpticalDepth(
+           [&model,energy]( const CellIdType cell ) -> double
+           {
+             if( model.isCellVoid<StateType>( cell ) )
+               return 0.0;
+             else
+             {
+               return model.getMacroscopicTotalCrossSection<StateType>( cell,
+                                                                        energy );
+             }
+           } );
+}
+
+// Calculate the optical depth along the traced ray
+/*! \details The cell cross section functor must return the total
+ * macroscopic cross section of a cell. It can be used to cache the cross
+ * sections when the optical depth of many rays must be calculated.
+ */
+template<typename CellCrossSectionFunctor>
+inline double ModelRayTracer::calculateOpticalDepth(
+                       const CellCrossSectionFunctor& cell_cross_section ) const
+{
+  double optical_depth = 0.0;
+
+  for( auto&& segment : d_ray_segments )
+    optical_depth += segment.second*cell_cross_section( segment.first );
+
+  return optical_depth;
+}
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_MODEL_RAY_TRACER_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ModelRayTracer.hpp
+//---------------------------------------------------------------------------//
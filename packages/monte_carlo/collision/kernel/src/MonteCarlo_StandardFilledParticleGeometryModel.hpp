@@ -168,6 +168,12 @@ protected:
   virtual void processLoadedScatteringCenters(
                    const ScatteringCenterNameMap& scattering_centers );
 
+  //! Process the scattering centers and fractions of a material
+  virtual void processMaterialScatteringCenters(
+       const ScatteringCenterDefinitionDatabase& scattering_center_definitions,
+       std::vector<std::string>& scattering_center_names,
+       std::vector<double>& scattering_center_fractions ) const;
+
 private:
 
   // Add a material to the collision kernel
@@ -125,6 +125,10 @@ void StandardFilledParticleGeometryModel<Material>::loadMaterialsAndFillModel(
           Utility::get<1>( material_definition[i] );
       }
 
+      this->processMaterialScatteringCenters( scattering_center_definitions,
+                                              scattering_center_names,
+                                              scattering_center_fractions );
+
       new_material.reset( new MaterialType( material_id,
                                             density,
                                             d_scattering_center_name_map,
@@ -197,6 +201,19 @@ void StandardFilledParticleGeometryModel<Material>::processLoadedScatteringCente
                                                const ScatteringCenterNameMap& )
 { /* ... */ }
 
+// Process the scattering centers and fractions of a material
+/*! \details This method is called before each material is constructed. It
+ * can be used to replace the scattering centers listed in the material
+ * definition with the scattering centers that were actually loaded (e.g.
+ * the bracketing tables of a temperature interpolated scattering center).
+ */
+template<typename Material>
+void StandardFilledParticleGeometryModel<Material>::processMaterialScatteringCenters(
+                                   const ScatteringCenterDefinitionDatabase&,
+                                   std::vector<std::string>&,
+                                   std::vector<double>& ) const
+{ /* ... */ }
+
 // Check if the entire model is void
 template<typename Material>
 bool StandardFilledParticleGeometryModel<Material>::isVoid() const
@@ -8,10 +8,16 @@
 
 // Std Lib Includes
 #include <iostream>
+#include <fstream>
+#include <sstream>
+
+// Boost Includes
+#include <boost/algorithm/string/replace.hpp>
 
 // FRENSIE Includes
 #include "MonteCarlo_FilledGeometryModel.hpp"
 #include "Data_ScatteringCenterPropertiesDatabase.hpp"
+#include "Data_ACENuclearDataProperties.hpp"
 #include "Geometry_InfiniteMediumModel.hpp"
 #include "Utility_RandomNumberGenerator.hpp"
 #include "Utility_UnitTestHarnessWithMain.hpp"
@@ -39,6 +45,57 @@ scattering_center_definition_database;
 std::shared_ptr<MonteCarlo::MaterialDefinitionDatabase>
 material_definition_database;
 
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Copy an ACE table and give the copy a new table name
+/*! \details There is only a single evaluation temperature available for each
+ * nuclide in the test data. A renamed copy of a table can be used to test the
+ * temperature interpolated nuclides.
+ */
+void copyACETable( const boost::filesystem::path& ace_file_path,
+                   const size_t table_start_line,
+                   const std::string& table_name,
+                   const std::string& new_table_name,
+                   const boost::filesystem::path& new_ace_file_path )
+{
+  std::ifstream ace_file( ace_file_path.string() );
+  std::ofstream new_ace_file( new_ace_file_path.string() );
+
+  std::string line;
+
+  for( size_t i = 1; i < table_start_line; ++i )
+    std::getline( ace_file, line );
+
+  // Rename the table (header line 1)
+  std::getline( ace_file, line );
+  boost::algorithm::replace_first( line, table_name, new_table_name );
+  new_ace_file << line << "\n";
+
+  // Copy the second header line and the zaids and awrs
+  for( size_t i = 0; i < 5; ++i )
+  {
+    std::getline( ace_file, line );
+    new_ace_file << line << "\n";
+  }
+
+  // The first nxs value is the size of the xss array
+  size_t xss_size;
+
+  std::getline( ace_file, line );
+  std::istringstream( line ) >> xss_size;
+  new_ace_file << line << "\n";
+
+  // Copy the remaining nxs line, the jxs array and the xss array
+  const size_t remaining_lines = 5 + (xss_size + 3)/4;
+
+  for( size_t i = 0; i < remaining_lines; ++i )
+  {
+    std::getline( ace_file, line );
+    new_ace_file << line << "\n";
+  }
+}
+
 //---------------------------------------------------------------------------//
 // Tests
 //---------------------------------------------------------------------------//
@@ -3988,6 +4045,137 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( FilledGeometryModel,
   Utility::JustInTimeInitializer::getInstance().deactivate();
 }
 
+//---------------------------------------------------------------------------//
+// Check that the fraction of a temperature interpolated nuclide is split
+// between its bracketing tables
+FRENSIE_UNIT_TEST( FilledGeometryModel,
+                   get_cross_section_temperature_interpolated_neutron_mode )
+{
+  boost::filesystem::path database_path = test_scattering_center_database_name;
+
+  const Data::ScatteringCenterPropertiesDatabase database( database_path );
+
+  const Data::NuclideProperties& h1_properties =
+    database.getNuclideProperties( 1001 );
+
+  // Create a renamed copy of the H-1 table to act as a higher temperature
+  // evaluation (600K)
+  std::shared_ptr<const Data::NuclearDataProperties> h1_lower_properties =
+    h1_properties.getSharedNuclearDataProperties(
+                                         Data::NuclearDataProperties::ACE_FILE,
+                                         7,
+                                         2.53010E-08*MeV,
+                                         true );
+
+  copyACETable( database_path.parent_path() / h1_lower_properties->filePath(),
+                h1_lower_properties->fileStartLine(),
+                "1001.70c",
+                "1001.71c",
+                database_path.parent_path() / "test_h1_71c_ace_file.txt" );
+
+  std::shared_ptr<const Data::NuclearDataProperties> h1_upper_properties(
+                new Data::ACENuclearDataProperties(
+                                    h1_lower_properties->atomicWeightRatio(),
+                                    5.17041E-08*MeV,
+                                    "test_h1_71c_ace_file.txt",
+                                    1,
+                                    "1001.71c" ) );
+
+  std::shared_ptr<MonteCarlo::ScatteringCenterDefinitionDatabase>
+    local_scattering_center_definition_database(
+                          new MonteCarlo::ScatteringCenterDefinitionDatabase );
+
+  local_scattering_center_definition_database->createDefinition( "H1 @ 293.6K", 1001 ).setNuclearDataProperties( h1_lower_properties );
+
+  // 400K (3.446933E-08 MeV)
+  MonteCarlo::ScatteringCenterDefinition& h1_400K_definition =
+    local_scattering_center_definition_database->createDefinition( "H1 @ 400K", 1001 );
+
+  h1_400K_definition.setTemperatureInterpolatedNuclearDataProperties(
+                                                 h1_lower_properties,
+                                                 h1_upper_properties,
+                                                 3.446933E-08*MeV );
+
+  std::shared_ptr<MonteCarlo::MaterialDefinitionDatabase>
+    local_material_definition_database(
+                                  new MonteCarlo::MaterialDefinitionDatabase );
+
+  local_material_definition_database->addDefinition( "H1 @ 293.6K", 1,
+                                                     {"H1 @ 293.6K"}, {1.0} );
+  local_material_definition_database->addDefinition( "H1 @ 400K", 2,
+                                                     {"H1 @ 400K"}, {1.0} );
+
+  std::shared_ptr<MonteCarlo::SimulationProperties> properties( new MonteCarlo::SimulationProperties );
+  properties->setParticleMode( MonteCarlo::NEUTRON_MODE );
+
+  MonteCarlo::FilledGeometryModel reference_filled_model(
+              test_scattering_center_database_name,
+              local_scattering_center_definition_database,
+              local_material_definition_database,
+              properties,
+              std::shared_ptr<const Geometry::Model>( new Geometry::InfiniteMediumModel( 1, 1, -1.0/cubic_centimeter ) ),
+              true );
+
+  MonteCarlo::FilledGeometryModel filled_model(
+              test_scattering_center_database_name,
+              local_scattering_center_definition_database,
+              local_material_definition_database,
+              properties,
+              std::shared_ptr<const Geometry::Model>( new Geometry::InfiniteMediumModel( 1, 2, -1.0/cubic_centimeter ) ),
+              true );
+
+  // Check the scattering center fractions
+  const std::shared_ptr<const MonteCarlo::NeutronMaterial>& material =
+    static_cast<const MonteCarlo::FilledNeutronGeometryModel&>( filled_model ).getMaterial( 1 );
+
+  const double interp_fraction =
+    h1_400K_definition.getNuclearDataTemperatureInterpolationFraction();
+
+  FRENSIE_REQUIRE_FLOATING_EQUALITY( interp_fraction,
+                                     (3.446933E-08 - 2.53010E-08)/
+                                     (5.17041E-08 - 2.53010E-08),
+                                     1e-12 );
+
+  const double number_density = material->getNumberDensity();
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+     material->getScatteringCenterNumberDensity( "H1 @ 400K@1001.70c" ),
+     (1.0 - interp_fraction)*number_density,
+     1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+     material->getScatteringCenterNumberDensity( "H1 @ 400K@1001.71c" ),
+     interp_fraction*number_density,
+     1e-12 );
+
+  // Check the interpolated cross sections
+  MonteCarlo::NeutronState neutron( 1ull );
+  neutron.embedInModel( filled_model );
+  neutron.setEnergy( 1.0 );
+
+  const double lower_cross_section =
+    material->getScatteringCenter( "H1 @ 400K@1001.70c" )->getTotalCrossSection( 1.0 );
+
+  const double upper_cross_section =
+    material->getScatteringCenter( "H1 @ 400K@1001.71c" )->getTotalCrossSection( 1.0 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                       filled_model.getMacroscopicTotalCrossSection( neutron ),
+                       number_density*((1.0 - interp_fraction)*lower_cross_section +
+                                       interp_fraction*upper_cross_section),
+                       1e-12 );
+
+  // The renamed table is a copy so the interpolated cross section must match
+  // the single table cross section
+  MonteCarlo::NeutronState reference_neutron( 1ull );
+  reference_neutron.embedInModel( reference_filled_model );
+  reference_neutron.setEnergy( 1.0 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+       filled_model.getMacroscopicTotalCrossSection( neutron ),
+       reference_filled_model.getMacroscopicTotalCrossSection( reference_neutron ),
+       1e-12 );
+}
+
 //---------------------------------------------------------------------------//
 // Custom Setup
 //---------------------------------------------------------------------------//
@@ -0,0 +1,260 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstModelRayTracer.cpp
+//! \author Alex Robinson
+//! \brief  Model ray tracer class unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+
+// FRENSIE Includes
+#include "MonteCarlo_ModelRayTracer.hpp"
+#include "MonteCarlo_FilledGeometryModel.hpp"
+#include "MonteCarlo_NeutronState.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+#include "Data_ScatteringCenterPropertiesDatabase.hpp"
+#include "Geometry_InfiniteMediumModel.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+using boost::units::si::kelvin;
+using boost::units::cgs::cubic_centimeter;
+using Utility::Units::MeV;
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+std::string test_scattering_center_database_name;
+
+std::shared_ptr<MonteCarlo::ScatteringCenterDefinitionDatabase>
+scattering_center_definition_database;
+
+std::shared_ptr<MonteCarlo::MaterialDefinitionDatabase>
+material_definition_database;
+
+std::shared_ptr<const MonteCarlo::FilledGeometryModel> filled_model;
+
+//---------------------------------------------------------------------------//
+// Tests
+//---------------------------------------------------------------------------//
+// Check that a ray can be traced through the model
+FRENSIE_UNIT_TEST( ModelRayTracer, traceRay )
+{
+  MonteCarlo::ModelRayTracer ray_tracer;
+
+  FRENSIE_CHECK( ray_tracer.getRaySegments().empty() );
+
+  const double position[3] = {0.0, 0.0, 0.0};
+  const double direction[3] = {0.0, 0.0, 1.0};
+
+  FRENSIE_REQUIRE( ray_tracer.traceRay( *filled_model,
+                                        position,
+                                        direction,
+                                        1,
+                                        2.0 ) );
+
+  FRENSIE_REQUIRE_EQUAL( ray_tracer.getRaySegments().size(), 1 );
+  FRENSIE_CHECK_EQUAL( ray_tracer.getRaySegments().front().first, 1 );
+  FRENSIE_CHECK_EQUAL( ray_tracer.getRaySegments().front().second, 2.0 );
+  FRENSIE_CHECK_EQUAL( ray_tracer.getEndCell(), 1 );
+
+  // A new trace replaces the previous ray
+  FRENSIE_REQUIRE( ray_tracer.traceRay( *filled_model,
+                                        position,
+                                        direction,
+                                        1,
+                                        0.5 ) );
+
+  FRENSIE_REQUIRE_EQUAL( ray_tracer.getRaySegments().size(), 1 );
+  FRENSIE_CHECK_EQUAL( ray_tracer.getRaySegments().front().second, 0.5 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a copied ray tracer does not copy the traced ray
+FRENSIE_UNIT_TEST( ModelRayTracer, copy )
+{
+  MonteCarlo::ModelRayTracer ray_tracer;
+
+  const double position[3] = {0.0, 0.0, 0.0};
+  const double direction[3] = {1.0, 0.0, 0.0};
+
+  FRENSIE_REQUIRE( ray_tracer.traceRay( *filled_model,
+                                        position,
+                                        direction,
+                                        1,
+                                        1.0 ) );
+
+  MonteCarlo::ModelRayTracer ray_tracer_copy( ray_tracer );
+
+  FRENSIE_CHECK( ray_tracer_copy.getRaySegments().empty() );
+
+  ray_tracer_copy = ray_tracer;
+
+  FRENSIE_CHECK( ray_tracer_copy.getRaySegments().empty() );
+  FRENSIE_CHECK_EQUAL( ray_tracer.getRaySegments().size(), 1 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the optical depth along the traced ray can be calculated
+FRENSIE_UNIT_TEST( ModelRayTracer, calculateOpticalDepth )
+{
+  MonteCarlo::ModelRayTracer ray_tracer;
+
+  const double position[3] = {0.0, 0.0, 0.0};
+  const double direction[3] = {0.0, 1.0, 0.0};
+
+  FRENSIE_REQUIRE( ray_tracer.traceRay( *filled_model,
+                                        position,
+                                        direction,
+                                        1,
+                                        2.0 ) );
+
+  const double cross_section =
+    filled_model->getMacroscopicTotalCrossSection<MonteCarlo::NeutronState>( 1, 1.0 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+        ray_tracer.calculateOpticalDepth<MonteCarlo::NeutronState>( *filled_model, 1.0 ),
+        2.0*cross_section,
+        1e-15 );
+
+  // Photons are not transported in neutron mode (void cells)
+  FRENSIE_CHECK_EQUAL(
+        ray_tracer.calculateOpticalDepth<MonteCarlo::PhotonState>( *filled_model, 1.0 ),
+        0.0 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+        ray_tracer.calculateOpticalDepth( []( const MonteCarlo::ModelRayTracer::CellIdType ){ return 0.25; } ),
+        0.5,
+        1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Custom Setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_COMMAND_LINE_OPTIONS()
+{
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "test_database",
+                                        test_scattering_center_database_name, "",
+                                        "Test scattering center database name "
+                                        "with path" );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  {
+    // Determine the database directory
+    boost::filesystem::path database_path =
+      test_scattering_center_database_name;
+
+    // Load the database
+    const Data::ScatteringCenterPropertiesDatabase database( database_path );
+
+    const Data::AtomProperties& h_properties =
+      database.getAtomProperties( 1001 );
+
+    const Data::NuclideProperties& h1_properties =
+      database.getNuclideProperties( 1001 );
+
+    const Data::AtomProperties& o_properties =
+      database.getAtomProperties( 8016 );
+
+    const Data::NuclideProperties& o16_properties =
+      database.getNuclideProperties( 8016 );
+
+    // Set the sattering center definitions
+    scattering_center_definition_database.reset(
+                          new MonteCarlo::ScatteringCenterDefinitionDatabase );
+
+    MonteCarlo::ScatteringCenterDefinition& h_definition =
+      scattering_center_definition_database->createDefinition( "H1 @ 293.6K", 1001 );
+
+    h_definition.setPhotoatomicDataProperties(
+          h_properties.getSharedPhotoatomicDataProperties(
+                       Data::PhotoatomicDataProperties::Native_EPR_FILE, 0 ) );
+
+    h_definition.setAdjointPhotoatomicDataProperties(
+          h_properties.getSharedAdjointPhotoatomicDataProperties(
+                Data::AdjointPhotoatomicDataProperties::Native_EPR_FILE, 0 ) );
+
+    h_definition.setElectroatomicDataProperties(
+          h_properties.getSharedElectroatomicDataProperties(
+                     Data::ElectroatomicDataProperties::Native_EPR_FILE, 0 ) );
+
+    h_definition.setAdjointElectroatomicDataProperties(
+          h_properties.getSharedAdjointElectroatomicDataProperties(
+              Data::AdjointElectroatomicDataProperties::Native_EPR_FILE, 0 ) );
+
+    h_definition.setNuclearDataProperties(
+          h1_properties.getSharedNuclearDataProperties(
+                                         Data::NuclearDataProperties::ACE_FILE,
+                                         7,
+                                         2.53010E-08*MeV,
+                                         true ) );
+
+    MonteCarlo::ScatteringCenterDefinition& o_definition =
+      scattering_center_definition_database->createDefinition( "O16 @ 293.6K", 8016 );
+
+    o_definition.setPhotoatomicDataProperties(
+          o_properties.getSharedPhotoatomicDataProperties(
+                         Data::PhotoatomicDataProperties::ACE_EPR_FILE, 12 ) );
+
+    o_definition.setElectroatomicDataProperties(
+          o_properties.getSharedElectroatomicDataProperties(
+                       Data::ElectroatomicDataProperties::ACE_EPR_FILE, 12 ) );
+
+    o_definition.setNuclearDataProperties(
+          o16_properties.getSharedNuclearDataProperties(
+                                         Data::NuclearDataProperties::ACE_FILE,
+                                         7,
+                                         2.53010E-08*MeV,
+                                         true ) );
+
+    material_definition_database.reset(
+                                  new MonteCarlo::MaterialDefinitionDatabase );
+
+    // Set the material definitions
+    material_definition_database->addDefinition(
+                                               "Water @ 293.6K", 1,
+                                               {"H1 @ 293.6K", "O16 @ 293.6K"},
+                                               {2.0,           1.0});
+
+    material_definition_database->addDefinition( "H1 @ 293.6K", 2,
+                                                 {"H1 @ 293.6K"}, {1.0} );
+  }
+
+  // Create the filled model (neutron mode)
+  {
+    std::shared_ptr<const Geometry::Model> unfilled_model(
+            new Geometry::InfiniteMediumModel( 1, 1, -1.0/cubic_centimeter ) );
+
+    std::shared_ptr<MonteCarlo::SimulationProperties>
+      properties( new MonteCarlo::SimulationProperties );
+    properties->setParticleMode( MonteCarlo::NEUTRON_MODE );
+
+    filled_model.reset( new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        unfilled_model,
+                                        true ) );
+  }
+
+  // Initialize the random number generator
+  Utility::RandomNumberGenerator::createStreams();
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstModelRayTracer.cpp
+//---------------------------------------------------------------------------//
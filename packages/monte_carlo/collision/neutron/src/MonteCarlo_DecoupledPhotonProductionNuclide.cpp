@@ -36,7 +36,10 @@ DecoupledPhotonProductionNuclide::DecoupledPhotonProductionNuclide(
           grid_searcher,
           const ConstReactionMap& standard_scattering_reactions,
           const ConstReactionMap& standard_absorption_reactions,
-          const ConstPhotonProductionReactionMap& photon_production_reactions )
+          const ConstPhotonProductionReactionMap& photon_production_reactions,
+          const std::shared_ptr<const SAlphaBeta>& s_alpha_beta,
+          const std::shared_ptr<const UnresolvedResonanceProbabilityTable>&
+          unresolved_resonance_table )
   : Nuclide( name,
              atomic_number,
              atomic_mass_number,
@@ -46,7 +49,9 @@ DecoupledPhotonProductionNuclide::DecoupledPhotonProductionNuclide(
              energy_grid,
              grid_searcher,
              standard_scattering_reactions,
-             standard_absorption_reactions )
+             standard_absorption_reactions,
+             s_alpha_beta,
+             unresolved_resonance_table )
 {
   // Place the photon production reactions into the member data
   ConstPhotonProductionReactionMap::const_iterator reaction_type_pointer, end_reaction_type_pointer;
@@ -48,7 +48,12 @@ public:
      grid_searcher,
      const ConstReactionMap& standard_scattering_reactions,
      const ConstReactionMap& standard_absorption_reactions,
-     const ConstPhotonProductionReactionMap& photon_production_reactions );
+     const ConstPhotonProductionReactionMap& photon_production_reactions,
+     const std::shared_ptr<const SAlphaBeta>& s_alpha_beta =
+     std::shared_ptr<const SAlphaBeta>(),
+     const std::shared_ptr<const UnresolvedResonanceProbabilityTable>&
+     unresolved_resonance_table =
+     std::shared_ptr<const UnresolvedResonanceProbabilityTable>() );
 
   //! Destructor
   ~DecoupledPhotonProductionNuclide()
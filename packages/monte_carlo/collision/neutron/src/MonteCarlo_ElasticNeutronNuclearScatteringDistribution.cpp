@@ -169,6 +169,65 @@ void ElasticNeutronNuclearScatteringDistribution::scatterParticle(
  }
 }
 
+// Evaluate the lab scattering angle cosine PDF
+/*! \details Target-at-rest kinematics are always used (the thermal motion
+ * of the target is ignored). The center-of-mass scattering angle cosine that
+ * results in the lab scattering angle cosine is found by inverting the
+ * target-at-rest relationship and the center-of-mass PDF is transformed to
+ * the lab frame with the Jacobian of this relationship. When the atomic
+ * weight ratio is less than one a lab angle can be reached with two
+ * center-of-mass angles - only the forward branch is considered since the
+ * backward branch only contributes near the kinematic limit.
+ */
+double ElasticNeutronNuclearScatteringDistribution::evaluateLabScatteringAnglePDF(
+                                   const double incoming_energy,
+                                   const double scattering_angle_cosine,
+                                   double& outgoing_energy ) const
+{
+  // Make sure the incoming energy is valid
+  testPrecondition( incoming_energy > 0.0 );
+  // Make sure the scattering angle cosine is valid
+  testPrecondition( scattering_angle_cosine >= -1.0 );
+  testPrecondition( scattering_angle_cosine <= 1.0 );
+
+  const double A = this->getAtomicWeightRatio();
+  const double mu_sqr = scattering_angle_cosine*scattering_angle_cosine;
+
+  outgoing_energy = incoming_energy;
+
+  // Check if the lab angle is kinematically accessible
+  const double discriminant = A*A - 1.0 + mu_sqr;
+
+  if( discriminant < 0.0 )
+    return 0.0;
+
+  double cm_scattering_angle_cosine =
+    (-(1.0 - mu_sqr) + scattering_angle_cosine*sqrt( discriminant ))/A;
+
+  // Correct for roundoff errors
+  if( cm_scattering_angle_cosine < -1.0 )
+    cm_scattering_angle_cosine = -1.0;
+  else if( cm_scattering_angle_cosine > 1.0 )
+    cm_scattering_angle_cosine = 1.0;
+
+  // The center-of-mass angle must result in a lab angle with the same sign
+  if( (A*cm_scattering_angle_cosine + 1.0)*scattering_angle_cosine < 0.0 ||
+      A + cm_scattering_angle_cosine <= 0.0 )
+    return 0.0;
+
+  const double energy_ratio_arg = A*A + 2*A*cm_scattering_angle_cosine + 1.0;
+
+  outgoing_energy = incoming_energy*energy_ratio_arg/((A+1.0)*(A+1.0));
+
+  // dmu_lab/dmu_cm = A^2(A + mu_cm)/(A^2 + 2A*mu_cm + 1)^(3/2)
+  const double jacobian = energy_ratio_arg*sqrt( energy_ratio_arg )/
+    (A*A*(A + cm_scattering_angle_cosine));
+
+  return d_angular_scattering_distribution->evaluatePDF(
+                                        incoming_energy,
+                                        cm_scattering_angle_cosine )*jacobian;
+}
+
 // Sample the velocity of the target nucleus
 /*! \details the temperature should be in units of MeV (kT)
  */
@@ -43,6 +43,12 @@ public:
 			NeutronState& outgoing_particle,
 			const double temperature ) const override;
 
+  //! Evaluate the lab scattering angle cosine PDF
+  double evaluateLabScatteringAnglePDF(
+                                 const double incoming_energy,
+                                 const double scattering_angle_cosine,
+                                 double& outgoing_energy ) const override;
+
 protected:
 
   //! Calculate the center-of-mass velocity
@@ -140,6 +140,12 @@ void EnergyDependentNeutronMultiplicityReaction::react(
     std::shared_ptr<NeutronState> new_neutron(
 				    new NeutronState( neutron, true, false ) );
 
+    // The additional neutrons are part of the flight that may be represented
+    // by DXTRAN particles (the multiplicity is part of the differential
+    // cross section)
+    new_neutron->setRepresentedByDXTRANParticles(
+                                  neutron.isRepresentedByDXTRANParticles() );
+
     d_scattering_distribution->scatterParticle( *new_neutron,
 						this->getTemperature() );
 
@@ -159,6 +165,38 @@ void EnergyDependentNeutronMultiplicityReaction::react(
     neutron.setAsGone();
 }
 
+// Evaluate the differential cross section (b) of the outgoing neutrons
+/*! \details The differential cross section includes the average neutron
+ * multiplicity at the incoming energy.
+ */
+double EnergyDependentNeutronMultiplicityReaction::evaluateDifferentialCrossSection(
+                                       const double incoming_energy,
+                                       const double scattering_angle_cosine,
+                                       double& outgoing_energy ) const
+{
+  // Make sure the scattering angle cosine is valid
+  testPrecondition( scattering_angle_cosine >= -1.0 );
+  testPrecondition( scattering_angle_cosine <= 1.0 );
+
+  const double cross_section = this->getCrossSection( incoming_energy )*
+    this->getAverageNumberOfEmittedParticles( incoming_energy );
+
+  if( cross_section > 0.0 )
+  {
+    return cross_section*
+      d_scattering_distribution->evaluateLabScatteringAnglePDF(
+                                                     incoming_energy,
+                                                     scattering_angle_cosine,
+                                                     outgoing_energy );
+  }
+  else
+  {
+    outgoing_energy = incoming_energy;
+
+    return 0.0;
+  }
+}
+
 } // end MonteCarlo namespace
 
 //---------------------------------------------------------------------------//
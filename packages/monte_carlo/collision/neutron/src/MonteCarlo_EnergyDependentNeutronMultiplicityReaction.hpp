@@ -74,6 +74,12 @@ public:
   //! Simulate the reaction
   void react( NeutronState& neutron, ParticleBank& bank ) const override;
 
+  //! Evaluate the differential cross section (b) of the outgoing neutrons
+  double evaluateDifferentialCrossSection(
+                              const double incoming_energy,
+                              const double scattering_angle_cosine,
+                              double& outgoing_energy ) const override;
+
 private:
 
   // The energy grid of the number of secondary particles (of the same type as
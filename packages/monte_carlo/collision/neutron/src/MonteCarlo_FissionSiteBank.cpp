@@ -0,0 +1,133 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_FissionSiteBank.cpp
+//! \author Alex Robinson
+//! \brief  Fission site bank class definition
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "MonteCarlo_FissionSiteBank.hpp"
+#include "MonteCarlo_NeutronState.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Check if a reaction is a fission reaction
+bool FissionSiteBank::isFissionReaction( const int reaction )
+{
+  switch( reaction )
+  {
+  case N__TOTAL_FISSION_REACTION:
+  case N__FISSION_REACTION:
+  case N__N_FISSION_REACTION:
+  case N__2N_FISSION_REACTION:
+  case N__3N_FISSION_REACTION:
+    return true;
+  default:
+    return false;
+  }
+}
+
+// Default Constructor
+FissionSiteBank::FissionSiteBank()
+  : d_sites()
+{ /* ... */ }
+
+// Insert a neutron into the bank after an interaction (Most Efficient/Recommended)
+void FissionSiteBank::push( std::shared_ptr<NeutronState>& neutron,
+                            const int reaction )
+{
+  // Make sure that the neutron pointer is valid
+  testPrecondition( neutron.get() );
+
+  if( FissionSiteBank::isFissionReaction( reaction ) )
+  {
+    this->recordSite( *neutron );
+
+    neutron.reset();
+  }
+  else
+    ParticleBank::push( neutron );
+}
+
+// Insert a neutron into the bank after an interaction
+void FissionSiteBank::push( const NeutronState& neutron,
+                            const int reaction )
+{
+  if( FissionSiteBank::isFissionReaction( reaction ) )
+    this->recordSite( neutron );
+  else
+    ParticleBank::push( neutron );
+}
+
+// Record a fission site
+void FissionSiteBank::recordSite( const NeutronState& neutron )
+{
+  d_sites.emplace_back();
+
+  FissionSite& site = d_sites.back();
+
+  const double* position = neutron.getPosition();
+  const double* direction = neutron.getDirection();
+
+  site.position[0] = position[0];
+  site.position[1] = position[1];
+  site.position[2] = position[2];
+
+  site.direction[0] = direction[0];
+  site.direction[1] = direction[1];
+  site.direction[2] = direction[2];
+
+  site.energy = neutron.getEnergy();
+  site.weight = neutron.getWeight();
+}
+
+// Return the number of fission sites
+size_t FissionSiteBank::getNumberOfSites() const
+{
+  return d_sites.size();
+}
+
+// Return the fission sites
+auto FissionSiteBank::getSites() const -> const FissionSiteContainerType&
+{
+  return d_sites;
+}
+
+// Return the total weight of the fission sites
+double FissionSiteBank::getTotalSiteWeight() const
+{
+  double total_weight = 0.0;
+
+  for( size_t i = 0; i < d_sites.size(); ++i )
+    total_weight += d_sites[i].weight;
+
+  return total_weight;
+}
+
+// Append the fission sites from another bank (order preserving)
+void FissionSiteBank::appendSites( const FissionSiteBank& other_bank )
+{
+  d_sites.insert( d_sites.end(),
+                  other_bank.d_sites.begin(),
+                  other_bank.d_sites.end() );
+}
+
+// Reserve space for fission sites
+void FissionSiteBank::reserveSites( const size_t number_of_sites )
+{
+  d_sites.reserve( number_of_sites );
+}
+
+// Remove all fission sites
+void FissionSiteBank::clearSites()
+{
+  d_sites.clear();
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_FissionSiteBank.cpp
+//---------------------------------------------------------------------------//
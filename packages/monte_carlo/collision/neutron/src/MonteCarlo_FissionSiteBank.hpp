@@ -0,0 +1,103 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_FissionSiteBank.hpp
+//! \author Alex Robinson
+//! \brief  Fission site bank class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_FISSION_SITE_BANK_HPP
+#define MONTE_CARLO_FISSION_SITE_BANK_HPP
+
+// Std Lib Includes
+#include <memory>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleBank.hpp"
+#include "MonteCarlo_NuclearReactionType.hpp"
+#include "Utility_Vector.hpp"
+
+namespace MonteCarlo{
+
+/*! The fission site bank class
+ * \details Neutrons that are pushed to this bank by a fission reaction are
+ * not stored as particle states. Instead, a compact fission site record is
+ * appended to a contiguous array. The fission sites will become the source
+ * for the next k-eigenvalue cycle. All other particles are handled by the
+ * base class.
+ */
+class FissionSiteBank : public ParticleBank
+{
+
+public:
+
+  //! The fission site
+  struct FissionSite
+  {
+    //! The site position
+    double position[3];
+
+    //! The emitted neutron direction
+    double direction[3];
+
+    //! The emitted neutron energy (MeV)
+    double energy;
+
+    //! The emitted neutron weight
+    double weight;
+  };
+
+  //! The fission site container type
+  typedef std::vector<FissionSite> FissionSiteContainerType;
+
+  //! Check if a reaction is a fission reaction
+  static bool isFissionReaction( const int reaction );
+
+  //! Default Constructor
+  FissionSiteBank();
+
+  // Don't hide the base class push methods
+  using ParticleBank::push;
+
+  //! Insert a neutron into the bank after an interaction (Most Efficient/Recommended)
+  void push( std::shared_ptr<NeutronState>& neutron,
+             const int reaction ) final override;
+
+  //! Insert a neutron into the bank after an interaction
+  void push( const NeutronState& neutron,
+	     const int reaction ) final override;
+
+  //! Return the number of fission sites
+  size_t getNumberOfSites() const;
+
+  //! Return the fission sites
+  const FissionSiteContainerType& getSites() const;
+
+  //! Return the total weight of the fission sites
+  double getTotalSiteWeight() const;
+
+  //! Append the fission sites from another bank (order preserving)
+  void appendSites( const FissionSiteBank& other_bank );
+
+  //! Reserve space for fission sites
+  void reserveSites( const size_t number_of_sites );
+
+  //! Remove all fission sites
+  void clearSites();
+
+private:
+
+  // Record a fission site
+  void recordSite( const NeutronState& neutron );
+
+  // The fission sites
+  FissionSiteContainerType d_sites;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_FISSION_SITE_BANK_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_FissionSiteBank.hpp
+//---------------------------------------------------------------------------//
@@ -44,8 +44,29 @@ public:
 
   //! Simulate the reaction
   virtual void react( NeutronState& neutron, ParticleBank& bank ) const = 0;
+
+  //! Evaluate the differential cross section (b) of the outgoing neutrons
+  virtual double evaluateDifferentialCrossSection(
+                                       const double incoming_energy,
+                                       const double scattering_angle_cosine,
+                                       double& outgoing_energy ) const;
 };
 
+// Evaluate the differential cross section (b) of the outgoing neutrons
+/*! \details The differential cross section is with respect to the lab
+ * scattering angle cosine. Reactions that do not emit neutrons return zero,
+ * which is the default.
+ */
+inline double NeutronNuclearReaction::evaluateDifferentialCrossSection(
+                                       const double incoming_energy,
+                                       const double,
+                                       double& outgoing_energy ) const
+{
+  outgoing_energy = incoming_energy;
+
+  return 0.0;
+}
+
 EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( StandardReactionBaseImpl<NeutronNuclearReaction,Utility::LinLin,false> );
 EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( StandardReactionBaseImpl<NeutronNuclearReaction,Utility::LinLin,true> );
 
@@ -92,6 +92,12 @@ void NeutronScatteringReaction::react( NeutronState& neutron,
     std::shared_ptr<NeutronState> new_neutron(
 				   new NeutronState( neutron, true, false ) );
 
+    // The additional neutrons are part of the flight that may be represented
+    // by DXTRAN particles (the multiplicity is part of the differential
+    // cross section)
+    new_neutron->setRepresentedByDXTRANParticles(
+                                  neutron.isRepresentedByDXTRANParticles() );
+
     d_scattering_distribution->scatterParticle( *new_neutron,
 						this->getTemperature() );
 
@@ -104,6 +110,38 @@ void NeutronScatteringReaction::react( NeutronState& neutron,
 					      this->getTemperature() );
 }
 
+// Evaluate the differential cross section (b) of the outgoing neutrons
+/*! \details The differential cross section includes the neutron
+ * multiplicity (i.e. it is the expected number of neutrons emitted per unit
+ * lab scattering angle cosine times the reaction cross section).
+ */
+double NeutronScatteringReaction::evaluateDifferentialCrossSection(
+                                       const double incoming_energy,
+                                       const double scattering_angle_cosine,
+                                       double& outgoing_energy ) const
+{
+  // Make sure the scattering angle cosine is valid
+  testPrecondition( scattering_angle_cosine >= -1.0 );
+  testPrecondition( scattering_angle_cosine <= 1.0 );
+
+  const double cross_section = this->getCrossSection( incoming_energy );
+
+  if( cross_section > 0.0 )
+  {
+    return d_multiplicity*cross_section*
+      d_scattering_distribution->evaluateLabScatteringAnglePDF(
+                                                     incoming_energy,
+                                                     scattering_angle_cosine,
+                                                     outgoing_energy );
+  }
+  else
+  {
+    outgoing_energy = incoming_energy;
+
+    return 0.0;
+  }
+}
+
 } // end MonteCarlo namespace
 
 //---------------------------------------------------------------------------//
@@ -63,6 +63,12 @@ public:
   //! Simulate the reaction
   void react( NeutronState& neutron, ParticleBank& bank ) const override;
 
+  //! Evaluate the differential cross section (b) of the outgoing neutrons
+  double evaluateDifferentialCrossSection(
+                              const double incoming_energy,
+                              const double scattering_angle_cosine,
+                              double& outgoing_energy ) const override;
+
 private:
 
   // The neutron multiplicity
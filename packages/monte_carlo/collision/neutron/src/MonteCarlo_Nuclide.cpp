@@ -9,6 +9,7 @@
 // Std Lib Includes
 #include <stdexcept>
 #include <sstream>
+#include <algorithm>
 
 // FRENSIE Includes
 #include "MonteCarlo_Nuclide.hpp"
@@ -110,7 +111,10 @@ Nuclide::Nuclide(
           const std::shared_ptr<const Utility::HashBasedGridSearcher<double> >&
           grid_searcher,
           const ConstReactionMap& standard_scattering_reactions,
-          const ConstReactionMap& standard_absorption_reactions )
+          const ConstReactionMap& standard_absorption_reactions,
+          const std::shared_ptr<const SAlphaBeta>& s_alpha_beta,
+          const std::shared_ptr<const UnresolvedResonanceProbabilityTable>&
+          unresolved_resonance_table )
   : d_name( name ),
     d_id( Nuclide::getUniqueIdFromName( name ) ),
     d_atomic_number( atomic_number ),
@@ -119,7 +123,14 @@ Nuclide::Nuclide(
     d_atomic_weight_ratio( atomic_weight_ratio ),
     d_temperature( temperature ),
     d_total_reaction(),
-    d_total_absorption_reaction()
+    d_total_absorption_reaction(),
+    d_elastic_reaction(),
+    d_s_alpha_beta( s_alpha_beta ),
+    d_fission_reactions(),
+    d_capture_reaction(),
+    d_inelastic_reactions(),
+    d_other_absorption_reactions(),
+    d_unresolved_resonance_table( unresolved_resonance_table )
 {
   // Make sure the atomic weight ratio is valid
   testPrecondition( atomic_weight_ratio > 0.0 );
@@ -170,6 +181,37 @@ Nuclide::Nuclide(
 
   // Calculate the total cross section
   this->calculateTotalReaction( energy_grid, grid_searcher );
+
+  // Cache the elastic reaction (replaced by S(alpha,beta) at thermal energies)
+  if( d_scattering_reactions.find( N__N_ELASTIC_REACTION ) !=
+      d_scattering_reactions.end() )
+    d_elastic_reaction = d_scattering_reactions.find( N__N_ELASTIC_REACTION )->second;
+
+  TEST_FOR_EXCEPTION( d_s_alpha_beta && !d_elastic_reaction,
+                      std::runtime_error,
+                      "Nuclide " << name << " cannot use S(alpha,beta) "
+                      "thermal scattering data because it does not have an "
+                      "elastic scattering reaction!" );
+
+  // Cache the reactions that are modified by the unresolved resonance tables
+  if( d_unresolved_resonance_table )
+  {
+    for( auto&& reaction : d_scattering_reactions )
+    {
+      if( Nuclide::isFissionReaction( reaction.first ) )
+        d_fission_reactions.push_back( reaction.second );
+      else if( reaction.first != N__N_ELASTIC_REACTION )
+        d_inelastic_reactions.push_back( reaction.second );
+    }
+
+    for( auto&& reaction : d_absorption_reactions )
+    {
+      if( reaction.first == N__GAMMA_REACTION )
+        d_capture_reaction = reaction.second;
+      else
+        d_other_absorption_reactions.push_back( reaction.second );
+    }
+  }
 }
 
 // Return the nuclide name
@@ -220,16 +262,57 @@ double Nuclide::getTemperature() const
   return d_temperature;
 }
 
+// Check if the nuclide has S(alpha,beta) thermal scattering data
+bool Nuclide::hasSAlphaBetaData() const
+{
+  return d_s_alpha_beta.get() != NULL;
+}
+
+// Check if the nuclide has unresolved resonance probability tables
+bool Nuclide::hasUnresolvedResonanceData() const
+{
+  return d_unresolved_resonance_table.get() != NULL;
+}
+
 // Return the total cross section at the desired energy
+/*! \details Below the S(alpha,beta) upper energy limit the elastic cross
+ * section is replaced by the S(alpha,beta) thermal scattering cross section.
+ * In the unresolved resonance range the elastic, fission and capture cross
+ * sections are sampled from the probability tables.
+ */
 double Nuclide::getTotalCrossSection( const double energy ) const
 {
-  return d_total_reaction->getCrossSection( energy );
+  if( this->isSAlphaBetaEnergy( energy ) )
+  {
+    return d_total_reaction->getCrossSection( energy ) -
+      d_elastic_reaction->getCrossSection( energy ) +
+      d_s_alpha_beta->getCrossSection( energy );
+  }
+  else if( this->isUnresolvedResonanceEnergy( energy ) )
+  {
+    UnresolvedResonanceCrossSections cross_sections;
+
+    this->evaluateUnresolvedResonanceCrossSections( energy, cross_sections );
+
+    return cross_sections.total_cross_section;
+  }
+  else
+    return d_total_reaction->getCrossSection( energy );
 }
 
 // Return the total absorption cross section at the desired energy
 double Nuclide::getAbsorptionCrossSection( const double energy ) const
 {
-  return d_total_absorption_reaction->getCrossSection( energy );
+  if( this->isUnresolvedResonanceEnergy( energy ) )
+  {
+    UnresolvedResonanceCrossSections cross_sections;
+
+    this->evaluateUnresolvedResonanceCrossSections( energy, cross_sections );
+
+    return cross_sections.absorption_cross_section;
+  }
+  else
+    return d_total_absorption_reaction->getCrossSection( energy );
 }
 
 // Return the survival probability at the desired energy
@@ -240,8 +323,8 @@ double Nuclide::getSurvivalProbability( const double energy ) const
   testPrecondition( energy > 0.0 );
 
   double survival_prob = 1.0 -
-    d_total_absorption_reaction->getCrossSection( energy )/
-    d_total_reaction->getCrossSection( energy );
+    this->getAbsorptionCrossSection( energy )/
+    this->getTotalCrossSection( energy );
 
   // Make sure the survival probability is valid
   testPostcondition( survival_prob >= 0.0 );
@@ -255,23 +338,40 @@ double Nuclide::getReactionCrossSection(
 				     const double energy,
 				     const NuclearReactionType reaction ) const
 {
+  // The S(alpha,beta) reaction replaces the elastic reaction below its cutoff
+  if( reaction == N__N_ELASTIC_REACTION && this->isSAlphaBetaEnergy( energy ) )
+    return d_s_alpha_beta->getCrossSection( energy );
+
   switch( reaction )
   {
   case N__TOTAL_REACTION:
-    return d_total_reaction->getCrossSection( energy );
+    return this->getTotalCrossSection( energy );
   case N__TOTAL_ABSORPTION_REACTION:
-    return d_total_absorption_reaction->getCrossSection( energy );
+    return this->getAbsorptionCrossSection( energy );
   default:
+    // Scale the reactions that are modified by the unresolved resonance tables
+    double factor = 1.0;
+
+    if( this->isUnresolvedResonanceEnergy( energy ) )
+    {
+      UnresolvedResonanceCrossSections cross_sections;
+
+      this->evaluateUnresolvedResonanceCrossSections( energy, cross_sections );
+
+      factor = Nuclide::getUnresolvedResonanceFactor( reaction,
+                                                      cross_sections );
+    }
+
     ConstReactionMap::const_iterator nuclear_reaction =
       d_scattering_reactions.find( reaction );
 
     if( nuclear_reaction != d_scattering_reactions.end() )
-      return nuclear_reaction->second->getCrossSection( energy );
+      return factor*nuclear_reaction->second->getCrossSection( energy );
 
     nuclear_reaction = d_absorption_reactions.find( reaction );
 
     if( nuclear_reaction != d_absorption_reactions.end() )
-      return nuclear_reaction->second->getCrossSection( energy );
+      return factor*nuclear_reaction->second->getCrossSection( energy );
 
     nuclear_reaction = d_miscellaneous_reactions.find( reaction );
 
@@ -282,6 +382,79 @@ double Nuclide::getReactionCrossSection(
   }
 }
 
+// Return the differential scattering cross sections at the desired energy
+/*! \details The outgoing neutron energy and the cross section (b)
+ * differential in the lab scattering angle cosine of every scattering
+ * reaction will be appended to the cross sections array. Below the
+ * S(alpha,beta) upper energy limit the elastic reaction is replaced by the
+ * thermal scattering reaction and in the unresolved resonance range the
+ * cross sections are scaled by the probability table factors (the same
+ * cross sections that are used to sample a scattering reaction).
+ */
+void Nuclide::getDifferentialScatteringCrossSections(
+           const double energy,
+           const double scattering_angle_cosine,
+           std::vector<std::pair<double,double> >& cross_sections ) const
+{
+  // Make sure the energy is valid
+  testPrecondition( !QT::isnaninf( energy ) );
+  testPrecondition( energy > 0.0 );
+
+  const bool s_alpha_beta_energy = this->isSAlphaBetaEnergy( energy );
+
+  const bool unresolved_resonance_energy =
+    this->isUnresolvedResonanceEnergy( energy );
+
+  UnresolvedResonanceCrossSections unresolved_resonance_cross_sections;
+
+  if( unresolved_resonance_energy )
+  {
+    this->evaluateUnresolvedResonanceCrossSections(
+                                         energy,
+                                         unresolved_resonance_cross_sections );
+  }
+
+  ConstReactionMap::const_iterator nuclear_reaction =
+    d_scattering_reactions.begin();
+
+  while( nuclear_reaction != d_scattering_reactions.end() )
+  {
+    double outgoing_energy, cross_section;
+
+    if( s_alpha_beta_energy &&
+        nuclear_reaction->first == N__N_ELASTIC_REACTION )
+    {
+      cross_section = d_s_alpha_beta->getCrossSection( energy )*
+        d_s_alpha_beta->evaluateLabScatteringAnglePDF( energy,
+                                                       scattering_angle_cosine,
+                                                       outgoing_energy );
+    }
+    else
+    {
+      cross_section =
+        nuclear_reaction->second->evaluateDifferentialCrossSection(
+                                                     energy,
+                                                     scattering_angle_cosine,
+                                                     outgoing_energy );
+
+      if( unresolved_resonance_energy )
+      {
+        cross_section *= Nuclide::getUnresolvedResonanceFactor(
+                                       nuclear_reaction->first,
+                                       unresolved_resonance_cross_sections );
+      }
+    }
+
+    if( cross_section > 0.0 )
+    {
+      cross_sections.push_back( std::make_pair( outgoing_energy,
+                                                cross_section ) );
+    }
+
+    ++nuclear_reaction;
+  }
+}
+
 // Return the absorption reaction types
 void Nuclide::getAbsorptionReactionTypes( ReactionEnumTypeSet& reaction_types ) const
 {
@@ -341,14 +514,14 @@ void Nuclide::collideAnalogue( NeutronState& neutron,
 			       ParticleBank& bank ) const
 {
   double total_cross_section =
-    d_total_reaction->getCrossSection( neutron.getEnergy() );
+    this->getTotalCrossSection( neutron.getEnergy() );
 
   double scaled_random_number =
     Utility::RandomNumberGenerator::getRandomNumber<double>()*
     total_cross_section;
 
   double absorption_cross_section =
-    d_total_absorption_reaction->getCrossSection( neutron.getEnergy() );
+    this->getAbsorptionCrossSection( neutron.getEnergy() );
 
   // Check if absorption occurs
   if( scaled_random_number < absorption_cross_section )
@@ -364,6 +537,9 @@ void Nuclide::collideAnalogue( NeutronState& neutron,
 			      neutron,
 			      bank );
   }
+
+  // The neutron energy has changed - a new band random number is needed
+  UnresolvedResonanceProbabilityTable::resetBandRandomNumber();
 }
 
 // Collide with a neutron and survival bias
@@ -374,10 +550,10 @@ void Nuclide::collideSurvivalBias( NeutronState& neutron,
     Utility::RandomNumberGenerator::getRandomNumber<double>();
 
   double total_cross_section =
-    d_total_reaction->getCrossSection( neutron.getEnergy() );
+    this->getTotalCrossSection( neutron.getEnergy() );
 
   double scattering_cross_section = total_cross_section -
-    d_total_absorption_reaction->getCrossSection( neutron.getEnergy() );
+    this->getAbsorptionCrossSection( neutron.getEnergy() );
 
   double survival_prob = scattering_cross_section/total_cross_section;
 
@@ -392,6 +568,9 @@ void Nuclide::collideSurvivalBias( NeutronState& neutron,
   }
   else
     neutron.setAsGone();
+
+  // The neutron energy has changed - a new band random number is needed
+  UnresolvedResonanceProbabilityTable::resetBandRandomNumber();
 }
 
 // Calculate the total absorption cross section
@@ -486,6 +665,21 @@ void Nuclide::sampleScatteringReaction( const double scaled_random_number,
 {
   double partial_cross_section = 0.0;
 
+  const bool s_alpha_beta_energy =
+    this->isSAlphaBetaEnergy( neutron.getEnergy() );
+
+  const bool unresolved_resonance_energy =
+    this->isUnresolvedResonanceEnergy( neutron.getEnergy() );
+
+  UnresolvedResonanceCrossSections unresolved_resonance_cross_sections;
+
+  if( unresolved_resonance_energy )
+  {
+    this->evaluateUnresolvedResonanceCrossSections(
+                                         neutron.getEnergy(),
+                                         unresolved_resonance_cross_sections );
+  }
+
   ConstReactionMap::const_iterator nuclear_reaction, nuclear_reaction_end;
 
   nuclear_reaction = d_scattering_reactions.begin();
@@ -493,8 +687,25 @@ void Nuclide::sampleScatteringReaction( const double scaled_random_number,
 
   while( nuclear_reaction != nuclear_reaction_end )
   {
-    partial_cross_section +=
-      nuclear_reaction->second->getCrossSection( neutron.getEnergy() );
+    if( s_alpha_beta_energy &&
+        nuclear_reaction->first == N__N_ELASTIC_REACTION )
+    {
+      partial_cross_section +=
+        d_s_alpha_beta->getCrossSection( neutron.getEnergy() );
+    }
+    else if( unresolved_resonance_energy )
+    {
+      partial_cross_section +=
+        Nuclide::getUnresolvedResonanceFactor(
+                                      nuclear_reaction->first,
+                                      unresolved_resonance_cross_sections )*
+        nuclear_reaction->second->getCrossSection( neutron.getEnergy() );
+    }
+    else
+    {
+      partial_cross_section +=
+        nuclear_reaction->second->getCrossSection( neutron.getEnergy() );
+    }
 
     if( scaled_random_number < partial_cross_section )
       break;
@@ -506,7 +717,15 @@ void Nuclide::sampleScatteringReaction( const double scaled_random_number,
   testPostcondition( nuclear_reaction != nuclear_reaction_end );
 
   // Undergo reaction selected
-  nuclear_reaction->second->react( neutron, bank );
+  if( s_alpha_beta_energy &&
+      nuclear_reaction->first == N__N_ELASTIC_REACTION )
+  {
+    neutron.incrementCollisionNumber();
+
+    d_s_alpha_beta->scatterParticle( neutron, d_temperature );
+  }
+  else
+    nuclear_reaction->second->react( neutron, bank );
 }
 
 // Sample an absorption reaction
@@ -518,6 +737,18 @@ void Nuclide::sampleAbsorptionReaction( const double scaled_random_number,
 {
   double partial_cross_section = 0.0;
 
+  const bool unresolved_resonance_energy =
+    this->isUnresolvedResonanceEnergy( neutron.getEnergy() );
+
+  UnresolvedResonanceCrossSections unresolved_resonance_cross_sections;
+
+  if( unresolved_resonance_energy )
+  {
+    this->evaluateUnresolvedResonanceCrossSections(
+                                         neutron.getEnergy(),
+                                         unresolved_resonance_cross_sections );
+  }
+
   ConstReactionMap::const_iterator nuclear_reaction, nuclear_reaction_end;
 
   nuclear_reaction = d_absorption_reactions.begin();
@@ -525,8 +756,19 @@ void Nuclide::sampleAbsorptionReaction( const double scaled_random_number,
 
   while( nuclear_reaction != nuclear_reaction_end )
   {
-    partial_cross_section +=
-      nuclear_reaction->second->getCrossSection( neutron.getEnergy() );
+    if( unresolved_resonance_energy )
+    {
+      partial_cross_section +=
+        Nuclide::getUnresolvedResonanceFactor(
+                                      nuclear_reaction->first,
+                                      unresolved_resonance_cross_sections )*
+        nuclear_reaction->second->getCrossSection( neutron.getEnergy() );
+    }
+    else
+    {
+      partial_cross_section +=
+        nuclear_reaction->second->getCrossSection( neutron.getEnergy() );
+    }
 
     if( scaled_random_number < partial_cross_section )
       break;
@@ -541,6 +783,154 @@ void Nuclide::sampleAbsorptionReaction( const double scaled_random_number,
   nuclear_reaction->second->react( neutron, bank );
 }
 
+// Evaluate the unresolved resonance cross sections
+/*! \details The band values are sampled with the cached band random number
+ * (shared by all nuclides). The elastic, fission and capture band values are
+ * converted to scale factors of the smooth cross sections so that partial
+ * fission reactions can be handled. If the inelastic competition flag or the
+ * other absorption flag of the table is negative, the inelastic or other
+ * absorption cross sections are zero in the unresolved resonance range.
+ * Otherwise the flag is the reaction number of the smooth cross section that
+ * is used, which is the sum of the smooth reactions that are stored, so the
+ * smooth data is used directly.
+ */
+void Nuclide::evaluateUnresolvedResonanceCrossSections(
+                    const double energy,
+                    UnresolvedResonanceCrossSections& cross_sections ) const
+{
+  // Make sure the energy is valid
+  testPrecondition( this->isUnresolvedResonanceEnergy( energy ) );
+
+  double elastic_value, fission_value, capture_value;
+
+  d_unresolved_resonance_table->evaluate(
+                      energy,
+                      UnresolvedResonanceProbabilityTable::getBandRandomNumber(),
+                      elastic_value,
+                      fission_value,
+                      capture_value );
+
+  // Evaluate the smooth cross sections
+  const double smooth_elastic_cross_section = d_elastic_reaction ?
+    d_elastic_reaction->getCrossSection( energy ) : 0.0;
+
+  double smooth_fission_cross_section = 0.0;
+
+  for( size_t i = 0; i < d_fission_reactions.size(); ++i )
+  {
+    smooth_fission_cross_section +=
+      d_fission_reactions[i]->getCrossSection( energy );
+  }
+
+  const double smooth_capture_cross_section = d_capture_reaction ?
+    d_capture_reaction->getCrossSection( energy ) : 0.0;
+
+  // Calculate the scale factors
+  if( d_unresolved_resonance_table->areCrossSectionFactors() )
+  {
+    cross_sections.elastic_factor = elastic_value;
+    cross_sections.fission_factor = fission_value;
+    cross_sections.capture_factor = capture_value;
+  }
+  else
+  {
+    cross_sections.elastic_factor = smooth_elastic_cross_section > 0.0 ?
+      elastic_value/smooth_elastic_cross_section : 0.0;
+
+    cross_sections.fission_factor = smooth_fission_cross_section > 0.0 ?
+      fission_value/smooth_fission_cross_section : 0.0;
+
+    cross_sections.capture_factor = smooth_capture_cross_section > 0.0 ?
+      capture_value/smooth_capture_cross_section : 0.0;
+  }
+
+  // Remove the inelastic competition if it is zero in the range
+  double inelastic_difference = 0.0;
+
+  if( d_unresolved_resonance_table->getInelasticCompetitionFlag() < 0 )
+  {
+    cross_sections.inelastic_factor = 0.0;
+
+    for( size_t i = 0; i < d_inelastic_reactions.size(); ++i )
+    {
+      inelastic_difference -=
+        d_inelastic_reactions[i]->getCrossSection( energy );
+    }
+  }
+  else
+    cross_sections.inelastic_factor = 1.0;
+
+  // Remove the other absorption if it is zero in the range
+  double other_absorption_difference = 0.0;
+
+  if( d_unresolved_resonance_table->getOtherAbsorptionFlag() < 0 )
+  {
+    cross_sections.other_absorption_factor = 0.0;
+
+    for( size_t i = 0; i < d_other_absorption_reactions.size(); ++i )
+    {
+      other_absorption_difference -=
+        d_other_absorption_reactions[i]->getCrossSection( energy );
+    }
+  }
+  else
+    cross_sections.other_absorption_factor = 1.0;
+
+  // Calculate the absorption and total cross sections
+  const double absorption_difference =
+    (cross_sections.capture_factor - 1.0)*smooth_capture_cross_section +
+    other_absorption_difference;
+
+  cross_sections.absorption_cross_section = std::max(
+       d_total_absorption_reaction->getCrossSection( energy ) +
+       absorption_difference,
+       0.0 );
+
+  cross_sections.total_cross_section = std::max(
+       d_total_reaction->getCrossSection( energy ) +
+       (cross_sections.elastic_factor - 1.0)*smooth_elastic_cross_section +
+       (cross_sections.fission_factor - 1.0)*smooth_fission_cross_section +
+       inelastic_difference +
+       absorption_difference,
+       0.0 );
+}
+
+// Check if a reaction is a fission reaction
+bool Nuclide::isFissionReaction( const NuclearReactionType reaction )
+{
+  switch( reaction )
+  {
+  case N__TOTAL_FISSION_REACTION:
+  case N__FISSION_REACTION:
+  case N__N_FISSION_REACTION:
+  case N__2N_FISSION_REACTION:
+  case N__3N_FISSION_REACTION:
+    return true;
+  default:
+    return false;
+  }
+}
+
+// Return the unresolved resonance scale factor of a reaction
+/*! \details The reaction must be a scattering or an absorption reaction of
+ * the nuclide (miscellaneous reactions are never scaled).
+ */
+double Nuclide::getUnresolvedResonanceFactor(
+                    const NuclearReactionType reaction,
+                    const UnresolvedResonanceCrossSections& cross_sections )
+{
+  if( reaction == N__N_ELASTIC_REACTION )
+    return cross_sections.elastic_factor;
+  else if( reaction == N__GAMMA_REACTION )
+    return cross_sections.capture_factor;
+  else if( Nuclide::isFissionReaction( reaction ) )
+    return cross_sections.fission_factor;
+  else if( Nuclide::absorption_reaction_types.count( reaction ) )
+    return cross_sections.other_absorption_factor;
+  else
+    return cross_sections.inelastic_factor;
+}
+
 } // end MonteCarlo namespace
 
 //---------------------------------------------------------------------------//
@@ -16,6 +16,8 @@
 
 // FRENSIE Includes
 #include "MonteCarlo_NeutronNuclearReaction.hpp"
+#include "MonteCarlo_SAlphaBeta.hpp"
+#include "MonteCarlo_UnresolvedResonanceProbabilityTable.hpp"
 #include "Utility_HashBasedGridSearcher.hpp"
 #include "Utility_Vector.hpp"
 #include "Utility_Set.hpp"
@@ -24,8 +26,12 @@
 namespace MonteCarlo{
 
 /*! The nuclide class
- * \details This is the base class for all nuclides. No unresolved
- * resonance data is stored in this base class.
+ * \details This is the base class for all nuclides. If unresolved resonance
+ * probability tables are provided, the elastic, fission and capture cross
+ * sections are sampled from the tables in the unresolved resonance range.
+ * The inelastic competition and other absorption cross sections are taken
+ * from the smooth data unless the table flags indicate that they are zero
+ * in the unresolved resonance range.
  */
 class Nuclide
 {
@@ -73,7 +79,12 @@ public:
           const std::shared_ptr<const Utility::HashBasedGridSearcher<double> >&
           grid_searcher,
           const ConstReactionMap& standard_scattering_reactions,
-          const ConstReactionMap& standard_absorption_reactions );
+          const ConstReactionMap& standard_absorption_reactions,
+          const std::shared_ptr<const SAlphaBeta>& s_alpha_beta =
+          std::shared_ptr<const SAlphaBeta>(),
+          const std::shared_ptr<const UnresolvedResonanceProbabilityTable>&
+          unresolved_resonance_table =
+          std::shared_ptr<const UnresolvedResonanceProbabilityTable>() );
 
   //! Destructor
   virtual ~Nuclide()
@@ -103,6 +114,12 @@ public:
   //! Return the temperature of the nuclide (in MeV)
   double getTemperature() const;
 
+  //! Check if the nuclide has S(alpha,beta) thermal scattering data
+  bool hasSAlphaBetaData() const;
+
+  //! Check if the nuclide has unresolved resonance probability tables
+  bool hasUnresolvedResonanceData() const;
+
   //! Return the total cross section at the desired energy
   double getTotalCrossSection( const double energy ) const;
 
@@ -116,6 +133,12 @@ public:
   double getReactionCrossSection( const double energy,
 				  const NuclearReactionType reaction ) const;
 
+  //! Return the differential scattering cross sections at the desired energy
+  void getDifferentialScatteringCrossSections(
+           const double energy,
+           const double scattering_angle_cosine,
+           std::vector<std::pair<double,double> >& cross_sections ) const;
+
   //! Return the absorption reaction types
   void getAbsorptionReactionTypes( ReactionEnumTypeSet& reaction_types ) const;
 
@@ -136,6 +159,31 @@ public:
 
 private:
 
+  // The unresolved resonance cross sections at an energy
+  struct UnresolvedResonanceCrossSections
+  {
+    // The elastic cross section scale factor
+    double elastic_factor;
+
+    // The fission cross section scale factor
+    double fission_factor;
+
+    // The capture cross section scale factor
+    double capture_factor;
+
+    // The inelastic competition cross section scale factor
+    double inelastic_factor;
+
+    // The other absorption cross section scale factor
+    double other_absorption_factor;
+
+    // The total cross section
+    double total_cross_section;
+
+    // The total absorption cross section
+    double absorption_cross_section;
+  };
+
   // Set the default absorption reaction types
   static std::unordered_set<NuclearReactionType>
   setDefaultAbsorptionReactionTypes();
@@ -152,6 +200,25 @@ private:
           const std::shared_ptr<const Utility::HashBasedGridSearcher<double> >&
           grid_searcher );
 
+  // Check if S(alpha,beta) thermal scattering is used at an energy
+  bool isSAlphaBetaEnergy( const double energy ) const;
+
+  // Check if the unresolved resonance tables are used at an energy
+  bool isUnresolvedResonanceEnergy( const double energy ) const;
+
+  // Evaluate the unresolved resonance cross sections
+  void evaluateUnresolvedResonanceCrossSections(
+               const double energy,
+               UnresolvedResonanceCrossSections& cross_sections ) const;
+
+  // Check if a reaction is a fission reaction
+  static bool isFissionReaction( const NuclearReactionType reaction );
+
+  // Return the unresolved resonance scale factor of a reaction
+  static double getUnresolvedResonanceFactor(
+               const NuclearReactionType reaction,
+               const UnresolvedResonanceCrossSections& cross_sections );
+
   // Sample an absorption reaction
   void sampleAbsorptionReaction( const double scaled_random_number,
 				 NeutronState& neutron,
@@ -200,8 +267,48 @@ private:
 
   // Miscellaneous reactions
   ConstReactionMap d_miscellaneous_reactions;
+
+  // The elastic reaction (replaced by S(alpha,beta) at thermal energies)
+  std::shared_ptr<const NeutronNuclearReaction> d_elastic_reaction;
+
+  // The S(alpha,beta) thermal scattering data
+  std::shared_ptr<const SAlphaBeta> d_s_alpha_beta;
+
+  // The fission reactions (modified by the unresolved resonance tables)
+  std::vector<std::shared_ptr<const NeutronNuclearReaction> >
+  d_fission_reactions;
+
+  // The capture reaction (modified by the unresolved resonance tables)
+  std::shared_ptr<const NeutronNuclearReaction> d_capture_reaction;
+
+  // The inelastic competition reactions (zero in the unresolved resonance
+  // range if the inelastic competition flag is negative)
+  std::vector<std::shared_ptr<const NeutronNuclearReaction> >
+  d_inelastic_reactions;
+
+  // The other absorption reactions (zero in the unresolved resonance range
+  // if the other absorption flag is negative)
+  std::vector<std::shared_ptr<const NeutronNuclearReaction> >
+  d_other_absorption_reactions;
+
+  // The unresolved resonance probability tables
+  std::shared_ptr<const UnresolvedResonanceProbabilityTable>
+  d_unresolved_resonance_table;
 };
 
+// Check if S(alpha,beta) thermal scattering is used at an energy
+inline bool Nuclide::isSAlphaBetaEnergy( const double energy ) const
+{
+  return d_s_alpha_beta && energy < d_s_alpha_beta->getUpperEnergyLimit();
+}
+
+// Check if the unresolved resonance tables are used at an energy
+inline bool Nuclide::isUnresolvedResonanceEnergy( const double energy ) const
+{
+  return d_unresolved_resonance_table &&
+    d_unresolved_resonance_table->isEnergyWithinTable( energy );
+}
+
 } // end MonteCarlo namespace
 
 #endif // end MONTE_CARLO_NUCLIDE_HPP
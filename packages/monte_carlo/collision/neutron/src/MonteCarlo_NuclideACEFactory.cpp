@@ -14,6 +14,7 @@
 #include "Utility_StandardHashBasedGridSearcher.hpp"
 #include "Utility_Vector.hpp"
 #include "Utility_LoggingMacros.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
 
 namespace MonteCarlo{
 
@@ -27,6 +28,31 @@ void NuclideACEFactory::createNuclide(
 			 const double temperature,
                          const SimulationProperties& properties,
 			 std::shared_ptr<const Nuclide>& nuclide )
+{
+  NuclideACEFactory::createNuclide( raw_nuclide_data,
+                                    nuclide_alias,
+                                    atomic_number,
+                                    atomic_mass_number,
+                                    isomer_number,
+                                    atomic_weight_ratio,
+                                    temperature,
+                                    properties,
+                                    std::shared_ptr<const SAlphaBeta>(),
+                                    nuclide );
+}
+
+// Create a nuclide with S(alpha,beta) thermal scattering data
+void NuclideACEFactory::createNuclide(
+			 const Data::XSSNeutronDataExtractor& raw_nuclide_data,
+			 const std::string& nuclide_alias,
+			 const unsigned atomic_number,
+			 const unsigned atomic_mass_number,
+			 const unsigned isomer_number,
+			 const double atomic_weight_ratio,
+			 const double temperature,
+                         const SimulationProperties& properties,
+                         const std::shared_ptr<const SAlphaBeta>& s_alpha_beta,
+			 std::shared_ptr<const Nuclide>& nuclide )
 {
   // Extract the common energy grid used for this nuclide
   std::shared_ptr<const std::vector<double> > energy_grid(
@@ -37,12 +63,16 @@ void NuclideACEFactory::createNuclide(
                                energy_grid,
                                properties.getNumberOfNeutronHashGridBins() ) );
 
-  if( properties.isUnresolvedResonanceProbabilityTableModeOn() )
+  // Create the unresolved resonance probability tables
+  std::shared_ptr<const UnresolvedResonanceProbabilityTable>
+    unresolved_resonance_table;
+
+  if( properties.isUnresolvedResonanceProbabilityTableModeOn() &&
+      raw_nuclide_data.hasUnresolvedResonanceData() )
   {
-    FRENSIE_LOG_TAGGED_WARNING( "NuclideACEFactory",
-                                "Unresolved resonance data has been "
-                                "requested. This feature is not currently "
-                                "supported!" );
+    NuclideACEFactory::createUnresolvedResonanceProbabilityTable(
+                                                  raw_nuclide_data,
+                                                  unresolved_resonance_table );
   }
 
   if( properties.getParticleMode() == NEUTRON_PHOTON_MODE ||
@@ -86,7 +116,9 @@ void NuclideACEFactory::createNuclide(
                                                grid_searcher,
                                                standard_scattering_reactions,
                                                standard_absorption_reactions,
-                                               photon_production_reactions ) );
+                                               photon_production_reactions,
+                                               s_alpha_beta,
+                                               unresolved_resonance_table ) );
   }
   else
   {
@@ -119,7 +151,9 @@ void NuclideACEFactory::createNuclide(
 			        energy_grid,
                                 grid_searcher,
 			        standard_scattering_reactions,
-			        standard_absorption_reactions ) );
+			        standard_absorption_reactions,
+                                s_alpha_beta,
+                                unresolved_resonance_table ) );
   }
 }
 
@@ -135,6 +169,48 @@ void NuclideACEFactory::createScatteringReactions(
   reaction_factory.createAbsorptionReactions( absorption_reactions );
 }
 
+// Create the unresolved resonance probability tables
+void NuclideACEFactory::createUnresolvedResonanceProbabilityTable(
+                 const Data::XSSNeutronDataExtractor& raw_nuclide_data,
+                 std::shared_ptr<const UnresolvedResonanceProbabilityTable>&
+                 unresolved_resonance_table )
+{
+  // Make sure there is unresolved resonance data
+  testPrecondition( raw_nuclide_data.hasUnresolvedResonanceData() );
+
+  Utility::ArrayView<const double> unr_block =
+    raw_nuclide_data.extractUNRBlock();
+
+  const size_t number_of_energies = (size_t)unr_block[0];
+  const size_t number_of_bands = (size_t)unr_block[1];
+  const int interpolation = (int)unr_block[2];
+  const int inelastic_competition_flag = (int)unr_block[3];
+  const int other_absorption_flag = (int)unr_block[4];
+  const int cross_section_factors_flag = (int)unr_block[5];
+
+  TEST_FOR_EXCEPTION( interpolation != 2 && interpolation != 5,
+                      std::runtime_error,
+                      "The unresolved resonance probability table "
+                      "interpolation parameter (" << interpolation <<
+                      ") is not supported!" );
+
+  std::vector<double> energy_grid( unr_block( 6, number_of_energies ) );
+
+  std::vector<double> band_data( unr_block( 6 + number_of_energies,
+                                            6*number_of_energies*
+                                            number_of_bands ) );
+
+  unresolved_resonance_table.reset(
+            new UnresolvedResonanceProbabilityTable(
+                                           energy_grid,
+                                           number_of_bands,
+                                           interpolation == 5,
+                                           inelastic_competition_flag,
+                                           other_absorption_flag,
+                                           cross_section_factors_flag == 1,
+                                           band_data ) );
+}
+
 } // end MonteCarlo namespace
 
 //---------------------------------------------------------------------------//
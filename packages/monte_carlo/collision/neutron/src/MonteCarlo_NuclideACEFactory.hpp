@@ -38,6 +38,19 @@ public:
                          const SimulationProperties& properties,
 			 std::shared_ptr<const Nuclide>& nuclide );
 
+  //! Create a nuclide with S(alpha,beta) thermal scattering data
+  static void createNuclide(
+			 const Data::XSSNeutronDataExtractor& raw_nuclide_data,
+			 const std::string& nuclide_alias,
+			 const unsigned atomic_number,
+			 const unsigned atomic_mass_number,
+			 const unsigned isomer_number,
+			 const double atomic_weight_ratio,
+			 const double temperature,
+                         const SimulationProperties& properties,
+                         const std::shared_ptr<const SAlphaBeta>& s_alpha_beta,
+			 std::shared_ptr<const Nuclide>& nuclide );
+
 private:
 
   // Create the scattering reactions
@@ -46,6 +59,12 @@ private:
                       Nuclide::ConstReactionMap& scattering_reaction_map,
                       Nuclide::ConstReactionMap& absorption_reaction_map );
 
+  // Create the unresolved resonance probability tables
+  static void createUnresolvedResonanceProbabilityTable(
+                 const Data::XSSNeutronDataExtractor& raw_nuclide_data,
+                 std::shared_ptr<const UnresolvedResonanceProbabilityTable>&
+                 unresolved_resonance_table );
+
   // Constructor
   NuclideACEFactory();
 };
@@ -10,7 +10,9 @@
 #include "MonteCarlo_NuclideFactory.hpp"
 #include "MonteCarlo_NuclideACEFactory.hpp"
 #include "Data_ACEFileHandler.hpp"
+#include "MonteCarlo_SAlphaBetaACEFactory.hpp"
 #include "Data_XSSNeutronDataExtractor.hpp"
+#include "Data_XSSSabDataExtractor.hpp"
 #include "Utility_LoggingMacros.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_DesignByContract.hpp"
@@ -24,6 +26,7 @@ NuclideFactory::NuclideFactory(
                  const ScatteringCenterDefinitionDatabase& nuclide_definitions,
                  const SimulationProperties& properties,
                  const bool verbose )
+  : d_verbose( verbose )
 {
   FRENSIE_LOG_NOTIFICATION( "Starting to load nuclide data tables ... " );
   FRENSIE_FLUSH_ALL_LOGS();
@@ -54,6 +57,22 @@ NuclideFactory::NuclideFactory(
     const Data::NuclearDataProperties& nuclear_data_properties =
       nuclide_definition.getNuclearDataProperties( &atomic_weight_ratio );
 
+    // Load the S(alpha,beta) thermal scattering data
+    std::string s_alpha_beta_table_name;
+
+    if( nuclide_definition.hasThermalNuclearDataProperties() )
+    {
+      const Data::ThermalNuclearDataProperties& thermal_data_properties =
+        nuclide_definition.getThermalNuclearDataProperties();
+
+      this->createSAlphaBetaFromACETable( data_directory,
+                                          atomic_weight_ratio,
+                                          thermal_data_properties,
+                                          properties );
+
+      s_alpha_beta_table_name = thermal_data_properties.tableName();
+    }
+
     if( nuclear_data_properties.fileType() ==
         Data::NuclearDataProperties::ACE_FILE )
     {
@@ -64,11 +83,65 @@ NuclideFactory::NuclideFactory(
         d_nuclear_table_name_map[Data::NuclearDataProperties::ACE_FILE];
       }
       
-      this->createNuclideFromACETable( data_directory,
-                                       *nuclide_name,
-                                       atomic_weight_ratio,
-                                       nuclear_data_properties,
-                                       properties );
+      // Create a nuclide for each bracketing table - materials will sample
+      // the table at each collision using the interpolation fraction
+      if( nuclide_definition.hasTemperatureInterpolatedNuclearDataProperties() )
+      {
+        double upper_atomic_weight_ratio;
+
+        const Data::NuclearDataProperties& upper_nuclear_data_properties =
+          nuclide_definition.getUpperNuclearDataProperties(
+                                                  &upper_atomic_weight_ratio );
+
+        this->createNuclideFromACETable(
+                 data_directory,
+                 this->getTemperatureTableNuclideName(
+                                    *nuclide_name,
+                                    nuclear_data_properties.tableName() ),
+                 atomic_weight_ratio,
+                 nuclear_data_properties,
+                 s_alpha_beta_table_name,
+                 properties );
+
+        this->createNuclideFromACETable(
+                 data_directory,
+                 this->getTemperatureTableNuclideName(
+                              *nuclide_name,
+                              upper_nuclear_data_properties.tableName() ),
+                 upper_atomic_weight_ratio,
+                 upper_nuclear_data_properties,
+                 s_alpha_beta_table_name,
+                 properties );
+
+        // The nuclide name refers to the table nearest the desired temp.
+        if( nuclide_definition.getNuclearDataTemperatureInterpolationFraction() < 0.5 )
+        {
+          this->createNuclideFromACETable( data_directory,
+                                           *nuclide_name,
+                                           atomic_weight_ratio,
+                                           nuclear_data_properties,
+                                           s_alpha_beta_table_name,
+                                           properties );
+        }
+        else
+        {
+          this->createNuclideFromACETable( data_directory,
+                                           *nuclide_name,
+                                           upper_atomic_weight_ratio,
+                                           upper_nuclear_data_properties,
+                                           s_alpha_beta_table_name,
+                                           properties );
+        }
+      }
+      else
+      {
+        this->createNuclideFromACETable( data_directory,
+                                         *nuclide_name,
+                                         atomic_weight_ratio,
+                                         nuclear_data_properties,
+                                         s_alpha_beta_table_name,
+                                         properties );
+      }
     }
     else
     {
@@ -83,8 +156,9 @@ NuclideFactory::NuclideFactory(
     ++nuclide_name;
   }
 
-  // Make sure that every nuclide has been created
-  testPostcondition( d_nuclide_name_map.size() == nuclide_names.size() );
+  // Make sure that every nuclide has been created (temperature
+  // interpolated nuclides also create a nuclide for each bracketing table)
+  testPostcondition( d_nuclide_name_map.size() >= nuclide_names.size() );
 
   FRENSIE_LOG_NOTIFICATION( "Finished loading nuclide data tables." );
   FRENSIE_FLUSH_ALL_LOGS();
@@ -96,16 +170,38 @@ void NuclideFactory::createNuclideMap( NuclideNameMap& nuclide_map ) const
   nuclide_map = d_nuclide_name_map;
 }
 
+// Get the name of a nuclide evaluated with a specific data table
+/*! \details Temperature interpolated nuclides are represented by a
+ * nuclide for each of the bracketing data tables. The returned name is
+ * the key of the bracketing table nuclide in the nuclide map.
+ */
+std::string NuclideFactory::getTemperatureTableNuclideName(
+                                               const std::string& nuclide_name,
+                                               const std::string& table_name )
+{
+  return nuclide_name + "@" + table_name;
+}
+
 // Create a nuclide from an ACE table
 void NuclideFactory::createNuclideFromACETable(
                             const boost::filesystem::path& data_directory,
                             const std::string& nuclide_name,
                             const double atomic_weight_ratio,
                             const Data::NuclearDataProperties& data_properties,
+                            const std::string& s_alpha_beta_table_name,
                             const SimulationProperties& properties )
 {
+  // Nuclides with S(alpha,beta) data cannot share the standard table nuclide
+  std::string table_key = data_properties.tableName();
+
+  if( !s_alpha_beta_table_name.empty() )
+  {
+    table_key += "+";
+    table_key += s_alpha_beta_table_name;
+  }
+
   // Check if the table has already been loaded
-  if( d_nuclear_table_name_map[Data::NuclearDataProperties::ACE_FILE].find( data_properties.tableName() ) ==
+  if( d_nuclear_table_name_map[Data::NuclearDataProperties::ACE_FILE].find( table_key ) ==
       d_nuclear_table_name_map[Data::NuclearDataProperties::ACE_FILE].end() )
   {
     // Construct the path to the data file
@@ -147,10 +243,13 @@ void NuclideFactory::createNuclideFromACETable(
                           atomic_weight_ratio,
                           data_properties.evaluationTemperatureInMeV().value(),
                           properties,
+                          s_alpha_beta_table_name.empty() ?
+                          std::shared_ptr<const SAlphaBeta>() :
+                          d_s_alpha_beta_table_map.find( s_alpha_beta_table_name )->second,
                           nuclide );
 
     // Cache the new nuclide in the table name map
-    d_nuclear_table_name_map[Data::NuclearDataProperties::ACE_FILE][data_properties.tableName()] = nuclide;
+    d_nuclear_table_name_map[Data::NuclearDataProperties::ACE_FILE][table_key] = nuclide;
     
     if( d_verbose )
     {
@@ -162,7 +261,69 @@ void NuclideFactory::createNuclideFromACETable(
   else
   {
     d_nuclide_name_map[nuclide_name] =
-      d_nuclear_table_name_map[Data::NuclearDataProperties::ACE_FILE][data_properties.tableName()];
+      d_nuclear_table_name_map[Data::NuclearDataProperties::ACE_FILE][table_key];
+  }
+}
+
+// Create S(alpha,beta) thermal scattering data from an ACE table
+void NuclideFactory::createSAlphaBetaFromACETable(
+              const boost::filesystem::path& data_directory,
+              const double atomic_weight_ratio,
+              const Data::ThermalNuclearDataProperties& thermal_data_properties,
+              const SimulationProperties& properties )
+{
+  // Check if the table has already been loaded
+  if( d_s_alpha_beta_table_map.find( thermal_data_properties.tableName() ) !=
+      d_s_alpha_beta_table_map.end() )
+    return;
+
+  TEST_FOR_EXCEPTION( thermal_data_properties.fileType() !=
+                      Data::ThermalNuclearDataProperties::STANDARD_ACE_FILE &&
+                      thermal_data_properties.fileType() !=
+                      Data::ThermalNuclearDataProperties::MCNP6_ACE_FILE,
+                      std::runtime_error,
+                      "S(alpha,beta) table "
+                      << thermal_data_properties.tableName() << " cannot be "
+                      "created because its file type ("
+                      << thermal_data_properties.fileType() << ") is "
+                      "currently unsupported!" );
+
+  // Construct the path to the data file
+  boost::filesystem::path ace_file_path = data_directory;
+  ace_file_path /= thermal_data_properties.filePath();
+  ace_file_path.make_preferred();
+
+  if( d_verbose )
+  {
+    FRENSIE_LOG_PARTIAL_NOTIFICATION( " Loading ACE S(alpha,beta) table "
+                                      << thermal_data_properties.tableName() <<
+                                      " from " << ace_file_path.string() <<
+                                      " ... " );
+    FRENSIE_FLUSH_ALL_LOGS();
+  }
+
+  // The ACE table reader
+  Data::ACEFileHandler ace_file_handler( ace_file_path,
+                                         thermal_data_properties.tableName(),
+                                         thermal_data_properties.fileStartLine(),
+                                         true );
+
+  // The XSS S(alpha,beta) data extractor
+  Data::XSSSabDataExtractor xss_data_extractor(
+                                       ace_file_handler.getTableNXSArray(),
+                                       ace_file_handler.getTableJXSArray(),
+                                       ace_file_handler.getTableXSSArray() );
+
+  SAlphaBetaACEFactory::createSAlphaBeta(
+                 xss_data_extractor,
+                 atomic_weight_ratio,
+                 properties,
+                 d_s_alpha_beta_table_map[thermal_data_properties.tableName()] );
+
+  if( d_verbose )
+  {
+    FRENSIE_LOG_NOTIFICATION( "done." );
+    FRENSIE_FLUSH_ALL_LOGS();
   }
 }
 
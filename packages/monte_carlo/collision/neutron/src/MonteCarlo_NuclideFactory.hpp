@@ -52,6 +52,11 @@ public:
   //! Create the map of nuclides
   void createNuclideMap( NuclideNameMap& nuclide_map ) const;
 
+  //! Get the name of a nuclide evaluated with a specific data table
+  static std::string getTemperatureTableNuclideName(
+                                               const std::string& nuclide_name,
+                                               const std::string& table_name );
+
 private:
 
   // Create a nuclide from an ACE table
@@ -60,8 +65,16 @@ private:
                             const std::string& nuclide_name,
                             const double atomic_weight_ratio,
                             const Data::NuclearDataProperties& data_properties,
+                            const std::string& s_alpha_beta_table_name,
                             const SimulationProperties& properties );
 
+  // Create S(alpha,beta) thermal scattering data from an ACE table
+  void createSAlphaBetaFromACETable(
+              const boost::filesystem::path& data_directory,
+              const double atomic_weight_ratio,
+              const Data::ThermalNuclearDataProperties& thermal_data_properties,
+              const SimulationProperties& properties );
+
   // The nuclide  map
   NuclideNameMap d_nuclide_name_map;
 
@@ -69,6 +82,11 @@ private:
   std::map<Data::NuclearDataProperties::FileType,NuclideNameMap>
   d_nuclear_table_name_map;
 
+  // The S(alpha,beta) table map (used to prevent multiple reads of the same
+  // data file)
+  std::unordered_map<std::string,std::shared_ptr<const SAlphaBeta> >
+  d_s_alpha_beta_table_map;
+
   // Verbose nuclide construction
   bool d_verbose;
 };
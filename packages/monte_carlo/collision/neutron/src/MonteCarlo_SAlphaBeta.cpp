@@ -0,0 +1,583 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_SAlphaBeta.cpp
+//! \author Alex Robinson
+//! \brief  The S(alpha,beta) class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+
+// FRENSIE Includes
+#include "MonteCarlo_SAlphaBeta.hpp"
+#include "Utility_StandardHashBasedGridSearcher.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_3DCartesianVectorHelpers.hpp"
+#include "Utility_SortAlgorithms.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor (inelastic scattering only)
+SAlphaBeta::SAlphaBeta(
+              const double atomic_weight_ratio,
+              const std::vector<double>& inelastic_energy_grid,
+              const std::vector<double>& inelastic_cross_section,
+              const std::vector<double>& inelastic_outgoing_energies,
+              const std::vector<double>& inelastic_scattering_angle_cosines,
+              const bool skewed_inelastic_outgoing_energies,
+              const size_t hash_grid_bins )
+  : SAlphaBeta( atomic_weight_ratio,
+                inelastic_energy_grid,
+                inelastic_cross_section,
+                inelastic_outgoing_energies,
+                inelastic_scattering_angle_cosines,
+                skewed_inelastic_outgoing_energies,
+                Data::INCOHERENT_ELASTIC_MODE,
+                std::vector<double>(),
+                std::vector<double>(),
+                std::vector<double>(),
+                hash_grid_bins )
+{ /* ... */ }
+
+// Constructor
+/*! \details The inelastic outgoing energies must be stored in row major
+ * order (incoming energy, outgoing energy) and the inelastic scattering angle
+ * cosines must be stored in row major order (incoming energy, outgoing
+ * energy, cosine). The number of outgoing energies and cosines will be
+ * deduced from the array sizes. When the coherent elastic mode is used the
+ * elastic energy grid stores the Bragg edges, the elastic cross section
+ * stores the cumulative structure factors (the cross section is the
+ * cumulative structure factor divided by the energy) and the elastic
+ * scattering angle cosines must be empty. When the incoherent elastic mode
+ * is used the elastic scattering angle cosines must be stored in row major
+ * order (incoming energy, cosine). The elastic arrays can be empty if there
+ * is no elastic scattering data.
+ */
+SAlphaBeta::SAlphaBeta(
+              const double atomic_weight_ratio,
+              const std::vector<double>& inelastic_energy_grid,
+              const std::vector<double>& inelastic_cross_section,
+              const std::vector<double>& inelastic_outgoing_energies,
+              const std::vector<double>& inelastic_scattering_angle_cosines,
+              const bool skewed_inelastic_outgoing_energies,
+              const Data::SabElasticMode elastic_mode,
+              const std::vector<double>& elastic_energy_grid,
+              const std::vector<double>& elastic_cross_section,
+              const std::vector<double>& elastic_scattering_angle_cosines,
+              const size_t hash_grid_bins )
+  : BaseType( atomic_weight_ratio ),
+    d_inelastic_energy_grid( inelastic_energy_grid ),
+    d_inelastic_cross_section( inelastic_cross_section ),
+    d_inelastic_outgoing_energies_per_energy( 0 ),
+    d_inelastic_outgoing_energies( inelastic_outgoing_energies ),
+    d_inelastic_cosines_per_outgoing_energy( 0 ),
+    d_inelastic_scattering_angle_cosines( inelastic_scattering_angle_cosines ),
+    d_outgoing_energy_bin_table(),
+    d_elastic_mode( elastic_mode ),
+    d_elastic_energy_grid( elastic_energy_grid ),
+    d_elastic_cross_section( elastic_cross_section ),
+    d_elastic_cosines_per_energy( 0 ),
+    d_elastic_scattering_angle_cosines( elastic_scattering_angle_cosines ),
+    d_union_energy_grid(),
+    d_union_inelastic_grid_point_counts(),
+    d_union_elastic_grid_point_counts(),
+    d_union_grid_searcher()
+{
+  // Make sure that the inelastic data is valid
+  testPrecondition( inelastic_energy_grid.size() > 1 );
+  testPrecondition( Utility::Sort::isSortedAscending(
+                                             inelastic_energy_grid.begin(),
+                                             inelastic_energy_grid.end() ) );
+  testPrecondition( inelastic_cross_section.size() ==
+                    inelastic_energy_grid.size() );
+  // Make sure that the elastic data is valid
+  testPrecondition( elastic_cross_section.size() ==
+                    elastic_energy_grid.size() );
+  testPrecondition( Utility::Sort::isSortedAscending(
+                                             elastic_energy_grid.begin(),
+                                             elastic_energy_grid.end() ) );
+
+  // Determine the inelastic table dimensions
+  TEST_FOR_EXCEPTION( inelastic_outgoing_energies.size() == 0 ||
+                      inelastic_outgoing_energies.size()%
+                      inelastic_energy_grid.size() != 0,
+                      std::runtime_error,
+                      "The number of inelastic outgoing energies ("
+                      << inelastic_outgoing_energies.size() << ") is not "
+                      "consistent with the inelastic energy grid size ("
+                      << inelastic_energy_grid.size() << ")!" );
+
+  d_inelastic_outgoing_energies_per_energy =
+    inelastic_outgoing_energies.size()/inelastic_energy_grid.size();
+
+  TEST_FOR_EXCEPTION( inelastic_scattering_angle_cosines.size() == 0 ||
+                      inelastic_scattering_angle_cosines.size()%
+                      inelastic_outgoing_energies.size() != 0,
+                      std::runtime_error,
+                      "The number of inelastic scattering angle cosines ("
+                      << inelastic_scattering_angle_cosines.size() << ") is "
+                      "not consistent with the number of inelastic outgoing "
+                      "energies (" << inelastic_outgoing_energies.size() <<
+                      ")!" );
+
+  d_inelastic_cosines_per_outgoing_energy =
+    inelastic_scattering_angle_cosines.size()/
+    inelastic_outgoing_energies.size();
+
+  // Determine the elastic table dimensions
+  if( elastic_energy_grid.size() > 0 )
+  {
+    if( elastic_mode == Data::INCOHERENT_ELASTIC_MODE )
+    {
+      TEST_FOR_EXCEPTION( elastic_energy_grid.size() < 2,
+                          std::runtime_error,
+                          "At least two incoherent elastic energies are "
+                          "required!" );
+
+      TEST_FOR_EXCEPTION( elastic_scattering_angle_cosines.size() == 0 ||
+                          elastic_scattering_angle_cosines.size()%
+                          elastic_energy_grid.size() != 0,
+                          std::runtime_error,
+                          "The number of incoherent elastic scattering angle "
+                          "cosines (" << elastic_scattering_angle_cosines.size()
+                          << ") is not consistent with the elastic energy "
+                          "grid size (" << elastic_energy_grid.size() <<
+                          ")!" );
+
+      d_elastic_cosines_per_energy =
+        elastic_scattering_angle_cosines.size()/elastic_energy_grid.size();
+    }
+    else
+    {
+      TEST_FOR_EXCEPTION( elastic_scattering_angle_cosines.size() != 0,
+                          std::runtime_error,
+                          "Coherent elastic scattering angle cosines cannot "
+                          "be specified (they are calculated from the Bragg "
+                          "edges)!" );
+    }
+  }
+
+  // Create the outgoing energy bin table
+  this->createOutgoingEnergyBinTable( skewed_inelastic_outgoing_energies );
+
+  // Create the union energy grid
+  this->createUnionEnergyGrid( hash_grid_bins );
+}
+
+// Create the union energy grid
+/*! \details The union grid contains every inelastic and elastic grid point.
+ * Within a union grid bin the inelastic and elastic grid bins are therefore
+ * constant and can be cached.
+ */
+void SAlphaBeta::createUnionEnergyGrid( const size_t hash_grid_bins )
+{
+  std::shared_ptr<std::vector<double> >
+    union_energy_grid( new std::vector<double>() );
+
+  union_energy_grid->reserve( d_inelastic_energy_grid.size() +
+                              d_elastic_energy_grid.size() );
+
+  std::merge( d_inelastic_energy_grid.begin(),
+              d_inelastic_energy_grid.end(),
+              d_elastic_energy_grid.begin(),
+              d_elastic_energy_grid.end(),
+              std::back_inserter( *union_energy_grid ) );
+
+  union_energy_grid->erase( std::unique( union_energy_grid->begin(),
+                                         union_energy_grid->end() ),
+                            union_energy_grid->end() );
+
+  // Only the energies below the upper energy limit are needed
+  union_energy_grid->erase(
+                    std::upper_bound( union_energy_grid->begin(),
+                                      union_energy_grid->end(),
+                                      this->getUpperEnergyLimit() ),
+                    union_energy_grid->end() );
+
+  // Cache the grid bins of each union grid point
+  d_union_inelastic_grid_point_counts.resize( union_energy_grid->size() );
+  d_union_elastic_grid_point_counts.resize( union_energy_grid->size() );
+
+  for( size_t i = 0; i < union_energy_grid->size(); ++i )
+  {
+    d_union_inelastic_grid_point_counts[i] =
+      std::upper_bound( d_inelastic_energy_grid.begin(),
+                        d_inelastic_energy_grid.end(),
+                        (*union_energy_grid)[i] ) -
+      d_inelastic_energy_grid.begin();
+
+    d_union_elastic_grid_point_counts[i] =
+      std::upper_bound( d_elastic_energy_grid.begin(),
+                        d_elastic_energy_grid.end(),
+                        (*union_energy_grid)[i] ) -
+      d_elastic_energy_grid.begin();
+  }
+
+  d_union_energy_grid = union_energy_grid;
+
+  d_union_grid_searcher.reset(
+         new Utility::StandardHashBasedGridSearcher<std::vector<double>,false>(
+                                                         d_union_energy_grid,
+                                                         hash_grid_bins ) );
+}
+
+// Create the outgoing energy bin table
+/*! \details Each entry of the table has the same probability of being
+ * selected. With equiprobable outgoing energies each outgoing energy bin
+ * has a single entry. With skewed outgoing energies (N bins) the first and
+ * last bins have probability 0.1/(N-3), the second and second to last bins
+ * have probability 0.4/(N-3) and the remaining bins have probability
+ * 1/(N-3). Skewed outgoing energy bins are therefore given 1, 4 or 10
+ * entries in the table, which allows a bin to be sampled with a single
+ * random number and a single table lookup.
+ */
+void SAlphaBeta::createOutgoingEnergyBinTable( const bool skewed )
+{
+  const size_t num_bins = d_inelastic_outgoing_energies_per_energy;
+
+  if( skewed )
+  {
+    TEST_FOR_EXCEPTION( num_bins < 4,
+                        std::runtime_error,
+                        "At least four skewed outgoing energies are "
+                        "required (" << num_bins << " were given)!" );
+
+    d_outgoing_energy_bin_table.reserve( 10*(num_bins-3) );
+
+    for( size_t j = 0; j < num_bins; ++j )
+    {
+      size_t entries;
+
+      if( j == 0 || j == num_bins-1 )
+        entries = 1;
+      else if( j == 1 || j == num_bins-2 )
+        entries = 4;
+      else
+        entries = 10;
+
+      d_outgoing_energy_bin_table.insert( d_outgoing_energy_bin_table.end(),
+                                          entries,
+                                          j );
+    }
+  }
+  else
+  {
+    d_outgoing_energy_bin_table.resize( num_bins );
+
+    for( size_t j = 0; j < num_bins; ++j )
+      d_outgoing_energy_bin_table[j] = j;
+  }
+}
+
+// Check if there is elastic scattering data
+bool SAlphaBeta::hasElasticScatteringData() const
+{
+  return d_elastic_energy_grid.size() > 0;
+}
+
+// Return the elastic scattering mode
+Data::SabElasticMode SAlphaBeta::getElasticScatteringMode() const
+{
+  return d_elastic_mode;
+}
+
+// Find the union energy grid bin that an energy falls in
+size_t SAlphaBeta::findUnionEnergyGridBin( const double energy ) const
+{
+  if( energy <= d_union_energy_grid->front() )
+    return 0;
+  else if( energy >= d_union_energy_grid->back() )
+    return d_union_energy_grid->size() - 1;
+  else
+    return d_union_grid_searcher->findLowerBinIndex( energy );
+}
+
+// Calculate the interpolation fraction for an energy in a grid bin
+/*! \details Energies outside of the bin are clamped to the bin boundaries.
+ */
+double SAlphaBeta::calculateInterpolationFraction(
+                                              const std::vector<double>& grid,
+                                              const size_t bin,
+                                              const double energy )
+{
+  if( energy <= grid[bin] )
+    return 0.0;
+  else if( energy >= grid[bin+1] )
+    return 1.0;
+  else
+    return (energy - grid[bin])/(grid[bin+1] - grid[bin]);
+}
+
+// Return the total thermal scattering cross section at the desired energy
+double SAlphaBeta::getCrossSection( const double energy ) const
+{
+  return this->getInelasticCrossSection( energy ) +
+    this->getElasticCrossSection( energy );
+}
+
+// Return the inelastic scattering cross section at the desired energy
+double SAlphaBeta::getInelasticCrossSection( const double energy ) const
+{
+  // Make sure that the energy is valid
+  testPrecondition( energy > 0.0 );
+
+  const size_t union_bin = this->findUnionEnergyGridBin( energy );
+
+  const size_t bin = std::min(
+               std::max( d_union_inelastic_grid_point_counts[union_bin], (size_t)1 ),
+               d_inelastic_energy_grid.size() - 1 ) - 1;
+
+  const double interp_fraction =
+    this->calculateInterpolationFraction( d_inelastic_energy_grid,
+                                          bin,
+                                          energy );
+
+  return d_inelastic_cross_section[bin] + interp_fraction*
+    (d_inelastic_cross_section[bin+1] - d_inelastic_cross_section[bin]);
+}
+
+// Return the elastic scattering cross section at the desired energy
+double SAlphaBeta::getElasticCrossSection( const double energy ) const
+{
+  // Make sure that the energy is valid
+  testPrecondition( energy > 0.0 );
+
+  if( !this->hasElasticScatteringData() )
+    return 0.0;
+
+  const size_t union_bin = this->findUnionEnergyGridBin( energy );
+
+  const size_t grid_point_count = d_union_elastic_grid_point_counts[union_bin];
+
+  // The coherent cross section is the cumulative structure factor of the
+  // Bragg edges below the energy divided by the energy
+  if( d_elastic_mode == Data::COHERENT_ELASTIC_MODE )
+  {
+    if( energy < d_elastic_energy_grid.front() )
+      return 0.0;
+    else
+      return d_elastic_cross_section[grid_point_count-1]/energy;
+  }
+  else
+  {
+    const size_t bin =
+      std::min( std::max( grid_point_count, (size_t)1 ),
+                d_elastic_energy_grid.size() - 1 ) - 1;
+
+    const double interp_fraction =
+      this->calculateInterpolationFraction( d_elastic_energy_grid,
+                                            bin,
+                                            energy );
+
+    return d_elastic_cross_section[bin] + interp_fraction*
+      (d_elastic_cross_section[bin+1] - d_elastic_cross_section[bin]);
+  }
+}
+
+// Sample a tabulated scattering angle cosine
+/*! \details One of the equiprobable cosines is selected and the selected
+ * cosines of the bracketing incoming energies are linearly interpolated.
+ */
+double SAlphaBeta::sampleScatteringAngleCosine(
+                                      const std::vector<double>& cosine_table,
+                                      const size_t lower_table_index,
+                                      const size_t upper_table_index,
+                                      const size_t number_of_cosines,
+                                      const double interpolation_fraction )
+{
+  const size_t cosine_index = std::min(
+    (size_t)(Utility::RandomNumberGenerator::getRandomNumber<double>()*
+             number_of_cosines),
+    number_of_cosines - 1 );
+
+  const double lower_cosine =
+    cosine_table[lower_table_index*number_of_cosines + cosine_index];
+
+  const double upper_cosine =
+    cosine_table[upper_table_index*number_of_cosines + cosine_index];
+
+  double scattering_angle_cosine =
+    lower_cosine + interpolation_fraction*(upper_cosine - lower_cosine);
+
+  // Eliminate roundoff errors
+  if( scattering_angle_cosine < -1.0 )
+    scattering_angle_cosine = -1.0;
+  else if( scattering_angle_cosine > 1.0 )
+    scattering_angle_cosine = 1.0;
+
+  return scattering_angle_cosine;
+}
+
+// Sample an outgoing energy and scattering angle cosine (inelastic)
+/*! \details The same outgoing energy bin and cosine are selected from the
+ * tables of the bracketing incoming energies and the results are linearly
+ * interpolated.
+ */
+void SAlphaBeta::sampleInelasticScattering(
+                                      const double energy,
+                                      double& outgoing_energy,
+                                      double& scattering_angle_cosine ) const
+{
+  // Make sure that the energy is valid
+  testPrecondition( energy > 0.0 );
+
+  const size_t union_bin = this->findUnionEnergyGridBin( energy );
+
+  const size_t bin = std::min(
+               std::max( d_union_inelastic_grid_point_counts[union_bin], (size_t)1 ),
+               d_inelastic_energy_grid.size() - 1 ) - 1;
+
+  const double interp_fraction =
+    this->calculateInterpolationFraction( d_inelastic_energy_grid,
+                                          bin,
+                                          energy );
+
+  // Sample the outgoing energy bin
+  const size_t table_index = std::min(
+    (size_t)(Utility::RandomNumberGenerator::getRandomNumber<double>()*
+             d_outgoing_energy_bin_table.size()),
+    d_outgoing_energy_bin_table.size() - 1 );
+
+  const size_t outgoing_energy_bin = d_outgoing_energy_bin_table[table_index];
+
+  const size_t lower_index =
+    bin*d_inelastic_outgoing_energies_per_energy + outgoing_energy_bin;
+
+  const size_t upper_index =
+    lower_index + d_inelastic_outgoing_energies_per_energy;
+
+  outgoing_energy = d_inelastic_outgoing_energies[lower_index] +
+    interp_fraction*(d_inelastic_outgoing_energies[upper_index] -
+                     d_inelastic_outgoing_energies[lower_index]);
+
+  // Sample the scattering angle cosine
+  scattering_angle_cosine = this->sampleScatteringAngleCosine(
+                                       d_inelastic_scattering_angle_cosines,
+                                       lower_index,
+                                       upper_index,
+                                       d_inelastic_cosines_per_outgoing_energy,
+                                       interp_fraction );
+
+  // Make sure that the outgoing energy is valid
+  testPostcondition( outgoing_energy > 0.0 );
+}
+
+// Sample an outgoing energy and scattering angle cosine (elastic)
+/*! \details With coherent elastic scattering a Bragg edge below the energy
+ * is sampled using the structure factors and the scattering angle cosine
+ * is calculated from the Bragg edge (mu = 1 - 2E_i/E). With incoherent
+ * elastic scattering an equiprobable cosine is sampled. The energy does
+ * not change.
+ */
+void SAlphaBeta::sampleElasticScattering(
+                                      const double energy,
+                                      double& outgoing_energy,
+                                      double& scattering_angle_cosine ) const
+{
+  // Make sure that the energy is valid
+  testPrecondition( energy > 0.0 );
+  // Make sure that there is elastic scattering data
+  testPrecondition( this->hasElasticScatteringData() );
+
+  const size_t union_bin = this->findUnionEnergyGridBin( energy );
+
+  const size_t grid_point_count = d_union_elastic_grid_point_counts[union_bin];
+
+  if( d_elastic_mode == Data::COHERENT_ELASTIC_MODE )
+  {
+    // Make sure that the energy is above the first Bragg edge
+    testPrecondition( grid_point_count > 0 );
+
+    const double scaled_random_number =
+      Utility::RandomNumberGenerator::getRandomNumber<double>()*
+      d_elastic_cross_section[grid_point_count-1];
+
+    const size_t edge = std::min(
+          (size_t)(std::upper_bound( d_elastic_cross_section.begin(),
+                                     d_elastic_cross_section.begin() +
+                                     grid_point_count,
+                                     scaled_random_number ) -
+                   d_elastic_cross_section.begin()),
+          grid_point_count - 1 );
+
+    scattering_angle_cosine = 1.0 - 2.0*d_elastic_energy_grid[edge]/energy;
+
+    // Eliminate roundoff errors
+    if( scattering_angle_cosine < -1.0 )
+      scattering_angle_cosine = -1.0;
+  }
+  else
+  {
+    const size_t bin =
+      std::min( std::max( grid_point_count, (size_t)1 ),
+                d_elastic_energy_grid.size() - 1 ) - 1;
+
+    const double interp_fraction =
+      this->calculateInterpolationFraction( d_elastic_energy_grid,
+                                            bin,
+                                            energy );
+
+    scattering_angle_cosine = this->sampleScatteringAngleCosine(
+                                            d_elastic_scattering_angle_cosines,
+                                            bin,
+                                            bin+1,
+                                            d_elastic_cosines_per_energy,
+                                            interp_fraction );
+  }
+
+  outgoing_energy = energy;
+}
+
+// Randomly scatter the neutron
+/*! \details The temperature is ignored because the thermal scattering data
+ * has already been evaluated at a specific temperature.
+ */
+void SAlphaBeta::scatterParticle( const NeutronState& incoming_neutron,
+                                  NeutronState& outgoing_neutron,
+                                  const double ) const
+{
+  const double energy = incoming_neutron.getEnergy();
+
+  const double inelastic_cross_section =
+    this->getInelasticCrossSection( energy );
+
+  const double elastic_cross_section = this->getElasticCrossSection( energy );
+
+  double outgoing_energy, scattering_angle_cosine;
+
+  if( Utility::RandomNumberGenerator::getRandomNumber<double>()*
+      (inelastic_cross_section + elastic_cross_section) <
+      elastic_cross_section )
+  {
+    this->sampleElasticScattering( energy,
+                                   outgoing_energy,
+                                   scattering_angle_cosine );
+  }
+  else
+  {
+    this->sampleInelasticScattering( energy,
+                                     outgoing_energy,
+                                     scattering_angle_cosine );
+  }
+
+  // Rotate the neutron direction (the data is in the lab frame)
+  double outgoing_direction[3];
+
+  Utility::rotateUnitVectorThroughPolarAndAzimuthalAngle(
+                                             scattering_angle_cosine,
+                                             this->sampleAzimuthalAngle(),
+                                             incoming_neutron.getDirection(),
+                                             outgoing_direction );
+
+  outgoing_neutron.setDirection( outgoing_direction );
+  outgoing_neutron.setEnergy( outgoing_energy );
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_SAlphaBeta.cpp
+//---------------------------------------------------------------------------//
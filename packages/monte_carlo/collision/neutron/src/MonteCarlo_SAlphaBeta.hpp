@@ -9,16 +9,181 @@
 #ifndef MONTE_CARLO_S_ALPHA_BETA_HPP
 #define MONTE_CARLO_S_ALPHA_BETA_HPP
 
+// Std Lib Includes
+#include <memory>
+
+// FRENSIE Includes
+#include "MonteCarlo_NuclearScatteringDistribution.hpp"
+#include "MonteCarlo_NeutronState.hpp"
+#include "Data_SabElasticMode.hpp"
+#include "Utility_HashBasedGridSearcher.hpp"
+#include "Utility_Vector.hpp"
+
 namespace MonteCarlo{
 
-//! The S(alpha,beta) class
-class SAlphaBeta
+/*! The S(alpha,beta) class
+ * \details This class handles thermal neutron scattering from bound
+ * scattering centers (e.g. hydrogen in water). Below the upper energy limit
+ * of the table it replaces the elastic scattering reaction of the nuclide.
+ * Inelastic scattering uses discrete outgoing energy tables (equiprobable
+ * or skewed) with equiprobable scattering angle cosines for each outgoing
+ * energy. Elastic scattering is either coherent (Bragg edges) or incoherent
+ * (equiprobable scattering angle cosines). The inelastic and elastic energy
+ * grids are merged into a union grid so that the bins of both grids can be
+ * found with a single hash based grid search. The outgoing energy bin is
+ * selected with a single table lookup (no searching) for both the
+ * equiprobable and the skewed outgoing energy tables.
+ */
+class SAlphaBeta : public NuclearScatteringDistribution<NeutronState,NeutronState>
 {
+  // Typedef for the base type
+  typedef NuclearScatteringDistribution<NeutronState,NeutronState> BaseType;
+
+public:
+
+  //! Constructor (inelastic scattering only)
+  SAlphaBeta( const double atomic_weight_ratio,
+              const std::vector<double>& inelastic_energy_grid,
+              const std::vector<double>& inelastic_cross_section,
+              const std::vector<double>& inelastic_outgoing_energies,
+              const std::vector<double>& inelastic_scattering_angle_cosines,
+              const bool skewed_inelastic_outgoing_energies,
+              const size_t hash_grid_bins );
+
+  //! Constructor
+  SAlphaBeta( const double atomic_weight_ratio,
+              const std::vector<double>& inelastic_energy_grid,
+              const std::vector<double>& inelastic_cross_section,
+              const std::vector<double>& inelastic_outgoing_energies,
+              const std::vector<double>& inelastic_scattering_angle_cosines,
+              const bool skewed_inelastic_outgoing_energies,
+              const Data::SabElasticMode elastic_mode,
+              const std::vector<double>& elastic_energy_grid,
+              const std::vector<double>& elastic_cross_section,
+              const std::vector<double>& elastic_scattering_angle_cosines,
+              const size_t hash_grid_bins );
+
+  //! Destructor
+  ~SAlphaBeta()
+  { /* ... */ }
+
+  //! Return the upper energy limit of the thermal scattering data (MeV)
+  double getUpperEnergyLimit() const;
+
+  //! Check if there is elastic scattering data
+  bool hasElasticScatteringData() const;
+
+  //! Return the elastic scattering mode
+  Data::SabElasticMode getElasticScatteringMode() const;
+
+  //! Return the total thermal scattering cross section at the desired energy
+  double getCrossSection( const double energy ) const;
+
+  //! Return the inelastic scattering cross section at the desired energy
+  double getInelasticCrossSection( const double energy ) const;
+
+  //! Return the elastic scattering cross section at the desired energy
+  double getElasticCrossSection( const double energy ) const;
+
+  //! Sample an outgoing energy and scattering angle cosine (inelastic)
+  void sampleInelasticScattering( const double energy,
+                                  double& outgoing_energy,
+                                  double& scattering_angle_cosine ) const;
+
+  //! Sample an outgoing energy and scattering angle cosine (elastic)
+  void sampleElasticScattering( const double energy,
+                                double& outgoing_energy,
+                                double& scattering_angle_cosine ) const;
+
+  //! Randomly scatter the neutron
+  void scatterParticle( const NeutronState& incoming_neutron,
+                        NeutronState& outgoing_neutron,
+                        const double temperature ) const override;
+
+  using BaseType::scatterParticle;
+
+private:
+
+  // Create the union energy grid
+  void createUnionEnergyGrid( const size_t hash_grid_bins );
+
+  // Create the outgoing energy bin table
+  void createOutgoingEnergyBinTable( const bool skewed );
 
+  // Find the union energy grid bin that an energy falls in
+  size_t findUnionEnergyGridBin( const double energy ) const;
 
+  // Calculate the interpolation fraction for an energy in a grid bin
+  static double calculateInterpolationFraction(
+                                           const std::vector<double>& grid,
+                                           const size_t bin,
+                                           const double energy );
 
+  // Sample a tabulated scattering angle cosine
+  static double sampleScatteringAngleCosine(
+                                      const std::vector<double>& cosine_table,
+                                      const size_t lower_table_index,
+                                      const size_t upper_table_index,
+                                      const size_t number_of_cosines,
+                                      const double interpolation_fraction );
+
+  // The inelastic energy grid
+  std::vector<double> d_inelastic_energy_grid;
+
+  // The inelastic cross section
+  std::vector<double> d_inelastic_cross_section;
+
+  // The number of outgoing energies for each inelastic incoming energy
+  size_t d_inelastic_outgoing_energies_per_energy;
+
+  // The inelastic outgoing energies (row major: incoming, outgoing)
+  std::vector<double> d_inelastic_outgoing_energies;
+
+  // The number of cosines for each inelastic outgoing energy
+  size_t d_inelastic_cosines_per_outgoing_energy;
+
+  // The inelastic cosines (row major: incoming, outgoing, cosine)
+  std::vector<double> d_inelastic_scattering_angle_cosines;
+
+  // The outgoing energy bin table (equal probability entries)
+  std::vector<size_t> d_outgoing_energy_bin_table;
+
+  // The elastic scattering mode
+  Data::SabElasticMode d_elastic_mode;
+
+  // The elastic energy grid (Bragg edges with coherent elastic mode)
+  std::vector<double> d_elastic_energy_grid;
+
+  // The elastic cross section (cumulative structure factors with coherent
+  // elastic mode)
+  std::vector<double> d_elastic_cross_section;
+
+  // The number of cosines for each elastic incoming energy
+  size_t d_elastic_cosines_per_energy;
+
+  // The elastic cosines (row major: incoming, cosine)
+  std::vector<double> d_elastic_scattering_angle_cosines;
+
+  // The union energy grid
+  std::shared_ptr<const std::vector<double> > d_union_energy_grid;
+
+  // The number of inelastic grid points <= each union grid point
+  std::vector<size_t> d_union_inelastic_grid_point_counts;
+
+  // The number of elastic grid points <= each union grid point
+  std::vector<size_t> d_union_elastic_grid_point_counts;
+
+  // The union energy grid searcher
+  std::unique_ptr<const Utility::HashBasedGridSearcher<double> >
+  d_union_grid_searcher;
 };
 
+// Return the upper energy limit of the thermal scattering data (MeV)
+inline double SAlphaBeta::getUpperEnergyLimit() const
+{
+  return d_inelastic_energy_grid.back();
+}
+
 } // end MonteCarlo namespace
 
 #endif // end MONTE_CARLO_S_ALPHA_BETA_HPP
@@ -0,0 +1,131 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_SAlphaBetaACEFactory.cpp
+//! \author Alex Robinson
+//! \brief  The S(alpha,beta) ACE factory class definition
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "MonteCarlo_SAlphaBetaACEFactory.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Create the S(alpha,beta) thermal scattering data
+/*! \details The ITXE block stores, for each inelastic incoming energy, the
+ * outgoing energies each followed by their equiprobable scattering angle
+ * cosines. These interleaved values will be split into separate outgoing
+ * energy and cosine tables. Only the discrete (equiprobable and skewed)
+ * secondary energy modes are currently supported.
+ */
+void SAlphaBetaACEFactory::createSAlphaBeta(
+                          const Data::XSSSabDataExtractor& raw_sab_data,
+                          const double atomic_weight_ratio,
+                          const SimulationProperties& properties,
+                          std::shared_ptr<const SAlphaBeta>& s_alpha_beta )
+{
+  const Data::SabSecondaryEnergyMode secondary_energy_mode =
+    raw_sab_data.getInelasticSecondaryEnergyMode();
+
+  TEST_FOR_EXCEPTION( secondary_energy_mode ==
+                      Data::CONTINUOUS_SECONDARY_ENERGY_MODE,
+                      std::runtime_error,
+                      "S(alpha,beta) tables with continuous inelastic "
+                      "secondary energy distributions are not currently "
+                      "supported!" );
+
+  // Extract the inelastic data
+  Utility::ArrayView<const double> inelastic_energy_grid =
+    raw_sab_data.extractInelasticEnergyGrid();
+
+  Utility::ArrayView<const double> inelastic_cross_section =
+    raw_sab_data.extractInelasticCrossSection();
+
+  Utility::ArrayView<const double> itxe_block =
+    raw_sab_data.extractITXEBlock();
+
+  const size_t num_outgoing_energies =
+    raw_sab_data.getNumberOfInelasticOutgoingEnergies();
+
+  const size_t num_cosines =
+    raw_sab_data.getNumberOfInelasticScatteringAngleCosines();
+
+  const size_t num_tables =
+    inelastic_energy_grid.size()*num_outgoing_energies;
+
+  TEST_FOR_EXCEPTION( itxe_block.size() < num_tables*(num_cosines+1),
+                      std::runtime_error,
+                      "The ITXE block is too small (" << itxe_block.size() <<
+                      " < " << num_tables*(num_cosines+1) << ")!" );
+
+  std::vector<double> inelastic_outgoing_energies( num_tables );
+  std::vector<double> inelastic_cosines( num_tables*num_cosines );
+
+  for( size_t i = 0; i < num_tables; ++i )
+  {
+    Utility::ArrayView<const double>::const_iterator table_start =
+      itxe_block.begin() + i*(num_cosines+1);
+
+    inelastic_outgoing_energies[i] = *table_start;
+
+    std::copy( table_start + 1,
+               table_start + 1 + num_cosines,
+               inelastic_cosines.begin() + i*num_cosines );
+  }
+
+  // Extract the elastic data
+  std::vector<double> elastic_energy_grid, elastic_cross_section,
+    elastic_cosines;
+
+  if( raw_sab_data.hasElasticScatteringCrossSectionData() )
+  {
+    elastic_energy_grid.assign(
+                        raw_sab_data.extractElasticEnergyGrid().begin(),
+                        raw_sab_data.extractElasticEnergyGrid().end() );
+
+    elastic_cross_section.assign(
+                        raw_sab_data.extractElasticCrossSection().begin(),
+                        raw_sab_data.extractElasticCrossSection().end() );
+
+    if( raw_sab_data.getElasticScatteringMode() ==
+        Data::INCOHERENT_ELASTIC_MODE )
+    {
+      Utility::ArrayView<const double> itca_block =
+        raw_sab_data.extractITCABlock();
+
+      const size_t num_elastic_cosines = elastic_energy_grid.size()*
+        raw_sab_data.getNumberOfElasticScatteringAngleCosines();
+
+      TEST_FOR_EXCEPTION( itca_block.size() < num_elastic_cosines,
+                          std::runtime_error,
+                          "The ITCA block is too small (" << itca_block.size()
+                          << " < " << num_elastic_cosines << ")!" );
+
+      elastic_cosines.assign( itca_block.begin(),
+                              itca_block.begin() + num_elastic_cosines );
+    }
+  }
+
+  s_alpha_beta.reset( new SAlphaBeta(
+                 atomic_weight_ratio,
+                 std::vector<double>( inelastic_energy_grid.begin(),
+                                      inelastic_energy_grid.end() ),
+                 std::vector<double>( inelastic_cross_section.begin(),
+                                      inelastic_cross_section.end() ),
+                 inelastic_outgoing_energies,
+                 inelastic_cosines,
+                 secondary_energy_mode == Data::SKEWED_SECONDARY_ENERGY_MODE,
+                 raw_sab_data.getElasticScatteringMode(),
+                 elastic_energy_grid,
+                 elastic_cross_section,
+                 elastic_cosines,
+                 properties.getNumberOfNeutronHashGridBins() ) );
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_SAlphaBetaACEFactory.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,47 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_SAlphaBetaACEFactory.hpp
+//! \author Alex Robinson
+//! \brief  The S(alpha,beta) ACE factory class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_S_ALPHA_BETA_ACE_FACTORY_HPP
+#define MONTE_CARLO_S_ALPHA_BETA_ACE_FACTORY_HPP
+
+// Std Lib Includes
+#include <memory>
+
+// FRENSIE Includes
+#include "MonteCarlo_SAlphaBeta.hpp"
+#include "MonteCarlo_SimulationProperties.hpp"
+#include "Data_XSSSabDataExtractor.hpp"
+
+namespace MonteCarlo{
+
+//! The S(alpha,beta) ACE factory class
+class SAlphaBetaACEFactory
+{
+
+public:
+
+  //! Create the S(alpha,beta) thermal scattering data
+  static void createSAlphaBeta(
+                          const Data::XSSSabDataExtractor& raw_sab_data,
+                          const double atomic_weight_ratio,
+                          const SimulationProperties& properties,
+                          std::shared_ptr<const SAlphaBeta>& s_alpha_beta );
+
+private:
+
+  // Constructor
+  SAlphaBetaACEFactory();
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_S_ALPHA_BETA_ACE_FACTORY_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_SAlphaBetaACEFactory.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,271 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_UnresolvedResonanceProbabilityTable.cpp
+//! \author Alex Robinson
+//! \brief  The unresolved resonance probability table class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+#include <cmath>
+
+// FRENSIE Includes
+#include "MonteCarlo_UnresolvedResonanceProbabilityTable.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_SortAlgorithms.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Return the per-thread band random number caches
+Utility::PerThread<UnresolvedResonanceProbabilityTable::BandRandomNumberCache>&
+UnresolvedResonanceProbabilityTable::getBandRandomNumberCaches()
+{
+  static Utility::PerThread<BandRandomNumberCache> band_random_number_caches(
+                                           1, BandRandomNumberCache{0.0, false} );
+
+  return band_random_number_caches;
+}
+
+// Get the band random number (sampled if it has been reset)
+/*! \details The band random number is shared by all nuclides so that the
+ * cross sections that are sampled from the probability tables of different
+ * nuclides (or of the same nuclide at different temperatures) are
+ * correlated.
+ */
+double UnresolvedResonanceProbabilityTable::getBandRandomNumber()
+{
+  BandRandomNumberCache& cache =
+    UnresolvedResonanceProbabilityTable::getBandRandomNumberCaches().local();
+
+  if( !cache.sampled )
+  {
+    cache.random_number =
+      Utility::RandomNumberGenerator::getRandomNumber<double>();
+
+    cache.sampled = true;
+  }
+
+  return cache.random_number;
+}
+
+// Reset the band random number
+void UnresolvedResonanceProbabilityTable::resetBandRandomNumber()
+{
+  UnresolvedResonanceProbabilityTable::getBandRandomNumberCaches().local().sampled = false;
+}
+
+// Enable support for multiple threads
+/*! \details Only the master thread should call this method. Existing band
+ * random numbers will be preserved.
+ */
+void UnresolvedResonanceProbabilityTable::enableThreadSupport(
+                                                       const unsigned threads )
+{
+  // Make sure that the number of threads is valid
+  testPrecondition( threads > 0 );
+
+  if( threads > UnresolvedResonanceProbabilityTable::getBandRandomNumberCaches().size() )
+  {
+    UnresolvedResonanceProbabilityTable::getBandRandomNumberCaches().resize(
+                                    threads, BandRandomNumberCache{0.0, false} );
+  }
+}
+
+// Constructor
+/*! \details The band data must be stored in the ACE UNR block order: for
+ * each table energy the band cdf, total, elastic, fission, capture and
+ * heating values (each of which has one value per band).
+ */
+UnresolvedResonanceProbabilityTable::UnresolvedResonanceProbabilityTable(
+                                 const std::vector<double>& energy_grid,
+                                 const size_t number_of_bands,
+                                 const bool log_log_interpolation,
+                                 const int inelastic_competition_flag,
+                                 const int other_absorption_flag,
+                                 const bool cross_section_factors,
+                                 const std::vector<double>& band_data )
+  : d_energy_grid( energy_grid ),
+    d_number_of_bands( number_of_bands ),
+    d_log_log_interpolation( log_log_interpolation ),
+    d_inelastic_competition_flag( inelastic_competition_flag ),
+    d_other_absorption_flag( other_absorption_flag ),
+    d_cross_section_factors( cross_section_factors ),
+    d_band_data( band_data )
+{
+  // Make sure the energy grid is valid
+  testPrecondition( energy_grid.size() > 1 );
+  testPrecondition( energy_grid.front() > 0.0 );
+  testPrecondition( Utility::Sort::isSortedAscending( energy_grid.begin(),
+                                                      energy_grid.end() ) );
+  // Make sure the number of bands is valid
+  testPrecondition( number_of_bands > 0 );
+  // Make sure the band data is valid
+  testPrecondition( band_data.size() ==
+                    energy_grid.size()*NUMBER_OF_BAND_QUANTITIES*
+                    number_of_bands );
+}
+
+// Return the lower energy limit of the unresolved resonance range (MeV)
+double UnresolvedResonanceProbabilityTable::getLowerEnergyLimit() const
+{
+  return d_energy_grid.front();
+}
+
+// Return the upper energy limit of the unresolved resonance range (MeV)
+double UnresolvedResonanceProbabilityTable::getUpperEnergyLimit() const
+{
+  return d_energy_grid.back();
+}
+
+// Return the number of bands
+size_t UnresolvedResonanceProbabilityTable::getNumberOfBands() const
+{
+  return d_number_of_bands;
+}
+
+// Check if log-log interpolation is used between the tables
+bool UnresolvedResonanceProbabilityTable::isLogLogInterpolationUsed() const
+{
+  return d_log_log_interpolation;
+}
+
+// Return the inelastic competition flag
+/*! \details A negative flag indicates that the inelastic cross section is
+ * zero in the unresolved resonance range. A positive flag is the reaction
+ * number of the smooth cross section that should be used for inelastic
+ * competition.
+ */
+int UnresolvedResonanceProbabilityTable::getInelasticCompetitionFlag() const
+{
+  return d_inelastic_competition_flag;
+}
+
+// Return the other absorption flag
+/*! \details A positive flag is the reaction number of the smooth cross
+ * section that should be used for other absorption.
+ */
+int UnresolvedResonanceProbabilityTable::getOtherAbsorptionFlag() const
+{
+  return d_other_absorption_flag;
+}
+
+// Check if the tables store factors of the smooth cross sections
+bool UnresolvedResonanceProbabilityTable::areCrossSectionFactors() const
+{
+  return d_cross_section_factors;
+}
+
+// Evaluate the elastic, fission and capture band values
+/*! \details The band that is sampled at the two tables that bracket the
+ * energy is selected with the same band random number. The band values are
+ * then interpolated. If the tables store factors, the band values must be
+ * multiplied by the smooth cross sections.
+ */
+void UnresolvedResonanceProbabilityTable::evaluate(
+                                         const double energy,
+                                         const double band_random_number,
+                                         double& elastic_value,
+                                         double& fission_value,
+                                         double& capture_value ) const
+{
+  // Make sure the energy is valid
+  testPrecondition( this->isEnergyWithinTable( energy ) );
+  // Make sure the band random number is valid
+  testPrecondition( band_random_number >= 0.0 );
+  testPrecondition( band_random_number < 1.0 );
+
+  size_t lower_energy_index =
+    std::upper_bound( d_energy_grid.begin(), d_energy_grid.end(), energy ) -
+    d_energy_grid.begin() - 1;
+
+  if( lower_energy_index == d_energy_grid.size() - 1 )
+    --lower_energy_index;
+
+  const size_t lower_band =
+    this->sampleBand( lower_energy_index, band_random_number );
+
+  const size_t upper_band =
+    this->sampleBand( lower_energy_index+1, band_random_number );
+
+  elastic_value = this->interpolate( energy,
+                                     lower_energy_index,
+                                     lower_band,
+                                     upper_band,
+                                     ELASTIC_BAND_QUANTITY );
+
+  fission_value = this->interpolate( energy,
+                                     lower_energy_index,
+                                     lower_band,
+                                     upper_band,
+                                     FISSION_BAND_QUANTITY );
+
+  capture_value = this->interpolate( energy,
+                                     lower_energy_index,
+                                     lower_band,
+                                     upper_band,
+                                     CAPTURE_BAND_QUANTITY );
+}
+
+// Sample the band at a table energy
+size_t UnresolvedResonanceProbabilityTable::sampleBand(
+                                      const size_t energy_index,
+                                      const double band_random_number ) const
+{
+  const double* cdf = this->getBandData( energy_index, CDF_BAND_QUANTITY );
+
+  size_t band = std::upper_bound( cdf, cdf + d_number_of_bands,
+                                  band_random_number ) - cdf;
+
+  // Check for roundoff error in the last cdf value
+  if( band == d_number_of_bands )
+    --band;
+
+  return band;
+}
+
+// Interpolate a band quantity between two table energies
+double UnresolvedResonanceProbabilityTable::interpolate(
+                                        const double energy,
+                                        const size_t lower_energy_index,
+                                        const size_t lower_band,
+                                        const size_t upper_band,
+                                        const BandQuantity quantity ) const
+{
+  const double lower_energy = d_energy_grid[lower_energy_index];
+  const double upper_energy = d_energy_grid[lower_energy_index+1];
+
+  const double lower_value =
+    this->getBandData( lower_energy_index, quantity )[lower_band];
+
+  const double upper_value =
+    this->getBandData( lower_energy_index+1, quantity )[upper_band];
+
+  double value;
+
+  if( d_log_log_interpolation )
+  {
+    if( lower_value > 0.0 && upper_value > 0.0 )
+    {
+      value = lower_value*std::pow( upper_value/lower_value,
+                                    std::log( energy/lower_energy )/
+                                    std::log( upper_energy/lower_energy ) );
+    }
+    else
+      value = 0.0;
+  }
+  else
+  {
+    value = lower_value + (upper_value - lower_value)*
+      (energy - lower_energy)/(upper_energy - lower_energy);
+  }
+
+  return std::max( value, 0.0 );
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_UnresolvedResonanceProbabilityTable.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,177 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_UnresolvedResonanceProbabilityTable.hpp
+//! \author Alex Robinson
+//! \brief  The unresolved resonance probability table class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_UNRESOLVED_RESONANCE_PROBABILITY_TABLE_HPP
+#define MONTE_CARLO_UNRESOLVED_RESONANCE_PROBABILITY_TABLE_HPP
+
+// Std Lib Includes
+#include <memory>
+
+// FRENSIE Includes
+#include "Utility_PerThread.hpp"
+#include "Utility_Vector.hpp"
+
+namespace MonteCarlo{
+
+/*! The unresolved resonance probability table class
+ * \details This class stores the unresolved resonance range (URR)
+ * probability tables of a nuclide. The band data of every table energy is
+ * stored contiguously (cdf, total, elastic, fission, capture, heating for
+ * each band) so that a lookup only touches the two tables that bracket the
+ * energy. The same band random number is used at both tables and for every
+ * nuclide so that the sampled cross sections are correlated. The band random
+ * number is cached for each thread (thread support must be enabled before
+ * the tables are used in a parallel block). It is sampled the first time
+ * that it is needed and it is kept until it is reset (at the start of each
+ * history and after each collision, when the neutron energy changes).
+ */
+class UnresolvedResonanceProbabilityTable
+{
+
+public:
+
+  //! Get the band random number (sampled if it has been reset)
+  static double getBandRandomNumber();
+
+  //! Reset the band random number
+  static void resetBandRandomNumber();
+
+  //! Enable support for multiple threads
+  static void enableThreadSupport( const unsigned threads );
+
+  //! Constructor
+  UnresolvedResonanceProbabilityTable(
+                                 const std::vector<double>& energy_grid,
+                                 const size_t number_of_bands,
+                                 const bool log_log_interpolation,
+                                 const int inelastic_competition_flag,
+                                 const int other_absorption_flag,
+                                 const bool cross_section_factors,
+                                 const std::vector<double>& band_data );
+
+  //! Destructor
+  ~UnresolvedResonanceProbabilityTable()
+  { /* ... */ }
+
+  //! Return the lower energy limit of the unresolved resonance range (MeV)
+  double getLowerEnergyLimit() const;
+
+  //! Return the upper energy limit of the unresolved resonance range (MeV)
+  double getUpperEnergyLimit() const;
+
+  //! Check if an energy is in the unresolved resonance range
+  bool isEnergyWithinTable( const double energy ) const;
+
+  //! Return the number of bands
+  size_t getNumberOfBands() const;
+
+  //! Check if log-log interpolation is used between the tables
+  bool isLogLogInterpolationUsed() const;
+
+  //! Return the inelastic competition flag
+  int getInelasticCompetitionFlag() const;
+
+  //! Return the other absorption flag
+  int getOtherAbsorptionFlag() const;
+
+  //! Check if the tables store factors of the smooth cross sections
+  bool areCrossSectionFactors() const;
+
+  //! Evaluate the elastic, fission and capture band values
+  void evaluate( const double energy,
+                 const double band_random_number,
+                 double& elastic_value,
+                 double& fission_value,
+                 double& capture_value ) const;
+
+private:
+
+  // The band data quantities
+  enum BandQuantity{
+    CDF_BAND_QUANTITY = 0,
+    TOTAL_BAND_QUANTITY,
+    ELASTIC_BAND_QUANTITY,
+    FISSION_BAND_QUANTITY,
+    CAPTURE_BAND_QUANTITY,
+    HEATING_BAND_QUANTITY,
+    NUMBER_OF_BAND_QUANTITIES
+  };
+
+  // Return the band data of a quantity at a table energy
+  const double* getBandData( const size_t energy_index,
+                             const BandQuantity quantity ) const;
+
+  // Sample the band at a table energy
+  size_t sampleBand( const size_t energy_index,
+                     const double band_random_number ) const;
+
+  // Interpolate a band quantity between two table energies
+  double interpolate( const double energy,
+                      const size_t lower_energy_index,
+                      const size_t lower_band,
+                      const size_t upper_band,
+                      const BandQuantity quantity ) const;
+
+  // The cached band random number of a thread
+  struct BandRandomNumberCache
+  {
+    // The band random number
+    double random_number;
+
+    // Records if the band random number has been sampled
+    bool sampled;
+  };
+
+  // Return the per-thread band random number caches
+  static Utility::PerThread<BandRandomNumberCache>& getBandRandomNumberCaches();
+
+  // The energy grid
+  std::vector<double> d_energy_grid;
+
+  // The number of bands
+  size_t d_number_of_bands;
+
+  // Log-log interpolation between the tables
+  bool d_log_log_interpolation;
+
+  // The inelastic competition flag
+  int d_inelastic_competition_flag;
+
+  // The other absorption flag
+  int d_other_absorption_flag;
+
+  // The tables store factors of the smooth cross sections
+  bool d_cross_section_factors;
+
+  // The band data (energy major order)
+  std::vector<double> d_band_data;
+};
+
+// Check if an energy is in the unresolved resonance range
+inline bool UnresolvedResonanceProbabilityTable::isEnergyWithinTable(
+                                                   const double energy ) const
+{
+  return energy >= d_energy_grid.front() && energy <= d_energy_grid.back();
+}
+
+// Return the band data of a quantity at a table energy
+inline const double* UnresolvedResonanceProbabilityTable::getBandData(
+                                           const size_t energy_index,
+                                           const BandQuantity quantity ) const
+{
+  return d_band_data.data() +
+    (energy_index*NUMBER_OF_BAND_QUANTITIES + quantity)*d_number_of_bands;
+}
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_UNRESOLVED_RESONANCE_PROBABILITY_TABLE_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_UnresolvedResonanceProbabilityTable.hpp
+//---------------------------------------------------------------------------//
@@ -56,6 +56,39 @@ FRENSIE_UNIT_TEST( EnergyDependentNeutronMultiplicityReaction,
   FRENSIE_CHECK_EQUAL( number_of_emitted_neutrons, 2.0 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the differential cross section can be evaluated
+FRENSIE_UNIT_TEST( EnergyDependentNeutronMultiplicityReaction,
+                   evaluateDifferentialCrossSection )
+{
+  double outgoing_energy;
+
+  // No neutrons are emitted outside of the multiplicity energy grid
+  double cross_section =
+    nuclear_reaction->evaluateDifferentialCrossSection( 1e-11,
+                                                        0.5,
+                                                        outgoing_energy );
+
+  FRENSIE_CHECK_EQUAL( cross_section, 0.0 );
+  FRENSIE_CHECK_EQUAL( outgoing_energy, 1e-11 );
+
+  cross_section =
+    nuclear_reaction->evaluateDifferentialCrossSection( 30.0,
+                                                        0.5,
+                                                        outgoing_energy );
+
+  FRENSIE_CHECK_EQUAL( cross_section, 0.0 );
+  FRENSIE_CHECK_EQUAL( outgoing_energy, 30.0 );
+
+  cross_section =
+    nuclear_reaction->evaluateDifferentialCrossSection( 150.0,
+                                                        0.5,
+                                                        outgoing_energy );
+
+  FRENSIE_CHECK_GREATER( cross_section, 0.0 );
+  FRENSIE_CHECK_GREATER( outgoing_energy, 0.0 );
+}
+
 //---------------------------------------------------------------------------//
 // Custom Setup
 //---------------------------------------------------------------------------//
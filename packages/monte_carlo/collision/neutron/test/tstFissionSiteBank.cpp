@@ -0,0 +1,129 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstFissionSiteBank.cpp
+//! \author Alex Robinson
+//! \brief  Fission site bank unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+
+// FRENSIE Includes
+#include "MonteCarlo_FissionSiteBank.hpp"
+#include "MonteCarlo_NeutronState.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check if a reaction is a fission reaction
+FRENSIE_UNIT_TEST( FissionSiteBank, isFissionReaction )
+{
+  FRENSIE_CHECK( MonteCarlo::FissionSiteBank::isFissionReaction( MonteCarlo::N__TOTAL_FISSION_REACTION ) );
+  FRENSIE_CHECK( MonteCarlo::FissionSiteBank::isFissionReaction( MonteCarlo::N__FISSION_REACTION ) );
+  FRENSIE_CHECK( MonteCarlo::FissionSiteBank::isFissionReaction( MonteCarlo::N__N_FISSION_REACTION ) );
+  FRENSIE_CHECK( MonteCarlo::FissionSiteBank::isFissionReaction( MonteCarlo::N__2N_FISSION_REACTION ) );
+  FRENSIE_CHECK( MonteCarlo::FissionSiteBank::isFissionReaction( MonteCarlo::N__3N_FISSION_REACTION ) );
+  FRENSIE_CHECK( !MonteCarlo::FissionSiteBank::isFissionReaction( MonteCarlo::N__N_ELASTIC_REACTION ) );
+  FRENSIE_CHECK( !MonteCarlo::FissionSiteBank::isFissionReaction( MonteCarlo::N__2N_REACTION ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that fission neutrons are recorded as fission sites
+FRENSIE_UNIT_TEST( FissionSiteBank, push_fission )
+{
+  MonteCarlo::FissionSiteBank bank;
+
+  std::shared_ptr<MonteCarlo::NeutronState>
+    neutron( new MonteCarlo::NeutronState( 1ull ) );
+  neutron->setPosition( 1.0, 2.0, 3.0 );
+  neutron->setDirection( 0.0, 0.0, 1.0 );
+  neutron->setEnergy( 2.0 );
+  neutron->setWeight( 0.5 );
+
+  bank.push( neutron, MonteCarlo::N__FISSION_REACTION );
+
+  FRENSIE_CHECK( !neutron );
+  FRENSIE_CHECK( bank.isEmpty() );
+  FRENSIE_REQUIRE_EQUAL( bank.getNumberOfSites(), 1 );
+
+  const MonteCarlo::FissionSiteBank::FissionSite& site = bank.getSites()[0];
+
+  FRENSIE_CHECK_EQUAL( site.position[0], 1.0 );
+  FRENSIE_CHECK_EQUAL( site.position[1], 2.0 );
+  FRENSIE_CHECK_EQUAL( site.position[2], 3.0 );
+  FRENSIE_CHECK_EQUAL( site.direction[0], 0.0 );
+  FRENSIE_CHECK_EQUAL( site.direction[1], 0.0 );
+  FRENSIE_CHECK_EQUAL( site.direction[2], 1.0 );
+  FRENSIE_CHECK_EQUAL( site.energy, 2.0 );
+  FRENSIE_CHECK_EQUAL( site.weight, 0.5 );
+
+  MonteCarlo::NeutronState other_neutron( 2ull );
+  other_neutron.setPosition( -1.0, -2.0, -3.0 );
+  other_neutron.setDirection( 1.0, 0.0, 0.0 );
+  other_neutron.setEnergy( 1.0 );
+  other_neutron.setWeight( 2.0 );
+
+  bank.push( other_neutron, MonteCarlo::N__TOTAL_FISSION_REACTION );
+
+  FRENSIE_CHECK( bank.isEmpty() );
+  FRENSIE_CHECK_EQUAL( bank.getNumberOfSites(), 2 );
+  FRENSIE_CHECK_EQUAL( bank.getTotalSiteWeight(), 2.5 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that non-fission particles are stored in the bank
+FRENSIE_UNIT_TEST( FissionSiteBank, push_non_fission )
+{
+  MonteCarlo::FissionSiteBank bank;
+
+  std::shared_ptr<MonteCarlo::NeutronState>
+    neutron( new MonteCarlo::NeutronState( 1ull ) );
+
+  bank.push( neutron, MonteCarlo::N__2N_REACTION );
+
+  MonteCarlo::PhotonState photon( 1ull );
+
+  bank.push( photon );
+
+  FRENSIE_CHECK_EQUAL( bank.size(), 2 );
+  FRENSIE_CHECK_EQUAL( bank.getNumberOfSites(), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that fission sites can be appended in order
+FRENSIE_UNIT_TEST( FissionSiteBank, appendSites )
+{
+  MonteCarlo::FissionSiteBank bank_a, bank_b;
+
+  MonteCarlo::NeutronState neutron( 1ull );
+  neutron.setPosition( 1.0, 1.0, 1.0 );
+
+  bank_a.push( neutron, MonteCarlo::N__FISSION_REACTION );
+
+  neutron.setPosition( 2.0, 2.0, 2.0 );
+
+  bank_b.push( neutron, MonteCarlo::N__FISSION_REACTION );
+
+  neutron.setPosition( 3.0, 3.0, 3.0 );
+
+  bank_b.push( neutron, MonteCarlo::N__FISSION_REACTION );
+
+  bank_a.appendSites( bank_b );
+
+  FRENSIE_REQUIRE_EQUAL( bank_a.getNumberOfSites(), 3 );
+  FRENSIE_CHECK_EQUAL( bank_a.getSites()[0].position[0], 1.0 );
+  FRENSIE_CHECK_EQUAL( bank_a.getSites()[1].position[0], 2.0 );
+  FRENSIE_CHECK_EQUAL( bank_a.getSites()[2].position[0], 3.0 );
+
+  bank_a.clearSites();
+
+  FRENSIE_CHECK_EQUAL( bank_a.getNumberOfSites(), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// end tstFissionSiteBank.cpp
+//---------------------------------------------------------------------------//
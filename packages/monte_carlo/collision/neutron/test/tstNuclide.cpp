@@ -8,6 +8,8 @@
 
 // Std Lib Includes
 #include <iostream>
+#include <cmath>
+#include <random>
 
 // FRENSIE Includes
 #include "MonteCarlo_Nuclide.hpp"
@@ -22,6 +24,31 @@
 
 std::shared_ptr<const MonteCarlo::Nuclide> h1_nuclide;
 std::shared_ptr<const MonteCarlo::Nuclide> o16_nuclide;
+std::shared_ptr<const MonteCarlo::Nuclide> o16_urr_nuclide;
+std::shared_ptr<const MonteCarlo::Nuclide> o16_urr_no_competition_nuclide;
+
+//---------------------------------------------------------------------------//
+// Testing Functions.
+//---------------------------------------------------------------------------//
+// Sum the scattering and absorption reaction cross sections of a nuclide
+double sumReactionCrossSections( const MonteCarlo::Nuclide& nuclide,
+                                 const double energy,
+                                 const bool absorption_only )
+{
+  MonteCarlo::Nuclide::ReactionEnumTypeSet reaction_types;
+
+  nuclide.getAbsorptionReactionTypes( reaction_types );
+
+  if( !absorption_only )
+    nuclide.getScatteringReactionTypes( reaction_types );
+
+  double cross_section = 0.0;
+
+  for( auto&& reaction_type : reaction_types )
+    cross_section += nuclide.getReactionCrossSection( energy, reaction_type );
+
+  return cross_section;
+}
 
 //---------------------------------------------------------------------------//
 // Tests.
@@ -345,6 +372,316 @@ FRENSIE_UNIT_TEST( Nuclide_hydrogen, collideSurvivalBias)
   std::cout << neutron << std::endl;
 }
 
+//---------------------------------------------------------------------------//
+// Check that survival biasing (implicit capture) reduces the relative error
+// of a thermal neutron survival estimate
+FRENSIE_UNIT_TEST( Nuclide_hydrogen, collideSurvivalBias_relative_error )
+{
+  const unsigned number_of_histories = 10000;
+  const unsigned number_of_collisions = 40;
+
+  // Use a fixed stream so that the comparison is reproducible (a statistical
+  // test on the real stream could fail at random)
+  std::vector<double> fake_stream( 100003 );
+
+  {
+    std::mt19937 generator( 1 );
+    std::uniform_real_distribution<double> uniform( 0.0, 1.0 );
+
+    for( size_t i = 0; i < fake_stream.size(); ++i )
+      fake_stream[i] = uniform( generator );
+  }
+
+  // Estimate the probability that a neutron survives the collisions
+  // (the first and second moments of the score are returned)
+  auto estimate_survival_probability =
+    [number_of_histories,number_of_collisions,&fake_stream](
+                                                   const bool survival_bias,
+                                                   double& first_moment,
+                                                   double& second_moment )
+    {
+      Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+      MonteCarlo::ParticleBank bank;
+
+      first_moment = 0.0;
+      second_moment = 0.0;
+
+      for( unsigned i = 0; i < number_of_histories; ++i )
+      {
+        MonteCarlo::NeutronState neutron( i );
+        neutron.setDirection( 0.0, 0.0, 1.0 );
+        neutron.setEnergy( 2.53e-8 );
+        neutron.setWeight( 1.0 );
+
+        for( unsigned j = 0; j < number_of_collisions; ++j )
+        {
+          if( survival_bias )
+            h1_nuclide->collideSurvivalBias( neutron, bank );
+          else
+            h1_nuclide->collideAnalogue( neutron, bank );
+
+          // Stop if the neutron has been absorbed or has left the grid
+          if( neutron.isGone() || neutron.getEnergy() <= 1e-11 )
+            break;
+        }
+
+        double score = neutron.isGone() ? 0.0 : neutron.getWeight();
+
+        first_moment += score;
+        second_moment += score*score;
+      }
+
+      Utility::RandomNumberGenerator::unsetFakeStream();
+    };
+
+  double analogue_first_moment, analogue_second_moment;
+
+  estimate_survival_probability( false,
+                                 analogue_first_moment,
+                                 analogue_second_moment );
+
+  double implicit_first_moment, implicit_second_moment;
+
+  estimate_survival_probability( true,
+                                 implicit_first_moment,
+                                 implicit_second_moment );
+
+  const double n = number_of_histories;
+
+  double analogue_mean = analogue_first_moment/n;
+  double analogue_mean_variance =
+    (analogue_second_moment/n - analogue_mean*analogue_mean)/(n - 1.0);
+
+  double implicit_mean = implicit_first_moment/n;
+  double implicit_mean_variance =
+    (implicit_second_moment/n - implicit_mean*implicit_mean)/(n - 1.0);
+
+  // Both collision modes must estimate the same survival probability
+  FRENSIE_CHECK( std::fabs( analogue_mean - implicit_mean ) <
+                 4.0*std::sqrt( analogue_mean_variance +
+                                implicit_mean_variance ) );
+
+  // Implicit capture must reduce the relative error for the same number of
+  // histories (the figure of merit is compared by the implicit capture timer)
+  FRENSIE_CHECK_LESS( implicit_mean_variance/(implicit_mean*implicit_mean),
+                      analogue_mean_variance/(analogue_mean*analogue_mean) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the unresolved resonance cross sections are consistent
+FRENSIE_UNIT_TEST( Nuclide_oxygen_urr, getTotalCrossSection )
+{
+  // Select the first band (elastic and capture factors of 0.5)
+  MonteCarlo::UnresolvedResonanceProbabilityTable::resetBandRandomNumber();
+
+  std::vector<double> fake_stream( 1, 0.25 );
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  double total_cross_section = o16_urr_nuclide->getTotalCrossSection( 8.5 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+         total_cross_section,
+         o16_nuclide->getTotalCrossSection( 8.5 ) -
+         0.5*o16_nuclide->getReactionCrossSection( 8.5, MonteCarlo::N__N_ELASTIC_REACTION ) -
+         0.5*o16_nuclide->getReactionCrossSection( 8.5, MonteCarlo::N__GAMMA_REACTION ),
+         1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+         total_cross_section,
+         sumReactionCrossSections( *o16_urr_nuclide, 8.5, false ),
+         1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+         o16_urr_nuclide->getReactionCrossSection( 8.5, MonteCarlo::N__TOTAL_REACTION ),
+         total_cross_section,
+         1e-15 );
+
+  double absorption_cross_section =
+    o16_urr_nuclide->getAbsorptionCrossSection( 8.5 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+         absorption_cross_section,
+         sumReactionCrossSections( *o16_urr_nuclide, 8.5, true ),
+         1e-12 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+         o16_urr_nuclide->getReactionCrossSection( 8.5, MonteCarlo::N__N_ELASTIC_REACTION ),
+         0.5*o16_nuclide->getReactionCrossSection( 8.5, MonteCarlo::N__N_ELASTIC_REACTION ),
+         1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+         o16_urr_nuclide->getReactionCrossSection( 8.5, MonteCarlo::N__GAMMA_REACTION ),
+         0.5*o16_nuclide->getReactionCrossSection( 8.5, MonteCarlo::N__GAMMA_REACTION ),
+         1e-15 );
+
+  // The inelastic competition and other absorption use the smooth data
+  FRENSIE_CHECK_EQUAL(
+         o16_urr_nuclide->getReactionCrossSection( 8.5, MonteCarlo::N__N_EXCITED_STATE_1_REACTION ),
+         o16_nuclide->getReactionCrossSection( 8.5, MonteCarlo::N__N_EXCITED_STATE_1_REACTION ) );
+  FRENSIE_CHECK_EQUAL(
+         o16_urr_nuclide->getReactionCrossSection( 8.5, MonteCarlo::N__ALPHA_REACTION ),
+         o16_nuclide->getReactionCrossSection( 8.5, MonteCarlo::N__ALPHA_REACTION ) );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+}
+
+//---------------------------------------------------------------------------//
+// Check that the unresolved resonance tables are skipped outside of the
+// unresolved resonance range
+FRENSIE_UNIT_TEST( Nuclide_oxygen_urr, getTotalCrossSection_outside_range )
+{
+  MonteCarlo::UnresolvedResonanceProbabilityTable::resetBandRandomNumber();
+
+  // Select the second band (elastic and capture factors of 1.5)
+  std::vector<double> fake_stream( 1, 0.75 );
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  FRENSIE_CHECK_EQUAL( o16_urr_nuclide->getTotalCrossSection( 1.0 ),
+                       o16_nuclide->getTotalCrossSection( 1.0 ) );
+  FRENSIE_CHECK_EQUAL( o16_urr_nuclide->getAbsorptionCrossSection( 1.0 ),
+                       o16_nuclide->getAbsorptionCrossSection( 1.0 ) );
+  FRENSIE_CHECK_EQUAL(
+         o16_urr_nuclide->getReactionCrossSection( 1.0, MonteCarlo::N__N_ELASTIC_REACTION ),
+         o16_nuclide->getReactionCrossSection( 1.0, MonteCarlo::N__N_ELASTIC_REACTION ) );
+
+  FRENSIE_CHECK_EQUAL( o16_urr_no_competition_nuclide->getTotalCrossSection( 2.0e1 ),
+                       o16_nuclide->getTotalCrossSection( 2.0e1 ) );
+  FRENSIE_CHECK_EQUAL( o16_urr_no_competition_nuclide->getAbsorptionCrossSection( 2.0e1 ),
+                       o16_nuclide->getAbsorptionCrossSection( 2.0e1 ) );
+  FRENSIE_CHECK_EQUAL(
+         o16_urr_no_competition_nuclide->getReactionCrossSection( 2.0e1, MonteCarlo::N__N_EXCITED_STATE_1_REACTION ),
+         o16_nuclide->getReactionCrossSection( 2.0e1, MonteCarlo::N__N_EXCITED_STATE_1_REACTION ) );
+
+  // No band random number can be consumed outside of the range - the first
+  // evaluation in the range must still use the fake stream value
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+         o16_urr_nuclide->getReactionCrossSection( 8.5, MonteCarlo::N__N_ELASTIC_REACTION ),
+         1.5*o16_nuclide->getReactionCrossSection( 8.5, MonteCarlo::N__N_ELASTIC_REACTION ),
+         1e-15 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+}
+
+//---------------------------------------------------------------------------//
+// Check that the inelastic competition and other absorption are removed from
+// the unresolved resonance range when the table flags are negative
+FRENSIE_UNIT_TEST( Nuclide_oxygen_urr_no_competition, getTotalCrossSection )
+{
+  MonteCarlo::UnresolvedResonanceProbabilityTable::resetBandRandomNumber();
+
+  std::vector<double> fake_stream( 1, 0.25 );
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  FRENSIE_CHECK_EQUAL(
+         o16_urr_no_competition_nuclide->getReactionCrossSection( 8.5, MonteCarlo::N__N_EXCITED_STATE_1_REACTION ),
+         0.0 );
+  FRENSIE_CHECK_EQUAL(
+         o16_urr_no_competition_nuclide->getReactionCrossSection( 8.5, MonteCarlo::N__ALPHA_REACTION ),
+         0.0 );
+
+  const double elastic_cross_section = 0.5*
+    o16_nuclide->getReactionCrossSection( 8.5, MonteCarlo::N__N_ELASTIC_REACTION );
+
+  const double capture_cross_section = 0.5*
+    o16_nuclide->getReactionCrossSection( 8.5, MonteCarlo::N__GAMMA_REACTION );
+
+  double total_cross_section =
+    o16_urr_no_competition_nuclide->getTotalCrossSection( 8.5 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( total_cross_section,
+                                   elastic_cross_section +
+                                   capture_cross_section,
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+         total_cross_section,
+         sumReactionCrossSections( *o16_urr_no_competition_nuclide, 8.5, false ),
+         1e-12 );
+
+  double absorption_cross_section =
+    o16_urr_no_competition_nuclide->getAbsorptionCrossSection( 8.5 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( absorption_cross_section,
+                                   capture_cross_section,
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+         absorption_cross_section,
+         sumReactionCrossSections( *o16_urr_no_competition_nuclide, 8.5, true ),
+         1e-12 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+}
+
+//---------------------------------------------------------------------------//
+// Check that the sampled reactions are consistent with the unresolved
+// resonance cross sections
+FRENSIE_UNIT_TEST( Nuclide_oxygen_urr_no_competition, collideAnalogue )
+{
+  MonteCarlo::UnresolvedResonanceProbabilityTable::resetBandRandomNumber();
+
+  std::vector<double> fake_stream( 1, 0.25 );
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  const double absorption_probability =
+    o16_urr_no_competition_nuclide->getAbsorptionCrossSection( 8.5 )/
+    o16_urr_no_competition_nuclide->getTotalCrossSection( 8.5 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+
+  MonteCarlo::ParticleBank bank;
+
+  // Capture is the only absorption reaction left in the range
+  {
+    MonteCarlo::UnresolvedResonanceProbabilityTable::resetBandRandomNumber();
+
+    fake_stream.resize( 12, 0.5 );
+    fake_stream[0] = 0.25;
+    fake_stream[1] = 0.999*absorption_probability;
+
+    Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+    MonteCarlo::NeutronState neutron( 0ull );
+    neutron.setDirection( 0.0, 0.0, 1.0 );
+    neutron.setEnergy( 8.5 );
+    neutron.setWeight( 1.0 );
+
+    o16_urr_no_competition_nuclide->collideAnalogue( neutron, bank );
+
+    FRENSIE_CHECK( neutron.isGone() );
+
+    Utility::RandomNumberGenerator::unsetFakeStream();
+  }
+
+  // Elastic is the only scattering reaction left in the range, so every
+  // scattering random number (up to the end of the cdf) must select it
+  {
+    MonteCarlo::UnresolvedResonanceProbabilityTable::resetBandRandomNumber();
+
+    fake_stream[0] = 0.25;
+    fake_stream[1] = 1.0 - 1e-12;
+
+    Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+    MonteCarlo::NeutronState neutron( 0ull );
+    neutron.setDirection( 0.0, 0.0, 1.0 );
+    neutron.setEnergy( 8.5 );
+    neutron.setWeight( 1.0 );
+
+    o16_urr_no_competition_nuclide->collideAnalogue( neutron, bank );
+
+    FRENSIE_CHECK( !neutron.isGone() );
+
+    // The minimum outgoing energy from elastic scattering is
+    // 8.5*((A-1)/(A+1))^2 (~6.6 MeV) - inelastic scattering leaves < 2.5 MeV
+    FRENSIE_CHECK_GREATER( neutron.getEnergy(), 6.5 );
+
+    Utility::RandomNumberGenerator::unsetFakeStream();
+  }
+
+  FRENSIE_CHECK_EQUAL( bank.size(), 0 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that a neutron can collide with a nuclide
 // FRENSIE_UNIT_TEST( Nuclide_oxygen, collideSurvivalBias)
@@ -521,7 +858,74 @@ FRENSIE_CUSTOM_UNIT_TEST_INIT()
                                energy_grid_searcher,
                                standard_scattering_reactions,
                                standard_absorption_reactions ) );
-  
+
+  // Initialize O-16 with unresolved resonance tables (two tables and two
+  // bands with elastic and capture factors of 0.5 and 1.5)
+  {
+    std::vector<double> urr_energy_grid( {8.0, 9.0} );
+
+    std::vector<double> urr_band_data( {0.5, 1.0, // cdf
+                                        1.0, 1.0, // total
+                                        0.5, 1.5, // elastic
+                                        0.0, 0.0, // fission
+                                        0.5, 1.5, // capture
+                                        0.0, 0.0, // heating
+                                        0.5, 1.0, // cdf
+                                        1.0, 1.0, // total
+                                        0.5, 1.5, // elastic
+                                        0.0, 0.0, // fission
+                                        0.5, 1.5, // capture
+                                        0.0, 0.0} ); // heating
+
+    std::shared_ptr<const MonteCarlo::UnresolvedResonanceProbabilityTable>
+      urr_table( new MonteCarlo::UnresolvedResonanceProbabilityTable(
+                                            urr_energy_grid,
+                                            2,
+                                            false,
+                                            51,
+                                            0,
+                                            true,
+                                            urr_band_data ) );
+
+    o16_urr_nuclide.reset( new MonteCarlo::Nuclide(
+			       "8016.70c",
+                               1u,
+                               1u,
+                               0u,
+                               ace_file_handler->getTableAtomicWeightRatio(),
+			       ace_file_handler->getTableTemperature().value(),
+                               energy_grid,
+                               energy_grid_searcher,
+                               standard_scattering_reactions,
+                               standard_absorption_reactions,
+                               std::shared_ptr<const MonteCarlo::SAlphaBeta>(),
+                               urr_table ) );
+
+    // The inelastic competition and other absorption are zero in the range
+    urr_table.reset( new MonteCarlo::UnresolvedResonanceProbabilityTable(
+                                            urr_energy_grid,
+                                            2,
+                                            false,
+                                            -1,
+                                            -1,
+                                            true,
+                                            urr_band_data ) );
+
+    o16_urr_no_competition_nuclide.reset( new MonteCarlo::Nuclide(
+			       "8016.70c",
+                               1u,
+                               1u,
+                               0u,
+                               ace_file_handler->getTableAtomicWeightRatio(),
+			       ace_file_handler->getTableTemperature().value(),
+                               energy_grid,
+                               energy_grid_searcher,
+                               standard_scattering_reactions,
+                               standard_absorption_reactions,
+                               std::shared_ptr<const MonteCarlo::SAlphaBeta>(),
+                               urr_table ) );
+  }
+
   // Initialize the random number generator
   Utility::RandomNumberGenerator::createStreams();
 }
@@ -8,12 +8,18 @@
 
 // Std Lib Includes
 #include <iostream>
+#include <fstream>
+#include <sstream>
 #include <memory>
 
+// Boost Includes
+#include <boost/algorithm/string/replace.hpp>
+
 // FRENSIE Includes
 #include "MonteCarlo_NuclideFactory.hpp"
 #include "MonteCarlo_DecoupledPhotonProductionNuclide.hpp"
 #include "Data_ScatteringCenterPropertiesDatabase.hpp"
+#include "Data_ACENuclearDataProperties.hpp"
 #include "Utility_UnitTestHarnessWithMain.hpp"
 
 //---------------------------------------------------------------------------//
@@ -32,6 +38,57 @@ std::unique_ptr<MonteCarlo::ScatteringCenterDefinitionDatabase> nuclide_definiti
 
 std::shared_ptr<const MonteCarlo::SimulationProperties> properties;
 
+//---------------------------------------------------------------------------//
+// Testing Functions.
+//---------------------------------------------------------------------------//
+// Copy an ACE table and give the copy a new table name
+/*! \details There is only a single evaluation temperature available for each
+ * nuclide in the test data. A renamed copy of a table can be used to test the
+ * loading of bracketing tables.
+ */
+void copyACETable( const boost::filesystem::path& ace_file_path,
+                   const size_t table_start_line,
+                   const std::string& table_name,
+                   const std::string& new_table_name,
+                   const boost::filesystem::path& new_ace_file_path )
+{
+  std::ifstream ace_file( ace_file_path.string() );
+  std::ofstream new_ace_file( new_ace_file_path.string() );
+
+  std::string line;
+
+  for( size_t i = 1; i < table_start_line; ++i )
+    std::getline( ace_file, line );
+
+  // Rename the table (header line 1)
+  std::getline( ace_file, line );
+  boost::algorithm::replace_first( line, table_name, new_table_name );
+  new_ace_file << line << "\n";
+
+  // Copy the second header line and the zaids and awrs
+  for( size_t i = 0; i < 5; ++i )
+  {
+    std::getline( ace_file, line );
+    new_ace_file << line << "\n";
+  }
+
+  // The first nxs value is the size of the xss array
+  size_t xss_size;
+
+  std::getline( ace_file, line );
+  std::istringstream( line ) >> xss_size;
+  new_ace_file << line << "\n";
+
+  // Copy the remaining nxs line, the jxs array and the xss array
+  const size_t remaining_lines = 5 + (xss_size + 3)/4;
+
+  for( size_t i = 0; i < remaining_lines; ++i )
+  {
+    std::getline( ace_file, line );
+    new_ace_file << line << "\n";
+  }
+}
+
 //---------------------------------------------------------------------------//
 // Tests.
 //---------------------------------------------------------------------------//
@@ -93,6 +150,75 @@ FRENSIE_UNIT_TEST( NuclideFactory, createNuclideMap_basic )
   FRENSIE_CHECK( nuclide_map["H-1_900K"].get() != NULL );
 }
 
+//---------------------------------------------------------------------------//
+// Check that a nuclide map can be created with temperature interpolated
+// nuclides
+FRENSIE_UNIT_TEST( NuclideFactory, createNuclideMap_temperature_interpolated )
+{
+  MonteCarlo::NuclideFactory::ScatteringCenterNameSet nuclide_names;
+  nuclide_names.insert( "H-1_293.6K" );
+  nuclide_names.insert( "H-1_400K" );
+  nuclide_names.insert( "H-1_500K" );
+
+  MonteCarlo::SimulationProperties properties;
+  properties.setNumberOfNeutronHashGridBins( 100 );
+  properties.setUnresolvedResonanceProbabilityTableModeOff();
+  properties.setParticleMode( MonteCarlo::NEUTRON_MODE );
+
+  std::unique_ptr<MonteCarlo::NuclideFactory> factory(
+                                      new MonteCarlo::NuclideFactory(
+                                                          *data_directory,
+                                                          nuclide_names,
+                                                          *nuclide_definitions,
+                                                          properties,
+                                                          true ) );
+
+  MonteCarlo::NuclideFactory::NuclideNameMap nuclide_map;
+
+  factory->createNuclideMap( nuclide_map );
+
+  // Each interpolated nuclide has a nuclide for each bracketing table
+  FRENSIE_CHECK_EQUAL( nuclide_map.size(), 7 );
+  FRENSIE_REQUIRE( nuclide_map.count( "H-1_293.6K" ) );
+  FRENSIE_REQUIRE( nuclide_map.count( "H-1_400K" ) );
+  FRENSIE_REQUIRE( nuclide_map.count( "H-1_400K@1001.70c" ) );
+  FRENSIE_REQUIRE( nuclide_map.count( "H-1_400K@1001.71c" ) );
+  FRENSIE_REQUIRE( nuclide_map.count( "H-1_500K" ) );
+  FRENSIE_REQUIRE( nuclide_map.count( "H-1_500K@1001.70c" ) );
+  FRENSIE_REQUIRE( nuclide_map.count( "H-1_500K@1001.71c" ) );
+
+  // Each table is only loaded once
+  FRENSIE_CHECK( nuclide_map["H-1_400K@1001.70c"].get() ==
+                 nuclide_map["H-1_293.6K"].get() );
+  FRENSIE_CHECK( nuclide_map["H-1_500K@1001.70c"].get() ==
+                 nuclide_map["H-1_293.6K"].get() );
+  FRENSIE_CHECK( nuclide_map["H-1_400K@1001.71c"].get() ==
+                 nuclide_map["H-1_500K@1001.71c"].get() );
+  FRENSIE_CHECK( nuclide_map["H-1_400K@1001.71c"].get() !=
+                 nuclide_map["H-1_400K@1001.70c"].get() );
+
+  // The nuclide name refers to the table nearest the desired temperature
+  FRENSIE_CHECK( nuclide_map["H-1_400K"].get() ==
+                 nuclide_map["H-1_400K@1001.70c"].get() );
+  FRENSIE_CHECK( nuclide_map["H-1_500K"].get() ==
+                 nuclide_map["H-1_500K@1001.71c"].get() );
+
+  // The bracketing table nuclides use the table evaluation temperatures
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                        nuclide_map["H-1_400K@1001.70c"]->getTemperature(),
+                        2.53010E-08,
+                        1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                        nuclide_map["H-1_400K@1001.71c"]->getTemperature(),
+                        5.17041E-08,
+                        1e-15 );
+
+  // The renamed table is a copy so the cross sections must be identical
+  FRENSIE_CHECK_EQUAL(
+            nuclide_map["H-1_400K@1001.71c"]->getTotalCrossSection( 1.0 ),
+            nuclide_map["H-1_400K@1001.70c"]->getTotalCrossSection( 1.0 ) );
+}
+
 // //---------------------------------------------------------------------------//
 // // Check that a nuclide map can be created
 // FRENSIE_UNIT_TEST( NuclideFactory, createNuclideMap_unresolved_resonances )
@@ -221,6 +347,47 @@ FRENSIE_CUSTOM_UNIT_TEST_INIT()
                                          900*kelvin,
                                          false ) );
 
+  // Create a renamed copy of the H-1 table to act as a higher temperature
+  // evaluation (600K)
+  std::shared_ptr<const Data::NuclearDataProperties> h1_lower_properties =
+    h1_properties.getSharedNuclearDataProperties(
+                                         Data::NuclearDataProperties::ACE_FILE,
+                                         7,
+                                         2.53010E-08*MeV,
+                                         true );
+
+  copyACETable( *data_directory / h1_lower_properties->filePath(),
+                h1_lower_properties->fileStartLine(),
+                "1001.70c",
+                "1001.71c",
+                *data_directory / "test_h1_71c_ace_file.txt" );
+
+  std::shared_ptr<const Data::NuclearDataProperties> h1_upper_properties(
+                new Data::ACENuclearDataProperties(
+                                    h1_lower_properties->atomicWeightRatio(),
+                                    5.17041E-08*MeV,
+                                    "test_h1_71c_ace_file.txt",
+                                    1,
+                                    "1001.71c" ) );
+
+  // The lower table is nearest to 400K (3.446933E-08 MeV)
+  MonteCarlo::ScatteringCenterDefinition& h1_400K_definition =
+    nuclide_definitions->createDefinition( "H-1_400K", 1001 );
+
+  h1_400K_definition.setTemperatureInterpolatedNuclearDataProperties(
+                                                 h1_lower_properties,
+                                                 h1_upper_properties,
+                                                 3.446933E-08*MeV );
+
+  // The upper table is nearest to 500K (4.308667E-08 MeV)
+  MonteCarlo::ScatteringCenterDefinition& h1_500K_definition =
+    nuclide_definitions->createDefinition( "H-1_500K", 1001 );
+
+  h1_500K_definition.setTemperatureInterpolatedNuclearDataProperties(
+                                                 h1_lower_properties,
+                                                 h1_upper_properties,
+                                                 4.308667E-08*MeV );
+
   // Initialize the random number generator
   Utility::RandomNumberGenerator::createStreams();
 }
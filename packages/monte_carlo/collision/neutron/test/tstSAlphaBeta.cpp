@@ -0,0 +1,421 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstSAlphaBeta.cpp
+//! \author Alex Robinson
+//! \brief  S(alpha,beta) thermal scattering unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+
+// FRENSIE Includes
+#include "MonteCarlo_SAlphaBeta.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_3DCartesianVectorHelpers.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+std::shared_ptr<const MonteCarlo::SAlphaBeta> equiprobable_s_alpha_beta;
+std::shared_ptr<const MonteCarlo::SAlphaBeta> skewed_s_alpha_beta;
+std::shared_ptr<const MonteCarlo::SAlphaBeta> coherent_s_alpha_beta;
+
+//---------------------------------------------------------------------------//
+// Tests
+//---------------------------------------------------------------------------//
+// Check that the upper energy limit can be returned
+FRENSIE_UNIT_TEST( SAlphaBeta, getUpperEnergyLimit )
+{
+  FRENSIE_CHECK_EQUAL( equiprobable_s_alpha_beta->getUpperEnergyLimit(),
+                       3e-8 );
+  FRENSIE_CHECK_EQUAL( coherent_s_alpha_beta->getUpperEnergyLimit(), 3e-8 );
+}
+
+//---------------------------------------------------------------------------//
+// Check if there is elastic scattering data
+FRENSIE_UNIT_TEST( SAlphaBeta, hasElasticScatteringData )
+{
+  FRENSIE_CHECK( equiprobable_s_alpha_beta->hasElasticScatteringData() );
+  FRENSIE_CHECK( !skewed_s_alpha_beta->hasElasticScatteringData() );
+  FRENSIE_CHECK( coherent_s_alpha_beta->hasElasticScatteringData() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the elastic scattering mode can be returned
+FRENSIE_UNIT_TEST( SAlphaBeta, getElasticScatteringMode )
+{
+  FRENSIE_CHECK_EQUAL( equiprobable_s_alpha_beta->getElasticScatteringMode(),
+                       Data::INCOHERENT_ELASTIC_MODE );
+  FRENSIE_CHECK_EQUAL( coherent_s_alpha_beta->getElasticScatteringMode(),
+                       Data::COHERENT_ELASTIC_MODE );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the inelastic cross section can be returned
+FRENSIE_UNIT_TEST( SAlphaBeta, getInelasticCrossSection )
+{
+  FRENSIE_CHECK_EQUAL( equiprobable_s_alpha_beta->getInelasticCrossSection( 5e-9 ),
+                       10.0 );
+  FRENSIE_CHECK_EQUAL( equiprobable_s_alpha_beta->getInelasticCrossSection( 1e-8 ),
+                       10.0 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( equiprobable_s_alpha_beta->getInelasticCrossSection( 2e-8 ),
+                                   15.0,
+                                   1e-12 );
+  FRENSIE_CHECK_EQUAL( equiprobable_s_alpha_beta->getInelasticCrossSection( 3e-8 ),
+                       20.0 );
+
+  // The Bragg edges are in the union grid of the coherent data
+  FRENSIE_CHECK_EQUAL( coherent_s_alpha_beta->getInelasticCrossSection( 5e-9 ),
+                       10.0 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( coherent_s_alpha_beta->getInelasticCrossSection( 2e-8 ),
+                                   15.0,
+                                   1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the elastic cross section can be returned
+FRENSIE_UNIT_TEST( SAlphaBeta, getElasticCrossSection )
+{
+  FRENSIE_CHECK_EQUAL( equiprobable_s_alpha_beta->getElasticCrossSection( 1e-8 ),
+                       2.0 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( equiprobable_s_alpha_beta->getElasticCrossSection( 2e-8 ),
+                                   3.0,
+                                   1e-12 );
+  FRENSIE_CHECK_EQUAL( skewed_s_alpha_beta->getElasticCrossSection( 2e-8 ),
+                       0.0 );
+
+  // Coherent elastic cross section
+  FRENSIE_CHECK_EQUAL( coherent_s_alpha_beta->getElasticCrossSection( 5e-10 ),
+                       0.0 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( coherent_s_alpha_beta->getElasticCrossSection( 1e-9 ),
+                                   2.0,
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( coherent_s_alpha_beta->getElasticCrossSection( 5e-9 ),
+                                   1.2,
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( coherent_s_alpha_beta->getElasticCrossSection( 2e-8 ),
+                                   0.35,
+                                   1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the total cross section can be returned
+FRENSIE_UNIT_TEST( SAlphaBeta, getCrossSection )
+{
+  FRENSIE_CHECK_FLOATING_EQUALITY( equiprobable_s_alpha_beta->getCrossSection( 2e-8 ),
+                                   18.0,
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( skewed_s_alpha_beta->getCrossSection( 2e-8 ),
+                                   15.0,
+                                   1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that inelastic scattering can be sampled (equiprobable energies)
+FRENSIE_UNIT_TEST( SAlphaBeta, sampleInelasticScattering_equiprobable )
+{
+  std::vector<double> fake_stream( 4 );
+  fake_stream[0] = 0.5;
+  fake_stream[1] = 0.0;
+  fake_stream[2] = 0.0;
+  fake_stream[3] = 1.0-1e-15;
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  double outgoing_energy, scattering_angle_cosine;
+
+  equiprobable_s_alpha_beta->sampleInelasticScattering(
+                                                     2e-8,
+                                                     outgoing_energy,
+                                                     scattering_angle_cosine );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( outgoing_energy, 2e-8, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( scattering_angle_cosine, -0.3, 1e-12 );
+
+  equiprobable_s_alpha_beta->sampleInelasticScattering(
+                                                     2e-8,
+                                                     outgoing_energy,
+                                                     scattering_angle_cosine );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( outgoing_energy, 2e-9, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( scattering_angle_cosine, 0.4, 1e-12 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+}
+
+//---------------------------------------------------------------------------//
+// Check that inelastic scattering can be sampled (skewed energies)
+FRENSIE_UNIT_TEST( SAlphaBeta, sampleInelasticScattering_skewed )
+{
+  std::vector<double> fake_stream( 8 );
+  fake_stream[0] = 0.05; // first bin (prob = 0.1)
+  fake_stream[1] = 0.0;
+  fake_stream[2] = 0.45; // second bin (prob = 0.4)
+  fake_stream[3] = 0.0;
+  fake_stream[4] = 0.55; // third bin (prob = 0.4)
+  fake_stream[5] = 0.0;
+  fake_stream[6] = 0.95; // fourth bin (prob = 0.1)
+  fake_stream[7] = 0.0;
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  double outgoing_energy, scattering_angle_cosine;
+
+  skewed_s_alpha_beta->sampleInelasticScattering( 1e-8,
+                                                  outgoing_energy,
+                                                  scattering_angle_cosine );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( outgoing_energy, 1e-9, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( scattering_angle_cosine, -0.5, 1e-12 );
+
+  skewed_s_alpha_beta->sampleInelasticScattering( 1e-8,
+                                                  outgoing_energy,
+                                                  scattering_angle_cosine );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( outgoing_energy, 5e-9, 1e-12 );
+
+  skewed_s_alpha_beta->sampleInelasticScattering( 1e-8,
+                                                  outgoing_energy,
+                                                  scattering_angle_cosine );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( outgoing_energy, 1e-8, 1e-12 );
+
+  skewed_s_alpha_beta->sampleInelasticScattering( 1e-8,
+                                                  outgoing_energy,
+                                                  scattering_angle_cosine );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( outgoing_energy, 2e-8, 1e-12 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+}
+
+//---------------------------------------------------------------------------//
+// Check that incoherent elastic scattering can be sampled
+FRENSIE_UNIT_TEST( SAlphaBeta, sampleElasticScattering_incoherent )
+{
+  std::vector<double> fake_stream( 2 );
+  fake_stream[0] = 0.0;
+  fake_stream[1] = 1.0-1e-15;
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  double outgoing_energy, scattering_angle_cosine;
+
+  equiprobable_s_alpha_beta->sampleElasticScattering(
+                                                     2e-8,
+                                                     outgoing_energy,
+                                                     scattering_angle_cosine );
+
+  FRENSIE_CHECK_EQUAL( outgoing_energy, 2e-8 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( scattering_angle_cosine, -0.1, 1e-12 );
+
+  equiprobable_s_alpha_beta->sampleElasticScattering(
+                                                     2e-8,
+                                                     outgoing_energy,
+                                                     scattering_angle_cosine );
+
+  FRENSIE_CHECK_EQUAL( outgoing_energy, 2e-8 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( scattering_angle_cosine, 0.8, 1e-12 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+}
+
+//---------------------------------------------------------------------------//
+// Check that coherent elastic scattering can be sampled
+FRENSIE_UNIT_TEST( SAlphaBeta, sampleElasticScattering_coherent )
+{
+  std::vector<double> fake_stream( 3 );
+  fake_stream[0] = 0.2;
+  fake_stream[1] = 0.5;
+  fake_stream[2] = 0.9;
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  double outgoing_energy, scattering_angle_cosine;
+
+  coherent_s_alpha_beta->sampleElasticScattering( 2e-8,
+                                                  outgoing_energy,
+                                                  scattering_angle_cosine );
+
+  FRENSIE_CHECK_EQUAL( outgoing_energy, 2e-8 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( scattering_angle_cosine, 0.9, 1e-12 );
+
+  coherent_s_alpha_beta->sampleElasticScattering( 2e-8,
+                                                  outgoing_energy,
+                                                  scattering_angle_cosine );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( scattering_angle_cosine, 0.6, 1e-12 );
+
+  coherent_s_alpha_beta->sampleElasticScattering( 2e-8,
+                                                  outgoing_energy,
+                                                  scattering_angle_cosine );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( scattering_angle_cosine, 0.1, 1e-12 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+}
+
+//---------------------------------------------------------------------------//
+// Check that a neutron can be scattered
+FRENSIE_UNIT_TEST( SAlphaBeta, scatterParticle )
+{
+  std::vector<double> fake_stream( 7 );
+  fake_stream[0] = 0.1; // elastic (0.1*18 < 3)
+  fake_stream[1] = 0.0;
+  fake_stream[2] = 0.0;
+  fake_stream[3] = 0.5; // inelastic
+  fake_stream[4] = 0.5;
+  fake_stream[5] = 0.0;
+  fake_stream[6] = 0.0;
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  const double initial_direction[3] = {0.0, 0.0, 1.0};
+
+  MonteCarlo::NeutronState neutron( 0ull );
+  neutron.setDirection( initial_direction );
+  neutron.setEnergy( 2e-8 );
+
+  equiprobable_s_alpha_beta->scatterParticle( neutron, 2.53010e-8 );
+
+  FRENSIE_CHECK_EQUAL( neutron.getEnergy(), 2e-8 );
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                          Utility::calculateCosineOfAngleBetweenVectors(
+                                                      initial_direction,
+                                                      neutron.getDirection() ),
+                          -0.1,
+                          1e-12 );
+
+  neutron.setDirection( initial_direction );
+  neutron.setEnergy( 2e-8 );
+
+  equiprobable_s_alpha_beta->scatterParticle( neutron, 2.53010e-8 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( neutron.getEnergy(), 2e-8, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                          Utility::calculateCosineOfAngleBetweenVectors(
+                                                      initial_direction,
+                                                      neutron.getDirection() ),
+                          -0.3,
+                          1e-12 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+}
+
+//---------------------------------------------------------------------------//
+// Check that inconsistent table dimensions are detected
+FRENSIE_UNIT_TEST( SAlphaBeta, constructor_invalid_dimensions )
+{
+  std::vector<double> energy_grid( {1e-8, 3e-8} );
+  std::vector<double> cross_section( {10.0, 20.0} );
+
+  FRENSIE_CHECK_THROW( MonteCarlo::SAlphaBeta( 1.0,
+                                               energy_grid,
+                                               cross_section,
+                                               std::vector<double>( 7, 1e-8 ),
+                                               std::vector<double>( 14, 0.0 ),
+                                               false,
+                                               100 ),
+                       std::runtime_error );
+
+  FRENSIE_CHECK_THROW( MonteCarlo::SAlphaBeta( 1.0,
+                                               energy_grid,
+                                               cross_section,
+                                               std::vector<double>( 8, 1e-8 ),
+                                               std::vector<double>( 12, 0.0 ),
+                                               false,
+                                               100 ),
+                       std::runtime_error );
+
+  // At least four skewed outgoing energies are required
+  FRENSIE_CHECK_THROW( MonteCarlo::SAlphaBeta( 1.0,
+                                               energy_grid,
+                                               cross_section,
+                                               std::vector<double>( 6, 1e-8 ),
+                                               std::vector<double>( 12, 0.0 ),
+                                               true,
+                                               100 ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Custom Setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // Initialize the random number generator
+  Utility::RandomNumberGenerator::createStreams();
+
+  // Create the inelastic data
+  std::vector<double> inelastic_energy_grid( {1e-8, 3e-8} );
+  std::vector<double> inelastic_cross_section( {10.0, 20.0} );
+
+  std::vector<double> inelastic_outgoing_energies( {1e-9, 5e-9, 1e-8, 2e-8,
+                                                    3e-9, 1.5e-8, 3e-8, 6e-8} );
+
+  std::vector<double> inelastic_cosines( {-0.5, 0.5,
+                                          -0.5, 0.5,
+                                          -0.5, 0.5,
+                                          -0.5, 0.5,
+                                          -0.1, 0.3,
+                                          -0.1, 0.3,
+                                          -0.1, 0.3,
+                                          -0.1, 0.3} );
+
+  // Create the incoherent elastic data
+  std::vector<double> elastic_energy_grid( {1e-8, 3e-8} );
+  std::vector<double> elastic_cross_section( {2.0, 4.0} );
+  std::vector<double> elastic_cosines( {-0.2, 0.6,
+                                        0.0, 1.0} );
+
+  equiprobable_s_alpha_beta.reset( new MonteCarlo::SAlphaBeta(
+                                                 0.999167,
+                                                 inelastic_energy_grid,
+                                                 inelastic_cross_section,
+                                                 inelastic_outgoing_energies,
+                                                 inelastic_cosines,
+                                                 false,
+                                                 Data::INCOHERENT_ELASTIC_MODE,
+                                                 elastic_energy_grid,
+                                                 elastic_cross_section,
+                                                 elastic_cosines,
+                                                 100 ) );
+
+  skewed_s_alpha_beta.reset( new MonteCarlo::SAlphaBeta(
+                                                 0.999167,
+                                                 inelastic_energy_grid,
+                                                 inelastic_cross_section,
+                                                 inelastic_outgoing_energies,
+                                                 inelastic_cosines,
+                                                 true,
+                                                 100 ) );
+
+  // Create the coherent elastic data (Bragg edges and cumulative structure
+  // factors)
+  std::vector<double> bragg_edges( {1e-9, 4e-9, 9e-9} );
+  std::vector<double> structure_factors( {2e-9, 6e-9, 7e-9} );
+
+  coherent_s_alpha_beta.reset( new MonteCarlo::SAlphaBeta(
+                                                 11.8969,
+                                                 inelastic_energy_grid,
+                                                 inelastic_cross_section,
+                                                 inelastic_outgoing_energies,
+                                                 inelastic_cosines,
+                                                 false,
+                                                 Data::COHERENT_ELASTIC_MODE,
+                                                 bragg_edges,
+                                                 structure_factors,
+                                                 std::vector<double>(),
+                                                 100 ) );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstSAlphaBeta.cpp
+//---------------------------------------------------------------------------//
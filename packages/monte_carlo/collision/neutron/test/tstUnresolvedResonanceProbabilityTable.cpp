@@ -0,0 +1,195 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstUnresolvedResonanceProbabilityTable.cpp
+//! \author Alex Robinson
+//! \brief  Unresolved resonance probability table unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <cmath>
+
+// FRENSIE Includes
+#include "MonteCarlo_UnresolvedResonanceProbabilityTable.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+std::shared_ptr<const MonteCarlo::UnresolvedResonanceProbabilityTable>
+lin_lin_table, log_log_table;
+
+//---------------------------------------------------------------------------//
+// Tests
+//---------------------------------------------------------------------------//
+// Check that the band random number is cached until it is reset
+FRENSIE_UNIT_TEST( UnresolvedResonanceProbabilityTable, getBandRandomNumber )
+{
+  std::vector<double> fake_stream( 2 );
+  fake_stream[0] = 0.3;
+  fake_stream[1] = 0.9;
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  MonteCarlo::UnresolvedResonanceProbabilityTable::resetBandRandomNumber();
+
+  FRENSIE_CHECK_EQUAL( MonteCarlo::UnresolvedResonanceProbabilityTable::getBandRandomNumber(),
+                       0.3 );
+  FRENSIE_CHECK_EQUAL( MonteCarlo::UnresolvedResonanceProbabilityTable::getBandRandomNumber(),
+                       0.3 );
+
+  MonteCarlo::UnresolvedResonanceProbabilityTable::resetBandRandomNumber();
+
+  FRENSIE_CHECK_EQUAL( MonteCarlo::UnresolvedResonanceProbabilityTable::getBandRandomNumber(),
+                       0.9 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+
+  MonteCarlo::UnresolvedResonanceProbabilityTable::resetBandRandomNumber();
+}
+
+//---------------------------------------------------------------------------//
+// Check that the energy limits can be returned
+FRENSIE_UNIT_TEST( UnresolvedResonanceProbabilityTable, getEnergyLimits )
+{
+  FRENSIE_CHECK_EQUAL( lin_lin_table->getLowerEnergyLimit(), 1e-2 );
+  FRENSIE_CHECK_EQUAL( lin_lin_table->getUpperEnergyLimit(), 2e-2 );
+}
+
+//---------------------------------------------------------------------------//
+// Check if an energy is in the unresolved resonance range
+FRENSIE_UNIT_TEST( UnresolvedResonanceProbabilityTable, isEnergyWithinTable )
+{
+  FRENSIE_CHECK( !lin_lin_table->isEnergyWithinTable( 9e-3 ) );
+  FRENSIE_CHECK( lin_lin_table->isEnergyWithinTable( 1e-2 ) );
+  FRENSIE_CHECK( lin_lin_table->isEnergyWithinTable( 1.5e-2 ) );
+  FRENSIE_CHECK( lin_lin_table->isEnergyWithinTable( 2e-2 ) );
+  FRENSIE_CHECK( !lin_lin_table->isEnergyWithinTable( 2.1e-2 ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the table properties can be returned
+FRENSIE_UNIT_TEST( UnresolvedResonanceProbabilityTable, getProperties )
+{
+  FRENSIE_CHECK_EQUAL( lin_lin_table->getNumberOfBands(), 2 );
+  FRENSIE_CHECK( !lin_lin_table->isLogLogInterpolationUsed() );
+  FRENSIE_CHECK( log_log_table->isLogLogInterpolationUsed() );
+  FRENSIE_CHECK_EQUAL( lin_lin_table->getInelasticCompetitionFlag(), -1 );
+  FRENSIE_CHECK_EQUAL( lin_lin_table->getOtherAbsorptionFlag(), 0 );
+  FRENSIE_CHECK( !lin_lin_table->areCrossSectionFactors() );
+  FRENSIE_CHECK( log_log_table->areCrossSectionFactors() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the band values can be evaluated with lin-lin interpolation
+FRENSIE_UNIT_TEST( UnresolvedResonanceProbabilityTable, evaluate_lin_lin )
+{
+  double elastic, fission, capture;
+
+  // Band 0 at both table energies
+  lin_lin_table->evaluate( 1.5e-2, 0.2, elastic, fission, capture );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( elastic, 15.0, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( fission, 1.5, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( capture, 4.5, 1e-12 );
+
+  // Band 1 at the lower table energy, band 0 at the upper table energy
+  lin_lin_table->evaluate( 1.5e-2, 0.5, elastic, fission, capture );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( elastic, 20.0, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( fission, 2.0, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( capture, 6.0, 1e-12 );
+
+  // Band 1 at both table energies
+  lin_lin_table->evaluate( 1.5e-2, 0.7, elastic, fission, capture );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( elastic, 30.0, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( fission, 3.0, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( capture, 9.0, 1e-12 );
+
+  // The table energies
+  lin_lin_table->evaluate( 1e-2, 0.2, elastic, fission, capture );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( elastic, 10.0, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( fission, 1.0, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( capture, 3.0, 1e-12 );
+
+  lin_lin_table->evaluate( 2e-2, 0.2, elastic, fission, capture );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( elastic, 20.0, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( fission, 2.0, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( capture, 6.0, 1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the band values can be evaluated with log-log interpolation
+FRENSIE_UNIT_TEST( UnresolvedResonanceProbabilityTable, evaluate_log_log )
+{
+  double elastic, fission, capture;
+
+  log_log_table->evaluate( std::sqrt( 2e-4 ), 0.2, elastic, fission, capture );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( elastic, 10.0*std::sqrt( 2.0 ), 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( fission, std::sqrt( 2.0 ), 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( capture, 3.0*std::sqrt( 2.0 ), 1e-12 );
+
+  log_log_table->evaluate( std::sqrt( 2e-4 ), 0.7, elastic, fission, capture );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( elastic, 20.0*std::sqrt( 2.0 ), 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( fission, 2.0*std::sqrt( 2.0 ), 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( capture, 6.0*std::sqrt( 2.0 ), 1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Custom Setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  std::vector<double> energy_grid( {1e-2, 2e-2} );
+
+  // cdf, total, elastic, fission, capture, heating at each energy
+  std::vector<double> band_data( {0.4, 1.0,
+                                  14.0, 28.0,
+                                  10.0, 20.0,
+                                  1.0, 2.0,
+                                  3.0, 6.0,
+                                  0.0, 0.0,
+                                  0.6, 1.0,
+                                  28.0, 56.0,
+                                  20.0, 40.0,
+                                  2.0, 4.0,
+                                  6.0, 12.0,
+                                  0.0, 0.0} );
+
+  lin_lin_table.reset( new MonteCarlo::UnresolvedResonanceProbabilityTable(
+                                                                energy_grid,
+                                                                2,
+                                                                false,
+                                                                -1,
+                                                                0,
+                                                                false,
+                                                                band_data ) );
+
+  log_log_table.reset( new MonteCarlo::UnresolvedResonanceProbabilityTable(
+                                                                energy_grid,
+                                                                2,
+                                                                true,
+                                                                -1,
+                                                                0,
+                                                                true,
+                                                                band_data ) );
+
+  // Initialize the random number generator
+  Utility::RandomNumberGenerator::createStreams();
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstUnresolvedResonanceProbabilityTable.cpp
+//---------------------------------------------------------------------------//
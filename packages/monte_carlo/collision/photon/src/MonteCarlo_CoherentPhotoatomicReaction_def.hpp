@@ -111,6 +111,25 @@ void CoherentPhotoatomicReaction<InterpPolicy,processed_cross_section>::react(
   shell_of_interaction =Data::UNKNOWN_SUBSHELL;
 }
 
+// Evaluate the differential cross section (b) of the outgoing photon
+/*! \details Coherent scattering does not change the photon energy.
+ */
+template<typename InterpPolicy, bool processed_cross_section>
+double CoherentPhotoatomicReaction<InterpPolicy,processed_cross_section>::evaluateDifferentialCrossSection(
+                                       const double incoming_energy,
+                                       const double scattering_angle_cosine,
+                                       double& outgoing_energy ) const
+{
+  // Make sure the scattering angle cosine is valid
+  testPrecondition( scattering_angle_cosine >= -1.0 );
+  testPrecondition( scattering_angle_cosine <= 1.0 );
+
+  outgoing_energy = incoming_energy;
+
+  return d_scattering_distribution->evaluate( incoming_energy,
+                                              scattering_angle_cosine );
+}
+
 EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( CoherentPhotoatomicReaction<Utility::LinLin,false> );
 EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( CoherentPhotoatomicReaction<Utility::LinLin,true> );
 
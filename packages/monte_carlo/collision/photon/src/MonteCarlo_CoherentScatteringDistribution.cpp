@@ -25,7 +25,8 @@ CoherentScatteringDistribution::CoherentScatteringDistribution(
                                 const std::shared_ptr<const FormFactorSquared>&
                                 form_factor_function_squared )
   : PhotonScatteringDistribution(),
-    d_form_factor_function_squared( form_factor_function_squared )
+    d_form_factor_function_squared( form_factor_function_squared ),
+    d_scattering_angle_sampling_table()
 {
   // Make sure the form factor squared is valid
   testPrecondition( form_factor_function_squared.get() );
@@ -114,7 +115,8 @@ void CoherentScatteringDistribution::sample(
   Counter trial_dummy;
 
   // Sample an outgoing direction
-  this->sampleAndRecordTrialsImpl( incoming_energy,
+  this->sampleScatteringAngleCosineAndRecordTrials(
+                                   incoming_energy,
 				   scattering_angle_cosine,
 				   trial_dummy );
 }
@@ -130,7 +132,8 @@ void CoherentScatteringDistribution::sampleAndRecordTrials(
   outgoing_energy = incoming_energy;
 
   // Sample an outgoing direction
-  this->sampleAndRecordTrialsImpl( incoming_energy,
+  this->sampleScatteringAngleCosineAndRecordTrials(
+                                   incoming_energy,
 				   scattering_angle_cosine,
 				   trials );
 }
@@ -146,7 +149,8 @@ void CoherentScatteringDistribution::scatterPhoton(
   Counter trial_dummy;
 
   // Sample an outgoing direction
-  this->sampleAndRecordTrialsImpl( photon.getEnergy(),
+  this->sampleScatteringAngleCosineAndRecordTrials(
+                                   photon.getEnergy(),
 				   scattering_angle_cosine,
 				   trial_dummy );
 
@@ -168,7 +172,8 @@ void CoherentScatteringDistribution::scatterAdjointPhoton(
   Counter trial_dummy;
 
   // Sample an outgoing direction
-  this->sampleAndRecordTrialsImpl( adjoint_photon.getEnergy(),
+  this->sampleScatteringAngleCosineAndRecordTrials(
+                                   adjoint_photon.getEnergy(),
 				   scattering_angle_cosine,
 				   trial_dummy );
 
@@ -238,6 +243,53 @@ void CoherentScatteringDistribution::sampleAndRecordTrialsBasicImpl(
   testPostcondition( scattering_angle_cosine <= 1.0 );
 }
 
+// Create the scattering angle sampling table (direct sampling)
+/*! \details The scattering angle cosine will be sampled directly from the
+ * table at energies that are covered by the energy grid. The convergence
+ * tolerance controls the interpolation error of the tabulated distributions.
+ */
+void CoherentScatteringDistribution::createScatteringAngleSamplingTable(
+                                       const std::vector<double>& energy_grid,
+                                       const double convergence_tolerance )
+{
+  d_scattering_angle_sampling_table.reset(
+              new PhotonScatteringAngleSamplingTable(
+                       energy_grid,
+                       std::bind<double>( &CoherentScatteringDistribution::evaluate,
+                                          std::cref( *this ),
+                                          std::placeholders::_1,
+                                          std::placeholders::_2 ),
+                       convergence_tolerance ) );
+}
+
+// Check if a scattering angle sampling table has been created
+bool CoherentScatteringDistribution::hasScatteringAngleSamplingTable() const
+{
+  return d_scattering_angle_sampling_table.get() != NULL;
+}
+
+// Sample an outgoing direction using the table if possible
+void CoherentScatteringDistribution::sampleScatteringAngleCosineAndRecordTrials(
+                                         const double incoming_energy,
+                                         double& scattering_angle_cosine,
+                                         Counter& trials ) const
+{
+  if( d_scattering_angle_sampling_table &&
+      d_scattering_angle_sampling_table->isEnergyWithinTable( incoming_energy ) )
+  {
+    ++trials;
+
+    scattering_angle_cosine =
+      d_scattering_angle_sampling_table->sample( incoming_energy );
+  }
+  else
+  {
+    this->sampleAndRecordTrialsImpl( incoming_energy,
+                                     scattering_angle_cosine,
+                                     trials );
+  }
+}
+
 //! Return the form factor squared distribution
 const FormFactorSquared&
 CoherentScatteringDistribution::getFormFactorSquaredDistribution() const
@@ -16,11 +16,17 @@
 #include "MonteCarlo_PhotonScatteringDistribution.hpp"
 #include "MonteCarlo_AdjointPhotonScatteringDistribution.hpp"
 #include "MonteCarlo_FormFactorSquared.hpp"
+#include "MonteCarlo_PhotonScatteringAngleSamplingTable.hpp"
 #include "Utility_Tuple.hpp"
 
 namespace MonteCarlo{
 
-//! The coherent scattering distribution class
+/*! The coherent scattering distribution class
+ * \details A scattering angle sampling table can optionally be created so
+ * that the scattering angle cosine can be sampled directly (instead of with
+ * the rejection sampling implementation of the derived class) at energies
+ * that are covered by the table.
+ */
 class CoherentScatteringDistribution : public PhotonScatteringDistribution,
 				       public AdjointPhotonScatteringDistribution
 
@@ -73,6 +79,14 @@ public:
 			     ParticleBank& bank,
 			     Data::SubshellType& shell_of_interaction ) const override;
 
+  //! Create the scattering angle sampling table (direct sampling)
+  void createScatteringAngleSamplingTable(
+                                     const std::vector<double>& energy_grid,
+                                     const double convergence_tolerance = 1e-3 );
+
+  //! Check if a scattering angle sampling table has been created
+  bool hasScatteringAngleSamplingTable() const;
+
 protected:
 
   //! Sample an outgoing direction from the distribution
@@ -96,9 +110,19 @@ protected:
 
 private:
 
+  // Sample an outgoing direction using the table if possible
+  void sampleScatteringAngleCosineAndRecordTrials(
+                                         const double incoming_energy,
+                                         double& scattering_angle_cosine,
+                                         Counter& trials ) const;
+
   // The coherent form factor function squared
   std::shared_ptr<const FormFactorSquared>
   d_form_factor_function_squared;
+
+  // The scattering angle sampling table
+  std::shared_ptr<const PhotonScatteringAngleSamplingTable>
+  d_scattering_angle_sampling_table;
 };
 
 } // end MonteCarlo namespace
@@ -6,6 +6,10 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Std Lib Includes
+#include <algorithm>
+#include <cmath>
+
 // FRENSIE Includes
 #include "MonteCarlo_CoherentScatteringDistributionACEFactory.hpp"
 #include "MonteCarlo_ThompsonScatteringDistribution.hpp"
@@ -38,11 +42,20 @@ void CoherentScatteringDistributionACEFactory::createBasicCoherentDistribution(
 }
 
 // Create an efficient coherent distribution
+/*! \details If the scattering angle table tolerance is greater than zero,
+ * a scattering angle sampling table will be created on the photon energy
+ * grid so that the scattering angle cosine can be sampled directly.
+ */
 void CoherentScatteringDistributionACEFactory::createEfficientCoherentDistribution(
 			   const Data::XSSEPRDataExtractor& raw_photoatom_data,
 			   std::shared_ptr<const CoherentScatteringDistribution>&
-			   coherent_distribution )
+			   coherent_distribution,
+                           const double scattering_angle_table_tol )
 {
+  // Make sure the tolerance is valid
+  testPrecondition( scattering_angle_table_tol >= 0.0 );
+  testPrecondition( scattering_angle_table_tol <= 1.0 );
+
   // Create the form factor squared
   std::shared_ptr<const FormFactorSquared> form_factor_squared;
 
@@ -50,8 +63,27 @@ void CoherentScatteringDistributionACEFactory::createEfficientCoherentDistributi
 							 raw_photoatom_data,
 							 form_factor_squared );
 
-  coherent_distribution.reset(
-	  new EfficientCoherentScatteringDistribution( form_factor_squared ) );
+  std::shared_ptr<EfficientCoherentScatteringDistribution> distribution(
+          new EfficientCoherentScatteringDistribution( form_factor_squared ) );
+
+  if( scattering_angle_table_tol > 0.0 )
+  {
+    // The ACE photon energy grid stores ln(E)
+    std::vector<double> energy_grid(
+                        raw_photoatom_data.extractPhotonEnergyGrid().begin(),
+                        raw_photoatom_data.extractPhotonEnergyGrid().end() );
+
+    std::transform( energy_grid.begin(),
+                    energy_grid.end(),
+                    energy_grid.begin(),
+                    []( const double log_energy ){ return std::exp( log_energy ); } );
+
+    distribution->createScatteringAngleSamplingTable(
+                                                  energy_grid,
+                                                  scattering_angle_table_tol );
+  }
+
+  coherent_distribution = distribution;
 }
 
 // Create the form factor distribution
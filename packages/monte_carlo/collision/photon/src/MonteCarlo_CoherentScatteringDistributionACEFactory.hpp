@@ -35,7 +35,8 @@ public:
   static void createEfficientCoherentDistribution(
 			 const Data::XSSEPRDataExtractor& raw_photoatom_data,
 			 std::shared_ptr<const CoherentScatteringDistribution>&
-                         coherent_distribution );
+                         coherent_distribution,
+                         const double scattering_angle_table_tol = 0.0 );
 
 protected:
 
@@ -0,0 +1,54 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_CoherentScatteringDistributionNativeFactory.cpp
+//! \author Alex Robinson
+//! \brief  The coherent scattering distribution native factory definition
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "MonteCarlo_CoherentScatteringDistributionNativeFactory.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Create an efficient coherent distribution with an angle sampling table
+/*! \details If the scattering angle table tolerance is greater than zero,
+ * a scattering angle sampling table will be created on the photon energy
+ * grid so that the scattering angle cosine can be sampled directly.
+ */
+void CoherentScatteringDistributionNativeFactory::createEfficientCoherentDistribution(
+          const Data::ElectronPhotonRelaxationDataContainer& raw_photoatom_data,
+          std::shared_ptr<const CoherentScatteringDistribution>&
+          coherent_distribution,
+          const double scattering_angle_table_tol )
+{
+  // Make sure the tolerance is valid
+  testPrecondition( scattering_angle_table_tol >= 0.0 );
+  testPrecondition( scattering_angle_table_tol <= 1.0 );
+
+  // Create the form factor squared
+  std::shared_ptr<const FormFactorSquared> form_factor_squared;
+
+  CoherentScatteringDistributionNativeFactory::createFormFactorSquared(
+							 raw_photoatom_data,
+							 form_factor_squared );
+
+  std::shared_ptr<EfficientCoherentScatteringDistribution> distribution(
+          new EfficientCoherentScatteringDistribution( form_factor_squared ) );
+
+  if( scattering_angle_table_tol > 0.0 )
+  {
+    distribution->createScatteringAngleSamplingTable(
+                                      raw_photoatom_data.getPhotonEnergyGrid(),
+                                      scattering_angle_table_tol );
+  }
+
+  coherent_distribution = distribution;
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_CoherentScatteringDistributionNativeFactory.cpp
+//---------------------------------------------------------------------------//
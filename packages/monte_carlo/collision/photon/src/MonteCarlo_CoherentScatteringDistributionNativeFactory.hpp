@@ -38,6 +38,13 @@ public:
                                 SmartPtr<const CoherentScatteringDistribution>&
                                 coherent_distribution );
 
+  //! Create an efficient coherent distribution with an angle sampling table
+  static void createEfficientCoherentDistribution(
+          const Data::ElectronPhotonRelaxationDataContainer& raw_photoatom_data,
+          std::shared_ptr<const CoherentScatteringDistribution>&
+          coherent_distribution,
+          const double scattering_angle_table_tol );
+
 protected:
 
   //! Create the form factor squared distribution
@@ -45,15 +45,23 @@ protected:
   //! Return the binding energy of a subshell
   double getSubshellBindingEnergy( const Data::SubshellType subshell ) const;
 
-  //! Sample an interaction subshell
-  void sampleInteractionSubshell( size_t& old_subshell_index,
+  //! Sample an interaction subshell where an interaction is possible
+  void sampleInteractionSubshell( const double incoming_energy,
+                                  size_t& old_subshell_index,
                                   double& subshell_binding_energy,
                                   Data::SubshellType& subshell ) const override;
 
 private:
 
+  // The base type
+  typedef StandardCompleteDopplerBroadenedPhotonEnergyDistribution<ComptonProfilePolicy> BaseType;
+
   // The endf subshell binding energies
   std::vector<double> d_subshell_binding_energies;
+
+  // The binding energy truncated endf subshell occupancy distributions
+  typename BaseType::TruncatedOccupancyDistributions
+  d_truncated_subshell_occupancy_distributions;
 };
 
 } // end MonteCarlo namespace
@@ -33,7 +33,8 @@ CoupledStandardCompleteDopplerBroadenedPhotonEnergyDistribution<ComptonProfilePo
                                                 subshell_order,
                                                 subshell_converter,
                                                 compton_profile_array ),
-    d_subshell_binding_energies( subshell_binding_energies )
+    d_subshell_binding_energies( subshell_binding_energies ),
+    d_truncated_subshell_occupancy_distributions()
 {
   // Make sure the shell interaction data is valid
   testPrecondition( subshell_occupancies.size() > 0 );
@@ -41,6 +42,12 @@ CoupledStandardCompleteDopplerBroadenedPhotonEnergyDistribution<ComptonProfilePo
 		    subshell_occupancies.size() );
   testPrecondition( subshell_binding_energies.size() ==
 		    subshell_occupancies.size() );
+
+  // Create the binding energy truncated subshell occupancy distributions
+  BaseType::createTruncatedOccupancyDistributions(
+                               subshell_binding_energies,
+                               subshell_occupancies,
+                               d_truncated_subshell_occupancy_distributions );
 }
 
 // Return the binding energy of a subshell
@@ -56,19 +63,25 @@ double CoupledStandardCompleteDopplerBroadenedPhotonEnergyDistribution<ComptonPr
   return d_subshell_binding_energies[endf_subshell_index];
 }
 
-// Sample an interaction subshell
+// Sample an interaction subshell where an interaction is possible
 /*! \details The old subshell index used to select the Compton profile and
  * and the binding energy is the same as the subshell (i.e. they are coupled).
  */
 template<typename ComptonProfilePolicy>
 void CoupledStandardCompleteDopplerBroadenedPhotonEnergyDistribution<ComptonProfilePolicy>::sampleInteractionSubshell(
+                                               const double incoming_energy,
                                                size_t& old_subshell_index,
                                                double& subshell_binding_energy,
                                                Data::SubshellType& subshell ) const
 {
-  subshell = this->sampleENDFInteractionSubshell();
+  const size_t endf_subshell_index =
+    BaseType::sampleTruncatedOccupancyDistribution(
+                               incoming_energy,
+                               d_truncated_subshell_occupancy_distributions );
+
+  subshell = this->getSubshell( endf_subshell_index );
 
-  subshell_binding_energy = this->getSubshellBindingEnergy( subshell );
+  subshell_binding_energy = d_subshell_binding_energies[endf_subshell_index];
 
   old_subshell_index = this->getOldSubshellIndex( subshell );
 }
@@ -73,19 +73,19 @@ public:
 
 protected:
 
-  //! Sample an interaction subshell
-  void sampleInteractionSubshell( size_t& old_subshell_index,
+  //! Sample an interaction subshell where an interaction is possible
+  void sampleInteractionSubshell( const double incoming_energy,
+                                  size_t& old_subshell_index,
                                   double& subshell_binding_energy,
                                   Data::SubshellType& subshell ) const override;
 
 private:
 
-  // Sample the old subshell that is interacted with
-  size_t sampleOldInteractionSubshell() const;
+  // The base type
+  typedef StandardCompleteDopplerBroadenedPhotonEnergyDistribution<ComptonProfilePolicy> BaseType;
 
-  // The old subshell interaction probabilities
-  std::unique_ptr<const Utility::TabularUnivariateDistribution>
-  d_old_subshell_occupancy_distribution;
+  // Sample the old subshell that is interacted with
+  size_t sampleOldInteractionSubshell( const double incoming_energy ) const;
 
   // The old subshell binding energies
   std::vector<double> d_old_subshell_binding_energy;
@@ -95,6 +95,10 @@ private:
 
   // The index of the minimum binding energy
   unsigned d_min_binding_energy_index;
+
+  // The binding energy truncated old subshell occupancy distributions
+  typename BaseType::TruncatedOccupancyDistributions
+  d_truncated_old_subshell_occupancy_distributions;
 };
 
 } // end MonteCarlo namespace
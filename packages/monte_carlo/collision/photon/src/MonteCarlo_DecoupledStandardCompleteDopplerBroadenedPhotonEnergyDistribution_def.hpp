@@ -46,10 +46,10 @@ DecoupledStandardCompleteDopplerBroadenedPhotonEnergyDistribution<ComptonProfile
                                                      endf_subshell_order,
                                                      subshell_converter,
                                                      compton_profile_array ),
-  d_old_subshell_occupancy_distribution(),
   d_old_subshell_binding_energy( old_subshell_binding_energies ),
   d_old_subshell_occupancies( old_subshell_occupancies ),
-  d_min_binding_energy_index( 0 )
+  d_min_binding_energy_index( 0 ),
+  d_truncated_old_subshell_occupancy_distributions()
 {
   // Make sure the old shell data is valid
   testPrecondition( old_subshell_binding_energies.size() > 0 );
@@ -59,13 +59,6 @@ DecoupledStandardCompleteDopplerBroadenedPhotonEnergyDistribution<ComptonProfile
   testPrecondition( compton_profile_array.size() ==
 		    old_subshell_binding_energies.size() );
 
-  // Create the old subshell interaction distribution
-  std::vector<double> dummy_indep_vals( old_subshell_occupancies.size() );
-
-  d_old_subshell_occupancy_distribution.reset(
-	       new Utility::DiscreteDistribution( dummy_indep_vals,
-					          old_subshell_occupancies ) );
-
   // Calculate the min binding energy index
   std::vector<double>::iterator min_binding_energy_it =
     std::min_element( d_old_subshell_binding_energy.begin(),
@@ -74,6 +67,12 @@ DecoupledStandardCompleteDopplerBroadenedPhotonEnergyDistribution<ComptonProfile
   d_min_binding_energy_index =
     std::distance( d_old_subshell_binding_energy.begin(),
                    min_binding_energy_it );
+
+  // Create the binding energy truncated old subshell occupancy distributions
+  BaseType::createTruncatedOccupancyDistributions(
+                           old_subshell_binding_energies,
+                           old_subshell_occupancies,
+                           d_truncated_old_subshell_occupancy_distributions );
 }
 
 // Return the binding energy of a subshell
@@ -363,18 +362,20 @@ double DecoupledStandardCompleteDopplerBroadenedPhotonEnergyDistribution<Compton
   return diff_cs;
 }
 
-// Sample an interaction subshell
+// Sample an interaction subshell where an interaction is possible
 /*! \details The old subshell index used to select the Compton profile and
  * and the binding energy is not the same as the subshell (each are sampled
- * separately - i.e. they are decoupled).
+ * separately - i.e. they are decoupled). Only the old subshells where an
+ * interaction is possible can be sampled.
  */
 template<typename ComptonProfilePolicy>
 void DecoupledStandardCompleteDopplerBroadenedPhotonEnergyDistribution<ComptonProfilePolicy>::sampleInteractionSubshell(
+                                           const double incoming_energy,
                                            size_t& old_subshell_index,
                                            double& subshell_binding_energy,
                                            Data::SubshellType& subshell ) const
 {
-  old_subshell_index = this->sampleOldInteractionSubshell();
+  old_subshell_index = this->sampleOldInteractionSubshell( incoming_energy );
 
   subshell_binding_energy = d_old_subshell_binding_energy[old_subshell_index];
 
@@ -383,14 +384,12 @@ void DecoupledStandardCompleteDopplerBroadenedPhotonEnergyDistribution<ComptonPr
 
 // Sample the old subshell that is interacted with
 template<typename ComptonProfilePolicy>
-size_t DecoupledStandardCompleteDopplerBroadenedPhotonEnergyDistribution<ComptonProfilePolicy>::sampleOldInteractionSubshell() const
+size_t DecoupledStandardCompleteDopplerBroadenedPhotonEnergyDistribution<ComptonProfilePolicy>::sampleOldInteractionSubshell(
+                                          const double incoming_energy ) const
 {
-  size_t old_subshell_of_interaction;
-
-  d_old_subshell_occupancy_distribution->sampleAndRecordBinIndex(
-                                                 old_subshell_of_interaction );
-
-  return old_subshell_of_interaction;
+  return BaseType::sampleTruncatedOccupancyDistribution(
+                           incoming_energy,
+                           d_truncated_old_subshell_occupancy_distributions );
 }
 
 EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( DecoupledStandardCompleteDopplerBroadenedPhotonEnergyDistribution<FullComptonProfilePolicy> );
@@ -67,6 +67,12 @@ public:
 	      ParticleBank& bank,
 	      Data::SubshellType& shell_of_interaction ) const override;
 
+  //! Evaluate the differential cross section (b) of the outgoing photon
+  double evaluateDifferentialCrossSection(
+                              const double incoming_energy,
+                              const double scattering_angle_cosine,
+                              double& outgoing_energy ) const override;
+
 private:
 
   // The incoherent scattering distribution
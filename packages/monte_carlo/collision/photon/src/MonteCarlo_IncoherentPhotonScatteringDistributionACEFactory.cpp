@@ -6,6 +6,10 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Std Lib Includes
+#include <algorithm>
+#include <cmath>
+
 // FRENSIE Includes
 #include "MonteCarlo_IncoherentPhotonScatteringDistributionACEFactory.hpp"
 #include "MonteCarlo_DopplerBroadenedPhotonEnergyDistributionACEFactory.hpp"
@@ -25,12 +29,18 @@
 namespace MonteCarlo{
 
 // Create the requested incoherent distribution
+/*! \details If the scattering angle table tolerance is greater than zero,
+ * the Waller-Hartree and Doppler broadened hybrid distributions will create
+ * a scattering angle sampling table on the photon energy grid. The tolerance
+ * is ignored by the other incoherent models.
+ */
 void IncoherentPhotonScatteringDistributionACEFactory::createDistribution(
 		    const Data::XSSEPRDataExtractor& raw_photoatom_data,
 		    std::shared_ptr<const IncoherentPhotonScatteringDistribution>&
 		    incoherent_distribution,
 		    const IncoherentModelType incoherent_model,
-		    const double kahn_sampling_cutoff_energy )
+		    const double kahn_sampling_cutoff_energy,
+                    const double scattering_angle_table_tol )
 {
   // Make sure the cutoff energy is valid
   TEST_FOR_EXCEPTION( kahn_sampling_cutoff_energy <
@@ -53,7 +63,8 @@ void IncoherentPhotonScatteringDistributionACEFactory::createDistribution(
       IncoherentPhotonScatteringDistributionACEFactory::createWallerHartreeDistribution(
 						 raw_photoatom_data,
 						 incoherent_distribution,
-						 kahn_sampling_cutoff_energy );
+						 kahn_sampling_cutoff_energy,
+						 scattering_angle_table_tol );
       break;
     }
     case DECOUPLED_HALF_PROFILE_DB_HYBRID_INCOHERENT_MODEL:
@@ -70,7 +81,8 @@ void IncoherentPhotonScatteringDistributionACEFactory::createDistribution(
 						 raw_photoatom_data,
 						 doppler_broadened_dist,
 						 incoherent_distribution,
-						 kahn_sampling_cutoff_energy );
+						 kahn_sampling_cutoff_energy,
+						 scattering_angle_table_tol );
       break;
     }
     case DECOUPLED_FULL_PROFILE_DB_HYBRID_INCOHERENT_MODEL:
@@ -87,7 +99,8 @@ void IncoherentPhotonScatteringDistributionACEFactory::createDistribution(
 						 raw_photoatom_data,
 						 doppler_broadened_dist,
 						 incoherent_distribution,
-						 kahn_sampling_cutoff_energy );
+						 kahn_sampling_cutoff_energy,
+						 scattering_angle_table_tol );
       break;
     }
     case COUPLED_HALF_PROFILE_DB_HYBRID_INCOHERENT_MODEL:
@@ -104,7 +117,8 @@ void IncoherentPhotonScatteringDistributionACEFactory::createDistribution(
 						 raw_photoatom_data,
 						 doppler_broadened_dist,
 						 incoherent_distribution,
-						 kahn_sampling_cutoff_energy );
+						 kahn_sampling_cutoff_energy,
+						 scattering_angle_table_tol );
       break;
     }
     case COUPLED_FULL_PROFILE_DB_HYBRID_INCOHERENT_MODEL:
@@ -121,7 +135,8 @@ void IncoherentPhotonScatteringDistributionACEFactory::createDistribution(
 						 raw_photoatom_data,
 						 doppler_broadened_dist,
 						 incoherent_distribution,
-						 kahn_sampling_cutoff_energy );
+						 kahn_sampling_cutoff_energy,
+						 scattering_angle_table_tol );
       break;
     }
     default:
@@ -138,7 +153,8 @@ void IncoherentPhotonScatteringDistributionACEFactory::createWallerHartreeDistri
 		    const Data::XSSEPRDataExtractor& raw_photoatom_data,
 		    std::shared_ptr<const IncoherentPhotonScatteringDistribution>&
 		    incoherent_distribution,
-		    const double kahn_sampling_cutoff_energy )
+		    const double kahn_sampling_cutoff_energy,
+                    const double scattering_angle_table_tol )
 {
   // Make sure the cutoff energy is valid
   testPrecondition( kahn_sampling_cutoff_energy >=
@@ -163,12 +179,19 @@ void IncoherentPhotonScatteringDistributionACEFactory::createWallerHartreeDistri
 							    raw_photoatom_data,
 							    subshell_order );
 
-  incoherent_distribution.reset(
+  std::shared_ptr<WHIncoherentPhotonScatteringDistribution> distribution(
 			 new DetailedWHIncoherentPhotonScatteringDistribution(
 			   scattering_function,
 			   subshell_occupancies,
 			   subshell_order,
 			   kahn_sampling_cutoff_energy ) );
+
+  IncoherentPhotonScatteringDistributionACEFactory::createScatteringAngleSamplingTable(
+                                                  raw_photoatom_data,
+                                                  scattering_angle_table_tol,
+                                                  *distribution );
+
+  incoherent_distribution = distribution;
 }
 
 // Create a Doppler broadened hybrid incoherent distribution
@@ -178,7 +201,8 @@ void IncoherentPhotonScatteringDistributionACEFactory::createDopplerBroadenedHyb
  doppler_broadened_dist,
  std::shared_ptr<const IncoherentPhotonScatteringDistribution>&
  incoherent_distribution,
- const double kahn_sampling_cutoff_energy )
+ const double kahn_sampling_cutoff_energy,
+ const double scattering_angle_table_tol )
 {
   // Make sure the Doppler broadened distribution is valid
   testPrecondition( doppler_broadened_dist.get() );
@@ -193,11 +217,49 @@ void IncoherentPhotonScatteringDistributionACEFactory::createDopplerBroadenedHyb
 							 raw_photoatom_data,
 							 scattering_function );
 
-  incoherent_distribution.reset(
+  std::shared_ptr<WHIncoherentPhotonScatteringDistribution> distribution(
 	      new DopplerBroadenedHybridIncoherentPhotonScatteringDistribution(
 					       scattering_function,
 					       doppler_broadened_dist,
 					       kahn_sampling_cutoff_energy ) );
+
+  IncoherentPhotonScatteringDistributionACEFactory::createScatteringAngleSamplingTable(
+                                                  raw_photoatom_data,
+                                                  scattering_angle_table_tol,
+                                                  *distribution );
+
+  incoherent_distribution = distribution;
+}
+
+// Create the scattering angle sampling table of a Waller-Hartree dist.
+/*! \details The table will only be created if the tolerance is greater than
+ * zero. The table will be created on the photon energy grid (the ACE grid
+ * stores ln(E)).
+ */
+void IncoherentPhotonScatteringDistributionACEFactory::createScatteringAngleSamplingTable(
+               const Data::XSSEPRDataExtractor& raw_photoatom_data,
+               const double scattering_angle_table_tol,
+               WHIncoherentPhotonScatteringDistribution& distribution )
+{
+  // Make sure the tolerance is valid
+  testPrecondition( scattering_angle_table_tol >= 0.0 );
+  testPrecondition( scattering_angle_table_tol <= 1.0 );
+
+  if( scattering_angle_table_tol > 0.0 )
+  {
+    std::vector<double> energy_grid(
+                        raw_photoatom_data.extractPhotonEnergyGrid().begin(),
+                        raw_photoatom_data.extractPhotonEnergyGrid().end() );
+
+    std::transform( energy_grid.begin(),
+                    energy_grid.end(),
+                    energy_grid.begin(),
+                    []( const double log_energy ){ return std::exp( log_energy ); } );
+
+    distribution.createScatteringAngleSamplingTable(
+                                                  energy_grid,
+                                                  scattering_angle_table_tol );
+  }
 }
 
 // Create the scattering function
@@ -15,6 +15,7 @@
 // FRENSIE Includes
 #include "MonteCarlo_IncoherentPhotonScatteringDistribution.hpp"
 #include "MonteCarlo_IncoherentPhotonScatteringDistributionFactory.hpp"
+#include "MonteCarlo_WHIncoherentPhotonScatteringDistribution.hpp"
 #include "MonteCarlo_CompleteDopplerBroadenedPhotonEnergyDistribution.hpp"
 #include "MonteCarlo_ScatteringFunction.hpp"
 #include "MonteCarlo_IncoherentModelType.hpp"
@@ -38,7 +39,8 @@ public:
 		 std::shared_ptr<const IncoherentPhotonScatteringDistribution>&
                  incoherent_distribution,
                  const IncoherentModelType incoherent_model,
-                 const double kahn_sampling_cutoff_energy );
+                 const double kahn_sampling_cutoff_energy,
+                 const double scattering_angle_table_tol = 0.0 );
 
 protected:
 
@@ -47,7 +49,8 @@ protected:
 		 const Data::XSSEPRDataExtractor& raw_photoatom_data,
 		 std::shared_ptr<const IncoherentPhotonScatteringDistribution>&
                  incoherent_distribution,
-                 const double kahn_sampling_cutoff_energy );
+                 const double kahn_sampling_cutoff_energy,
+                 const double scattering_angle_table_tol = 0.0 );
 
   //! Create a Doppler broadened hybrid incoherent distribution
   static void createDopplerBroadenedHybridDistribution(
@@ -56,10 +59,17 @@ protected:
     doppler_broadened_dist,
     std::shared_ptr<const IncoherentPhotonScatteringDistribution>&
     incoherent_distribution,
-    const double kahn_sampling_cutoff_energy );
+    const double kahn_sampling_cutoff_energy,
+    const double scattering_angle_table_tol = 0.0 );
 
 private:
 
+  // Create the scattering angle sampling table of a Waller-Hartree dist.
+  static void createScatteringAngleSamplingTable(
+               const Data::XSSEPRDataExtractor& raw_photoatom_data,
+               const double scattering_angle_table_tol,
+               WHIncoherentPhotonScatteringDistribution& distribution );
+
   //! Create the scattering function
   static void createScatteringFunction(
 	  const Data::XSSEPRDataExtractor& raw_photoatom_data,
@@ -26,13 +26,19 @@
 namespace MonteCarlo{
 
 // Create an incoherent distribution
+/*! \details If the scattering angle table tolerance is greater than zero,
+ * the Waller-Hartree and Doppler broadened hybrid distributions will create
+ * a scattering angle sampling table on the photon energy grid. The tolerance
+ * is ignored by the other incoherent models.
+ */
 void IncoherentPhotonScatteringDistributionNativeFactory::createDistribution(
 	 const Data::ElectronPhotonRelaxationDataContainer& raw_photoatom_data,
 	 std::shared_ptr<const IncoherentPhotonScatteringDistribution>&
 	 incoherent_distribution,
 	 const IncoherentModelType incoherent_model,
 	 const double kahn_sampling_cutoff_energy,
-	 const unsigned endf_subshell )
+	 const unsigned endf_subshell,
+	 const double scattering_angle_table_tol )
 {
   // Make sure the cutoff energy is valid
   testPrecondition( kahn_sampling_cutoff_energy >=
@@ -52,7 +58,8 @@ void IncoherentPhotonScatteringDistributionNativeFactory::createDistribution(
       IncoherentPhotonScatteringDistributionNativeFactory::createWallerHartreeDistribution(
 						 raw_photoatom_data,
 						 incoherent_distribution,
-						 kahn_sampling_cutoff_energy );
+						 kahn_sampling_cutoff_energy,
+						 scattering_angle_table_tol );
       break;
     }
     case COUPLED_FULL_PROFILE_DB_HYBRID_INCOHERENT_MODEL:
@@ -68,7 +75,8 @@ void IncoherentPhotonScatteringDistributionNativeFactory::createDistribution(
 						 raw_photoatom_data,
 						 doppler_broadened_dist,
 						 incoherent_distribution,
-						 kahn_sampling_cutoff_energy );
+						 kahn_sampling_cutoff_energy,
+						 scattering_angle_table_tol );
       break;
     }
     case IMPULSE_INCOHERENT_MODEL:
@@ -112,11 +120,15 @@ void IncoherentPhotonScatteringDistributionNativeFactory::createWallerHartreeDis
 	 const Data::ElectronPhotonRelaxationDataContainer& raw_photoatom_data,
 	 std::shared_ptr<const IncoherentPhotonScatteringDistribution>&
 	 incoherent_distribution,
-	 const double kahn_sampling_cutoff_energy )
+	 const double kahn_sampling_cutoff_energy,
+	 const double scattering_angle_table_tol )
 {
   // Make sure the cutoff energy is valid
   testPrecondition( kahn_sampling_cutoff_energy >=
 		    SimulationPhotonProperties::getAbsoluteMinKahnSamplingCutoffEnergy() );
+  // Make sure the tolerance is valid
+  testPrecondition( scattering_angle_table_tol >= 0.0 );
+  testPrecondition( scattering_angle_table_tol <= 1.0 );
 
   // Create the scattering function
   std::shared_ptr<const ScatteringFunction> scattering_function;
@@ -145,12 +157,21 @@ void IncoherentPhotonScatteringDistributionNativeFactory::createWallerHartreeDis
     ++subshell_it;
   }
 
-  incoherent_distribution.reset(
+  std::shared_ptr<WHIncoherentPhotonScatteringDistribution> distribution(
 			 new DetailedWHIncoherentPhotonScatteringDistribution(
 					       scattering_function,
 					       occupancy_numbers,
 					       subshell_order,
 					       kahn_sampling_cutoff_energy ) );
+
+  if( scattering_angle_table_tol > 0.0 )
+  {
+    distribution->createScatteringAngleSamplingTable(
+                                      raw_photoatom_data.getPhotonEnergyGrid(),
+                                      scattering_angle_table_tol );
+  }
+
+  incoherent_distribution = distribution;
 }
 
 // Create a Doppler broadened hybrid incoherent distribution
@@ -160,13 +181,17 @@ void IncoherentPhotonScatteringDistributionNativeFactory::createDopplerBroadened
     doppler_broadened_dist,
     std::shared_ptr<const IncoherentPhotonScatteringDistribution>&
     incoherent_distribution,
-    const double kahn_sampling_cutoff_energy )
+    const double kahn_sampling_cutoff_energy,
+    const double scattering_angle_table_tol )
 {
   // Make sure the Doppler broadened distribution is valid
   testPrecondition( doppler_broadened_dist.get() );
   // Make sure the cutoff energy is valid
   testPrecondition( kahn_sampling_cutoff_energy >=
 		    SimulationPhotonProperties::getAbsoluteMinKahnSamplingCutoffEnergy() );
+  // Make sure the tolerance is valid
+  testPrecondition( scattering_angle_table_tol >= 0.0 );
+  testPrecondition( scattering_angle_table_tol <= 1.0 );
 
   // Create the scattering function
   std::shared_ptr<const ScatteringFunction> scattering_function;
@@ -175,11 +200,20 @@ void IncoherentPhotonScatteringDistributionNativeFactory::createDopplerBroadened
 							 raw_photoatom_data,
 							 scattering_function );
 
-  incoherent_distribution.reset(
+  std::shared_ptr<WHIncoherentPhotonScatteringDistribution> distribution(
 	      new DopplerBroadenedHybridIncoherentPhotonScatteringDistribution(
 					       scattering_function,
 					       doppler_broadened_dist,
 					       kahn_sampling_cutoff_energy ) );
+
+  if( scattering_angle_table_tol > 0.0 )
+  {
+    distribution->createScatteringAngleSamplingTable(
+                                      raw_photoatom_data.getPhotonEnergyGrid(),
+                                      scattering_angle_table_tol );
+  }
+
+  incoherent_distribution = distribution;
 }
 
 
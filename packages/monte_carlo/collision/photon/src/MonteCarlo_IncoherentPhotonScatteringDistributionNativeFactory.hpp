@@ -38,7 +38,8 @@ public:
 	 incoherent_distribution,
 	 const IncoherentModelType incoherent_model,
 	 const double kahn_sampling_cutoff_energy,
-	 const unsigned endf_subshell = 0u );
+	 const unsigned endf_subshell = 0u,
+	 const double scattering_angle_table_tol = 0.0 );
 
 protected:
 
@@ -47,7 +48,8 @@ protected:
 	 const Data::ElectronPhotonRelaxationDataContainer& raw_photoatom_data,
 	 std::shared_ptr<const IncoherentPhotonScatteringDistribution>&
 	 incoherent_distribution,
-	 const double kahn_sampling_cutoff_energy );
+	 const double kahn_sampling_cutoff_energy,
+	 const double scattering_angle_table_tol = 0.0 );
 
   //! Create a Doppler broadened hybrid incoherent distribution
   static void createDopplerBroadenedHybridDistribution(
@@ -56,7 +58,8 @@ protected:
     doppler_broadened_dist,
     std::shared_ptr<const IncoherentPhotonScatteringDistribution>&
     incoherent_distribution,
-    const double kahn_sampling_cutoff_energy );
+    const double kahn_sampling_cutoff_energy,
+    const double scattering_angle_table_tol = 0.0 );
 
   //! Create a subshell incoherent distribution
   static void createSubshellDistribution(
@@ -46,6 +46,45 @@ double Photoatom::getReactionCrossSection(
   }
 }
 
+// Return the differential scattering cross sections at the desired energy
+/*! \details The outgoing photon energy and the cross section (b)
+ * differential in the scattering angle cosine of every scattering reaction
+ * will be appended to the cross sections array. Photonuclear reactions are
+ * not considered.
+ */
+void Photoatom::getDifferentialScatteringCrossSections(
+           const double energy,
+           const double scattering_angle_cosine,
+           std::vector<std::pair<double,double> >& cross_sections ) const
+{
+  // Make sure the energy is valid
+  testPrecondition( !QT::isnaninf( energy ) );
+  testPrecondition( energy > 0.0 );
+
+  ConstReactionMap::const_iterator scattering_reaction =
+    this->getCore().getScatteringReactions().begin();
+
+  while( scattering_reaction !=
+         this->getCore().getScatteringReactions().end() )
+  {
+    double outgoing_energy;
+
+    const double cross_section =
+      scattering_reaction->second->evaluateDifferentialCrossSection(
+                                                     energy,
+                                                     scattering_angle_cosine,
+                                                     outgoing_energy );
+
+    if( cross_section > 0.0 )
+    {
+      cross_sections.push_back( std::make_pair( outgoing_energy,
+                                                cross_section ) );
+    }
+
+    ++scattering_reaction;
+  }
+}
+
 } // end MonteCarlo namespace
 
 //---------------------------------------------------------------------------//
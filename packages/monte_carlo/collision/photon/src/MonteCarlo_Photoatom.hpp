@@ -92,6 +92,12 @@ public:
 			        const double energy,
 			        const PhotoatomicReactionType reaction ) const;
 
+  //! Return the differential scattering cross sections at the desired energy
+  void getDifferentialScatteringCrossSections(
+           const double energy,
+           const double scattering_angle_cosine,
+           std::vector<std::pair<double,double> >& cross_sections ) const;
+
   //! Return the cross section for a specific photonuclear reaction
   virtual double getReactionCrossSection(
 			       const double energy,
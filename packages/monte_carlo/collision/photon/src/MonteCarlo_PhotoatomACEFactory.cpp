@@ -54,7 +54,8 @@ void PhotoatomACEFactory::createPhotoatomCore(
                                     grid_searcher,
                                     reaction_pointer,
                                     properties.getIncoherentModelType(),
-                                    properties.getKahnSamplingCutoffEnergy() );
+                                    properties.getKahnSamplingCutoffEnergy(),
+                                    properties.getPhotonScatteringAngleTableTolerance() );
   }
 
   // Create the coherent scattering reaction
@@ -62,10 +63,12 @@ void PhotoatomACEFactory::createPhotoatomCore(
     Photoatom::ConstReactionMap::mapped_type& reaction_pointer =
       scattering_reactions[COHERENT_PHOTOATOMIC_REACTION];
 
-    PhotoatomicReactionACEFactory::createCoherentReaction( raw_photoatom_data,
-							   energy_grid,
-							   grid_searcher,
-							   reaction_pointer );
+    PhotoatomicReactionACEFactory::createCoherentReaction(
+                      raw_photoatom_data,
+                      energy_grid,
+                      grid_searcher,
+                      reaction_pointer,
+                      properties.getPhotonScatteringAngleTableTolerance() );
   }
 
   // Create the pair production reaction
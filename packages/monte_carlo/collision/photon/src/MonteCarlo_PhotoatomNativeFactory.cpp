@@ -50,7 +50,8 @@ void PhotoatomNativeFactory::createPhotoatomCore(
                                     grid_searcher,
                                     reaction_pointers,
                                     properties.getIncoherentModelType(),
-                                    properties.getKahnSamplingCutoffEnergy() );
+                                    properties.getKahnSamplingCutoffEnergy(),
+                                    properties.getPhotonScatteringAngleTableTolerance() );
     
 
     for( unsigned i = 0; i < reaction_pointers.size(); ++i )
@@ -66,10 +67,11 @@ void PhotoatomNativeFactory::createPhotoatomCore(
       scattering_reactions[COHERENT_PHOTOATOMIC_REACTION];
 
     PhotoatomicReactionNativeFactory::createCoherentReaction(
-							    raw_photoatom_data,
-							    energy_grid,
-							    grid_searcher,
-							    reaction_pointer );
+                      raw_photoatom_data,
+                      energy_grid,
+                      grid_searcher,
+                      reaction_pointer,
+                      properties.getPhotonScatteringAngleTableTolerance() );
   }
 
   // Create the pair production reaction
@@ -52,6 +52,11 @@ public:
 		      Data::SubshellType& shell_of_interaction,
 		      Counter& trials ) const;
 
+  //! Evaluate the differential cross section (b) of the outgoing photon
+  virtual double evaluateDifferentialCrossSection(
+                                       const double incoming_energy,
+                                       const double scattering_angle_cosine,
+                                       double& outgoing_energy ) const;
 };
 
 // Simulate the reaction and track the number of sampling trials
@@ -66,6 +71,22 @@ inline void PhotoatomicReaction::react(
   this->react( photon, bank, shell_of_interaction );
 }
 
+// Evaluate the differential cross section (b) of the outgoing photon
+/*! \details The differential cross section is with respect to the
+ * scattering angle cosine of the outgoing (primary) photon. Reactions that
+ * do not have an outgoing primary photon (e.g. photoelectric) return zero,
+ * which is the default.
+ */
+inline double PhotoatomicReaction::evaluateDifferentialCrossSection(
+                                       const double incoming_energy,
+                                       const double,
+                                       double& outgoing_energy ) const
+{
+  outgoing_energy = incoming_energy;
+
+  return 0.0;
+}
+
 EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( StandardReactionBaseImpl<PhotoatomicReaction,Utility::LinLin,false> );
 EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( StandardReactionBaseImpl<PhotoatomicReaction,Utility::LinLin,true> );
 
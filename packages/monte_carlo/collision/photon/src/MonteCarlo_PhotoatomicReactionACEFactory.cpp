@@ -36,7 +36,8 @@ void PhotoatomicReactionACEFactory::createIncoherentReaction(
     grid_searcher,
     std::shared_ptr<const PhotoatomicReaction>& incoherent_reaction,
     const IncoherentModelType incoherent_model,
-    const double kahn_sampling_cutoff_energy )
+    const double kahn_sampling_cutoff_energy,
+    const double scattering_angle_table_tol )
 {
   // Make sure the energy grid is valid
   testPrecondition( raw_photoatom_data.extractPhotonEnergyGrid().size() ==
@@ -63,7 +64,8 @@ void PhotoatomicReactionACEFactory::createIncoherentReaction(
 						 raw_photoatom_data,
 						 distribution,
 						 incoherent_model,
-						 kahn_sampling_cutoff_energy );
+						 kahn_sampling_cutoff_energy,
+						 scattering_angle_table_tol );
 
   // Create the incoherent reaction
   incoherent_reaction.reset(new IncoherentPhotoatomicReaction<Utility::LogLog>(
@@ -80,7 +82,8 @@ void PhotoatomicReactionACEFactory::createCoherentReaction(
        const std::shared_ptr<const std::vector<double> >& energy_grid,
        const std::shared_ptr<const Utility::HashBasedGridSearcher<double> >&
        grid_searcher,
-       std::shared_ptr<const PhotoatomicReaction>& coherent_reaction )
+       std::shared_ptr<const PhotoatomicReaction>& coherent_reaction,
+       const double scattering_angle_table_tol )
 {
   // Make sure the energy grid is valid
   testPrecondition( raw_photoatom_data.extractPhotonEnergyGrid().size() ==
@@ -104,7 +107,8 @@ void PhotoatomicReactionACEFactory::createCoherentReaction(
 
   CoherentScatteringDistributionACEFactory::createEfficientCoherentDistribution(
 					                    raw_photoatom_data,
-							    distribution );
+							    distribution,
+                                                            scattering_angle_table_tol );
 
   // Create the coherent reaction
   coherent_reaction.reset(new CoherentPhotoatomicReaction<Utility::LogLog>(
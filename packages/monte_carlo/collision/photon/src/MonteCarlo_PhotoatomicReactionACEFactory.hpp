@@ -33,7 +33,8 @@ public:
     grid_searcher,
     std::shared_ptr<const PhotoatomicReaction>& incoherent_reaction,
     const IncoherentModelType incoherent_model,
-    const double kahn_sampling_cutoff_energy );
+    const double kahn_sampling_cutoff_energy,
+    const double scattering_angle_table_tol = 0.0 );
 
   //! Create a coherent scattering photoatomic reaction
   static void createCoherentReaction(
@@ -41,7 +42,8 @@ public:
     const std::shared_ptr<const std::vector<double> >& energy_grid,
     const std::shared_ptr<const Utility::HashBasedGridSearcher<double> >&
     grid_searcher,
-    std::shared_ptr<const PhotoatomicReaction>& coherent_reaction );
+    std::shared_ptr<const PhotoatomicReaction>& coherent_reaction,
+    const double scattering_angle_table_tol = 0.0 );
   
   //! Create a pair production photoatomic reaction
   static void createPairProductionReaction(
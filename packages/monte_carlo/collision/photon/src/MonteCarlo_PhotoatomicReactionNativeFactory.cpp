@@ -37,7 +37,8 @@ void PhotoatomicReactionNativeFactory::createIncoherentReactions(
        std::vector<std::shared_ptr<const PhotoatomicReaction> >&
        incoherent_reactions,
        const IncoherentModelType incoherent_model,
-       const double kahn_sampling_cutoff_energy )
+       const double kahn_sampling_cutoff_energy,
+       const double scattering_angle_table_tol )
 {
   // Make sure the energy grid is valid
   testPrecondition( raw_photoatom_data.getPhotonEnergyGrid().size() ==
@@ -67,7 +68,9 @@ void PhotoatomicReactionNativeFactory::createIncoherentReactions(
 						 raw_photoatom_data,
 						 distribution,
 						 incoherent_model,
-						 kahn_sampling_cutoff_energy );
+						 kahn_sampling_cutoff_energy,
+						 0u,
+						 scattering_angle_table_tol );
 
     // Create the incoherent reaction
     incoherent_reactions[0].reset(
@@ -133,7 +136,8 @@ void PhotoatomicReactionNativeFactory::createCoherentReaction(
        const std::shared_ptr<const std::vector<double> >& energy_grid,
        const std::shared_ptr<const Utility::HashBasedGridSearcher<double> >&
        grid_searcher,
-       std::shared_ptr<const PhotoatomicReaction>& coherent_reaction )
+       std::shared_ptr<const PhotoatomicReaction>& coherent_reaction,
+       const double scattering_angle_table_tol )
 {
   // Make sure the energy grid is valid
   testPrecondition( raw_photoatom_data.getPhotonEnergyGrid().size() ==
@@ -153,7 +157,8 @@ void PhotoatomicReactionNativeFactory::createCoherentReaction(
 
   CoherentScatteringDistributionNativeFactory::createEfficientCoherentDistribution(
 					                    raw_photoatom_data,
-							    distribution );
+							    distribution,
+                                                            scattering_angle_table_tol );
 
   // Create the coherent reaction
   coherent_reaction.reset(
@@ -36,7 +36,8 @@ public:
        std::vector<std::shared_ptr<const PhotoatomicReaction> >&
        incoherent_reactions,
        const IncoherentModelType incoherent_model,
-       const double kahn_sampling_cutoff_energy );
+       const double kahn_sampling_cutoff_energy,
+       const double scattering_angle_table_tol = 0.0 );
 
   //! Create the coherent scattering photoatomic reaction
   static void createCoherentReaction(
@@ -44,7 +45,8 @@ public:
        const std::shared_ptr<const std::vector<double> >& energy_grid,
        const std::shared_ptr<const Utility::HashBasedGridSearcher<double> >&
        grid_searcher,
-       std::shared_ptr<const PhotoatomicReaction>& coherent_reaction );
+       std::shared_ptr<const PhotoatomicReaction>& coherent_reaction,
+       const double scattering_angle_table_tol = 0.0 );
 
   //! Create the pair production photoatomic reaction
   static void createPairProductionReaction(
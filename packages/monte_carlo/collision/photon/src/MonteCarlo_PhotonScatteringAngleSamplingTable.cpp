@@ -0,0 +1,149 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_PhotonScatteringAngleSamplingTable.cpp
+//! \author Alex Robinson
+//! \brief  The photon scattering angle sampling table class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <cmath>
+
+// FRENSIE Includes
+#include "MonteCarlo_PhotonScatteringAngleSamplingTable.hpp"
+#include "Utility_TabularDistribution.hpp"
+#include "Utility_GridGenerator.hpp"
+#include "Utility_SearchAlgorithms.hpp"
+#include "Utility_SortAlgorithms.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// The initial scattering angle cosine grid
+/*! \details Photon scattering distributions can be very forward peaked (e.g.
+ * coherent scattering at high energies) so the initial grid points are
+ * clustered near a scattering angle cosine of 1.0.
+ */
+const std::vector<double>
+PhotonScatteringAngleSamplingTable::s_initial_scattering_angle_cosine_grid(
+                     {-1.0, -0.5, 0.0, 0.5, 0.9, 0.99, 0.999, 0.9999, 0.99999,
+                      0.999999, 0.9999999, 0.99999999, 1.0} );
+
+// Constructor
+/*! \details The energy grid must be sorted and all energies must be greater
+ * than 0.0. The differential cross section must be positive somewhere in
+ * [-1.0,1.0] at every energy grid point.
+ */
+PhotonScatteringAngleSamplingTable::PhotonScatteringAngleSamplingTable(
+                    const std::vector<double>& energy_grid,
+                    const DifferentialCrossSection& differential_cross_section,
+                    const double convergence_tolerance,
+                    const double absolute_difference_tolerance,
+                    const double distance_tolerance )
+  : d_energy_grid( energy_grid ),
+    d_scattering_angle_cosine_distributions( energy_grid.size() )
+{
+  // Make sure the energy grid is valid
+  testPrecondition( energy_grid.size() > 1 );
+  testPrecondition( energy_grid.front() > 0.0 );
+  testPrecondition( Utility::Sort::isSortedAscending( energy_grid.begin(),
+                                                      energy_grid.end() ) );
+  // Make sure the differential cross section is valid
+  testPrecondition( differential_cross_section );
+  // Make sure the convergence tolerance is valid
+  testPrecondition( convergence_tolerance > 0.0 );
+  testPrecondition( convergence_tolerance <= 1.0 );
+
+  Utility::GridGenerator<Utility::LinLin>
+    grid_generator( convergence_tolerance,
+                    absolute_difference_tolerance,
+                    distance_tolerance );
+
+  grid_generator.throwExceptionOnDirtyConvergence();
+
+  for( size_t i = 0; i < energy_grid.size(); ++i )
+  {
+    const double energy = energy_grid[i];
+
+    std::vector<double> scattering_angle_cosines, cross_sections;
+
+    grid_generator.generateAndEvaluate(
+            scattering_angle_cosines,
+            cross_sections,
+            s_initial_scattering_angle_cosine_grid,
+            [&differential_cross_section, energy]( const double mu ){
+              return differential_cross_section( energy, mu );
+            } );
+
+    d_scattering_angle_cosine_distributions[i].reset(
+              new Utility::TabularDistribution<Utility::LinLin>(
+                                                      scattering_angle_cosines,
+                                                      cross_sections ) );
+  }
+}
+
+// Return the energy grid
+const std::vector<double>&
+PhotonScatteringAngleSamplingTable::getEnergyGrid() const
+{
+  return d_energy_grid;
+}
+
+// Return the scattering angle cosine distribution at an energy grid point
+const Utility::TabularUnivariateDistribution&
+PhotonScatteringAngleSamplingTable::getDistribution(
+                                        const size_t energy_grid_index ) const
+{
+  // Make sure the energy grid index is valid
+  testPrecondition( energy_grid_index < d_energy_grid.size() );
+
+  return *d_scattering_angle_cosine_distributions[energy_grid_index];
+}
+
+// Sample a scattering angle cosine
+double PhotonScatteringAngleSamplingTable::sample( const double energy ) const
+{
+  // Make sure the energy is valid
+  testPrecondition( this->isEnergyWithinTable( energy ) );
+
+  size_t lower_bin_index =
+    Utility::Search::binaryLowerBoundIndex( d_energy_grid.begin(),
+                                            d_energy_grid.end(),
+                                            energy );
+
+  if( lower_bin_index == d_energy_grid.size() - 1 )
+    --lower_bin_index;
+
+  // Select the distribution using stochastic mixing
+  const double interpolation_fraction =
+    std::log( energy/d_energy_grid[lower_bin_index] )/
+    std::log( d_energy_grid[lower_bin_index+1]/d_energy_grid[lower_bin_index] );
+
+  const double random_number =
+    Utility::RandomNumberGenerator::getRandomNumber<double>();
+
+  size_t sampled_bin_index = lower_bin_index;
+
+  if( random_number < interpolation_fraction )
+    ++sampled_bin_index;
+
+  double scattering_angle_cosine =
+    d_scattering_angle_cosine_distributions[sampled_bin_index]->sample();
+
+  // Check for roundoff error
+  if( std::fabs( scattering_angle_cosine ) > 1.0 )
+    scattering_angle_cosine = std::copysign( 1.0, scattering_angle_cosine );
+
+  // Make sure the scattering angle cosine is valid
+  testPostcondition( scattering_angle_cosine >= -1.0 );
+  testPostcondition( scattering_angle_cosine <= 1.0 );
+
+  return scattering_angle_cosine;
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_PhotonScatteringAngleSamplingTable.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,92 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_PhotonScatteringAngleSamplingTable.hpp
+//! \author Alex Robinson
+//! \brief  The photon scattering angle sampling table class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_PHOTON_SCATTERING_ANGLE_SAMPLING_TABLE_HPP
+#define MONTE_CARLO_PHOTON_SCATTERING_ANGLE_SAMPLING_TABLE_HPP
+
+// Std Lib Includes
+#include <memory>
+#include <functional>
+
+// FRENSIE Includes
+#include "Utility_TabularUnivariateDistribution.hpp"
+#include "Utility_Vector.hpp"
+
+namespace MonteCarlo{
+
+/*! The photon scattering angle sampling table class
+ * \details This class allows scattering angle cosines to be sampled directly
+ * (no rejection sampling) from a photon scattering distribution. The
+ * distribution (differential in the scattering angle cosine) is tabulated
+ * at every energy grid point on a scattering angle cosine grid that is
+ * generated with lin-lin interpolation and the requested convergence
+ * tolerance (the interpolation error is controlled by the tolerance). At an
+ * energy between two grid points, the table that will be sampled is selected
+ * using stochastic mixing with log interpolation weights. Exactly two random
+ * numbers are used to sample a scattering angle cosine.
+ */
+class PhotonScatteringAngleSamplingTable
+{
+
+public:
+
+  //! The differential cross section (energy, scattering angle cosine)
+  typedef std::function<double(const double,const double)> DifferentialCrossSection;
+
+  //! Constructor
+  PhotonScatteringAngleSamplingTable(
+                    const std::vector<double>& energy_grid,
+                    const DifferentialCrossSection& differential_cross_section,
+                    const double convergence_tolerance = 1e-3,
+                    const double absolute_difference_tolerance = 1e-12,
+                    const double distance_tolerance = 1e-14 );
+
+  //! Destructor
+  ~PhotonScatteringAngleSamplingTable()
+  { /* ... */ }
+
+  //! Return the energy grid
+  const std::vector<double>& getEnergyGrid() const;
+
+  //! Check if an energy is covered by the table
+  bool isEnergyWithinTable( const double energy ) const;
+
+  //! Return the scattering angle cosine distribution at an energy grid point
+  const Utility::TabularUnivariateDistribution& getDistribution(
+                                   const size_t energy_grid_index ) const;
+
+  //! Sample a scattering angle cosine
+  double sample( const double energy ) const;
+
+private:
+
+  // The initial scattering angle cosine grid
+  static const std::vector<double> s_initial_scattering_angle_cosine_grid;
+
+  // The energy grid
+  std::vector<double> d_energy_grid;
+
+  // The scattering angle cosine distributions
+  std::vector<std::shared_ptr<const Utility::TabularUnivariateDistribution> >
+  d_scattering_angle_cosine_distributions;
+};
+
+// Check if an energy is covered by the table
+inline bool PhotonScatteringAngleSamplingTable::isEnergyWithinTable(
+                                                   const double energy ) const
+{
+  return energy >= d_energy_grid.front() && energy <= d_energy_grid.back();
+}
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_PHOTON_SCATTERING_ANGLE_SAMPLING_TABLE_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_PhotonScatteringAngleSamplingTable.hpp
+//---------------------------------------------------------------------------//
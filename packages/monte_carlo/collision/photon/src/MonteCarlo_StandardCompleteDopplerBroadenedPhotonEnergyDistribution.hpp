@@ -21,6 +21,7 @@
 #include "MonteCarlo_ComptonProfileSubshellConverter.hpp"
 #include "MonteCarlo_ComptonProfilePolicy.hpp"
 #include "Utility_TabularUnivariateDistribution.hpp"
+#include "Utility_DiscreteDistribution.hpp"
 
 namespace MonteCarlo{
 
@@ -177,11 +178,26 @@ protected:
   //! Sample an ENDF subshell
   Data::SubshellType sampleENDFInteractionSubshell() const;
 
-  //! Sample an interaction subshell
-  virtual void sampleInteractionSubshell( size_t& old_subshell_index,
+  //! Sample an interaction subshell where an interaction is possible
+  virtual void sampleInteractionSubshell( const double incoming_energy,
+                                          size_t& old_subshell_index,
                                           double& subshell_binding_energy,
                                           Data::SubshellType& subshell ) const = 0;
 
+  //! The binding energy truncated subshell occupancy distributions type
+  typedef std::vector<std::pair<double,std::shared_ptr<const Utility::DiscreteDistribution> > > TruncatedOccupancyDistributions;
+
+  //! Create the binding energy truncated subshell occupancy distributions
+  static void createTruncatedOccupancyDistributions(
+                      const std::vector<double>& subshell_binding_energies,
+                      const std::vector<double>& subshell_occupancies,
+                      TruncatedOccupancyDistributions& truncated_distributions );
+
+  //! Sample a subshell index from the truncated occupancy distributions
+  static size_t sampleTruncatedOccupancyDistribution(
+               const double incoming_energy,
+               const TruncatedOccupancyDistributions& truncated_distributions );
+
 private:
 
   // Sample an electron momentum from the subshell distribution
@@ -9,6 +9,9 @@
 #ifndef MONTE_CARLO_STANDARD_COMPLETE_DOPPLER_BROADENED_PHOTON_ENERGY_DISTRIBUTION_DEF_HPP
 #define MONTE_CARLO_STANDARD_COMPLETE_DOPPLER_BROADENED_PHOTON_ENERGY_DISTRIBUTION_DEF_HPP
 
+// Std Lib Includes
+#include <algorithm>
+
 // Boost Includes
 #include <boost/function.hpp>
 #include <boost/bind.hpp>
@@ -718,7 +721,9 @@ void StandardCompleteDopplerBroadenedPhotonEnergyDistribution<ComptonProfilePoli
 
 // Sample an electron momentum from the distribution
 /*! \details The sampling of the Compton profile and the interaction subshell
- * are decoupled in this procedure.
+ * are decoupled in this procedure. Only subshells where an incoherent
+ * interaction is energetically possible can be sampled (no rejection
+ * sampling is required).
  */
 template<typename ComptonProfilePolicy>
 void StandardCompleteDopplerBroadenedPhotonEnergyDistribution<ComptonProfilePolicy>::sampleMomentumAndRecordTrials(
@@ -734,30 +739,14 @@ void StandardCompleteDopplerBroadenedPhotonEnergyDistribution<ComptonProfilePoli
   testPrecondition( scattering_angle_cosine >= -1.0 );
   testPrecondition( scattering_angle_cosine <= 1.0 );
 
-  // Record the number of iterations
-  Counter iterations = 0;
-
   // Sample the shell that is interacted with
   size_t compton_subshell_index;
   double subshell_binding_energy;
 
-  // Only allow the selection of subshells where an incoherent interaction is
-  // energetically possible - there is definitely a more efficient way to do
-  // this!
-  while( true )
-  {
-    ++iterations;
-
-    this->sampleInteractionSubshell( compton_subshell_index,
-                                     subshell_binding_energy,
-                                     shell_of_interaction );
-
-    // Calculate the maximum outgoing photon energy
-    double energy_max = incoming_energy - subshell_binding_energy;
-
-    if( energy_max >= 0.0 )
-      break;
-  }
+  this->sampleInteractionSubshell( incoming_energy,
+                                   compton_subshell_index,
+                                   subshell_binding_energy,
+                                   shell_of_interaction );
 
   // Get the Compton profile for the sampled subshell
   const ComptonProfile& compton_profile =
@@ -769,7 +758,7 @@ void StandardCompleteDopplerBroadenedPhotonEnergyDistribution<ComptonProfilePoli
                                                     compton_profile );
 
   // Increment the number of trials
-  trials += iterations;
+  ++trials;
 }
 
 // Sample an electron momentum from the subshell distribution
@@ -921,6 +910,88 @@ Data::SubshellType StandardCompleteDopplerBroadenedPhotonEnergyDistribution<Comp
   return this->getSubshell( endf_subshell_index );
 }
 
+// Create the binding energy truncated subshell occupancy distributions
+/*! \details A subshell occupancy distribution will be created for each
+ * unique subshell binding energy. Only the subshells with a binding energy
+ * that is less than or equal to the binding energy of the distribution are
+ * included in the distribution (incoherent scattering is not possible in the
+ * other subshells). The independent values of the distributions are the
+ * subshell indices. The subshell order is preserved so that the distribution
+ * for the max binding energy is identical to the full subshell occupancy
+ * distribution.
+ */
+template<typename ComptonProfilePolicy>
+void StandardCompleteDopplerBroadenedPhotonEnergyDistribution<ComptonProfilePolicy>::createTruncatedOccupancyDistributions(
+                      const std::vector<double>& subshell_binding_energies,
+                      const std::vector<double>& subshell_occupancies,
+                      TruncatedOccupancyDistributions& truncated_distributions )
+{
+  // Make sure the subshell data is valid
+  testPrecondition( subshell_binding_energies.size() > 0 );
+  testPrecondition( subshell_occupancies.size() ==
+                    subshell_binding_energies.size() );
+
+  // Get the unique binding energies
+  std::vector<double> unique_binding_energies( subshell_binding_energies );
+
+  std::sort( unique_binding_energies.begin(), unique_binding_energies.end() );
+
+  unique_binding_energies.erase( std::unique( unique_binding_energies.begin(),
+                                              unique_binding_energies.end() ),
+                                 unique_binding_energies.end() );
+
+  truncated_distributions.clear();
+  truncated_distributions.reserve( unique_binding_energies.size() );
+
+  for( size_t i = 0; i < unique_binding_energies.size(); ++i )
+  {
+    std::vector<double> subshell_indices, occupancies;
+
+    for( size_t j = 0; j < subshell_binding_energies.size(); ++j )
+    {
+      if( subshell_binding_energies[j] <= unique_binding_energies[i] )
+      {
+        subshell_indices.push_back( j );
+        occupancies.push_back( subshell_occupancies[j] );
+      }
+    }
+
+    truncated_distributions.push_back( std::make_pair(
+       unique_binding_energies[i],
+       std::shared_ptr<const Utility::DiscreteDistribution>(
+                   new Utility::DiscreteDistribution( subshell_indices,
+                                                      occupancies ) ) ) );
+  }
+}
+
+// Sample a subshell index from the truncated occupancy distributions
+/*! \details If the incoming energy is below the min binding energy the
+ * distribution for the min binding energy will be sampled (the Doppler
+ * broadened energy will not be energetically possible in this case).
+ */
+template<typename ComptonProfilePolicy>
+size_t StandardCompleteDopplerBroadenedPhotonEnergyDistribution<ComptonProfilePolicy>::sampleTruncatedOccupancyDistribution(
+               const double incoming_energy,
+               const TruncatedOccupancyDistributions& truncated_distributions )
+{
+  // Make sure the truncated distributions are valid
+  testPrecondition( truncated_distributions.size() > 0 );
+
+  // Find the first distribution with a binding energy above the energy
+  typename TruncatedOccupancyDistributions::const_iterator distribution_it =
+    std::upper_bound( truncated_distributions.begin(),
+                      truncated_distributions.end(),
+                      incoming_energy,
+                      []( const double energy,
+                          const typename TruncatedOccupancyDistributions::value_type& distribution )
+                      { return energy < distribution.first; } );
+
+  if( distribution_it != truncated_distributions.begin() )
+    --distribution_it;
+
+  return static_cast<size_t>( distribution_it->second->sample() );
+}
+
 EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( StandardCompleteDopplerBroadenedPhotonEnergyDistribution<FullComptonProfilePolicy> );
 EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( StandardCompleteDopplerBroadenedPhotonEnergyDistribution<HalfComptonProfilePolicy> );
 EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( StandardCompleteDopplerBroadenedPhotonEnergyDistribution<DoubledHalfComptonProfilePolicy> );
@@ -6,6 +6,9 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Std Lib Includes
+#include <functional>
+
 // Boost Includes
 #include <boost/function.hpp>
 #include <boost/bind.hpp>
@@ -24,7 +27,8 @@ WHIncoherentPhotonScatteringDistribution::WHIncoherentPhotonScatteringDistributi
 	  const std::shared_ptr<const ScatteringFunction>& scattering_function,
 	  const double kahn_sampling_cutoff_energy )
   : IncoherentPhotonScatteringDistribution( kahn_sampling_cutoff_energy ),
-    d_scattering_function( scattering_function )
+    d_scattering_function( scattering_function ),
+    d_scattering_angle_sampling_table()
 {
   // Make sure the scattering function is valid
   testPrecondition( scattering_function.get() );
@@ -116,6 +120,21 @@ void WHIncoherentPhotonScatteringDistribution::sampleAndRecordTrials(
   // Make sure the incoming energy is valid
   testPrecondition( incoming_energy > 0.0 );
 
+  // Sample the scattering angle cosine directly if possible
+  if( d_scattering_angle_sampling_table &&
+      d_scattering_angle_sampling_table->isEnergyWithinTable( incoming_energy ) )
+  {
+    ++trials;
+
+    scattering_angle_cosine =
+      d_scattering_angle_sampling_table->sample( incoming_energy );
+
+    outgoing_energy = calculateComptonLineEnergy( incoming_energy,
+                                                  scattering_angle_cosine );
+
+    return;
+  }
+
   // Evaluate the maximum scattering function value
   const double max_scattering_function_value =
     this->evaluateScatteringFunction( incoming_energy, -1.0 );
@@ -145,6 +164,31 @@ void WHIncoherentPhotonScatteringDistribution::sampleAndRecordTrials(
   testPostcondition( outgoing_energy <= incoming_energy );
 }
 
+// Create the scattering angle sampling table (direct sampling)
+/*! \details The scattering angle cosine will be sampled directly from the
+ * table at energies that are covered by the energy grid. The convergence
+ * tolerance controls the interpolation error of the tabulated distributions.
+ */
+void WHIncoherentPhotonScatteringDistribution::createScatteringAngleSamplingTable(
+                                       const std::vector<double>& energy_grid,
+                                       const double convergence_tolerance )
+{
+  d_scattering_angle_sampling_table.reset(
+              new PhotonScatteringAngleSamplingTable(
+                  energy_grid,
+                  std::bind<double>( &WHIncoherentPhotonScatteringDistribution::evaluate,
+                                     std::cref( *this ),
+                                     std::placeholders::_1,
+                                     std::placeholders::_2 ),
+                  convergence_tolerance ) );
+}
+
+// Check if a scattering angle sampling table has been created
+bool WHIncoherentPhotonScatteringDistribution::hasScatteringAngleSamplingTable() const
+{
+  return d_scattering_angle_sampling_table.get() != NULL;
+}
+
 } // end MonteCarlo namespace
 
 //---------------------------------------------------------------------------//
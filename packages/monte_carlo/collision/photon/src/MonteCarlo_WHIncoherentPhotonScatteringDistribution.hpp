@@ -15,10 +15,16 @@
 // FRENSIE Includes
 #include "MonteCarlo_IncoherentPhotonScatteringDistribution.hpp"
 #include "MonteCarlo_ScatteringFunction.hpp"
+#include "MonteCarlo_PhotonScatteringAngleSamplingTable.hpp"
 
 namespace MonteCarlo{
 
-//! The Waller-Hartree incoherent photon scattering distribution class
+/*! The Waller-Hartree incoherent photon scattering distribution class
+ * \details By default the scattering angle cosine is sampled by rejection
+ * on the scattering function. A scattering angle sampling table can
+ * optionally be created so that the scattering angle cosine can be sampled
+ * directly at energies that are covered by the table.
+ */
 class WHIncoherentPhotonScatteringDistribution : public IncoherentPhotonScatteringDistribution
 {
 
@@ -55,6 +61,14 @@ public:
 			      double& scattering_angle_cosine,
 			      Counter& trials ) const;
 
+  //! Create the scattering angle sampling table (direct sampling)
+  void createScatteringAngleSamplingTable(
+                                     const std::vector<double>& energy_grid,
+                                     const double convergence_tolerance = 1e-3 );
+
+  //! Check if a scattering angle sampling table has been created
+  bool hasScatteringAngleSamplingTable() const;
+
 private:
 
   // Evaluate the scattering function
@@ -64,6 +78,10 @@ private:
 
   // The scattering function
   std::shared_ptr<const ScatteringFunction> d_scattering_function;
+
+  // The scattering angle sampling table
+  std::shared_ptr<const PhotonScatteringAngleSamplingTable>
+  d_scattering_angle_sampling_table;
 };
 
 // Evaluate the scattering function
@@ -139,6 +139,49 @@ FRENSIE_UNIT_TEST( CoherentScatteringDistributionNativeFactory,
   Utility::RandomNumberGenerator::unsetFakeStream();
 }
 
+//---------------------------------------------------------------------------//
+// Check that an efficient coherent distribution with a scattering angle
+// sampling table can be created
+FRENSIE_UNIT_TEST( CoherentScatteringDistributionNativeFactory,
+		   createEfficientCoherentDistribution_angle_table )
+{
+  MonteCarlo::CoherentScatteringDistributionNativeFactory::createEfficientCoherentDistribution(
+							       *data_container,
+							       distribution,
+                                                               0.0 );
+
+  FRENSIE_CHECK( !distribution->hasScatteringAngleSamplingTable() );
+
+  MonteCarlo::CoherentScatteringDistributionNativeFactory::createEfficientCoherentDistribution(
+							       *data_container,
+							       distribution,
+                                                               1e-3 );
+
+  FRENSIE_CHECK( distribution->hasScatteringAngleSamplingTable() );
+
+  // The scattering angle cosine is sampled directly (one trial)
+  double outgoing_energy, scattering_angle_cosine;
+  MonteCarlo::CoherentScatteringDistribution::Counter trials = 0;
+
+  std::vector<double> fake_stream( 2 );
+  fake_stream[0] = 0.5;
+  fake_stream[1] = 0.5;
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  distribution->sampleAndRecordTrials( 0.1,
+                                       outgoing_energy,
+                                       scattering_angle_cosine,
+                                       trials );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+
+  FRENSIE_CHECK_EQUAL( outgoing_energy, 0.1 );
+  FRENSIE_CHECK_GREATER_OR_EQUAL( scattering_angle_cosine, -1.0 );
+  FRENSIE_CHECK_LESS_OR_EQUAL( scattering_angle_cosine, 1.0 );
+  FRENSIE_CHECK_EQUAL( trials, 1 );
+}
+
 //---------------------------------------------------------------------------//
 // Custom Setup
 //---------------------------------------------------------------------------//
@@ -94,6 +94,40 @@ FRENSIE_UNIT_TEST( CoupledCompleteDopplerBroadenedPhotonEnergyDistribution,
   FRENSIE_CHECK_EQUAL( shell_of_interaction, Data::K_SUBSHELL );
 }
 
+//---------------------------------------------------------------------------//
+// Check that only subshells where an interaction is possible can be sampled
+FRENSIE_UNIT_TEST( CoupledCompleteDopplerBroadenedPhotonEnergyDistribution,
+		   sample_below_k_binding_energy )
+{
+  // Below the K subshell binding energy (8.8e-2 MeV) and above the L1
+  // subshell binding energy (1.58e-2 MeV)
+  double incoming_energy = 5e-2, scattering_angle_cosine = 0.0;
+  double outgoing_energy;
+  Data::SubshellType shell_of_interaction;
+
+  // Set up the random number stream
+  std::vector<double> fake_stream( 3 );
+  fake_stream[0] = 0.005; // select first possible shell for collision
+  fake_stream[1] = 0.5; // select pz = 0.0
+  fake_stream[2] = 0.5;
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  MonteCarlo::DopplerBroadenedPhotonEnergyDistribution::Counter trials = 0;
+
+  full_distribution->sampleAndRecordTrials( incoming_energy,
+                                            scattering_angle_cosine,
+                                            outgoing_energy,
+                                            shell_of_interaction,
+                                            trials );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+
+  FRENSIE_CHECK_EQUAL( shell_of_interaction, Data::L1_SUBSHELL );
+  FRENSIE_CHECK_EQUAL( trials, 1 );
+  FRENSIE_CHECK( outgoing_energy <= incoming_energy );
+}
+
 //---------------------------------------------------------------------------//
 // Custom Setup
 //---------------------------------------------------------------------------//
@@ -11,6 +11,7 @@
 
 // FRENSIE Includes
 #include "MonteCarlo_IncoherentPhotonScatteringDistributionNativeFactory.hpp"
+#include "MonteCarlo_WHIncoherentPhotonScatteringDistribution.hpp"
 #include "Data_ElectronPhotonRelaxationDataContainer.hpp"
 #include "Utility_RandomNumberGenerator.hpp"
 #include "Utility_UnitTestHarnessWithMain.hpp"
@@ -107,6 +108,49 @@ FRENSIE_UNIT_TEST( IncoherentPhotonScatteringDistributionNativeFactory,
 
 
 
+//---------------------------------------------------------------------------//
+// Check that a basic incoherent distribution with a scattering angle
+// sampling table can be created
+FRENSIE_UNIT_TEST( IncoherentPhotonScatteringDistributionNativeFactory,
+		   createIncoherentDistribution_angle_table )
+{
+  MonteCarlo::IncoherentPhotonScatteringDistributionNativeFactory::createDistribution(
+                                               *data_container,
+					       distribution,
+					       MonteCarlo::WH_INCOHERENT_MODEL,
+					       3.0,
+                                               0u,
+                                               1e-3 );
+
+  std::shared_ptr<const MonteCarlo::WHIncoherentPhotonScatteringDistribution>
+    wh_distribution = std::dynamic_pointer_cast<const MonteCarlo::WHIncoherentPhotonScatteringDistribution>( distribution );
+
+  FRENSIE_REQUIRE( wh_distribution.get() != NULL );
+  FRENSIE_CHECK( wh_distribution->hasScatteringAngleSamplingTable() );
+
+  // The scattering angle cosine is sampled directly (one trial)
+  double outgoing_energy, scattering_angle_cosine;
+  MonteCarlo::IncoherentPhotonScatteringDistribution::Counter trials = 0;
+
+  std::vector<double> fake_stream( 2 );
+  fake_stream[0] = 0.5;
+  fake_stream[1] = 0.5;
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  wh_distribution->sampleAndRecordTrials( 1.0,
+                                          outgoing_energy,
+                                          scattering_angle_cosine,
+                                          trials );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+
+  FRENSIE_CHECK_GREATER_OR_EQUAL( scattering_angle_cosine, -1.0 );
+  FRENSIE_CHECK_LESS_OR_EQUAL( scattering_angle_cosine, 1.0 );
+  FRENSIE_CHECK_LESS_OR_EQUAL( outgoing_energy, 1.0 );
+  FRENSIE_CHECK_EQUAL( trials, 1 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the Doppler broadened incoherent dist. can be created
 FRENSIE_UNIT_TEST( IncoherentPhotonScatteringDistributionNativeFactory,
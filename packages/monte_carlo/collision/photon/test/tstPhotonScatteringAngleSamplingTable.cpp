@@ -0,0 +1,146 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstPhotonScatteringAngleSamplingTable.cpp
+//! \author Alex Robinson
+//! \brief  Photon scattering angle sampling table unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+#include <cmath>
+
+// FRENSIE Includes
+#include "MonteCarlo_PhotonScatteringAngleSamplingTable.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+std::shared_ptr<const MonteCarlo::PhotonScatteringAngleSamplingTable> table;
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Forward peaked at 1.0 MeV, backward peaked at 10.0 MeV
+double evaluateDifferentialCrossSection( const double energy,
+                                         const double scattering_angle_cosine )
+{
+  if( energy < 10.0 )
+    return 1.0 + scattering_angle_cosine;
+  else
+    return 1.0 - scattering_angle_cosine;
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the energy grid can be returned
+FRENSIE_UNIT_TEST( PhotonScatteringAngleSamplingTable, getEnergyGrid )
+{
+  FRENSIE_REQUIRE_EQUAL( table->getEnergyGrid().size(), 2 );
+  FRENSIE_CHECK_EQUAL( table->getEnergyGrid().front(), 1.0 );
+  FRENSIE_CHECK_EQUAL( table->getEnergyGrid().back(), 10.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check if an energy is covered by the table
+FRENSIE_UNIT_TEST( PhotonScatteringAngleSamplingTable, isEnergyWithinTable )
+{
+  FRENSIE_CHECK( !table->isEnergyWithinTable( 0.9 ) );
+  FRENSIE_CHECK( table->isEnergyWithinTable( 1.0 ) );
+  FRENSIE_CHECK( table->isEnergyWithinTable( 5.0 ) );
+  FRENSIE_CHECK( table->isEnergyWithinTable( 10.0 ) );
+  FRENSIE_CHECK( !table->isEnergyWithinTable( 10.1 ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the tabulated distributions can be returned
+FRENSIE_UNIT_TEST( PhotonScatteringAngleSamplingTable, getDistribution )
+{
+  FRENSIE_CHECK_FLOATING_EQUALITY( table->getDistribution( 0 ).evaluatePDF( -1.0 ),
+                                   0.0,
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( table->getDistribution( 0 ).evaluatePDF( 0.0 ),
+                                   0.5,
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( table->getDistribution( 0 ).evaluatePDF( 1.0 ),
+                                   1.0,
+                                   1e-12 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( table->getDistribution( 1 ).evaluatePDF( -1.0 ),
+                                   1.0,
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( table->getDistribution( 1 ).evaluatePDF( 0.0 ),
+                                   0.5,
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( table->getDistribution( 1 ).evaluatePDF( 1.0 ),
+                                   0.0,
+                                   1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a scattering angle cosine can be sampled
+FRENSIE_UNIT_TEST( PhotonScatteringAngleSamplingTable, sample )
+{
+  std::vector<double> fake_stream( 8 );
+  fake_stream[0] = 0.5; // lower distribution
+  fake_stream[1] = 0.25; // mu = 0.0
+  fake_stream[2] = 0.0; // upper distribution
+  fake_stream[3] = 0.25; // mu = 1.0 - sqrt(3)
+  fake_stream[4] = 0.49; // upper distribution
+  fake_stream[5] = 0.25; // mu = 1.0 - sqrt(3)
+  fake_stream[6] = 0.51; // lower distribution
+  fake_stream[7] = 0.25; // mu = 0.0
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  double scattering_angle_cosine = table->sample( 1.0 );
+
+  FRENSIE_CHECK_SMALL( scattering_angle_cosine, 1e-12 );
+
+  scattering_angle_cosine = table->sample( 10.0 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( scattering_angle_cosine,
+                                   1.0 - std::sqrt( 3.0 ),
+                                   1e-12 );
+
+  scattering_angle_cosine = table->sample( std::sqrt( 10.0 ) );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( scattering_angle_cosine,
+                                   1.0 - std::sqrt( 3.0 ),
+                                   1e-12 );
+
+  scattering_angle_cosine = table->sample( std::sqrt( 10.0 ) );
+
+  FRENSIE_CHECK_SMALL( scattering_angle_cosine, 1e-12 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+}
+
+//---------------------------------------------------------------------------//
+// Custom Setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  std::vector<double> energy_grid( {1.0, 10.0} );
+
+  table.reset( new MonteCarlo::PhotonScatteringAngleSamplingTable(
+                                          energy_grid,
+                                          &evaluateDifferentialCrossSection,
+                                          1e-3 ) );
+
+  // Initialize the random number generator
+  Utility::RandomNumberGenerator::createStreams();
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstPhotonScatteringAngleSamplingTable.cpp
+//---------------------------------------------------------------------------//
@@ -38,8 +38,13 @@ ParticleState::ParticleState()
     d_source_cell( 0 ),
     d_lost( false ),
     d_gone( false ),
+    d_represented_by_dxtran_particles( false ),
     d_model( new Geometry::InfiniteMediumModel( d_source_cell ) ),
+    d_deferred_cell( Geometry::Navigator::invalidCellId() ),
     d_navigator( d_model->createNavigatorAdvanced( this->createAdvanceCompleteCallback() ) ),
+    d_cached_mesh( NULL ),
+    d_cached_mesh_element( 0 ),
+    d_cached_mesh_element_index( 0 ),
     d_importance_pair( std::make_pair(1.0, 1.0))
 { /* ... */ }
 
@@ -64,8 +69,13 @@ ParticleState::ParticleState(
     d_source_cell( 0 ),
     d_lost( false ),
     d_gone( false ),
+    d_represented_by_dxtran_particles( false ),
     d_model( new Geometry::InfiniteMediumModel( d_source_cell ) ),
+    d_deferred_cell( Geometry::Navigator::invalidCellId() ),
     d_navigator( d_model->createNavigatorAdvanced( this->createAdvanceCompleteCallback() ) ),
+    d_cached_mesh( NULL ),
+    d_cached_mesh_element( 0 ),
+    d_cached_mesh_element_index( 0 ),
     d_importance_pair( std::make_pair(1.0, 1.0))
 { /* ... */ }
 
@@ -73,7 +83,10 @@ ParticleState::ParticleState(
 /*! \details When copied, the new particle is assumed to not be lost and
  * not be gone (i.e. the lost and gone states will never be copied). The
  * newly created particle will also be embedded in the same model as the
- * copied particle.
+ * copied particle. Only the position, direction and cell of the copied
+ * particle will be stored - the navigator will not be created until it is
+ * needed (e.g. when the particle is advanced). Secondary particles that are
+ * killed before they are transported therefore never touch the geometry.
  */
 ParticleState::ParticleState( const ParticleState& existing_base_state,
                               const ParticleType new_type,
@@ -97,14 +110,48 @@ ParticleState::ParticleState( const ParticleState& existing_base_state,
     d_source_cell( existing_base_state.d_source_cell ),
     d_lost( false ),
     d_gone( false ),
+    d_represented_by_dxtran_particles( existing_base_state.d_represented_by_dxtran_particles ),
     d_model( existing_base_state.d_model ),
-    d_navigator( existing_base_state.d_navigator->clone( this->createAdvanceCompleteCallback() ) ),
+    d_deferred_cell( Geometry::Navigator::invalidCellId() ),
+    d_navigator(),
+    d_cached_mesh( existing_base_state.d_cached_mesh ),
+    d_cached_mesh_element( existing_base_state.d_cached_mesh_element ),
+    d_cached_mesh_element_index( existing_base_state.d_cached_mesh_element_index ),
     d_importance_pair( existing_base_state.d_importance_pair )
 {
+  // A navigator without a state can be cloned without any geometry queries
+  if( existing_base_state.d_navigator &&
+      !existing_base_state.d_navigator->isStateSet() )
+  {
+    d_navigator.reset( existing_base_state.d_navigator->clone( this->createAdvanceCompleteCallback() ) );
+  }
+  // Defer the creation of the navigator
+  else
+  {
+    const double* position = existing_base_state.getPosition();
+    const double* direction = existing_base_state.getDirection();
+
+    for( size_t i = 0; i < 3; ++i )
+    {
+      d_deferred_position[i] =
+        Geometry::Navigator::Length::from_value( position[i] );
+
+      d_deferred_direction[i] = direction[i];
+    }
+
+    d_deferred_cell = existing_base_state.getCell();
+  }
+
   // Increment the generation number if requested
+  // Only the flight of the existing particle can be represented by DXTRAN
+  // particles (a new generation starts a new flight)
   if( increment_generation_number )
+  {
     ++d_generation_number;
 
+    d_represented_by_dxtran_particles = false;
+  }
+
   // Reset the collision number if requested
   if( reset_collision_number )
     d_collision_number = 0u;
@@ -215,31 +262,37 @@ void ParticleState::setSourceCell(
 // Return the cell handle for the cell containing the particle
 Geometry::Model::EntityId ParticleState::getCell() const
 {
-  return d_navigator->getCurrentCell();
+  if( d_navigator )
+    return d_navigator->getCurrentCell();
+  else
+    return d_deferred_cell;
 }
 
 // Return the x position of the particle
 double ParticleState::getXPosition() const
 {
-  return d_navigator->getPosition()[0].value();
+  return this->getPosition()[0];
 }
 
 // Return the y position of the particle
 double ParticleState::getYPosition() const
 {
-  return d_navigator->getPosition()[1].value();
+  return this->getPosition()[1];
 }
 
 // Return the z position of the particle
 double ParticleState::getZPosition() const
 {
-  return d_navigator->getPosition()[2].value();
+  return this->getPosition()[2];
 }
 
 // Return the position of the particle
 const double* ParticleState::getPosition() const
 {
-  return Utility::reinterpretAsRaw( d_navigator->getPosition() );
+  if( d_navigator )
+    return Utility::reinterpretAsRaw( d_navigator->getPosition() );
+  else
+    return Utility::reinterpretAsRaw( d_deferred_position );
 }
 
 // Set the position of the particle
@@ -252,7 +305,12 @@ void ParticleState::setPosition( const double x_position,
   testPrecondition( !QT::isnaninf( y_position ) );
   testPrecondition( !QT::isnaninf( z_position ) );
 
-  const double* current_direction = d_navigator->getDirection();
+  const double* current_direction = this->getDirection();
+
+  // The deferred cell is not valid at the new position so the deferred
+  // navigator state does not need to be set
+  if( !d_navigator )
+    d_navigator.reset( d_model->createNavigatorAdvanced( this->createAdvanceCompleteCallback() ) );
 
   d_navigator->setState( Geometry::Navigator::Length::from_value(x_position),
                          Geometry::Navigator::Length::from_value(y_position),
@@ -265,25 +323,28 @@ void ParticleState::setPosition( const double x_position,
 // Return the x direction of the particle
 double ParticleState::getXDirection() const
 {
-  return d_navigator->getDirection()[0];
+  return this->getDirection()[0];
 }
 
 // Return the y direction of the particle
 double ParticleState::getYDirection() const
 {
-  return d_navigator->getDirection()[1];
+  return this->getDirection()[1];
 }
 
 // Return the z direction of the particle
 double ParticleState::getZDirection() const
 {
-  return d_navigator->getDirection()[2];
+  return this->getDirection()[2];
 }
 
 // Return the direction of the particle
 const double* ParticleState::getDirection() const
 {
-  return d_navigator->getDirection();
+  if( d_navigator )
+    return d_navigator->getDirection();
+  else
+    return d_deferred_direction;
 }
 
 // Set the direction of the particle
@@ -300,7 +361,14 @@ void ParticleState::setDirection( const double x_direction,
                                            y_direction,
                                            z_direction ) );
 
-  d_navigator->changeDirection( x_direction, y_direction, z_direction );
+  if( d_navigator )
+    d_navigator->changeDirection( x_direction, y_direction, z_direction );
+  else
+  {
+    d_deferred_direction[0] = x_direction;
+    d_deferred_direction[1] = y_direction;
+    d_deferred_direction[2] = z_direction;
+  }
 }
 
 // Rotate the direction of the particle using polar a. cosine and azimuthal a.
@@ -352,14 +420,16 @@ void ParticleState::advance( double raw_distance )
   Geometry::Navigator::Length distance =
     Geometry::Navigator::Length::from_value( raw_distance );
 
-  Geometry::Navigator::Length distance_to_surface = d_navigator->fireRay();
+  Geometry::Navigator& navigator = this->navigator();
+
+  Geometry::Navigator::Length distance_to_surface = navigator.fireRay();
 
   while( distance > distance_to_surface )
   {
     // Try to advance the particle to the next cell boundary. If the
     // advance fails, the particle is lost.
     try{
-      d_navigator->advanceToCellBoundary();
+      navigator.advanceToCellBoundary();
     }
     catch( const std::exception& exception )
     {
@@ -380,7 +450,7 @@ void ParticleState::advance( double raw_distance )
 
     // Determine the distance to the next surface
     if( !d_model->isTerminationCell( this->getCell() ) )
-      distance_to_surface = d_navigator->fireRay();
+      distance_to_surface = navigator.fireRay();
 
     // The particle has exited the model
     else
@@ -393,7 +463,7 @@ void ParticleState::advance( double raw_distance )
   // Travel any remaining distance
   if( distance > 0.0*boost::units::cgs::centimeter )
   {
-    d_navigator->advanceBySubstep( distance );
+    navigator.advanceBySubstep( distance );
   }
 }
 
@@ -582,6 +652,21 @@ void ParticleState::setAsGone()
   d_gone = true;
 }
 
+// Return if the current flight is represented by DXTRAN particles
+/*! \details A particle whose current flight is represented by DXTRAN
+ * particles must be killed if it enters a DXTRAN sphere.
+ */
+bool ParticleState::isRepresentedByDXTRANParticles() const
+{
+  return d_represented_by_dxtran_particles;
+}
+
+// Set if the current flight is represented by DXTRAN particles
+void ParticleState::setRepresentedByDXTRANParticles( const bool represented )
+{
+  d_represented_by_dxtran_particles = represented;
+}
+
 // Check if the particle state is still valid
 /*! \details This will return false if the particle is lost or gone.
  */
@@ -598,13 +683,13 @@ void ParticleState::embedInModel(
   testPrecondition( model.get() );
 
   // Cache the current particle position and direction
-  const double position[3] = {d_navigator->getPosition()[0].value(),
-                              d_navigator->getPosition()[1].value(),
-                              d_navigator->getPosition()[2].value()};
+  const double position[3] = {this->getXPosition(),
+                              this->getYPosition(),
+                              this->getZPosition()};
 
-  const double direction[3] = {d_navigator->getDirection()[0],
-                               d_navigator->getDirection()[1],
-                               d_navigator->getDirection()[2]};
+  const double direction[3] = {this->getXDirection(),
+                               this->getYDirection(),
+                               this->getZDirection()};
 
   this->embedInModel( model, position, direction );
 }
@@ -621,13 +706,13 @@ void ParticleState::embedInModel(
   testPrecondition( model.get() );
 
   // Cache the current particle position and direction
-  const double position[3] = {d_navigator->getPosition()[0].value(),
-                              d_navigator->getPosition()[1].value(),
-                              d_navigator->getPosition()[2].value()};
+  const double position[3] = {this->getXPosition(),
+                              this->getYPosition(),
+                              this->getZPosition()};
 
-  const double direction[3] = {d_navigator->getDirection()[0],
-                               d_navigator->getDirection()[1],
-                               d_navigator->getDirection()[2]};
+  const double direction[3] = {this->getXDirection(),
+                               this->getYDirection(),
+                               this->getZDirection()};
 
   this->embedInModel( model, position, direction, cell );
 }
@@ -700,13 +785,13 @@ void ParticleState::extractFromModel()
 {
   // Cache the current particle position and direction
   const Geometry::Navigator::Length position[3] =
-    {d_navigator->getPosition()[0],
-     d_navigator->getPosition()[1],
-     d_navigator->getPosition()[2]};
+    {Geometry::Navigator::Length::from_value( this->getXPosition() ),
+     Geometry::Navigator::Length::from_value( this->getYPosition() ),
+     Geometry::Navigator::Length::from_value( this->getZPosition() )};
 
-  const double direction[3] = {d_navigator->getDirection()[0],
-                               d_navigator->getDirection()[1],
-                               d_navigator->getDirection()[2]};
+  const double direction[3] = {this->getXDirection(),
+                               this->getYDirection(),
+                               this->getZDirection()};
 
   // Create a dummy model
   d_source_cell = 0;
@@ -747,6 +832,25 @@ ParticleState::createAdvanceCompleteCallback()
                           std::placeholders::_1 );
 }
 
+// Create the navigator from the deferred navigator state
+/*! \details The navigator will be created in the same state that a clone of
+ * the copied particle's navigator would have (the cell is known so no
+ * cell search will be required).
+ */
+void ParticleState::materializeNavigator() const
+{
+  // Make sure that the navigator has not been created yet
+  testPrecondition( !d_navigator );
+
+  // The callback modifies the particle time, which is not part of the
+  // navigator state
+  d_navigator.reset( d_model->createNavigatorAdvanced( const_cast<ParticleState*>( this )->createAdvanceCompleteCallback() ) );
+
+  d_navigator->setState( d_deferred_position,
+                         d_deferred_direction,
+                         d_deferred_cell );
+}
+
 EXPLICIT_CLASS_SAVE_LOAD_INST( ParticleState );
 
 } // end MonteCarlo
@@ -23,6 +23,7 @@
 #include "MonteCarlo_ParticleType.hpp"
 #include "Geometry_Navigator.hpp"
 #include "Geometry_Model.hpp"
+#include "Utility_Mesh.hpp"
 #include "Utility_OStreamableObject.hpp"
 #include "Utility_PhysicalConstants.hpp"
 #include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
@@ -257,6 +258,12 @@ public:
   //! Set the particle as gone
   void setAsGone();
 
+  //! Return if the current flight is represented by DXTRAN particles
+  bool isRepresentedByDXTRANParticles() const;
+
+  //! Set if the current flight is represented by DXTRAN particles
+  void setRepresentedByDXTRANParticles( const bool represented );
+
   //! Check if the particle state is still valid
   operator bool() const;
 
@@ -290,6 +297,19 @@ public:
   //! Get the navigator used by the particle
   const Geometry::Navigator& navigator() const;
 
+  //! Check if the navigator used by the particle has been created
+  bool isNavigatorMaterialized() const;
+
+  //! Cache the mesh element that contains the particle
+  void cacheMeshElement( const Utility::Mesh& mesh,
+                         const Utility::Mesh::ElementHandle element,
+                         const size_t element_index ) const;
+
+  //! Return the cached mesh element (false if none is cached for the mesh)
+  bool getCachedMeshElement( const Utility::Mesh& mesh,
+                             Utility::Mesh::ElementHandle& element,
+                             size_t& element_index ) const;
+
 protected:
 
   //! Calculate the time to traverse a distance
@@ -313,6 +333,9 @@ private:
   // Create the navigator AdvanceComplete callback method
   Geometry::Navigator::AdvanceCompleteCallback createAdvanceCompleteCallback();
 
+  // Create the navigator from the deferred navigator state
+  void materializeNavigator() const;
+
   // Save the state to an archive
   template<typename Archive>
   void save( Archive& ar, const unsigned version ) const;
@@ -377,14 +400,36 @@ private:
   // Finished history boolean
   bool d_gone;
 
+  // DXTRAN represented flight boolean
+  bool d_represented_by_dxtran_particles;
+
   // The model that the particle is embedded in
   // Note: This must be stored to avoid persistence issues that could arrise
   //       from the model being deleted while the particle is still embedded
   //       in it.
   std::shared_ptr<const Geometry::Model> d_model;
 
-  // The navigator used by the particle
-  std::unique_ptr<Geometry::Navigator> d_navigator;
+  // The deferred navigator position (only used before the navigator of a
+  // copied state has been created)
+  Geometry::Navigator::Length d_deferred_position[3];
+
+  // The deferred navigator direction
+  double d_deferred_direction[3];
+
+  // The deferred navigator cell
+  Geometry::Model::EntityId d_deferred_cell;
+
+  // The navigator used by the particle (copied states create it on demand)
+  mutable std::unique_ptr<Geometry::Navigator> d_navigator;
+
+  // The mesh that the cached mesh element belongs to (never dereferenced)
+  mutable const Utility::Mesh* d_cached_mesh;
+
+  // The cached mesh element
+  mutable Utility::Mesh::ElementHandle d_cached_mesh_element;
+
+  // The cached mesh element index (defined by the user of the cache)
+  mutable size_t d_cached_mesh_element_index;
 };
 
 // Set the position of the particle
@@ -419,15 +464,66 @@ inline ParticleState::energyType ParticleState::getEnergy() const
  */
 inline Geometry::Navigator& ParticleState::navigator()
 {
+  if( !d_navigator )
+    this->materializeNavigator();
+
   return *d_navigator;
 }
 
 // Get the navigator used by the particle
 inline const Geometry::Navigator& ParticleState::navigator() const
 {
+  if( !d_navigator )
+    this->materializeNavigator();
+
   return *d_navigator;
 }
 
+// Check if the navigator used by the particle has been created
+/*! \details The navigator of a copied particle state is only created when
+ * it is first needed (e.g. when the particle is advanced).
+ */
+inline bool ParticleState::isNavigatorMaterialized() const
+{
+  return d_navigator.get() != NULL;
+}
+
+// Cache the mesh element that contains the particle
+/*! \details The cached mesh element is only a hint (the particle does not
+ * know when it leaves the element). Users of the cache must check that the
+ * particle is still in the cached element (e.g. with
+ * Utility::Mesh::isPointInElement), which is much cheaper than locating the
+ * particle in the mesh for most mesh types. Only one mesh element is cached
+ * at a time. The cached mesh element is copied to particles created from
+ * this particle (e.g. split particles) but it is never archived.
+ */
+inline void ParticleState::cacheMeshElement(
+                                    const Utility::Mesh& mesh,
+                                    const Utility::Mesh::ElementHandle element,
+                                    const size_t element_index ) const
+{
+  d_cached_mesh = &mesh;
+  d_cached_mesh_element = element;
+  d_cached_mesh_element_index = element_index;
+}
+
+// Return the cached mesh element (false if none is cached for the mesh)
+inline bool ParticleState::getCachedMeshElement(
+                                          const Utility::Mesh& mesh,
+                                          Utility::Mesh::ElementHandle& element,
+                                          size_t& element_index ) const
+{
+  if( d_cached_mesh == &mesh )
+  {
+    element = d_cached_mesh_element;
+    element_index = d_cached_mesh_element_index;
+
+    return true;
+  }
+  else
+    return false;
+}
+
 } // end MonteCarlo namespace
 
 BOOST_SERIALIZATION_ASSUME_ABSTRACT_CLASS( ParticleState, MonteCarlo );
@@ -47,13 +47,21 @@ void ParticleState::save( Archive& ar, const unsigned version ) const
   ar & BOOST_SERIALIZATION_NVP( d_source_cell );
   ar & BOOST_SERIALIZATION_NVP( d_lost );
   ar & BOOST_SERIALIZATION_NVP( d_gone );
+  ar & BOOST_SERIALIZATION_NVP( d_represented_by_dxtran_particles );
   ar & BOOST_SERIALIZATION_NVP( d_importance_pair );
-  ar & boost::serialization::make_nvp( "d_x_position", d_navigator->getPosition()[0] );
-  ar & boost::serialization::make_nvp( "d_y_position", d_navigator->getPosition()[1] );
-  ar & boost::serialization::make_nvp( "d_z_position", d_navigator->getPosition()[2] );
-  ar & boost::serialization::make_nvp( "d_x_direction", d_navigator->getDirection()[0] );
-  ar & boost::serialization::make_nvp( "d_y_direction", d_navigator->getDirection()[1] );
-  ar & boost::serialization::make_nvp( "d_z_direction", d_navigator->getDirection()[2] );
+
+  // The navigator will not be created if it has been deferred
+  const Geometry::Navigator::Length* position =
+    Utility::reinterpretAsQuantity<Geometry::Navigator::Length>( this->getPosition() );
+
+  const double* direction = this->getDirection();
+
+  ar & boost::serialization::make_nvp( "d_x_position", position[0] );
+  ar & boost::serialization::make_nvp( "d_y_position", position[1] );
+  ar & boost::serialization::make_nvp( "d_z_position", position[2] );
+  ar & boost::serialization::make_nvp( "d_x_direction", direction[0] );
+  ar & boost::serialization::make_nvp( "d_y_direction", direction[1] );
+  ar & boost::serialization::make_nvp( "d_z_direction", direction[2] );
 
   // We will not use the cell when we set the internal ray because the
   // particle may not be embedded in the same geometry as it was when it
@@ -80,6 +88,7 @@ void ParticleState::load( Archive& ar, const unsigned version )
   ar & BOOST_SERIALIZATION_NVP( d_source_cell );
   ar & BOOST_SERIALIZATION_NVP( d_lost );
   ar & BOOST_SERIALIZATION_NVP( d_gone );
+  ar & BOOST_SERIALIZATION_NVP( d_represented_by_dxtran_particles );
   ar & BOOST_SERIALIZATION_NVP( d_importance_pair );
 
   Geometry::Navigator::Length position[3];
@@ -97,7 +106,7 @@ void ParticleState::load( Archive& ar, const unsigned version )
   // We will not use the cell when we set the internal ray because the
   // particle may not be embedded in the same geometry as it was when it
   // was archived.
-  d_navigator->setState( position, direction );
+  this->navigator().setState( position, direction );
 }
 
 } // end MonteCarlo namespace
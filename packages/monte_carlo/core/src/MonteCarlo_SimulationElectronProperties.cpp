@@ -24,6 +24,7 @@ SimulationElectronProperties::SimulationElectronProperties()
   : d_min_electron_energy( 1e-4 ),
     d_max_electron_energy( 20.0 ),
     d_evaluation_tol( 1e-7 ),
+    d_inverse_cdf_table_tol( 0.0 ),
     d_electron_interpolation_type( LOGLOGLOG_INTERPOLATION ),
     d_electron_grid_type( UNIT_BASE_CORRELATED_GRID ),
     d_num_electron_hash_grid_bins( 1000 ),
@@ -36,6 +37,7 @@ SimulationElectronProperties::SimulationElectronProperties()
     d_bremsstrahlung_mode_on( true ),
     d_bremsstrahlung_interpolation_type( LOGLOGLOG_INTERPOLATION ),
     d_bremsstrahlung_angular_distribution_function( TWOBS_DISTRIBUTION ),
+    d_bremsstrahlung_photon_angle_table_tol( 0.0 ),
     d_electroionization_mode_on( true ),
     d_electroionization_interpolation_type( LOGLOGLOG_INTERPOLATION ),
     d_electroionization_sampling_mode( KNOCK_ON_SAMPLING ),
@@ -109,6 +111,27 @@ double SimulationElectronProperties::getElectronEvaluationTolerance() const
   return d_evaluation_tol;
 }
 
+// Set the electron inverse CDF table tolerance (default = 0.0 - no tables)
+/*! \details When the tolerance is greater than zero, the correlated
+ * bremsstrahlung and electroionization energy distributions will
+ * precompute inverse CDF tables with the desired CDF error tolerance and
+ * use them for sampling. A tolerance of zero turns the tables off.
+ */
+void SimulationElectronProperties::setElectronInverseCDFTableTolerance(
+    const double tol )
+{
+  // Make sure the tolerance is valid
+  testPrecondition( tol >= 0.0 );
+
+  d_inverse_cdf_table_tol = tol;
+}
+
+// Return the electron inverse CDF table tolerance (default = 0.0 - no tables)
+double SimulationElectronProperties::getElectronInverseCDFTableTolerance() const
+{
+  return d_inverse_cdf_table_tol;
+}
+
 // Set the electron 2D interpolation policy (LogLogLog by default)
 void SimulationElectronProperties::setElectronTwoDInterpPolicy(
     const TwoDInterpolationType interp_type )
@@ -294,6 +317,29 @@ SimulationElectronProperties::getBremsstrahlungAngularDistributionFunction() con
   return d_bremsstrahlung_angular_distribution_function;
 }
 
+// Set the bremsstrahlung 2BS photon angle table tolerance (default = 0.0 - no table)
+/*! \details When the tolerance is greater than zero and the 2BS photon
+ * angular distribution is used, the bremsstrahlung distribution will
+ * precompute a 2BS angle sampling table with the desired convergence
+ * tolerance and sample the photon angle from it instead of using the
+ * rejection routine. A tolerance of zero turns the table off.
+ */
+void SimulationElectronProperties::setBremsstrahlungPhotonAngleTableTolerance(
+    const double tol )
+{
+  // Make sure the tolerance is valid
+  testPrecondition( tol >= 0.0 );
+  testPrecondition( tol <= 1.0 );
+
+  d_bremsstrahlung_photon_angle_table_tol = tol;
+}
+
+// Return the bremsstrahlung 2BS photon angle table tolerance (default = 0.0 - no table)
+double SimulationElectronProperties::getBremsstrahlungPhotonAngleTableTolerance() const
+{
+  return d_bremsstrahlung_photon_angle_table_tol;
+}
+
 // Set atomic excitation mode to off (on by default)
 void SimulationElectronProperties::setAtomicExcitationModeOff()
 {
@@ -66,6 +66,12 @@ public:
   //! Return the electron FullyTabularTwoDDistribution evaluation tolerance (default = 1e-7)
   double getElectronEvaluationTolerance() const;
 
+  //! Set the electron inverse CDF table tolerance (default = 0.0 - no tables)
+  void setElectronInverseCDFTableTolerance( const double tol );
+
+  //! Return the electron inverse CDF table tolerance (default = 0.0 - no tables)
+  double getElectronInverseCDFTableTolerance() const;
+
   //! Set the electron 2D interpolation policy (LogLogLog by default)
   void setElectronTwoDInterpPolicy( const TwoDInterpolationType interp_type );
 
@@ -159,6 +165,12 @@ public:
   BremsstrahlungAngularDistributionType
   getBremsstrahlungAngularDistributionFunction() const;
 
+  //! Set the bremsstrahlung 2BS photon angle table tolerance (default = 0.0 - no table)
+  void setBremsstrahlungPhotonAngleTableTolerance( const double tol );
+
+  //! Return the bremsstrahlung 2BS photon angle table tolerance (default = 0.0 - no table)
+  double getBremsstrahlungPhotonAngleTableTolerance() const;
+
   /* ------ Atomic Excitation Properties ------ */
 
   //! Set atomic excitation mode to off (on by default)
@@ -206,6 +218,9 @@ private:
   // The electron FullyTabularTwoDDistribution evaluation tolerance
   double d_evaluation_tol;
 
+  // The electron inverse CDF table tolerance (0.0 - no tables)
+  double d_inverse_cdf_table_tol;
+
   // The electron 2D interpolation type ( LogLogLog - default )
   TwoDInterpolationType d_electron_interpolation_type;
 
@@ -252,6 +267,9 @@ private:
   BremsstrahlungAngularDistributionType
   d_bremsstrahlung_angular_distribution_function;
 
+  // The bremsstrahlung 2BS photon angle table tolerance (0.0 - no table)
+  double d_bremsstrahlung_photon_angle_table_tol;
+
   // The atomic excitation electron scattering mode (true = on - default, false = off)
   bool d_atomic_excitation_mode_on;
 
@@ -288,13 +306,23 @@ void SimulationElectronProperties::serialize( Archive& ar,
   ar & BOOST_SERIALIZATION_NVP( d_atomic_excitation_mode_on );
   ar & BOOST_SERIALIZATION_NVP( d_threshold_weight );
   ar & BOOST_SERIALIZATION_NVP( d_survival_weight );
+
+  if( version > 0 )
+    ar & BOOST_SERIALIZATION_NVP( d_inverse_cdf_table_tol );
+  else
+    d_inverse_cdf_table_tol = 0.0;
+
+  if( version > 1 )
+    ar & BOOST_SERIALIZATION_NVP( d_bremsstrahlung_photon_angle_table_tol );
+  else
+    d_bremsstrahlung_photon_angle_table_tol = 0.0;
 }
 
 } // end MonteCarlo namespace
 
 #if !defined SWIG
 
-BOOST_CLASS_VERSION( MonteCarlo::SimulationElectronProperties, 0 );
+BOOST_CLASS_VERSION( MonteCarlo::SimulationElectronProperties, 2 );
 BOOST_CLASS_EXPORT_KEY2( MonteCarlo::SimulationElectronProperties, "SimulationElectronProperties" );
 EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, SimulationElectronProperties );
 
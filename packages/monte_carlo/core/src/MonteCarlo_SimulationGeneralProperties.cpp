@@ -25,8 +25,14 @@ SimulationGeneralProperties::SimulationGeneralProperties()
     d_max_batch_size( d_max_rendezvous_batch_size ),
     d_number_of_batches_per_processor( 1 ),
     d_number_of_snapshots_per_batch( 1 ),
+    d_max_number_of_snapshots( Utility::QuantityTraits<uint64_t>::max() ),
+    d_discard_oldest_snapshots_mode_on( false ),
     d_wall_time( Utility::QuantityTraits<double>::inf() ),
-    d_implicit_capture_mode_on( false )
+    d_implicit_capture_mode_on( false ),
+    d_k_eigenvalue_mode_on( false ),
+    d_number_of_histories_per_cycle( 1000 ),
+    d_number_of_inactive_cycles( 30 ),
+    d_number_of_active_cycles( 100 )
 { /* ... */ }
 
 // Set the particle mode
@@ -166,6 +172,47 @@ uint64_t SimulationGeneralProperties::getNumberOfSnapshotsPerBatch() const
   return d_number_of_snapshots_per_batch;
 }
 
+// Set the max number of snapshots that each estimator will keep
+/*! \details By default all snapshots will be kept. When the number of
+ * snapshots exceeds the max number the estimators will either thin their
+ * snapshots (default) or discard the oldest snapshots.
+ */
+void SimulationGeneralProperties::setMaxNumberOfSnapshots(
+                                       const uint64_t max_number_of_snapshots )
+{
+  // There must be at least one snapshot
+  TEST_FOR_EXCEPTION( max_number_of_snapshots == 0,
+                      std::runtime_error,
+                      "The max number of snapshots must be greater than "
+                      "zero!" );
+
+  d_max_number_of_snapshots = max_number_of_snapshots;
+}
+
+// Get the max number of snapshots that each estimator will keep
+uint64_t SimulationGeneralProperties::getMaxNumberOfSnapshots() const
+{
+  return d_max_number_of_snapshots;
+}
+
+// Discard the oldest estimator snapshots when the max number is exceeded
+void SimulationGeneralProperties::setDiscardOldestSnapshotsModeOn()
+{
+  d_discard_oldest_snapshots_mode_on = true;
+}
+
+// Thin the estimator snapshots when the max number is exceeded (default)
+void SimulationGeneralProperties::setThinSnapshotsModeOn()
+{
+  d_discard_oldest_snapshots_mode_on = false;
+}
+
+// Return if the oldest estimator snapshots will be discarded
+bool SimulationGeneralProperties::isDiscardOldestSnapshotsModeOn() const
+{
+  return d_discard_oldest_snapshots_mode_on;
+}
+
 // Set the history simulation wall time
 void SimulationGeneralProperties::setSimulationWallTime( const double wall_time )
 {
@@ -201,6 +248,76 @@ bool SimulationGeneralProperties::isImplicitCaptureModeOn() const
   return d_implicit_capture_mode_on;
 }
 
+// Set k-eigenvalue (criticality) mode to on (off by default)
+void SimulationGeneralProperties::setKEigenvalueModeOn()
+{
+  d_k_eigenvalue_mode_on = true;
+}
+
+// Set fixed source mode to on (on by default)
+void SimulationGeneralProperties::setFixedSourceModeOn()
+{
+  d_k_eigenvalue_mode_on = false;
+}
+
+// Return if k-eigenvalue mode has been set
+bool SimulationGeneralProperties::isKEigenvalueModeOn() const
+{
+  return d_k_eigenvalue_mode_on;
+}
+
+// Set the number of histories per k-eigenvalue cycle
+void SimulationGeneralProperties::setNumberOfHistoriesPerCycle(
+                                           const uint64_t histories_per_cycle )
+{
+  // There must be at least one history per cycle
+  TEST_FOR_EXCEPTION( histories_per_cycle == 0,
+                      std::runtime_error,
+                      "There must be at least one history per cycle!" );
+
+  d_number_of_histories_per_cycle = histories_per_cycle;
+}
+
+// Return the number of histories per k-eigenvalue cycle
+uint64_t SimulationGeneralProperties::getNumberOfHistoriesPerCycle() const
+{
+  return d_number_of_histories_per_cycle;
+}
+
+// Set the number of inactive k-eigenvalue cycles
+/*! \details Zero inactive cycles is allowed (the initial source will be
+ * used to accumulate tallies directly).
+ */
+void SimulationGeneralProperties::setNumberOfInactiveCycles(
+                                               const uint64_t inactive_cycles )
+{
+  d_number_of_inactive_cycles = inactive_cycles;
+}
+
+// Return the number of inactive k-eigenvalue cycles
+uint64_t SimulationGeneralProperties::getNumberOfInactiveCycles() const
+{
+  return d_number_of_inactive_cycles;
+}
+
+// Set the number of active k-eigenvalue cycles
+void SimulationGeneralProperties::setNumberOfActiveCycles(
+                                                 const uint64_t active_cycles )
+{
+  // There must be at least one active cycle
+  TEST_FOR_EXCEPTION( active_cycles == 0,
+                      std::runtime_error,
+                      "There must be at least one active cycle!" );
+
+  d_number_of_active_cycles = active_cycles;
+}
+
+// Return the number of active k-eigenvalue cycles
+uint64_t SimulationGeneralProperties::getNumberOfActiveCycles() const
+{
+  return d_number_of_active_cycles;
+}
+
 EXPLICIT_CLASS_SERIALIZE_INST( SimulationGeneralProperties );
 
 } // end MonteCarlo namespace
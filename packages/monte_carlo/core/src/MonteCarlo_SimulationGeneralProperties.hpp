@@ -86,6 +86,21 @@ public:
   //! Get the number of snapshots per batch
   uint64_t getNumberOfSnapshotsPerBatch() const;
 
+  //! Set the max number of snapshots that each estimator will keep
+  void setMaxNumberOfSnapshots( const uint64_t max_number_of_snapshots );
+
+  //! Get the max number of snapshots that each estimator will keep
+  uint64_t getMaxNumberOfSnapshots() const;
+
+  //! Discard the oldest estimator snapshots when the max number is exceeded
+  void setDiscardOldestSnapshotsModeOn();
+
+  //! Thin the estimator snapshots when the max number is exceeded (default)
+  void setThinSnapshotsModeOn();
+
+  //! Return if the oldest estimator snapshots will be discarded
+  bool isDiscardOldestSnapshotsModeOn() const;
+
   //! Set the history simulation wall time (s)
   void setSimulationWallTime( const double wall_time );
 
@@ -101,6 +116,33 @@ public:
   //! Return if implicit capture mode has been set
   bool isImplicitCaptureModeOn() const;
 
+  //! Set k-eigenvalue (criticality) mode to on (off by default)
+  void setKEigenvalueModeOn();
+
+  //! Set fixed source mode to on (on by default)
+  void setFixedSourceModeOn();
+
+  //! Return if k-eigenvalue mode has been set
+  bool isKEigenvalueModeOn() const;
+
+  //! Set the number of histories per k-eigenvalue cycle
+  void setNumberOfHistoriesPerCycle( const uint64_t histories_per_cycle );
+
+  //! Return the number of histories per k-eigenvalue cycle
+  uint64_t getNumberOfHistoriesPerCycle() const;
+
+  //! Set the number of inactive k-eigenvalue cycles
+  void setNumberOfInactiveCycles( const uint64_t inactive_cycles );
+
+  //! Return the number of inactive k-eigenvalue cycles
+  uint64_t getNumberOfInactiveCycles() const;
+
+  //! Set the number of active k-eigenvalue cycles
+  void setNumberOfActiveCycles( const uint64_t active_cycles );
+
+  //! Return the number of active k-eigenvalue cycles
+  uint64_t getNumberOfActiveCycles() const;
+
 private:
 
   // Save the state to an archive
@@ -140,11 +182,29 @@ private:
   // The number of snapshots per batch
   uint64_t d_number_of_snapshots_per_batch;
 
+  // The max number of snapshots that each estimator will keep
+  uint64_t d_max_number_of_snapshots;
+
+  // The snapshot limiting mode (true = discard oldest, false = thin - default)
+  bool d_discard_oldest_snapshots_mode_on;
+
   // The simulation wall time
   double d_wall_time;
 
   // The capture mode (true = implicit, false = analogue - default)
   bool d_implicit_capture_mode_on;
+
+  // The simulation mode (true = k-eigenvalue, false = fixed source - default)
+  bool d_k_eigenvalue_mode_on;
+
+  // The number of histories per k-eigenvalue cycle
+  uint64_t d_number_of_histories_per_cycle;
+
+  // The number of inactive k-eigenvalue cycles
+  uint64_t d_number_of_inactive_cycles;
+
+  // The number of active k-eigenvalue cycles
+  uint64_t d_number_of_active_cycles;
 };
 
 // Save the state to an archive
@@ -179,6 +239,12 @@ void SimulationGeneralProperties::save( Archive& ar, const unsigned version ) co
   }
 
   ar & BOOST_SERIALIZATION_NVP( d_implicit_capture_mode_on );
+  ar & BOOST_SERIALIZATION_NVP( d_k_eigenvalue_mode_on );
+  ar & BOOST_SERIALIZATION_NVP( d_number_of_histories_per_cycle );
+  ar & BOOST_SERIALIZATION_NVP( d_number_of_inactive_cycles );
+  ar & BOOST_SERIALIZATION_NVP( d_number_of_active_cycles );
+  ar & BOOST_SERIALIZATION_NVP( d_max_number_of_snapshots );
+  ar & BOOST_SERIALIZATION_NVP( d_discard_oldest_snapshots_mode_on );
 }
 
 // Load the state to an archive
@@ -203,13 +269,39 @@ void SimulationGeneralProperties::load( Archive& ar, const unsigned version )
     d_wall_time = Utility::QuantityTraits<double>::inf();
 
   ar & BOOST_SERIALIZATION_NVP( d_implicit_capture_mode_on );
+
+  if( version > 0 )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_k_eigenvalue_mode_on );
+    ar & BOOST_SERIALIZATION_NVP( d_number_of_histories_per_cycle );
+    ar & BOOST_SERIALIZATION_NVP( d_number_of_inactive_cycles );
+    ar & BOOST_SERIALIZATION_NVP( d_number_of_active_cycles );
+  }
+  else
+  {
+    d_k_eigenvalue_mode_on = false;
+    d_number_of_histories_per_cycle = 1000;
+    d_number_of_inactive_cycles = 30;
+    d_number_of_active_cycles = 100;
+  }
+
+  if( version > 1 )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_max_number_of_snapshots );
+    ar & BOOST_SERIALIZATION_NVP( d_discard_oldest_snapshots_mode_on );
+  }
+  else
+  {
+    d_max_number_of_snapshots = Utility::QuantityTraits<uint64_t>::max();
+    d_discard_oldest_snapshots_mode_on = false;
+  }
 }
 
 } // end MonteCarlo namespace
 
 #if !defined SWIG
 
-BOOST_CLASS_VERSION( MonteCarlo::SimulationGeneralProperties, 0 );
+BOOST_CLASS_VERSION( MonteCarlo::SimulationGeneralProperties, 2 );
 BOOST_CLASS_EXPORT_KEY2( MonteCarlo::SimulationGeneralProperties, "SimulationGeneralProperties" );
 EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, SimulationGeneralProperties );
 
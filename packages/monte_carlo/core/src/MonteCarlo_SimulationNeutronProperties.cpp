@@ -27,7 +27,8 @@ SimulationNeutronProperties::SimulationNeutronProperties()
     d_free_gas_threshold( 400.0 ),
     d_unresolved_resonance_probability_table_mode_on( true ),
     d_threshold_weight( 0.0 ),
-    d_survival_weight()
+    d_survival_weight(),
+    d_neutron_implicit_capture_mode_on( false )
 { /* ... */ }
 
 // Set the minimum neutron energy (MeV)
@@ -159,6 +160,29 @@ double SimulationNeutronProperties::getNeutronRouletteSurvivalWeight() const
   return d_survival_weight;
 }
 
+// Set neutron implicit capture mode to on (off by default)
+/*! \details When implicit capture mode is on, neutron absorption is replaced
+ * by a reduction of the neutron weight by the survival probability at each
+ * collision. The neutron roulette threshold and survival weights should also be
+ * set so that low weight neutrons are eventually terminated.
+ */
+void SimulationNeutronProperties::setNeutronImplicitCaptureModeOn()
+{
+  d_neutron_implicit_capture_mode_on = true;
+}
+
+// Set neutron analogue capture mode to on (on by default)
+void SimulationNeutronProperties::setNeutronAnalogueCaptureModeOn()
+{
+  d_neutron_implicit_capture_mode_on = false;
+}
+
+// Return if neutron implicit capture mode has been set
+bool SimulationNeutronProperties::isNeutronImplicitCaptureModeOn() const
+{
+  return d_neutron_implicit_capture_mode_on;
+}
+
 EXPLICIT_CLASS_SERIALIZE_INST( SimulationNeutronProperties );
 
 } // end MonteCarlo namespace
@@ -87,6 +87,15 @@ public:
   //! Return the cutoff roulette survival weight
   double getNeutronRouletteSurvivalWeight() const;
 
+  //! Set neutron implicit capture mode to on (off by default)
+  void setNeutronImplicitCaptureModeOn();
+
+  //! Set neutron analogue capture mode to on (on by default)
+  void setNeutronAnalogueCaptureModeOn();
+
+  //! Return if neutron implicit capture mode has been set
+  bool isNeutronImplicitCaptureModeOn() const;
+
 private:
 
   // Save/load the state to an archive
@@ -124,6 +133,9 @@ private:
 
   // The roulette survival weight
   double d_survival_weight;
+
+  // The neutron capture mode (true = implicit, false = analogue - default)
+  bool d_neutron_implicit_capture_mode_on;
 };
 
 // Save/load the state to an archive
@@ -138,13 +150,18 @@ void SimulationNeutronProperties::serialize( Archive& ar,
   ar & BOOST_SERIALIZATION_NVP( d_unresolved_resonance_probability_table_mode_on );
   ar & BOOST_SERIALIZATION_NVP( d_threshold_weight );
   ar & BOOST_SERIALIZATION_NVP( d_survival_weight );
+
+  if( version > 0 )
+    ar & BOOST_SERIALIZATION_NVP( d_neutron_implicit_capture_mode_on );
+  else
+    d_neutron_implicit_capture_mode_on = false;
 }
 
 } // end MonteCarlo namespace
 
 #if !defined SWIG
 
-BOOST_CLASS_VERSION( MonteCarlo::SimulationNeutronProperties, 0 );
+BOOST_CLASS_VERSION( MonteCarlo::SimulationNeutronProperties, 1 );
 BOOST_CLASS_EXPORT_KEY2( MonteCarlo::SimulationNeutronProperties, "SimulationNeutronProperties" );
 EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, SimulationNeutronProperties );
 
@@ -32,11 +32,13 @@ SimulationPhotonProperties::SimulationPhotonProperties()
     d_kahn_sampling_cutoff_energy( 3.0 ),
     d_num_photon_hash_grid_bins( 1000 ),
     d_incoherent_model_type( COUPLED_FULL_PROFILE_DB_HYBRID_INCOHERENT_MODEL ),
+    d_scattering_angle_table_tol( 0.0 ),
     d_atomic_relaxation_mode_on( true ),
     d_detailed_pair_production_mode_on( false ),
     d_photonuclear_interaction_mode_on( false ),
     d_threshold_weight( 0.0 ),
-    d_survival_weight()
+    d_survival_weight(),
+    d_photon_implicit_capture_mode_on( false )
 { /* ... */ }
 
 // Set the minimum photon energy (MeV)
@@ -156,6 +158,30 @@ IncoherentModelType SimulationPhotonProperties::getIncoherentModelType() const
   return d_incoherent_model_type;
 }
 
+// Set the photon scattering angle table tolerance (default = 0.0 - no tables)
+/*! \details When the tolerance is greater than zero, the Waller-Hartree
+ * incoherent and the coherent scattering distributions will tabulate their
+ * scattering angle cosine distributions on the photon energy grid (with the
+ * desired interpolation error tolerance) and sample the scattering angle
+ * cosine directly instead of using rejection sampling. A tolerance of zero
+ * turns the tables off.
+ */
+void SimulationPhotonProperties::setPhotonScatteringAngleTableTolerance(
+                                                            const double tol )
+{
+  // Make sure the tolerance is valid
+  testPrecondition( tol >= 0.0 );
+  testPrecondition( tol <= 1.0 );
+
+  d_scattering_angle_table_tol = tol;
+}
+
+// Return the photon scattering angle table tolerance (default = 0.0 - no tables)
+double SimulationPhotonProperties::getPhotonScatteringAngleTableTolerance() const
+{
+  return d_scattering_angle_table_tol;
+}
+
 // Set atomic relaxation mode to off (on by default)
 void SimulationPhotonProperties::setAtomicRelaxationModeOff()
 {
@@ -245,6 +271,29 @@ double SimulationPhotonProperties::getPhotonRouletteSurvivalWeight() const
   return d_survival_weight;
 }
 
+// Set photon implicit capture mode to on (off by default)
+/*! \details When implicit capture mode is on, photon absorption is replaced
+ * by a reduction of the photon weight by the survival probability at each
+ * collision. The photon roulette threshold and survival weights should also be
+ * set so that low weight photons are eventually terminated.
+ */
+void SimulationPhotonProperties::setPhotonImplicitCaptureModeOn()
+{
+  d_photon_implicit_capture_mode_on = true;
+}
+
+// Set photon analogue capture mode to on (on by default)
+void SimulationPhotonProperties::setPhotonAnalogueCaptureModeOn()
+{
+  d_photon_implicit_capture_mode_on = false;
+}
+
+// Return if photon implicit capture mode has been set
+bool SimulationPhotonProperties::isPhotonImplicitCaptureModeOn() const
+{
+  return d_photon_implicit_capture_mode_on;
+}
+
 EXPLICIT_CLASS_SERIALIZE_INST( SimulationPhotonProperties );
 
 } // end MonteCarlo namespace
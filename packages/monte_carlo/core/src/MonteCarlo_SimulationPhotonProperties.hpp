@@ -77,6 +77,12 @@ public:
   //! Return the incoherent model
   IncoherentModelType getIncoherentModelType() const;
 
+  //! Set the photon scattering angle table tolerance (default = 0.0 - no tables)
+  void setPhotonScatteringAngleTableTolerance( const double tol );
+
+  //! Return the photon scattering angle table tolerance (default = 0.0 - no tables)
+  double getPhotonScatteringAngleTableTolerance() const;
+
   //! Set atomic relaxation mode to off (on by default)
   void setAtomicRelaxationModeOff();
 
@@ -116,6 +122,15 @@ public:
   //! Return the cutoff roulette survival weight
   double getPhotonRouletteSurvivalWeight() const;
 
+  //! Set photon implicit capture mode to on (off by default)
+  void setPhotonImplicitCaptureModeOn();
+
+  //! Set photon analogue capture mode to on (on by default)
+  void setPhotonAnalogueCaptureModeOn();
+
+  //! Return if photon implicit capture mode has been set
+  bool isPhotonImplicitCaptureModeOn() const;
+
 private:
 
   // Save/load the state to an archive
@@ -149,6 +164,9 @@ private:
   // The incoherent model
   IncoherentModelType d_incoherent_model_type;
 
+  // The photon scattering angle table tolerance (0.0 - no tables)
+  double d_scattering_angle_table_tol;
+
   // The atomic relaxation mode (true = on - default, false = off)
   bool d_atomic_relaxation_mode_on;
 
@@ -163,6 +181,9 @@ private:
 
   // The roulette survival weight
   double d_survival_weight;
+
+  // The photon capture mode (true = implicit, false = analogue - default)
+  bool d_photon_implicit_capture_mode_on;
 };
 
 // Save/load the state to an archive
@@ -180,13 +201,23 @@ void SimulationPhotonProperties::serialize( Archive& ar,
   ar & BOOST_SERIALIZATION_NVP( d_photonuclear_interaction_mode_on );
   ar & BOOST_SERIALIZATION_NVP( d_threshold_weight );
   ar & BOOST_SERIALIZATION_NVP( d_survival_weight );
+
+  if( version > 0 )
+    ar & BOOST_SERIALIZATION_NVP( d_photon_implicit_capture_mode_on );
+  else
+    d_photon_implicit_capture_mode_on = false;
+
+  if( version > 1 )
+    ar & BOOST_SERIALIZATION_NVP( d_scattering_angle_table_tol );
+  else
+    d_scattering_angle_table_tol = 0.0;
 }
 
 } // end MonteCarlo namespace
 
 #if !defined SWIG
 
-BOOST_CLASS_VERSION( MonteCarlo::SimulationPhotonProperties, 0 );
+BOOST_CLASS_VERSION( MonteCarlo::SimulationPhotonProperties, 2 );
 BOOST_CLASS_EXPORT_KEY2( MonteCarlo::SimulationPhotonProperties, "SimulationPhotonProperties" );
 EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, SimulationPhotonProperties );
 
@@ -69,6 +69,68 @@ bool SimulationProperties::isAtomicRelaxationModeOn(
   }
 }
 
+// Set implicit capture mode to on
+void SimulationProperties::setImplicitCaptureModeOn(
+                                                  const ParticleType particle )
+{
+  switch( particle )
+  {
+  case NEUTRON:
+    SimulationNeutronProperties::setNeutronImplicitCaptureModeOn();
+    break;
+  case PHOTON:
+    SimulationPhotonProperties::setPhotonImplicitCaptureModeOn();
+    break;
+  default:
+    THROW_EXCEPTION( std::logic_error,
+                     "Error: particle implicit capture mode only exists for "
+                     "neutrons and photons!" );
+  }
+}
+
+// Set analogue capture mode to on
+/*! \details If implicit capture mode has been set for all particles it will
+ * still be used for the particle of interest.
+ */
+void SimulationProperties::setAnalogueCaptureModeOn(
+                                                  const ParticleType particle )
+{
+  switch( particle )
+  {
+  case NEUTRON:
+    SimulationNeutronProperties::setNeutronAnalogueCaptureModeOn();
+    break;
+  case PHOTON:
+    SimulationPhotonProperties::setPhotonAnalogueCaptureModeOn();
+    break;
+  default:
+    THROW_EXCEPTION( std::logic_error,
+                     "Error: particle implicit capture mode only exists for "
+                     "neutrons and photons!" );
+  }
+}
+
+// Return if implicit capture mode has been set
+/*! \details Implicit capture mode will be on for the particle of interest
+ * if it has been set for all particles or for the particle type.
+ */
+bool SimulationProperties::isImplicitCaptureModeOn(
+                                            const ParticleType particle ) const
+{
+  if( SimulationGeneralProperties::isImplicitCaptureModeOn() )
+    return true;
+
+  switch( particle )
+  {
+  case NEUTRON:
+    return SimulationNeutronProperties::isNeutronImplicitCaptureModeOn();
+  case PHOTON:
+    return SimulationPhotonProperties::isPhotonImplicitCaptureModeOn();
+  default:
+    return false;
+  }
+}
+
 EXPLICIT_CLASS_SERIALIZE_INST( SimulationProperties );
 
 } // end MonteCarlo namespace
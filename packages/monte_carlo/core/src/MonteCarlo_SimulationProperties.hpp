@@ -67,6 +67,24 @@ public:
   //! Return if atomic relaxation mode is on
   bool isAtomicRelaxationModeOn( const ParticleType particle ) const;
 
+  //! Set implicit capture mode to on (all particles)
+  using SimulationGeneralProperties::setImplicitCaptureModeOn;
+
+  //! Set implicit capture mode to on
+  void setImplicitCaptureModeOn( const ParticleType particle );
+
+  //! Set analogue capture mode to on (all particles)
+  using SimulationGeneralProperties::setAnalogueCaptureModeOn;
+
+  //! Set analogue capture mode to on
+  void setAnalogueCaptureModeOn( const ParticleType particle );
+
+  //! Return if implicit capture mode has been set for all particles
+  using SimulationGeneralProperties::isImplicitCaptureModeOn;
+
+  //! Return if implicit capture mode has been set
+  bool isImplicitCaptureModeOn( const ParticleType particle ) const;
+
   //! Return the cutoff roulette threshold weight
   template<typename ParticleType>
   double getRouletteThresholdWeight() const;
@@ -0,0 +1,269 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_TransportProfiler.cpp
+//! \author Alex Robinson
+//! \brief  Transport stage timer and event counter definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iomanip>
+
+// FRENSIE Includes
+#include "MonteCarlo_TransportProfiler.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Initialize static member data
+constexpr size_t TransportProfiler::number_of_stages;
+
+// Check if transport profiling has been enabled
+bool TransportProfiler::isEnabled()
+{
+#if HAVE_FRENSIE_TRANSPORT_PROFILING
+  return true;
+#else
+  return false;
+#endif
+}
+
+// Return the per-thread stage data
+Utility::PerThread<TransportProfiler::ThreadStageData>&
+TransportProfiler::getThreadStageData()
+{
+  static Utility::PerThread<ThreadStageData> thread_stage_data(
+                                                       1, ThreadStageData() );
+
+  return thread_stage_data;
+}
+
+// Enable support for multiple threads
+/*! \details Only the master thread should call this method. Existing stage
+ * data will be preserved.
+ */
+void TransportProfiler::enableThreadSupport( const unsigned threads )
+{
+  // Make sure that the number of threads is valid
+  testPrecondition( threads > 0 );
+
+  if( threads > TransportProfiler::getThreadStageData().size() )
+    TransportProfiler::getThreadStageData().resize( threads, ThreadStageData() );
+}
+
+// Reset the stage timers and event counters
+void TransportProfiler::reset()
+{
+  TransportProfiler::getThreadStageData().fill( ThreadStageData() );
+}
+
+// Get the collision stage associated with a particle type
+auto TransportProfiler::getCollisionStage( const ParticleType particle_type ) -> Stage
+{
+  switch( particle_type )
+  {
+  case PHOTON: return PHOTON_COLLISION_STAGE;
+  case NEUTRON: return NEUTRON_COLLISION_STAGE;
+  case ELECTRON: return ELECTRON_COLLISION_STAGE;
+  case POSITRON: return POSITRON_COLLISION_STAGE;
+  case ADJOINT_PHOTON: return ADJOINT_PHOTON_COLLISION_STAGE;
+  case ADJOINT_NEUTRON: return ADJOINT_NEUTRON_COLLISION_STAGE;
+  case ADJOINT_ELECTRON: return ADJOINT_ELECTRON_COLLISION_STAGE;
+  case ADJOINT_POSITRON: return ADJOINT_POSITRON_COLLISION_STAGE;
+  default:
+  {
+    THROW_EXCEPTION( std::logic_error,
+                     "Particle type " << (unsigned)particle_type <<
+                     " does not have an associated collision stage!" );
+  }
+  }
+}
+
+// Get the stage name
+std::string TransportProfiler::getStageName( const Stage stage )
+{
+  switch( stage )
+  {
+  case SOURCE_SAMPLING_STAGE: return "source_sampling";
+  case RAY_FIRE_STAGE: return "ray_fire";
+  case CROSS_SECTION_LOOKUP_STAGE: return "cross_section_lookup";
+  case PHOTON_COLLISION_STAGE: return "photon_collision";
+  case NEUTRON_COLLISION_STAGE: return "neutron_collision";
+  case ELECTRON_COLLISION_STAGE: return "electron_collision";
+  case POSITRON_COLLISION_STAGE: return "positron_collision";
+  case ADJOINT_PHOTON_COLLISION_STAGE: return "adjoint_photon_collision";
+  case ADJOINT_NEUTRON_COLLISION_STAGE: return "adjoint_neutron_collision";
+  case ADJOINT_ELECTRON_COLLISION_STAGE: return "adjoint_electron_collision";
+  case ADJOINT_POSITRON_COLLISION_STAGE: return "adjoint_positron_collision";
+  case POPULATION_CONTROL_STAGE: return "population_control";
+  case PARTICLE_COLLIDING_IN_CELL_DISPATCH_STAGE:
+    return "particle_colliding_in_cell_dispatch";
+  case PARTICLE_ENTERING_CELL_DISPATCH_STAGE:
+    return "particle_entering_cell_dispatch";
+  case PARTICLE_LEAVING_CELL_DISPATCH_STAGE:
+    return "particle_leaving_cell_dispatch";
+  case PARTICLE_CROSSING_SURFACE_DISPATCH_STAGE:
+    return "particle_crossing_surface_dispatch";
+  case PARTICLE_SUBTRACK_ENDING_IN_CELL_DISPATCH_STAGE:
+    return "particle_subtrack_ending_in_cell_dispatch";
+  case PARTICLE_SUBTRACK_ENDING_GLOBAL_DISPATCH_STAGE:
+    return "particle_subtrack_ending_global_dispatch";
+  case PARTICLE_GONE_GLOBAL_DISPATCH_STAGE:
+    return "particle_gone_global_dispatch";
+  case HISTORY_COMMIT_STAGE: return "history_commit";
+  case BANK_PUSH_STAGE: return "bank_push";
+  case BANK_POP_STAGE: return "bank_pop";
+  default:
+  {
+    THROW_EXCEPTION( std::logic_error,
+                     "Transport stage " << (unsigned)stage <<
+                     " cannot be converted to a string!" );
+  }
+  }
+}
+
+// Get the number of times that a stage was entered (all threads)
+uint64_t TransportProfiler::getStageCount( const Stage stage )
+{
+  // Make sure that the stage is valid
+  testPrecondition( stage < Stage_END );
+
+  const Utility::PerThread<ThreadStageData>& thread_stage_data =
+    TransportProfiler::getThreadStageData();
+
+  uint64_t count = 0;
+
+  for( size_t i = 0; i < thread_stage_data.size(); ++i )
+    count += thread_stage_data[i].counts[stage];
+
+  return count;
+}
+
+// Get the time spent in a stage (all threads) (s)
+double TransportProfiler::getStageTime( const Stage stage )
+{
+  // Make sure that the stage is valid
+  testPrecondition( stage < Stage_END );
+
+  const Utility::PerThread<ThreadStageData>& thread_stage_data =
+    TransportProfiler::getThreadStageData();
+
+  uint64_t nanoseconds = 0;
+
+  for( size_t i = 0; i < thread_stage_data.size(); ++i )
+    nanoseconds += thread_stage_data[i].nanoseconds[stage];
+
+  return nanoseconds*1e-9;
+}
+
+// Export the report for this process
+/*! \details This method should only be called outside of parallel blocks.
+ */
+void TransportProfiler::exportReport( std::ostream& os,
+                                      const ReportFormat format,
+                                      const int process_rank )
+{
+  switch( format )
+  {
+  case JSON_REPORT_FORMAT:
+  {
+    TransportProfiler::exportJSONReport( os, process_rank );
+    break;
+  }
+  case CSV_REPORT_FORMAT:
+  {
+    TransportProfiler::exportCSVReport( os, process_rank );
+    break;
+  }
+  default:
+  {
+    THROW_EXCEPTION( std::logic_error,
+                     "Report format " << (unsigned)format <<
+                     " is not supported!" );
+  }
+  }
+}
+
+// Export the JSON report for this process
+void TransportProfiler::exportJSONReport( std::ostream& os,
+                                          const int process_rank )
+{
+  const Utility::PerThread<ThreadStageData>& thread_stage_data =
+    TransportProfiler::getThreadStageData();
+
+  os << "{\n"
+     << "  \"rank\": " << process_rank << ",\n"
+     << "  \"threads\": " << thread_stage_data.size() << ",\n"
+     << "  \"stages\": {\n";
+
+  for( size_t stage = Stage_START; stage < Stage_END; ++stage )
+  {
+    const Stage stage_enum = static_cast<Stage>( stage );
+
+    os << "    \"" << TransportProfiler::getStageName( stage_enum ) << "\": {"
+       << "\"count\": " << TransportProfiler::getStageCount( stage_enum )
+       << ", \"time\": " << std::setprecision( 9 )
+       << TransportProfiler::getStageTime( stage_enum )
+       << ", \"thread_counts\": [";
+
+    for( size_t i = 0; i < thread_stage_data.size(); ++i )
+    {
+      if( i != 0 )
+        os << ", ";
+
+      os << thread_stage_data[i].counts[stage];
+    }
+
+    os << "], \"thread_times\": [";
+
+    for( size_t i = 0; i < thread_stage_data.size(); ++i )
+    {
+      if( i != 0 )
+        os << ", ";
+
+      os << thread_stage_data[i].nanoseconds[stage]*1e-9;
+    }
+
+    os << "]}";
+
+    if( stage + 1 < Stage_END )
+      os << ",";
+
+    os << "\n";
+  }
+
+  os << "  }\n"
+     << "}" << std::endl;
+}
+
+// Export the CSV report for this process
+void TransportProfiler::exportCSVReport( std::ostream& os,
+                                         const int process_rank )
+{
+  const Utility::PerThread<ThreadStageData>& thread_stage_data =
+    TransportProfiler::getThreadStageData();
+
+  os << "rank,thread,stage,count,time" << "\n";
+
+  for( size_t i = 0; i < thread_stage_data.size(); ++i )
+  {
+    for( size_t stage = Stage_START; stage < Stage_END; ++stage )
+    {
+      os << process_rank << ","
+         << i << ","
+         << TransportProfiler::getStageName( static_cast<Stage>( stage ) ) << ","
+         << thread_stage_data[i].counts[stage] << ","
+         << std::setprecision( 9 )
+         << thread_stage_data[i].nanoseconds[stage]*1e-9 << "\n";
+    }
+  }
+
+  os.flush();
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_TransportProfiler.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,222 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_TransportProfiler.hpp
+//! \author Alex Robinson
+//! \brief  Transport stage timer and event counter declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_TRANSPORT_PROFILER_HPP
+#define MONTE_CARLO_TRANSPORT_PROFILER_HPP
+
+// Std Lib Includes
+#include <iostream>
+#include <string>
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+// Boost Includes
+#include <boost/preprocessor/cat.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleType.hpp"
+#include "Utility_PerThread.hpp"
+#include "FRENSIE_config.hpp"
+
+namespace MonteCarlo{
+
+/*! The transport stage timers and event counters
+ *
+ * Each thread accumulates the number of times that each transport stage has
+ * been entered and the wall time spent in it in its own cache line aligned
+ * slot, so no synchronization is required while particles are being
+ * transported. Stage times are inclusive (e.g. the collision stage time
+ * includes any cross section lookups done by the collision kernel). The
+ * profiler should only be accessed through the FRENSIE_PROFILE_TRANSPORT_STAGE
+ * and FRENSIE_COUNT_TRANSPORT_STAGE macros in transport code - when
+ * transport profiling has not been enabled (FRENSIE_ENABLE_TRANSPORT_PROFILING)
+ * the macros expand to nothing.
+ */
+class TransportProfiler
+{
+
+public:
+
+  //! The profiled transport stages
+  enum Stage{
+    Stage_START = 0,
+    SOURCE_SAMPLING_STAGE = Stage_START,
+    RAY_FIRE_STAGE,
+    CROSS_SECTION_LOOKUP_STAGE,
+    PHOTON_COLLISION_STAGE,
+    NEUTRON_COLLISION_STAGE,
+    ELECTRON_COLLISION_STAGE,
+    POSITRON_COLLISION_STAGE,
+    ADJOINT_PHOTON_COLLISION_STAGE,
+    ADJOINT_NEUTRON_COLLISION_STAGE,
+    ADJOINT_ELECTRON_COLLISION_STAGE,
+    ADJOINT_POSITRON_COLLISION_STAGE,
+    POPULATION_CONTROL_STAGE,
+    PARTICLE_COLLIDING_IN_CELL_DISPATCH_STAGE,
+    PARTICLE_ENTERING_CELL_DISPATCH_STAGE,
+    PARTICLE_LEAVING_CELL_DISPATCH_STAGE,
+    PARTICLE_CROSSING_SURFACE_DISPATCH_STAGE,
+    PARTICLE_SUBTRACK_ENDING_IN_CELL_DISPATCH_STAGE,
+    PARTICLE_SUBTRACK_ENDING_GLOBAL_DISPATCH_STAGE,
+    PARTICLE_GONE_GLOBAL_DISPATCH_STAGE,
+    HISTORY_COMMIT_STAGE,
+    BANK_PUSH_STAGE,
+    BANK_POP_STAGE,
+    Stage_END
+  };
+
+  //! The number of profiled transport stages
+  static constexpr size_t number_of_stages = Stage_END;
+
+  //! The report formats
+  enum ReportFormat{
+    JSON_REPORT_FORMAT = 0,
+    CSV_REPORT_FORMAT
+  };
+
+  //! The scoped stage timer
+  class ScopedStageTimer
+  {
+
+  public:
+
+    //! Constructor (starts the timer)
+    ScopedStageTimer( const Stage stage );
+
+    //! Destructor (stops the timer and records the elapsed time)
+    ~ScopedStageTimer();
+
+  private:
+
+    // The stage being timed
+    Stage d_stage;
+
+    // The start time
+    std::chrono::steady_clock::time_point d_start_time;
+  };
+
+  //! Check if transport profiling has been enabled
+  static bool isEnabled();
+
+  //! Enable support for multiple threads
+  static void enableThreadSupport( const unsigned threads );
+
+  //! Reset the stage timers and event counters
+  static void reset();
+
+  //! Increment the event counter of a stage (without timing it)
+  static void countStage( const Stage stage );
+
+  //! Record a stage event that took the requested time (nanoseconds)
+  static void recordStage( const Stage stage,
+                           const uint64_t elapsed_nanoseconds );
+
+  //! Get the collision stage associated with a particle type
+  static Stage getCollisionStage( const ParticleType particle_type );
+
+  //! Get the stage name
+  static std::string getStageName( const Stage stage );
+
+  //! Get the number of times that a stage was entered (all threads)
+  static uint64_t getStageCount( const Stage stage );
+
+  //! Get the time spent in a stage (all threads) (s)
+  static double getStageTime( const Stage stage );
+
+  //! Export the report for this process
+  static void exportReport( std::ostream& os,
+                            const ReportFormat format,
+                            const int process_rank = 0 );
+
+private:
+
+  // The thread stage data
+  struct ThreadStageData
+  {
+    // The stage counts
+    std::array<uint64_t,number_of_stages> counts;
+
+    // The stage times (ns)
+    std::array<uint64_t,number_of_stages> nanoseconds;
+  };
+
+  // Return the per-thread stage data
+  static Utility::PerThread<ThreadStageData>& getThreadStageData();
+
+  // Export the JSON report for this process
+  static void exportJSONReport( std::ostream& os, const int process_rank );
+
+  // Export the CSV report for this process
+  static void exportCSVReport( std::ostream& os, const int process_rank );
+};
+
+// Construct the scoped stage timer
+inline TransportProfiler::ScopedStageTimer::ScopedStageTimer( const Stage stage )
+  : d_stage( stage ),
+    d_start_time( std::chrono::steady_clock::now() )
+{ /* ... */ }
+
+// Destroy the scoped stage timer
+inline TransportProfiler::ScopedStageTimer::~ScopedStageTimer()
+{
+  TransportProfiler::recordStage( d_stage,
+       std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now() - d_start_time ).count() );
+}
+
+// Increment the event counter of a stage (without timing it)
+inline void TransportProfiler::countStage( const Stage stage )
+{
+  ++TransportProfiler::getThreadStageData().local().counts[stage];
+}
+
+// Record a stage event that took the requested time (nanoseconds)
+inline void TransportProfiler::recordStage( const Stage stage,
+                                            const uint64_t elapsed_nanoseconds )
+{
+  ThreadStageData& thread_data = TransportProfiler::getThreadStageData().local();
+
+  ++thread_data.counts[stage];
+  thread_data.nanoseconds[stage] += elapsed_nanoseconds;
+}
+
+} // end MonteCarlo namespace
+
+#if HAVE_FRENSIE_TRANSPORT_PROFILING
+
+//! Time the remainder of the enclosing scope as a transport stage (e.g. RAY_FIRE_STAGE)
+#define FRENSIE_PROFILE_TRANSPORT_STAGE( stage )                          \
+  MonteCarlo::TransportProfiler::ScopedStageTimer                         \
+  BOOST_PP_CAT( __frensie_transport_stage_timer_, __LINE__ )( MonteCarlo::TransportProfiler::stage )
+
+//! Count a transport stage event without timing it (e.g. BANK_PUSH_STAGE)
+#define FRENSIE_COUNT_TRANSPORT_STAGE( stage )                            \
+  MonteCarlo::TransportProfiler::countStage( MonteCarlo::TransportProfiler::stage )
+
+//! Time the remainder of the enclosing scope as a particle collision
+#define FRENSIE_PROFILE_TRANSPORT_COLLISION( particle_type )              \
+  MonteCarlo::TransportProfiler::ScopedStageTimer                         \
+  BOOST_PP_CAT( __frensie_transport_stage_timer_, __LINE__ )(             \
+     MonteCarlo::TransportProfiler::getCollisionStage( particle_type ) )
+
+#else // HAVE_FRENSIE_TRANSPORT_PROFILING
+
+#define FRENSIE_PROFILE_TRANSPORT_STAGE( stage )
+
+#define FRENSIE_COUNT_TRANSPORT_STAGE( stage )
+
+#define FRENSIE_PROFILE_TRANSPORT_COLLISION( particle_type )
+
+#endif // end HAVE_FRENSIE_TRANSPORT_PROFILING
+
+#endif // end MONTE_CARLO_TRANSPORT_PROFILER_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_TransportProfiler.hpp
+//---------------------------------------------------------------------------//
@@ -403,6 +403,33 @@ FRENSIE_UNIT_TEST( ParticleState, gone )
   FRENSIE_CHECK( !(bool)particle );
 }
 
+//---------------------------------------------------------------------------//
+// Test if a particle flight is represented by DXTRAN particles
+FRENSIE_UNIT_TEST( ParticleState, represented_by_dxtran_particles )
+{
+  TestParticleState particle( 1ull );
+
+  FRENSIE_CHECK( !particle.isRepresentedByDXTRANParticles() );
+
+  particle.setRepresentedByDXTRANParticles( true );
+
+  FRENSIE_CHECK( particle.isRepresentedByDXTRANParticles() );
+
+  // A copy of the particle continues the represented flight
+  TestParticleState particle_copy( particle, false );
+
+  FRENSIE_CHECK( particle_copy.isRepresentedByDXTRANParticles() );
+
+  // A new generation particle starts a new flight
+  TestParticleState particle_gen_b( particle, true );
+
+  FRENSIE_CHECK( !particle_gen_b.isRepresentedByDXTRANParticles() );
+
+  particle.setRepresentedByDXTRANParticles( false );
+
+  FRENSIE_CHECK( !particle.isRepresentedByDXTRANParticles() );
+}
+
 //---------------------------------------------------------------------------//
 // Test if the navigator can be returned
 FRENSIE_UNIT_TEST( ParticleState, navigator )
@@ -699,6 +726,63 @@ FRENSIE_UNIT_TEST( ParticleState, copy_constructor )
   FRENSIE_CHECK( !particle_gen_2b.isLost() );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the navigator of a copied particle is only created when needed
+FRENSIE_UNIT_TEST( ParticleState, copy_constructor_deferred_navigator )
+{
+  TestParticleState particle_gen_a( 1ull );
+  particle_gen_a.setPosition( 1.0, 1.0, 1.0 );
+  particle_gen_a.setDirection( 0.0, 0.0, 1.0 );
+
+  FRENSIE_CHECK( particle_gen_a.isNavigatorMaterialized() );
+
+  TestParticleState particle_gen_b( particle_gen_a, true );
+
+  FRENSIE_CHECK( !particle_gen_b.isNavigatorMaterialized() );
+  FRENSIE_CHECK_EQUAL( particle_gen_b.getXPosition(), 1.0 );
+  FRENSIE_CHECK_EQUAL( particle_gen_b.getYPosition(), 1.0 );
+  FRENSIE_CHECK_EQUAL( particle_gen_b.getZPosition(), 1.0 );
+  FRENSIE_CHECK_EQUAL( particle_gen_b.getCell(), particle_gen_a.getCell() );
+
+  // Changing the direction does not require the navigator
+  particle_gen_b.setDirection( 1.0, 0.0, 0.0 );
+
+  FRENSIE_CHECK( !particle_gen_b.isNavigatorMaterialized() );
+  FRENSIE_CHECK_EQUAL( particle_gen_b.getXDirection(), 1.0 );
+  FRENSIE_CHECK_EQUAL( particle_gen_b.getYDirection(), 0.0 );
+  FRENSIE_CHECK_EQUAL( particle_gen_b.getZDirection(), 0.0 );
+
+  // A copy of a copy also defers the navigator
+  TestParticleState particle_gen_c( particle_gen_b, true );
+
+  FRENSIE_CHECK( !particle_gen_c.isNavigatorMaterialized() );
+  FRENSIE_CHECK_EQUAL( particle_gen_c.getXDirection(), 1.0 );
+
+  // Advancing the particle creates the navigator
+  particle_gen_b.advance( 2.0 );
+
+  FRENSIE_CHECK( particle_gen_b.isNavigatorMaterialized() );
+  FRENSIE_CHECK_EQUAL( particle_gen_b.getXPosition(), 3.0 );
+  FRENSIE_CHECK_EQUAL( particle_gen_b.getYPosition(), 1.0 );
+  FRENSIE_CHECK_EQUAL( particle_gen_b.getZPosition(), 1.0 );
+  FRENSIE_CHECK_EQUAL( particle_gen_b.getTime(), 2.0 );
+  FRENSIE_CHECK_EQUAL( particle_gen_b.navigator().getDirection()[0], 1.0 );
+
+  // The copied particles are not modified
+  FRENSIE_CHECK_EQUAL( particle_gen_a.getXPosition(), 1.0 );
+  FRENSIE_CHECK_EQUAL( particle_gen_a.getZDirection(), 1.0 );
+  FRENSIE_CHECK_EQUAL( particle_gen_a.getTime(), 0.0 );
+  FRENSIE_CHECK_EQUAL( particle_gen_c.getXPosition(), 1.0 );
+  FRENSIE_CHECK_EQUAL( particle_gen_c.getTime(), 0.0 );
+
+  // Setting the position creates the navigator
+  particle_gen_c.setPosition( 2.0, 2.0, 2.0 );
+
+  FRENSIE_CHECK( particle_gen_c.isNavigatorMaterialized() );
+  FRENSIE_CHECK_EQUAL( particle_gen_c.getXPosition(), 2.0 );
+  FRENSIE_CHECK_EQUAL( particle_gen_c.getXDirection(), 1.0 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that a particle can be archived
 FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( ParticleState, archive, TestArchives )
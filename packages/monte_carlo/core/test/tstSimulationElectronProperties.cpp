@@ -35,6 +35,7 @@ FRENSIE_UNIT_TEST( SimulationElectronProperties, defaults )
   FRENSIE_CHECK_EQUAL( properties.getMinElectronEnergy(), 1e-4 );
   FRENSIE_CHECK_EQUAL( properties.getMaxElectronEnergy(), 20.0 );
   FRENSIE_CHECK_EQUAL( properties.getElectronEvaluationTolerance(), 1e-7 );
+  FRENSIE_CHECK_EQUAL( properties.getElectronInverseCDFTableTolerance(), 0.0 );
   FRENSIE_CHECK_EQUAL( properties.getElectronTwoDInterpPolicy(),
                        MonteCarlo::LOGLOGLOG_INTERPOLATION );
   FRENSIE_CHECK_EQUAL( properties.getElectronTwoDGridPolicy(),
@@ -52,6 +53,7 @@ FRENSIE_UNIT_TEST( SimulationElectronProperties, defaults )
   FRENSIE_CHECK( properties.isBremsstrahlungModeOn() );
   FRENSIE_CHECK_EQUAL( properties.getBremsstrahlungAngularDistributionFunction(),
                        MonteCarlo::TWOBS_DISTRIBUTION );
+  FRENSIE_CHECK_EQUAL( properties.getBremsstrahlungPhotonAngleTableTolerance(), 0.0 );
   FRENSIE_CHECK( properties.isAtomicExcitationModeOn() );
   FRENSIE_CHECK_SMALL( properties.getElectronRouletteThresholdWeight(), 1e-30 );
   FRENSIE_CHECK_SMALL( properties.getElectronRouletteSurvivalWeight(), 1e-30 );
@@ -90,6 +92,18 @@ FRENSIE_UNIT_TEST( SimulationElectronProperties, setElectronEvaluationTolerance
   FRENSIE_CHECK_EQUAL( properties.getElectronEvaluationTolerance(), 1e-4 );
 }
 
+//---------------------------------------------------------------------------//
+// Test that the electron inverse CDF table tolerance can be set
+FRENSIE_UNIT_TEST( SimulationElectronProperties,
+                   setElectronInverseCDFTableTolerance )
+{
+  MonteCarlo::SimulationElectronProperties properties;
+
+  properties.setElectronInverseCDFTableTolerance( 1e-4 );
+
+  FRENSIE_CHECK_EQUAL( properties.getElectronInverseCDFTableTolerance(), 1e-4 );
+}
+
 //---------------------------------------------------------------------------//
 // Test that the electron 2D interpolation policy can be set
 FRENSIE_UNIT_TEST( SimulationElectronProperties, setElectronTwoDInterpPolicy )
@@ -337,6 +351,18 @@ FRENSIE_UNIT_TEST( SimulationElectronProperties,
                        function );
 }
 
+//---------------------------------------------------------------------------//
+// Test that the bremsstrahlung 2BS photon angle table tolerance can be set
+FRENSIE_UNIT_TEST( SimulationElectronProperties,
+                   setBremsstrahlungPhotonAngleTableTolerance )
+{
+  MonteCarlo::SimulationElectronProperties properties;
+
+  properties.setBremsstrahlungPhotonAngleTableTolerance( 1e-3 );
+
+  FRENSIE_CHECK_EQUAL( properties.getBremsstrahlungPhotonAngleTableTolerance(), 1e-3 );
+}
+
 //---------------------------------------------------------------------------//
 // Test that atomic excitation mode can be turned off
 FRENSIE_UNIT_TEST( SimulationElectronProperties, setAtomicExcitationModeOffOn )
@@ -408,6 +434,7 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationElectronProperties,
     custom_properties.setMinElectronEnergy( 1e-2 );
     custom_properties.setMaxElectronEnergy( 15.0 );
     custom_properties.setElectronEvaluationTolerance( 1e-4 );
+    custom_properties.setElectronInverseCDFTableTolerance( 1e-3 );
     custom_properties.setElectronTwoDInterpPolicy( MonteCarlo::LINLINLIN_INTERPOLATION );
     custom_properties.setElectronTwoDGridPolicy( MonteCarlo::DIRECT_GRID );
     custom_properties.setAtomicRelaxationModeOff();
@@ -419,6 +446,7 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationElectronProperties,
     custom_properties.setElectroionizationSamplingMode( MonteCarlo::OUTGOING_ENERGY_SAMPLING );
     custom_properties.setBremsstrahlungModeOff();
     custom_properties.setBremsstrahlungAngularDistributionFunction( MonteCarlo::DIPOLE_DISTRIBUTION );
+    custom_properties.setBremsstrahlungPhotonAngleTableTolerance( 1e-2 );
     custom_properties.setAtomicExcitationModeOff();
     custom_properties.setElectronRouletteThresholdWeight( 1e-15 );
     custom_properties.setElectronRouletteSurvivalWeight( 1e-13 );
@@ -442,6 +470,7 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationElectronProperties,
   FRENSIE_CHECK_EQUAL( default_properties.getMinElectronEnergy(), 1e-4 );
   FRENSIE_CHECK_EQUAL( default_properties.getMaxElectronEnergy(), 20.0 );
   FRENSIE_CHECK_EQUAL( default_properties.getElectronEvaluationTolerance(), 1e-7 );
+  FRENSIE_CHECK_EQUAL( default_properties.getElectronInverseCDFTableTolerance(), 0.0 );
   FRENSIE_CHECK_EQUAL( default_properties.getElectronTwoDInterpPolicy(),
                        MonteCarlo::LOGLOGLOG_INTERPOLATION );
   FRENSIE_CHECK_EQUAL( default_properties.getElectronTwoDGridPolicy(),
@@ -459,6 +488,7 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationElectronProperties,
   FRENSIE_CHECK( default_properties.isBremsstrahlungModeOn() );
   FRENSIE_CHECK_EQUAL( default_properties.getBremsstrahlungAngularDistributionFunction(),
                        MonteCarlo::TWOBS_DISTRIBUTION );
+  FRENSIE_CHECK_EQUAL( default_properties.getBremsstrahlungPhotonAngleTableTolerance(), 0.0 );
   FRENSIE_CHECK( default_properties.isAtomicExcitationModeOn() );
   FRENSIE_CHECK_SMALL( default_properties.getElectronRouletteThresholdWeight(), 1e-30 );
   FRENSIE_CHECK_SMALL( default_properties.getElectronRouletteSurvivalWeight(), 1e-30  );
@@ -470,6 +500,7 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationElectronProperties,
   FRENSIE_CHECK_EQUAL( custom_properties.getMinElectronEnergy(), 1e-2 );
   FRENSIE_CHECK_EQUAL( custom_properties.getMaxElectronEnergy(), 15.0 );
   FRENSIE_CHECK_EQUAL( custom_properties.getElectronEvaluationTolerance(), 1e-4 );
+  FRENSIE_CHECK_EQUAL( custom_properties.getElectronInverseCDFTableTolerance(), 1e-3 );
   FRENSIE_CHECK_EQUAL( custom_properties.getElectronTwoDInterpPolicy(),
                        MonteCarlo::LINLINLIN_INTERPOLATION );
   FRENSIE_CHECK_EQUAL( custom_properties.getElectronTwoDGridPolicy(),
@@ -487,6 +518,7 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationElectronProperties,
   FRENSIE_CHECK( !custom_properties.isBremsstrahlungModeOn() );
   FRENSIE_CHECK_EQUAL( custom_properties.getBremsstrahlungAngularDistributionFunction(),
                        MonteCarlo::DIPOLE_DISTRIBUTION );
+  FRENSIE_CHECK_EQUAL( custom_properties.getBremsstrahlungPhotonAngleTableTolerance(), 1e-2 );
   FRENSIE_CHECK( !custom_properties.isAtomicExcitationModeOn() );
   FRENSIE_CHECK_EQUAL( custom_properties.getElectronRouletteThresholdWeight(), 1e-15 );
   FRENSIE_CHECK_EQUAL( custom_properties.getElectronRouletteSurvivalWeight(), 1e-13 );
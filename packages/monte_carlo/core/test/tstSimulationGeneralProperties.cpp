@@ -40,7 +40,14 @@ FRENSIE_UNIT_TEST( SimulationGeneralProperties, defaults )
   FRENSIE_CHECK_EQUAL( properties.getMaxBatchSize(), 1000000000 );
   FRENSIE_CHECK_EQUAL( properties.getNumberOfBatchesPerProcessor(), 1 );
   FRENSIE_CHECK_EQUAL( properties.getNumberOfSnapshotsPerBatch(), 1 );
+  FRENSIE_CHECK_EQUAL( properties.getMaxNumberOfSnapshots(),
+                       Utility::QuantityTraits<uint64_t>::max() );
+  FRENSIE_CHECK( !properties.isDiscardOldestSnapshotsModeOn() );
   FRENSIE_CHECK( !properties.isImplicitCaptureModeOn() );
+  FRENSIE_CHECK( !properties.isKEigenvalueModeOn() );
+  FRENSIE_CHECK_EQUAL( properties.getNumberOfHistoriesPerCycle(), 1000 );
+  FRENSIE_CHECK_EQUAL( properties.getNumberOfInactiveCycles(), 30 );
+  FRENSIE_CHECK_EQUAL( properties.getNumberOfActiveCycles(), 100 );
 }
 
 //---------------------------------------------------------------------------//
@@ -178,6 +185,36 @@ FRENSIE_UNIT_TEST( SimulationGeneralProperties, setNumberOfSnapshotsPerBatch )
   FRENSIE_CHECK_EQUAL( properties.getNumberOfSnapshotsPerBatch(), 2 );
 }
 
+//---------------------------------------------------------------------------//
+// Test that the max number of snapshots can be set
+FRENSIE_UNIT_TEST( SimulationGeneralProperties, setMaxNumberOfSnapshots )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setMaxNumberOfSnapshots( 100 );
+
+  FRENSIE_CHECK_EQUAL( properties.getMaxNumberOfSnapshots(), 100 );
+
+  FRENSIE_CHECK_THROW( properties.setMaxNumberOfSnapshots( 0 ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Test that discard oldest snapshots mode can be turned on/off
+FRENSIE_UNIT_TEST( SimulationGeneralProperties,
+                   setDiscardOldestSnapshotsModeOnOff )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setDiscardOldestSnapshotsModeOn();
+
+  FRENSIE_CHECK( properties.isDiscardOldestSnapshotsModeOn() );
+
+  properties.setThinSnapshotsModeOn();
+
+  FRENSIE_CHECK( !properties.isDiscardOldestSnapshotsModeOn() );
+}
+
 //---------------------------------------------------------------------------//
 // Test that implicit capture mode can be turned on/off
 FRENSIE_UNIT_TEST( SimulationGeneralProperties, setImplicitCaptureModeOnOff )
@@ -193,6 +230,44 @@ FRENSIE_UNIT_TEST( SimulationGeneralProperties, setImplicitCaptureModeOnOff )
   FRENSIE_CHECK( !properties.isImplicitCaptureModeOn() );
 }
 
+//---------------------------------------------------------------------------//
+// Test that k-eigenvalue mode can be turned on/off
+FRENSIE_UNIT_TEST( SimulationGeneralProperties, setKEigenvalueModeOnOff )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setKEigenvalueModeOn();
+
+  FRENSIE_CHECK( properties.isKEigenvalueModeOn() );
+
+  properties.setFixedSourceModeOn();
+
+  FRENSIE_CHECK( !properties.isKEigenvalueModeOn() );
+}
+
+//---------------------------------------------------------------------------//
+// Test that the k-eigenvalue cycle parameters can be set
+FRENSIE_UNIT_TEST( SimulationGeneralProperties, setCycleParameters )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setNumberOfHistoriesPerCycle( 10000000 );
+
+  FRENSIE_CHECK_EQUAL( properties.getNumberOfHistoriesPerCycle(), 10000000 );
+  FRENSIE_CHECK_THROW( properties.setNumberOfHistoriesPerCycle( 0 ),
+                       std::runtime_error );
+
+  properties.setNumberOfInactiveCycles( 0 );
+
+  FRENSIE_CHECK_EQUAL( properties.getNumberOfInactiveCycles(), 0 );
+
+  properties.setNumberOfActiveCycles( 250 );
+
+  FRENSIE_CHECK_EQUAL( properties.getNumberOfActiveCycles(), 250 );
+  FRENSIE_CHECK_THROW( properties.setNumberOfActiveCycles( 0 ),
+                       std::runtime_error );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the properties can be archived
 FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationGeneralProperties,
@@ -225,7 +300,13 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationGeneralProperties,
     custom_properties.setMaxBatchSize( 100000000 );
     custom_properties.setNumberOfBatchesPerProcessor( 25 );
     custom_properties.setNumberOfSnapshotsPerBatch( 3 );
+    custom_properties.setMaxNumberOfSnapshots( 50 );
+    custom_properties.setDiscardOldestSnapshotsModeOn();
     custom_properties.setImplicitCaptureModeOn();
+    custom_properties.setKEigenvalueModeOn();
+    custom_properties.setNumberOfHistoriesPerCycle( 50000 );
+    custom_properties.setNumberOfInactiveCycles( 10 );
+    custom_properties.setNumberOfActiveCycles( 40 );
 
     FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( default_properties ) );
     FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( custom_properties ) );
@@ -256,7 +337,14 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationGeneralProperties,
   FRENSIE_CHECK_EQUAL( default_properties.getMaxBatchSize(), 1000000000 );
   FRENSIE_CHECK_EQUAL( default_properties.getNumberOfBatchesPerProcessor(), 1 );
   FRENSIE_CHECK_EQUAL( default_properties.getNumberOfSnapshotsPerBatch(), 1 );
+  FRENSIE_CHECK_EQUAL( default_properties.getMaxNumberOfSnapshots(),
+                       Utility::QuantityTraits<uint64_t>::max() );
+  FRENSIE_CHECK( !default_properties.isDiscardOldestSnapshotsModeOn() );
   FRENSIE_CHECK( !default_properties.isImplicitCaptureModeOn() );
+  FRENSIE_CHECK( !default_properties.isKEigenvalueModeOn() );
+  FRENSIE_CHECK_EQUAL( default_properties.getNumberOfHistoriesPerCycle(), 1000 );
+  FRENSIE_CHECK_EQUAL( default_properties.getNumberOfInactiveCycles(), 30 );
+  FRENSIE_CHECK_EQUAL( default_properties.getNumberOfActiveCycles(), 100 );
 
   MonteCarlo::SimulationGeneralProperties custom_properties;
 
@@ -274,7 +362,13 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationGeneralProperties,
   FRENSIE_CHECK_EQUAL( custom_properties.getMaxBatchSize(), 100000000 );
   FRENSIE_CHECK_EQUAL( custom_properties.getNumberOfBatchesPerProcessor(), 25 );
   FRENSIE_CHECK_EQUAL( custom_properties.getNumberOfSnapshotsPerBatch(), 3 );
+  FRENSIE_CHECK_EQUAL( custom_properties.getMaxNumberOfSnapshots(), 50 );
+  FRENSIE_CHECK( custom_properties.isDiscardOldestSnapshotsModeOn() );
   FRENSIE_CHECK( custom_properties.isImplicitCaptureModeOn() );
+  FRENSIE_CHECK( custom_properties.isKEigenvalueModeOn() );
+  FRENSIE_CHECK_EQUAL( custom_properties.getNumberOfHistoriesPerCycle(), 50000 );
+  FRENSIE_CHECK_EQUAL( custom_properties.getNumberOfInactiveCycles(), 10 );
+  FRENSIE_CHECK_EQUAL( custom_properties.getNumberOfActiveCycles(), 40 );
 }
 
 //---------------------------------------------------------------------------//
@@ -37,6 +37,7 @@ FRENSIE_UNIT_TEST( SimulationNeutronProperties, defaults )
   FRENSIE_CHECK( properties.isUnresolvedResonanceProbabilityTableModeOn() );
   FRENSIE_CHECK_SMALL( properties.getNeutronRouletteThresholdWeight(), 1e-30 );
   FRENSIE_CHECK_SMALL( properties.getNeutronRouletteSurvivalWeight(), 1e-30 );
+  FRENSIE_CHECK( !properties.isNeutronImplicitCaptureModeOn() );
 }
 
 //---------------------------------------------------------------------------//
@@ -130,6 +131,22 @@ FRENSIE_UNIT_TEST( SimulationNeutronProperties,
                        weight );
 }
 
+//---------------------------------------------------------------------------//
+// Test that the neutron capture mode can be toggled
+FRENSIE_UNIT_TEST( SimulationNeutronProperties,
+                   setNeutronImplicitCaptureModeOn_AnalogueCaptureModeOn )
+{
+  MonteCarlo::SimulationNeutronProperties properties;
+
+  properties.setNeutronImplicitCaptureModeOn();
+
+  FRENSIE_CHECK( properties.isNeutronImplicitCaptureModeOn() );
+
+  properties.setNeutronAnalogueCaptureModeOn();
+
+  FRENSIE_CHECK( !properties.isNeutronImplicitCaptureModeOn() );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the properties can be archived
 FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationNeutronProperties,
@@ -160,6 +177,7 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationNeutronProperties,
     custom_properties.setUnresolvedResonanceProbabilityTableModeOff();
     custom_properties.setNeutronRouletteThresholdWeight( 1e-15 );
     custom_properties.setNeutronRouletteSurvivalWeight( 1e-13 );
+    custom_properties.setNeutronImplicitCaptureModeOn();
 
     FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( default_properties ) );
     FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( custom_properties ) );
@@ -186,6 +204,7 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationNeutronProperties,
   FRENSIE_CHECK( default_properties.isUnresolvedResonanceProbabilityTableModeOn() );
   FRENSIE_CHECK_SMALL( default_properties.getNeutronRouletteThresholdWeight(), 1e-30 );
   FRENSIE_CHECK_SMALL( default_properties.getNeutronRouletteSurvivalWeight(), 1e-30  );
+  FRENSIE_CHECK( !default_properties.isNeutronImplicitCaptureModeOn() );
 
   MonteCarlo::SimulationNeutronProperties custom_properties;
 
@@ -200,6 +219,7 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationNeutronProperties,
   FRENSIE_CHECK( !custom_properties.isUnresolvedResonanceProbabilityTableModeOn() );
   FRENSIE_CHECK_EQUAL( custom_properties.getNeutronRouletteThresholdWeight(), 1e-15 );
   FRENSIE_CHECK_EQUAL( custom_properties.getNeutronRouletteSurvivalWeight(), 1e-13 );
+  FRENSIE_CHECK( custom_properties.isNeutronImplicitCaptureModeOn() );
 }
 
 //---------------------------------------------------------------------------//
@@ -36,11 +36,13 @@ FRENSIE_UNIT_TEST( SimulationPhotonProperties, defaults )
   FRENSIE_CHECK_EQUAL( properties.getNumberOfPhotonHashGridBins(), 1000 );
   FRENSIE_CHECK_EQUAL( properties.getIncoherentModelType(),
 		       MonteCarlo::COUPLED_FULL_PROFILE_DB_HYBRID_INCOHERENT_MODEL );
+  FRENSIE_CHECK_EQUAL( properties.getPhotonScatteringAngleTableTolerance(), 0.0 );
   FRENSIE_CHECK( properties.isAtomicRelaxationModeOn() );
   FRENSIE_CHECK( !properties.isDetailedPairProductionModeOn() );
   FRENSIE_CHECK( !properties.isPhotonuclearInteractionModeOn() );
   FRENSIE_CHECK_SMALL( properties.getPhotonRouletteThresholdWeight(), 1e-30 );
   FRENSIE_CHECK_SMALL( properties.getPhotonRouletteSurvivalWeight(), 1e-30 );
+  FRENSIE_CHECK( !properties.isPhotonImplicitCaptureModeOn() );
 }
 
 //---------------------------------------------------------------------------//
@@ -99,6 +101,19 @@ FRENSIE_UNIT_TEST( SimulationPhotonProperties, setIncoherentModelType )
                        MonteCarlo::KN_INCOHERENT_MODEL );
 }
 
+//---------------------------------------------------------------------------//
+// Test that the photon scattering angle table tolerance can be set
+FRENSIE_UNIT_TEST( SimulationPhotonProperties,
+                   setPhotonScatteringAngleTableTolerance )
+{
+  MonteCarlo::SimulationPhotonProperties properties;
+
+  properties.setPhotonScatteringAngleTableTolerance( 1e-3 );
+
+  FRENSIE_CHECK_EQUAL( properties.getPhotonScatteringAngleTableTolerance(),
+                       1e-3 );
+}
+
 //---------------------------------------------------------------------------//
 // Test that atomic relaxation mode can be turned off
 FRENSIE_UNIT_TEST( SimulationPhotonProperties, setAtomicRelaxationModeOffOn )
@@ -174,6 +189,22 @@ FRENSIE_UNIT_TEST( SimulationPhotonProperties,
                        weight );
 }
 
+//---------------------------------------------------------------------------//
+// Test that the photon capture mode can be toggled
+FRENSIE_UNIT_TEST( SimulationPhotonProperties,
+                   setPhotonImplicitCaptureModeOn_AnalogueCaptureModeOn )
+{
+  MonteCarlo::SimulationPhotonProperties properties;
+
+  properties.setPhotonImplicitCaptureModeOn();
+
+  FRENSIE_CHECK( properties.isPhotonImplicitCaptureModeOn() );
+
+  properties.setPhotonAnalogueCaptureModeOn();
+
+  FRENSIE_CHECK( !properties.isPhotonImplicitCaptureModeOn() );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the properties can be archived
 FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationPhotonProperties,
@@ -202,11 +233,13 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationPhotonProperties,
     custom_properties.setKahnSamplingCutoffEnergy( 2.5 );
     custom_properties.setNumberOfPhotonHashGridBins( 500 );
     custom_properties.setIncoherentModelType( MonteCarlo::KN_INCOHERENT_MODEL );
+    custom_properties.setPhotonScatteringAngleTableTolerance( 1e-2 );
     custom_properties.setAtomicRelaxationModeOff();
     custom_properties.setDetailedPairProductionModeOn();
     custom_properties.setPhotonuclearInteractionModeOn();
     custom_properties.setPhotonRouletteThresholdWeight( 1e-15 );
     custom_properties.setPhotonRouletteSurvivalWeight( 1e-13 );
+    custom_properties.setPhotonImplicitCaptureModeOn();
 
     FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( default_properties ) );
     FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( custom_properties ) );
@@ -232,11 +265,13 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationPhotonProperties,
   FRENSIE_CHECK_EQUAL( default_properties.getNumberOfPhotonHashGridBins(), 1000 );
   FRENSIE_CHECK_EQUAL( default_properties.getIncoherentModelType(),
 		       MonteCarlo::COUPLED_FULL_PROFILE_DB_HYBRID_INCOHERENT_MODEL );
+  FRENSIE_CHECK_EQUAL( default_properties.getPhotonScatteringAngleTableTolerance(), 0.0 );
   FRENSIE_CHECK( default_properties.isAtomicRelaxationModeOn() );
   FRENSIE_CHECK( !default_properties.isDetailedPairProductionModeOn() );
   FRENSIE_CHECK( !default_properties.isPhotonuclearInteractionModeOn() );
   FRENSIE_CHECK_SMALL( default_properties.getPhotonRouletteThresholdWeight(), 1e-30 );
   FRENSIE_CHECK_SMALL( default_properties.getPhotonRouletteSurvivalWeight(), 1e-30  );
+  FRENSIE_CHECK( !default_properties.isPhotonImplicitCaptureModeOn() );
 
   MonteCarlo::SimulationPhotonProperties custom_properties;
 
@@ -250,11 +285,13 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationPhotonProperties,
   FRENSIE_CHECK_EQUAL( custom_properties.getNumberOfPhotonHashGridBins(), 500 );
   FRENSIE_CHECK_EQUAL( custom_properties.getIncoherentModelType(),
 		       MonteCarlo::KN_INCOHERENT_MODEL );
+  FRENSIE_CHECK_EQUAL( custom_properties.getPhotonScatteringAngleTableTolerance(), 1e-2 );
   FRENSIE_CHECK( !custom_properties.isAtomicRelaxationModeOn() );
   FRENSIE_CHECK( custom_properties.isDetailedPairProductionModeOn() );
   FRENSIE_CHECK( custom_properties.isPhotonuclearInteractionModeOn() );
   FRENSIE_CHECK_EQUAL( custom_properties.getPhotonRouletteThresholdWeight(), 1e-15 );
   FRENSIE_CHECK_EQUAL( custom_properties.getPhotonRouletteSurvivalWeight(), 1e-13 );
+  FRENSIE_CHECK( custom_properties.isPhotonImplicitCaptureModeOn() );
 }
 
 //---------------------------------------------------------------------------//
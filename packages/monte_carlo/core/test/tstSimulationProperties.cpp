@@ -179,6 +179,43 @@ FRENSIE_UNIT_TEST( SimulationProperties, setAtomicRelaxationModeOffOn )
   FRENSIE_CHECK( properties.isAtomicRelaxationModeOn( MonteCarlo::ELECTRON ) );
 }
 
+//---------------------------------------------------------------------------//
+// Test that implicit capture mode can be set for individual particles
+FRENSIE_UNIT_TEST( SimulationProperties, setImplicitCaptureModeOn_particle )
+{
+  MonteCarlo::SimulationProperties properties;
+
+  FRENSIE_CHECK( !properties.isImplicitCaptureModeOn( MonteCarlo::NEUTRON ) );
+  FRENSIE_CHECK( !properties.isImplicitCaptureModeOn( MonteCarlo::PHOTON ) );
+
+  properties.setImplicitCaptureModeOn( MonteCarlo::NEUTRON );
+
+  FRENSIE_CHECK( !properties.isImplicitCaptureModeOn() );
+  FRENSIE_CHECK( properties.isImplicitCaptureModeOn( MonteCarlo::NEUTRON ) );
+  FRENSIE_CHECK( !properties.isImplicitCaptureModeOn( MonteCarlo::PHOTON ) );
+  FRENSIE_CHECK( !properties.isImplicitCaptureModeOn( MonteCarlo::ELECTRON ) );
+
+  properties.setImplicitCaptureModeOn( MonteCarlo::PHOTON );
+
+  FRENSIE_CHECK( properties.isImplicitCaptureModeOn( MonteCarlo::PHOTON ) );
+
+  properties.setAnalogueCaptureModeOn( MonteCarlo::NEUTRON );
+  properties.setAnalogueCaptureModeOn( MonteCarlo::PHOTON );
+
+  FRENSIE_CHECK( !properties.isImplicitCaptureModeOn( MonteCarlo::NEUTRON ) );
+  FRENSIE_CHECK( !properties.isImplicitCaptureModeOn( MonteCarlo::PHOTON ) );
+
+  // The global mode takes precedence over the particle mode
+  properties.setImplicitCaptureModeOn();
+
+  FRENSIE_CHECK( properties.isImplicitCaptureModeOn( MonteCarlo::NEUTRON ) );
+  FRENSIE_CHECK( properties.isImplicitCaptureModeOn( MonteCarlo::PHOTON ) );
+  FRENSIE_CHECK( properties.isImplicitCaptureModeOn( MonteCarlo::ELECTRON ) );
+
+  FRENSIE_CHECK_THROW( properties.setImplicitCaptureModeOn( MonteCarlo::ELECTRON ),
+                       std::logic_error );
+}
+
 //---------------------------------------------------------------------------//
 // Test that the roulette threshold weight can be returned
 FRENSIE_UNIT_TEST( SimulationProperties, getRouletteThresholdWeight )
@@ -0,0 +1,175 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstTransportProfiler.cpp
+//! \author Alex Robinson
+//! \brief  Transport stage timer and event counter unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <sstream>
+#include <string>
+
+// FRENSIE Includes
+#include "MonteCarlo_TransportProfiler.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the collision stage associated with a particle type can be
+// returned
+FRENSIE_UNIT_TEST( TransportProfiler, getCollisionStage )
+{
+  FRENSIE_CHECK_EQUAL( MonteCarlo::TransportProfiler::getCollisionStage( MonteCarlo::PHOTON ),
+                       MonteCarlo::TransportProfiler::PHOTON_COLLISION_STAGE );
+  FRENSIE_CHECK_EQUAL( MonteCarlo::TransportProfiler::getCollisionStage( MonteCarlo::NEUTRON ),
+                       MonteCarlo::TransportProfiler::NEUTRON_COLLISION_STAGE );
+  FRENSIE_CHECK_EQUAL( MonteCarlo::TransportProfiler::getCollisionStage( MonteCarlo::ELECTRON ),
+                       MonteCarlo::TransportProfiler::ELECTRON_COLLISION_STAGE );
+  FRENSIE_CHECK_EQUAL( MonteCarlo::TransportProfiler::getCollisionStage( MonteCarlo::POSITRON ),
+                       MonteCarlo::TransportProfiler::POSITRON_COLLISION_STAGE );
+  FRENSIE_CHECK_EQUAL( MonteCarlo::TransportProfiler::getCollisionStage( MonteCarlo::ADJOINT_PHOTON ),
+                       MonteCarlo::TransportProfiler::ADJOINT_PHOTON_COLLISION_STAGE );
+  FRENSIE_CHECK_EQUAL( MonteCarlo::TransportProfiler::getCollisionStage( MonteCarlo::ADJOINT_NEUTRON ),
+                       MonteCarlo::TransportProfiler::ADJOINT_NEUTRON_COLLISION_STAGE );
+  FRENSIE_CHECK_EQUAL( MonteCarlo::TransportProfiler::getCollisionStage( MonteCarlo::ADJOINT_ELECTRON ),
+                       MonteCarlo::TransportProfiler::ADJOINT_ELECTRON_COLLISION_STAGE );
+  FRENSIE_CHECK_EQUAL( MonteCarlo::TransportProfiler::getCollisionStage( MonteCarlo::ADJOINT_POSITRON ),
+                       MonteCarlo::TransportProfiler::ADJOINT_POSITRON_COLLISION_STAGE );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the stage names can be returned
+FRENSIE_UNIT_TEST( TransportProfiler, getStageName )
+{
+  FRENSIE_CHECK_EQUAL( MonteCarlo::TransportProfiler::getStageName( MonteCarlo::TransportProfiler::RAY_FIRE_STAGE ),
+                       "ray_fire" );
+  FRENSIE_CHECK_EQUAL( MonteCarlo::TransportProfiler::getStageName( MonteCarlo::TransportProfiler::CROSS_SECTION_LOOKUP_STAGE ),
+                       "cross_section_lookup" );
+  FRENSIE_CHECK_EQUAL( MonteCarlo::TransportProfiler::getStageName( MonteCarlo::TransportProfiler::NEUTRON_COLLISION_STAGE ),
+                       "neutron_collision" );
+  FRENSIE_CHECK_EQUAL( MonteCarlo::TransportProfiler::getStageName( MonteCarlo::TransportProfiler::PARTICLE_CROSSING_SURFACE_DISPATCH_STAGE ),
+                       "particle_crossing_surface_dispatch" );
+  FRENSIE_CHECK_EQUAL( MonteCarlo::TransportProfiler::getStageName( MonteCarlo::TransportProfiler::BANK_POP_STAGE ),
+                       "bank_pop" );
+}
+
+//---------------------------------------------------------------------------//
+// Check that stage events can be recorded
+FRENSIE_UNIT_TEST( TransportProfiler, recordStage )
+{
+  MonteCarlo::TransportProfiler::reset();
+
+  MonteCarlo::TransportProfiler::recordStage( MonteCarlo::TransportProfiler::RAY_FIRE_STAGE, 1000 );
+  MonteCarlo::TransportProfiler::recordStage( MonteCarlo::TransportProfiler::RAY_FIRE_STAGE, 500 );
+  MonteCarlo::TransportProfiler::countStage( MonteCarlo::TransportProfiler::BANK_PUSH_STAGE );
+
+  FRENSIE_CHECK_EQUAL( MonteCarlo::TransportProfiler::getStageCount( MonteCarlo::TransportProfiler::RAY_FIRE_STAGE ), 2 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( MonteCarlo::TransportProfiler::getStageTime( MonteCarlo::TransportProfiler::RAY_FIRE_STAGE ),
+                                   1.5e-6,
+                                   1e-12 );
+  FRENSIE_CHECK_EQUAL( MonteCarlo::TransportProfiler::getStageCount( MonteCarlo::TransportProfiler::BANK_PUSH_STAGE ), 1 );
+  FRENSIE_CHECK_EQUAL( MonteCarlo::TransportProfiler::getStageTime( MonteCarlo::TransportProfiler::BANK_PUSH_STAGE ), 0.0 );
+  FRENSIE_CHECK_EQUAL( MonteCarlo::TransportProfiler::getStageCount( MonteCarlo::TransportProfiler::BANK_POP_STAGE ), 0 );
+
+  MonteCarlo::TransportProfiler::reset();
+
+  FRENSIE_CHECK_EQUAL( MonteCarlo::TransportProfiler::getStageCount( MonteCarlo::TransportProfiler::RAY_FIRE_STAGE ), 0 );
+  FRENSIE_CHECK_EQUAL( MonteCarlo::TransportProfiler::getStageTime( MonteCarlo::TransportProfiler::RAY_FIRE_STAGE ), 0.0 );
+  FRENSIE_CHECK_EQUAL( MonteCarlo::TransportProfiler::getStageCount( MonteCarlo::TransportProfiler::BANK_PUSH_STAGE ), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a scoped stage timer records a stage event
+FRENSIE_UNIT_TEST( TransportProfiler, ScopedStageTimer )
+{
+  MonteCarlo::TransportProfiler::reset();
+
+  {
+    MonteCarlo::TransportProfiler::ScopedStageTimer
+      timer( MonteCarlo::TransportProfiler::SOURCE_SAMPLING_STAGE );
+  }
+
+  FRENSIE_CHECK_EQUAL( MonteCarlo::TransportProfiler::getStageCount( MonteCarlo::TransportProfiler::SOURCE_SAMPLING_STAGE ), 1 );
+  FRENSIE_CHECK( MonteCarlo::TransportProfiler::getStageTime( MonteCarlo::TransportProfiler::SOURCE_SAMPLING_STAGE ) >= 0.0 );
+
+  MonteCarlo::TransportProfiler::reset();
+}
+
+//---------------------------------------------------------------------------//
+// Check that each thread can record stage events
+FRENSIE_UNIT_TEST( TransportProfiler, enableThreadSupport )
+{
+  MonteCarlo::TransportProfiler::enableThreadSupport( Utility::OpenMPProperties::getRequestedNumberOfThreads() );
+  MonteCarlo::TransportProfiler::reset();
+
+  #pragma omp parallel num_threads( Utility::OpenMPProperties::getRequestedNumberOfThreads() )
+  {
+    for( size_t i = 0; i < 1000; ++i )
+      MonteCarlo::TransportProfiler::countStage( MonteCarlo::TransportProfiler::BANK_POP_STAGE );
+  }
+
+  FRENSIE_CHECK_EQUAL( MonteCarlo::TransportProfiler::getStageCount( MonteCarlo::TransportProfiler::BANK_POP_STAGE ),
+                       1000*Utility::OpenMPProperties::getRequestedNumberOfThreads() );
+
+  MonteCarlo::TransportProfiler::reset();
+}
+
+//---------------------------------------------------------------------------//
+// Check that the report can be exported
+FRENSIE_UNIT_TEST( TransportProfiler, exportReport )
+{
+  MonteCarlo::TransportProfiler::enableThreadSupport( 1 );
+  MonteCarlo::TransportProfiler::reset();
+
+  MonteCarlo::TransportProfiler::recordStage( MonteCarlo::TransportProfiler::PHOTON_COLLISION_STAGE, 2000000000 );
+
+  std::ostringstream oss;
+
+  MonteCarlo::TransportProfiler::exportReport( oss, MonteCarlo::TransportProfiler::JSON_REPORT_FORMAT, 3 );
+
+  FRENSIE_CHECK( oss.str().find( "\"rank\": 3" ) != std::string::npos );
+  FRENSIE_CHECK( oss.str().find( "\"photon_collision\": {\"count\": 1, \"time\": 2," ) != std::string::npos );
+  FRENSIE_CHECK( oss.str().find( "\"bank_pop\": {\"count\": 0" ) != std::string::npos );
+
+  oss.str( "" );
+  oss.clear();
+
+  MonteCarlo::TransportProfiler::exportReport( oss, MonteCarlo::TransportProfiler::CSV_REPORT_FORMAT, 3 );
+
+  FRENSIE_CHECK( oss.str().find( "rank,thread,stage,count,time\n" ) == 0 );
+  FRENSIE_CHECK( oss.str().find( "3,0,photon_collision,1,2\n" ) != std::string::npos );
+  FRENSIE_CHECK( oss.str().find( "3,0,ray_fire,0,0\n" ) != std::string::npos );
+
+  MonteCarlo::TransportProfiler::reset();
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+int threads;
+
+FRENSIE_CUSTOM_UNIT_TEST_COMMAND_LINE_OPTIONS()
+{
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "threads",
+                                        threads, 1,
+                                        "Number of threads to use" );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // Set up the global OpenMP session
+  if( Utility::OpenMPProperties::isOpenMPUsed() )
+    Utility::OpenMPProperties::setNumberOfThreads( threads );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstTransportProfiler.cpp
+//---------------------------------------------------------------------------//
@@ -8,13 +8,13 @@
 
 // Std Lib Includes
 #include <functional>
-#include <numeric>
 
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp"
 #include "MonteCarlo_ParticleHistorySimulationCompletionCriterion.hpp"
 #include "Utility_GlobalMPISession.hpp"
 #include "Utility_OpenMPProperties.hpp"
+#include "Utility_PerThread.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
 
 namespace MonteCarlo{
@@ -46,9 +46,7 @@ public:
     // Make sure only the root thread calls this
     testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
     
-    return std::accumulate( d_num_completed_histories.begin(),
-                            d_num_completed_histories.end(),
-                            0ull );
+    return d_num_completed_histories.reduce( 0ull, std::plus<uint64_t>() );
   }
 
   //! Check if the simulation is complete
@@ -84,8 +82,7 @@ public:
     // Make sure only the root thread calls this
     testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
     
-    for( size_t i = 0; i < d_num_completed_histories.size(); ++i )
-      d_num_completed_histories[i] = 0;
+    d_num_completed_histories.fill( 0 );
   }
 
   //! Enable support for multiple threads
@@ -109,7 +106,7 @@ public:
                       d_num_completed_histories.size() );
     
     if( d_count_histories )
-      ++d_num_completed_histories[Utility::OpenMPProperties::getThreadId()];
+      ++d_num_completed_histories.local();
   }
 
   //! Reset the observer data
@@ -214,7 +211,7 @@ private:
   friend class boost::serialization::access;
 
   // The number of completed histories
-  std::vector<uint64_t> d_num_completed_histories;
+  Utility::PerThread<uint64_t> d_num_completed_histories;
 
   // The history wall
   uint64_t d_history_wall;
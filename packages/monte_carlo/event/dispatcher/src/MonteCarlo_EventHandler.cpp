@@ -8,7 +8,7 @@
 
 // Std Lib Includes
 #include <sstream>
-#include <numeric>
+#include <functional>
 
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp"
@@ -388,6 +388,31 @@ void EventHandler::setSimulationCompletionCriterion(
   this->setSimulationCompletionCriterion( this->createDefaultCompletionCriterion( properties ) );
 }
 
+// Set the max number of snapshots that each estimator will keep
+/*! \details The limit and the snapshot limiting mode will only be applied
+ * to the estimators that have already been added. If the properties do not
+ * limit the number of snapshots the estimators will not be changed (any
+ * limit set directly on an estimator will be kept).
+ */
+void EventHandler::setMaxNumberOfEstimatorSnapshots(
+                    const MonteCarlo::SimulationGeneralProperties& properties )
+{
+  if( properties.getMaxNumberOfSnapshots() <
+      Utility::QuantityTraits<uint64_t>::max() )
+  {
+    for( auto&& estimator_data : d_estimators )
+    {
+      estimator_data.second->setMaxNumberOfSnapshots(
+                                       properties.getMaxNumberOfSnapshots() );
+
+      if( properties.isDiscardOldestSnapshotsModeOn() )
+        estimator_data.second->setDiscardOldestSnapshotsModeOn();
+      else
+        estimator_data.second->setThinSnapshotsModeOn();
+    }
+  }
+}
+
 // Update the simulation completion criterion observer
 void EventHandler::updateSimulationCompletionCriterionObserver( const std::shared_ptr<ParticleHistorySimulationCompletionCriterion>& observer )
 {
@@ -552,8 +577,8 @@ void EventHandler::commitObserverHistoryContributions()
     ++it;
   }
 
-  ++d_number_of_committed_histories[Utility::OpenMPProperties::getThreadId()];
-  ++d_number_of_committed_histories_from_last_snapshot[Utility::OpenMPProperties::getThreadId()];
+  ++d_number_of_committed_histories.local();
+  ++d_number_of_committed_histories_from_last_snapshot.local();
 }
 
 // Take a snapshot of the observer states
@@ -627,8 +652,7 @@ void EventHandler::resetObserverData()
   testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
 
   // Reset the committed histories
-  for( size_t i = 0; i < d_number_of_committed_histories.size(); ++i )
-    d_number_of_committed_histories[i] = 0;
+  d_number_of_committed_histories.fill( 0 );
 
   // Reset the observers
   ParticleHistoryObservers::iterator it =
@@ -668,11 +692,9 @@ void EventHandler::reduceObserverData( const Utility::Communicator& comm,
                          std::plus<uint64_t>(),
                          root_process );
         
+        d_number_of_committed_histories.fill( 0 );
         d_number_of_committed_histories.front() =
           reduced_num_committed_histories;
-
-        for( size_t i = 1; i < d_number_of_committed_histories.size(); ++i )
-          d_number_of_committed_histories[i] = 0;
       }
       else
       {
@@ -682,10 +704,7 @@ void EventHandler::reduceObserverData( const Utility::Communicator& comm,
                          root_process );
 
         // Reset the number of committed histories
-        for( size_t i = 0; i < d_number_of_committed_histories.size(); ++i )
-          d_number_of_committed_histories[i] = 0;
-
-        
+        d_number_of_committed_histories.fill( 0 );
       }
     }
     EXCEPTION_CATCH_RETHROW( std::runtime_error,
@@ -718,24 +737,21 @@ void EventHandler::reduceObserverData( const Utility::Communicator& comm,
 // Get the number of particle histories that have been simulated
 uint64_t EventHandler::getNumberOfCommittedHistories() const
 {
-  return std::accumulate( d_number_of_committed_histories.begin(),
-                          d_number_of_committed_histories.end(),
-                          0ull );
+  return d_number_of_committed_histories.reduce( 0ull,
+                                                std::plus<uint64_t>() );
 }
 
 // Get the number of particle histories committed since the last snapshot
 uint64_t EventHandler::getNumberOfCommittedHistoriesSinceLastSnapshot() const
 {
-  return std::accumulate( d_number_of_committed_histories_from_last_snapshot.begin(),
-                          d_number_of_committed_histories_from_last_snapshot.end(),
-                          0ull );
+  return d_number_of_committed_histories_from_last_snapshot.reduce(
+                                                    0ull, std::plus<uint64_t>() );
 }
 
 // Reset the number of committed histories since the last snapshot
 void EventHandler::resetNumberOfCommittedHistoriesSinceLastSnapshot()
 {
-  for( size_t i = 0; i < d_number_of_committed_histories_from_last_snapshot.size(); ++i )
-    d_number_of_committed_histories_from_last_snapshot[i] = 0;
+  d_number_of_committed_histories_from_last_snapshot.fill( 0 );
 }
 
 // Get the elapsed time since the last snapshot
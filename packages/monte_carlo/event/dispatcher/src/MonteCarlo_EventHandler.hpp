@@ -23,6 +23,7 @@
 #include "MonteCarlo_ParticleSubtrackEndingGlobalEventHandler.hpp"
 #include "MonteCarlo_ParticleGoneGlobalEventHandler.hpp"
 #include "MonteCarlo_MeshTrackLengthFluxEstimator.hpp"
+#include "MonteCarlo_PointDetectorFluxEstimator.hpp"
 #include "MonteCarlo_ParticleTracker.hpp"
 #include "MonteCarlo_ParticleHistorySimulationCompletionCriterion.hpp"
 #include "MonteCarlo_FilledGeometryModel.hpp"
@@ -30,6 +31,7 @@
 #include "MonteCarlo_SimulationGeneralProperties.hpp"
 #include "Geometry_AdvancedModel.hpp"
 #include "Utility_Vector.hpp"
+#include "Utility_PerThread.hpp"
 
 namespace MonteCarlo{
 
@@ -84,6 +86,9 @@ public:
   //! Set a simulation completion criterion
   void setSimulationCompletionCriterion( const MonteCarlo::SimulationGeneralProperties& properties );
 
+  //! Set the max number of snapshots that each estimator will keep
+  void setMaxNumberOfEstimatorSnapshots( const MonteCarlo::SimulationGeneralProperties& properties );
+
   //! Check if the simulation is complete
   bool isSimulationComplete() const;
 
@@ -190,6 +195,15 @@ private:
           const std::shared_ptr<MeshTrackLengthFluxEstimator<T> >& estimator );
   };
 
+  // Struct for registering estimator
+  template<typename T>
+  struct EstimatorRegistrationHelper<PointDetectorFluxEstimator<T> >
+  {
+    static void registerEstimator(
+          EventHandler& event_handler,
+          const std::shared_ptr<PointDetectorFluxEstimator<T> >& estimator );
+  };
+
   // Add the estimator registration helper as a friend class
   template<typename T>
   friend class EstimatorRegistrationHelper;
@@ -356,10 +370,10 @@ private:
   std::shared_ptr<ParticleHistorySimulationCompletionCriterion> d_simulation_completion_criterion;
 
   // The number of simulated particle histories
-  std::vector<uint64_t> d_number_of_committed_histories;
+  Utility::PerThread<uint64_t> d_number_of_committed_histories;
 
   // The number of simulation particle histories since the last snapshot
-  std::vector<uint64_t> d_number_of_committed_histories_from_last_snapshot;
+  Utility::PerThread<uint64_t> d_number_of_committed_histories_from_last_snapshot;
 
   // The simulation timer (s)
   std::shared_ptr<Utility::Timer> d_simulation_timer;
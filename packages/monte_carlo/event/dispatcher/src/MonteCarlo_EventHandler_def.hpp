@@ -91,6 +91,24 @@ void EventHandler::EstimatorRegistrationHelper<MeshTrackLengthFluxEstimator<T> >
   event_handler.registerGlobalObserver( estimator, particle_types );
 }
 
+// Struct for registering estimator
+/*! \details The detector ids are not cell ids. A point detector estimator
+ * must observe collisions in every cell that is not void.
+ */
+template<typename T>
+void EventHandler::EstimatorRegistrationHelper<PointDetectorFluxEstimator<T> >::registerEstimator(
+           EventHandler& event_handler,
+           const std::shared_ptr<PointDetectorFluxEstimator<T> >& estimator )
+{
+  Geometry::Model::CellIdSet cells;
+
+  event_handler.d_model->getCells( cells, false, false );
+
+  std::set<ParticleType> particle_types = estimator->getParticleTypes();
+
+  event_handler.registerObserver( estimator, cells, particle_types );
+}
+
 // Register an observer with the appropriate dispatcher
 template<typename Observer, typename InputEntityId>
 void EventHandler::registerObserver( const std::shared_ptr<Observer>& observer,
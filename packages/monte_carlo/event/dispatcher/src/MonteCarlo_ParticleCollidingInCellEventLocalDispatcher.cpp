@@ -33,21 +33,14 @@ ParticleCollidingInCellEventLocalDispatcher::dispatchParticleCollidingInCellEven
   // Make sure the cell being collided in is valid
   testPrecondition( cell_of_collision == this->getEntityId() );
 
-  if( this->hasObserverSet( particle.getParticleType() ) )
+  const ObserverList& observer_list =
+    this->getObserverList( particle.getParticleType() );
+
+  for( size_t i = 0; i < observer_list.size(); ++i )
   {
-    ObserverSet& observer_set =
-      this->getObserverSet( particle.getParticleType() );
-  
-    ObserverSet::iterator it = observer_set.begin();
-
-    while( it != observer_set.end() )
-    {
-      (*it)->updateFromParticleCollidingInCellEvent( particle,
-                                                     cell_of_collision,
-                                                     inverse_total_cross_section );
-
-      ++it;
-    }
+    observer_list[i]->updateFromParticleCollidingInCellEvent( particle,
+                                                              cell_of_collision,
+                                                              inverse_total_cross_section );
   }
 }
 
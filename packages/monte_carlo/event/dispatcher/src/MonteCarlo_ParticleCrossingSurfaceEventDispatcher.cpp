@@ -19,13 +19,14 @@ void ParticleCrossingSurfaceEventDispatcher::dispatchParticleCrossingSurfaceEven
                               const Geometry::Model::EntityId surface_crossing,
                               const double angle_cosine )
 {
-  DispatcherMap::iterator it = this->getDispatcherMap().find( surface_crossing );
+  ParticleCrossingSurfaceEventLocalDispatcher* local_dispatcher =
+    this->findLocalDispatcher( surface_crossing );
 
-  if( it != this->getDispatcherMap().end() )
+  if( local_dispatcher )
   {
-    it->second->dispatchParticleCrossingSurfaceEvent( particle,
-						      surface_crossing,
-						      angle_cosine );
+    local_dispatcher->dispatchParticleCrossingSurfaceEvent( particle,
+                                                            surface_crossing,
+                                                            angle_cosine );
   }
 }
 
@@ -32,21 +32,14 @@ void ParticleCrossingSurfaceEventLocalDispatcher::dispatchParticleCrossingSurfac
   // Make sure the surface being crossed is valid
   testPrecondition( surface_crossing == this->getEntityId() );
 
-  if( this->hasObserverSet( particle.getParticleType() ) )
+  const ObserverList& observer_list =
+    this->getObserverList( particle.getParticleType() );
+
+  for( size_t i = 0; i < observer_list.size(); ++i )
   {
-    ObserverSet& observer_set =
-      this->getObserverSet( particle.getParticleType() );
-    
-    ObserverSet::iterator it = observer_set.begin();
-    
-    while( it != observer_set.end() )
-    {
-      (*it)->updateFromParticleCrossingSurfaceEvent( particle,
-                                                     surface_crossing,
-                                                     angle_cosine );
-      
-      ++it;
-    }
+    observer_list[i]->updateFromParticleCrossingSurfaceEvent( particle,
+                                                              surface_crossing,
+                                                              angle_cosine );
   }
 }
 
@@ -31,19 +31,12 @@ void ParticleEnteringCellEventLocalDispatcher::dispatchParticleEnteringCellEvent
   // Make sure the cell being entered is valid
   testPrecondition( cell_entering == this->getEntityId() );
 
-  if( this->hasObserverSet( particle.getParticleType() ) )
+  const ObserverList& observer_list =
+    this->getObserverList( particle.getParticleType() );
+
+  for( size_t i = 0; i < observer_list.size(); ++i )
   {
-    ObserverSet& observer_set =
-      this->getObserverSet( particle.getParticleType() );
-    
-    ObserverSet::iterator it = observer_set.begin();
-    
-    while( it != observer_set.end() )
-    {
-      (*it)->updateFromParticleEnteringCellEvent( particle, cell_entering );
-      
-      ++it;
-    }
+    observer_list[i]->updateFromParticleEnteringCellEvent( particle, cell_entering );
   }
 }
 
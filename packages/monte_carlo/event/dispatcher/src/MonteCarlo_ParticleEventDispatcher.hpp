@@ -11,6 +11,7 @@
 
 // Std Lib Includes
 #include <memory>
+#include <vector>
 
 // Boost Includes
 #include <boost/serialization/split_member.hpp>
@@ -26,7 +27,14 @@
 
 namespace MonteCarlo{
 
-//! The particle event dispatcher database base class
+/*! The particle event dispatcher database base class
+ * \details The local dispatchers are stored in a hash map keyed by the
+ * entity id. Since the entity ids of most models are small integers, the
+ * local dispatchers of entities with an id less than the max dense entity
+ * id are also stored in a dense table that is indexed by the entity id.
+ * This allows the local dispatcher of most entities to be found without
+ * hashing when an event is dispatched.
+ */
 template<typename Dispatcher>
 class ParticleEventDispatcher
 {
@@ -73,16 +81,38 @@ protected:
   //! Get the dispatcher map
   DispatcherMap& getDispatcherMap();
 
+  //! Find the local dispatcher for the given entity id (NULL if none)
+  Dispatcher* findLocalDispatcher( const uint64_t entity_id );
+
 private:
 
-  // Serialize the observer
+  // The max entity id that will be stored in the dense dispatcher table
+  static const uint64_t s_max_dense_entity_id = 65535;
+
+  // Add a local dispatcher to the dense dispatcher table
+  void addToDenseDispatcherTable( const uint64_t entity_id,
+                                  Dispatcher* dispatcher );
+
+  // Update the dense dispatcher table
+  void updateDenseDispatcherTable();
+
+  // Save the observer
   template<typename Archive>
-  void serialize( Archive& ar, const unsigned version );
+  void save( Archive& ar, const unsigned version ) const;
+
+  // Load the observer
+  template<typename Archive>
+  void load( Archive& ar, const unsigned version );
+
+  BOOST_SERIALIZATION_SPLIT_MEMBER();
   
   // Declare the boost serialization access object as a friend
   friend class boost::serialization::access;
 
   DispatcherMap d_dispatcher_map;
+
+  // The dense dispatcher table (indexed by entity id)
+  std::vector<Dispatcher*> d_dense_dispatcher_table;
 };
 
 } // end MonteCarlo namespace
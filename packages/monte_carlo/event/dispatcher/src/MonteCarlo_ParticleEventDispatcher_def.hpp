@@ -14,7 +14,8 @@ namespace MonteCarlo{
 // Constructor
 template<typename Dispatcher>
 ParticleEventDispatcher<Dispatcher>::ParticleEventDispatcher()
-  : d_dispatcher_map()
+  : d_dispatcher_map(),
+    d_dense_dispatcher_table()
 { /* ... */ }
 
 // Get the appropriate local dispatcher for the given entity id
@@ -33,6 +34,8 @@ inline Dispatcher& ParticleEventDispatcher<Dispatcher>::getLocalDispatcher(
 
     new_dispatcher.reset( new Dispatcher( entity_id ) );
 
+    this->addToDenseDispatcherTable( entity_id, new_dispatcher.get() );
+
     return *new_dispatcher;
   }
 }
@@ -86,6 +89,7 @@ template<typename Dispatcher>
 void ParticleEventDispatcher<Dispatcher>::detachAllObservers()
 {
   d_dispatcher_map.clear();
+  d_dense_dispatcher_table.clear();
 }
 
 // Get the dispatcher map
@@ -95,14 +99,75 @@ inline auto ParticleEventDispatcher<Dispatcher>::getDispatcherMap() -> Dispatche
   return d_dispatcher_map;
 }
 
-// Serialize the observer
+// Find the local dispatcher for the given entity id (NULL if none)
+template<typename Dispatcher>
+inline Dispatcher* ParticleEventDispatcher<Dispatcher>::findLocalDispatcher(
+                                                     const uint64_t entity_id )
+{
+  if( entity_id < d_dense_dispatcher_table.size() )
+    return d_dense_dispatcher_table[entity_id];
+  else if( entity_id <= s_max_dense_entity_id )
+    return NULL;
+  else
+  {
+    typename DispatcherMap::iterator it = d_dispatcher_map.find( entity_id );
+
+    if( it != d_dispatcher_map.end() )
+      return it->second.get();
+    else
+      return NULL;
+  }
+}
+
+// Add a local dispatcher to the dense dispatcher table
+template<typename Dispatcher>
+void ParticleEventDispatcher<Dispatcher>::addToDenseDispatcherTable(
+                                                    const uint64_t entity_id,
+                                                    Dispatcher* dispatcher )
+{
+  if( entity_id <= s_max_dense_entity_id )
+  {
+    if( entity_id >= d_dense_dispatcher_table.size() )
+      d_dense_dispatcher_table.resize( entity_id+1, NULL );
+
+    d_dense_dispatcher_table[entity_id] = dispatcher;
+  }
+}
+
+// Update the dense dispatcher table
+template<typename Dispatcher>
+void ParticleEventDispatcher<Dispatcher>::updateDenseDispatcherTable()
+{
+  d_dense_dispatcher_table.clear();
+
+  typename DispatcherMap::iterator it = d_dispatcher_map.begin();
+
+  while( it != d_dispatcher_map.end() )
+  {
+    this->addToDenseDispatcherTable( it->first, it->second.get() );
+
+    ++it;
+  }
+}
+
+// Save the observer
 template<typename Dispatcher>
 template<typename Archive>
-void ParticleEventDispatcher<Dispatcher>::serialize( Archive& ar, const unsigned version )
+void ParticleEventDispatcher<Dispatcher>::save( Archive& ar, const unsigned version ) const
 {
   ar & BOOST_SERIALIZATION_NVP( d_dispatcher_map );
 }
 
+// Load the observer
+template<typename Dispatcher>
+template<typename Archive>
+void ParticleEventDispatcher<Dispatcher>::load( Archive& ar, const unsigned version )
+{
+  ar & BOOST_SERIALIZATION_NVP( d_dispatcher_map );
+
+  this->updateDenseDispatcherTable();
+}
+
 } // end MonteCarlo namespace
 
 #endif // end MONTE_CARLO_PARTICLE_EVENT_DISPATCHER_DEF_HPP
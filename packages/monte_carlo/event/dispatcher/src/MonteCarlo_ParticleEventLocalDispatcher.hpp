@@ -11,6 +11,7 @@
 
 // Std Lib Includes
 #include <memory>
+#include <array>
 
 // Boost Includes
 #include <boost/serialization/split_member.hpp>
@@ -27,7 +28,13 @@
 
 namespace MonteCarlo{
 
-//! The particle event dispatcher base class
+/*! The particle event dispatcher base class
+ * \details The attached observers are owned by the observer sets. Every
+ * time that an observer is attached or detached a contiguous list of the
+ * observers of each particle type is rebuilt from the observer sets. The
+ * observer lists are indexed by the particle type, which allows the event
+ * to be dispatched without any map or set look-ups.
+ */
 template<typename Observer>
 class ParticleEventLocalDispatcher
 {
@@ -68,6 +75,9 @@ protected:
   // The observers set
   typedef std::set<std::shared_ptr<Observer> > ObserverSet;
 
+  // The observer list
+  typedef std::vector<Observer*> ObserverList;
+
   //! Default constructor
   ParticleEventLocalDispatcher();
 
@@ -77,11 +87,23 @@ protected:
   // Get the observer map
   ObserverSet& getObserverSet( const ParticleType particle_type );
 
+  // Get the observer list for the particle type
+  const ObserverList& getObserverList( const ParticleType particle_type ) const;
+
 private:
 
-  // Serialize the observer
+  // Update the observer lists
+  void updateObserverLists();
+
+  // Save the observer
   template<typename Archive>
-  void serialize( Archive& ar, const unsigned version );
+  void save( Archive& ar, const unsigned version ) const;
+
+  // Load the observer
+  template<typename Archive>
+  void load( Archive& ar, const unsigned version );
+
+  BOOST_SERIALIZATION_SPLIT_MEMBER();
   
   // Declare the boost serialization access object as a friend
   friend class boost::serialization::access;
@@ -91,6 +113,9 @@ private:
 
   // The particle type observer set
   std::map<int,ObserverSet> d_observer_sets;
+
+  // The particle type observer lists (indexed by particle type)
+  std::array<ObserverList,ParticleType_END> d_observer_lists;
 };
 
 } // end MonteCarlo namespace
@@ -24,7 +24,8 @@ template<typename Observer>
 ParticleEventLocalDispatcher<Observer>::ParticleEventLocalDispatcher(
 						     const uint64_t entity_id )
   : d_entity_id( entity_id ),
-    d_observer_sets()
+    d_observer_sets(),
+    d_observer_lists()
 { /* ... */ }
 
 // Attach an observer to the dispatcher
@@ -35,6 +36,8 @@ void ParticleEventLocalDispatcher<Observer>::attachObserver(
 {
   for( auto&& particle_type : particle_types )
     d_observer_sets[particle_type].insert( observer );
+
+  this->updateObserverLists();
 }
 
 // Attach an observer to the dispatcher
@@ -44,6 +47,8 @@ void ParticleEventLocalDispatcher<Observer>::attachObserver(
 {
   for( int i = ParticleType_START; i < ParticleType_END; ++i )
     d_observer_sets[i].insert( observer );
+
+  this->updateObserverLists();
 }
 
 // Detach an observer from the dispatcher
@@ -60,6 +65,8 @@ void ParticleEventLocalDispatcher<Observer>::detachObserver(
 
     ++particle_observer_sets_it;
   }
+
+  this->updateObserverLists();
 }
 
 // Detach all observers
@@ -67,6 +74,8 @@ template<typename Observer>
 void ParticleEventLocalDispatcher<Observer>::detachAllObservers()
 {
   d_observer_sets.clear();
+
+  this->updateObserverLists();
 }
 
 // Get the entity id corresponding to this particle event dispatcher
@@ -106,13 +115,58 @@ inline auto ParticleEventLocalDispatcher<Observer>::getObserverSet(
   return d_observer_sets[particle_types];
 }
 
-// Serialize the observer
+// Get the observer list for the particle type
+template<typename Observer>
+inline auto ParticleEventLocalDispatcher<Observer>::getObserverList(
+                const ParticleType particle_type ) const -> const ObserverList&
+{
+  // Make sure the particle type is valid
+  testPrecondition( particle_type < ParticleType_END );
+
+  return d_observer_lists[particle_type];
+}
+
+// Update the observer lists
+template<typename Observer>
+void ParticleEventLocalDispatcher<Observer>::updateObserverLists()
+{
+  for( int i = ParticleType_START; i < ParticleType_END; ++i )
+  {
+    d_observer_lists[i].clear();
+
+    typename std::map<int,ObserverSet>::const_iterator
+      particle_observer_sets_it = d_observer_sets.find( i );
+
+    if( particle_observer_sets_it != d_observer_sets.end() )
+    {
+      d_observer_lists[i].reserve( particle_observer_sets_it->second.size() );
+
+      for( auto&& observer : particle_observer_sets_it->second )
+        d_observer_lists[i].push_back( observer.get() );
+    }
+
+    d_observer_lists[i].shrink_to_fit();
+  }
+}
+
+// Save the observer
+template<typename Observer>
+template<typename Archive>
+void ParticleEventLocalDispatcher<Observer>::save( Archive& ar, const unsigned version ) const
+{
+  ar & BOOST_SERIALIZATION_NVP( d_entity_id );
+  ar & BOOST_SERIALIZATION_NVP( d_observer_sets );
+}
+
+// Load the observer
 template<typename Observer>
 template<typename Archive>
-void ParticleEventLocalDispatcher<Observer>::serialize( Archive& ar, const unsigned version )
+void ParticleEventLocalDispatcher<Observer>::load( Archive& ar, const unsigned version )
 {
   ar & BOOST_SERIALIZATION_NVP( d_entity_id );
   ar & BOOST_SERIALIZATION_NVP( d_observer_sets );
+
+  this->updateObserverLists();
 }
 
 } // end MonteCarlo namespace
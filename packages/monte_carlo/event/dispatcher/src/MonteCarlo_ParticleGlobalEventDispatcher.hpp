@@ -11,6 +11,7 @@
 
 // Std Lib Includes
 #include <memory>
+#include <array>
 
 // Boost Includes
 #include <boost/serialization/split_member.hpp>
@@ -27,7 +28,11 @@
 
 namespace MonteCarlo{
 
-//! The particle global event dispatcher base class
+/*! The particle global event dispatcher base class
+ * \details A contiguous list of the observers of each particle type is
+ * rebuilt from the observer sets every time that an observer is attached or
+ * detached (see MonteCarlo::ParticleEventLocalDispatcher).
+ */
 template<typename Observer>
 class ParticleGlobalEventDispatcher
 {
@@ -71,16 +76,34 @@ protected:
   // Get the oberver map
   ObserverSet& getObserverSet( const ParticleType particle_type );
 
+  // The observer list
+  typedef std::vector<Observer*> ObserverList;
+
+  // Get the observer list for the particle type
+  const ObserverList& getObserverList( const ParticleType particle_type ) const;
+
 private:
 
-  // Serialize the observer
+  // Update the observer lists
+  void updateObserverLists();
+
+  // Save the observer
   template<typename Archive>
-  void serialize( Archive& ar, const unsigned version );
+  void save( Archive& ar, const unsigned version ) const;
+
+  // Load the observer
+  template<typename Archive>
+  void load( Archive& ar, const unsigned version );
+
+  BOOST_SERIALIZATION_SPLIT_MEMBER();
   
   // Declare the boost serialization access object as a friend
   friend class boost::serialization::access;
 
   std::map<int,ObserverSet> d_observer_sets;
+
+  // The particle type observer lists (indexed by particle type)
+  std::array<ObserverList,ParticleType_END> d_observer_lists;
 };
 
 } // end MonteCarlo namespace
@@ -17,7 +17,8 @@ namespace MonteCarlo{
 // Constructor
 template<typename Observer>
 ParticleGlobalEventDispatcher<Observer>::ParticleGlobalEventDispatcher()
-  : d_observer_sets()
+  : d_observer_sets(),
+    d_observer_lists()
 { /* ... */ }
 
 // Attach an observer to the dispatcher
@@ -28,6 +29,8 @@ void ParticleGlobalEventDispatcher<Observer>::attachObserver(
 {
   for( auto&& particle_type : particle_types )
     d_observer_sets[particle_type].insert( observer );
+
+  this->updateObserverLists();
 }
   
 // Attach an observer to the dispatcher
@@ -37,6 +40,8 @@ void ParticleGlobalEventDispatcher<Observer>::attachObserver(
 {
   for( int i = ParticleType_START; i < ParticleType_END; ++i )
     d_observer_sets[i].insert( observer );
+
+  this->updateObserverLists();
 }
 
 // Detach an observer from the dispatcher
@@ -53,6 +58,8 @@ void ParticleGlobalEventDispatcher<Observer>::detachObserver(
 
     ++particle_observer_sets_it;
   }
+
+  this->updateObserverLists();
 }
 
 // Get the number of attached observers
@@ -74,6 +81,8 @@ template<typename Observer>
 void ParticleGlobalEventDispatcher<Observer>::detachAllObservers()
 {
   d_observer_sets.clear();
+
+  this->updateObserverLists();
 }
 
 // Check if there is an observer set for the particle type
@@ -92,14 +101,58 @@ inline auto ParticleGlobalEventDispatcher<Observer>::getObserverSet(
   return d_observer_sets[particle_type];
 }
 
-// Serialize the observer
+// Get the observer list for the particle type
+template<typename Observer>
+inline auto ParticleGlobalEventDispatcher<Observer>::getObserverList(
+                const ParticleType particle_type ) const -> const ObserverList&
+{
+  // Make sure the particle type is valid
+  testPrecondition( particle_type < ParticleType_END );
+
+  return d_observer_lists[particle_type];
+}
+
+// Update the observer lists
+template<typename Observer>
+void ParticleGlobalEventDispatcher<Observer>::updateObserverLists()
+{
+  for( int i = ParticleType_START; i < ParticleType_END; ++i )
+  {
+    d_observer_lists[i].clear();
+
+    typename std::map<int,ObserverSet>::const_iterator
+      particle_observer_sets_it = d_observer_sets.find( i );
+
+    if( particle_observer_sets_it != d_observer_sets.end() )
+    {
+      d_observer_lists[i].reserve( particle_observer_sets_it->second.size() );
+
+      for( auto&& observer : particle_observer_sets_it->second )
+        d_observer_lists[i].push_back( observer.get() );
+    }
+
+    d_observer_lists[i].shrink_to_fit();
+  }
+}
+
+// Save the observer
 template<typename Observer>
 template<typename Archive>
-void ParticleGlobalEventDispatcher<Observer>::serialize( Archive& ar, const unsigned version )
+void ParticleGlobalEventDispatcher<Observer>::save( Archive& ar, const unsigned version ) const
 {
   ar & BOOST_SERIALIZATION_NVP( d_observer_sets );
 }
 
+// Load the observer
+template<typename Observer>
+template<typename Archive>
+void ParticleGlobalEventDispatcher<Observer>::load( Archive& ar, const unsigned version )
+{
+  ar & BOOST_SERIALIZATION_NVP( d_observer_sets );
+
+  this->updateObserverLists();
+}
+
 } // end MonteCarlo namespace
 
 #endif // end MONTE_CARLO_PARTICLE_GLOBAL_EVENT_DISPATCHER_DEF_HPP
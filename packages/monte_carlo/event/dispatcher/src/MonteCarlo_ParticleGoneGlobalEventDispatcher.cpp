@@ -17,19 +17,12 @@ namespace MonteCarlo{
 void ParticleGoneGlobalEventDispatcher::dispatchParticleGoneGlobalEvent(
                                                 const ParticleState& particle )
 {
-  if( this->hasObserverSet( particle.getParticleType() ) )
+  const ObserverList& observer_list =
+    this->getObserverList( particle.getParticleType() );
+
+  for( size_t i = 0; i < observer_list.size(); ++i )
   {
-    ObserverSet& observer_set =
-      this->getObserverSet( particle.getParticleType() );
-    
-    ObserverSet::iterator it = observer_set.begin();
-    
-    while( it != observer_set.end() )
-    {
-      (*it)->updateFromGlobalParticleGoneEvent( particle );
-      
-      ++it;
-    }
+    observer_list[i]->updateFromGlobalParticleGoneEvent( particle );
   }
 }
   
@@ -18,10 +18,11 @@ void ParticleLeavingCellEventDispatcher::dispatchParticleLeavingCellEvent(
                                  const ParticleState& particle,
 	                         const Geometry::Model::EntityId cell_leaving )
 {
-  DispatcherMap::iterator it = this->getDispatcherMap().find( cell_leaving );
+  ParticleLeavingCellEventLocalDispatcher* local_dispatcher =
+    this->findLocalDispatcher( cell_leaving );
 
-  if( it != this->getDispatcherMap().end() )
-    it->second->dispatchParticleLeavingCellEvent( particle, cell_leaving );
+  if( local_dispatcher )
+    local_dispatcher->dispatchParticleLeavingCellEvent( particle, cell_leaving );
 }
   
 } // end MonteCarlo namespace
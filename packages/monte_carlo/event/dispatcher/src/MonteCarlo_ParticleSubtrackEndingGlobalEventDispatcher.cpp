@@ -19,21 +19,14 @@ void ParticleSubtrackEndingGlobalEventDispatcher::dispatchParticleSubtrackEnding
 						 const double start_point[3],
 						 const double end_point[3] )
 {
-  if( this->hasObserverSet( particle.getParticleType() ) )
+  const ObserverList& observer_list =
+    this->getObserverList( particle.getParticleType() );
+
+  for( size_t i = 0; i < observer_list.size(); ++i )
   {
-    ObserverSet& observer_set =
-      this->getObserverSet( particle.getParticleType() );
-  
-    ObserverSet::iterator it = observer_set.begin();
-    
-    while( it != observer_set.end() )
-    {
-      (*it)->updateFromGlobalParticleSubtrackEndingEvent( particle,
-                                                          start_point,
-                                                          end_point );
-      
-      ++it;
-    }
+    observer_list[i]->updateFromGlobalParticleSubtrackEndingEvent( particle,
+                                                                   start_point,
+                                                                   end_point );
   }
 }
 
@@ -32,21 +32,14 @@ void ParticleSubtrackEndingInCellEventLocalDispatcher::dispatchParticleSubtrackE
   // Make sure the cell being collided with is valid
   testPrecondition( cell_of_subtrack == this->getEntityId() );
 
-  if( this->hasObserverSet( particle.getParticleType() ) )
+  const ObserverList& observer_list =
+    this->getObserverList( particle.getParticleType() );
+
+  for( size_t i = 0; i < observer_list.size(); ++i )
   {
-    ObserverSet& observer_set =
-      this->getObserverSet( particle.getParticleType() );
-    
-    ObserverSet::iterator it = observer_set.begin();
-    
-    while( it != observer_set.end() )
-    {
-      (*it)->updateFromParticleSubtrackEndingInCellEvent( particle,
-                                                          cell_of_subtrack,
-                                                          track_length );
-      
-      ++it;
-    }
+    observer_list[i]->updateFromParticleSubtrackEndingInCellEvent( particle,
+                                                                   cell_of_subtrack,
+                                                                   track_length );
   }
 }
 
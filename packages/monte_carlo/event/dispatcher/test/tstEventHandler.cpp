@@ -598,6 +598,42 @@ FRENSIE_UNIT_TEST( EventHandler, getEstimator )
 
 }
 
+//---------------------------------------------------------------------------//
+// Check that the max number of estimator snapshots can be set
+FRENSIE_UNIT_TEST( EventHandler, setMaxNumberOfEstimatorSnapshots )
+{
+  MonteCarlo::EventHandler event_handler;
+
+  event_handler.addEstimator( estimator_1 );
+  event_handler.addEstimator( estimator_2 );
+
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  // The estimators are not changed if the properties do not set a limit
+  estimator_1->setMaxNumberOfSnapshots( 10 );
+
+  event_handler.setMaxNumberOfEstimatorSnapshots( properties );
+
+  FRENSIE_CHECK_EQUAL( estimator_1->getMaxNumberOfSnapshots(), 10 );
+  FRENSIE_CHECK_EQUAL( estimator_2->getMaxNumberOfSnapshots(),
+                       std::numeric_limits<size_t>::max() );
+
+  properties.setMaxNumberOfSnapshots( 20 );
+  properties.setDiscardOldestSnapshotsModeOn();
+
+  event_handler.setMaxNumberOfEstimatorSnapshots( properties );
+
+  FRENSIE_CHECK_EQUAL( estimator_1->getMaxNumberOfSnapshots(), 20 );
+  FRENSIE_CHECK( estimator_1->isDiscardOldestSnapshotsModeOn() );
+  FRENSIE_CHECK_EQUAL( estimator_2->getMaxNumberOfSnapshots(), 20 );
+  FRENSIE_CHECK( estimator_2->isDiscardOldestSnapshotsModeOn() );
+
+  // Restore the estimator defaults
+  estimator_1->setMaxNumberOfSnapshots( std::numeric_limits<size_t>::max() );
+  estimator_1->setThinSnapshotsModeOn();
+  estimator_2->setMaxNumberOfSnapshots( std::numeric_limits<size_t>::max() );
+  estimator_2->setThinSnapshotsModeOn();
+}
 //---------------------------------------------------------------------------//
 // Check that particle trackers can be added
 FRENSIE_UNIT_TEST( EventHandler, addParticleTracker )
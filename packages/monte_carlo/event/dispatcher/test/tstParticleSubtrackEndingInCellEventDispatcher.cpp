@@ -297,6 +297,37 @@ FRENSIE_UNIT_TEST( ParticleSubtrackEndingInCellEventDispatcher,
   }
 }
 
+//---------------------------------------------------------------------------//
+// Check that an event in a cell without a local dispatcher is ignored
+FRENSIE_UNIT_TEST( ParticleSubtrackEndingInCellEventDispatcher,
+                   dispatchParticleSubtrackEndingInCellEvent_no_dispatcher )
+{
+  std::shared_ptr<MonteCarlo::ParticleSubtrackEndingInCellEventDispatcher>
+    dispatcher( new MonteCarlo::ParticleSubtrackEndingInCellEventDispatcher );
+
+  dispatcher->attachObserver( 0, estimator_1->getParticleTypes(), estimator_1 );
+
+  // Create a local dispatcher outside of the dense dispatcher table
+  FRENSIE_CHECK_EQUAL( dispatcher->getLocalDispatcher( 100000 ).getEntityId(),
+                       100000 );
+
+  MonteCarlo::PhotonState photon( 0ull );
+  photon.setWeight( 1.0 );
+  photon.setEnergy( 1.0 );
+
+  dispatcher->dispatchParticleSubtrackEndingInCellEvent( photon, 2, 1.0 );
+  dispatcher->dispatchParticleSubtrackEndingInCellEvent( photon, 100000, 1.0 );
+  dispatcher->dispatchParticleSubtrackEndingInCellEvent( photon, 100001, 1.0 );
+
+  FRENSIE_CHECK( !estimator_1->hasUncommittedHistoryContribution() );
+
+  dispatcher->dispatchParticleSubtrackEndingInCellEvent( photon, 0, 1.0 );
+
+  FRENSIE_CHECK( estimator_1->hasUncommittedHistoryContribution() );
+
+  estimator_1->commitHistoryContribution();
+}
+
 //---------------------------------------------------------------------------//
 // Check that an event dispatcher can be archived
 FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( ParticleSubtrackEndingInCellEventDispatcher,
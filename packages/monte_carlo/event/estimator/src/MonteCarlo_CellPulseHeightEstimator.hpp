@@ -21,6 +21,7 @@
 #include "Utility_Map.hpp"
 #include "Utility_Set.hpp"
 #include "Utility_Vector.hpp"
+#include "Utility_PerThread.hpp"
 #include "Utility_Tuple.hpp"
 
 namespace MonteCarlo{
@@ -45,7 +46,7 @@ class CellPulseHeightEstimator : public EntityEstimator,
   SerialUpdateTracker;
 
   // Typedef for the parallel update tracker
-  typedef std::vector<SerialUpdateTracker> ParallelUpdateTracker;
+  typedef Utility::PerThread<SerialUpdateTracker> ParallelUpdateTracker;
 
 public:
 
@@ -168,7 +169,7 @@ private:
   ParallelUpdateTracker d_update_tracker;
 
   // The generic particle state map (avoids having to make a new map for cont.)
-  std::vector<Estimator::DimensionValueMap> d_dimension_values;
+  Utility::PerThread<Estimator::DimensionValueMap> d_dimension_values;
 };
 
 //! The weight multiplied cell pulse height estimator
@@ -170,8 +170,8 @@ void CellPulseHeightEstimator<ContributionMultiplierPolicy>::commitHistoryContri
   double charge_deposition_in_all_cells = 0.0;
   double source_weight = d_update_tracker[thread_id].first;
 
-  size_t bin_index;
   double bin_contribution;
+  std::vector<double> bin_contributions;
 
   Estimator::DimensionValueMap& thread_dimension_values =
     d_dimension_values[thread_id];
@@ -197,12 +197,11 @@ void CellPulseHeightEstimator<ContributionMultiplierPolicy>::commitHistoryContri
                                             source_weight,
                                             ContributionMultiplierPolicy() );
 
-      for( size_t i = 0; i < bin_indices.size(); ++i )
-      {
-        this->commitHistoryContributionToBinOfEntity( cell_data->first,
-                                                      bin_indices[i],
-                                                      bin_contribution );
-      }
+      bin_contributions.assign( bin_indices.size(), bin_contribution );
+
+      this->commitHistoryContributionToBinsOfEntity( cell_data->first,
+                                                     bin_indices,
+                                                     bin_contributions );
 
       // Add the energy deposition in this cell to the total energy deposition
       energy_deposition_in_all_cells += Utility::get<0>(cell_data->second);
@@ -233,11 +232,10 @@ void CellPulseHeightEstimator<ContributionMultiplierPolicy>::commitHistoryContri
                                             source_weight,
                                             ContributionMultiplierPolicy() );
 
-    for( size_t i = 0; i < bin_indices.size(); ++i )
-    {
-      this->commitHistoryContributionToBinOfTotal( bin_indices[i],
-                                                   bin_contribution );
-    }
+    bin_contributions.assign( bin_indices.size(), bin_contribution );
+
+    this->commitHistoryContributionToBinsOfTotal( bin_indices,
+                                                  bin_contributions );
   }
 
   // Reset the update tracker
@@ -195,12 +195,14 @@ void EntityEstimator::takeSnapshot( const uint64_t num_histories_since_last_snap
     d_estimator_total_bin_data_snapshots.takeSnapshot( num_histories_since_last_snapshot,
                                                        time_since_last_snapshot,
                                                        d_estimator_total_bin_data );
+    this->limitSnapshots( d_estimator_total_bin_data_snapshots );
 
     for( auto&& entity_data : d_entity_estimator_moments_snapshots_map )
     {
       entity_data.second.takeSnapshot( num_histories_since_last_snapshot,
                                        time_since_last_snapshot,
                                        d_entity_estimator_moments_map[entity_data.first] );
+      this->limitSnapshots( entity_data.second );
     }
   }
 }
@@ -218,7 +220,7 @@ void EntityEstimator::getEntityBinMomentSnapshotHistoryValues(
   
   if( d_entity_bin_snapshots_enabled )
   {
-    const std::list<uint64_t>& raw_history_values = 
+    const std::vector<uint64_t>& raw_history_values = 
       d_entity_estimator_moments_snapshots_map.find( entity_id )->second.getSnapshotIndices();
     
     history_values.assign( raw_history_values.begin(),
@@ -239,7 +241,7 @@ void EntityEstimator::getEntityBinMomentSnapshotSamplingTimes(
   
   if( d_entity_bin_snapshots_enabled )
   {
-    const std::list<double>& raw_sampling_time_values = 
+    const std::vector<double>& raw_sampling_time_values = 
       d_entity_estimator_moments_snapshots_map.find( entity_id )->second.getSnapshotSamplingTimes();
     
     sampling_times.assign( raw_sampling_time_values.begin(),
@@ -267,7 +269,7 @@ void EntityEstimator::getEntityBinFirstMomentSnapshots(
 
   if( d_entity_bin_snapshots_enabled )
   {
-    const std::list<double>& moment_snapshots =
+    const std::vector<double>& moment_snapshots =
       Utility::getScoreSnapshots<1>(
             d_entity_estimator_moments_snapshots_map.find( entity_id )->second,
             bin_index );
@@ -296,7 +298,7 @@ void EntityEstimator::getEntityBinSecondMomentSnapshots(
 
   if( d_entity_bin_snapshots_enabled )
   {
-    const std::list<double>& moment_snapshots =
+    const std::vector<double>& moment_snapshots =
       Utility::getScoreSnapshots<2>(
            d_entity_estimator_moments_snapshots_map.find( entity_id )->second,
            bin_index );
@@ -325,7 +327,7 @@ void EntityEstimator::getEntityBinThirdMomentSnapshots(
 
   if( d_entity_bin_snapshots_enabled )
   {
-    const std::list<double>& moment_snapshots =
+    const std::vector<double>& moment_snapshots =
       Utility::getScoreSnapshots<3>(
            d_entity_estimator_moments_snapshots_map.find( entity_id )->second,
            bin_index );
@@ -354,7 +356,7 @@ void EntityEstimator::getEntityBinFourthMomentSnapshots(
 
   if( d_entity_bin_snapshots_enabled )
   {
-    const std::list<double>& moment_snapshots =
+    const std::vector<double>& moment_snapshots =
       Utility::getScoreSnapshots<4>(
            d_entity_estimator_moments_snapshots_map.find( entity_id )->second,
            bin_index );
@@ -369,7 +371,7 @@ void EntityEstimator::getTotalBinMomentSnapshotHistoryValues(
 {
   if( d_entity_bin_snapshots_enabled )
   {
-    const std::list<uint64_t>& raw_history_values = 
+    const std::vector<uint64_t>& raw_history_values = 
       d_estimator_total_bin_data_snapshots.getSnapshotIndices();
     
     history_values.assign( raw_history_values.begin(),
@@ -383,7 +385,7 @@ void EntityEstimator::getTotalBinMomentSnapshotSamplingTimes(
 {
   if( d_entity_bin_snapshots_enabled )
   {
-    const std::list<double>& raw_sampling_time_values = 
+    const std::vector<double>& raw_sampling_time_values = 
       d_estimator_total_bin_data_snapshots.getSnapshotSamplingTimes();
     
     sampling_times.assign( raw_sampling_time_values.begin(),
@@ -404,7 +406,7 @@ void EntityEstimator::getTotalBinFirstMomentSnapshots(
 
   if( d_entity_bin_snapshots_enabled )
   {
-    const std::list<double>& moment_snapshots =
+    const std::vector<double>& moment_snapshots =
       Utility::getScoreSnapshots<1>( d_estimator_total_bin_data_snapshots,
                                      bin_index );
     
@@ -425,7 +427,7 @@ void EntityEstimator::getTotalBinSecondMomentSnapshots(
 
   if( d_entity_bin_snapshots_enabled )
   {
-    const std::list<double>& moment_snapshots =
+    const std::vector<double>& moment_snapshots =
       Utility::getScoreSnapshots<2>( d_estimator_total_bin_data_snapshots,
                                      bin_index );
     
@@ -446,7 +448,7 @@ void EntityEstimator::getTotalBinThirdMomentSnapshots(
 
   if( d_entity_bin_snapshots_enabled )
   {
-    const std::list<double>& moment_snapshots =
+    const std::vector<double>& moment_snapshots =
       Utility::getScoreSnapshots<3>( d_estimator_total_bin_data_snapshots,
                                      bin_index );
     
@@ -467,7 +469,7 @@ void EntityEstimator::getTotalBinFourthMomentSnapshots(
 
   if( d_entity_bin_snapshots_enabled )
   {
-    const std::list<double>& moment_snapshots =
+    const std::vector<double>& moment_snapshots =
       Utility::getScoreSnapshots<4>( d_estimator_total_bin_data_snapshots,
                                      bin_index );
 
@@ -1091,6 +1093,119 @@ void EntityEstimator::commitHistoryContributionToBinOfTotal(
   this->addHistoryContributionToTotalBinHistogram( bin_index, contribution );
 }
 
+// Commit history contributions to bins of an entity
+/*! \details The moments of all of the bins are updated in a single batch
+ * (and a single critical section), which is considerably faster than
+ * committing the contribution to each bin individually. Each bin index
+ * should only appear once. If the bin indices are contiguous and in
+ * increasing order the vectorized range update will be used.
+ */
+void EntityEstimator::commitHistoryContributionToBinsOfEntity(
+                                     const EntityId entity_id,
+                                     const std::vector<size_t>& bin_indices,
+                                     const std::vector<double>& contributions )
+{
+  // Make sure the entity is assigned to this estimator
+  testPrecondition( this->isEntityAssigned( entity_id ) );
+  // Make sure the contributions are valid
+  testPrecondition( bin_indices.size() == contributions.size() );
+
+  if( bin_indices.empty() )
+    return;
+
+  FourEstimatorMomentsCollection& entity_estimator_moments =
+    d_entity_estimator_moments_map.find( entity_id )->second;
+
+  const bool contiguous_bins =
+    EntityEstimator::areBinIndicesContiguous( bin_indices );
+
+  // Update the moments
+  #pragma omp critical
+  {
+    if( contiguous_bins )
+    {
+      entity_estimator_moments.addRawScoresToRange( bin_indices.front(),
+                                                    contributions.data(),
+                                                    contributions.size() );
+    }
+    else
+    {
+      entity_estimator_moments.addRawScores( bin_indices.data(),
+                                             contributions.data(),
+                                             bin_indices.size() );
+    }
+  }
+
+  if( d_entity_bin_histograms_enabled )
+  {
+    for( size_t i = 0; i < bin_indices.size(); ++i )
+    {
+      this->addHistoryContributionToEntityBinHistogram( entity_id,
+                                                        bin_indices[i],
+                                                        contributions[i] );
+    }
+  }
+}
+
+// Commit history contributions to bins of total
+/*! \details The moments of all of the bins are updated in a single batch
+ * (and a single critical section). Each bin index should only appear once.
+ * If the bin indices are contiguous and in increasing order the vectorized
+ * range update will be used.
+ */
+void EntityEstimator::commitHistoryContributionToBinsOfTotal(
+                                     const std::vector<size_t>& bin_indices,
+                                     const std::vector<double>& contributions )
+{
+  // Make sure the contributions are valid
+  testPrecondition( bin_indices.size() == contributions.size() );
+
+  if( bin_indices.empty() )
+    return;
+
+  const bool contiguous_bins =
+    EntityEstimator::areBinIndicesContiguous( bin_indices );
+
+  // Update the moments
+  #pragma omp critical
+  {
+    if( contiguous_bins )
+    {
+      d_estimator_total_bin_data.addRawScoresToRange( bin_indices.front(),
+                                                      contributions.data(),
+                                                      contributions.size() );
+    }
+    else
+    {
+      d_estimator_total_bin_data.addRawScores( bin_indices.data(),
+                                               contributions.data(),
+                                               bin_indices.size() );
+    }
+  }
+
+  if( d_entity_bin_histograms_enabled )
+  {
+    for( size_t i = 0; i < bin_indices.size(); ++i )
+    {
+      this->addHistoryContributionToTotalBinHistogram( bin_indices[i],
+                                                       contributions[i] );
+    }
+  }
+}
+
+// Check if the bin indices are contiguous (and increasing)
+bool EntityEstimator::areBinIndicesContiguous(
+                                       const std::vector<size_t>& bin_indices )
+{
+  for( size_t i = 1; i < bin_indices.size(); ++i )
+  {
+    if( bin_indices[i] != bin_indices.front() + i )
+      return false;
+  }
+
+  return true;
+}
+
 // Add contribution to total bin histogram
 void EntityEstimator::addHistoryContributionToTotalBinHistogram(
                                                     const size_t bin_index,
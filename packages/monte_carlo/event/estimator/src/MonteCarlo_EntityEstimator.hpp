@@ -222,6 +222,17 @@ protected:
   void commitHistoryContributionToBinOfTotal( const size_t bin_index,
 					      const double contribution );
 
+  //! Commit history contributions to bins of an entity
+  void commitHistoryContributionToBinsOfEntity(
+                                     const EntityId entity_id,
+                                     const std::vector<size_t>& bin_indices,
+                                     const std::vector<double>& contributions );
+
+  //! Commit history contributions to bins of total
+  void commitHistoryContributionToBinsOfTotal(
+                                     const std::vector<size_t>& bin_indices,
+                                     const std::vector<double>& contributions );
+
   //! Print the estimator data
   virtual void printImplementation( std::ostream& os,
 				    const std::string& entity_type ) const;
@@ -307,6 +318,9 @@ private:
                                                    const size_t bin_index,
                                                    const double contribution );
 
+  // Check if the bin indices are contiguous (and increasing)
+  static bool areBinIndicesContiguous( const std::vector<size_t>& bin_indices );
+
   // Add contribution to total bin histogram
   void addHistoryContributionToTotalBinHistogram( const size_t bin_index,
                                                   const double contribution );
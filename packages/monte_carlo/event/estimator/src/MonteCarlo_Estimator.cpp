@@ -22,7 +22,9 @@ std::shared_ptr<const std::vector<double> > Estimator::s_default_sample_moment_h
   
 // Default constructor
 Estimator::Estimator()
-  : d_id( std::numeric_limits<Id>::max() )
+  : d_id( std::numeric_limits<Id>::max() ),
+    d_max_number_of_snapshots( std::numeric_limits<size_t>::max() ),
+    d_discard_oldest_snapshots( false )
 { /* ... */ }
   
 // Constructor
@@ -32,6 +34,8 @@ Estimator::Estimator( const Id id, const double multiplier )
     d_particle_types(),
     d_response_functions( 1 ),
     d_sample_moment_histogram_bins( Estimator::getDefaultSampleMomentHistogramBins() ),
+    d_max_number_of_snapshots( std::numeric_limits<size_t>::max() ),
+    d_discard_oldest_snapshots( false ),
     d_has_uncommitted_history_contribution( 1, false )
 {
   // Make sure the multiplier is valid
@@ -152,6 +156,52 @@ void Estimator::setSampleMomentHistogramBins( const std::shared_ptr<const std::v
   this->assignSampleMomentHistogramBins( bin_boundaries );
 }
 
+// Set the max number of snapshots that will be kept
+/*! \details When the number of snapshots exceeds the max number, every other
+ * snapshot will be discarded (the most recent snapshot is always kept). This
+ * bounds the memory used by the snapshots (and the size of the rendezvous
+ * files) while still allowing a convergence analysis over the entire
+ * simulation. If discard oldest snapshots mode is on, the oldest snapshots
+ * will be discarded instead. By default all snapshots will be kept.
+ */
+void Estimator::setMaxNumberOfSnapshots( const size_t max_number_of_snapshots )
+{
+  // Make sure that the max number of snapshots is valid
+  TEST_FOR_EXCEPTION( max_number_of_snapshots == 0,
+                      std::runtime_error,
+                      "The max number of snapshots must be greater than "
+                      "zero!" );
+
+  d_max_number_of_snapshots = max_number_of_snapshots;
+}
+
+// Get the max number of snapshots that will be kept
+size_t Estimator::getMaxNumberOfSnapshots() const
+{
+  return d_max_number_of_snapshots;
+}
+
+// Discard the oldest snapshots when the max number is exceeded
+/*! \details Only the most recent snapshots will be kept, which limits the
+ * convergence analysis to the end of the simulation.
+ */
+void Estimator::setDiscardOldestSnapshotsModeOn()
+{
+  d_discard_oldest_snapshots = true;
+}
+
+// Thin the snapshots when the max number is exceeded (default)
+void Estimator::setThinSnapshotsModeOn()
+{
+  d_discard_oldest_snapshots = false;
+}
+
+// Check if the oldest snapshots are discarded when the max number is exceeded
+bool Estimator::isDiscardOldestSnapshotsModeOn() const
+{
+  return d_discard_oldest_snapshots;
+}
+
 // Get the sample moment histogram bins
 const std::shared_ptr<const std::vector<double> >& Estimator::getSampleMomentHistogramBins()
 {
@@ -1167,11 +1217,23 @@ void Estimator::reduceSnapshots(
       if( i != root_process )
         snapshots.mergeSnapshots( gathered_snapshots[i] );
     }
+
+    this->limitSnapshots( snapshots );
   }
   else
     Utility::send( comm, root_process, 0, snapshots );
 }
 
+// Remove snapshots until no more than the max number remain
+void Estimator::limitSnapshots(
+                     FourEstimatorMomentsCollectionSnapshots& snapshots ) const
+{
+  if( d_discard_oldest_snapshots )
+    snapshots.discardOldestSnapshots( d_max_number_of_snapshots );
+  else
+    snapshots.thinSnapshots( d_max_number_of_snapshots );
+}
+
 // Return the response function name
 const std::string& Estimator::getResponseFunctionName(
 				   const size_t response_function_index ) const
@@ -11,6 +11,7 @@
 
 // Std Lib Includes
 #include <string>
+#include <limits>
 
 // Boost includes
 #include <boost/any.hpp>
@@ -38,6 +39,7 @@
 #include "Utility_Set.hpp"
 #include "Utility_Tuple.hpp"
 #include "Utility_QuantityTraits.hpp"
+#include "Utility_PerThread.hpp"
 
 namespace MonteCarlo{
 
@@ -57,7 +59,7 @@ protected:
   typedef Utility::SampleMomentCollection<double,4,3,2,1> FourEstimatorMomentsCollection;
 
   //! Typedef for the estimator moments snapshots
-  typedef Utility::SampleMomentCollectionSnapshots<double,std::list,4,3,2,1> FourEstimatorMomentsCollectionSnapshots;
+  typedef Utility::SampleMomentCollectionSnapshots<double,std::vector,4,3,2,1> FourEstimatorMomentsCollectionSnapshots;
 
 public:
 
@@ -412,6 +414,21 @@ public:
   //! Set the sample moment histogram bins
   void setSampleMomentHistogramBins( const std::shared_ptr<const std::vector<double> >& bin_boundaries );
 
+  //! Set the max number of snapshots that will be kept
+  void setMaxNumberOfSnapshots( const size_t max_number_of_snapshots );
+
+  //! Get the max number of snapshots that will be kept
+  size_t getMaxNumberOfSnapshots() const;
+
+  //! Discard the oldest snapshots when the max number is exceeded
+  void setDiscardOldestSnapshotsModeOn();
+
+  //! Thin the snapshots when the max number is exceeded (default)
+  void setThinSnapshotsModeOn();
+
+  //! Check if the oldest snapshots are discarded when the max number is exceeded
+  bool isDiscardOldestSnapshotsModeOn() const;
+
   //! Get the entity bin sample moment histogram
   virtual void getEntityBinSampleMomentHistogram(
                      const EntityId entity_id,
@@ -497,6 +514,10 @@ protected:
                     const int root_process,
                     FourEstimatorMomentsCollectionSnapshots& snapshots ) const;
 
+  //! Remove snapshots until no more than the max number remain
+  void limitSnapshots(
+                    FourEstimatorMomentsCollectionSnapshots& snapshots ) const;
+
   //! Return the response function name
   const std::string& getResponseFunctionName(
 				const size_t response_function_index ) const;
@@ -644,16 +665,19 @@ private:
   // The sample moment histogram bins
   std::shared_ptr<const std::vector<double> > d_sample_moment_histogram_bins;
 
+  // The max number of snapshots that will be kept
+  size_t d_max_number_of_snapshots;
+
+  // The snapshot limiting mode (true = discard oldest, false = thin - default)
+  bool d_discard_oldest_snapshots;
+
   // Records if there is an uncommitted history contribution for a thread
-  // Note: uint8_t is used instead of bool deliberately due to a
-  //       unusual thread safety issue that was encountered with
-  //       std::vector<bool>.
-  std::vector<uint8_t> d_has_uncommitted_history_contribution;
+  Utility::PerThread<bool> d_has_uncommitted_history_contribution;
 };
 
 } // end MonteCarlo namespace
 
-BOOST_SERIALIZATION_CLASS_VERSION( Estimator, MonteCarlo, 0 );
+BOOST_SERIALIZATION_CLASS_VERSION( Estimator, MonteCarlo, 2 );
 BOOST_SERIALIZATION_ASSUME_ABSTRACT_CLASS( Estimator, MonteCarlo );
 EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo, Estimator );
 
@@ -78,6 +78,8 @@ void Estimator::save( Archive& ar, const unsigned version ) const
   ar & BOOST_SERIALIZATION_NVP( d_particle_types );
   ar & BOOST_SERIALIZATION_NVP( d_response_functions );
   ar & BOOST_SERIALIZATION_NVP( d_sample_moment_histogram_bins );
+  ar & BOOST_SERIALIZATION_NVP( d_max_number_of_snapshots );
+  ar & BOOST_SERIALIZATION_NVP( d_discard_oldest_snapshots );
   // Do not save d_has_uncommited_history_contribution because it is thread
   // specific data - all data should be committed before saving the estimator
 }
@@ -95,6 +97,16 @@ void Estimator::load( Archive& ar, const unsigned version )
   ar & BOOST_SERIALIZATION_NVP( d_particle_types );
   ar & BOOST_SERIALIZATION_NVP( d_response_functions );
   ar & BOOST_SERIALIZATION_NVP( d_sample_moment_histogram_bins );
+
+  if( version > 0 )
+    ar & BOOST_SERIALIZATION_NVP( d_max_number_of_snapshots );
+  else
+    d_max_number_of_snapshots = std::numeric_limits<size_t>::max();
+
+  if( version > 1 )
+    ar & BOOST_SERIALIZATION_NVP( d_discard_oldest_snapshots );
+  else
+    d_discard_oldest_snapshots = false;
   
   // Initialize the thread data
   d_has_uncommitted_history_contribution.resize( 1, false );
@@ -0,0 +1,216 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_PointDetectorFluxEstimator.hpp
+//! \author Alex Robinson
+//! \brief  Point detector flux estimator class declaration.
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_POINT_DETECTOR_FLUX_ESTIMATOR_HPP
+#define MONTE_CARLO_POINT_DETECTOR_FLUX_ESTIMATOR_HPP
+
+// Std Lib Includes
+#include <memory>
+#include <map>
+
+// Boost Includes
+#include <boost/mpl/vector.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_StandardEntityEstimator.hpp"
+#include "MonteCarlo_ParticleCollidingInCellEventObserver.hpp"
+#include "MonteCarlo_EstimatorContributionMultiplierPolicy.hpp"
+#include "MonteCarlo_FilledGeometryModel.hpp"
+#include "MonteCarlo_ParticleState.hpp"
+#include "MonteCarlo_ModelRayTracer.hpp"
+#include "Utility_PerThread.hpp"
+#include "Utility_Vector.hpp"
+
+namespace MonteCarlo{
+
+/*! The point detector (next-event) flux estimator class
+ * \details At every collision of an assigned particle type the expected
+ * flux at each detector point is scored: the macroscopic cross section
+ * differential in the scattering angle cosine that points at the detector
+ * (divided by the cell total macroscopic cross section) times the
+ * attenuation along the ray to the detector divided by 2*pi*R^2. The ray
+ * to each detector is traced once per collision and the optical depth is
+ * accumulated from the total macroscopic cross sections of the cells that
+ * are crossed, which are cached (per thread) for every outgoing energy that
+ * is needed during the collision. Contributions that are smaller than the
+ * Russian roulette threshold (before attenuation) are rouletted so that the
+ * ray tracing can be skipped for most of them. Only photons and neutrons
+ * can contribute to the estimator. Rays that leave the geometry or hit a
+ * reflecting surface do not contribute.
+ * \ingroup particle_colliding_in_cell_event
+ */
+template<typename ContributionMultiplierPolicy = WeightMultiplier>
+class PointDetectorFluxEstimator : public StandardEntityEstimator,
+                                   public ParticleCollidingInCellEventObserver
+{
+
+public:
+
+  //! Typedef for the cell id type
+  typedef Geometry::Model::EntityId CellIdType;
+
+  //! Typedef for the detector id type
+  typedef StandardEntityEstimator::EntityId DetectorIdType;
+
+  //! Typedef for the detector position type
+  typedef std::array<double,3> DetectorPosition;
+
+  //! Typedef for event tags used for quick dispatcher registering
+  typedef boost::mpl::vector<ParticleCollidingInCellEventObserver::EventTag>
+  EventTags;
+
+  //! Constructor
+  PointDetectorFluxEstimator(
+           const Id id,
+           const double multiplier,
+           const std::vector<DetectorIdType>& detector_ids,
+           const std::vector<DetectorPosition>& detector_positions,
+           const std::shared_ptr<const FilledGeometryModel>& model );
+
+  //! Destructor
+  ~PointDetectorFluxEstimator()
+  { /* ... */ }
+
+  //! Check if the estimator is a cell estimator
+  bool isCellEstimator() const final override;
+
+  //! Check if the estimator is a surface estimator
+  bool isSurfaceEstimator() const final override;
+
+  //! Check if the estimator is a mesh estimator
+  bool isMeshEstimator() const final override;
+
+  //! Return the position of a detector
+  const DetectorPosition& getDetectorPosition(
+                                     const DetectorIdType detector_id ) const;
+
+  //! Set the Russian roulette threshold
+  void setRussianRouletteThreshold( const double threshold );
+
+  //! Return the Russian roulette threshold
+  double getRussianRouletteThreshold() const;
+
+  //! Add current history estimator contribution
+  void updateFromParticleCollidingInCellEvent(
+                     const ParticleState& particle,
+                     const CellIdType cell_of_collision,
+                     const double inverse_total_cross_section ) final override;
+
+  //! Enable support for multiple threads
+  void enableThreadSupport( const unsigned num_threads ) final override;
+
+  //! Print the estimator data summary
+  void printSummary( std::ostream& os ) const final override;
+
+protected:
+
+  //! Assign discretization to an estimator dimension
+  void assignDiscretization( const std::shared_ptr<const ObserverPhaseSpaceDimensionDiscretization>& bins,
+                             const bool range_dimension ) final override;
+
+  //! Assign the particle type to the estimator
+  void assignParticleType( const ParticleType particle_type ) final override;
+
+private:
+
+  // The thread cache type
+  struct ThreadCache
+  {
+    // The ray tracer used to trace rays to the detectors
+    ModelRayTracer ray_tracer;
+
+    // The outgoing energies and macroscopic differential cross sections
+    std::vector<std::pair<double,double> > differential_cross_sections;
+
+    // The cell total macroscopic cross sections at the outgoing energies
+    std::map<std::pair<CellIdType,double>,double> cell_cross_sections;
+  };
+
+  // Default constructor
+  PointDetectorFluxEstimator();
+
+  // Add the current history contribution of a particle type
+  template<typename StateType>
+  void updateFromParticleCollidingInCellEventImpl(
+                                    const ParticleState& particle,
+                                    const CellIdType cell_of_collision,
+                                    const double inverse_total_cross_section );
+
+  // Trace the ray to a detector (false if the ray cannot reach it)
+  bool traceRayToDetector( ThreadCache& cache,
+                           const ParticleState& particle,
+                           const CellIdType cell_of_collision,
+                           const double direction[3],
+                           const double distance ) const;
+
+  // Calculate the optical depth along the traced ray
+  template<typename StateType>
+  double calculateOpticalDepth( ThreadCache& cache,
+                                const double energy ) const;
+
+  // Return the cell total macroscopic cross section (cached)
+  template<typename StateType>
+  double getCellTotalCrossSection( ThreadCache& cache,
+                                   const CellIdType cell,
+                                   const double energy ) const;
+
+  // Serialize the estimator data
+  template<typename Archive>
+  void serialize( Archive& ar, const unsigned version );
+
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+
+  // The detector positions
+  std::map<DetectorIdType,DetectorPosition> d_detector_positions;
+
+  // The filled geometry model
+  std::shared_ptr<const FilledGeometryModel> d_model;
+
+  // The Russian roulette threshold
+  double d_russian_roulette_threshold;
+
+  // The thread caches
+  Utility::PerThread<ThreadCache> d_thread_caches;
+};
+
+// Serialize the estimator data
+template<typename ContributionMultiplierPolicy>
+template<typename Archive>
+void PointDetectorFluxEstimator<ContributionMultiplierPolicy>::serialize( Archive& ar, const unsigned version )
+{
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( StandardEntityEstimator );
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleCollidingInCellEventObserver );
+  ar & BOOST_SERIALIZATION_NVP( d_detector_positions );
+  ar & BOOST_SERIALIZATION_NVP( d_model );
+  ar & BOOST_SERIALIZATION_NVP( d_russian_roulette_threshold );
+}
+
+//! The weight multiplied point detector flux estimator
+typedef PointDetectorFluxEstimator<WeightMultiplier> WeightMultipliedPointDetectorFluxEstimator;
+
+//! The weight and energy multiplied point detector flux estimator
+typedef PointDetectorFluxEstimator<WeightAndEnergyMultiplier> WeightAndEnergyMultipliedPointDetectorFluxEstimator;
+
+} // end MonteCarlo namespace
+
+BOOST_SERIALIZATION_CLASS1_VERSION( PointDetectorFluxEstimator, MonteCarlo, 0 );
+
+//---------------------------------------------------------------------------//
+// Template Includes
+//---------------------------------------------------------------------------//
+
+#include "MonteCarlo_PointDetectorFluxEstimator_def.hpp"
+
+//---------------------------------------------------------------------------//
+
+#endif // end MONTE_CARLO_POINT_DETECTOR_FLUX_ESTIMATOR_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_PointDetectorFluxEstimator.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,447 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_PointDetectorFluxEstimator_def.hpp
+//! \author Alex Robinson
+//! \brief  Point detector flux estimator class definition.
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_POINT_DETECTOR_FLUX_ESTIMATOR_DEF_HPP
+#define MONTE_CARLO_POINT_DETECTOR_FLUX_ESTIMATOR_DEF_HPP
+
+// Std Lib Includes
+#include <iostream>
+#include <stdexcept>
+#include <cmath>
+
+// FRENSIE Includes
+#include "MonteCarlo_PhotonState.hpp"
+#include "MonteCarlo_NeutronState.hpp"
+#include "Utility_3DCartesianVectorHelpers.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_PhysicalConstants.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_ExplicitTemplateInstantiationMacros.hpp"
+#include "Utility_LoggingMacros.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Default constructor
+template<typename ContributionMultiplierPolicy>
+PointDetectorFluxEstimator<ContributionMultiplierPolicy>::PointDetectorFluxEstimator()
+  : d_russian_roulette_threshold( 0.0 )
+{ /* ... */ }
+
+// Constructor
+template<typename ContributionMultiplierPolicy>
+PointDetectorFluxEstimator<ContributionMultiplierPolicy>::PointDetectorFluxEstimator(
+               const Id id,
+               const double multiplier,
+               const std::vector<DetectorIdType>& detector_ids,
+               const std::vector<DetectorPosition>& detector_positions,
+               const std::shared_ptr<const FilledGeometryModel>& model )
+  : StandardEntityEstimator( id, multiplier, detector_ids ),
+    ParticleCollidingInCellEventObserver(),
+    d_detector_positions(),
+    d_model( model ),
+    d_russian_roulette_threshold( 0.0 ),
+    d_thread_caches()
+{
+  // Make sure the model is valid
+  testPrecondition( model.get() );
+
+  TEST_FOR_EXCEPTION( detector_ids.size() != detector_positions.size(),
+                      std::runtime_error,
+                      "The number of detector ids (" << detector_ids.size() <<
+                      ") does not match the number of detector positions ("
+                      << detector_positions.size() << ")!" );
+
+  for( size_t i = 0; i < detector_ids.size(); ++i )
+    d_detector_positions[detector_ids[i]] = detector_positions[i];
+}
+
+// Check if the estimator is a cell estimator
+template<typename ContributionMultiplierPolicy>
+bool PointDetectorFluxEstimator<ContributionMultiplierPolicy>::isCellEstimator() const
+{
+  return false;
+}
+
+// Check if the estimator is a surface estimator
+template<typename ContributionMultiplierPolicy>
+bool PointDetectorFluxEstimator<ContributionMultiplierPolicy>::isSurfaceEstimator() const
+{
+  return false;
+}
+
+// Check if the estimator is a mesh estimator
+template<typename ContributionMultiplierPolicy>
+bool PointDetectorFluxEstimator<ContributionMultiplierPolicy>::isMeshEstimator() const
+{
+  return false;
+}
+
+// Return the position of a detector
+template<typename ContributionMultiplierPolicy>
+auto PointDetectorFluxEstimator<ContributionMultiplierPolicy>::getDetectorPosition(
+                     const DetectorIdType detector_id ) const
+  -> const DetectorPosition&
+{
+  // Make sure the detector is assigned to the estimator
+  testPrecondition( this->isEntityAssigned( detector_id ) );
+
+  return d_detector_positions.find( detector_id )->second;
+}
+
+// Set the Russian roulette threshold
+/*! \details A contribution whose unattenuated value is below the threshold
+ * will survive with a probability equal to the ratio of the value and the
+ * threshold (and will be increased to the threshold if it survives). A
+ * threshold of zero (the default) disables Russian roulette.
+ */
+template<typename ContributionMultiplierPolicy>
+void PointDetectorFluxEstimator<ContributionMultiplierPolicy>::setRussianRouletteThreshold(
+                                                       const double threshold )
+{
+  // Make sure the threshold is valid
+  testPrecondition( threshold >= 0.0 );
+
+  d_russian_roulette_threshold = threshold;
+}
+
+// Return the Russian roulette threshold
+template<typename ContributionMultiplierPolicy>
+double PointDetectorFluxEstimator<ContributionMultiplierPolicy>::getRussianRouletteThreshold() const
+{
+  return d_russian_roulette_threshold;
+}
+
+// Add current history estimator contribution
+template<typename ContributionMultiplierPolicy>
+void PointDetectorFluxEstimator<ContributionMultiplierPolicy>::updateFromParticleCollidingInCellEvent(
+                                    const ParticleState& particle,
+                                    const CellIdType cell_of_collision,
+                                    const double inverse_total_cross_section )
+{
+  // Make sure that the particle type is assigned to this estimator
+  testPrecondition( this->isParticleTypeAssigned( particle.getParticleType() ) );
+  // Make sure that the inverse total cross section is valid
+  testPrecondition( inverse_total_cross_section > 0.0 );
+
+  switch( particle.getParticleType() )
+  {
+    case PHOTON:
+    {
+      this->template updateFromParticleCollidingInCellEventImpl<PhotonState>(
+                                                 particle,
+                                                 cell_of_collision,
+                                                 inverse_total_cross_section );
+      break;
+    }
+    case NEUTRON:
+    {
+      this->template updateFromParticleCollidingInCellEventImpl<NeutronState>(
+                                                 particle,
+                                                 cell_of_collision,
+                                                 inverse_total_cross_section );
+      break;
+    }
+    default: break;
+  }
+}
+
+// Add the current history contribution of a particle type
+/*! \details The contribution of every scattering reaction is scored with
+ * a copy of the particle that has the outgoing energy and direction (toward
+ * the detector) and that has arrived at the detector. The phase space
+ * binning and the response functions are therefore applied at the detector.
+ */
+template<typename ContributionMultiplierPolicy>
+template<typename StateType>
+void PointDetectorFluxEstimator<ContributionMultiplierPolicy>::updateFromParticleCollidingInCellEventImpl(
+                                    const ParticleState& particle,
+                                    const CellIdType cell_of_collision,
+                                    const double inverse_total_cross_section )
+{
+  typedef typename Details::FilledGeometryModelUpcastHelper<StateType>::UpcastType
+    FilledParticleGeometryModel;
+
+  const auto& material =
+    static_cast<const FilledParticleGeometryModel&>( *d_model ).getMaterial( cell_of_collision );
+
+  ThreadCache& cache = d_thread_caches.local();
+
+  // The cached cross sections are only valid for the current collision
+  cache.cell_cross_sections.clear();
+
+  std::unique_ptr<ParticleState> particle_at_detector;
+
+  for( auto&& detector_data : d_detector_positions )
+  {
+    double direction[3] = {detector_data.second[0] - particle.getXPosition(),
+                           detector_data.second[1] - particle.getYPosition(),
+                           detector_data.second[2] - particle.getZPosition()};
+
+    const double distance =
+      Utility::normalizeVectorAndReturnMagnitude( direction );
+
+    // The flux at a collision site is infinite
+    if( distance == 0.0 )
+      continue;
+
+    double angle_cosine =
+      Utility::calculateCosineOfAngleBetweenUnitVectors( particle.getDirection(),
+                                                         direction );
+
+    if( angle_cosine > 1.0 )
+      angle_cosine = 1.0;
+    else if( angle_cosine < -1.0 )
+      angle_cosine = -1.0;
+
+    material->getMacroscopicDifferentialScatteringCrossSections(
+                                          particle.getEnergy(),
+                                          angle_cosine,
+                                          cache.differential_cross_sections );
+
+    if( cache.differential_cross_sections.empty() )
+      continue;
+
+    const double geometric_factor = inverse_total_cross_section/
+      (2*Utility::PhysicalConstants::pi*distance*distance);
+
+    double roulette_factor = 1.0;
+
+    // Play Russian roulette before the ray is traced
+    if( d_russian_roulette_threshold > 0.0 )
+    {
+      double unattenuated_contribution = 0.0;
+
+      for( auto&& cross_section : cache.differential_cross_sections )
+        unattenuated_contribution += cross_section.second;
+
+      unattenuated_contribution *= geometric_factor*particle.getWeight();
+
+      if( unattenuated_contribution < d_russian_roulette_threshold )
+      {
+        const double survival_probability =
+          unattenuated_contribution/d_russian_roulette_threshold;
+
+        if( Utility::RandomNumberGenerator::getRandomNumber<double>() <
+            survival_probability )
+          roulette_factor = 1.0/survival_probability;
+        else
+          continue;
+      }
+    }
+
+    if( !this->traceRayToDetector( cache,
+                                   particle,
+                                   cell_of_collision,
+                                   direction,
+                                   distance ) )
+      continue;
+
+    if( !particle_at_detector )
+    {
+      particle_at_detector.reset( particle.clone() );
+      particle_at_detector->incrementCollisionNumber();
+    }
+
+    particle_at_detector->setDirection( direction );
+
+    for( auto&& cross_section : cache.differential_cross_sections )
+    {
+      const double optical_depth =
+        this->template calculateOpticalDepth<StateType>( cache,
+                                                         cross_section.first );
+
+      particle_at_detector->setEnergy( cross_section.first );
+      particle_at_detector->setTime( particle.getTime() +
+                                     distance/particle_at_detector->getSpeed() );
+
+      const double contribution = roulette_factor*geometric_factor*
+        cross_section.second*std::exp( -optical_depth )*
+        ContributionMultiplierPolicy::multiplier( *particle_at_detector );
+
+      if( contribution > 0.0 )
+      {
+        ObserverParticleStateWrapper
+          particle_state_wrapper( *particle_at_detector );
+
+        this->addPartialHistoryPointContribution( detector_data.first,
+                                                  particle_state_wrapper,
+                                                  contribution );
+      }
+    }
+  }
+}
+
+// Trace the ray to a detector (false if the ray cannot reach it)
+template<typename ContributionMultiplierPolicy>
+bool PointDetectorFluxEstimator<ContributionMultiplierPolicy>::traceRayToDetector(
+                                            ThreadCache& cache,
+                                            const ParticleState& particle,
+                                            const CellIdType cell_of_collision,
+                                            const double direction[3],
+                                            const double distance ) const
+{
+  try{
+    return cache.ray_tracer.traceRay( *d_model,
+                                      particle.getPosition(),
+                                      direction,
+                                      cell_of_collision,
+                                      distance );
+  }
+  catch( const std::runtime_error& exception )
+  {
+    FRENSIE_LOG_TAGGED_WARNING( "Estimator",
+                                "The ray from a collision to a detector of "
+                                "point detector estimator " << this->getId()
+                                << " could not be traced ("
+                                << exception.what() << "). The contribution "
+                                "will be ignored!" );
+
+    return false;
+  }
+}
+
+// Calculate the optical depth along the traced ray
+/*! \details The cell total macroscopic cross sections are cached for the
+ * current collision.
+ */
+template<typename ContributionMultiplierPolicy>
+template<typename StateType>
+double PointDetectorFluxEstimator<ContributionMultiplierPolicy>::calculateOpticalDepth(
+                                                   ThreadCache& cache,
+                                                   const double energy ) const
+{
+  return cache.ray_tracer.calculateOpticalDepth(
+           [this,&cache,energy]( const CellIdType cell ) -> double
+           {
+             return this->template getCellTotalCrossSection<StateType>( cache,
+                                                                        cell,
+                                                                        energy );
+           } );
+}
+
+// Return the cell total macroscopic cross section (cached)
+template<typename ContributionMultiplierPolicy>
+template<typename StateType>
+double PointDetectorFluxEstimator<ContributionMultiplierPolicy>::getCellTotalCrossSection(
+                                                  ThreadCache& cache,
+                                                  const CellIdType cell,
+                                                  const double energy ) const
+{
+  const std::pair<CellIdType,double> key( cell, energy );
+
+  auto cross_section_it = cache.cell_cross_sections.find( key );
+
+  if( cross_section_it == cache.cell_cross_sections.end() )
+  {
+    double cross_section = 0.0;
+
+    if( !d_model->template isCellVoid<StateType>( cell ) )
+    {
+      cross_section =
+        d_model->template getMacroscopicTotalCrossSection<StateType>( cell,
+                                                                      energy );
+    }
+
+    cross_section_it =
+      cache.cell_cross_sections.insert( std::make_pair( key, cross_section ) ).first;
+  }
+
+  return cross_section_it->second;
+}
+
+// Enable support for multiple threads
+template<typename ContributionMultiplierPolicy>
+void PointDetectorFluxEstimator<ContributionMultiplierPolicy>::enableThreadSupport(
+                                                   const unsigned num_threads )
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  StandardEntityEstimator::enableThreadSupport( num_threads );
+
+  // Add thread support to the ray tracing caches
+  d_thread_caches.resize( num_threads );
+}
+
+// Print the estimator data
+template<typename ContributionMultiplierPolicy>
+void PointDetectorFluxEstimator<ContributionMultiplierPolicy>::printSummary( std::ostream& os ) const
+{
+  os << "Point Detector Flux Estimator: " << this->getId() << "\n";
+
+  this->printImplementation( os, "Detector" );
+
+  os << std::flush;
+}
+
+// Assign discretization to an estimator dimension
+template<typename ContributionMultiplierPolicy>
+void PointDetectorFluxEstimator<ContributionMultiplierPolicy>::assignDiscretization(
+  const std::shared_ptr<const ObserverPhaseSpaceDimensionDiscretization>& bins,
+  const bool range_dimension )
+{
+  if( bins->getDimension() == OBSERVER_COSINE_DIMENSION )
+  {
+    FRENSIE_LOG_TAGGED_WARNING( "Estimator",
+                                bins->getDimensionName() <<
+                                " bins cannot be set for point detector "
+                                "estimators. The bins requested for point "
+                                "detector estimator " << this->getId() <<
+                                " will be ignored!" );
+  }
+  else
+    StandardEntityEstimator::assignDiscretization( bins, range_dimension );
+}
+
+// Assign the particle type to the estimator
+/*! \details Only photons or neutrons can contribute to the estimator.
+ * Combinations are not allowed.
+ */
+template<typename ContributionMultiplierPolicy>
+void PointDetectorFluxEstimator<ContributionMultiplierPolicy>::assignParticleType(
+                                            const ParticleType particle_type )
+{
+  if( particle_type != PHOTON && particle_type != NEUTRON )
+  {
+    FRENSIE_LOG_TAGGED_WARNING( "Estimator",
+                                "Only photons and neutrons can contribute to "
+                                "point detector estimators. The requested "
+                                "particle type of " << particle_type <<
+                                " will be ignored by estimator "
+                                << this->getId() << "!" );
+  }
+  else if( this->getNumberOfAssignedParticleTypes() != 0 )
+  {
+    FRENSIE_LOG_TAGGED_WARNING( "Estimator",
+                                "Point detector estimators can only have one "
+                                "particle type contribute. Since estimator "
+                                << this->getId() << " already has a particle "
+                                "type assigned the requested particle type of "
+                                << particle_type << " will be ignored!" );
+  }
+  else
+    Estimator::assignParticleType( particle_type );
+}
+
+} // end MonteCarlo namespace
+
+BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( WeightMultipliedPointDetectorFluxEstimator, MonteCarlo );
+EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::PointDetectorFluxEstimator<MonteCarlo::WeightMultiplier> );
+EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, PointDetectorFluxEstimator<MonteCarlo::WeightMultiplier> );
+
+BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( WeightAndEnergyMultipliedPointDetectorFluxEstimator, MonteCarlo );
+EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::PointDetectorFluxEstimator<MonteCarlo::WeightAndEnergyMultiplier> );
+EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, PointDetectorFluxEstimator<MonteCarlo::WeightAndEnergyMultiplier> );
+
+#endif // end MONTE_CARLO_POINT_DETECTOR_FLUX_ESTIMATOR_DEF_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_PointDetectorFluxEstimator_def.hpp
+//---------------------------------------------------------------------------//
@@ -137,12 +137,14 @@ void StandardEntityEstimator::takeSnapshot( const uint64_t num_histories_since_l
   d_total_estimator_moment_snapshots.takeSnapshot( num_histories_since_last_snapshot,
                                                    time_since_last_snapshot,
                                                    d_total_estimator_moments );
+  this->limitSnapshots( d_total_estimator_moment_snapshots );
 
   for( auto&& entity_data : d_entity_total_estimator_moment_snapshots_map )
   {
     entity_data.second.takeSnapshot( num_histories_since_last_snapshot,
                                      time_since_last_snapshot,
                                      d_entity_total_estimator_moments_map[entity_data.first] );
+    this->limitSnapshots( entity_data.second );
   }
 
   EntityEstimator::takeSnapshot( num_histories_since_last_snapshot,
@@ -160,7 +162,7 @@ void StandardEntityEstimator::getEntityTotalMomentSnapshotHistoryValues(
                       "Entity " << entity_id << " is not assigned to "
                       "estimator " << this->getId() << "!" );
 
-  const std::list<uint64_t>& raw_history_values =
+  const std::vector<uint64_t>& raw_history_values =
     d_entity_total_estimator_moment_snapshots_map.find( entity_id )->second.getSnapshotIndices();
 
   history_values.assign( raw_history_values.begin(),
@@ -178,7 +180,7 @@ void StandardEntityEstimator::getEntityTotalMomentSnapshotSamplingTimes(
                       "Entity " << entity_id << " is not assigned to "
                       "estimator " << this->getId() << "!" );
 
-  const std::list<double>& raw_sampling_time_values =
+  const std::vector<double>& raw_sampling_time_values =
     d_entity_total_estimator_moment_snapshots_map.find( entity_id )->second.getSnapshotSamplingTimes();
 
   sampling_times.assign( raw_sampling_time_values.begin(),
@@ -203,7 +205,7 @@ void StandardEntityEstimator::getEntityTotalFirstMomentSnapshots(
                       "The response function index must be less than "
                       << this->getNumberOfResponseFunctions() << "!" );
 
-  const std::list<double>& moment_snapshots =
+  const std::vector<double>& moment_snapshots =
     Utility::getScoreSnapshots<1>(
        d_entity_total_estimator_moment_snapshots_map.find( entity_id )->second,
        response_function_index );
@@ -229,7 +231,7 @@ void StandardEntityEstimator::getEntityTotalSecondMomentSnapshots(
                       "The response function index must be less than "
                       << this->getNumberOfResponseFunctions() << "!" );
 
-  const std::list<double>& moment_snapshots =
+  const std::vector<double>& moment_snapshots =
     Utility::getScoreSnapshots<2>(
        d_entity_total_estimator_moment_snapshots_map.find( entity_id )->second,
        response_function_index );
@@ -255,7 +257,7 @@ void StandardEntityEstimator::getEntityTotalThirdMomentSnapshots(
                       "The response function index must be less than "
                       << this->getNumberOfResponseFunctions() << "!" );
 
-  const std::list<double>& moment_snapshots =
+  const std::vector<double>& moment_snapshots =
     Utility::getScoreSnapshots<3>(
        d_entity_total_estimator_moment_snapshots_map.find( entity_id )->second,
        response_function_index );
@@ -281,7 +283,7 @@ void StandardEntityEstimator::getEntityTotalFourthMomentSnapshots(
                       "The response function index must be less than "
                       << this->getNumberOfResponseFunctions() << "!" );
 
-  const std::list<double>& moment_snapshots =
+  const std::vector<double>& moment_snapshots =
     Utility::getScoreSnapshots<4>(
        d_entity_total_estimator_moment_snapshots_map.find( entity_id )->second,
        response_function_index );
@@ -293,7 +295,7 @@ void StandardEntityEstimator::getEntityTotalFourthMomentSnapshots(
 void StandardEntityEstimator::getTotalMomentSnapshotHistoryValues(
                                   std::vector<uint64_t>& history_values ) const
 {
-  const std::list<uint64_t>& raw_history_values =
+  const std::vector<uint64_t>& raw_history_values =
     d_total_estimator_moment_snapshots.getSnapshotIndices();
 
   history_values.assign( raw_history_values.begin(),
@@ -304,7 +306,7 @@ void StandardEntityEstimator::getTotalMomentSnapshotHistoryValues(
 void StandardEntityEstimator::getTotalMomentSnapshotSamplingTimes(
                                     std::vector<double>& sampling_times ) const
 {
-  const std::list<double>& raw_sampling_time_values =
+  const std::vector<double>& raw_sampling_time_values =
     d_total_estimator_moment_snapshots.getSnapshotSamplingTimes();
 
   sampling_times.assign( raw_sampling_time_values.begin(),
@@ -322,7 +324,7 @@ void StandardEntityEstimator::getTotalFirstMomentSnapshots(
                       "The response function index must be less than "
                       << this->getNumberOfResponseFunctions() << "!" );
 
-  const std::list<double>& moment_snapshots =
+  const std::vector<double>& moment_snapshots =
     Utility::getScoreSnapshots<1>( d_total_estimator_moment_snapshots,
                                    response_function_index );
 
@@ -340,7 +342,7 @@ void StandardEntityEstimator::getTotalSecondMomentSnapshots(
                       "The response function index must be less than "
                       << this->getNumberOfResponseFunctions() << "!" );
 
-  const std::list<double>& moment_snapshots =
+  const std::vector<double>& moment_snapshots =
     Utility::getScoreSnapshots<2>( d_total_estimator_moment_snapshots,
                                    response_function_index );
 
@@ -358,7 +360,7 @@ void StandardEntityEstimator::getTotalThirdMomentSnapshots(
                       "The response function index must be less than "
                       << this->getNumberOfResponseFunctions() << "!" );
 
-  const std::list<double>& moment_snapshots =
+  const std::vector<double>& moment_snapshots =
     Utility::getScoreSnapshots<3>( d_total_estimator_moment_snapshots,
                                    response_function_index );
 
@@ -376,7 +378,7 @@ void StandardEntityEstimator::getTotalFourthMomentSnapshots(
                       "The response function index must be less than "
                       << this->getNumberOfResponseFunctions() << "!" );
 
-  const std::list<double>& moment_snapshots =
+  const std::vector<double>& moment_snapshots =
     Utility::getScoreSnapshots<4>( d_total_estimator_moment_snapshots,
                                    response_function_index );
 
@@ -443,6 +445,10 @@ void StandardEntityEstimator::commitHistoryContribution()
   // The bin totals over all entities
   BinContributionMap bin_totals;
 
+  // The bin indices and contributions that will be committed in a batch
+  std::vector<size_t> bin_indices;
+  std::vector<double> bin_contributions;
+
   // Get the entities with updated data
   typename SerialUpdateTracker::const_iterator entity, end_entity;
 
@@ -458,58 +464,53 @@ void StandardEntityEstimator::commitHistoryContribution()
                                                    bin_data,
                                                    end_bin_data );
 
-    while( bin_data != end_bin_data )
+    StandardEntityEstimator::extractBinContributions( bin_data,
+                                                      end_bin_data,
+                                                      bin_indices,
+                                                      bin_contributions );
+
+    for( size_t i = 0; i < bin_indices.size(); ++i )
     {
       size_t response_func_index =
-	this->calculateResponseFunctionIndex( bin_data->first );
+	this->calculateResponseFunctionIndex( bin_indices[i] );
 
-      const double bin_contribution = bin_data->second;
+      const double bin_contribution = bin_contributions[i];
 
       entity_totals[response_func_index] += bin_contribution;
 
       totals[response_func_index] += bin_contribution;
 
-      if( bin_totals.find( bin_data->first ) != bin_totals.end() )
-	bin_totals[bin_data->first] += bin_contribution;
+      if( bin_totals.find( bin_indices[i] ) != bin_totals.end() )
+	bin_totals[bin_indices[i]] += bin_contribution;
       else
-	bin_totals[bin_data->first] = bin_contribution;
-
-      this->commitHistoryContributionToBinOfEntity( entity->first,
-						    bin_data->first,
-						    bin_contribution );
-
-      ++bin_data;
+	bin_totals[bin_indices[i]] = bin_contribution;
     }
 
+    this->commitHistoryContributionToBinsOfEntity( entity->first,
+                                                   bin_indices,
+                                                   bin_contributions );
+
     // Commit the entity totals
-    for( size_t i = 0; i < num_response_funcs; ++i )
-    {
-      this->commitHistoryContributionToTotalOfEntity( entity->first,
-                                                      i,
-                                                      entity_totals[i] );
+    this->commitHistoryContributionToTotalsOfEntity( entity->first,
+                                                     entity_totals );
 
-      // Reset the entity totals
-      entity_totals[i] = 0.0;
-    }
+    // Reset the entity totals
+    std::fill( entity_totals.begin(), entity_totals.end(), 0.0 );
 
     ++entity;
   }
 
   // Commit the totals over all entities
-  for( size_t i = 0; i < num_response_funcs; ++i )
-    this->commitHistoryContributionToTotalOfEstimator( i, totals[i] );
+  this->commitHistoryContributionToTotalsOfEstimator( totals );
 
   // Commit the bin totals over all entities
-  BinContributionMap::const_iterator bin_data, end_bin_data;
-  bin_data = bin_totals.begin();
-  end_bin_data = bin_totals.end();
+  StandardEntityEstimator::extractBinContributions( bin_totals.begin(),
+                                                    bin_totals.end(),
+                                                    bin_indices,
+                                                    bin_contributions );
 
-  while( bin_data != end_bin_data )
-  {
-    this->commitHistoryContributionToBinOfTotal( bin_data->first,
-						 bin_data->second );
-    ++bin_data;
-  }
+  this->commitHistoryContributionToBinsOfTotal( bin_indices,
+                                                bin_contributions );
 
   // Reset the update tracker
   this->resetUpdateTracker( thread_id );
@@ -911,31 +912,101 @@ void StandardEntityEstimator::resizeEntityTotalEstimatorMomentsMapCollections()
     entity_data.second.resize( size, default_histogram );
 }
 
-// Commit hist. contr. to the total for a response function of an entity
-void StandardEntityEstimator::commitHistoryContributionToTotalOfEntity(
-					const EntityId entity_id,
-					const size_t response_function_index,
-					const double contribution )
+// Extract the bin contributions from a bin contribution map
+/*! \details If the bins are contiguous (e.g. every energy bin of a mesh
+ * element or cell was updated) they will be stored in increasing order so
+ * that the moments can be updated with the vectorized range update.
+ */
+void StandardEntityEstimator::extractBinContributions(
+                               BinContributionMap::const_iterator bin_data,
+                               BinContributionMap::const_iterator end_bin_data,
+                               std::vector<size_t>& bin_indices,
+                               std::vector<double>& bin_contributions )
+{
+  bin_indices.clear();
+  bin_contributions.clear();
+
+  if( bin_data == end_bin_data )
+    return;
+
+  size_t min_bin_index = bin_data->first;
+  size_t max_bin_index = bin_data->first;
+  size_t number_of_bins = 0;
+
+  for( BinContributionMap::const_iterator bin_data_it = bin_data;
+       bin_data_it != end_bin_data;
+       ++bin_data_it )
+  {
+    if( bin_data_it->first < min_bin_index )
+      min_bin_index = bin_data_it->first;
+    else if( bin_data_it->first > max_bin_index )
+      max_bin_index = bin_data_it->first;
+
+    ++number_of_bins;
+  }
+
+  if( max_bin_index - min_bin_index + 1 == number_of_bins )
+  {
+    bin_indices.resize( number_of_bins );
+    bin_contributions.resize( number_of_bins );
+
+    while( bin_data != end_bin_data )
+    {
+      const size_t local_index = bin_data->first - min_bin_index;
+
+      bin_indices[local_index] = bin_data->first;
+      bin_contributions[local_index] = bin_data->second;
+
+      ++bin_data;
+    }
+  }
+  else
+  {
+    while( bin_data != end_bin_data )
+    {
+      bin_indices.push_back( bin_data->first );
+      bin_contributions.push_back( bin_data->second );
+
+      ++bin_data;
+    }
+  }
+}
+
+// Commit hist. contr. to the totals for each response function of an entity
+void StandardEntityEstimator::commitHistoryContributionToTotalsOfEntity(
+                                     const EntityId entity_id,
+                                     const std::vector<double>& contributions )
 {
   // Make sure the entity is assigned to this estimator
   testPrecondition( this->isEntityAssigned( entity_id ) );
-  // Make sure the response function index is valid
-  testPrecondition( response_function_index <
+  // Make sure the contributions are valid
+  testPrecondition( contributions.size() ==
 		    this->getNumberOfResponseFunctions() );
-  // Make sure the contribution is valid
-  testPrecondition( !Utility::QuantityTraits<double>::isnaninf( contribution ) );
+
+  for( size_t i = 0; i < contributions.size(); ++i )
+  {
+    testPrecondition( !Utility::QuantityTraits<double>::isnaninf( contributions[i] ) );
+  }
 
   Estimator::FourEstimatorMomentsCollection&
     entity_total_estimator_moments_collection =
     d_entity_total_estimator_moments_map.find( entity_id )->second;
 
-  // Update the moments
+  // Update the moments (the response functions are contiguous)
   #pragma omp critical
   {
-    entity_total_estimator_moments_collection.addRawScore( response_function_index, contribution );
+    entity_total_estimator_moments_collection.addRawScoresToRange(
+                                                       0,
+                                                       contributions.data(),
+                                                       contributions.size() );
   }
 
-  this->addHistoryContributionToEntityBinHistogram( entity_id, response_function_index, contribution );
+  for( size_t i = 0; i < contributions.size(); ++i )
+  {
+    this->addHistoryContributionToEntityBinHistogram( entity_id,
+                                                      i,
+                                                      contributions[i] );
+  }
 }
 
 // Add contribution to entity bin histogram
@@ -962,25 +1033,29 @@ void StandardEntityEstimator::addHistoryContributionToEntityBinHistogram(
   }
 }  
 
-// Commit history contr. to the total for a response function of an estimator
-void StandardEntityEstimator::commitHistoryContributionToTotalOfEstimator(
-					const size_t response_function_index,
-					const double contribution )
+// Commit hist. contr. to the totals for each response function of the estimator
+void StandardEntityEstimator::commitHistoryContributionToTotalsOfEstimator(
+                                     const std::vector<double>& contributions )
 {
-  // Make sure the response function index is valid
-  testPrecondition( response_function_index <
+  // Make sure the contributions are valid
+  testPrecondition( contributions.size() ==
 		    this->getNumberOfResponseFunctions() );
-  // Make sure the contribution is valid
-  testPrecondition( !Utility::QuantityTraits<double>::isnaninf( contribution ) );
 
-  // Update the moments
+  for( size_t i = 0; i < contributions.size(); ++i )
+  {
+    testPrecondition( !Utility::QuantityTraits<double>::isnaninf( contributions[i] ) );
+  }
+
+  // Update the moments (the response functions are contiguous)
   #pragma omp critical
   {
-    d_total_estimator_moments.addRawScore( response_function_index, contribution );
+    d_total_estimator_moments.addRawScoresToRange( 0,
+                                                   contributions.data(),
+                                                   contributions.size() );
   }
 
-  this->addHistoryContributionToTotalBinHistogram( response_function_index,
-                                                   contribution );
+  for( size_t i = 0; i < contributions.size(); ++i )
+    this->addHistoryContributionToTotalBinHistogram( i, contributions[i] );
 }
 
 // Add contribution to total bin histogram
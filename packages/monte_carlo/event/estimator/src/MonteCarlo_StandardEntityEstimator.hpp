@@ -13,6 +13,7 @@
 #include "MonteCarlo_EntityEstimator.hpp"
 #include "Utility_Map.hpp"
 #include "Utility_Vector.hpp"
+#include "Utility_PerThread.hpp"
 #include "Utility_QuantityTraits.hpp"
 
 namespace MonteCarlo{
@@ -33,7 +34,7 @@ class StandardEntityEstimator : public EntityEstimator
   typedef std::unordered_map<EntityId,BinContributionMap> SerialUpdateTracker;
 
   // Typedef for parallel update tracker
-  typedef std::vector<SerialUpdateTracker> ParallelUpdateTracker;
+  typedef Utility::PerThread<SerialUpdateTracker> ParallelUpdateTracker;
 
 protected:
 
@@ -180,7 +181,7 @@ public:
   void commitHistoryContribution() final override;
 
   //! Enable support for multiple threads
-  void enableThreadSupport( const unsigned num_threads ) final override;
+  void enableThreadSupport( const unsigned num_threads ) override;
 
   //! Reset estimator data
   void resetData() final override;
@@ -234,16 +235,21 @@ private:
   // Resize the entity total estimator moments map collections
   void resizeEntityTotalEstimatorMomentsMapCollections();
 
-  // Commit history contr. to the total for a response function of an entity
-  void commitHistoryContributionToTotalOfEntity(
-					const EntityId entity_id,
-					const size_t response_function_index,
-					const double contribution );
-
-  // Commit hist. contr. to the total for a response function of the estimator
-  void commitHistoryContributionToTotalOfEstimator(
-					const size_t response_function_index,
-					const double contribution );
+  // Extract the bin contributions from a bin contribution map
+  static void extractBinContributions(
+                               BinContributionMap::const_iterator bin_data,
+                               BinContributionMap::const_iterator end_bin_data,
+                               std::vector<size_t>& bin_indices,
+                               std::vector<double>& bin_contributions );
+
+  // Commit hist. contr. to the totals for each response function of an entity
+  void commitHistoryContributionToTotalsOfEntity(
+                                    const EntityId entity_id,
+                                    const std::vector<double>& contributions );
+
+  // Commit hist. contr. to the totals for each response function of the estimator
+  void commitHistoryContributionToTotalsOfEstimator(
+                                    const std::vector<double>& contributions );
 
   // Add contribution to entity bin histogram
   void addHistoryContributionToEntityBinHistogram(
@@ -0,0 +1,427 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstPointDetectorFluxEstimator.cpp
+//! \author Alex Robinson
+//! \brief  Point detector flux estimator unit tests.
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+#include <cmath>
+
+// FRENSIE Includes
+#include "MonteCarlo_PointDetectorFluxEstimator.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+#include "MonteCarlo_NeutronState.hpp"
+#include "Geometry_InfiniteMediumModel.hpp"
+#include "Data_ScatteringCenterPropertiesDatabase.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_PhysicalConstants.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+using boost::units::si::kelvin;
+using boost::units::cgs::cubic_centimeter;
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+std::shared_ptr<const MonteCarlo::FilledGeometryModel> filled_model;
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Calculate the expected contribution from a collision
+template<typename StateType>
+double calculateExpectedContribution( const double energy,
+                                      const double angle_cosine,
+                                      const double distance,
+                                      const double inverse_total_cross_section,
+                                      const double weight )
+{
+  typedef typename MonteCarlo::Details::FilledGeometryModelUpcastHelper<StateType>::UpcastType
+    FilledParticleGeometryModel;
+
+  const auto& material =
+    static_cast<const FilledParticleGeometryModel&>( *filled_model ).getMaterial( 1 );
+
+  std::vector<std::pair<double,double> > cross_sections;
+
+  material->getMacroscopicDifferentialScatteringCrossSections( energy,
+                                                               angle_cosine,
+                                                               cross_sections );
+
+  double contribution = 0.0;
+
+  for( auto&& cross_section : cross_sections )
+  {
+    contribution += cross_section.second*std::exp( -distance*
+         filled_model->getMacroscopicTotalCrossSection<StateType>( 1, cross_section.first ) );
+  }
+
+  return contribution*inverse_total_cross_section*weight/
+    (2*Utility::PhysicalConstants::pi*distance*distance);
+}
+
+// Calculate the expected contribution from a collision (no attenuation)
+double calculateUnattenuatedPhotonContribution( const double energy,
+                                                const double angle_cosine,
+                                                const double distance )
+{
+  const auto& material =
+    static_cast<const MonteCarlo::FilledPhotonGeometryModel&>( *filled_model ).getMaterial( 1 );
+
+  std::vector<std::pair<double,double> > cross_sections;
+
+  material->getMacroscopicDifferentialScatteringCrossSections( energy,
+                                                               angle_cosine,
+                                                               cross_sections );
+
+  double contribution = 0.0;
+
+  for( auto&& cross_section : cross_sections )
+    contribution += cross_section.second;
+
+  return contribution/(2*Utility::PhysicalConstants::pi*distance*distance);
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the estimator is not a cell, surface or mesh estimator
+FRENSIE_UNIT_TEST_TEMPLATE( PointDetectorFluxEstimator,
+                            check_type,
+                            MonteCarlo::WeightMultiplier,
+                            MonteCarlo::WeightAndEnergyMultiplier )
+{
+  FETCH_TEMPLATE_PARAM( 0, ContributionMultiplierPolicy );
+  std::shared_ptr<MonteCarlo::Estimator> estimator;
+
+  std::vector<MonteCarlo::Estimator::EntityId> detector_ids( {0, 1} );
+
+  std::vector<std::array<double,3> > detector_positions( 2 );
+  detector_positions[0] = {0.0, 0.0, 2.0};
+  detector_positions[1] = {0.0, 3.0, 0.0};
+
+  estimator.reset( new MonteCarlo::PointDetectorFluxEstimator<ContributionMultiplierPolicy>(
+                                                          0u,
+                                                          1.0,
+                                                          detector_ids,
+                                                          detector_positions,
+                                                          filled_model ) );
+
+  FRENSIE_CHECK( !estimator->isCellEstimator() );
+  FRENSIE_CHECK( !estimator->isSurfaceEstimator() );
+  FRENSIE_CHECK( !estimator->isMeshEstimator() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the detector positions can be returned
+FRENSIE_UNIT_TEST( PointDetectorFluxEstimator, getDetectorPosition )
+{
+  std::vector<MonteCarlo::Estimator::EntityId> detector_ids( {0, 1} );
+
+  std::vector<std::array<double,3> > detector_positions( 2 );
+  detector_positions[0] = {0.0, 0.0, 2.0};
+  detector_positions[1] = {0.0, 3.0, 0.0};
+
+  MonteCarlo::WeightMultipliedPointDetectorFluxEstimator estimator(
+                                                          0u,
+                                                          1.0,
+                                                          detector_ids,
+                                                          detector_positions,
+                                                          filled_model );
+
+  for( size_t i = 0; i < 3; ++i )
+  {
+    FRENSIE_CHECK_EQUAL( estimator.getDetectorPosition( 0 )[i],
+                         detector_positions[0][i] );
+    FRENSIE_CHECK_EQUAL( estimator.getDetectorPosition( 1 )[i],
+                         detector_positions[1][i] );
+  }
+
+  FRENSIE_CHECK_EQUAL( estimator.getRussianRouletteThreshold(), 0.0 );
+
+  estimator.setRussianRouletteThreshold( 1e-3 );
+
+  FRENSIE_CHECK_EQUAL( estimator.getRussianRouletteThreshold(), 1e-3 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that only a photon or a neutron type can be assigned
+FRENSIE_UNIT_TEST( PointDetectorFluxEstimator, setParticleTypes )
+{
+  std::vector<MonteCarlo::Estimator::EntityId> detector_ids( {0} );
+
+  std::vector<std::array<double,3> > detector_positions( 1 );
+  detector_positions[0] = {0.0, 0.0, 2.0};
+
+  MonteCarlo::WeightMultipliedPointDetectorFluxEstimator estimator(
+                                                          0u,
+                                                          1.0,
+                                                          detector_ids,
+                                                          detector_positions,
+                                                          filled_model );
+
+  estimator.setParticleTypes( std::vector<MonteCarlo::ParticleType>( {MonteCarlo::ELECTRON} ) );
+
+  FRENSIE_CHECK_EQUAL( estimator.getParticleTypes().size(), 0 );
+
+  estimator.setParticleTypes( std::vector<MonteCarlo::ParticleType>( {MonteCarlo::PHOTON, MonteCarlo::NEUTRON} ) );
+
+  FRENSIE_CHECK_EQUAL( estimator.getParticleTypes().size(), 1 );
+  FRENSIE_CHECK( estimator.isParticleTypeAssigned( MonteCarlo::PHOTON ) );
+  FRENSIE_CHECK( !estimator.isParticleTypeAssigned( MonteCarlo::NEUTRON ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a photon collision contributes to the detectors
+FRENSIE_UNIT_TEST( PointDetectorFluxEstimator,
+                   updateFromParticleCollidingInCellEvent_photon )
+{
+  std::vector<MonteCarlo::Estimator::EntityId> detector_ids( {0, 1} );
+
+  std::vector<std::array<double,3> > detector_positions( 2 );
+  detector_positions[0] = {0.0, 0.0, 2.0};
+  detector_positions[1] = {0.0, 3.0, 0.0};
+
+  std::shared_ptr<MonteCarlo::WeightMultipliedPointDetectorFluxEstimator>
+    estimator( new MonteCarlo::WeightMultipliedPointDetectorFluxEstimator(
+                                                          0u,
+                                                          1.0,
+                                                          detector_ids,
+                                                          detector_positions,
+                                                          filled_model ) );
+
+  std::shared_ptr<MonteCarlo::Estimator> estimator_base = estimator;
+
+  estimator_base->setParticleTypes( std::vector<MonteCarlo::ParticleType>( {MonteCarlo::PHOTON} ) );
+
+  MonteCarlo::PhotonState photon( 0 );
+  photon.setEnergy( 1.0 );
+  photon.setPosition( 0.0, 0.0, 0.0 );
+  photon.setDirection( 0.0, 0.0, 1.0 );
+  photon.setWeight( 2.0 );
+  photon.embedInModel( *filled_model );
+
+  estimator->updateFromParticleCollidingInCellEvent( photon, 1, 0.5 );
+
+  FRENSIE_CHECK( estimator_base->hasUncommittedHistoryContribution() );
+
+  estimator_base->commitHistoryContribution();
+
+  Utility::ArrayView<const double> first_moments =
+    estimator_base->getEntityBinDataFirstMoments( 0 );
+
+  FRENSIE_REQUIRE_EQUAL( first_moments.size(), 1 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( first_moments[0],
+                                   calculateExpectedContribution<MonteCarlo::PhotonState>( 1.0, 1.0, 2.0, 0.5, 2.0 ),
+                                   1e-12 );
+
+  first_moments = estimator_base->getEntityBinDataFirstMoments( 1 );
+
+  FRENSIE_REQUIRE_EQUAL( first_moments.size(), 1 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( first_moments[0],
+                                   calculateExpectedContribution<MonteCarlo::PhotonState>( 1.0, 0.0, 3.0, 0.5, 2.0 ),
+                                   1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a neutron collision contributes to the detectors
+FRENSIE_UNIT_TEST( PointDetectorFluxEstimator,
+                   updateFromParticleCollidingInCellEvent_neutron )
+{
+  std::vector<MonteCarlo::Estimator::EntityId> detector_ids( {0, 1} );
+
+  std::vector<std::array<double,3> > detector_positions( 2 );
+  detector_positions[0] = {0.0, 0.0, 2.0};
+  detector_positions[1] = {0.0, 0.0, -3.0};
+
+  std::shared_ptr<MonteCarlo::WeightMultipliedPointDetectorFluxEstimator>
+    estimator( new MonteCarlo::WeightMultipliedPointDetectorFluxEstimator(
+                                                          0u,
+                                                          1.0,
+                                                          detector_ids,
+                                                          detector_positions,
+                                                          filled_model ) );
+
+  std::shared_ptr<MonteCarlo::Estimator> estimator_base = estimator;
+
+  estimator_base->setParticleTypes( std::vector<MonteCarlo::ParticleType>( {MonteCarlo::NEUTRON} ) );
+
+  MonteCarlo::NeutronState neutron( 0 );
+  neutron.setEnergy( 1.0 );
+  neutron.setPosition( 0.0, 0.0, 0.0 );
+  neutron.setDirection( 0.0, 0.0, 1.0 );
+  neutron.setWeight( 1.0 );
+  neutron.embedInModel( *filled_model );
+
+  estimator->updateFromParticleCollidingInCellEvent( neutron, 1, 0.25 );
+
+  estimator_base->commitHistoryContribution();
+
+  Utility::ArrayView<const double> first_moments =
+    estimator_base->getEntityBinDataFirstMoments( 0 );
+
+  FRENSIE_REQUIRE_EQUAL( first_moments.size(), 1 );
+  FRENSIE_CHECK( first_moments[0] > 0.0 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( first_moments[0],
+                                   calculateExpectedContribution<MonteCarlo::NeutronState>( 1.0, 1.0, 2.0, 0.25, 1.0 ),
+                                   1e-12 );
+
+  // H-1 cannot scatter a neutron backward (in the lab frame)
+  first_moments = estimator_base->getEntityBinDataFirstMoments( 1 );
+
+  FRENSIE_REQUIRE_EQUAL( first_moments.size(), 1 );
+  FRENSIE_CHECK_EQUAL( first_moments[0], 0.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that small contributions are rouletted
+FRENSIE_UNIT_TEST( PointDetectorFluxEstimator,
+                   updateFromParticleCollidingInCellEvent_roulette )
+{
+  std::vector<MonteCarlo::Estimator::EntityId> detector_ids( {0} );
+
+  std::vector<std::array<double,3> > detector_positions( 1 );
+  detector_positions[0] = {0.0, 0.0, 2.0};
+
+  std::shared_ptr<MonteCarlo::WeightMultipliedPointDetectorFluxEstimator>
+    estimator( new MonteCarlo::WeightMultipliedPointDetectorFluxEstimator(
+                                                          0u,
+                                                          1.0,
+                                                          detector_ids,
+                                                          detector_positions,
+                                                          filled_model ) );
+
+  std::shared_ptr<MonteCarlo::Estimator> estimator_base = estimator;
+
+  estimator_base->setParticleTypes( std::vector<MonteCarlo::ParticleType>( {MonteCarlo::PHOTON} ) );
+
+  MonteCarlo::PhotonState photon( 0 );
+  photon.setEnergy( 1.0 );
+  photon.setPosition( 0.0, 0.0, 0.0 );
+  photon.setDirection( 0.0, 0.0, 1.0 );
+  photon.setWeight( 1.0 );
+  photon.embedInModel( *filled_model );
+
+  // The unattenuated contribution
+  const double unattenuated_contribution =
+    calculateUnattenuatedPhotonContribution( 1.0, 1.0, 2.0 );
+
+  estimator->setRussianRouletteThreshold( 4.0*unattenuated_contribution );
+
+  std::vector<double> fake_stream( 2 );
+  fake_stream[0] = 0.26; // kill the contribution
+  fake_stream[1] = 0.24; // keep the contribution
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  estimator->updateFromParticleCollidingInCellEvent( photon, 1, 1.0 );
+
+  FRENSIE_CHECK( !estimator_base->hasUncommittedHistoryContribution() );
+
+  estimator->updateFromParticleCollidingInCellEvent( photon, 1, 1.0 );
+
+  FRENSIE_CHECK( estimator_base->hasUncommittedHistoryContribution() );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+
+  estimator_base->commitHistoryContribution();
+
+  Utility::ArrayView<const double> first_moments =
+    estimator_base->getEntityBinDataFirstMoments( 0 );
+
+  FRENSIE_REQUIRE_EQUAL( first_moments.size(), 1 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( first_moments[0],
+                                   4.0*calculateExpectedContribution<MonteCarlo::PhotonState>( 1.0, 1.0, 2.0, 1.0, 1.0 ),
+                                   1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+std::string test_scattering_center_database_name;
+
+FRENSIE_CUSTOM_UNIT_TEST_COMMAND_LINE_OPTIONS()
+{
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "test_database",
+                                        test_scattering_center_database_name, "",
+                                        "Test scattering center database name "
+                                        "with path" );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // Determine the database directory
+  boost::filesystem::path database_path =
+    test_scattering_center_database_name;
+
+  // Load the database
+  const Data::ScatteringCenterPropertiesDatabase database( database_path );
+
+  const Data::AtomProperties& h_properties =
+    database.getAtomProperties( 1001 );
+
+  const Data::NuclideProperties& h1_properties =
+    database.getNuclideProperties( 1001 );
+
+  // Set the sattering center definitions
+  std::shared_ptr<MonteCarlo::ScatteringCenterDefinitionDatabase>
+    scattering_center_definition_database(
+                          new MonteCarlo::ScatteringCenterDefinitionDatabase );
+
+  MonteCarlo::ScatteringCenterDefinition& h_definition =
+    scattering_center_definition_database->createDefinition( "H1 @ 293.6K", 1001 );
+
+  h_definition.setPhotoatomicDataProperties(
+          h_properties.getSharedPhotoatomicDataProperties(
+                Data::PhotoatomicDataProperties::Native_EPR_FILE, 0 ) );
+
+  h_definition.setElectroatomicDataProperties(
+          h_properties.getSharedElectroatomicDataProperties(
+              Data::ElectroatomicDataProperties::Native_EPR_FILE, 0 ) );
+
+  h_definition.setNuclearDataProperties(
+          h1_properties.getSharedNuclearDataProperties(
+             Data::NuclearDataProperties::ACE_FILE, 7, 293.6*kelvin, false ) );
+
+  // Set the material definitions
+  std::shared_ptr<MonteCarlo::MaterialDefinitionDatabase>
+    material_definition_database( new MonteCarlo::MaterialDefinitionDatabase );
+
+  material_definition_database->addDefinition( "H1 @ 293.6K", 2,
+                                               {"H1 @ 293.6K"}, {1.0} );
+
+  // Create the unfilled model
+  std::shared_ptr<const Geometry::Model> unfilled_model(
+             new Geometry::InfiniteMediumModel( 1, 2, 1e24/cubic_centimeter ) );
+  std::shared_ptr<MonteCarlo::SimulationProperties>
+    properties( new MonteCarlo::SimulationProperties );
+  properties->setParticleMode( MonteCarlo::NEUTRON_PHOTON_ELECTRON_MODE );
+
+  filled_model.reset( new MonteCarlo::FilledGeometryModel(
+                                         database_path,
+                                         scattering_center_definition_database,
+                                         material_definition_database,
+                                         properties,
+                                         unfilled_model,
+                                         true ) );
+
+  // Initialize the random number generator
+  Utility::RandomNumberGenerator::createStreams();
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstPointDetectorFluxEstimator.cpp
+//---------------------------------------------------------------------------//
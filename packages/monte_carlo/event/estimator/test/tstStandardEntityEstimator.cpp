@@ -9,6 +9,7 @@
 // Std Lib Includes
 #include <iostream>
 #include <memory>
+#include <limits>
 
 // FRENSIE Includes
 #include "MonteCarlo_StandardEntityEstimator.hpp"
@@ -3104,6 +3105,91 @@ FRENSIE_UNIT_TEST( StandardEntityEstimator, takeSnapshot_with_bin_snapshots )
   FRENSIE_CHECK_FLOATING_EQUALITY( processed_snapshots["fom"], std::vector<double>( {0.5, 0.5625} ), 1e-15 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the number of snapshots that are kept can be limited
+FRENSIE_UNIT_TEST( StandardEntityEstimator, setMaxNumberOfSnapshots )
+{
+  std::shared_ptr<TestStandardEntityEstimator> estimator;
+  initializeStandardEntityEstimator( estimator );
+
+  estimator->enableSnapshotsOnEntityBins();
+
+  FRENSIE_CHECK_EQUAL( estimator->getMaxNumberOfSnapshots(),
+                       std::numeric_limits<size_t>::max() );
+  FRENSIE_CHECK_THROW( estimator->setMaxNumberOfSnapshots( 0 ),
+                       std::runtime_error );
+
+  estimator->setMaxNumberOfSnapshots( 2 );
+
+  FRENSIE_CHECK_EQUAL( estimator->getMaxNumberOfSnapshots(), 2 );
+
+  for( size_t i = 0; i < 5; ++i )
+    estimator->takeSnapshot( 1, 1.0 );
+
+  // Every other snapshot is discarded once the max number is exceeded - the
+  // first and the most recent snapshots remain
+  std::vector<uint64_t> history_values;
+  std::vector<double> sampling_times;
+
+  estimator->getTotalBinMomentSnapshotHistoryValues( history_values );
+  estimator->getTotalBinMomentSnapshotSamplingTimes( sampling_times );
+
+  FRENSIE_CHECK_EQUAL( history_values, std::vector<uint64_t>( {1, 5} ) );
+  FRENSIE_CHECK_EQUAL( sampling_times, std::vector<double>( {1.0, 5.0} ) );
+
+  std::vector<double> moments;
+
+  estimator->getTotalBinFirstMomentSnapshots( 0, moments );
+
+  FRENSIE_CHECK_EQUAL( moments.size(), 2 );
+
+  estimator->getEntityTotalMomentSnapshotHistoryValues( 0, history_values );
+
+  FRENSIE_CHECK_EQUAL( history_values, std::vector<uint64_t>( {1, 5} ) );
+
+  estimator->getEntityTotalFirstMomentSnapshots( 0, 0, moments );
+
+  FRENSIE_CHECK_EQUAL( moments.size(), 2 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the oldest snapshots can be discarded instead of thinned
+FRENSIE_UNIT_TEST( StandardEntityEstimator, setDiscardOldestSnapshotsModeOn )
+{
+  std::shared_ptr<TestStandardEntityEstimator> estimator;
+  initializeStandardEntityEstimator( estimator );
+
+  estimator->enableSnapshotsOnEntityBins();
+
+  FRENSIE_CHECK( !estimator->isDiscardOldestSnapshotsModeOn() );
+
+  estimator->setMaxNumberOfSnapshots( 2 );
+  estimator->setDiscardOldestSnapshotsModeOn();
+
+  FRENSIE_CHECK( estimator->isDiscardOldestSnapshotsModeOn() );
+
+  for( size_t i = 0; i < 5; ++i )
+    estimator->takeSnapshot( 1, 1.0 );
+
+  // Only the most recent snapshots remain
+  std::vector<uint64_t> history_values;
+  std::vector<double> sampling_times;
+
+  estimator->getTotalBinMomentSnapshotHistoryValues( history_values );
+  estimator->getTotalBinMomentSnapshotSamplingTimes( sampling_times );
+
+  FRENSIE_CHECK_EQUAL( history_values, std::vector<uint64_t>( {4, 5} ) );
+  FRENSIE_CHECK_EQUAL( sampling_times, std::vector<double>( {4.0, 5.0} ) );
+
+  estimator->getEntityTotalMomentSnapshotHistoryValues( 0, history_values );
+
+  FRENSIE_CHECK_EQUAL( history_values, std::vector<uint64_t>( {4, 5} ) );
+
+  estimator->setThinSnapshotsModeOn();
+
+  FRENSIE_CHECK( !estimator->isDiscardOldestSnapshotsModeOn() );
+}
+
 //---------------------------------------------------------------------------//
 // Check that a partial history contribution can be added to the estimator
 FRENSIE_UNIT_TEST( StandardEntityEstimator, resetData_no_additional_bin_stats )
@@ -0,0 +1,388 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_DXTRANSpheres.cpp
+//! \author Alex Robinson
+//! \brief  DXTRAN spheres class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <stdexcept>
+#include <limits>
+#include <cmath>
+
+// FRENSIE Includes
+#include "MonteCarlo_DXTRANSpheres.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+#include "MonteCarlo_NeutronState.hpp"
+#include "Utility_3DCartesianVectorHelpers.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_PhysicalConstants.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_LoggingMacros.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+DXTRANSpheres::DXTRANSpheres(
+                      const std::shared_ptr<const FilledGeometryModel>& model )
+  : d_model( model ),
+    d_spheres(),
+    d_thread_caches()
+{
+  // Make sure that the model is valid
+  testPrecondition( model.get() );
+}
+
+// Add a DXTRAN sphere for the specified particle type
+void DXTRANSpheres::addSphere( const ParticleType particle_type,
+                               const SphereCenter& center,
+                               const double radius )
+{
+  TEST_FOR_EXCEPTION( particle_type != PHOTON && particle_type != NEUTRON,
+                      std::runtime_error,
+                      "DXTRAN spheres can only be used with photons and "
+                      "neutrons (not " << particle_type << ")!" );
+
+  TEST_FOR_EXCEPTION( radius <= 0.0,
+                      std::runtime_error,
+                      "The DXTRAN sphere radius must be greater than 0.0!" );
+
+  d_spheres[particle_type].push_back( std::make_pair( center, radius ) );
+}
+
+// Check if DXTRAN spheres have been specified for the particle type
+bool DXTRANSpheres::hasSpheres( const ParticleType particle_type ) const
+{
+  return d_spheres.find( particle_type ) != d_spheres.end();
+}
+
+// Return the number of DXTRAN spheres of the particle type
+size_t DXTRANSpheres::getNumberOfSpheres(
+                                       const ParticleType particle_type ) const
+{
+  std::map<ParticleType,std::vector<Sphere> >::const_iterator spheres_it =
+    d_spheres.find( particle_type );
+
+  if( spheres_it != d_spheres.end() )
+    return spheres_it->second.size();
+  else
+    return 0;
+}
+
+// Return the center of a DXTRAN sphere of the particle type
+auto DXTRANSpheres::getSphereCenter( const ParticleType particle_type,
+                                     const size_t sphere_index ) const
+  -> const SphereCenter&
+{
+  // Make sure that the sphere index is valid
+  testPrecondition( sphere_index < this->getNumberOfSpheres( particle_type ) );
+
+  return d_spheres.find( particle_type )->second[sphere_index].first;
+}
+
+// Return the radius of a DXTRAN sphere of the particle type
+double DXTRANSpheres::getSphereRadius( const ParticleType particle_type,
+                                       const size_t sphere_index ) const
+{
+  // Make sure that the sphere index is valid
+  testPrecondition( sphere_index < this->getNumberOfSpheres( particle_type ) );
+
+  return d_spheres.find( particle_type )->second[sphere_index].second;
+}
+
+// Return the distance to the nearest DXTRAN sphere that will be entered
+/*! \details A sphere that contains the particle (or that the particle lies
+ * on) will never be entered since the flight of the particle is a straight
+ * line. If no sphere will be entered infinity will be returned.
+ */
+double DXTRANSpheres::getDistanceToSphereEntry(
+                                          const ParticleState& particle ) const
+{
+  double distance_to_entry = std::numeric_limits<double>::infinity();
+
+  std::map<ParticleType,std::vector<Sphere> >::const_iterator spheres_it =
+    d_spheres.find( particle.getParticleType() );
+
+  if( spheres_it == d_spheres.end() )
+    return distance_to_entry;
+
+  const double* direction = particle.getDirection();
+
+  for( auto&& sphere : spheres_it->second )
+  {
+    const double relative_position[3] =
+      {particle.getXPosition() - sphere.first[0],
+       particle.getYPosition() - sphere.first[1],
+       particle.getZPosition() - sphere.first[2]};
+
+    const double radius_squared = sphere.second*sphere.second;
+
+    const double distance_squared_difference =
+      relative_position[0]*relative_position[0] +
+      relative_position[1]*relative_position[1] +
+      relative_position[2]*relative_position[2] - radius_squared;
+
+    // The particle is inside of the sphere or on its surface (DXTRAN
+    // particles are created on the surface)
+    if( distance_squared_difference <= 1e-9*radius_squared )
+      continue;
+
+    const double projection = relative_position[0]*direction[0] +
+      relative_position[1]*direction[1] +
+      relative_position[2]*direction[2];
+
+    // The particle is moving away from the sphere
+    if( projection >= 0.0 )
+      continue;
+
+    const double discriminant =
+      projection*projection - distance_squared_difference;
+
+    // The particle will miss the sphere
+    if( discriminant < 0.0 )
+      continue;
+
+    const double distance = -projection - std::sqrt( discriminant );
+
+    if( distance < distance_to_entry )
+      distance_to_entry = distance;
+  }
+
+  return distance_to_entry;
+}
+
+// Create the DXTRAN particles of a collision
+/*! \details The particle must have its pre-collision state. The DXTRAN
+ * particles will be added to the bank.
+ */
+void DXTRANSpheres::createDXTRANParticles(
+                                    const ParticleState& particle,
+                                    const double inverse_total_cross_section,
+                                    ParticleBank& bank ) const
+{
+  // Make sure that the inverse total cross section is valid
+  testPrecondition( inverse_total_cross_section >= 0.0 );
+
+  switch( particle.getParticleType() )
+  {
+    case PHOTON:
+    {
+      this->createDXTRANParticlesImpl<PhotonState>(
+                                                 particle,
+                                                 inverse_total_cross_section,
+                                                 bank );
+      break;
+    }
+    case NEUTRON:
+    {
+      this->createDXTRANParticlesImpl<NeutronState>(
+                                                 particle,
+                                                 inverse_total_cross_section,
+                                                 bank );
+      break;
+    }
+    default:
+      break;
+  }
+}
+
+// Create the DXTRAN particles of a collision
+/*! \details The direction of the DXTRAN particle is sampled uniformly from
+ * the cone subtended by the sphere and one of the scattering reactions that
+ * can emit the particle in that direction is sampled (proportional to its
+ * macroscopic differential cross section). The weight of the DXTRAN particle
+ * is therefore the sum of the macroscopic differential cross sections
+ * (divided by 2*pi and the total macroscopic cross section) divided by the
+ * direction PDF, times the attenuation along the ray to the sphere.
+ */
+template<typename StateType>
+void DXTRANSpheres::createDXTRANParticlesImpl(
+                                    const ParticleState& particle,
+                                    const double inverse_total_cross_section,
+                                    ParticleBank& bank ) const
+{
+  typedef typename Details::FilledGeometryModelUpcastHelper<StateType>::UpcastType
+    FilledParticleGeometryModel;
+
+  std::map<ParticleType,std::vector<Sphere> >::const_iterator spheres_it =
+    d_spheres.find( particle.getParticleType() );
+
+  if( spheres_it == d_spheres.end() )
+    return;
+
+  const auto& material =
+    static_cast<const FilledParticleGeometryModel&>( *d_model ).getMaterial( particle.getCell() );
+
+  ThreadCache& cache = d_thread_caches.local();
+
+  for( auto&& sphere : spheres_it->second )
+  {
+    double direction_to_center[3] =
+      {sphere.first[0] - particle.getXPosition(),
+       sphere.first[1] - particle.getYPosition(),
+       sphere.first[2] - particle.getZPosition()};
+
+    const double distance_to_center =
+      Utility::normalizeVectorAndReturnMagnitude( direction_to_center );
+
+    // A particle that collides inside of a sphere cannot enter it
+    if( distance_to_center <= sphere.second )
+      continue;
+
+    const double radius_ratio = sphere.second/distance_to_center;
+
+    const double min_angle_cosine =
+      std::sqrt( 1.0 - radius_ratio*radius_ratio );
+
+    // Sample the direction from the cone subtended by the sphere
+    const double angle_cosine = min_angle_cosine + (1.0 - min_angle_cosine)*
+      Utility::RandomNumberGenerator::getRandomNumber<double>();
+
+    const double azimuthal_angle = 2*Utility::PhysicalConstants::pi*
+      Utility::RandomNumberGenerator::getRandomNumber<double>();
+
+    double direction[3];
+
+    Utility::rotateUnitVectorThroughPolarAndAzimuthalAngle( angle_cosine,
+                                                            azimuthal_angle,
+                                                            direction_to_center,
+                                                            direction );
+
+    double scattering_angle_cosine =
+      Utility::calculateCosineOfAngleBetweenUnitVectors( particle.getDirection(),
+                                                         direction );
+
+    if( scattering_angle_cosine > 1.0 )
+      scattering_angle_cosine = 1.0;
+    else if( scattering_angle_cosine < -1.0 )
+      scattering_angle_cosine = -1.0;
+
+    material->getMacroscopicDifferentialScatteringCrossSections(
+                                          particle.getEnergy(),
+                                          scattering_angle_cosine,
+                                          cache.differential_cross_sections );
+
+    if( cache.differential_cross_sections.empty() )
+      continue;
+
+    double differential_cross_section = 0.0;
+
+    for( auto&& cross_section : cache.differential_cross_sections )
+      differential_cross_section += cross_section.second;
+
+    // Sample the scattering reaction (outgoing energy)
+    const double scaled_random_number = differential_cross_section*
+      Utility::RandomNumberGenerator::getRandomNumber<double>();
+
+    double partial_cross_section = 0.0;
+    double outgoing_energy = cache.differential_cross_sections.back().first;
+
+    for( auto&& cross_section : cache.differential_cross_sections )
+    {
+      partial_cross_section += cross_section.second;
+
+      if( scaled_random_number < partial_cross_section )
+      {
+        outgoing_energy = cross_section.first;
+
+        break;
+      }
+    }
+
+    // Calculate the distance to the sphere along the sampled direction
+    double discriminant = sphere.second*sphere.second -
+      distance_to_center*distance_to_center*
+      (1.0 - angle_cosine*angle_cosine);
+
+    if( discriminant < 0.0 )
+      discriminant = 0.0;
+
+    const double distance_to_entry =
+      distance_to_center*angle_cosine - std::sqrt( discriminant );
+
+    if( !this->traceRayToSphere( cache,
+                                 particle,
+                                 direction,
+                                 distance_to_entry ) )
+      continue;
+
+    const double optical_depth =
+      cache.ray_tracer.calculateOpticalDepth<StateType>( *d_model,
+                                                         outgoing_energy );
+
+    const double weight = particle.getWeight()*differential_cross_section*
+      (1.0 - min_angle_cosine)*inverse_total_cross_section*
+      std::exp( -optical_depth );
+
+    if( weight <= 0.0 )
+      continue;
+
+    const double entry_position[3] =
+      {particle.getXPosition() + distance_to_entry*direction[0],
+       particle.getYPosition() + distance_to_entry*direction[1],
+       particle.getZPosition() + distance_to_entry*direction[2]};
+
+    std::shared_ptr<ParticleState> dxtran_particle( particle.clone() );
+
+    dxtran_particle->embedInModel( *d_model,
+                                   entry_position,
+                                   direction,
+                                   cache.ray_tracer.getEndCell() );
+
+    if( dxtran_particle->isLost() )
+      continue;
+
+    dxtran_particle->setEnergy( outgoing_energy );
+    dxtran_particle->setTime( particle.getTime() +
+                              distance_to_entry/dxtran_particle->getSpeed() );
+    dxtran_particle->setWeight( weight );
+    dxtran_particle->setRaySafetyDistance( 0.0 );
+    dxtran_particle->incrementCollisionNumber();
+    dxtran_particle->setRepresentedByDXTRANParticles( false );
+
+    bank.push( dxtran_particle );
+  }
+}
+
+// Trace the ray to a sphere (false if the ray cannot reach it)
+bool DXTRANSpheres::traceRayToSphere( ThreadCache& cache,
+                                      const ParticleState& particle,
+                                      const double direction[3],
+                                      const double distance ) const
+{
+  try{
+    return cache.ray_tracer.traceRay( *d_model,
+                                      particle.getPosition(),
+                                      direction,
+                                      particle.getCell(),
+                                      distance );
+  }
+  catch( const std::runtime_error& exception )
+  {
+    FRENSIE_LOG_TAGGED_WARNING( "DXTRAN",
+                                "The ray from a collision to a DXTRAN sphere "
+                                "could not be traced (" << exception.what()
+                                << "). The DXTRAN particle will not be "
+                                "created!" );
+
+    return false;
+  }
+}
+
+// Enable support for multiple threads
+void DXTRANSpheres::enableThreadSupport( const unsigned num_threads )
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  d_thread_caches.resize( num_threads );
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_DXTRANSpheres.cpp
+//---------------------------------------------------------------------------//
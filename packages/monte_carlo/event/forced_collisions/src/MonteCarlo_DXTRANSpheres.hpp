@@ -0,0 +1,132 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_DXTRANSpheres.hpp
+//! \author Alex Robinson
+//! \brief  DXTRAN spheres class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_DXTRAN_SPHERES_HPP
+#define MONTE_CARLO_DXTRAN_SPHERES_HPP
+
+// Std Lib Includes
+#include <memory>
+#include <array>
+
+// FRENSIE Includes
+#include "MonteCarlo_FilledGeometryModel.hpp"
+#include "MonteCarlo_ParticleState.hpp"
+#include "MonteCarlo_ParticleBank.hpp"
+#include "MonteCarlo_ModelRayTracer.hpp"
+#include "Utility_PerThread.hpp"
+#include "Utility_Vector.hpp"
+#include "Utility_Map.hpp"
+
+namespace MonteCarlo{
+
+/*! The DXTRAN spheres class
+ * \details At every collision of a particle type that has DXTRAN spheres,
+ * a DXTRAN particle is created on each sphere that does not contain the
+ * collision site. The direction of the DXTRAN particle is sampled uniformly
+ * from the cone subtended by the sphere and the outgoing energy is sampled
+ * from the scattering reactions that can emit the particle in that direction
+ * (using the macroscopic differential scattering cross sections of the
+ * material). The weight of the DXTRAN particle is the expected weight that
+ * reaches the sphere in the sampled direction without colliding (the
+ * attenuation is calculated by tracing the ray to the sphere). To keep the
+ * simulation unbiased, a particle whose flight is represented by DXTRAN
+ * particles must be killed when it enters a DXTRAN sphere. DXTRAN spheres
+ * can only be used with photons and neutrons.
+ */
+class DXTRANSpheres
+{
+
+public:
+
+  //! The cell id type
+  typedef Geometry::Model::EntityId CellIdType;
+
+  //! The sphere center type
+  typedef std::array<double,3> SphereCenter;
+
+  //! Constructor
+  DXTRANSpheres( const std::shared_ptr<const FilledGeometryModel>& model );
+
+  //! Destructor
+  ~DXTRANSpheres()
+  { /* ... */ }
+
+  //! Add a DXTRAN sphere for the specified particle type
+  void addSphere( const ParticleType particle_type,
+                  const SphereCenter& center,
+                  const double radius );
+
+  //! Check if DXTRAN spheres have been specified for the particle type
+  bool hasSpheres( const ParticleType particle_type ) const;
+
+  //! Return the number of DXTRAN spheres of the particle type
+  size_t getNumberOfSpheres( const ParticleType particle_type ) const;
+
+  //! Return the center of a DXTRAN sphere of the particle type
+  const SphereCenter& getSphereCenter( const ParticleType particle_type,
+                                       const size_t sphere_index ) const;
+
+  //! Return the radius of a DXTRAN sphere of the particle type
+  double getSphereRadius( const ParticleType particle_type,
+                          const size_t sphere_index ) const;
+
+  //! Return the distance to the nearest DXTRAN sphere that will be entered
+  double getDistanceToSphereEntry( const ParticleState& particle ) const;
+
+  //! Create the DXTRAN particles of a collision
+  void createDXTRANParticles( const ParticleState& particle,
+                              const double inverse_total_cross_section,
+                              ParticleBank& bank ) const;
+
+  //! Enable support for multiple threads
+  void enableThreadSupport( const unsigned num_threads );
+
+private:
+
+  // The DXTRAN sphere type
+  typedef std::pair<SphereCenter,double> Sphere;
+
+  // The thread cache type
+  struct ThreadCache
+  {
+    // The ray tracer used to trace rays to the spheres
+    ModelRayTracer ray_tracer;
+
+    // The outgoing energies and macroscopic differential cross sections
+    std::vector<std::pair<double,double> > differential_cross_sections;
+  };
+
+  // Create the DXTRAN particles of a collision
+  template<typename StateType>
+  void createDXTRANParticlesImpl( const ParticleState& particle,
+                                  const double inverse_total_cross_section,
+                                  ParticleBank& bank ) const;
+
+  // Trace the ray to a sphere (false if the ray cannot reach it)
+  bool traceRayToSphere( ThreadCache& cache,
+                         const ParticleState& particle,
+                         const double direction[3],
+                         const double distance ) const;
+
+  // The filled geometry model
+  std::shared_ptr<const FilledGeometryModel> d_model;
+
+  // The DXTRAN spheres of each particle type
+  std::map<ParticleType,std::vector<Sphere> > d_spheres;
+
+  // The thread caches
+  mutable Utility::PerThread<ThreadCache> d_thread_caches;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_DXTRAN_SPHERES_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_DXTRANSpheres.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,390 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstDXTRANSpheres.cpp
+//! \author Alex Robinson
+//! \brief  DXTRAN spheres unit tests.
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+#include <limits>
+#include <cmath>
+
+// FRENSIE Includes
+#include "MonteCarlo_DXTRANSpheres.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+#include "MonteCarlo_NeutronState.hpp"
+#include "MonteCarlo_ElectronState.hpp"
+#include "Geometry_InfiniteMediumModel.hpp"
+#include "Data_ScatteringCenterPropertiesDatabase.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+using boost::units::si::kelvin;
+using boost::units::cgs::cubic_centimeter;
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+std::shared_ptr<const MonteCarlo::FilledGeometryModel> filled_model;
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Calculate the expected weight of a DXTRAN particle
+template<typename StateType>
+double calculateExpectedWeight( const double energy,
+                                const double scattering_angle_cosine,
+                                const double min_angle_cosine,
+                                const double outgoing_energy,
+                                const double distance,
+                                const double inverse_total_cross_section,
+                                const double weight )
+{
+  typedef typename MonteCarlo::Details::FilledGeometryModelUpcastHelper<StateType>::UpcastType
+    FilledParticleGeometryModel;
+
+  const auto& material =
+    static_cast<const FilledParticleGeometryModel&>( *filled_model ).getMaterial( 1 );
+
+  std::vector<std::pair<double,double> > cross_sections;
+
+  material->getMacroscopicDifferentialScatteringCrossSections(
+                                                       energy,
+                                                       scattering_angle_cosine,
+                                                       cross_sections );
+
+  double differential_cross_section = 0.0;
+
+  for( auto&& cross_section : cross_sections )
+    differential_cross_section += cross_section.second;
+
+  return weight*differential_cross_section*(1.0 - min_angle_cosine)*
+    inverse_total_cross_section*std::exp( -distance*
+         filled_model->getMacroscopicTotalCrossSection<StateType>( 1, outgoing_energy ) );
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that spheres can be added
+FRENSIE_UNIT_TEST( DXTRANSpheres, addSphere )
+{
+  MonteCarlo::DXTRANSpheres dxtran_spheres( filled_model );
+
+  FRENSIE_CHECK( !dxtran_spheres.hasSpheres( MonteCarlo::PHOTON ) );
+  FRENSIE_CHECK_EQUAL( dxtran_spheres.getNumberOfSpheres( MonteCarlo::PHOTON ), 0 );
+
+  dxtran_spheres.addSphere( MonteCarlo::PHOTON, {1.0, 2.0, 3.0}, 0.5 );
+  dxtran_spheres.addSphere( MonteCarlo::PHOTON, {-1.0, 0.0, 0.0}, 2.0 );
+
+  FRENSIE_CHECK( dxtran_spheres.hasSpheres( MonteCarlo::PHOTON ) );
+  FRENSIE_CHECK( !dxtran_spheres.hasSpheres( MonteCarlo::NEUTRON ) );
+  FRENSIE_REQUIRE_EQUAL( dxtran_spheres.getNumberOfSpheres( MonteCarlo::PHOTON ), 2 );
+  FRENSIE_CHECK_EQUAL( dxtran_spheres.getSphereCenter( MonteCarlo::PHOTON, 0 )[0], 1.0 );
+  FRENSIE_CHECK_EQUAL( dxtran_spheres.getSphereCenter( MonteCarlo::PHOTON, 0 )[1], 2.0 );
+  FRENSIE_CHECK_EQUAL( dxtran_spheres.getSphereCenter( MonteCarlo::PHOTON, 0 )[2], 3.0 );
+  FRENSIE_CHECK_EQUAL( dxtran_spheres.getSphereRadius( MonteCarlo::PHOTON, 0 ), 0.5 );
+  FRENSIE_CHECK_EQUAL( dxtran_spheres.getSphereCenter( MonteCarlo::PHOTON, 1 )[0], -1.0 );
+  FRENSIE_CHECK_EQUAL( dxtran_spheres.getSphereCenter( MonteCarlo::PHOTON, 1 )[1], 0.0 );
+  FRENSIE_CHECK_EQUAL( dxtran_spheres.getSphereCenter( MonteCarlo::PHOTON, 1 )[2], 0.0 );
+  FRENSIE_CHECK_EQUAL( dxtran_spheres.getSphereRadius( MonteCarlo::PHOTON, 1 ), 2.0 );
+
+  dxtran_spheres.addSphere( MonteCarlo::NEUTRON, {0.0, 0.0, 0.0}, 1.0 );
+
+  FRENSIE_CHECK( dxtran_spheres.hasSpheres( MonteCarlo::NEUTRON ) );
+  FRENSIE_CHECK_EQUAL( dxtran_spheres.getNumberOfSpheres( MonteCarlo::NEUTRON ), 1 );
+
+  // Only photons and neutrons can have DXTRAN spheres
+  FRENSIE_CHECK_THROW( dxtran_spheres.addSphere( MonteCarlo::ELECTRON, {0.0, 0.0, 0.0}, 1.0 ),
+                       std::runtime_error );
+  FRENSIE_CHECK( !dxtran_spheres.hasSpheres( MonteCarlo::ELECTRON ) );
+
+  // The radius must be valid
+  FRENSIE_CHECK_THROW( dxtran_spheres.addSphere( MonteCarlo::PHOTON, {0.0, 0.0, 0.0}, 0.0 ),
+                       std::runtime_error );
+  FRENSIE_CHECK_EQUAL( dxtran_spheres.getNumberOfSpheres( MonteCarlo::PHOTON ), 2 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the distance to the nearest sphere entry can be returned
+FRENSIE_UNIT_TEST( DXTRANSpheres, getDistanceToSphereEntry )
+{
+  MonteCarlo::DXTRANSpheres dxtran_spheres( filled_model );
+
+  MonteCarlo::PhotonState photon( 0 );
+  photon.setPosition( 0.0, 0.0, 0.0 );
+  photon.setDirection( 0.0, 0.0, 1.0 );
+  photon.embedInModel( *filled_model );
+
+  FRENSIE_CHECK_EQUAL( dxtran_spheres.getDistanceToSphereEntry( photon ),
+                       std::numeric_limits<double>::infinity() );
+
+  dxtran_spheres.addSphere( MonteCarlo::PHOTON, {0.0, 0.0, 10.0}, 1.0 );
+  dxtran_spheres.addSphere( MonteCarlo::PHOTON, {0.0, 0.0, 5.0}, 2.0 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( dxtran_spheres.getDistanceToSphereEntry( photon ),
+                                   3.0,
+                                   1e-15 );
+
+  // The particle is moving away from the spheres
+  photon.setDirection( 0.0, 0.0, -1.0 );
+
+  FRENSIE_CHECK_EQUAL( dxtran_spheres.getDistanceToSphereEntry( photon ),
+                       std::numeric_limits<double>::infinity() );
+
+  // The particle will miss the spheres
+  photon.setDirection( 1.0, 0.0, 0.0 );
+
+  FRENSIE_CHECK_EQUAL( dxtran_spheres.getDistanceToSphereEntry( photon ),
+                       std::numeric_limits<double>::infinity() );
+
+  // The particle is inside of the closest sphere
+  photon.setPosition( 0.0, 0.0, 4.0 );
+  photon.setDirection( 0.0, 0.0, 1.0 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( dxtran_spheres.getDistanceToSphereEntry( photon ),
+                                   5.0,
+                                   1e-15 );
+
+  // The particle is on the surface of the farthest sphere
+  photon.setPosition( 0.0, 0.0, 9.0 );
+
+  FRENSIE_CHECK_EQUAL( dxtran_spheres.getDistanceToSphereEntry( photon ),
+                       std::numeric_limits<double>::infinity() );
+
+  // Only the spheres of the particle type are considered
+  MonteCarlo::NeutronState neutron( 0 );
+  neutron.setPosition( 0.0, 0.0, 0.0 );
+  neutron.setDirection( 0.0, 0.0, 1.0 );
+  neutron.embedInModel( *filled_model );
+
+  FRENSIE_CHECK_EQUAL( dxtran_spheres.getDistanceToSphereEntry( neutron ),
+                       std::numeric_limits<double>::infinity() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a photon collision creates a DXTRAN particle
+FRENSIE_UNIT_TEST( DXTRANSpheres, createDXTRANParticles_photon )
+{
+  MonteCarlo::DXTRANSpheres dxtran_spheres( filled_model );
+
+  dxtran_spheres.addSphere( MonteCarlo::PHOTON, {0.0, 0.0, 10.0}, 1.0 );
+
+  MonteCarlo::PhotonState photon( 0 );
+  photon.setEnergy( 1.0 );
+  photon.setPosition( 0.0, 0.0, 0.0 );
+  photon.setDirection( 0.0, 0.0, 1.0 );
+  photon.setWeight( 2.0 );
+  photon.setTime( 1.0 );
+  photon.embedInModel( *filled_model );
+
+  std::vector<double> fake_stream( 3 );
+  fake_stream[0] = 0.5;
+  fake_stream[1] = 0.0;
+  fake_stream[2] = 0.5;
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  MonteCarlo::ParticleBank bank;
+
+  dxtran_spheres.createDXTRANParticles( photon, 0.5, bank );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+
+  FRENSIE_REQUIRE_EQUAL( bank.size(), 1 );
+
+  const MonteCarlo::ParticleState& dxtran_particle = bank.top();
+
+  const double min_angle_cosine = std::sqrt( 1.0 - 0.01 );
+  const double angle_cosine = min_angle_cosine + 0.5*(1.0 - min_angle_cosine);
+  const double distance = 10.0*angle_cosine -
+    std::sqrt( 1.0 - 100.0*(1.0 - angle_cosine*angle_cosine) );
+
+  FRENSIE_CHECK_EQUAL( dxtran_particle.getParticleType(), MonteCarlo::PHOTON );
+  FRENSIE_CHECK_FLOATING_EQUALITY( dxtran_particle.getZDirection(),
+                                   angle_cosine,
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( dxtran_particle.getZPosition(),
+                                   distance*angle_cosine,
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+           std::sqrt( dxtran_particle.getXPosition()*dxtran_particle.getXPosition() +
+                      dxtran_particle.getYPosition()*dxtran_particle.getYPosition() +
+                      (dxtran_particle.getZPosition() - 10.0)*
+                      (dxtran_particle.getZPosition() - 10.0) ),
+           1.0,
+           1e-12 );
+  FRENSIE_CHECK_EQUAL( dxtran_particle.getCell(), 1 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( dxtran_particle.getTime(),
+                                   1.0 + distance/dxtran_particle.getSpeed(),
+                                   1e-12 );
+  FRENSIE_CHECK_EQUAL( dxtran_particle.getCollisionNumber(),
+                       photon.getCollisionNumber()+1 );
+  FRENSIE_CHECK( !dxtran_particle.isRepresentedByDXTRANParticles() );
+  FRENSIE_CHECK( dxtran_particle.getEnergy() <= 1.0 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( dxtran_particle.getWeight(),
+                                   calculateExpectedWeight<MonteCarlo::PhotonState>(
+                                                  1.0,
+                                                  angle_cosine,
+                                                  min_angle_cosine,
+                                                  dxtran_particle.getEnergy(),
+                                                  distance,
+                                                  0.5,
+                                                  2.0 ),
+                                   1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a neutron collision creates a DXTRAN particle
+FRENSIE_UNIT_TEST( DXTRANSpheres, createDXTRANParticles_neutron )
+{
+  MonteCarlo::DXTRANSpheres dxtran_spheres( filled_model );
+
+  dxtran_spheres.addSphere( MonteCarlo::NEUTRON, {0.0, 0.0, 10.0}, 1.0 );
+  dxtran_spheres.addSphere( MonteCarlo::NEUTRON, {0.0, 0.0, -10.0}, 1.0 );
+
+  MonteCarlo::NeutronState neutron( 0 );
+  neutron.setEnergy( 1.0 );
+  neutron.setPosition( 0.0, 0.0, 0.0 );
+  neutron.setDirection( 0.0, 0.0, 1.0 );
+  neutron.setWeight( 1.0 );
+  neutron.embedInModel( *filled_model );
+
+  MonteCarlo::ParticleBank bank;
+
+  dxtran_spheres.createDXTRANParticles( neutron, 0.25, bank );
+
+  // H-1 cannot scatter a neutron backward (in the lab frame)
+  FRENSIE_REQUIRE_EQUAL( bank.size(), 1 );
+
+  const MonteCarlo::ParticleState& dxtran_particle = bank.top();
+
+  FRENSIE_CHECK_EQUAL( dxtran_particle.getParticleType(), MonteCarlo::NEUTRON );
+  FRENSIE_CHECK( dxtran_particle.getZPosition() > 8.9 );
+  FRENSIE_CHECK( dxtran_particle.getZDirection() > 0.99 );
+  FRENSIE_CHECK( dxtran_particle.getEnergy() < 1.0 );
+  FRENSIE_CHECK( dxtran_particle.getWeight() > 0.0 );
+  FRENSIE_CHECK( !dxtran_particle.isRepresentedByDXTRANParticles() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a collision inside of a sphere does not create a DXTRAN particle
+FRENSIE_UNIT_TEST( DXTRANSpheres, createDXTRANParticles_inside_sphere )
+{
+  MonteCarlo::DXTRANSpheres dxtran_spheres( filled_model );
+
+  dxtran_spheres.addSphere( MonteCarlo::PHOTON, {0.0, 0.0, 0.5}, 1.0 );
+
+  MonteCarlo::PhotonState photon( 0 );
+  photon.setEnergy( 1.0 );
+  photon.setPosition( 0.0, 0.0, 0.0 );
+  photon.setDirection( 0.0, 0.0, 1.0 );
+  photon.embedInModel( *filled_model );
+
+  MonteCarlo::ParticleBank bank;
+
+  dxtran_spheres.createDXTRANParticles( photon, 0.5, bank );
+
+  FRENSIE_CHECK( bank.isEmpty() );
+
+  // Particle types without spheres do not create DXTRAN particles
+  MonteCarlo::ElectronState electron( 0 );
+  electron.setEnergy( 1.0 );
+  electron.setPosition( 0.0, 0.0, -5.0 );
+  electron.setDirection( 0.0, 0.0, 1.0 );
+  electron.embedInModel( *filled_model );
+
+  dxtran_spheres.createDXTRANParticles( electron, 0.5, bank );
+
+  FRENSIE_CHECK( bank.isEmpty() );
+}
+
+//---------------------------------------------------------------------------//
+// Custom Setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+std::string test_scattering_center_database_name;
+
+FRENSIE_CUSTOM_UNIT_TEST_COMMAND_LINE_OPTIONS()
+{
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "test_database",
+                                        test_scattering_center_database_name, "",
+                                        "Test scattering center database name "
+                                        "with path" );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // Determine the database directory
+  boost::filesystem::path database_path =
+    test_scattering_center_database_name;
+
+  // Load the database
+  const Data::ScatteringCenterPropertiesDatabase database( database_path );
+
+  const Data::AtomProperties& h_properties =
+    database.getAtomProperties( 1001 );
+
+  const Data::NuclideProperties& h1_properties =
+    database.getNuclideProperties( 1001 );
+
+  // Set the sattering center definitions
+  std::shared_ptr<MonteCarlo::ScatteringCenterDefinitionDatabase>
+    scattering_center_definition_database(
+                          new MonteCarlo::ScatteringCenterDefinitionDatabase );
+
+  MonteCarlo::ScatteringCenterDefinition& h_definition =
+    scattering_center_definition_database->createDefinition( "H1 @ 293.6K", 1001 );
+
+  h_definition.setPhotoatomicDataProperties(
+          h_properties.getSharedPhotoatomicDataProperties(
+                Data::PhotoatomicDataProperties::Native_EPR_FILE, 0 ) );
+
+  h_definition.setElectroatomicDataProperties(
+          h_properties.getSharedElectroatomicDataProperties(
+              Data::ElectroatomicDataProperties::Native_EPR_FILE, 0 ) );
+
+  h_definition.setNuclearDataProperties(
+          h1_properties.getSharedNuclearDataProperties(
+             Data::NuclearDataProperties::ACE_FILE, 7, 293.6*kelvin, false ) );
+
+  // Set the material definitions
+  std::shared_ptr<MonteCarlo::MaterialDefinitionDatabase>
+    material_definition_database( new MonteCarlo::MaterialDefinitionDatabase );
+
+  material_definition_database->addDefinition( "H1 @ 293.6K", 2,
+                                               {"H1 @ 293.6K"}, {1.0} );
+
+  // Create the unfilled model
+  std::shared_ptr<const Geometry::Model> unfilled_model(
+             new Geometry::InfiniteMediumModel( 1, 2, 1e24/cubic_centimeter ) );
+  std::shared_ptr<MonteCarlo::SimulationProperties>
+    properties( new MonteCarlo::SimulationProperties );
+  properties->setParticleMode( MonteCarlo::NEUTRON_PHOTON_ELECTRON_MODE );
+
+  filled_model.reset( new MonteCarlo::FilledGeometryModel(
+                                         database_path,
+                                         scattering_center_definition_database,
+                                         material_definition_database,
+                                         properties,
+                                         unfilled_model,
+                                         true ) );
+
+  // Initialize the random number generator
+  Utility::RandomNumberGenerator::createStreams();
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstDXTRANSpheres.cpp
+//---------------------------------------------------------------------------//
@@ -28,6 +28,7 @@
 #include "Utility_Map.hpp"
 #include "Utility_Set.hpp"
 #include "Utility_Tuple.hpp"
+#include "Utility_PerThread.hpp"
 
 namespace MonteCarlo{
 
@@ -154,7 +155,7 @@ private:
 
   // The partial tracked history info
   typedef std::map<const ParticleState*,ParticleDataArray> PartialHistorySubmap;
-  std::vector<PartialHistorySubmap> d_partial_history_map;
+  Utility::PerThread<PartialHistorySubmap> d_partial_history_map;
 
   // The tracked history info
   OverallHistoryMap d_history_number_map;
@@ -0,0 +1,415 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_CADISGenerator.cpp
+//! \author Alex Robinson
+//! \brief  CADIS variance reduction parameter generator class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+#include <limits>
+
+// FRENSIE Includes
+#include "MonteCarlo_CADISGenerator.hpp"
+#include "MonteCarlo_CADISParticleDistribution.hpp"
+#include "Utility_StructuredHexMesh.hpp"
+#include "Utility_SortAlgorithms.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+/*! \details The mesh must be the mesh of the adjoint mesh flux estimator and
+ * the only dimension discretized by the estimator must be the energy
+ * dimension (with the energy bin boundaries). Mesh elements that are not in
+ * the forward source strengths map are assumed to have no source. The
+ * forward source strengths are normalized so that they sum to one.
+ */
+CADISGenerator::CADISGenerator(
+             const std::shared_ptr<const Estimator>& adjoint_mesh_flux_estimator,
+             const std::shared_ptr<const Utility::Mesh>& mesh,
+             const std::vector<double>& energy_bin_boundaries,
+             const MeshElementBinValueMap& forward_source_strengths )
+  : d_mesh( mesh ),
+    d_energy_bin_boundaries( energy_bin_boundaries ),
+    d_forward_source_strengths( forward_source_strengths ),
+    d_adjoint_fluxes(),
+    d_estimated_response( 0.0 )
+{
+  // Make sure that the pointers are valid
+  testPrecondition( adjoint_mesh_flux_estimator.get() );
+  testPrecondition( mesh.get() );
+  // Make sure that the energy bin boundaries are valid
+  testPrecondition( energy_bin_boundaries.size() >= 2 );
+  testPrecondition( Utility::Sort::isSortedAscending( energy_bin_boundaries.begin(),
+                                                      energy_bin_boundaries.end() ) );
+
+  const size_t number_of_bins = energy_bin_boundaries.size() - 1;
+
+  TEST_FOR_EXCEPTION( adjoint_mesh_flux_estimator->getNumberOfBins() !=
+                      number_of_bins,
+                      std::runtime_error,
+                      "The discretization of estimator "
+                      << adjoint_mesh_flux_estimator->getId() << " does not "
+                      "match the energy bins ("
+                      << adjoint_mesh_flux_estimator->getNumberOfBins() <<
+                      " != " << number_of_bins << ")!" );
+
+  for( MeshElementBinValueMap::const_iterator source_it =
+         forward_source_strengths.begin();
+       source_it != forward_source_strengths.end();
+       ++source_it )
+  {
+    TEST_FOR_EXCEPTION( source_it->second.size() != number_of_bins,
+                        std::runtime_error,
+                        "The forward source strengths of mesh element "
+                        << source_it->first << " do not match the energy "
+                        "bins (" << source_it->second.size() << " != "
+                        << number_of_bins << ")!" );
+  }
+
+  // Normalize the forward source strengths so that the birth weights of the
+  // biased source are consistent with the weight windows
+  double total_source_strength = 0.0;
+
+  for( MeshElementBinValueMap::const_iterator source_it =
+         d_forward_source_strengths.begin();
+       source_it != d_forward_source_strengths.end();
+       ++source_it )
+  {
+    for( size_t i = 0; i < source_it->second.size(); ++i )
+      total_source_strength += source_it->second[i];
+  }
+
+  TEST_FOR_EXCEPTION( total_source_strength <= 0.0,
+                      std::runtime_error,
+                      "The forward source strengths do not have any "
+                      "positive values!" );
+
+  for( MeshElementBinValueMap::iterator source_it =
+         d_forward_source_strengths.begin();
+       source_it != d_forward_source_strengths.end();
+       ++source_it )
+  {
+    for( size_t i = 0; i < source_it->second.size(); ++i )
+      source_it->second[i] /= total_source_strength;
+  }
+
+  this->calculateUnnormalizedFluxes( *adjoint_mesh_flux_estimator,
+                                     *mesh,
+                                     d_adjoint_fluxes );
+
+  // Find the min estimated adjoint flux
+  double min_adjoint_flux = std::numeric_limits<double>::max();
+
+  for( MeshElementBinValueMap::const_iterator flux_it =
+         d_adjoint_fluxes.begin();
+       flux_it != d_adjoint_fluxes.end();
+       ++flux_it )
+  {
+    for( size_t i = 0; i < flux_it->second.size(); ++i )
+    {
+      if( flux_it->second[i] > 0.0 && flux_it->second[i] < min_adjoint_flux )
+        min_adjoint_flux = flux_it->second[i];
+    }
+  }
+
+  TEST_FOR_EXCEPTION( min_adjoint_flux == std::numeric_limits<double>::max(),
+                      std::runtime_error,
+                      "Estimator " << adjoint_mesh_flux_estimator->getId() <<
+                      " has not estimated any adjoint flux!" );
+
+  // Give every element and bin an adjoint flux and calculate the response
+  for( MeshElementBinValueMap::iterator flux_it = d_adjoint_fluxes.begin();
+       flux_it != d_adjoint_fluxes.end();
+       ++flux_it )
+  {
+    MeshElementBinValueMap::const_iterator source_it =
+      d_forward_source_strengths.find( flux_it->first );
+
+    for( size_t i = 0; i < flux_it->second.size(); ++i )
+    {
+      if( flux_it->second[i] <= 0.0 )
+        flux_it->second[i] = min_adjoint_flux;
+
+      if( source_it != d_forward_source_strengths.end() )
+        d_estimated_response += source_it->second[i]*flux_it->second[i];
+    }
+  }
+
+  TEST_FOR_EXCEPTION( d_estimated_response <= 0.0,
+                      std::runtime_error,
+                      "The forward source strengths do not have any "
+                      "positive values in the mesh!" );
+}
+
+// Return the mesh
+std::shared_ptr<const Utility::Mesh> CADISGenerator::getMesh() const
+{
+  return d_mesh;
+}
+
+// Return the energy bin boundaries
+const std::vector<double>& CADISGenerator::getEnergyBinBoundaries() const
+{
+  return d_energy_bin_boundaries;
+}
+
+// Return the adjoint flux (unnormalized) of each mesh element and bin
+auto CADISGenerator::getAdjointFluxes() const -> const MeshElementBinValueMap&
+{
+  return d_adjoint_fluxes;
+}
+
+// Return the estimated response (unnormalized)
+double CADISGenerator::getEstimatedResponse() const
+{
+  return d_estimated_response;
+}
+
+// Return the biased source strengths of each mesh element and bin
+/*! \details The biased source strengths sum to one.
+ */
+void CADISGenerator::getBiasedSourceStrengths(
+                     MeshElementBinValueMap& biased_source_strengths ) const
+{
+  biased_source_strengths.clear();
+
+  for( MeshElementBinValueMap::const_iterator flux_it =
+         d_adjoint_fluxes.begin();
+       flux_it != d_adjoint_fluxes.end();
+       ++flux_it )
+  {
+    std::vector<double>& element_biased_source_strengths =
+      biased_source_strengths[flux_it->first];
+
+    element_biased_source_strengths.resize( flux_it->second.size(), 0.0 );
+
+    MeshElementBinValueMap::const_iterator source_it =
+      d_forward_source_strengths.find( flux_it->first );
+
+    if( source_it != d_forward_source_strengths.end() )
+    {
+      for( size_t i = 0; i < flux_it->second.size(); ++i )
+      {
+        element_biased_source_strengths[i] =
+          source_it->second[i]*flux_it->second[i]/d_estimated_response;
+      }
+    }
+  }
+}
+
+// Create the weight window mesh
+/*! \details The weight window center (survival weight) of each mesh element
+ * and energy bin is the estimated response divided by the adjoint flux. The
+ * lower and upper weights are set so that the ratio of the upper weight to
+ * the lower weight is the requested ratio.
+ */
+std::shared_ptr<WeightWindowMesh> CADISGenerator::createWeightWindowMesh(
+                               const double upper_to_lower_weight_ratio ) const
+{
+  TEST_FOR_EXCEPTION( upper_to_lower_weight_ratio <= 1.0,
+                      std::runtime_error,
+                      "The upper weight to lower weight ratio must be "
+                      "greater than 1!" );
+
+  std::shared_ptr<WeightWindowMesh> weight_window_mesh( new WeightWindowMesh );
+
+  weight_window_mesh->setMesh( d_mesh );
+  weight_window_mesh->setDiscretization<OBSERVER_ENERGY_DIMENSION>(
+                                                     d_energy_bin_boundaries );
+
+  std::unordered_map<Utility::Mesh::ElementHandle,std::vector<WeightWindow> >
+    weight_window_map;
+
+  for( MeshElementBinValueMap::const_iterator flux_it =
+         d_adjoint_fluxes.begin();
+       flux_it != d_adjoint_fluxes.end();
+       ++flux_it )
+  {
+    std::vector<WeightWindow>& element_weight_windows =
+      weight_window_map[flux_it->first];
+
+    element_weight_windows.resize( flux_it->second.size() );
+
+    for( size_t i = 0; i < flux_it->second.size(); ++i )
+    {
+      const double center = d_estimated_response/flux_it->second[i];
+
+      element_weight_windows[i].survival_weight = center;
+      element_weight_windows[i].lower_weight =
+        2.0*center/(1.0 + upper_to_lower_weight_ratio);
+      element_weight_windows[i].upper_weight =
+        upper_to_lower_weight_ratio*element_weight_windows[i].lower_weight;
+    }
+  }
+
+  weight_window_mesh->setWeightWindowMap( weight_window_map );
+
+  return weight_window_mesh;
+}
+
+// Create the importance mesh
+std::shared_ptr<ImportanceMesh> CADISGenerator::createImportanceMesh() const
+{
+  std::shared_ptr<ImportanceMesh> importance_mesh( new ImportanceMesh );
+
+  importance_mesh->setMesh( d_mesh );
+  importance_mesh->setDiscretization<OBSERVER_ENERGY_DIMENSION>(
+                                                     d_energy_bin_boundaries );
+
+  std::unordered_map<Utility::Mesh::ElementHandle,std::vector<double> >
+    importance_map;
+
+  for( MeshElementBinValueMap::const_iterator flux_it =
+         d_adjoint_fluxes.begin();
+       flux_it != d_adjoint_fluxes.end();
+       ++flux_it )
+  {
+    std::vector<double>& element_importances = importance_map[flux_it->first];
+
+    element_importances.resize( flux_it->second.size() );
+
+    for( size_t i = 0; i < flux_it->second.size(); ++i )
+      element_importances[i] = flux_it->second[i]/d_estimated_response;
+  }
+
+  importance_mesh->setImportanceMap( importance_map );
+
+  return importance_mesh;
+}
+
+// Create the CADIS (joint space-energy biased) particle distribution
+/*! \details The (mesh element, energy bin) pairs are sampled from the biased
+ * source strengths and the birth weight of each pair is the weight window
+ * center (the estimated response divided by the adjoint flux), which is the
+ * normalized forward source strength divided by the biased source strength.
+ * The mesh must
+ * be a structured hex mesh. The position and energy are sampled uniformly
+ * inside of each mesh element and energy bin unless a shape distribution
+ * is set on the returned distribution.
+ */
+std::shared_ptr<ParticleDistribution>
+CADISGenerator::createBiasedParticleDistribution(
+        const std::string& name,
+        const std::shared_ptr<const ParticleDistribution>& unbiased_distribution ) const
+{
+  // Make sure that the unbiased distribution is valid
+  testPrecondition( unbiased_distribution.get() );
+
+  std::shared_ptr<const Utility::StructuredHexMesh> hex_mesh =
+    std::dynamic_pointer_cast<const Utility::StructuredHexMesh>( d_mesh );
+
+  TEST_FOR_EXCEPTION( !hex_mesh,
+                      std::runtime_error,
+                      "A CADIS particle distribution can only be created "
+                      "for a structured hex mesh!" );
+
+  MeshElementBinValueMap biased_source_strengths;
+
+  this->getBiasedSourceStrengths( biased_source_strengths );
+
+  MeshElementBinValueMap birth_weights;
+
+  for( MeshElementBinValueMap::const_iterator flux_it =
+         d_adjoint_fluxes.begin();
+       flux_it != d_adjoint_fluxes.end();
+       ++flux_it )
+  {
+    std::vector<double>& element_birth_weights = birth_weights[flux_it->first];
+
+    element_birth_weights.resize( flux_it->second.size() );
+
+    for( size_t i = 0; i < flux_it->second.size(); ++i )
+      element_birth_weights[i] = d_estimated_response/flux_it->second[i];
+  }
+
+  return std::shared_ptr<ParticleDistribution>(
+                  new CADISParticleDistribution( name,
+                                                 unbiased_distribution,
+                                                 hex_mesh,
+                                                 d_energy_bin_boundaries,
+                                                 biased_source_strengths,
+                                                 birth_weights ) );
+}
+
+// Calculate the FW-CADIS adjoint source strengths
+/*! \details The adjoint source strength of each mesh element and energy bin
+ * is the element volume divided by the (unnormalized) forward flux, which
+ * results in a uniform relative error of the forward mesh flux estimates.
+ * Mesh elements and energy bins without a forward flux estimate are given
+ * an adjoint source strength of zero.
+ */
+void CADISGenerator::calculateFWCADISAdjointSourceStrengths(
+                         const Estimator& forward_mesh_flux_estimator,
+                         const Utility::Mesh& mesh,
+                         MeshElementBinValueMap& adjoint_source_strengths )
+{
+  CADISGenerator::calculateUnnormalizedFluxes( forward_mesh_flux_estimator,
+                                               mesh,
+                                               adjoint_source_strengths );
+
+  for( MeshElementBinValueMap::iterator source_it =
+         adjoint_source_strengths.begin();
+       source_it != adjoint_source_strengths.end();
+       ++source_it )
+  {
+    const double volume = mesh.getElementVolume( source_it->first );
+
+    for( size_t i = 0; i < source_it->second.size(); ++i )
+    {
+      if( source_it->second[i] > 0.0 )
+        source_it->second[i] = volume/source_it->second[i];
+    }
+  }
+}
+
+// Calculate the unnormalized fluxes estimated by a mesh flux estimator
+void CADISGenerator::calculateUnnormalizedFluxes(
+                                         const Estimator& mesh_flux_estimator,
+                                         const Utility::Mesh& mesh,
+                                         MeshElementBinValueMap& fluxes )
+{
+  TEST_FOR_EXCEPTION( !mesh_flux_estimator.isMeshEstimator(),
+                      std::runtime_error,
+                      "Estimator " << mesh_flux_estimator.getId() <<
+                      " is not a mesh estimator!" );
+
+  const size_t number_of_bins = mesh_flux_estimator.getNumberOfBins();
+
+  fluxes.clear();
+
+  for( Utility::Mesh::ElementHandleIterator element_it =
+         mesh.getStartElementHandleIterator();
+       element_it != mesh.getEndElementHandleIterator();
+       ++element_it )
+  {
+    TEST_FOR_EXCEPTION( !mesh_flux_estimator.isEntityAssigned( *element_it ),
+                        std::runtime_error,
+                        "Mesh element " << *element_it << " is not assigned "
+                        "to estimator " << mesh_flux_estimator.getId() <<
+                        "!" );
+
+    Utility::ArrayView<const double> first_moments =
+      mesh_flux_estimator.getEntityBinDataFirstMoments( *element_it );
+
+    const double volume =
+      mesh_flux_estimator.getEntityNormConstant( *element_it );
+
+    std::vector<double>& element_fluxes = fluxes[*element_it];
+
+    element_fluxes.resize( number_of_bins );
+
+    // Only the bins of the first response function are used
+    for( size_t i = 0; i < number_of_bins; ++i )
+      element_fluxes[i] = first_moments[i]/volume;
+  }
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_CADISGenerator.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,130 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_CADISGenerator.hpp
+//! \author Alex Robinson
+//! \brief  CADIS variance reduction parameter generator class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_CADIS_GENERATOR_HPP
+#define MONTE_CARLO_CADIS_GENERATOR_HPP
+
+// Std Lib Includes
+#include <memory>
+#include <unordered_map>
+
+// FRENSIE Includes
+#include "MonteCarlo_WeightWindowMesh.hpp"
+#include "MonteCarlo_ImportanceMesh.hpp"
+#include "MonteCarlo_Estimator.hpp"
+#include "MonteCarlo_ParticleDistribution.hpp"
+#include "Utility_Mesh.hpp"
+#include "Utility_Vector.hpp"
+
+namespace MonteCarlo{
+
+/*! The CADIS variance reduction parameter generator class
+ * \details Consistent adjoint driven importance sampling (CADIS) parameters
+ * are generated from the adjoint flux estimated by a mesh flux estimator in
+ * an adjoint simulation and the forward source strength in each mesh element
+ * and energy bin. The forward source strength of a mesh element and energy
+ * bin is the number of source particles emitted in the element and bin (per
+ * source particle), so the forward source strengths are normalized. The
+ * estimated response is
+ * \f$R=\sum_{e,g}q_{e,g}\phi^{\dagger}_{e,g}\f$ and the biased source
+ * strengths are \f$\hat{q}_{e,g}=q_{e,g}\phi^{\dagger}_{e,g}/R\f$. The
+ * weight window centers are \f$R/\phi^{\dagger}_{e,g}\f$ and the importances
+ * are \f$\phi^{\dagger}_{e,g}/R\f$, which makes the weight windows consistent
+ * with the biased source. Since these quantities only depend on ratios of
+ * the adjoint flux the unnormalized adjoint flux (first moments divided by
+ * the element volumes) is used. Mesh elements and energy bins without an
+ * adjoint flux estimate are given the min estimated adjoint flux so that
+ * every part of the phase space can still be reached. The biased source is a
+ * joint distribution of the mesh elements and energy bins, which is sampled
+ * directly with a MonteCarlo::CADISParticleDistribution (structured hex
+ * meshes only).
+ * For FW-CADIS the adjoint simulation must use the adjoint source
+ * strengths calculated from a forward mesh flux estimate.
+ */
+class CADISGenerator
+{
+
+public:
+
+  //! Typedef for the mesh element bin value map
+  typedef std::unordered_map<Utility::Mesh::ElementHandle,std::vector<double> > MeshElementBinValueMap;
+
+  //! Constructor
+  CADISGenerator(
+              const std::shared_ptr<const Estimator>& adjoint_mesh_flux_estimator,
+              const std::shared_ptr<const Utility::Mesh>& mesh,
+              const std::vector<double>& energy_bin_boundaries,
+              const MeshElementBinValueMap& forward_source_strengths );
+
+  //! Destructor
+  ~CADISGenerator()
+  { /* ... */ }
+
+  //! Return the mesh
+  std::shared_ptr<const Utility::Mesh> getMesh() const;
+
+  //! Return the energy bin boundaries
+  const std::vector<double>& getEnergyBinBoundaries() const;
+
+  //! Return the adjoint flux (unnormalized) of each mesh element and bin
+  const MeshElementBinValueMap& getAdjointFluxes() const;
+
+  //! Return the estimated response (unnormalized)
+  double getEstimatedResponse() const;
+
+  //! Return the biased source strengths of each mesh element and bin
+  void getBiasedSourceStrengths( MeshElementBinValueMap& biased_source_strengths ) const;
+
+  //! Create the weight window mesh
+  std::shared_ptr<WeightWindowMesh> createWeightWindowMesh(
+                     const double upper_to_lower_weight_ratio = 5.0 ) const;
+
+  //! Create the importance mesh
+  std::shared_ptr<ImportanceMesh> createImportanceMesh() const;
+
+  //! Create the CADIS (joint space-energy biased) particle distribution
+  std::shared_ptr<ParticleDistribution> createBiasedParticleDistribution(
+        const std::string& name,
+        const std::shared_ptr<const ParticleDistribution>& unbiased_distribution ) const;
+
+  //! Calculate the FW-CADIS adjoint source strengths
+  static void calculateFWCADISAdjointSourceStrengths(
+                        const Estimator& forward_mesh_flux_estimator,
+                        const Utility::Mesh& mesh,
+                        MeshElementBinValueMap& adjoint_source_strengths );
+
+private:
+
+  // Calculate the unnormalized fluxes estimated by a mesh flux estimator
+  static void calculateUnnormalizedFluxes( const Estimator& mesh_flux_estimator,
+                                           const Utility::Mesh& mesh,
+                                           MeshElementBinValueMap& fluxes );
+
+  // The mesh
+  std::shared_ptr<const Utility::Mesh> d_mesh;
+
+  // The energy bin boundaries
+  std::vector<double> d_energy_bin_boundaries;
+
+  // The forward source strengths
+  MeshElementBinValueMap d_forward_source_strengths;
+
+  // The adjoint fluxes (unnormalized)
+  MeshElementBinValueMap d_adjoint_fluxes;
+
+  // The estimated response (unnormalized)
+  double d_estimated_response;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_CADIS_GENERATOR_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_CADISGenerator.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,478 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_CADISParticleDistribution.cpp
+//! \author Alex Robinson
+//! \brief  CADIS (joint space-energy biased) particle distribution definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+
+// FRENSIE Includes
+#include "FRENSIE_Archives.hpp"
+#include "MonteCarlo_CADISParticleDistribution.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_SortAlgorithms.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Default constructor
+CADISParticleDistribution::CADISParticleDistribution()
+  : ParticleDistribution( "cadis particle distribution" )
+{ /* ... */ }
+
+// Constructor
+/*! \details The biased source strengths and the birth weights must have a
+ * value for every energy bin of each mesh element that they contain. The
+ * (mesh element, energy bin) pairs with a biased source strength of zero
+ * are never sampled. For an unbiased source the birth weight of each pair
+ * must be the unbiased probability of the pair divided by the (normalized)
+ * biased source strength.
+ */
+CADISParticleDistribution::CADISParticleDistribution(
+        const std::string& name,
+        const std::shared_ptr<const ParticleDistribution>& unbiased_distribution,
+        const std::shared_ptr<const Utility::StructuredHexMesh>& mesh,
+        const std::vector<double>& energy_bin_boundaries,
+        const MeshElementBinValueMap& biased_source_strengths,
+        const MeshElementBinValueMap& birth_weights )
+  : ParticleDistribution( name ),
+    d_unbiased_distribution( unbiased_distribution ),
+    d_mesh( mesh ),
+    d_energy_bin_boundaries( energy_bin_boundaries ),
+    d_shape_distributions( 4 ),
+    d_pair_elements(),
+    d_pair_energy_bins(),
+    d_pair_cdf(),
+    d_pair_birth_weights()
+{
+  // Make sure that the pointers are valid
+  testPrecondition( unbiased_distribution.get() );
+  testPrecondition( mesh.get() );
+  // Make sure that the energy bin boundaries are valid
+  testPrecondition( energy_bin_boundaries.size() >= 2 );
+  testPrecondition( Utility::Sort::isSortedAscending( energy_bin_boundaries.begin(),
+                                                      energy_bin_boundaries.end() ) );
+
+  const size_t number_of_bins = energy_bin_boundaries.size() - 1;
+
+  // Use the mesh element order so that the pair order is reproducible
+  double cdf_value = 0.0;
+
+  for( Utility::Mesh::ElementHandleIterator element_it =
+         mesh->getStartElementHandleIterator();
+       element_it != mesh->getEndElementHandleIterator();
+       ++element_it )
+  {
+    MeshElementBinValueMap::const_iterator strength_it =
+      biased_source_strengths.find( *element_it );
+
+    if( strength_it == biased_source_strengths.end() )
+      continue;
+
+    TEST_FOR_EXCEPTION( strength_it->second.size() != number_of_bins,
+                        std::runtime_error,
+                        "The biased source strengths of mesh element "
+                        << *element_it << " do not match the energy bins ("
+                        << strength_it->second.size() << " != "
+                        << number_of_bins << ")!" );
+
+    MeshElementBinValueMap::const_iterator weight_it =
+      birth_weights.find( *element_it );
+
+    TEST_FOR_EXCEPTION( weight_it == birth_weights.end() ||
+                        weight_it->second.size() != number_of_bins,
+                        std::runtime_error,
+                        "The birth weights of mesh element " << *element_it
+                        << " do not match the energy bins!" );
+
+    for( size_t i = 0; i < number_of_bins; ++i )
+    {
+      if( strength_it->second[i] > 0.0 )
+      {
+        TEST_FOR_EXCEPTION( weight_it->second[i] <= 0.0,
+                            std::runtime_error,
+                            "The birth weight of mesh element " << *element_it
+                            << " energy bin " << i << " must be positive!" );
+
+        cdf_value += strength_it->second[i];
+
+        d_pair_elements.push_back( *element_it );
+        d_pair_energy_bins.push_back( i );
+        d_pair_cdf.push_back( cdf_value );
+        d_pair_birth_weights.push_back( weight_it->second[i] );
+      }
+    }
+  }
+
+  TEST_FOR_EXCEPTION( d_pair_cdf.empty(),
+                      std::runtime_error,
+                      "The biased source strengths do not have any positive "
+                      "values in the mesh!" );
+
+  // Normalize the cdf
+  for( size_t i = 0; i < d_pair_cdf.size(); ++i )
+    d_pair_cdf[i] /= cdf_value;
+
+  d_pair_cdf.back() = 1.0;
+
+  this->cacheDerivedData();
+}
+
+// Set the shape distribution of a biased dimension
+/*! \details The shape distribution is restricted to each mesh element
+ * (spatial dimensions) or energy bin (energy dimension) when sampling. It
+ * must be the (independent) unbiased distribution of the dimension so that
+ * the sampled phase space points are distributed like the unbiased source
+ * inside of each mesh element and energy bin. Only tabular distributions,
+ * which can be sampled in a subrange using the inverse cdf, are supported.
+ */
+void CADISParticleDistribution::setShapeDistribution(
+                  const PhaseSpaceDimension dimension,
+                  const std::shared_ptr<const Utility::UnivariateDistribution>&
+                  shape_distribution )
+{
+  // Make sure that the shape distribution is valid
+  testPrecondition( shape_distribution.get() );
+
+  TEST_FOR_EXCEPTION( !CADISParticleDistribution::isBiasedDimension( dimension ),
+                      std::runtime_error,
+                      "The " << dimension << " is not biased by the CADIS "
+                      "particle distribution!" );
+
+  TEST_FOR_EXCEPTION( !shape_distribution->isTabular(),
+                      std::runtime_error,
+                      "The " << dimension << " shape distribution must be "
+                      "tabular!" );
+
+  const size_t dimension_index =
+    (dimension == ENERGY_DIMENSION ? 3 : (size_t)dimension);
+
+  const Utility::TabularUnivariateDistribution* tabular_distribution =
+    dynamic_cast<const Utility::TabularUnivariateDistribution*>( shape_distribution.get() );
+
+  // Every sampled pair must have a nonzero shape probability
+  for( size_t i = 0; i < d_pair_elements.size(); ++i )
+  {
+    double lower_bounds[4], upper_bounds[4];
+
+    this->getBounds( i, lower_bounds, upper_bounds );
+
+    const double lower_bound =
+      std::max( lower_bounds[dimension_index],
+                shape_distribution->getLowerBoundOfIndepVar() );
+
+    const double upper_bound =
+      std::min( upper_bounds[dimension_index],
+                shape_distribution->getUpperBoundOfIndepVar() );
+
+    TEST_FOR_EXCEPTION( lower_bound >= upper_bound ||
+                        tabular_distribution->evaluateCDF( upper_bound ) <=
+                        tabular_distribution->evaluateCDF( lower_bound ),
+                        std::runtime_error,
+                        "The " << dimension << " shape distribution is zero "
+                        "in mesh element " << d_pair_elements[i] << " energy "
+                        "bin " << d_pair_energy_bins[i] << ", which has a "
+                        "positive biased source strength!" );
+  }
+
+  d_shape_distributions[dimension_index] = shape_distribution;
+
+  this->cacheDerivedData();
+}
+
+// Return the unbiased distribution
+std::shared_ptr<const ParticleDistribution>
+CADISParticleDistribution::getUnbiasedDistribution() const
+{
+  return d_unbiased_distribution;
+}
+
+// Return the mesh
+std::shared_ptr<const Utility::StructuredHexMesh>
+CADISParticleDistribution::getMesh() const
+{
+  return d_mesh;
+}
+
+// Return the birth weight of the mesh element and energy bin
+/*! \details A birth weight of zero will be returned if the mesh element and
+ * energy bin is never sampled.
+ */
+double CADISParticleDistribution::getBirthWeight(
+                                 const Utility::Mesh::ElementHandle element,
+                                 const size_t energy_bin ) const
+{
+  // Make sure that the energy bin is valid
+  testPrecondition( energy_bin < d_energy_bin_boundaries.size() - 1 );
+
+  std::unordered_map<Utility::Mesh::ElementHandle,std::vector<size_t> >::const_iterator
+    pair_indices_it = d_pair_indices.find( element );
+
+  if( pair_indices_it == d_pair_indices.end() )
+    return 0.0;
+
+  const size_t pair_index = pair_indices_it->second[energy_bin];
+
+  if( pair_index < d_pair_birth_weights.size() )
+    return d_pair_birth_weights[pair_index];
+  else
+    return 0.0;
+}
+
+// Return the dimension distribution type name
+std::string CADISParticleDistribution::getDimensionDistributionTypeName(
+                                    const PhaseSpaceDimension dimension ) const
+{
+  if( CADISParticleDistribution::isBiasedDimension( dimension ) )
+    return "CADIS Joint Space-Energy Distribution";
+  else
+    return d_unbiased_distribution->getDimensionDistributionTypeName( dimension );
+}
+
+// Check if the distribution is spatially uniform (somewhere)
+/*! \details The biased source is never spatially uniform.
+ */
+bool CADISParticleDistribution::isSpatiallyUniform() const
+{
+  return false;
+}
+
+// Check if the distribution is directionally uniform (isotropic)
+bool CADISParticleDistribution::isDirectionallyUniform() const
+{
+  return d_unbiased_distribution->isDirectionallyUniform();
+}
+
+// Initialize dimension counter map
+void CADISParticleDistribution::initializeDimensionCounters(
+                                           DimensionCounterMap& trials ) const
+{
+  d_unbiased_distribution->initializeDimensionCounters( trials );
+}
+
+// Evaluate the distribution at the desired phase space point
+/*! \details The biased distribution is the unbiased distribution divided by
+ * the birth weight of the mesh element and energy bin that contain the
+ * phase space point.
+ */
+double CADISParticleDistribution::evaluate( const ParticleState& particle ) const
+{
+  if( !d_mesh->isPointInMesh( particle.getPosition() ) )
+    return 0.0;
+
+  if( particle.getEnergy() < d_energy_bin_boundaries.front() ||
+      particle.getEnergy() > d_energy_bin_boundaries.back() )
+    return 0.0;
+
+  size_t energy_bin =
+    std::upper_bound( d_energy_bin_boundaries.begin(),
+                      d_energy_bin_boundaries.end(),
+                      particle.getEnergy() ) -
+    d_energy_bin_boundaries.begin();
+
+  energy_bin = std::min( energy_bin, d_energy_bin_boundaries.size() - 1 ) - 1;
+
+  const double birth_weight =
+    this->getBirthWeight( d_mesh->whichElementIsPointIn( particle.getPosition() ),
+                          energy_bin );
+
+  if( birth_weight > 0.0 )
+    return d_unbiased_distribution->evaluate( particle )/birth_weight;
+  else
+    return 0.0;
+}
+
+// Sample a particle state from the distribution
+void CADISParticleDistribution::sample( ParticleState& particle ) const
+{
+  d_unbiased_distribution->sample( particle );
+
+  this->sampleBiasedDimensions( particle );
+}
+
+// Sample a particle state from the dist. and record the number of trials
+/*! \details The joint sampling of the mesh element and energy bin is
+ * direct (one trial per dimension), so the unbiased distribution trials are
+ * recorded.
+ */
+void CADISParticleDistribution::sampleAndRecordTrials(
+                                            ParticleState& particle,
+                                            DimensionCounterMap& trials ) const
+{
+  d_unbiased_distribution->sampleAndRecordTrials( particle, trials );
+
+  this->sampleBiasedDimensions( particle );
+}
+
+// Sample a particle state with the desired dimension value
+/*! \details If the dimension is a biased dimension (spatial or energy) the
+ * remaining dimensions are sampled from the unbiased distribution (with a
+ * unit birth weight multiplier) since the biased source can't be
+ * conditioned on a single dimension value.
+ */
+void CADISParticleDistribution::sampleWithDimensionValue(
+                                        ParticleState& particle,
+                                        const PhaseSpaceDimension dimension,
+                                        const double dimension_value ) const
+{
+  d_unbiased_distribution->sampleWithDimensionValue( particle,
+                                                     dimension,
+                                                     dimension_value );
+
+  if( !CADISParticleDistribution::isBiasedDimension( dimension ) )
+    this->sampleBiasedDimensions( particle );
+}
+
+// Sample a particle state with the desired dim. value and record trials
+void CADISParticleDistribution::sampleWithDimensionValueAndRecordTrials(
+                                        ParticleState& particle,
+                                        DimensionCounterMap& trials,
+                                        const PhaseSpaceDimension dimension,
+                                        const double dimension_value ) const
+{
+  d_unbiased_distribution->sampleWithDimensionValueAndRecordTrials(
+                                                           particle,
+                                                           trials,
+                                                           dimension,
+                                                           dimension_value );
+
+  if( !CADISParticleDistribution::isBiasedDimension( dimension ) )
+    this->sampleBiasedDimensions( particle );
+}
+
+// Check if the dimension is a biased dimension
+bool CADISParticleDistribution::isBiasedDimension(
+                                          const PhaseSpaceDimension dimension )
+{
+  return dimension == PRIMARY_SPATIAL_DIMENSION ||
+    dimension == SECONDARY_SPATIAL_DIMENSION ||
+    dimension == TERTIARY_SPATIAL_DIMENSION ||
+    dimension == ENERGY_DIMENSION;
+}
+
+// Sample the biased dimensions of the particle state
+/*! \details The (mesh element, energy bin) pair is sampled from the biased
+ * source strengths, the position and energy are sampled inside of the pair
+ * bounds and the particle source weight is multiplied by the pair birth
+ * weight.
+ */
+void CADISParticleDistribution::sampleBiasedDimensions(
+                                               ParticleState& particle ) const
+{
+  const double random_number =
+    Utility::RandomNumberGenerator::getRandomNumber<double>();
+
+  size_t pair_index = std::upper_bound( d_pair_cdf.begin(),
+                                        d_pair_cdf.end(),
+                                        random_number ) - d_pair_cdf.begin();
+
+  pair_index = std::min( pair_index, d_pair_cdf.size() - 1 );
+
+  double lower_bounds[4], upper_bounds[4];
+
+  this->getBounds( pair_index, lower_bounds, upper_bounds );
+
+  particle.setPosition(
+       this->sampleDimensionValueInBounds( 0, lower_bounds[0], upper_bounds[0] ),
+       this->sampleDimensionValueInBounds( 1, lower_bounds[1], upper_bounds[1] ),
+       this->sampleDimensionValueInBounds( 2, lower_bounds[2], upper_bounds[2] ) );
+
+  particle.setSourceEnergy(
+      this->sampleDimensionValueInBounds( 3, lower_bounds[3], upper_bounds[3] ) );
+  particle.setEnergy( particle.getSourceEnergy() );
+
+  particle.setSourceWeight( particle.getSourceWeight()*
+                            d_pair_birth_weights[pair_index] );
+  particle.setWeight( particle.getSourceWeight() );
+}
+
+// Sample a dimension value inside of the bounds
+double CADISParticleDistribution::sampleDimensionValueInBounds(
+                                             const size_t dimension_index,
+                                             const double lower_bound,
+                                             const double upper_bound ) const
+{
+  const double random_number =
+    Utility::RandomNumberGenerator::getRandomNumber<double>();
+
+  const Utility::TabularUnivariateDistribution* shape_distribution =
+    d_tabular_shape_distributions[dimension_index];
+
+  if( shape_distribution )
+  {
+    const double lower_cdf = shape_distribution->evaluateCDF(
+         std::max( lower_bound, shape_distribution->getLowerBoundOfIndepVar() ) );
+
+    const double upper_cdf = shape_distribution->evaluateCDF(
+         std::min( upper_bound, shape_distribution->getUpperBoundOfIndepVar() ) );
+
+    return shape_distribution->sampleWithRandomNumber(
+                      lower_cdf + random_number*(upper_cdf - lower_cdf) );
+  }
+  else
+    return lower_bound + random_number*(upper_bound - lower_bound);
+}
+
+// Get the bounds of a mesh element and energy bin
+void CADISParticleDistribution::getBounds( const size_t pair_index,
+                                           double lower_bounds[4],
+                                           double upper_bounds[4] ) const
+{
+  size_t plane_indices[3];
+
+  d_mesh->getHexPlaneIndices( d_pair_elements[pair_index], plane_indices );
+
+  lower_bounds[0] = d_mesh->getXPlaneLocation( plane_indices[0] );
+  upper_bounds[0] = d_mesh->getXPlaneLocation( plane_indices[0]+1 );
+  lower_bounds[1] = d_mesh->getYPlaneLocation( plane_indices[1] );
+  upper_bounds[1] = d_mesh->getYPlaneLocation( plane_indices[1]+1 );
+  lower_bounds[2] = d_mesh->getZPlaneLocation( plane_indices[2] );
+  upper_bounds[2] = d_mesh->getZPlaneLocation( plane_indices[2]+1 );
+
+  const size_t energy_bin = d_pair_energy_bins[pair_index];
+
+  lower_bounds[3] = d_energy_bin_boundaries[energy_bin];
+  upper_bounds[3] = d_energy_bin_boundaries[energy_bin+1];
+}
+
+// Cache the tabular shape distributions and the birth weight lookup map
+void CADISParticleDistribution::cacheDerivedData()
+{
+  d_tabular_shape_distributions.resize( d_shape_distributions.size() );
+
+  for( size_t i = 0; i < d_shape_distributions.size(); ++i )
+  {
+    d_tabular_shape_distributions[i] =
+      dynamic_cast<const Utility::TabularUnivariateDistribution*>( d_shape_distributions[i].get() );
+  }
+
+  d_pair_indices.clear();
+
+  const size_t number_of_bins = d_energy_bin_boundaries.size() - 1;
+
+  for( size_t i = 0; i < d_pair_elements.size(); ++i )
+  {
+    std::vector<size_t>& element_pair_indices =
+      d_pair_indices[d_pair_elements[i]];
+
+    // Pairs that are never sampled get an invalid index
+    if( element_pair_indices.empty() )
+      element_pair_indices.resize( number_of_bins, d_pair_elements.size() );
+
+    element_pair_indices[d_pair_energy_bins[i]] = i;
+  }
+}
+
+EXPLICIT_CLASS_SAVE_LOAD_INST( CADISParticleDistribution );
+
+} // end MonteCarlo namespace
+
+BOOST_CLASS_EXPORT_IMPLEMENT( MonteCarlo::CADISParticleDistribution );
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_CADISParticleDistribution.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,235 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_CADISParticleDistribution.hpp
+//! \author Alex Robinson
+//! \brief  CADIS (joint space-energy biased) particle distribution declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_CADIS_PARTICLE_DISTRIBUTION_HPP
+#define MONTE_CARLO_CADIS_PARTICLE_DISTRIBUTION_HPP
+
+// Std Lib Includes
+#include <memory>
+#include <unordered_map>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleDistribution.hpp"
+#include "Utility_TabularUnivariateDistribution.hpp"
+#include "Utility_StructuredHexMesh.hpp"
+#include "Utility_Vector.hpp"
+
+namespace MonteCarlo{
+
+/*! The CADIS particle distribution class
+ * \details The CADIS biased source
+ * \f$\hat{q}_{e,g}=q_{e,g}\phi^{\dagger}_{e,g}/R\f$ is a joint distribution
+ * of the mesh elements and energy bins, which can't be represented by the
+ * independent phase space dimension distributions of a
+ * MonteCarlo::StandardParticleDistribution. This distribution samples the
+ * (mesh element, energy bin) pair directly from the biased source
+ * strengths and then samples the position and energy inside of the element
+ * and bin from the element and bin restricted shape distributions (uniform
+ * by default). The birth weight of the particle is the weight of the
+ * (mesh element, energy bin) pair, which is the unbiased probability
+ * divided by the biased probability (\f$R/\phi^{\dagger}_{e,g}\f$ for
+ * CADIS, the weight window center). All other phase space dimensions
+ * (direction, time, weight) are sampled from the unbiased distribution,
+ * which must not correlate them with the position or energy. The mesh is
+ * in the global (cartesian) coordinate system.
+ */
+class CADISParticleDistribution : public ParticleDistribution
+{
+
+public:
+
+  //! Typedef for the dimension trial counter map
+  typedef ParticleDistribution::DimensionCounterMap DimensionCounterMap;
+
+  //! Typedef for the mesh element bin value map
+  typedef std::unordered_map<Utility::Mesh::ElementHandle,std::vector<double> > MeshElementBinValueMap;
+
+  //! Constructor
+  CADISParticleDistribution(
+        const std::string& name,
+        const std::shared_ptr<const ParticleDistribution>& unbiased_distribution,
+        const std::shared_ptr<const Utility::StructuredHexMesh>& mesh,
+        const std::vector<double>& energy_bin_boundaries,
+        const MeshElementBinValueMap& biased_source_strengths,
+        const MeshElementBinValueMap& birth_weights );
+
+  //! Destructor
+  ~CADISParticleDistribution()
+  { /* ... */ }
+
+  //! Set the shape distribution of a biased dimension
+  void setShapeDistribution(
+                  const PhaseSpaceDimension dimension,
+                  const std::shared_ptr<const Utility::UnivariateDistribution>&
+                  shape_distribution );
+
+  //! Return the unbiased distribution
+  std::shared_ptr<const ParticleDistribution> getUnbiasedDistribution() const;
+
+  //! Return the mesh
+  std::shared_ptr<const Utility::StructuredHexMesh> getMesh() const;
+
+  //! Return the birth weight of the mesh element and energy bin
+  double getBirthWeight( const Utility::Mesh::ElementHandle element,
+                         const size_t energy_bin ) const;
+
+  //! Return the dimension distribution type name
+  std::string getDimensionDistributionTypeName(
+                          const PhaseSpaceDimension dimension ) const override;
+
+  //! Check if the distribution is spatially uniform (somewhere)
+  bool isSpatiallyUniform() const override;
+
+  //! Check if the distribution is directionally uniform (isotropic)
+  bool isDirectionallyUniform() const override;
+
+  //! Initialize dimension counter map
+  void initializeDimensionCounters( DimensionCounterMap& trials ) const override;
+
+  //! Evaluate the distribution at the desired phase space point
+  double evaluate( const ParticleState& particle ) const override;
+
+  //! Sample a particle state from the distribution
+  void sample( ParticleState& particle ) const override;
+
+  //! Sample a particle state from the dist. and record the number of trials
+  void sampleAndRecordTrials( ParticleState& particle,
+                              DimensionCounterMap& trials ) const override;
+
+  //! Sample a particle state with the desired dimension value
+  void sampleWithDimensionValue( ParticleState& particle,
+                                 const PhaseSpaceDimension dimension,
+                                 const double dimension_value ) const override;
+
+  //! Sample a particle state with the desired dim. value and record trials
+  void sampleWithDimensionValueAndRecordTrials(
+                                 ParticleState& particle,
+                                 DimensionCounterMap& trials,
+                                 const PhaseSpaceDimension dimension,
+                                 const double dimension_value ) const override;
+
+private:
+
+  // Default constructor
+  CADISParticleDistribution();
+
+  // Check if the dimension is a biased dimension
+  static bool isBiasedDimension( const PhaseSpaceDimension dimension );
+
+  // Sample the biased dimensions of the particle state
+  void sampleBiasedDimensions( ParticleState& particle ) const;
+
+  // Sample a dimension value inside of the bounds
+  double sampleDimensionValueInBounds( const size_t dimension_index,
+                                       const double lower_bound,
+                                       const double upper_bound ) const;
+
+  // Get the bounds of a mesh element and energy bin
+  void getBounds( const size_t pair_index,
+                  double lower_bounds[4],
+                  double upper_bounds[4] ) const;
+
+  // Cache the tabular shape distributions and the birth weight lookup map
+  void cacheDerivedData();
+
+  // Save the state to an archive
+  template<typename Archive>
+  void save( Archive& ar, const unsigned version ) const;
+
+  // Load the data from an archive
+  template<typename Archive>
+  void load( Archive& ar, const unsigned version );
+
+  BOOST_SERIALIZATION_SPLIT_MEMBER();
+
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+
+  // The unbiased distribution
+  std::shared_ptr<const ParticleDistribution> d_unbiased_distribution;
+
+  // The mesh
+  std::shared_ptr<const Utility::StructuredHexMesh> d_mesh;
+
+  // The energy bin boundaries
+  std::vector<double> d_energy_bin_boundaries;
+
+  // The shape distributions (x, y, z, energy - null for uniform)
+  std::vector<std::shared_ptr<const Utility::UnivariateDistribution> >
+  d_shape_distributions;
+
+  // The mesh element of each sampled (mesh element, energy bin) pair
+  std::vector<Utility::Mesh::ElementHandle> d_pair_elements;
+
+  // The energy bin of each sampled (mesh element, energy bin) pair
+  std::vector<size_t> d_pair_energy_bins;
+
+  // The biased cumulative distribution of the pairs
+  std::vector<double> d_pair_cdf;
+
+  // The birth weight of each pair
+  std::vector<double> d_pair_birth_weights;
+
+  // The tabular shape distributions (cached)
+  std::vector<const Utility::TabularUnivariateDistribution*>
+  d_tabular_shape_distributions;
+
+  // The pair index of each mesh element and energy bin (cached)
+  std::unordered_map<Utility::Mesh::ElementHandle,std::vector<size_t> >
+  d_pair_indices;
+};
+
+// Save the state to an archive
+template<typename Archive>
+void CADISParticleDistribution::save( Archive& ar, const unsigned version ) const
+{
+  // Save the base class member data
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleDistribution );
+
+  // Save the local member data
+  ar & BOOST_SERIALIZATION_NVP( d_unbiased_distribution );
+  ar & BOOST_SERIALIZATION_NVP( d_mesh );
+  ar & BOOST_SERIALIZATION_NVP( d_energy_bin_boundaries );
+  ar & BOOST_SERIALIZATION_NVP( d_shape_distributions );
+  ar & BOOST_SERIALIZATION_NVP( d_pair_elements );
+  ar & BOOST_SERIALIZATION_NVP( d_pair_energy_bins );
+  ar & BOOST_SERIALIZATION_NVP( d_pair_cdf );
+  ar & BOOST_SERIALIZATION_NVP( d_pair_birth_weights );
+}
+
+// Load the data from an archive
+template<typename Archive>
+void CADISParticleDistribution::load( Archive& ar, const unsigned version )
+{
+  // Load the base class member data
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleDistribution );
+
+  // Load the local member data
+  ar & BOOST_SERIALIZATION_NVP( d_unbiased_distribution );
+  ar & BOOST_SERIALIZATION_NVP( d_mesh );
+  ar & BOOST_SERIALIZATION_NVP( d_energy_bin_boundaries );
+  ar & BOOST_SERIALIZATION_NVP( d_shape_distributions );
+  ar & BOOST_SERIALIZATION_NVP( d_pair_elements );
+  ar & BOOST_SERIALIZATION_NVP( d_pair_energy_bins );
+  ar & BOOST_SERIALIZATION_NVP( d_pair_cdf );
+  ar & BOOST_SERIALIZATION_NVP( d_pair_birth_weights );
+
+  this->cacheDerivedData();
+}
+
+} // end MonteCarlo namespace
+
+BOOST_SERIALIZATION_CLASS_VERSION( CADISParticleDistribution, MonteCarlo, 0 );
+BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( CADISParticleDistribution, MonteCarlo );
+EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo, CADISParticleDistribution );
+
+#endif // end MONTE_CARLO_CADIS_PARTICLE_DISTRIBUTION_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_CADISParticleDistribution.hpp
+//---------------------------------------------------------------------------//
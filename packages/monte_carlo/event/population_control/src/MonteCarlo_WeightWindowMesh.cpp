@@ -6,53 +6,86 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Std Lib Includes
+#include <algorithm>
+#include <limits>
+
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp"
 #include "MonteCarlo_WeightWindowMesh.hpp"
+#include "Utility_SearchAlgorithms.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_DesignByContract.hpp"
 
 namespace MonteCarlo{
 
+// Initialize static member data
+const std::string WeightWindowMesh::s_archive_name( "weight_window_mesh" );
+
 // Constructor
 WeightWindowMesh::WeightWindowMesh()
+  : d_number_of_bins( 1 )
 { /* ... */ }
 
+// Load weight window mesh constructor
+WeightWindowMesh::WeightWindowMesh(
+                       const boost::filesystem::path& archive_name_with_path )
+  : d_number_of_bins( 1 )
+{
+  this->loadFromFile( archive_name_with_path );
+}
+
 // Set the mesh for a particle
 void WeightWindowMesh::setMesh(const std::shared_ptr<const Utility::Mesh> mesh)
 {
   d_mesh = mesh;
+
+  this->updateDenseWeightWindows();
 }
 
 // Set the weight windows
+/*! \details The discretization should be set before the weight windows.
+ * Mesh elements that are not in the map (or that have too few weight
+ * windows) will have open weight windows.
+ */
 void WeightWindowMesh::setWeightWindowMap( std::unordered_map<Utility::Mesh::ElementHandle, std::vector<WeightWindow>>& weight_window_map )
 {
   testPrecondition(d_mesh);
   d_weight_window_map = weight_window_map;
+
+  this->updateDenseWeightWindows();
 }
 
 // Get a specific weight window
+/*! \details The particle must be in the weight window discretization.
+ */
 const WeightWindow& WeightWindowMesh::getWeightWindow( const ParticleState& particle) const
 {
-  ObserverParticleStateWrapper observer_particle(particle);
-  ObserverPhaseSpaceDimensionDiscretization::BinIndexArray discretization_index;
-  this->calculateBinIndicesOfPoint(observer_particle, discretization_index);
+  size_t element_index;
+
+  bool element_found = this->findElementIndex( particle, element_index );
 
-  return d_weight_window_map.at(d_mesh->whichElementIsPointIn(particle.getPosition()))[discretization_index[0]];
+  // Make sure that the particle is in the mesh
+  testPrecondition( element_found );
+
+  return d_dense_weight_windows[element_index*d_number_of_bins +
+                                this->calculateDiscretizationIndex( particle )];
 }
 
 // Check if a particle is under the weight window phase space
+/*! \details The mesh element that contains the particle will be cached so
+ * that the following call to getWeightWindow does not search the mesh again.
+ */
 bool WeightWindowMesh::isParticleInWeightWindowDiscretization( const ParticleState& particle ) const
 {
-  ObserverParticleStateWrapper observer_particle(particle);
-
-  if(d_mesh->isPointInMesh(particle.getPosition()) && this->isPointInObserverPhaseSpace(observer_particle))
+  if( this->isParticleInDiscretization( particle ) )
   {
-    return true;
-  }else
-  {
-    return false;
+    size_t element_index;
+
+    return this->findElementIndex( particle, element_index );
   }
+  else
+    return false;
 }
 
 // Return pointer to weight window mesh
@@ -67,6 +100,161 @@ const std::unordered_map<Utility::Mesh::ElementHandle, std::vector<WeightWindow>
   return d_weight_window_map;
 }
 
+// The weight window mesh name used in an archive
+const char* WeightWindowMesh::getArchiveName() const
+{
+  return s_archive_name.c_str();
+}
+
+// Assign discretization to an observer dimension
+void WeightWindowMesh::assignDiscretization(
+  const std::shared_ptr<const ObserverPhaseSpaceDimensionDiscretization>& bins,
+  const bool range_dimension )
+{
+  WeightWindowBase::assignDiscretization( bins, range_dimension );
+
+  this->updateDenseWeightWindows();
+}
+
+// Update the dense weight window storage
+void WeightWindowMesh::updateDenseWeightWindows()
+{
+  d_element_indices.clear();
+  d_dense_weight_windows.clear();
+  d_energy_bin_boundaries.clear();
+
+  d_number_of_bins = this->getNumberOfBins();
+
+  // The energy bins can be searched directly if energy is the only dimension
+  std::vector<ObserverPhaseSpaceDimension> discretized_dimensions;
+
+  this->getDiscretizedDimensions( discretized_dimensions );
+
+  if( discretized_dimensions.size() == 1 &&
+      discretized_dimensions.front() == OBSERVER_ENERGY_DIMENSION )
+  {
+    this->getDiscretization<OBSERVER_ENERGY_DIMENSION>( d_energy_bin_boundaries );
+  }
+
+  if( !d_mesh )
+    return;
+
+  // Open weight window (no population control)
+  WeightWindow open_weight_window;
+  open_weight_window.lower_weight = 0.0;
+  open_weight_window.survival_weight = 0.0;
+  open_weight_window.upper_weight = std::numeric_limits<double>::max();
+
+  d_dense_weight_windows.resize( d_mesh->getNumberOfElements()*d_number_of_bins,
+                                 open_weight_window );
+
+  size_t element_index = 0;
+
+  for( Utility::Mesh::ElementHandleIterator element_it =
+         d_mesh->getStartElementHandleIterator();
+       element_it != d_mesh->getEndElementHandleIterator();
+       ++element_it, ++element_index )
+  {
+    d_element_indices[*element_it] = element_index;
+
+    std::unordered_map<Utility::Mesh::ElementHandle,std::vector<WeightWindow> >::const_iterator weight_windows_it =
+      d_weight_window_map.find( *element_it );
+
+    if( weight_windows_it != d_weight_window_map.end() )
+    {
+      const size_t number_of_windows =
+        std::min( weight_windows_it->second.size(), d_number_of_bins );
+
+      std::copy( weight_windows_it->second.begin(),
+                 weight_windows_it->second.begin() + number_of_windows,
+                 d_dense_weight_windows.begin() +
+                 element_index*d_number_of_bins );
+    }
+  }
+}
+
+// Find the dense index of the mesh element that contains the particle
+/*! \details The cached mesh element of the particle will be checked first.
+ * The mesh will only be searched if the particle has left the cached
+ * element, in which case the cached element will be updated.
+ */
+bool WeightWindowMesh::findElementIndex( const ParticleState& particle,
+                                         size_t& element_index ) const
+{
+  const double* position = particle.getPosition();
+
+  Utility::Mesh::ElementHandle element;
+
+  if( particle.getCachedMeshElement( *d_mesh, element, element_index ) )
+  {
+    if( d_mesh->isPointInElement( position, element ) )
+      return true;
+  }
+
+  if( !d_mesh->isPointInMesh( position ) )
+    return false;
+
+  element = d_mesh->whichElementIsPointIn( position );
+
+  std::unordered_map<Utility::Mesh::ElementHandle,size_t>::const_iterator
+    element_index_it = d_element_indices.find( element );
+
+  // The element may not be found due to tolerance issues (tet meshes)
+  if( element_index_it == d_element_indices.end() )
+    return false;
+
+  element_index = element_index_it->second;
+
+  particle.cacheMeshElement( *d_mesh, element, element_index );
+
+  return true;
+}
+
+// Calculate the discretization bin index of the particle
+size_t WeightWindowMesh::calculateDiscretizationIndex(
+                                        const ParticleState& particle ) const
+{
+  if( !d_energy_bin_boundaries.empty() )
+  {
+    size_t bin = Utility::Search::binaryUpperBoundIndex(
+                                               d_energy_bin_boundaries.begin(),
+                                               d_energy_bin_boundaries.end(),
+                                               particle.getEnergy() );
+
+    if( bin != 0 )
+      return bin - 1;
+    else
+      return bin;
+  }
+  else if( d_number_of_bins == 1 )
+    return 0;
+  else
+  {
+    ObserverParticleStateWrapper observer_particle(particle);
+    ObserverPhaseSpaceDimensionDiscretization::BinIndexArray discretization_index;
+    this->calculateBinIndicesOfPoint(observer_particle, discretization_index);
+
+    return discretization_index[0];
+  }
+}
+
+// Check if the particle is in the discretization
+bool WeightWindowMesh::isParticleInDiscretization(
+                                        const ParticleState& particle ) const
+{
+  if( !d_energy_bin_boundaries.empty() )
+  {
+    return particle.getEnergy() >= d_energy_bin_boundaries.front() &&
+      particle.getEnergy() <= d_energy_bin_boundaries.back();
+  }
+  else
+  {
+    ObserverParticleStateWrapper observer_particle(particle);
+
+    return this->isPointInObserverPhaseSpace(observer_particle);
+  }
+}
+
 } // end MonteCarlo namespace
 
 EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo::WeightWindowMesh );
@@ -15,13 +15,23 @@
 
 // FRENSIE Includes
 #include "MonteCarlo_WeightWindow.hpp"
+#include "Utility_ArchivableObject.hpp"
 #include "Utility_Mesh.hpp"
 #include "Utility_Map.hpp"
 
 namespace MonteCarlo{
 
-//! The weight window mesh class
-class WeightWindowMesh : public WeightWindowBase
+/*! The weight window mesh class
+ * \details The weight window mesh can be saved to and loaded from a file
+ * (e.g. .xml, .txt, .bin, .h5fa) so that generated weight windows can be
+ * reused in other simulations. The weight windows are stored in a dense
+ * [element][bin] array for fast lookup. The mesh element that contains a
+ * particle is cached in the particle state so that the mesh only has to be
+ * searched when the particle leaves the cached element. Mesh elements
+ * without weight windows have open weight windows (no population control).
+ */
+class WeightWindowMesh : public WeightWindowBase,
+                         public Utility::ArchivableObject<WeightWindowMesh>
 {
 
 public:
@@ -29,6 +39,9 @@ public:
   //! Constructor
   WeightWindowMesh();
 
+  //! Load weight window mesh constructor
+  WeightWindowMesh( const boost::filesystem::path& archive_name_with_path );
+
   //! Destructor
   ~WeightWindowMesh()
   { /* ... */ }
@@ -49,8 +62,33 @@ public:
   //! Get the weight window map (for viewing purposes only)
   const std::unordered_map<Utility::Mesh::ElementHandle, std::vector<WeightWindow>>& getWeightWindowMap() const;
 
+  //! The name that will be used when archiving the object
+  const char* getArchiveName() const final override;
+
+protected:
+
+  //! Assign discretization to an observer dimension
+  void assignDiscretization( const std::shared_ptr<const ObserverPhaseSpaceDimensionDiscretization>& bins,
+                             const bool range_dimension ) override;
+
 private:
 
+  // Update the dense weight window storage
+  void updateDenseWeightWindows();
+
+  // Find the dense index of the mesh element that contains the particle
+  bool findElementIndex( const ParticleState& particle,
+                         size_t& element_index ) const;
+
+  // Calculate the discretization bin index of the particle
+  size_t calculateDiscretizationIndex( const ParticleState& particle ) const;
+
+  // Check if the particle is in the discretization
+  bool isParticleInDiscretization( const ParticleState& particle ) const;
+
+  // The weight window mesh name used in an archive
+  static const std::string s_archive_name;
+
   // Declare the boost serialization access object as a friend
   friend class boost::serialization::access;
 
@@ -59,17 +97,44 @@ private:
   //! Map that contains weight windows. First key is the index of the mesh element, second key is the index of the discretization
   std::unordered_map<Utility::Mesh::ElementHandle, std::vector<WeightWindow>> d_weight_window_map;
 
-  // Serialize the data
+  // The dense index of each mesh element (mesh element iterator order)
+  std::unordered_map<Utility::Mesh::ElementHandle,size_t> d_element_indices;
+
+  // The dense weight windows (element index*number of bins + bin index)
+  std::vector<WeightWindow> d_dense_weight_windows;
+
+  // The number of discretization bins
+  size_t d_number_of_bins;
+
+  // The energy bin boundaries (only used when energy is the only dimension)
+  std::vector<double> d_energy_bin_boundaries;
+
+  // Save the data to an archive
+  template<typename Archive>
+  void save( Archive& ar, const unsigned version ) const
+  {
+    // Save the base class data
+    ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( WeightWindowBase );
+    // Save the member data
+    ar & BOOST_SERIALIZATION_NVP( d_mesh );
+    ar & BOOST_SERIALIZATION_NVP( d_weight_window_map );
+  }
+
+  // Load the data from an archive
   template<typename Archive>
-  void serialize( Archive& ar, const unsigned version )
-  {   
-    // Serialize the base class data
+  void load( Archive& ar, const unsigned version )
+  {
+    // Load the base class data
     ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( WeightWindowBase );
-    // Serialize the member data
+    // Load the member data
     ar & BOOST_SERIALIZATION_NVP( d_mesh );
     ar & BOOST_SERIALIZATION_NVP( d_weight_window_map );
+
+    this->updateDenseWeightWindows();
   }
 
+  BOOST_SERIALIZATION_SPLIT_MEMBER();
+
 };
 
 } // end MonteCarlo namespace
@@ -0,0 +1,417 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_WeightWindowMeshGenerator.cpp
+//! \author Alex Robinson
+//! \brief  Weight window mesh generator class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <limits>
+
+// FRENSIE Includes
+#include "FRENSIE_Archives.hpp"
+#include "MonteCarlo_WeightWindowMeshGenerator.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Default constructor
+WeightWindowMeshGenerator::WeightWindowMeshGenerator()
+  : d_mesh_flux_estimator(),
+    d_weight_window_mesh(),
+    d_upper_to_lower_weight_ratio( 5.0 ),
+    d_survival_to_lower_weight_ratio( 3.0 ),
+    d_max_relative_error( 0.5 ),
+    d_reference_lower_weight( 0.5 ),
+    d_number_of_updates( 0 )
+{ /* ... */ }
+
+// Constructor
+/*! \details The default ratios are the same as the default ratios used by
+ * MCNP (upper weight = 5*lower weight, survival weight = 3*lower weight).
+ */
+WeightWindowMeshGenerator::WeightWindowMeshGenerator(
+                 const std::shared_ptr<const Estimator>& mesh_flux_estimator,
+                 const std::shared_ptr<WeightWindowMesh>& weight_window_mesh,
+                 const double upper_to_lower_weight_ratio,
+                 const double survival_to_lower_weight_ratio,
+                 const double max_relative_error )
+  : d_mesh_flux_estimator( mesh_flux_estimator ),
+    d_weight_window_mesh( weight_window_mesh ),
+    d_upper_to_lower_weight_ratio( upper_to_lower_weight_ratio ),
+    d_survival_to_lower_weight_ratio( survival_to_lower_weight_ratio ),
+    d_max_relative_error( max_relative_error ),
+    d_reference_lower_weight( 0.5 ),
+    d_number_of_updates( 0 )
+{
+  // Make sure that the pointers are valid
+  testPrecondition( mesh_flux_estimator.get() );
+  testPrecondition( weight_window_mesh.get() );
+
+  TEST_FOR_EXCEPTION( !mesh_flux_estimator->isMeshEstimator(),
+                      std::runtime_error,
+                      "Estimator " << mesh_flux_estimator->getId() <<
+                      " cannot be used to generate weight windows because "
+                      "it is not a mesh estimator!" );
+
+  TEST_FOR_EXCEPTION( !weight_window_mesh->getMesh(),
+                      std::runtime_error,
+                      "The weight window mesh must have a mesh before "
+                      "weight windows can be generated!" );
+
+  TEST_FOR_EXCEPTION( mesh_flux_estimator->getNumberOfBins() !=
+                      weight_window_mesh->getNumberOfBins(),
+                      std::runtime_error,
+                      "Estimator " << mesh_flux_estimator->getId() <<
+                      " cannot be used to generate weight windows because "
+                      "its discretization does not match the weight window "
+                      "mesh discretization ("
+                      << mesh_flux_estimator->getNumberOfBins() << " != "
+                      << weight_window_mesh->getNumberOfBins() << ")!" );
+
+  const Utility::Mesh& mesh = *weight_window_mesh->getMesh();
+
+  for( Utility::Mesh::ElementHandleIterator element_it =
+         mesh.getStartElementHandleIterator();
+       element_it != mesh.getEndElementHandleIterator();
+       ++element_it )
+  {
+    TEST_FOR_EXCEPTION( !mesh_flux_estimator->isEntityAssigned( *element_it ),
+                        std::runtime_error,
+                        "Estimator " << mesh_flux_estimator->getId() <<
+                        " cannot be used to generate weight windows because "
+                        "mesh element " << *element_it << " is not assigned "
+                        "to it!" );
+  }
+
+  TEST_FOR_EXCEPTION( upper_to_lower_weight_ratio <= 1.0,
+                      std::runtime_error,
+                      "The upper weight to lower weight ratio must be "
+                      "greater than 1!" );
+
+  TEST_FOR_EXCEPTION( survival_to_lower_weight_ratio < 1.0 ||
+                      survival_to_lower_weight_ratio >
+                      upper_to_lower_weight_ratio,
+                      std::runtime_error,
+                      "The survival weight to lower weight ratio must be in "
+                      "[1," << upper_to_lower_weight_ratio << "]!" );
+
+  TEST_FOR_EXCEPTION( max_relative_error <= 0.0,
+                      std::runtime_error,
+                      "The max relative error must be greater than 0!" );
+}
+
+// Set the reference lower weight (lower weight where the flux is max)
+/*! \details The default reference lower weight is 0.5 so that unit weight
+ * source particles will be inside of the weight window of the mesh element
+ * bins with the max flux.
+ */
+void WeightWindowMeshGenerator::setReferenceLowerWeight(
+                                          const double reference_lower_weight )
+{
+  TEST_FOR_EXCEPTION( reference_lower_weight <= 0.0,
+                      std::runtime_error,
+                      "The reference lower weight must be greater than 0!" );
+
+  d_reference_lower_weight = reference_lower_weight;
+}
+
+// Return the reference lower weight
+double WeightWindowMeshGenerator::getReferenceLowerWeight() const
+{
+  return d_reference_lower_weight;
+}
+
+// Return the upper weight to lower weight ratio
+double WeightWindowMeshGenerator::getUpperToLowerWeightRatio() const
+{
+  return d_upper_to_lower_weight_ratio;
+}
+
+// Return the survival weight to lower weight ratio
+double WeightWindowMeshGenerator::getSurvivalToLowerWeightRatio() const
+{
+  return d_survival_to_lower_weight_ratio;
+}
+
+// Return the max relative error of a usable flux estimate
+double WeightWindowMeshGenerator::getMaxRelativeError() const
+{
+  return d_max_relative_error;
+}
+
+// Return the mesh flux estimator
+const Estimator& WeightWindowMeshGenerator::getMeshFluxEstimator() const
+{
+  return *d_mesh_flux_estimator;
+}
+
+// Return the weight window mesh
+std::shared_ptr<const WeightWindowMesh> WeightWindowMeshGenerator::getWeightWindowMesh() const
+{
+  return d_weight_window_mesh;
+}
+
+// Return the number of weight window updates that have been done
+size_t WeightWindowMeshGenerator::getNumberOfUpdates() const
+{
+  return d_number_of_updates;
+}
+
+// Update the weight windows using the current flux estimates
+/*! \details The weight window mesh will be updated in place (the population
+ * controller used by a simulation manager can be updated at each
+ * rendezvous). If no flux has been estimated yet the weight windows will not
+ * be changed.
+ */
+void WeightWindowMeshGenerator::updateWeightWindows()
+{
+  if( !this->hasFluxBeenEstimated() )
+    return;
+
+  const size_t number_of_bins = d_weight_window_mesh->getNumberOfBins();
+
+  std::vector<double> max_fluxes;
+
+  this->calculateMaxFluxes( max_fluxes );
+
+  // Open weight window (no population control)
+  WeightWindow open_weight_window;
+  open_weight_window.lower_weight = 0.0;
+  open_weight_window.survival_weight = 0.0;
+  open_weight_window.upper_weight = std::numeric_limits<double>::max();
+
+  const std::unordered_map<Utility::Mesh::ElementHandle,std::vector<WeightWindow> >&
+    old_weight_window_map = d_weight_window_mesh->getWeightWindowMap();
+
+  std::unordered_map<Utility::Mesh::ElementHandle,std::vector<WeightWindow> >
+    weight_window_map;
+
+  const Utility::Mesh& mesh = *d_weight_window_mesh->getMesh();
+
+  std::vector<double> mean, relative_error, vov, fom;
+
+  for( Utility::Mesh::ElementHandleIterator element_it =
+         mesh.getStartElementHandleIterator();
+       element_it != mesh.getEndElementHandleIterator();
+       ++element_it )
+  {
+    d_mesh_flux_estimator->getEntityBinProcessedData( *element_it,
+                                                      mean,
+                                                      relative_error,
+                                                      vov,
+                                                      fom );
+
+    std::unordered_map<Utility::Mesh::ElementHandle,std::vector<WeightWindow> >::const_iterator old_windows_it =
+      old_weight_window_map.find( *element_it );
+
+    std::vector<WeightWindow>& element_weight_windows =
+      weight_window_map[*element_it];
+
+    element_weight_windows.resize( number_of_bins );
+
+    // Only the bins of the first response function are used
+    for( size_t i = 0; i < number_of_bins; ++i )
+    {
+      WeightWindow& weight_window = element_weight_windows[i];
+
+      if( this->isFluxEstimateUsable( mean[i], relative_error[i] ) )
+      {
+        weight_window.lower_weight =
+          d_reference_lower_weight*mean[i]/max_fluxes[i];
+
+        weight_window.survival_weight =
+          d_survival_to_lower_weight_ratio*weight_window.lower_weight;
+
+        weight_window.upper_weight =
+          d_upper_to_lower_weight_ratio*weight_window.lower_weight;
+      }
+      else if( old_windows_it != old_weight_window_map.end() &&
+               i < old_windows_it->second.size() )
+      {
+        weight_window = old_windows_it->second[i];
+      }
+      else
+        weight_window = open_weight_window;
+    }
+  }
+
+  d_weight_window_mesh->setWeightWindowMap( weight_window_map );
+
+  ++d_number_of_updates;
+}
+
+// Broadcast the weight windows from the root process to all processes
+/*! \details Only the root process of a distributed simulation has the
+ * reduced flux estimates. The weight windows must be updated on the root
+ * process and then broadcast so that every process uses the same windows.
+ */
+void WeightWindowMeshGenerator::broadcastWeightWindows(
+                                            const Utility::Communicator& comm,
+                                            const int root_process )
+{
+  if( comm.size() == 1 )
+    return;
+
+  // Pack the weight windows (element handle, number of windows, windows)
+  std::vector<Utility::Mesh::ElementHandle> element_handles;
+  std::vector<uint64_t> element_window_counts;
+  std::vector<double> packed_weight_windows;
+
+  if( comm.rank() == root_process )
+  {
+    const std::unordered_map<Utility::Mesh::ElementHandle,std::vector<WeightWindow> >&
+      weight_window_map = d_weight_window_mesh->getWeightWindowMap();
+
+    element_handles.reserve( weight_window_map.size() );
+    element_window_counts.reserve( weight_window_map.size() );
+
+    for( auto&& element_weight_windows : weight_window_map )
+    {
+      element_handles.push_back( element_weight_windows.first );
+      element_window_counts.push_back( element_weight_windows.second.size() );
+
+      for( auto&& weight_window : element_weight_windows.second )
+      {
+        packed_weight_windows.push_back( weight_window.lower_weight );
+        packed_weight_windows.push_back( weight_window.survival_weight );
+        packed_weight_windows.push_back( weight_window.upper_weight );
+      }
+    }
+  }
+
+  uint64_t number_of_elements = element_handles.size();
+  uint64_t number_of_packed_values = packed_weight_windows.size();
+  uint64_t number_of_updates = d_number_of_updates;
+
+  Utility::broadcast( comm, number_of_elements, root_process );
+  Utility::broadcast( comm, number_of_packed_values, root_process );
+  Utility::broadcast( comm, number_of_updates, root_process );
+
+  element_handles.resize( number_of_elements );
+  element_window_counts.resize( number_of_elements );
+  packed_weight_windows.resize( number_of_packed_values );
+
+  Utility::broadcast( comm, Utility::arrayView( element_handles ), root_process );
+  Utility::broadcast( comm, Utility::arrayView( element_window_counts ), root_process );
+  Utility::broadcast( comm, Utility::arrayView( packed_weight_windows ), root_process );
+
+  // Unpack the weight windows
+  if( comm.rank() != root_process )
+  {
+    std::unordered_map<Utility::Mesh::ElementHandle,std::vector<WeightWindow> >
+      weight_window_map;
+
+    size_t packed_index = 0;
+
+    for( size_t i = 0; i < element_handles.size(); ++i )
+    {
+      std::vector<WeightWindow>& element_weight_windows =
+        weight_window_map[element_handles[i]];
+
+      element_weight_windows.resize( element_window_counts[i] );
+
+      for( size_t j = 0; j < element_weight_windows.size(); ++j )
+      {
+        element_weight_windows[j].lower_weight =
+          packed_weight_windows[packed_index++];
+        element_weight_windows[j].survival_weight =
+          packed_weight_windows[packed_index++];
+        element_weight_windows[j].upper_weight =
+          packed_weight_windows[packed_index++];
+      }
+    }
+
+    d_weight_window_mesh->setWeightWindowMap( weight_window_map );
+
+    d_number_of_updates = number_of_updates;
+  }
+}
+
+// Export the weight window mesh
+/*! \details The file extension will be used to determine the archive type
+ * (e.g. .xml, .txt, .bin, .h5fa). Any existing file will be overwritten.
+ * The exported weight window mesh can be reused by loading it with the
+ * MonteCarlo::WeightWindowMesh load constructor.
+ */
+void WeightWindowMeshGenerator::exportWeightWindowMesh(
+                  const boost::filesystem::path& archive_name_with_path ) const
+{
+  d_weight_window_mesh->saveToFile( archive_name_with_path, true );
+}
+
+// Check if any flux has been estimated
+bool WeightWindowMeshGenerator::hasFluxBeenEstimated() const
+{
+  const Utility::Mesh& mesh = *d_weight_window_mesh->getMesh();
+
+  for( Utility::Mesh::ElementHandleIterator element_it =
+         mesh.getStartElementHandleIterator();
+       element_it != mesh.getEndElementHandleIterator();
+       ++element_it )
+  {
+    Utility::ArrayView<const double> first_moments =
+      d_mesh_flux_estimator->getEntityBinDataFirstMoments( *element_it );
+
+    for( size_t i = 0; i < first_moments.size(); ++i )
+    {
+      if( first_moments[i] > 0.0 )
+        return true;
+    }
+  }
+
+  return false;
+}
+
+// Calculate the max usable flux estimate in each discretization bin
+void WeightWindowMeshGenerator::calculateMaxFluxes(
+                                        std::vector<double>& max_fluxes ) const
+{
+  const size_t number_of_bins = d_weight_window_mesh->getNumberOfBins();
+
+  max_fluxes.clear();
+  max_fluxes.resize( number_of_bins, 0.0 );
+
+  const Utility::Mesh& mesh = *d_weight_window_mesh->getMesh();
+
+  std::vector<double> mean, relative_error, vov, fom;
+
+  for( Utility::Mesh::ElementHandleIterator element_it =
+         mesh.getStartElementHandleIterator();
+       element_it != mesh.getEndElementHandleIterator();
+       ++element_it )
+  {
+    d_mesh_flux_estimator->getEntityBinProcessedData( *element_it,
+                                                      mean,
+                                                      relative_error,
+                                                      vov,
+                                                      fom );
+
+    for( size_t i = 0; i < number_of_bins; ++i )
+    {
+      if( this->isFluxEstimateUsable( mean[i], relative_error[i] ) )
+      {
+        if( mean[i] > max_fluxes[i] )
+          max_fluxes[i] = mean[i];
+      }
+    }
+  }
+}
+
+// Check if a flux estimate is usable
+bool WeightWindowMeshGenerator::isFluxEstimateUsable(
+                                          const double mean,
+                                          const double relative_error ) const
+{
+  return mean > 0.0 && relative_error <= d_max_relative_error;
+}
+
+} // end MonteCarlo namespace
+
+EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo::WeightWindowMeshGenerator );
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_WeightWindowMeshGenerator.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,162 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_WeightWindowMeshGenerator.hpp
+//! \author Alex Robinson
+//! \brief  Weight window mesh generator class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_WEIGHT_WINDOW_MESH_GENERATOR_HPP
+#define MONTE_CARLO_WEIGHT_WINDOW_MESH_GENERATOR_HPP
+
+// Std Lib Includes
+#include <memory>
+
+// Boost Includes
+#include <boost/filesystem/path.hpp>
+#include <boost/serialization/access.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_WeightWindowMesh.hpp"
+#include "MonteCarlo_Estimator.hpp"
+#include "Utility_Communicator.hpp"
+#include "Utility_SerializationHelpers.hpp"
+
+namespace MonteCarlo{
+
+/*! The weight window mesh generator class
+ * \details The weight windows of a weight window mesh are iteratively
+ * generated from the forward flux estimated by a mesh flux estimator
+ * (MAGIC method). The mesh of the estimator must be the mesh of the weight
+ * window mesh and the estimator must have the same discretization as the
+ * weight window mesh. The lower weight of each mesh element and
+ * discretization bin is set to the estimated flux in the element and bin,
+ * divided by the max estimated flux in the bin (over all elements) and
+ * multiplied by the reference lower weight. The upper and survival weights
+ * are set using constant ratios to the lower weight. Only flux estimates
+ * with a relative error less than or equal to the max relative error are
+ * used. Mesh element bins without a usable flux estimate keep their
+ * previous weight window. If there is no previous weight window, the
+ * window will be open (no population control will be done). The generator
+ * can be archived with the simulation manager so that weight window
+ * generation continues after a restart.
+ */
+class WeightWindowMeshGenerator
+{
+
+public:
+
+  //! Constructor
+  WeightWindowMeshGenerator(
+                const std::shared_ptr<const Estimator>& mesh_flux_estimator,
+                const std::shared_ptr<WeightWindowMesh>& weight_window_mesh,
+                const double upper_to_lower_weight_ratio = 5.0,
+                const double survival_to_lower_weight_ratio = 3.0,
+                const double max_relative_error = 0.5 );
+
+  //! Destructor
+  ~WeightWindowMeshGenerator()
+  { /* ... */ }
+
+  //! Set the reference lower weight (lower weight where the flux is max)
+  void setReferenceLowerWeight( const double reference_lower_weight );
+
+  //! Return the reference lower weight
+  double getReferenceLowerWeight() const;
+
+  //! Return the upper weight to lower weight ratio
+  double getUpperToLowerWeightRatio() const;
+
+  //! Return the survival weight to lower weight ratio
+  double getSurvivalToLowerWeightRatio() const;
+
+  //! Return the max relative error of a usable flux estimate
+  double getMaxRelativeError() const;
+
+  //! Return the mesh flux estimator
+  const Estimator& getMeshFluxEstimator() const;
+
+  //! Return the weight window mesh
+  std::shared_ptr<const WeightWindowMesh> getWeightWindowMesh() const;
+
+  //! Return the number of weight window updates that have been done
+  size_t getNumberOfUpdates() const;
+
+  //! Update the weight windows using the current flux estimates
+  void updateWeightWindows();
+
+  //! Broadcast the weight windows from the root process to all processes
+  void broadcastWeightWindows( const Utility::Communicator& comm,
+                               const int root_process );
+
+  //! Export the weight window mesh
+  void exportWeightWindowMesh(
+                 const boost::filesystem::path& archive_name_with_path ) const;
+
+private:
+
+  // Default constructor
+  WeightWindowMeshGenerator();
+
+  // Check if any flux has been estimated
+  bool hasFluxBeenEstimated() const;
+
+  // Calculate the max usable flux estimate in each discretization bin
+  void calculateMaxFluxes( std::vector<double>& max_fluxes ) const;
+
+  // Check if a flux estimate is usable
+  bool isFluxEstimateUsable( const double mean,
+                             const double relative_error ) const;
+
+  // The mesh flux estimator
+  std::shared_ptr<const Estimator> d_mesh_flux_estimator;
+
+  // The weight window mesh
+  std::shared_ptr<WeightWindowMesh> d_weight_window_mesh;
+
+  // The upper weight to lower weight ratio
+  double d_upper_to_lower_weight_ratio;
+
+  // The survival weight to lower weight ratio
+  double d_survival_to_lower_weight_ratio;
+
+  // The max relative error of a usable flux estimate
+  double d_max_relative_error;
+
+  // The reference lower weight
+  double d_reference_lower_weight;
+
+  // The number of weight window updates
+  size_t d_number_of_updates;
+
+  // Serialize the generator data
+  template<typename Archive>
+  void serialize( Archive& ar, const unsigned version );
+
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+};
+
+// Serialize the generator data
+template<typename Archive>
+void WeightWindowMeshGenerator::serialize( Archive& ar, const unsigned version )
+{
+  ar & BOOST_SERIALIZATION_NVP( d_mesh_flux_estimator );
+  ar & BOOST_SERIALIZATION_NVP( d_weight_window_mesh );
+  ar & BOOST_SERIALIZATION_NVP( d_upper_to_lower_weight_ratio );
+  ar & BOOST_SERIALIZATION_NVP( d_survival_to_lower_weight_ratio );
+  ar & BOOST_SERIALIZATION_NVP( d_max_relative_error );
+  ar & BOOST_SERIALIZATION_NVP( d_reference_lower_weight );
+  ar & BOOST_SERIALIZATION_NVP( d_number_of_updates );
+}
+
+} // end MonteCarlo namespace
+
+BOOST_SERIALIZATION_CLASS_VERSION( WeightWindowMeshGenerator, MonteCarlo, 0 );
+EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, WeightWindowMeshGenerator );
+
+#endif // end MONTE_CARLO_WEIGHT_WINDOW_MESH_GENERATOR_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_WeightWindowMeshGenerator.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,390 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstCADISGenerator.cpp
+//! \author Alex Robinson
+//! \brief  CADISGenerator test
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <memory>
+
+// FRENSIE Includes
+#include "MonteCarlo_CADISGenerator.hpp"
+#include "MonteCarlo_CADISParticleDistribution.hpp"
+#include "MonteCarlo_StandardParticleDistribution.hpp"
+#include "MonteCarlo_MeshTrackLengthFluxEstimator.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+#include "Utility_StructuredHexMesh.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+std::shared_ptr<const Utility::Mesh> hex_mesh;
+
+std::shared_ptr<MonteCarlo::MeshTrackLengthFluxEstimator<MonteCarlo::WeightMultiplier> > estimator;
+
+std::vector<double> energy_bin_boundaries( {0.0, 1.0, 2.0} );
+
+MonteCarlo::CADISGenerator::MeshElementBinValueMap forward_source_strengths;
+
+// The element handles of the mesh (lower x element, upper x element)
+Utility::Mesh::ElementHandle lower_element, upper_element;
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Score a single history in the estimator
+void scoreHistory()
+{
+  estimator->resetData();
+
+  MonteCarlo::PhotonState photon( 0 );
+  photon.setWeight( 1.0 );
+
+  // Energy bin 1: track length of 2 in lower element, 1 in upper element
+  photon.setEnergy( 1.5 );
+
+  double start_point_1[3] = {0.0, 0.5, 0.5};
+  double end_point_1[3] = {2.0, 0.5, 0.5};
+
+  estimator->updateFromGlobalParticleSubtrackEndingEvent( photon,
+                                                          start_point_1,
+                                                          end_point_1 );
+
+  double start_point_2[3] = {1.0, 0.5, 0.5};
+  double end_point_2[3] = {0.0, 0.5, 0.5};
+
+  estimator->updateFromGlobalParticleSubtrackEndingEvent( photon,
+                                                          start_point_2,
+                                                          end_point_2 );
+
+  // Energy bin 0: track length of 0.5 in lower element
+  photon.setEnergy( 0.5 );
+
+  double start_point_3[3] = {0.0, 0.5, 0.5};
+  double end_point_3[3] = {0.5, 0.5, 0.5};
+
+  estimator->updateFromGlobalParticleSubtrackEndingEvent( photon,
+                                                          start_point_3,
+                                                          end_point_3 );
+
+  estimator->commitHistoryContribution();
+
+  MonteCarlo::ParticleHistoryObserver::setNumberOfHistories( 1 );
+  MonteCarlo::ParticleHistoryObserver::setElapsedTime( 1.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the generator can be constructed
+FRENSIE_UNIT_TEST( CADISGenerator, constructor )
+{
+  scoreHistory();
+
+  std::unique_ptr<MonteCarlo::CADISGenerator> generator;
+
+  FRENSIE_REQUIRE_NO_THROW( generator.reset( new MonteCarlo::CADISGenerator( estimator, hex_mesh, energy_bin_boundaries, forward_source_strengths ) ) );
+
+  FRENSIE_CHECK( generator->getMesh().get() == hex_mesh.get() );
+  FRENSIE_CHECK_EQUAL( generator->getEnergyBinBoundaries(),
+                       energy_bin_boundaries );
+
+  // The upper element bin 0 adjoint flux is set to the min adjoint flux
+  const MonteCarlo::CADISGenerator::MeshElementBinValueMap& adjoint_fluxes =
+    generator->getAdjointFluxes();
+
+  FRENSIE_REQUIRE_EQUAL( adjoint_fluxes.size(), 2 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( adjoint_fluxes.find( lower_element )->second,
+                                   std::vector<double>( {0.5, 2.0} ),
+                                   1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( adjoint_fluxes.find( upper_element )->second,
+                                   std::vector<double>( {0.5, 1.0} ),
+                                   1e-15 );
+
+  // The forward source strengths sum to 2 and are normalized
+  FRENSIE_CHECK_FLOATING_EQUALITY( generator->getEstimatedResponse(),
+                                   0.75,
+                                   1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the generator cannot be constructed with bad input
+FRENSIE_UNIT_TEST( CADISGenerator, constructor_bad_input )
+{
+  scoreHistory();
+
+  // Energy bins that don't match the estimator
+  FRENSIE_CHECK_THROW( MonteCarlo::CADISGenerator( estimator, hex_mesh, std::vector<double>( {0.0, 2.0} ), forward_source_strengths ),
+                       std::runtime_error );
+
+  // Forward source strengths that don't match the energy bins
+  MonteCarlo::CADISGenerator::MeshElementBinValueMap
+    bad_forward_source_strengths;
+
+  bad_forward_source_strengths[lower_element] = std::vector<double>( 3, 1.0 );
+
+  FRENSIE_CHECK_THROW( MonteCarlo::CADISGenerator( estimator, hex_mesh, energy_bin_boundaries, bad_forward_source_strengths ),
+                       std::runtime_error );
+
+  // No forward source
+  FRENSIE_CHECK_THROW( MonteCarlo::CADISGenerator( estimator, hex_mesh, energy_bin_boundaries, MonteCarlo::CADISGenerator::MeshElementBinValueMap() ),
+                       std::runtime_error );
+
+  // No adjoint flux
+  estimator->resetData();
+
+  FRENSIE_CHECK_THROW( MonteCarlo::CADISGenerator( estimator, hex_mesh, energy_bin_boundaries, forward_source_strengths ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the biased source strengths can be returned
+FRENSIE_UNIT_TEST( CADISGenerator, getBiasedSourceStrengths )
+{
+  scoreHistory();
+
+  MonteCarlo::CADISGenerator generator( estimator, hex_mesh, energy_bin_boundaries, forward_source_strengths );
+
+  MonteCarlo::CADISGenerator::MeshElementBinValueMap biased_source_strengths;
+
+  generator.getBiasedSourceStrengths( biased_source_strengths );
+
+  FRENSIE_REQUIRE_EQUAL( biased_source_strengths.size(), 2 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( biased_source_strengths[lower_element],
+                                   std::vector<double>( {1.0/3, 0.0} ),
+                                   1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( biased_source_strengths[upper_element],
+                                   std::vector<double>( {0.0, 2.0/3} ),
+                                   1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the weight window mesh can be created
+FRENSIE_UNIT_TEST( CADISGenerator, createWeightWindowMesh )
+{
+  scoreHistory();
+
+  MonteCarlo::CADISGenerator generator( estimator, hex_mesh, energy_bin_boundaries, forward_source_strengths );
+
+  FRENSIE_CHECK_THROW( generator.createWeightWindowMesh( 1.0 ),
+                       std::runtime_error );
+
+  std::shared_ptr<MonteCarlo::WeightWindowMesh> weight_window_mesh =
+    generator.createWeightWindowMesh();
+
+  FRENSIE_CHECK( weight_window_mesh->getMesh().get() == hex_mesh.get() );
+  FRENSIE_CHECK_EQUAL( weight_window_mesh->getNumberOfBins(), 2 );
+
+  const std::unordered_map<Utility::Mesh::ElementHandle,std::vector<MonteCarlo::WeightWindow> >&
+    weight_window_map = weight_window_mesh->getWeightWindowMap();
+
+  FRENSIE_REQUIRE_EQUAL( weight_window_map.size(), 2 );
+
+  const std::vector<MonteCarlo::WeightWindow>& lower_element_windows =
+    weight_window_map.find( lower_element )->second;
+
+  FRENSIE_REQUIRE_EQUAL( lower_element_windows.size(), 2 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( lower_element_windows[0].lower_weight, 0.5, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( lower_element_windows[0].survival_weight, 1.5, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( lower_element_windows[0].upper_weight, 2.5, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( lower_element_windows[1].lower_weight, 0.125, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( lower_element_windows[1].survival_weight, 0.375, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( lower_element_windows[1].upper_weight, 0.625, 1e-15 );
+
+  const std::vector<MonteCarlo::WeightWindow>& upper_element_windows =
+    weight_window_map.find( upper_element )->second;
+
+  FRENSIE_REQUIRE_EQUAL( upper_element_windows.size(), 2 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( upper_element_windows[0].lower_weight, 0.5, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( upper_element_windows[0].survival_weight, 1.5, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( upper_element_windows[0].upper_weight, 2.5, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( upper_element_windows[1].lower_weight, 0.25, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( upper_element_windows[1].survival_weight, 0.75, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( upper_element_windows[1].upper_weight, 1.25, 1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the importance mesh can be created
+FRENSIE_UNIT_TEST( CADISGenerator, createImportanceMesh )
+{
+  scoreHistory();
+
+  MonteCarlo::CADISGenerator generator( estimator, hex_mesh, energy_bin_boundaries, forward_source_strengths );
+
+  std::shared_ptr<MonteCarlo::ImportanceMesh> importance_mesh =
+    generator.createImportanceMesh();
+
+  FRENSIE_CHECK( importance_mesh->getMesh().get() == hex_mesh.get() );
+  FRENSIE_CHECK_EQUAL( importance_mesh->getNumberOfBins(), 2 );
+
+  const std::unordered_map<Utility::Mesh::ElementHandle,std::vector<double> >&
+    importance_map = importance_mesh->getImportanceMap();
+
+  FRENSIE_REQUIRE_EQUAL( importance_map.size(), 2 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( importance_map.find( lower_element )->second,
+                                   std::vector<double>( {2.0/3, 8.0/3} ),
+                                   1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( importance_map.find( upper_element )->second,
+                                   std::vector<double>( {2.0/3, 4.0/3} ),
+                                   1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the CADIS particle distribution can be created
+FRENSIE_UNIT_TEST( CADISGenerator, createBiasedParticleDistribution )
+{
+  scoreHistory();
+
+  MonteCarlo::CADISGenerator generator( estimator, hex_mesh, energy_bin_boundaries, forward_source_strengths );
+
+  std::shared_ptr<const MonteCarlo::ParticleDistribution>
+    unbiased_distribution( new MonteCarlo::StandardParticleDistribution( "unbiased" ) );
+
+  std::shared_ptr<MonteCarlo::ParticleDistribution> biased_distribution =
+    generator.createBiasedParticleDistribution( "biased",
+                                                unbiased_distribution );
+
+  FRENSIE_CHECK_EQUAL( biased_distribution->getName(), "biased" );
+
+  std::shared_ptr<const MonteCarlo::CADISParticleDistribution>
+    cadis_distribution =
+    std::dynamic_pointer_cast<const MonteCarlo::CADISParticleDistribution>( biased_distribution );
+
+  FRENSIE_REQUIRE( cadis_distribution.get() != NULL );
+
+  // The birth weights are the normalized forward source strengths divided
+  // by the biased source strengths
+  FRENSIE_CHECK_FLOATING_EQUALITY( cadis_distribution->getBirthWeight( lower_element, 0 ),
+                                   1.5,
+                                   1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( cadis_distribution->getBirthWeight( upper_element, 1 ),
+                                   0.75,
+                                   1e-15 );
+  FRENSIE_CHECK_EQUAL( cadis_distribution->getBirthWeight( lower_element, 1 ),
+                       0.0 );
+  FRENSIE_CHECK_EQUAL( cadis_distribution->getBirthWeight( upper_element, 0 ),
+                       0.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the birth weights are the weight window centers when the
+// forward source strengths are not normalized
+FRENSIE_UNIT_TEST( CADISGenerator, birth_weights_match_weight_windows )
+{
+  scoreHistory();
+
+  MonteCarlo::CADISGenerator::MeshElementBinValueMap
+    unnormalized_source_strengths;
+
+  unnormalized_source_strengths[lower_element] =
+    std::vector<double>( {3.0, 1.0} );
+  unnormalized_source_strengths[upper_element] =
+    std::vector<double>( {0.0, 6.0} );
+
+  MonteCarlo::CADISGenerator generator( estimator, hex_mesh, energy_bin_boundaries, unnormalized_source_strengths );
+
+  std::shared_ptr<const MonteCarlo::ParticleDistribution>
+    unbiased_distribution( new MonteCarlo::StandardParticleDistribution( "unbiased" ) );
+
+  std::shared_ptr<const MonteCarlo::CADISParticleDistribution>
+    cadis_distribution =
+    std::dynamic_pointer_cast<const MonteCarlo::CADISParticleDistribution>(
+        generator.createBiasedParticleDistribution( "biased",
+                                                    unbiased_distribution ) );
+
+  FRENSIE_REQUIRE( cadis_distribution.get() != NULL );
+
+  std::shared_ptr<MonteCarlo::WeightWindowMesh> weight_window_mesh =
+    generator.createWeightWindowMesh();
+
+  const std::unordered_map<Utility::Mesh::ElementHandle,std::vector<MonteCarlo::WeightWindow> >&
+    weight_window_map = weight_window_mesh->getWeightWindowMap();
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( cadis_distribution->getBirthWeight( lower_element, 0 ),
+                                   weight_window_map.find( lower_element )->second[0].survival_weight,
+                                   1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( cadis_distribution->getBirthWeight( lower_element, 1 ),
+                                   weight_window_map.find( lower_element )->second[1].survival_weight,
+                                   1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( cadis_distribution->getBirthWeight( upper_element, 1 ),
+                                   weight_window_map.find( upper_element )->second[1].survival_weight,
+                                   1e-15 );
+
+  // The birth weight is the normalized source strength divided by the
+  // biased source strength
+  MonteCarlo::CADISGenerator::MeshElementBinValueMap biased_source_strengths;
+
+  generator.getBiasedSourceStrengths( biased_source_strengths );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( cadis_distribution->getBirthWeight( lower_element, 0 ),
+                                   0.3/biased_source_strengths[lower_element][0],
+                                   1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( cadis_distribution->getBirthWeight( upper_element, 1 ),
+                                   0.6/biased_source_strengths[upper_element][1],
+                                   1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the FW-CADIS adjoint source strengths can be calculated
+FRENSIE_UNIT_TEST( CADISGenerator, calculateFWCADISAdjointSourceStrengths )
+{
+  scoreHistory();
+
+  MonteCarlo::CADISGenerator::MeshElementBinValueMap adjoint_source_strengths;
+
+  MonteCarlo::CADISGenerator::calculateFWCADISAdjointSourceStrengths(
+                                                   *estimator,
+                                                   *hex_mesh,
+                                                   adjoint_source_strengths );
+
+  FRENSIE_REQUIRE_EQUAL( adjoint_source_strengths.size(), 2 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( adjoint_source_strengths[lower_element],
+                                   std::vector<double>( {2.0, 0.5} ),
+                                   1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( adjoint_source_strengths[upper_element],
+                                   std::vector<double>( {0.0, 1.0} ),
+                                   1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // Set up a mesh with two elements
+  std::vector<double> x_planes( {0.0, 1.0, 2.0} ),
+    y_planes( {0.0, 1.0} ),
+    z_planes( {0.0, 1.0} );
+
+  hex_mesh.reset( new Utility::StructuredHexMesh( x_planes, y_planes, z_planes ) );
+
+  {
+    double lower_point[3] = {0.5, 0.5, 0.5};
+    double upper_point[3] = {1.5, 0.5, 0.5};
+
+    lower_element = hex_mesh->whichElementIsPointIn( lower_point );
+    upper_element = hex_mesh->whichElementIsPointIn( upper_point );
+  }
+
+  // Set up the adjoint mesh flux estimator
+  estimator.reset( new MonteCarlo::MeshTrackLengthFluxEstimator<MonteCarlo::WeightMultiplier>( 0, 1.0, hex_mesh ) );
+
+  estimator->setDiscretization<MonteCarlo::OBSERVER_ENERGY_DIMENSION>( energy_bin_boundaries );
+  estimator->setParticleTypes( std::vector<MonteCarlo::ParticleType>( 1, MonteCarlo::PHOTON ) );
+
+  // Set up the forward source strengths
+  forward_source_strengths[lower_element] = std::vector<double>( {1.0, 0.0} );
+  forward_source_strengths[upper_element] = std::vector<double>( {0.0, 1.0} );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstCADISGenerator.cpp
+//---------------------------------------------------------------------------//
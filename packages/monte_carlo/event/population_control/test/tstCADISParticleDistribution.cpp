@@ -0,0 +1,345 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstCADISParticleDistribution.cpp
+//! \author Alex Robinson
+//! \brief  CADISParticleDistribution test
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <memory>
+
+// FRENSIE Includes
+#include "MonteCarlo_CADISParticleDistribution.hpp"
+#include "MonteCarlo_StandardParticleDistribution.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+#include "Utility_StructuredHexMesh.hpp"
+#include "Utility_UniformDistribution.hpp"
+#include "Utility_ExponentialDistribution.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+#include "ArchiveTestHelpers.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+typedef TestArchiveHelper::TestArchives TestArchives;
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+std::shared_ptr<const Utility::StructuredHexMesh> hex_mesh;
+
+std::shared_ptr<const MonteCarlo::ParticleDistribution> unbiased_distribution;
+
+std::vector<double> energy_bin_boundaries( {0.0, 1.0, 2.0} );
+
+MonteCarlo::CADISParticleDistribution::MeshElementBinValueMap
+biased_source_strengths, birth_weights;
+
+// The element handles of the mesh (lower x element, upper x element)
+Utility::Mesh::ElementHandle lower_element, upper_element;
+
+std::shared_ptr<MonteCarlo::CADISParticleDistribution> distribution;
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the distribution cannot be constructed with bad input
+FRENSIE_UNIT_TEST( CADISParticleDistribution, constructor_bad_input )
+{
+  // Biased source strengths that don't match the energy bins
+  MonteCarlo::CADISParticleDistribution::MeshElementBinValueMap
+    bad_values;
+
+  bad_values[lower_element] = std::vector<double>( 3, 1.0 );
+
+  FRENSIE_CHECK_THROW( MonteCarlo::CADISParticleDistribution( "test", unbiased_distribution, hex_mesh, energy_bin_boundaries, bad_values, birth_weights ),
+                       std::runtime_error );
+
+  // Birth weights that don't match the energy bins
+  FRENSIE_CHECK_THROW( MonteCarlo::CADISParticleDistribution( "test", unbiased_distribution, hex_mesh, energy_bin_boundaries, biased_source_strengths, bad_values ),
+                       std::runtime_error );
+
+  // No positive biased source strengths
+  bad_values[lower_element] = std::vector<double>( 2, 0.0 );
+
+  FRENSIE_CHECK_THROW( MonteCarlo::CADISParticleDistribution( "test", unbiased_distribution, hex_mesh, energy_bin_boundaries, bad_values, birth_weights ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the birth weights can be returned
+FRENSIE_UNIT_TEST( CADISParticleDistribution, getBirthWeight )
+{
+  FRENSIE_CHECK_EQUAL( distribution->getBirthWeight( lower_element, 0 ), 2.0 );
+  FRENSIE_CHECK_EQUAL( distribution->getBirthWeight( upper_element, 1 ), 0.5 );
+
+  // Pairs that are never sampled have a birth weight of zero
+  FRENSIE_CHECK_EQUAL( distribution->getBirthWeight( lower_element, 1 ), 0.0 );
+  FRENSIE_CHECK_EQUAL( distribution->getBirthWeight( upper_element, 0 ), 0.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the dimension distribution type names can be returned
+FRENSIE_UNIT_TEST( CADISParticleDistribution,
+                   getDimensionDistributionTypeName )
+{
+  FRENSIE_CHECK_EQUAL( distribution->getDimensionDistributionTypeName( MonteCarlo::PRIMARY_SPATIAL_DIMENSION ),
+                       "CADIS Joint Space-Energy Distribution" );
+  FRENSIE_CHECK_EQUAL( distribution->getDimensionDistributionTypeName( MonteCarlo::ENERGY_DIMENSION ),
+                       "CADIS Joint Space-Energy Distribution" );
+  FRENSIE_CHECK_EQUAL( distribution->getDimensionDistributionTypeName( MonteCarlo::TIME_DIMENSION ),
+                       unbiased_distribution->getDimensionDistributionTypeName( MonteCarlo::TIME_DIMENSION ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check if the distribution is spatially uniform
+FRENSIE_UNIT_TEST( CADISParticleDistribution, isSpatiallyUniform )
+{
+  FRENSIE_CHECK( !distribution->isSpatiallyUniform() );
+}
+
+//---------------------------------------------------------------------------//
+// Check if the distribution is directionally uniform
+FRENSIE_UNIT_TEST( CADISParticleDistribution, isDirectionallyUniform )
+{
+  FRENSIE_CHECK_EQUAL( distribution->isDirectionallyUniform(),
+                       unbiased_distribution->isDirectionallyUniform() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the distribution is zero outside of the mesh and energy bins
+FRENSIE_UNIT_TEST( CADISParticleDistribution, evaluate )
+{
+  MonteCarlo::PhotonState photon( 0 );
+  photon.setPosition( 3.0, 0.5, 0.5 );
+  photon.setEnergy( 0.5 );
+
+  FRENSIE_CHECK_EQUAL( distribution->evaluate( photon ), 0.0 );
+
+  photon.setPosition( 0.5, 0.5, 0.5 );
+  photon.setEnergy( 3.0 );
+
+  FRENSIE_CHECK_EQUAL( distribution->evaluate( photon ), 0.0 );
+
+  // The (upper element, energy bin 0) pair is never sampled
+  photon.setPosition( 1.5, 0.5, 0.5 );
+  photon.setEnergy( 0.5 );
+
+  FRENSIE_CHECK_EQUAL( distribution->evaluate( photon ), 0.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the distribution can be sampled
+FRENSIE_UNIT_TEST( CADISParticleDistribution, sample )
+{
+  std::vector<double> fake_stream( 14 );
+  fake_stream[0] = 0.5; // azimuthal angle (unbiased)
+  fake_stream[1] = 0.5; // polar angle cosine (unbiased)
+  fake_stream[2] = 0.1; // (lower element, energy bin 0)
+  fake_stream[3] = 0.5; // x
+  fake_stream[4] = 0.5; // y
+  fake_stream[5] = 0.5; // z
+  fake_stream[6] = 0.5; // energy
+  fake_stream[7] = 0.5; // azimuthal angle (unbiased)
+  fake_stream[8] = 0.5; // polar angle cosine (unbiased)
+  fake_stream[9] = 0.5; // (upper element, energy bin 1)
+  fake_stream[10] = 0.0; // x
+  fake_stream[11] = 0.25; // y
+  fake_stream[12] = 0.75; // z
+  fake_stream[13] = 0.5; // energy
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  MonteCarlo::PhotonState photon( 0 );
+
+  distribution->sample( photon );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( photon.getXPosition(), 0.5, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( photon.getYPosition(), 0.5, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( photon.getZPosition(), 0.5, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( photon.getSourceEnergy(), 0.5, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( photon.getEnergy(), 0.5, 1e-15 );
+  FRENSIE_CHECK_EQUAL( photon.getSourceWeight(), 2.0 );
+  FRENSIE_CHECK_EQUAL( photon.getWeight(), 2.0 );
+
+  distribution->sample( photon );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( photon.getXPosition(), 1.0, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( photon.getYPosition(), 0.25, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( photon.getZPosition(), 0.75, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( photon.getSourceEnergy(), 1.5, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( photon.getEnergy(), 1.5, 1e-15 );
+  FRENSIE_CHECK_EQUAL( photon.getSourceWeight(), 0.5 );
+  FRENSIE_CHECK_EQUAL( photon.getWeight(), 0.5 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+}
+
+//---------------------------------------------------------------------------//
+// Check that the shape distributions can be set
+FRENSIE_UNIT_TEST( CADISParticleDistribution, setShapeDistribution )
+{
+  MonteCarlo::CADISParticleDistribution
+    shaped_distribution( "test",
+                         unbiased_distribution,
+                         hex_mesh,
+                         energy_bin_boundaries,
+                         biased_source_strengths,
+                         birth_weights );
+
+  // The energy shape is only nonzero in the upper half of each energy bin
+  std::shared_ptr<const Utility::UnivariateDistribution>
+    energy_shape( new Utility::UniformDistribution( 0.5, 2.0, 1.0 ) );
+
+  FRENSIE_REQUIRE_NO_THROW( shaped_distribution.setShapeDistribution(
+                                  MonteCarlo::ENERGY_DIMENSION, energy_shape ) );
+
+  std::vector<double> fake_stream( 7 );
+  fake_stream[0] = 0.5; // azimuthal angle (unbiased)
+  fake_stream[1] = 0.5; // polar angle cosine (unbiased)
+  fake_stream[2] = 0.1; // (lower element, energy bin 0)
+  fake_stream[3] = 0.5; // x
+  fake_stream[4] = 0.5; // y
+  fake_stream[5] = 0.5; // z
+  fake_stream[6] = 0.5; // energy
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  MonteCarlo::PhotonState photon( 0 );
+
+  shaped_distribution.sample( photon );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( photon.getEnergy(), 0.75, 1e-12 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+
+  // Only the spatial and energy dimensions have shape distributions
+  FRENSIE_CHECK_THROW( shaped_distribution.setShapeDistribution(
+                                   MonteCarlo::TIME_DIMENSION, energy_shape ),
+                       std::runtime_error );
+
+  // Only tabular shape distributions are supported
+  std::shared_ptr<const Utility::UnivariateDistribution>
+    exponential_shape( new Utility::ExponentialDistribution( 1.0, 1.0, 0.0, 2.0 ) );
+
+  FRENSIE_CHECK_THROW( shaped_distribution.setShapeDistribution(
+                             MonteCarlo::ENERGY_DIMENSION, exponential_shape ),
+                       std::runtime_error );
+
+  // The shape distribution must be nonzero in every sampled pair
+  std::shared_ptr<const Utility::UnivariateDistribution>
+    narrow_shape( new Utility::UniformDistribution( 0.0, 1.0, 1.0 ) );
+
+  FRENSIE_CHECK_THROW( shaped_distribution.setShapeDistribution(
+                         MonteCarlo::PRIMARY_SPATIAL_DIMENSION, narrow_shape ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the distribution can be archived
+FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( CADISParticleDistribution,
+                                   archive,
+                                   TestArchives )
+{
+  FETCH_TEMPLATE_PARAM( 0, RawOArchive );
+  FETCH_TEMPLATE_PARAM( 1, RawIArchive );
+
+  typedef typename std::remove_pointer<RawOArchive>::type OArchive;
+  typedef typename std::remove_pointer<RawIArchive>::type IArchive;
+
+  std::string archive_base_name( "test_cadis_particle_distribution" );
+  std::ostringstream archive_ostream;
+
+  {
+    std::unique_ptr<OArchive> oarchive;
+
+    createOArchive( archive_base_name, archive_ostream, oarchive );
+
+    std::shared_ptr<const MonteCarlo::ParticleDistribution>
+      base_distribution = distribution;
+
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( base_distribution ) );
+  }
+
+  // Copy the archive ostream to an istream
+  std::istringstream archive_istream( archive_ostream.str() );
+
+  // Load the archived distribution
+  std::unique_ptr<IArchive> iarchive;
+
+  createIArchive( archive_istream, iarchive );
+
+  std::shared_ptr<const MonteCarlo::ParticleDistribution> base_distribution;
+
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( base_distribution ) );
+
+  iarchive.reset();
+
+  std::shared_ptr<const MonteCarlo::CADISParticleDistribution>
+    loaded_distribution =
+    std::dynamic_pointer_cast<const MonteCarlo::CADISParticleDistribution>( base_distribution );
+
+  FRENSIE_REQUIRE( loaded_distribution.get() != NULL );
+  FRENSIE_CHECK_EQUAL( loaded_distribution->getName(), "test" );
+  FRENSIE_CHECK_EQUAL( loaded_distribution->getBirthWeight( lower_element, 0 ),
+                       2.0 );
+  FRENSIE_CHECK_EQUAL( loaded_distribution->getBirthWeight( upper_element, 1 ),
+                       0.5 );
+  FRENSIE_CHECK_EQUAL( loaded_distribution->getBirthWeight( lower_element, 1 ),
+                       0.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // Set up a mesh with two elements
+  std::vector<double> x_planes( {0.0, 1.0, 2.0} ),
+    y_planes( {0.0, 1.0} ),
+    z_planes( {0.0, 1.0} );
+
+  hex_mesh.reset( new Utility::StructuredHexMesh( x_planes, y_planes, z_planes ) );
+
+  {
+    double lower_point[3] = {0.5, 0.5, 0.5};
+    double upper_point[3] = {1.5, 0.5, 0.5};
+
+    lower_element = hex_mesh->whichElementIsPointIn( lower_point );
+    upper_element = hex_mesh->whichElementIsPointIn( upper_point );
+  }
+
+  // Set up the unbiased (isotropic point) distribution
+  unbiased_distribution.reset(
+                 new MonteCarlo::StandardParticleDistribution( "unbiased" ) );
+
+  // Set up the biased source strengths (cdf: 0.25, 1.0)
+  biased_source_strengths[lower_element] = std::vector<double>( {1.0, 0.0} );
+  biased_source_strengths[upper_element] = std::vector<double>( {0.0, 3.0} );
+
+  birth_weights[lower_element] = std::vector<double>( {2.0, 1.0} );
+  birth_weights[upper_element] = std::vector<double>( {1.0, 0.5} );
+
+  distribution.reset( new MonteCarlo::CADISParticleDistribution(
+                                                   "test",
+                                                   unbiased_distribution,
+                                                   hex_mesh,
+                                                   energy_bin_boundaries,
+                                                   biased_source_strengths,
+                                                   birth_weights ) );
+
+  // Initialize the random number generator
+  Utility::RandomNumberGenerator::createStreams();
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstCADISParticleDistribution.cpp
+//---------------------------------------------------------------------------//
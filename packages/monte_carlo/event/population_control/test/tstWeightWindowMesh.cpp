@@ -8,6 +8,7 @@
 
 // std includes
 #include <memory>
+#include <limits>
 
 // FRENSIE Includes
 #include "MonteCarlo_WeightWindow.hpp"
@@ -50,6 +51,92 @@ FRENSIE_UNIT_TEST( WeightWindowMesh, getWeightWindow )
   FRENSIE_CHECK_EQUAL(weight_window.survival_weight, 6.0001);
 }
 
+//---------------------------------------------------------------------------//
+// Check that the mesh element of a particle is cached
+FRENSIE_UNIT_TEST( WeightWindowMesh, getWeightWindow_cached_element )
+{
+  MonteCarlo::PhotonState photon(0);
+
+  photon.setEnergy( 1.0 );
+  photon.setPosition(0.5, 0.5, 0.5);
+
+  Utility::Mesh::ElementHandle cached_element;
+  size_t cached_element_index;
+
+  FRENSIE_CHECK( !photon.getCachedMeshElement( *weight_window_mesh->getMesh(), cached_element, cached_element_index ) );
+
+  FRENSIE_REQUIRE( weight_window_mesh->isParticleInWeightWindowDiscretization(photon) );
+
+  FRENSIE_REQUIRE( photon.getCachedMeshElement( *weight_window_mesh->getMesh(), cached_element, cached_element_index ) );
+  FRENSIE_CHECK_EQUAL( cached_element, 0 );
+  FRENSIE_CHECK_EQUAL( cached_element_index, 0 );
+
+  // Move the particle to the other mesh element
+  photon.setPosition(1.5, 0.5, 0.5);
+  photon.setEnergy( 0.01 );
+
+  FRENSIE_REQUIRE( weight_window_mesh->isParticleInWeightWindowDiscretization(photon) );
+
+  MonteCarlo::WeightWindow weight_window = weight_window_mesh->getWeightWindow(photon);
+
+  FRENSIE_CHECK_EQUAL(weight_window.lower_weight, 1e-6);
+  FRENSIE_CHECK_EQUAL(weight_window.upper_weight, 0.5);
+  FRENSIE_CHECK_EQUAL(weight_window.survival_weight, 0.49);
+
+  FRENSIE_REQUIRE( photon.getCachedMeshElement( *weight_window_mesh->getMesh(), cached_element, cached_element_index ) );
+  FRENSIE_CHECK_EQUAL( cached_element, 1 );
+  FRENSIE_CHECK_EQUAL( cached_element_index, 1 );
+
+  // Particles outside of the mesh are not in the discretization
+  photon.setPosition(2.5, 0.5, 0.5);
+
+  FRENSIE_CHECK( !weight_window_mesh->isParticleInWeightWindowDiscretization(photon) );
+
+  // Particles outside of the energy bins are not in the discretization
+  photon.setPosition(0.5, 0.5, 0.5);
+  photon.setEnergy( 21.0 );
+
+  FRENSIE_CHECK( !weight_window_mesh->isParticleInWeightWindowDiscretization(photon) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that mesh elements without weight windows have open weight windows
+FRENSIE_UNIT_TEST( WeightWindowMesh, getWeightWindow_missing_element )
+{
+  std::vector<double> x_planes = {0, 1, 2};
+  std::vector<double> y_planes = {0, 1};
+  std::vector<double> z_planes = {0, 1};
+
+  std::shared_ptr<Utility::StructuredHexMesh> mesh = std::make_shared<Utility::StructuredHexMesh>(x_planes, y_planes, z_planes);
+
+  MonteCarlo::WeightWindowMesh local_weight_window_mesh;
+  local_weight_window_mesh.setMesh(mesh);
+
+  std::unordered_map<Utility::Mesh::ElementHandle, std::vector<MonteCarlo::WeightWindow>> weight_window_mesh_map;
+
+  MonteCarlo::WeightWindow weight_window = MonteCarlo::WeightWindow();
+  weight_window.lower_weight = 0.5;
+  weight_window.upper_weight = 2.5;
+  weight_window.survival_weight = 1.5;
+
+  weight_window_mesh_map.emplace(0, std::vector<MonteCarlo::WeightWindow>( 1, weight_window ));
+
+  local_weight_window_mesh.setWeightWindowMap(weight_window_mesh_map);
+
+  MonteCarlo::PhotonState photon(0);
+
+  photon.setEnergy( 1.0 );
+  photon.setPosition(0.5, 0.5, 0.5);
+
+  FRENSIE_CHECK_EQUAL(local_weight_window_mesh.getWeightWindow(photon).lower_weight, 0.5);
+
+  photon.setPosition(1.5, 0.5, 0.5);
+
+  FRENSIE_CHECK_EQUAL(local_weight_window_mesh.getWeightWindow(photon).lower_weight, 0.0);
+  FRENSIE_CHECK_EQUAL(local_weight_window_mesh.getWeightWindow(photon).upper_weight, std::numeric_limits<double>::max());
+}
+
+//---------------------------------------------------------------------------//
 FRENSIE_UNIT_TEST( WeightWindowMesh, checkParticleWithPopulationController_split)
 {
   MonteCarlo::PhotonState photon(0);
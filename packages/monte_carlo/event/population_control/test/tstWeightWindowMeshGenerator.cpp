@@ -0,0 +1,447 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstWeightWindowMeshGenerator.cpp
+//! \author Alex Robinson
+//! \brief  WeightWindowMeshGenerator test
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <memory>
+#include <limits>
+
+// FRENSIE Includes
+#include "MonteCarlo_WeightWindowMeshGenerator.hpp"
+#include "MonteCarlo_MeshTrackLengthFluxEstimator.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+#include "Utility_StructuredHexMesh.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+#include "ArchiveTestHelpers.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+typedef TestArchiveHelper::TestArchives TestArchives;
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+std::shared_ptr<const Utility::Mesh> hex_mesh;
+
+std::shared_ptr<MonteCarlo::MeshTrackLengthFluxEstimator<MonteCarlo::WeightMultiplier> > estimator;
+
+std::shared_ptr<MonteCarlo::WeightWindowMesh> weight_window_mesh;
+
+// The element handles of the mesh (lower x element, upper x element)
+Utility::Mesh::ElementHandle lower_element, upper_element;
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Score a single history in the estimator
+void scoreHistory()
+{
+  estimator->resetData();
+
+  MonteCarlo::PhotonState photon( 0 );
+  photon.setWeight( 1.0 );
+
+  // Energy bin 1: track length of 2 in lower element, 1 in upper element
+  photon.setEnergy( 1.5 );
+
+  double start_point_1[3] = {0.0, 0.5, 0.5};
+  double end_point_1[3] = {2.0, 0.5, 0.5};
+
+  estimator->updateFromGlobalParticleSubtrackEndingEvent( photon,
+                                                          start_point_1,
+                                                          end_point_1 );
+
+  double start_point_2[3] = {1.0, 0.5, 0.5};
+  double end_point_2[3] = {0.0, 0.5, 0.5};
+
+  estimator->updateFromGlobalParticleSubtrackEndingEvent( photon,
+                                                          start_point_2,
+                                                          end_point_2 );
+
+  // Energy bin 0: track length of 0.5 in lower element
+  photon.setEnergy( 0.5 );
+
+  double start_point_3[3] = {0.0, 0.5, 0.5};
+  double end_point_3[3] = {0.5, 0.5, 0.5};
+
+  estimator->updateFromGlobalParticleSubtrackEndingEvent( photon,
+                                                          start_point_3,
+                                                          end_point_3 );
+
+  estimator->commitHistoryContribution();
+
+  MonteCarlo::ParticleHistoryObserver::setNumberOfHistories( 1 );
+  MonteCarlo::ParticleHistoryObserver::setElapsedTime( 1.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the generator can be constructed
+FRENSIE_UNIT_TEST( WeightWindowMeshGenerator, constructor )
+{
+  std::unique_ptr<MonteCarlo::WeightWindowMeshGenerator> generator;
+
+  FRENSIE_REQUIRE_NO_THROW( generator.reset( new MonteCarlo::WeightWindowMeshGenerator( estimator, weight_window_mesh ) ) );
+
+  FRENSIE_CHECK_EQUAL( generator->getUpperToLowerWeightRatio(), 5.0 );
+  FRENSIE_CHECK_EQUAL( generator->getSurvivalToLowerWeightRatio(), 3.0 );
+  FRENSIE_CHECK_EQUAL( generator->getMaxRelativeError(), 0.5 );
+  FRENSIE_CHECK_EQUAL( generator->getReferenceLowerWeight(), 0.5 );
+  FRENSIE_CHECK_EQUAL( generator->getNumberOfUpdates(), 0 );
+  FRENSIE_CHECK_EQUAL( generator->getMeshFluxEstimator().getId(), 0 );
+  FRENSIE_CHECK( generator->getWeightWindowMesh().get() ==
+                 weight_window_mesh.get() );
+
+  // The survival weight ratio must be between 1 and the upper weight ratio
+  FRENSIE_CHECK_THROW( MonteCarlo::WeightWindowMeshGenerator( estimator, weight_window_mesh, 5.0, 6.0 ),
+                       std::runtime_error );
+
+  // The discretizations must match
+  std::shared_ptr<MonteCarlo::WeightWindowMesh>
+    coarse_weight_window_mesh( new MonteCarlo::WeightWindowMesh );
+  coarse_weight_window_mesh->setMesh( hex_mesh );
+
+  FRENSIE_CHECK_THROW( MonteCarlo::WeightWindowMeshGenerator( estimator, coarse_weight_window_mesh ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the reference lower weight can be set
+FRENSIE_UNIT_TEST( WeightWindowMeshGenerator, setReferenceLowerWeight )
+{
+  MonteCarlo::WeightWindowMeshGenerator generator( estimator,
+                                                   weight_window_mesh );
+
+  generator.setReferenceLowerWeight( 0.25 );
+
+  FRENSIE_CHECK_EQUAL( generator.getReferenceLowerWeight(), 0.25 );
+
+  FRENSIE_CHECK_THROW( generator.setReferenceLowerWeight( 0.0 ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the weight windows are not updated before the flux is estimated
+FRENSIE_UNIT_TEST( WeightWindowMeshGenerator, updateWeightWindows_no_flux )
+{
+  estimator->resetData();
+
+  std::shared_ptr<MonteCarlo::WeightWindowMesh>
+    local_weight_window_mesh( new MonteCarlo::WeightWindowMesh );
+  local_weight_window_mesh->setMesh( hex_mesh );
+  local_weight_window_mesh->setDiscretization<MonteCarlo::OBSERVER_ENERGY_DIMENSION>( std::vector<double>( {0.0, 1.0, 2.0} ) );
+
+  MonteCarlo::WeightWindowMeshGenerator generator( estimator,
+                                                   local_weight_window_mesh );
+
+  generator.updateWeightWindows();
+
+  FRENSIE_CHECK_EQUAL( generator.getNumberOfUpdates(), 0 );
+  FRENSIE_CHECK( local_weight_window_mesh->getWeightWindowMap().empty() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the weight windows can be updated
+FRENSIE_UNIT_TEST( WeightWindowMeshGenerator, updateWeightWindows )
+{
+  scoreHistory();
+
+  std::shared_ptr<MonteCarlo::WeightWindowMesh>
+    local_weight_window_mesh( new MonteCarlo::WeightWindowMesh );
+  local_weight_window_mesh->setMesh( hex_mesh );
+  local_weight_window_mesh->setDiscretization<MonteCarlo::OBSERVER_ENERGY_DIMENSION>( std::vector<double>( {0.0, 1.0, 2.0} ) );
+
+  MonteCarlo::WeightWindowMeshGenerator generator( estimator,
+                                                   local_weight_window_mesh );
+
+  generator.updateWeightWindows();
+
+  FRENSIE_CHECK_EQUAL( generator.getNumberOfUpdates(), 1 );
+
+  const std::unordered_map<Utility::Mesh::ElementHandle,std::vector<MonteCarlo::WeightWindow> >&
+    weight_window_map = local_weight_window_mesh->getWeightWindowMap();
+
+  FRENSIE_REQUIRE_EQUAL( weight_window_map.size(), 2 );
+  FRENSIE_REQUIRE_EQUAL( weight_window_map.at( lower_element ).size(), 2 );
+  FRENSIE_REQUIRE_EQUAL( weight_window_map.at( upper_element ).size(), 2 );
+
+  // Max flux in energy bin 0
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( lower_element )[0].lower_weight, 0.5, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( lower_element )[0].survival_weight, 1.5, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( lower_element )[0].upper_weight, 2.5, 1e-15 );
+
+  // Max flux in energy bin 1
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( lower_element )[1].lower_weight, 0.5, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( lower_element )[1].survival_weight, 1.5, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( lower_element )[1].upper_weight, 2.5, 1e-15 );
+
+  // No flux in energy bin 0 (open window)
+  FRENSIE_CHECK_EQUAL( weight_window_map.at( upper_element )[0].lower_weight, 0.0 );
+  FRENSIE_CHECK_EQUAL( weight_window_map.at( upper_element )[0].survival_weight, 0.0 );
+  FRENSIE_CHECK_EQUAL( weight_window_map.at( upper_element )[0].upper_weight,
+                       std::numeric_limits<double>::max() );
+
+  // Half of the max flux in energy bin 1
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( upper_element )[1].lower_weight, 0.25, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( upper_element )[1].survival_weight, 0.75, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( upper_element )[1].upper_weight, 1.25, 1e-15 );
+
+  // Check that particles in the open window are not changed
+  MonteCarlo::PhotonState photon( 0 );
+  photon.setEnergy( 0.5 );
+  photon.setPosition( 1.5, 0.5, 0.5 );
+  photon.setWeight( 1e-3 );
+
+  MonteCarlo::ParticleBank bank;
+
+  local_weight_window_mesh->checkParticleWithPopulationController( photon, bank );
+
+  FRENSIE_CHECK( !photon.isGone() );
+  FRENSIE_CHECK_EQUAL( photon.getWeight(), 1e-3 );
+  FRENSIE_CHECK_EQUAL( bank.size(), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the previous weight windows are kept when there is no flux
+FRENSIE_UNIT_TEST( WeightWindowMeshGenerator, updateWeightWindows_previous )
+{
+  scoreHistory();
+
+  std::unordered_map<Utility::Mesh::ElementHandle,std::vector<MonteCarlo::WeightWindow> >
+    previous_weight_window_map;
+
+  MonteCarlo::WeightWindow previous_weight_window;
+  previous_weight_window.lower_weight = 0.1;
+  previous_weight_window.survival_weight = 0.2;
+  previous_weight_window.upper_weight = 0.3;
+
+  previous_weight_window_map[lower_element].resize( 2, previous_weight_window );
+  previous_weight_window_map[upper_element].resize( 2, previous_weight_window );
+
+  std::shared_ptr<MonteCarlo::WeightWindowMesh>
+    local_weight_window_mesh( new MonteCarlo::WeightWindowMesh );
+  local_weight_window_mesh->setMesh( hex_mesh );
+  local_weight_window_mesh->setDiscretization<MonteCarlo::OBSERVER_ENERGY_DIMENSION>( std::vector<double>( {0.0, 1.0, 2.0} ) );
+  local_weight_window_mesh->setWeightWindowMap( previous_weight_window_map );
+
+  MonteCarlo::WeightWindowMeshGenerator generator( estimator,
+                                                   local_weight_window_mesh );
+
+  generator.setReferenceLowerWeight( 1.0 );
+  generator.updateWeightWindows();
+
+  const std::unordered_map<Utility::Mesh::ElementHandle,std::vector<MonteCarlo::WeightWindow> >&
+    weight_window_map = local_weight_window_mesh->getWeightWindowMap();
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( lower_element )[0].lower_weight, 1.0, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( lower_element )[1].lower_weight, 1.0, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( upper_element )[1].lower_weight, 0.5, 1e-15 );
+
+  FRENSIE_CHECK_EQUAL( weight_window_map.at( upper_element )[0].lower_weight, 0.1 );
+  FRENSIE_CHECK_EQUAL( weight_window_map.at( upper_element )[0].survival_weight, 0.2 );
+  FRENSIE_CHECK_EQUAL( weight_window_map.at( upper_element )[0].upper_weight, 0.3 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the weight windows can be exported and reused
+FRENSIE_UNIT_TEST( WeightWindowMeshGenerator, exportWeightWindowMesh )
+{
+  scoreHistory();
+
+  MonteCarlo::WeightWindowMeshGenerator generator( estimator,
+                                                   weight_window_mesh );
+
+  generator.updateWeightWindows();
+
+  FRENSIE_REQUIRE_NO_THROW( generator.exportWeightWindowMesh( "test_weight_window_mesh_generator.xml" ) );
+
+  std::unique_ptr<MonteCarlo::WeightWindowMesh> loaded_weight_window_mesh;
+
+  FRENSIE_REQUIRE_NO_THROW( loaded_weight_window_mesh.reset( new MonteCarlo::WeightWindowMesh( "test_weight_window_mesh_generator.xml" ) ) );
+
+  FRENSIE_CHECK_EQUAL( loaded_weight_window_mesh->getNumberOfBins(), 2 );
+  FRENSIE_CHECK_EQUAL( loaded_weight_window_mesh->getMesh()->getNumberOfElements(), 2 );
+
+  const std::unordered_map<Utility::Mesh::ElementHandle,std::vector<MonteCarlo::WeightWindow> >&
+    weight_window_map = loaded_weight_window_mesh->getWeightWindowMap();
+
+  FRENSIE_REQUIRE_EQUAL( weight_window_map.size(), 2 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( lower_element )[1].lower_weight, 0.5, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( upper_element )[1].lower_weight, 0.25, 1e-15 );
+
+  MonteCarlo::PhotonState photon( 0 );
+  photon.setEnergy( 1.5 );
+  photon.setPosition( 1.5, 0.5, 0.5 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( loaded_weight_window_mesh->getWeightWindow( photon ).upper_weight, 1.25, 1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the weight windows updated by the root process can be broadcast
+FRENSIE_UNIT_TEST( WeightWindowMeshGenerator, broadcastWeightWindows )
+{
+  std::shared_ptr<const Utility::Communicator> comm =
+    Utility::Communicator::getDefault();
+
+  // Only the root process has flux estimates (reduced estimator data)
+  if( comm->rank() == 0 )
+    scoreHistory();
+  else
+    estimator->resetData();
+
+  std::shared_ptr<MonteCarlo::WeightWindowMesh>
+    local_weight_window_mesh( new MonteCarlo::WeightWindowMesh );
+  local_weight_window_mesh->setMesh( hex_mesh );
+  local_weight_window_mesh->setDiscretization<MonteCarlo::OBSERVER_ENERGY_DIMENSION>( std::vector<double>( {0.0, 1.0, 2.0} ) );
+
+  MonteCarlo::WeightWindowMeshGenerator generator( estimator,
+                                                   local_weight_window_mesh );
+
+  if( comm->rank() == 0 )
+    generator.updateWeightWindows();
+
+  comm->barrier();
+
+  generator.broadcastWeightWindows( *comm, 0 );
+
+  FRENSIE_CHECK_EQUAL( generator.getNumberOfUpdates(), 1 );
+
+  const std::unordered_map<Utility::Mesh::ElementHandle,std::vector<MonteCarlo::WeightWindow> >&
+    weight_window_map = local_weight_window_mesh->getWeightWindowMap();
+
+  FRENSIE_REQUIRE_EQUAL( weight_window_map.size(), 2 );
+  FRENSIE_REQUIRE_EQUAL( weight_window_map.at( lower_element ).size(), 2 );
+  FRENSIE_REQUIRE_EQUAL( weight_window_map.at( upper_element ).size(), 2 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( lower_element )[0].lower_weight, 0.5, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( lower_element )[1].survival_weight, 1.5, 1e-15 );
+  FRENSIE_CHECK_EQUAL( weight_window_map.at( upper_element )[0].upper_weight,
+                       std::numeric_limits<double>::max() );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( upper_element )[1].lower_weight, 0.25, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( upper_element )[1].upper_weight, 1.25, 1e-15 );
+
+  // Check that the broadcast windows are used
+  MonteCarlo::PhotonState photon( 0 );
+  photon.setEnergy( 1.5 );
+  photon.setPosition( 1.5, 0.5, 0.5 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( local_weight_window_mesh->getWeightWindow( photon ).lower_weight, 0.25, 1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a generator can be archived
+FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( WeightWindowMeshGenerator,
+                                   archive,
+                                   TestArchives )
+{
+  FETCH_TEMPLATE_PARAM( 0, RawOArchive );
+  FETCH_TEMPLATE_PARAM( 1, RawIArchive );
+
+  typedef typename std::remove_pointer<RawOArchive>::type OArchive;
+  typedef typename std::remove_pointer<RawIArchive>::type IArchive;
+
+  std::string archive_base_name( "test_weight_window_mesh_generator" );
+  std::ostringstream archive_ostream;
+
+  {
+    std::unique_ptr<OArchive> oarchive;
+
+    createOArchive( archive_base_name, archive_ostream, oarchive );
+
+    std::shared_ptr<MonteCarlo::Estimator> estimator_archive_test = estimator;
+    std::shared_ptr<MonteCarlo::PopulationControl> population_control_archive_test =
+      weight_window_mesh;
+
+    std::shared_ptr<MonteCarlo::WeightWindowMeshGenerator>
+      generator_archive_test( new MonteCarlo::WeightWindowMeshGenerator(
+                                                estimator,
+                                                weight_window_mesh,
+                                                4.0,
+                                                2.0,
+                                                0.1 ) );
+    generator_archive_test->setReferenceLowerWeight( 0.25 );
+
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( estimator_archive_test ) );
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( population_control_archive_test ) );
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( generator_archive_test ) );
+  }
+
+  // Copy the archive ostream to an istream
+  std::istringstream archive_istream( archive_ostream.str() );
+
+  // Load the archived objects
+  std::unique_ptr<IArchive> iarchive;
+
+  createIArchive( archive_istream, iarchive );
+
+  std::shared_ptr<MonteCarlo::Estimator> estimator_archive_test;
+  std::shared_ptr<MonteCarlo::PopulationControl> population_control_archive_test;
+  std::shared_ptr<MonteCarlo::WeightWindowMeshGenerator> generator_archive_test;
+
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( estimator_archive_test ) );
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( population_control_archive_test ) );
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( generator_archive_test ) );
+
+  iarchive.reset();
+
+  // The generator must share the loaded estimator and weight window mesh
+  FRENSIE_CHECK( &generator_archive_test->getMeshFluxEstimator() ==
+                 estimator_archive_test.get() );
+  FRENSIE_CHECK( generator_archive_test->getWeightWindowMesh().get() ==
+                 population_control_archive_test.get() );
+  FRENSIE_CHECK_EQUAL( generator_archive_test->getUpperToLowerWeightRatio(), 4.0 );
+  FRENSIE_CHECK_EQUAL( generator_archive_test->getSurvivalToLowerWeightRatio(), 2.0 );
+  FRENSIE_CHECK_EQUAL( generator_archive_test->getMaxRelativeError(), 0.1 );
+  FRENSIE_CHECK_EQUAL( generator_archive_test->getReferenceLowerWeight(), 0.25 );
+  FRENSIE_CHECK_EQUAL( generator_archive_test->getNumberOfUpdates(), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // Set up a mesh with two elements
+  std::vector<double> x_planes( {0.0, 1.0, 2.0} ),
+    y_planes( {0.0, 1.0} ),
+    z_planes( {0.0, 1.0} );
+
+  hex_mesh.reset( new Utility::StructuredHexMesh( x_planes, y_planes, z_planes ) );
+
+  {
+    double lower_point[3] = {0.5, 0.5, 0.5};
+    double upper_point[3] = {1.5, 0.5, 0.5};
+
+    lower_element = hex_mesh->whichElementIsPointIn( lower_point );
+    upper_element = hex_mesh->whichElementIsPointIn( upper_point );
+  }
+
+  std::vector<double> energy_bin_boundaries( {0.0, 1.0, 2.0} );
+
+  // Set up the mesh flux estimator
+  estimator.reset( new MonteCarlo::MeshTrackLengthFluxEstimator<MonteCarlo::WeightMultiplier>( 0, 1.0, hex_mesh ) );
+
+  estimator->setDiscretization<MonteCarlo::OBSERVER_ENERGY_DIMENSION>( energy_bin_boundaries );
+  estimator->setParticleTypes( std::vector<MonteCarlo::ParticleType>( 1, MonteCarlo::PHOTON ) );
+
+  // Set up the weight window mesh
+  weight_window_mesh.reset( new MonteCarlo::WeightWindowMesh );
+  weight_window_mesh->setMesh( hex_mesh );
+  weight_window_mesh->setDiscretization<MonteCarlo::OBSERVER_ENERGY_DIMENSION>( energy_bin_boundaries );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstWeightWindowMeshGenerator.cpp
+//---------------------------------------------------------------------------//
@@ -109,6 +109,9 @@ void BatchedDistributedStandardParticleSimulationManager<mode>::runSimulation()
   else
     this->resetData();
 
+  // All processes must use the weight windows updated by the root process
+  this->broadcastGeneratedWeightWindows( *d_comm, 0 );
+
   d_comm->barrier();
 
   // The simulation has started
@@ -385,6 +388,11 @@ void BatchedDistributedStandardParticleSimulationManager<mode>::rendezvous()
 
   if( d_comm->rank() == 0 )
     ParticleSimulationManager::rendezvous();
+  else
+    this->exportTransportProfile();
+
+  // All processes must use the weight windows updated by the root process
+  this->broadcastGeneratedWeightWindows( *d_comm, 0 );
 
   d_comm->barrier();
 }
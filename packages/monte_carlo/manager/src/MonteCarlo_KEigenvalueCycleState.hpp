@@ -0,0 +1,86 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_KEigenvalueCycleState.hpp
+//! \author Alex Robinson
+//! \brief  K-eigenvalue cycle state struct declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_K_EIGENVALUE_CYCLE_STATE_HPP
+#define MONTE_CARLO_K_EIGENVALUE_CYCLE_STATE_HPP
+
+// Std Lib Includes
+#include <algorithm>
+
+// Boost Includes
+#include <boost/serialization/access.hpp>
+
+// FRENSIE Includes
+#include "Utility_Vector.hpp"
+#include "Utility_SerializationHelpers.hpp"
+
+namespace MonteCarlo{
+
+/*! The k-eigenvalue cycle state
+ * \details This stores all of the k-eigenvalue simulation state that must
+ * survive a rendezvous so that a restarted simulation can resume at the
+ * next cycle. The fission source sites for the next cycle are stored in
+ * global (history) order as packed arrays of 8 doubles (see
+ * MonteCarlo::FissionSiteBank::FissionSite).
+ */
+struct KEigenvalueCycleState
+{
+  //! Constructor
+  KEigenvalueCycleState()
+    : cycle_k_eigenvalues(),
+      cycle_shannon_entropies(),
+      entropy_mesh_elements_per_dim( 1 ),
+      packed_source_sites()
+  {
+    std::fill( entropy_mesh_lower_bounds, entropy_mesh_lower_bounds+3, 0.0 );
+    std::fill( entropy_mesh_element_widths, entropy_mesh_element_widths+3, 1.0 );
+  }
+
+  //! The k-eigenvalue estimate of each completed cycle
+  std::vector<double> cycle_k_eigenvalues;
+
+  //! The fission source Shannon entropy of each completed cycle
+  std::vector<double> cycle_shannon_entropies;
+
+  //! The Shannon entropy mesh lower bounds
+  double entropy_mesh_lower_bounds[3];
+
+  //! The Shannon entropy mesh element widths
+  double entropy_mesh_element_widths[3];
+
+  //! The number of Shannon entropy mesh elements in each dimension
+  uint64_t entropy_mesh_elements_per_dim;
+
+  //! The packed fission source sites of the next cycle (global order)
+  std::vector<double> packed_source_sites;
+
+private:
+
+  // Serialize the state
+  template<typename Archive>
+  void serialize( Archive& ar, const unsigned version )
+  {
+    ar & BOOST_SERIALIZATION_NVP( cycle_k_eigenvalues );
+    ar & BOOST_SERIALIZATION_NVP( cycle_shannon_entropies );
+    ar & BOOST_SERIALIZATION_NVP( entropy_mesh_lower_bounds );
+    ar & BOOST_SERIALIZATION_NVP( entropy_mesh_element_widths );
+    ar & BOOST_SERIALIZATION_NVP( entropy_mesh_elements_per_dim );
+    ar & BOOST_SERIALIZATION_NVP( packed_source_sites );
+  }
+
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_K_EIGENVALUE_CYCLE_STATE_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_KEigenvalueCycleState.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,195 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_KEigenvalueParticleSimulationManager.hpp
+//! \author Alex Robinson
+//! \brief  K-eigenvalue particle simulation manager class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_K_EIGENVALUE_PARTICLE_SIMULATION_MANAGER_HPP
+#define MONTE_CARLO_K_EIGENVALUE_PARTICLE_SIMULATION_MANAGER_HPP
+
+// FRENSIE Includes
+#include "MonteCarlo_StandardParticleSimulationManager.hpp"
+#include "MonteCarlo_FissionSiteBank.hpp"
+#include "MonteCarlo_KEigenvalueCycleState.hpp"
+#include "Utility_Communicator.hpp"
+#include "Utility_Vector.hpp"
+
+namespace MonteCarlo{
+
+/*! The k-eigenvalue (criticality) particle simulation manager class
+ * \details The fission source is converged using power iteration. Each cycle
+ * simulates the number of histories per cycle that has been requested. The
+ * histories of a cycle are split into contiguous slices across the
+ * processes and each thread records fission sites in its own contiguous
+ * bank. The thread banks are concatenated in thread order, which (because
+ * of the static history schedule) is also history order. The fission sites
+ * are then resampled (systematic, weight based) to form the source for the
+ * next cycle. The resampling only requires the total fission site weight
+ * of each process - the sites themselves are only exchanged between
+ * processes that own overlapping slices of the global site ordering (no
+ * gathering at the root process). The cycle results are therefore
+ * independent of the number of threads and processes used. The systematic
+ * resampling offset is drawn from the random number stream of the last
+ * history of each cycle (no history number is consumed). Observer data
+ * is reset after the inactive cycles have been completed. A Shannon entropy
+ * of the fission source is computed each cycle on a uniform mesh that
+ * bounds the first generation of fission sites. The cycle results and the
+ * fission source of the next cycle are cached at each rendezvous so that a
+ * restarted simulation resumes at the next cycle. A rendezvous is done
+ * between cycles whenever the rendezvous batch size has been reached.
+ */
+template<ParticleModeType mode>
+class KEigenvalueParticleSimulationManager : public StandardParticleSimulationManager<mode>
+{
+
+public:
+
+  //! The fission site type
+  typedef FissionSiteBank::FissionSite FissionSite;
+
+  //! Constructor
+  KEigenvalueParticleSimulationManager(
+                 const std::string& simulation_name,
+                 const std::string& archive_type,
+                 const std::shared_ptr<const FilledGeometryModel>& model,
+                 const std::shared_ptr<ParticleSource>& source,
+                 const std::shared_ptr<EventHandler>& event_handler,
+                 const std::shared_ptr<PopulationControl> population_controller,
+                 const std::shared_ptr<const CollisionForcer> collision_forcer,
+                 const std::shared_ptr<const SimulationProperties>& properties,
+                 const uint64_t next_history,
+                 const uint64_t rendezvous_number,
+                 const bool use_single_rendezvous_file,
+                 const std::shared_ptr<const Utility::Communicator>& comm,
+                 const KEigenvalueCycleState& cycle_state =
+                 KEigenvalueCycleState() );
+
+  //! Destructor
+  ~KEigenvalueParticleSimulationManager()
+  { /* ... */ }
+
+  //! Run the simulation set up by the user
+  void runSimulation() final override;
+
+  //! Run the simulation set up by the user with the ability to interrupt
+  void runInterruptibleSimulation() final override;
+
+  //! Print the simulation data to the desired stream
+  void printSimulationSummary( std::ostream& os ) const final override;
+
+  //! Log the simulation data
+  void logSimulationSummary() const final override;
+
+  //! Return the number of completed cycles
+  size_t getNumberOfCompletedCycles() const;
+
+  //! Return the k-eigenvalue estimate of each completed cycle
+  const std::vector<double>& getCycleKEigenvalues() const;
+
+  //! Return the fission source Shannon entropy of each completed cycle
+  const std::vector<double>& getCycleShannonEntropies() const;
+
+  //! Return the mean k-eigenvalue of the completed active cycles
+  double getKEigenvalue() const;
+
+  //! Return the std. dev. of the mean k-eigenvalue of the active cycles
+  double getKEigenvalueStandardDeviation() const;
+
+protected:
+
+  //! Rendezvous (cache state)
+  void rendezvous() final override;
+
+  //! Return the k-eigenvalue cycle state that will be cached
+  const KEigenvalueCycleState* getKEigenvalueCycleState() const final override;
+
+private:
+
+  // Restore the cycle state of a restarted simulation
+  void restoreCycleState( const KEigenvalueCycleState& cycle_state );
+
+  // Update the cached cycle state (the root process gathers the fission
+  // source sites of every process)
+  void updateCachedCycleState();
+
+  // Simulate a cycle
+  void simulateCycle( const uint64_t cycle,
+                      FissionSiteBank& cycle_fission_bank );
+
+  // Simulate a fission source history
+  void simulateFissionSourceHistory( const FissionSite& site,
+                                     const uint64_t history,
+                                     ParticleBank& source_bank,
+                                     ParticleBank& bank );
+
+  // Initialize the Shannon entropy mesh
+  void initializeShannonEntropyMesh( const FissionSiteBank& fission_bank );
+
+  // Calculate the Shannon entropy of the fission sites
+  double calculateShannonEntropy( const FissionSiteBank& fission_bank ) const;
+
+  // Resample the fission sites to create the next cycle source
+  void resampleFissionSites( const FissionSiteBank& fission_bank,
+                             const double global_site_weight,
+                             const double sample_offset );
+
+  // Sample the systematic resampling offset of a cycle
+  double sampleResamplingOffset();
+
+  // Return the first global history index owned by a process
+  uint64_t getFirstGlobalHistoryIndex( const int process ) const;
+
+  // Log the cycle results
+  void logCycleResults( const uint64_t cycle ) const;
+
+  // The communicator
+  std::shared_ptr<const Utility::Communicator> d_comm;
+
+  // The number of histories per cycle
+  uint64_t d_histories_per_cycle;
+
+  // The number of inactive cycles
+  uint64_t d_inactive_cycles;
+
+  // The number of active cycles
+  uint64_t d_active_cycles;
+
+  // The fission source sites of this process for the next cycle
+  std::vector<FissionSite> d_source_sites;
+
+  // The Shannon entropy mesh lower bounds
+  double d_entropy_mesh_lower_bounds[3];
+
+  // The Shannon entropy mesh element widths
+  double d_entropy_mesh_element_widths[3];
+
+  // The number of Shannon entropy mesh elements in each dimension
+  size_t d_entropy_mesh_elements_per_dim;
+
+  // The k-eigenvalue estimate of each completed cycle
+  std::vector<double> d_cycle_k_eigenvalues;
+
+  // The fission source Shannon entropy of each completed cycle
+  std::vector<double> d_cycle_shannon_entropies;
+
+  // The cached cycle state (only complete on the root process)
+  KEigenvalueCycleState d_cached_cycle_state;
+};
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// Template Includes
+//---------------------------------------------------------------------------//
+
+#include "MonteCarlo_KEigenvalueParticleSimulationManager_def.hpp"
+
+//---------------------------------------------------------------------------//
+
+#endif // end MONTE_CARLO_K_EIGENVALUE_PARTICLE_SIMULATION_MANAGER_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_KEigenvalueParticleSimulationManager.hpp
+//---------------------------------------------------------------------------//
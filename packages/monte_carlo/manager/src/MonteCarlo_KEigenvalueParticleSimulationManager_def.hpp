@@ -0,0 +1,920 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_KEigenvalueParticleSimulationManager_def.hpp
+//! \author Alex Robinson
+//! \brief  K-eigenvalue particle simulation manager class definition
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_K_EIGENVALUE_PARTICLE_SIMULATION_MANAGER_DEF_HPP
+#define MONTE_CARLO_K_EIGENVALUE_PARTICLE_SIMULATION_MANAGER_DEF_HPP
+
+// Std Lib Includes
+#include <cmath>
+#include <array>
+#include <algorithm>
+#include <functional>
+
+// FRENSIE Includes
+#include "MonteCarlo_NeutronState.hpp"
+#include "MonteCarlo_UnresolvedResonanceProbabilityTable.hpp"
+#include "Utility_PerThread.hpp"
+#include "Utility_QuantityTraits.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_JustInTimeInitializer.hpp"
+#include "Utility_LoggingMacros.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+template<ParticleModeType mode>
+KEigenvalueParticleSimulationManager<mode>::KEigenvalueParticleSimulationManager(
+                 const std::string& simulation_name,
+                 const std::string& archive_type,
+                 const std::shared_ptr<const FilledGeometryModel>& model,
+                 const std::shared_ptr<ParticleSource>& source,
+                 const std::shared_ptr<EventHandler>& event_handler,
+                 const std::shared_ptr<PopulationControl> population_controller,
+                 const std::shared_ptr<const CollisionForcer> collision_forcer,
+                 const std::shared_ptr<const SimulationProperties>& properties,
+                 const uint64_t next_history,
+                 const uint64_t rendezvous_number,
+                 const bool use_single_rendezvous_file,
+                 const std::shared_ptr<const Utility::Communicator>& comm,
+                 const KEigenvalueCycleState& cycle_state )
+  : StandardParticleSimulationManager<mode>( simulation_name,
+                                             archive_type,
+                                             model,
+                                             source,
+                                             event_handler,
+                                             population_controller,
+                                             collision_forcer,
+                                             properties,
+                                             next_history,
+                                             rendezvous_number,
+                                             use_single_rendezvous_file ),
+    d_comm( comm ),
+    d_histories_per_cycle( properties->getNumberOfHistoriesPerCycle() ),
+    d_inactive_cycles( properties->getNumberOfInactiveCycles() ),
+    d_active_cycles( properties->getNumberOfActiveCycles() ),
+    d_source_sites(),
+    d_entropy_mesh_elements_per_dim( 1 ),
+    d_cycle_k_eigenvalues(),
+    d_cycle_shannon_entropies(),
+    d_cached_cycle_state( cycle_state )
+{
+  // Make sure that the communicator pointer is valid
+  testPrecondition( comm.get() );
+
+  // The fission sites are sent as arrays of doubles
+  static_assert( sizeof(FissionSite) == 8*sizeof(double),
+                 "The fission site must be a packed array of doubles!" );
+
+  // Make sure that the mode is compatible with neutrons
+  testStaticPrecondition( (mode == NEUTRON_MODE ||
+                           mode == NEUTRON_PHOTON_MODE ||
+                           mode == NEUTRON_PHOTON_ELECTRON_MODE) );
+
+  TEST_FOR_EXCEPTION( d_histories_per_cycle < (uint64_t)comm->size(),
+                      std::runtime_error,
+                      "The number of histories per cycle ("
+                      << d_histories_per_cycle << ") must be at least as "
+                      "large as the number of processes ("
+                      << comm->size() << ")!" );
+
+  std::fill( d_entropy_mesh_lower_bounds,
+             d_entropy_mesh_lower_bounds+3,
+             0.0 );
+
+  std::fill( d_entropy_mesh_element_widths,
+             d_entropy_mesh_element_widths+3,
+             1.0 );
+
+  d_cycle_k_eigenvalues.reserve( d_inactive_cycles+d_active_cycles );
+  d_cycle_shannon_entropies.reserve( d_inactive_cycles+d_active_cycles );
+
+  this->restoreCycleState( cycle_state );
+}
+
+// Restore the cycle state of a restarted simulation
+/*! \details Each process only keeps the cached fission source sites that
+ * belong to its history slice.
+ */
+template<ParticleModeType mode>
+void KEigenvalueParticleSimulationManager<mode>::restoreCycleState(
+                                     const KEigenvalueCycleState& cycle_state )
+{
+  TEST_FOR_EXCEPTION( cycle_state.cycle_k_eigenvalues.size() !=
+                      cycle_state.cycle_shannon_entropies.size(),
+                      std::runtime_error,
+                      "The cached k-eigenvalue cycle state is corrupt (the "
+                      "number of cycle k-eigenvalues ("
+                      << cycle_state.cycle_k_eigenvalues.size() << ") does "
+                      "not match the number of cycle Shannon entropies ("
+                      << cycle_state.cycle_shannon_entropies.size() << "))!" );
+
+  // A new simulation has no cycle state
+  if( cycle_state.cycle_k_eigenvalues.empty() )
+    return;
+
+  TEST_FOR_EXCEPTION( cycle_state.packed_source_sites.size() !=
+                      8*d_histories_per_cycle,
+                      std::runtime_error,
+                      "The cached fission source ("
+                      << cycle_state.packed_source_sites.size()/8 << " sites) "
+                      "is not compatible with the number of histories per "
+                      "cycle (" << d_histories_per_cycle << ")!" );
+
+  d_cycle_k_eigenvalues.assign( cycle_state.cycle_k_eigenvalues.begin(),
+                                cycle_state.cycle_k_eigenvalues.end() );
+
+  d_cycle_shannon_entropies.assign(
+                                 cycle_state.cycle_shannon_entropies.begin(),
+                                 cycle_state.cycle_shannon_entropies.end() );
+
+  std::copy( cycle_state.entropy_mesh_lower_bounds,
+             cycle_state.entropy_mesh_lower_bounds+3,
+             d_entropy_mesh_lower_bounds );
+
+  std::copy( cycle_state.entropy_mesh_element_widths,
+             cycle_state.entropy_mesh_element_widths+3,
+             d_entropy_mesh_element_widths );
+
+  d_entropy_mesh_elements_per_dim = cycle_state.entropy_mesh_elements_per_dim;
+
+  const uint64_t first_local_index =
+    this->getFirstGlobalHistoryIndex( d_comm->rank() );
+
+  const uint64_t end_local_index =
+    this->getFirstGlobalHistoryIndex( d_comm->rank()+1 );
+
+  d_source_sites.resize( end_local_index - first_local_index );
+
+  std::copy( cycle_state.packed_source_sites.data() + 8*first_local_index,
+             cycle_state.packed_source_sites.data() + 8*end_local_index,
+             reinterpret_cast<double*>( d_source_sites.data() ) );
+}
+
+// Run the simulation set up by the user with the ability to interrupt
+/*! \details Distributed simulations cannot be interrupted. The
+ * runSimulation method will be called after issuing a warning.
+ */
+template<ParticleModeType mode>
+void KEigenvalueParticleSimulationManager<mode>::runInterruptibleSimulation()
+{
+  if( d_comm->size() > 1 )
+  {
+    if( d_comm->rank() == 0 )
+    {
+      FRENSIE_LOG_WARNING( "Distributed simulations cannot be interrupted!" );
+    }
+
+    this->runSimulation();
+  }
+  else
+    ParticleSimulationManager::runInterruptibleSimulation();
+}
+
+// Run the simulation set up by the user
+/*! \details The first cycle is sampled from the particle source. Every
+ * subsequent cycle is sampled from the resampled fission sites of the
+ * previous cycle. Rendezvous are only done between cycles (once the
+ * rendezvous batch size has been reached) so that the cached state can
+ * always be used to restart the simulation at the next cycle.
+ */
+template<ParticleModeType mode>
+void KEigenvalueParticleSimulationManager<mode>::runSimulation()
+{
+  // Make sure that all objects are initialized before running the simulation
+  Utility::JustInTimeInitializer::getInstance().initializeObjectsAndClear();
+
+  d_comm->barrier();
+
+  if( d_comm->rank() == 0 )
+  {
+    FRENSIE_LOG_NOTIFICATION( "K-eigenvalue simulation started. " );
+    FRENSIE_FLUSH_ALL_LOGS();
+  }
+
+  // Enable thread support
+  this->enableThreadSupport();
+
+  // Conduct the first rendezvous (for caching only)
+  if( d_comm->rank() == 0 )
+    ParticleSimulationManager::rendezvous();
+
+  // Reset data on non-root processes to avoid double counting
+  else
+    this->resetData();
+
+  d_comm->barrier();
+
+  // All processes must use the weight windows updated by the root process
+  this->broadcastGeneratedWeightWindows( *d_comm, 0 );
+
+  // The simulation has started
+  this->registerSimulationStartedEvent();
+
+  const uint64_t total_cycles = d_inactive_cycles + d_active_cycles;
+
+  FissionSiteBank cycle_fission_bank;
+
+  uint64_t next_rendezvous_history =
+    this->getNextHistory() + this->getRendezvousBatchSize();
+
+  bool simulation_ended_early = false;
+
+  for( uint64_t cycle = d_cycle_k_eigenvalues.size();
+       cycle < total_cycles;
+       ++cycle )
+  {
+    this->simulateCycle( cycle, cycle_fission_bank );
+
+    this->logCycleResults( cycle );
+
+    // The inactive cycles are only used to converge the fission source
+    if( cycle+1 == d_inactive_cycles )
+      this->resetData();
+
+    // End the simulation if requested (from signal handler)
+    int end_simulation = (this->hasEndSimulationRequestBeenMade() ||
+                          this->hasExitSimulationRequestBeenMade());
+
+    if( d_comm->size() > 1 )
+      Utility::allReduce( *d_comm, end_simulation, Utility::maximum<int>() );
+
+    if( end_simulation )
+    {
+      simulation_ended_early = true;
+
+      break;
+    }
+
+    // Rendezvous (the final rendezvous is done after the last cycle)
+    if( next_rendezvous_history <= this->getNextHistory() &&
+        cycle+1 < total_cycles )
+    {
+      this->rendezvous();
+
+      next_rendezvous_history += this->getRendezvousBatchSize();
+    }
+  }
+
+  // Do the final rendezvous
+  this->rendezvous();
+
+  // The simulation has finished
+  this->registerSimulationStoppedEvent();
+
+  if( d_comm->rank() == 0 )
+  {
+    if( !simulation_ended_early )
+    {
+      FRENSIE_LOG_NOTIFICATION( "K-eigenvalue simulation finished. " );
+    }
+    else
+    {
+      FRENSIE_LOG_NOTIFICATION( "K-eigenvalue simulation terminated. " );
+    }
+
+    FRENSIE_FLUSH_ALL_LOGS();
+  }
+
+  d_comm->barrier();
+}
+
+// Return the first global history index owned by a process
+/*! \details The histories of a cycle are split into contiguous slices. The
+ * slice sizes differ by at most one history.
+ */
+template<ParticleModeType mode>
+inline uint64_t KEigenvalueParticleSimulationManager<mode>::getFirstGlobalHistoryIndex( const int process ) const
+{
+  return (d_histories_per_cycle*process)/d_comm->size();
+}
+
+// Simulate a cycle
+/*! \details Each thread records the fission sites of its histories in a
+ * separate bank. A static schedule assigns contiguous, ordered blocks of
+ * histories to the threads so concatenating the thread banks in thread order
+ * recovers the history order.
+ */
+template<ParticleModeType mode>
+void KEigenvalueParticleSimulationManager<mode>::simulateCycle(
+                                         const uint64_t cycle,
+                                         FissionSiteBank& cycle_fission_bank )
+{
+  const uint64_t first_local_index =
+    this->getFirstGlobalHistoryIndex( d_comm->rank() );
+
+  const uint64_t local_histories =
+    this->getFirstGlobalHistoryIndex( d_comm->rank()+1 ) - first_local_index;
+
+  const uint64_t first_history = this->getNextHistory() + first_local_index;
+
+  const bool sample_from_source = (cycle == 0 || d_source_sites.empty());
+
+  // Make sure that the fission source is consistent with the history slice
+  testInvariant( sample_from_source ||
+                 d_source_sites.size() == local_histories );
+
+  Utility::PerThread<FissionSiteBank>
+    thread_fission_banks( Utility::OpenMPProperties::getRequestedNumberOfThreads() );
+
+  #pragma omp parallel num_threads( Utility::OpenMPProperties::getRequestedNumberOfThreads() )
+  {
+    // Create a source bank for each thread (the fission bank is also used
+    // for all non-fission secondary particles)
+    ParticleBank source_bank;
+
+    FissionSiteBank& fission_bank = thread_fission_banks.local();
+
+    #pragma omp for schedule( static )
+    for( uint64_t i = 0; i < local_histories; ++i )
+    {
+      // Note: Conformal OpenMP code cannot have a break statement.
+      if( this->hasExitSimulationRequestBeenMade() )
+        continue;
+
+      if( sample_from_source )
+      {
+        this->simulateSourceHistory( source_bank,
+                                     fission_bank,
+                                     first_history+i );
+      }
+      else
+      {
+        this->simulateFissionSourceHistory( d_source_sites[i],
+                                            first_history+i,
+                                            source_bank,
+                                            fission_bank );
+      }
+    }
+  }
+
+  // Concatenate the thread fission banks in thread order
+  size_t local_sites = 0;
+
+  for( size_t i = 0; i < thread_fission_banks.size(); ++i )
+    local_sites += thread_fission_banks[i].getNumberOfSites();
+
+  cycle_fission_bank.clearSites();
+  cycle_fission_bank.reserveSites( local_sites );
+
+  for( size_t i = 0; i < thread_fission_banks.size(); ++i )
+    cycle_fission_bank.appendSites( thread_fission_banks[i] );
+
+  this->incrementNextHistory( d_histories_per_cycle );
+
+  const double resampling_offset = this->sampleResamplingOffset();
+
+  // Estimate k from the total fission site weight
+  double global_site_weight = cycle_fission_bank.getTotalSiteWeight();
+
+  if( d_comm->size() > 1 )
+  {
+    Utility::allReduce( *d_comm, global_site_weight, std::plus<double>() );
+  }
+
+  TEST_FOR_EXCEPTION( global_site_weight <= 0.0,
+                      std::runtime_error,
+                      "No fission sites were generated in cycle "
+                      << cycle << " - the k-eigenvalue simulation cannot "
+                      "continue!" );
+
+  d_cycle_k_eigenvalues.push_back( global_site_weight/d_histories_per_cycle );
+
+  // Calculate the Shannon entropy of the fission source
+  if( cycle == 0 )
+    this->initializeShannonEntropyMesh( cycle_fission_bank );
+
+  d_cycle_shannon_entropies.push_back(
+                        this->calculateShannonEntropy( cycle_fission_bank ) );
+
+  // Create the source for the next cycle
+  this->resampleFissionSites( cycle_fission_bank,
+                              global_site_weight,
+                              resampling_offset );
+}
+
+// Sample the systematic resampling offset of a cycle
+/*! \details The offset is drawn from the random number stream of the last
+ * history of the cycle so that no history number is consumed. Every process
+ * samples the same offset, which will also be reproduced by a restarted
+ * simulation. This must be called after the histories of the cycle have
+ * been counted.
+ */
+template<ParticleModeType mode>
+double KEigenvalueParticleSimulationManager<mode>::sampleResamplingOffset()
+{
+  Utility::RandomNumberGenerator::initialize( this->getNextHistory() - 1 );
+
+  return Utility::RandomNumberGenerator::getRandomNumber<double>();
+}
+
+// Simulate a fission source history
+template<ParticleModeType mode>
+void KEigenvalueParticleSimulationManager<mode>::simulateFissionSourceHistory(
+                                                    const FissionSite& site,
+                                                    const uint64_t history,
+                                                    ParticleBank& source_bank,
+                                                    ParticleBank& bank )
+{
+  // Initialize the random number generator for this history
+  Utility::RandomNumberGenerator::initialize( history );
+
+  // Reset the unresolved resonance band random number for this history
+  UnresolvedResonanceProbabilityTable::resetBandRandomNumber();
+
+  std::shared_ptr<NeutronState> neutron( new NeutronState( history ) );
+
+  try{
+    FRENSIE_PROFILE_TRANSPORT_STAGE( SOURCE_SAMPLING_STAGE );
+
+    neutron->setPosition( site.position );
+    neutron->setDirection( site.direction );
+    neutron->setSourceEnergy( site.energy );
+    neutron->setEnergy( site.energy );
+    neutron->setSourceWeight( site.weight );
+    neutron->setWeight( site.weight );
+
+    neutron->embedInModel( this->getModel() );
+    neutron->setSourceCell( neutron->getCell() );
+  }
+  catch( const std::exception& exception )
+  {
+    FRENSIE_LOG_NESTED_ERROR( "Unable to embed the fission source neutron "
+                              "of history " << history << " in the model: "
+                              << exception.what() );
+
+    return;
+  }
+
+  source_bank.push( neutron );
+
+  this->simulateBankedHistory( source_bank, bank );
+}
+
+// Initialize the Shannon entropy mesh
+/*! \details The mesh bounds the fission sites of the first cycle on all
+ * processes. The number of mesh elements is chosen so that there are
+ * approximately 20 fission sites per element.
+ */
+template<ParticleModeType mode>
+void KEigenvalueParticleSimulationManager<mode>::initializeShannonEntropyMesh(
+                                         const FissionSiteBank& fission_bank )
+{
+  std::array<double,3> lower_bounds, upper_bounds;
+  lower_bounds.fill( Utility::QuantityTraits<double>::max() );
+  upper_bounds.fill( -Utility::QuantityTraits<double>::max() );
+
+  const FissionSiteBank::FissionSiteContainerType& sites =
+    fission_bank.getSites();
+
+  for( size_t i = 0; i < sites.size(); ++i )
+  {
+    for( size_t d = 0; d < 3; ++d )
+    {
+      lower_bounds[d] = std::min( lower_bounds[d], sites[i].position[d] );
+      upper_bounds[d] = std::max( upper_bounds[d], sites[i].position[d] );
+    }
+  }
+
+  if( d_comm->size() > 1 )
+  {
+    Utility::allReduce( *d_comm, lower_bounds, Utility::minimum<double>() );
+    Utility::allReduce( *d_comm, upper_bounds, Utility::maximum<double>() );
+  }
+
+  d_entropy_mesh_elements_per_dim =
+    std::max( (size_t)std::ceil( std::cbrt( d_histories_per_cycle/20.0 ) ),
+              (size_t)1 );
+
+  for( size_t d = 0; d < 3; ++d )
+  {
+    d_entropy_mesh_lower_bounds[d] = lower_bounds[d];
+
+    double width = (upper_bounds[d] - lower_bounds[d])/
+      d_entropy_mesh_elements_per_dim;
+
+    // A flat dimension only needs a single (arbitrary) element width
+    d_entropy_mesh_element_widths[d] = (width > 0.0 ? width : 1.0);
+  }
+}
+
+// Calculate the Shannon entropy of the fission sites
+template<ParticleModeType mode>
+double KEigenvalueParticleSimulationManager<mode>::calculateShannonEntropy(
+                                   const FissionSiteBank& fission_bank ) const
+{
+  const size_t n = d_entropy_mesh_elements_per_dim;
+
+  std::vector<double> element_weights( n*n*n, 0.0 );
+
+  const FissionSiteBank::FissionSiteContainerType& sites =
+    fission_bank.getSites();
+
+  for( size_t i = 0; i < sites.size(); ++i )
+  {
+    size_t element_index = 0;
+
+    for( int d = 2; d >= 0; --d )
+    {
+      double index = std::floor( (sites[i].position[d] -
+                                  d_entropy_mesh_lower_bounds[d])/
+                                 d_entropy_mesh_element_widths[d] );
+
+      // Sites outside of the mesh are assigned to the nearest element
+      index = std::max( std::min( index, (double)(n-1) ), 0.0 );
+
+      element_index = element_index*n + (size_t)index;
+    }
+
+    element_weights[element_index] += sites[i].weight;
+  }
+
+  if( d_comm->size() > 1 )
+    Utility::allReduce( *d_comm, element_weights, std::plus<double>() );
+
+  double total_weight = 0.0;
+
+  for( size_t i = 0; i < element_weights.size(); ++i )
+    total_weight += element_weights[i];
+
+  double entropy = 0.0;
+
+  if( total_weight > 0.0 )
+  {
+    for( size_t i = 0; i < element_weights.size(); ++i )
+    {
+      if( element_weights[i] > 0.0 )
+      {
+        const double p = element_weights[i]/total_weight;
+
+        entropy -= p*std::log2( p );
+      }
+    }
+  }
+
+  return entropy;
+}
+
+// Resample the fission sites to create the next cycle source
+/*! \details Systematic (weight based) resampling is used: the global site
+ * ordering (process order, then history order) is mapped to a cumulative
+ * weight and sample i is the site containing the cumulative weight
+ * (i+u)W/N, where u is the random sample offset of the cycle. Every
+ * process can calculate the sample range of every other process from the
+ * total site weight of each process so only the processes whose sample
+ * ranges overlap the history slice of a process send sites to it. Each
+ * resampled site has a weight of one.
+ */
+template<ParticleModeType mode>
+void KEigenvalueParticleSimulationManager<mode>::resampleFissionSites(
+                                           const FissionSiteBank& fission_bank,
+                                           const double global_site_weight,
+                                           const double sample_offset )
+{
+  // Make sure that the sample offset is valid
+  testPrecondition( sample_offset >= 0.0 );
+  testPrecondition( sample_offset < 1.0 );
+
+  const int rank = d_comm->rank();
+  const int size = d_comm->size();
+  const double n = d_histories_per_cycle;
+
+  // Calculate the cumulative weight boundary of each process (identical on
+  // every process)
+  const double local_site_weight = fission_bank.getTotalSiteWeight();
+
+  std::vector<double> process_site_weights( 1, local_site_weight );
+
+  if( size > 1 )
+    Utility::allGather( *d_comm, local_site_weight, process_site_weights );
+
+  std::vector<double> process_weight_bounds( size+1, 0.0 );
+
+  for( int p = 0; p < size; ++p )
+  {
+    process_weight_bounds[p+1] =
+      process_weight_bounds[p] + process_site_weights[p];
+  }
+
+  process_weight_bounds.back() = global_site_weight;
+
+  // Return the first sample that lies at or above a cumulative weight
+  auto sample_bound = [&]( const double cumulative_weight ) -> uint64_t
+  {
+    double sample = std::ceil( cumulative_weight*n/global_site_weight - sample_offset );
+
+    return (uint64_t)std::max( std::min( sample, n ), 0.0 );
+  };
+
+  std::vector<uint64_t> process_sample_bounds( size+1 );
+
+  for( int p = 0; p <= size; ++p )
+    process_sample_bounds[p] = sample_bound( process_weight_bounds[p] );
+
+  // Select the local sites (in global sample order)
+  std::vector<FissionSite> selected_sites;
+  selected_sites.reserve( process_sample_bounds[rank+1] -
+                          process_sample_bounds[rank] );
+
+  {
+    const FissionSiteBank::FissionSiteContainerType& sites =
+      fission_bank.getSites();
+
+    const double upper_weight_bound = process_weight_bounds[rank+1];
+
+    double cumulative_weight = process_weight_bounds[rank];
+
+    for( size_t i = 0; i < sites.size(); ++i )
+    {
+      const uint64_t first_sample = sample_bound( cumulative_weight );
+
+      if( i+1 < sites.size() )
+      {
+        cumulative_weight = std::min( cumulative_weight + sites[i].weight,
+                                      upper_weight_bound );
+      }
+      else
+        cumulative_weight = upper_weight_bound;
+
+      const uint64_t end_sample = sample_bound( cumulative_weight );
+
+      for( uint64_t j = first_sample; j < end_sample; ++j )
+      {
+        selected_sites.push_back( sites[i] );
+        selected_sites.back().weight = 1.0;
+      }
+    }
+  }
+
+  // Make sure that the expected number of sites have been selected
+  testInvariant( selected_sites.size() == process_sample_bounds[rank+1] -
+                 process_sample_bounds[rank] );
+
+  // Exchange the selected sites with the processes that own overlapping
+  // history slices
+  const uint64_t first_local_index = this->getFirstGlobalHistoryIndex( rank );
+  const uint64_t end_local_index = this->getFirstGlobalHistoryIndex( rank+1 );
+
+  d_source_sites.resize( end_local_index - first_local_index );
+
+  std::vector<Utility::Communicator::Request> requests;
+
+  for( int p = 0; p < size; ++p )
+  {
+    // Sites that this process will send to process p
+    {
+      const uint64_t first_index =
+        std::max( process_sample_bounds[rank],
+                  this->getFirstGlobalHistoryIndex( p ) );
+
+      const uint64_t end_index =
+        std::min( process_sample_bounds[rank+1],
+                  this->getFirstGlobalHistoryIndex( p+1 ) );
+
+      if( first_index < end_index )
+      {
+        const FissionSite* first_site =
+          selected_sites.data() + (first_index - process_sample_bounds[rank]);
+
+        if( p == rank )
+        {
+          std::copy( first_site,
+                     first_site + (end_index - first_index),
+                     d_source_sites.data() + (first_index - first_local_index) );
+        }
+        else
+        {
+          requests.push_back( Utility::isend( *d_comm, p, 0, Utility::ArrayView<const double>( reinterpret_cast<const double*>( first_site ), 8*(end_index - first_index) ) ) );
+        }
+      }
+    }
+
+    // Sites that this process will receive from process p
+    if( p != rank )
+    {
+      const uint64_t first_index =
+        std::max( process_sample_bounds[p], first_local_index );
+
+      const uint64_t end_index =
+        std::min( process_sample_bounds[p+1], end_local_index );
+
+      if( first_index < end_index )
+      {
+        FissionSite* first_site =
+          d_source_sites.data() + (first_index - first_local_index);
+
+        requests.push_back( Utility::ireceive( *d_comm, p, 0, Utility::ArrayView<double>( reinterpret_cast<double*>( first_site ), 8*(end_index - first_index) ) ) );
+      }
+    }
+  }
+
+  if( !requests.empty() )
+  {
+    std::vector<Utility::Communicator::Status> statuses;
+
+    Utility::wait( requests, statuses );
+  }
+}
+
+// Log the cycle results
+template<ParticleModeType mode>
+void KEigenvalueParticleSimulationManager<mode>::logCycleResults(
+                                                   const uint64_t cycle ) const
+{
+  if( d_comm->rank() == 0 )
+  {
+    FRENSIE_LOG_NOTIFICATION( "Cycle " << cycle+1 << " ("
+                              << (cycle < d_inactive_cycles ? "inactive" :
+                                  "active")
+                              << "): k = " << d_cycle_k_eigenvalues[cycle]
+                              << ", Shannon entropy = "
+                              << d_cycle_shannon_entropies[cycle] );
+    FRENSIE_FLUSH_ALL_LOGS();
+  }
+}
+
+// Return the number of completed cycles
+template<ParticleModeType mode>
+size_t KEigenvalueParticleSimulationManager<mode>::getNumberOfCompletedCycles() const
+{
+  return d_cycle_k_eigenvalues.size();
+}
+
+// Return the k-eigenvalue estimate of each completed cycle
+template<ParticleModeType mode>
+const std::vector<double>& KEigenvalueParticleSimulationManager<mode>::getCycleKEigenvalues() const
+{
+  return d_cycle_k_eigenvalues;
+}
+
+// Return the fission source Shannon entropy of each completed cycle
+template<ParticleModeType mode>
+const std::vector<double>& KEigenvalueParticleSimulationManager<mode>::getCycleShannonEntropies() const
+{
+  return d_cycle_shannon_entropies;
+}
+
+// Return the mean k-eigenvalue of the completed active cycles
+/*! \details If no active cycles have been completed zero will be returned.
+ */
+template<ParticleModeType mode>
+double KEigenvalueParticleSimulationManager<mode>::getKEigenvalue() const
+{
+  if( d_cycle_k_eigenvalues.size() <= d_inactive_cycles )
+    return 0.0;
+
+  double sum = 0.0;
+
+  for( size_t i = d_inactive_cycles; i < d_cycle_k_eigenvalues.size(); ++i )
+    sum += d_cycle_k_eigenvalues[i];
+
+  return sum/(d_cycle_k_eigenvalues.size() - d_inactive_cycles);
+}
+
+// Return the std. dev. of the mean k-eigenvalue of the active cycles
+/*! \details If fewer than two active cycles have been completed zero will be
+ * returned.
+ */
+template<ParticleModeType mode>
+double KEigenvalueParticleSimulationManager<mode>::getKEigenvalueStandardDeviation() const
+{
+  if( d_cycle_k_eigenvalues.size() < d_inactive_cycles + 2 )
+    return 0.0;
+
+  const double n = d_cycle_k_eigenvalues.size() - d_inactive_cycles;
+  const double mean = this->getKEigenvalue();
+
+  double sum_of_squares = 0.0;
+
+  for( size_t i = d_inactive_cycles; i < d_cycle_k_eigenvalues.size(); ++i )
+  {
+    const double diff = d_cycle_k_eigenvalues[i] - mean;
+
+    sum_of_squares += diff*diff;
+  }
+
+  return std::sqrt( sum_of_squares/(n*(n-1.0)) );
+}
+
+// Print the simulation data to the desired stream
+template<ParticleModeType mode>
+void KEigenvalueParticleSimulationManager<mode>::printSimulationSummary( std::ostream& os ) const
+{
+  if( d_comm->rank() == 0 )
+  {
+    os << "K-eigenvalue: " << this->getKEigenvalue() << " +/- "
+       << this->getKEigenvalueStandardDeviation() << " ("
+       << (d_cycle_k_eigenvalues.size() > d_inactive_cycles ?
+           d_cycle_k_eigenvalues.size() - d_inactive_cycles : 0)
+       << " active cycles, " << d_histories_per_cycle
+       << " histories per cycle)" << std::endl;
+
+    if( !d_cycle_shannon_entropies.empty() )
+    {
+      os << "Final fission source Shannon entropy: "
+         << d_cycle_shannon_entropies.back() << std::endl;
+    }
+
+    ParticleSimulationManager::printSimulationSummary( os );
+  }
+}
+
+// Log the simulation data
+template<ParticleModeType mode>
+void KEigenvalueParticleSimulationManager<mode>::logSimulationSummary() const
+{
+  if( d_comm->rank() == 0 )
+  {
+    FRENSIE_LOG_NOTIFICATION( "K-eigenvalue: " << this->getKEigenvalue()
+                              << " +/- "
+                              << this->getKEigenvalueStandardDeviation() );
+
+    ParticleSimulationManager::logSimulationSummary();
+  }
+}
+
+// Update the cached cycle state
+/*! \details The fission source sites are gathered at the root process in
+ * process order, which is also the global history order. This method must be
+ * called by every process.
+ */
+template<ParticleModeType mode>
+void KEigenvalueParticleSimulationManager<mode>::updateCachedCycleState()
+{
+  Utility::ArrayView<const double> packed_source_sites(
+                   reinterpret_cast<const double*>( d_source_sites.data() ),
+                   8*d_source_sites.size() );
+
+  Utility::gatherv( *d_comm,
+                    packed_source_sites,
+                    d_cached_cycle_state.packed_source_sites,
+                    0 );
+
+  if( d_comm->rank() == 0 )
+  {
+    d_cached_cycle_state.cycle_k_eigenvalues = d_cycle_k_eigenvalues;
+    d_cached_cycle_state.cycle_shannon_entropies = d_cycle_shannon_entropies;
+
+    std::copy( d_entropy_mesh_lower_bounds,
+               d_entropy_mesh_lower_bounds+3,
+               d_cached_cycle_state.entropy_mesh_lower_bounds );
+
+    std::copy( d_entropy_mesh_element_widths,
+               d_entropy_mesh_element_widths+3,
+               d_cached_cycle_state.entropy_mesh_element_widths );
+
+    d_cached_cycle_state.entropy_mesh_elements_per_dim =
+      d_entropy_mesh_elements_per_dim;
+  }
+}
+
+// Return the k-eigenvalue cycle state that will be cached
+template<ParticleModeType mode>
+const KEigenvalueCycleState* KEigenvalueParticleSimulationManager<mode>::getKEigenvalueCycleState() const
+{
+  return &d_cached_cycle_state;
+}
+
+// Rendezvous (cache state)
+/*! \details The cycle state is updated before the base rendezvous so that
+ * the cached simulation state includes the fission source of the next cycle.
+ * The weight windows generated by the root process are broadcast so that
+ * every process transports the next cycles with the same windows.
+ */
+template<ParticleModeType mode>
+void KEigenvalueParticleSimulationManager<mode>::rendezvous()
+{
+  this->updateCachedCycleState();
+
+  if( d_comm->size() > 1 )
+  {
+    this->reduceData( *d_comm, 0 );
+
+    if( d_comm->rank() == 0 )
+      ParticleSimulationManager::rendezvous();
+    else
+      this->exportTransportProfile();
+
+    d_comm->barrier();
+
+    // All processes must use the weight windows updated by the root process
+    this->broadcastGeneratedWeightWindows( *d_comm, 0 );
+  }
+  else
+    ParticleSimulationManager::rendezvous();
+}
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_K_EIGENVALUE_PARTICLE_SIMULATION_MANAGER_DEF_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_KEigenvalueParticleSimulationManager_def.hpp
+//---------------------------------------------------------------------------//
@@ -13,10 +13,12 @@
 // FRENSIE Includes
 #include "MonteCarlo_ParticleSimulationManager.hpp"
 #include "MonteCarlo_ParticleSimulationManagerFactory.hpp"
+#include "MonteCarlo_UnresolvedResonanceProbabilityTable.hpp"
 #include "Utility_RandomNumberGenerator.hpp"
 #include "Utility_OpenMPProperties.hpp"
 #include "Utility_JustInTimeInitializer.hpp"
 #include "Utility_LoggingMacros.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_DesignByContract.hpp"
 
 // The registered managers (these must be global so that the custom signal
@@ -88,9 +90,17 @@ ParticleSimulationManager::ParticleSimulationManager(
   // Make sure that the properties pointer is valid
   testPrecondition( properties.get() );
 
-  // Calculate the rendezvous batch size
+  // Calculate the rendezvous batch size (a k-eigenvalue simulation runs the
+  // histories of all of its cycles)
   uint64_t number_of_histories = d_properties->getNumberOfHistories();
 
+  if( d_properties->isKEigenvalueModeOn() )
+  {
+    number_of_histories = d_properties->getNumberOfHistoriesPerCycle()*
+      (d_properties->getNumberOfInactiveCycles() +
+       d_properties->getNumberOfActiveCycles());
+  }
+
   if( number_of_histories > 0 )
   {
     d_rendezvous_batch_size =
@@ -111,6 +121,9 @@ ParticleSimulationManager::ParticleSimulationManager(
 
   // Set the cutoff weight roulette
   this->setCutoffWeightRoulette();
+
+  // Limit the number of snapshots kept by the estimators
+  d_event_handler->setMaxNumberOfEstimatorSnapshots( *d_properties );
 }
 
 // Return the next history that will be completed
@@ -282,6 +295,14 @@ void ParticleSimulationManager::setNeutronCutoffWeightRoulette()
                                          d_properties->getRouletteThresholdWeight<NeutronState>(),
                                          d_properties->getRouletteSurvivalWeight<NeutronState>() );
   }
+  else if( d_properties->isImplicitCaptureModeOn( NEUTRON ) )
+  {
+    FRENSIE_LOG_TAGGED_WARNING( "ParticleSimulationManager",
+                                "Neutron implicit capture mode is on but "
+                                "the neutron roulette weights have not been "
+                                "set - low weight neutrons will only be "
+                                "terminated by the energy cutoff!" );
+  }
 }
 
 // Set the photon cutoff weight roulette
@@ -293,6 +314,14 @@ void ParticleSimulationManager::setPhotonCutoffWeightRoulette()
                                          d_properties->getRouletteThresholdWeight<PhotonState>(),
                                          d_properties->getRouletteSurvivalWeight<PhotonState>() );
   }
+  else if( d_properties->isImplicitCaptureModeOn( PHOTON ) )
+  {
+    FRENSIE_LOG_TAGGED_WARNING( "ParticleSimulationManager",
+                                "Photon implicit capture mode is on but "
+                                "the photon roulette weights have not been "
+                                "set - low weight photons will only be "
+                                "terminated by the energy cutoff!" );
+  }
 }
 
 // Set the adjoint photon cutoff weight roulette
@@ -355,6 +384,40 @@ bool ParticleSimulationManager::isSingleRendezvousFileUsed() const
   return d_use_single_rendezvous_file;
 }
 
+// Set the weight window mesh generator (used at each rendezvous)
+/*! \details The weight window mesh of the generator must be the population
+ * controller of the manager. The weight windows will be updated in place
+ * at each rendezvous and exported to the
+ * "<simulation_name>_weight_windows_<rendezvous_number>.<archive_type>"
+ * file (or the "<simulation_name>_weight_windows.<archive_type>" file if a
+ * single rendezvous file is used).
+ */
+void ParticleSimulationManager::setWeightWindowMeshGenerator(
+     const std::shared_ptr<WeightWindowMeshGenerator>& weight_window_generator )
+{
+  if( weight_window_generator )
+  {
+    TEST_FOR_EXCEPTION( weight_window_generator->getWeightWindowMesh().get() !=
+                        d_population_controller.get(),
+                        std::runtime_error,
+                        "The weight window mesh generator can only be used "
+                        "if its weight window mesh is the population "
+                        "controller of the manager!" );
+  }
+
+  d_weight_window_generator = weight_window_generator;
+}
+
+// Set the DXTRAN spheres
+/*! \details The DXTRAN spheres must be embedded in the model of the
+ * manager.
+ */
+void ParticleSimulationManager::setDXTRANSpheres(
+                         const std::shared_ptr<DXTRANSpheres>& dxtran_spheres )
+{
+  d_dxtran_spheres = dxtran_spheres;
+}
+
 // Run the simulation set up by the user
 void ParticleSimulationManager::runSimulation()
 {
@@ -473,6 +536,16 @@ void ParticleSimulationManager::enableThreadSupport()
 
   // Enable event handler thread support
   d_event_handler->enableThreadSupport( Utility::OpenMPProperties::getRequestedNumberOfThreads() );
+
+  // Enable transport profiler thread support
+  TransportProfiler::enableThreadSupport( Utility::OpenMPProperties::getRequestedNumberOfThreads() );
+
+  // Enable unresolved resonance probability table thread support
+  UnresolvedResonanceProbabilityTable::enableThreadSupport( Utility::OpenMPProperties::getRequestedNumberOfThreads() );
+
+  // Enable DXTRAN sphere thread support
+  if( d_dxtran_spheres )
+    d_dxtran_spheres->enableThreadSupport( Utility::OpenMPProperties::getRequestedNumberOfThreads() );
 }
 
 // Reset data
@@ -504,6 +577,8 @@ void ParticleSimulationManager::registerSimulationStartedEvent()
 void ParticleSimulationManager::registerSimulationStoppedEvent()
 {
   d_event_handler->updateObserversFromParticleSimulationStoppedEvent();
+
+  this->exportTransportProfile();
 }
 
 // Check if the simulation is complete
@@ -515,11 +590,51 @@ bool ParticleSimulationManager::isSimulationComplete()
 // Rendezvous (cache state)
 void ParticleSimulationManager::rendezvous()
 {
+  // The weight windows must be updated before the state is cached
+  if( d_weight_window_generator )
+    this->updateGeneratedWeightWindows();
+
   this->basicRendezvous();
 
+  this->exportTransportProfile();
+
   ++d_rendezvous_number;
 }
 
+// Export the transport profile of this process
+/*! \details The transport profile will only be exported if transport
+ * profiling has been enabled. The JSON and CSV reports will be written to
+ * the "<simulation_name>_transport_profile_<rank>" files (any reports from
+ * a previous rendezvous will be overwritten since the profile is cumulative).
+ */
+void ParticleSimulationManager::exportTransportProfile() const
+{
+  if( TransportProfiler::isEnabled() )
+  {
+    const int rank = Utility::Communicator::getDefault()->rank();
+
+    std::string profile_name( d_simulation_name );
+    profile_name += "_transport_profile_";
+    profile_name += Utility::toString( rank );
+
+    {
+      std::ofstream json_report( profile_name + ".json" );
+
+      TransportProfiler::exportReport( json_report,
+                                       TransportProfiler::JSON_REPORT_FORMAT,
+                                       rank );
+    }
+
+    {
+      std::ofstream csv_report( profile_name + ".csv" );
+
+      TransportProfiler::exportReport( csv_report,
+                                       TransportProfiler::CSV_REPORT_FORMAT,
+                                       rank );
+    }
+  }
+}
+
 // Conduct a basic rendezvous
 void ParticleSimulationManager::basicRendezvous() const
 {
@@ -554,9 +669,69 @@ void ParticleSimulationManager::basicRendezvous() const
                  d_rendezvous_number+1,
                  d_use_single_rendezvous_file );
 
+  // Cache the k-eigenvalue cycle state so that a restart resumes at the
+  // next cycle
+  if( const KEigenvalueCycleState* k_eigenvalue_state =
+      this->getKEigenvalueCycleState() )
+  {
+    tmp_factory.d_k_eigenvalue_cycle_state = *k_eigenvalue_state;
+  }
+
+  // Cache the weight window mesh generator so that the weight windows will
+  // continue to be generated after a restart
+  tmp_factory.d_weight_window_generator = d_weight_window_generator;
+
   tmp_factory.saveToFile( archive_name, true );
 }
 
+// Return the k-eigenvalue cycle state that will be cached (if any)
+/*! \details Only k-eigenvalue simulation managers have a cycle state. A null
+ * pointer is returned by default.
+ */
+const KEigenvalueCycleState* ParticleSimulationManager::getKEigenvalueCycleState() const
+{
+  return NULL;
+}
+
+// Update and export the generated weight windows
+void ParticleSimulationManager::updateGeneratedWeightWindows() const
+{
+  d_weight_window_generator->updateWeightWindows();
+
+  std::string archive_name( d_simulation_name );
+  archive_name += "_weight_windows";
+
+  if( !d_use_single_rendezvous_file )
+  {
+    archive_name += "_";
+    archive_name += Utility::toString( d_rendezvous_number );
+  }
+
+  archive_name += ".";
+  archive_name += d_archive_type;
+
+  d_weight_window_generator->exportWeightWindowMesh( archive_name );
+
+  FRENSIE_LOG_NOTIFICATION( " Weight windows updated ("
+                            << d_weight_window_generator->getNumberOfUpdates()
+                            << " updates): " << archive_name );
+}
+
+// Broadcast the generated weight windows from the root process
+/*! \details The weight windows are only updated by the root process of a
+ * distributed simulation (it is the only process with the reduced flux
+ * estimates). All other processes must receive the updated windows before
+ * the next batch is simulated. Nothing will be done if there is no weight
+ * window mesh generator.
+ */
+void ParticleSimulationManager::broadcastGeneratedWeightWindows(
+                                            const Utility::Communicator& comm,
+                                            const int root_process )
+{
+  if( d_weight_window_generator )
+    d_weight_window_generator->broadcastWeightWindows( comm, root_process );
+}
+
 // Print the simulation data to the desired stream
 void ParticleSimulationManager::printSimulationSummary( std::ostream& os ) const
 {
@@ -639,58 +814,94 @@ void ParticleSimulationManager::runSimulationMicroBatch(
       if( d_exit_simulation )
         continue;
 
-      // Initialize the random number generator for this history
-      Utility::RandomNumberGenerator::initialize( history );
+      this->simulateSourceHistory( source_bank, bank, history );
+    }
+  }
+}
 
-      // Sample a particle state from the source
-      try{
-        d_source->sampleParticleState( source_bank, history );
-      }
-      catch( const Geometry::GeometryError& exception )
-      {
-        LOG_LOST_PARTICLE_DETAILS( source_bank.top() );
+// Simulate a history from the source
+/*! \details The random number generator will be initialized for the history
+ * before the source is sampled. The observer history contributions will be
+ * committed once the history is complete.
+ */
+void ParticleSimulationManager::simulateSourceHistory(
+                                                   ParticleBank& source_bank,
+                                                   ParticleBank& bank,
+                                                   const uint64_t history )
+{
+  // Initialize the random number generator for this history
+  Utility::RandomNumberGenerator::initialize( history );
 
-        FRENSIE_LOG_NESTED_ERROR( exception.what() );
+  // Reset the unresolved resonance band random number for this history
+  UnresolvedResonanceProbabilityTable::resetBandRandomNumber();
 
-        continue;
-      }
-      catch( const std::runtime_error& exception )
-      {
-        FRENSIE_LOG_NESTED_ERROR( exception.what() );
+  // Sample a particle state from the source
+  try{
+    FRENSIE_PROFILE_TRANSPORT_STAGE( SOURCE_SAMPLING_STAGE );
 
-        continue;
-      }
-      // The source has likely been constructed incorrectly
-      catch( const std::logic_error& exception )
-      {
-        FRENSIE_LOG_ERROR( "There is an issue with the source!" );
+    d_source->sampleParticleState( source_bank, history );
+  }
+  catch( const Geometry::GeometryError& exception )
+  {
+    LOG_LOST_PARTICLE_DETAILS( source_bank.top() );
 
-        FRENSIE_LOG_NESTED_ERROR( exception.what() );
+    FRENSIE_LOG_NESTED_ERROR( exception.what() );
 
-        d_exit_simulation = true;
+    return;
+  }
+  catch( const std::runtime_error& exception )
+  {
+    FRENSIE_LOG_NESTED_ERROR( exception.what() );
 
-        continue;
-      }
+    return;
+  }
+  // The source has likely been constructed incorrectly
+  catch( const std::logic_error& exception )
+  {
+    FRENSIE_LOG_ERROR( "There is an issue with the source!" );
 
-      // Simulate the particles generated by the source first
-      while( source_bank.size() > 0 )
-      {
-        this->simulateUnresolvedParticle( source_bank.top(), bank, true );
+    FRENSIE_LOG_NESTED_ERROR( exception.what() );
 
-        source_bank.pop();
-      }
+    d_exit_simulation = true;
 
-      // This history only ends when the particle bank is empty
-      while( bank.size() > 0 )
-      {
-        this->simulateUnresolvedParticle( bank.top(), bank, false );
+    return;
+  }
 
-        bank.pop();
-      }
+  this->simulateBankedHistory( source_bank, bank );
+}
 
-      // History complete - commit all observer history contributions
-      d_event_handler->commitObserverHistoryContributions();
-    }
+// Simulate a history from the particles in a source bank
+/*! \details The particles in the source bank will be treated as source
+ * particles. The history only ends when both banks are empty. The observer
+ * history contributions will be committed once the history is complete.
+ */
+void ParticleSimulationManager::simulateBankedHistory(
+                                                     ParticleBank& source_bank,
+                                                     ParticleBank& bank )
+{
+  // Simulate the particles generated by the source first
+  while( source_bank.size() > 0 )
+  {
+    this->simulateUnresolvedParticle( source_bank.top(), bank, true );
+
+    source_bank.pop();
+    FRENSIE_COUNT_TRANSPORT_STAGE( BANK_POP_STAGE );
+  }
+
+  // This history only ends when the particle bank is empty
+  while( bank.size() > 0 )
+  {
+    this->simulateUnresolvedParticle( bank.top(), bank, false );
+
+    bank.pop();
+    FRENSIE_COUNT_TRANSPORT_STAGE( BANK_POP_STAGE );
+  }
+
+  // History complete - commit all observer history contributions
+  {
+    FRENSIE_PROFILE_TRANSPORT_STAGE( HISTORY_COMMIT_STAGE );
+
+    d_event_handler->commitObserverHistoryContributions();
   }
 }
 
@@ -734,6 +945,12 @@ bool ParticleSimulationManager::hasEndSimulationRequestBeenMade() const
   return d_end_simulation;
 }
 
+// Check if the simulation must be exited immediately
+bool ParticleSimulationManager::hasExitSimulationRequestBeenMade() const
+{
+  return d_exit_simulation;
+}
+
 } // end MonteCarlo namespace
 
 //---------------------------------------------------------------------------//
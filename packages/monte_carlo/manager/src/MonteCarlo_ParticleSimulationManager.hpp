@@ -18,13 +18,17 @@
 // FRENSIE Includes
 #include "MonteCarlo_EventHandler.hpp"
 #include "MonteCarlo_PopulationControl.hpp"
+#include "MonteCarlo_WeightWindowMeshGenerator.hpp"
 #include "MonteCarlo_CollisionForcer.hpp"
+#include "MonteCarlo_DXTRANSpheres.hpp"
 #include "MonteCarlo_StandardWeightCutoffRoulette.hpp"
 #include "MonteCarlo_ParticleSource.hpp"
 #include "MonteCarlo_FilledGeometryModel.hpp"
 #include "MonteCarlo_CollisionKernel.hpp"
 #include "MonteCarlo_TransportKernel.hpp"
 #include "MonteCarlo_SimulationProperties.hpp"
+#include "MonteCarlo_TransportProfiler.hpp"
+#include "MonteCarlo_KEigenvalueCycleState.hpp"
 #include "Utility_Communicator.hpp"
 
 extern "C" void __custom_signal_handler__( int signal );
@@ -96,6 +100,12 @@ public:
   //! Check if a single rendezvous file will be used
   bool isSingleRendezvousFileUsed() const;
 
+  //! Set the weight window mesh generator (used at each rendezvous)
+  void setWeightWindowMeshGenerator( const std::shared_ptr<WeightWindowMeshGenerator>& weight_window_generator );
+
+  //! Set the DXTRAN spheres
+  void setDXTRANSpheres( const std::shared_ptr<DXTRANSpheres>& dxtran_spheres );
+
   //! Run the simulation set up by the user
   virtual void runSimulation();
 
@@ -133,10 +143,21 @@ protected:
   //! Check if the simulation has been ended by the user
   bool hasEndSimulationRequestBeenMade() const;
 
+  //! Check if the simulation must be exited immediately
+  bool hasExitSimulationRequestBeenMade() const;
+
   //! Run the simulation batch
   void runSimulationBatch( const uint64_t batch_start_history,
                            const uint64_t batch_end_history );
 
+  //! Simulate a history from the source
+  void simulateSourceHistory( ParticleBank& source_bank,
+                              ParticleBank& bank,
+                              const uint64_t history );
+
+  //! Simulate a history from the particles in a source bank
+  void simulateBankedHistory( ParticleBank& source_bank, ParticleBank& bank );
+
   //! Simulate an unresolved particle
   virtual void simulateUnresolvedParticle(
                                         ParticleState& unresolved_particle,
@@ -180,6 +201,16 @@ protected:
   //! Rendezvous (cache state)
   virtual void rendezvous();
 
+  //! Export the transport profile of this process
+  void exportTransportProfile() const;
+
+  //! Broadcast the generated weight windows from the root process
+  void broadcastGeneratedWeightWindows( const Utility::Communicator& comm,
+                                        const int root_process );
+
+  //! Return the k-eigenvalue cycle state that will be cached (if any)
+  virtual const KEigenvalueCycleState* getKEigenvalueCycleState() const;
+
   //! The signal handler
   virtual void signalHandler( int signal );
 
@@ -264,14 +295,27 @@ private:
                                const double track_start_position[3],
                                bool& global_subtrack_ending_event_dispatched );
 
+  // Check if a particle enters a DXTRAN sphere (the particle will be killed)
+  template<typename State>
+  bool isParticleEnteringDXTRANSphere(
+                               State& particle,
+                               const double distance_to_surface_hit,
+                               const double distance_to_collision_site,
+                               const double track_start_position[3],
+                               bool& global_subtrack_ending_event_dispatched );
+
   // Collide with the cell material
   template<typename State>
   void collideWithCellMaterial( State& particle,
+                                const double cell_total_macro_cross_section,
                                 ParticleBank& bank );
 
   // Conduct a basic rendezvous
   void basicRendezvous() const;
 
+  // Update and export the generated weight windows
+  void updateGeneratedWeightWindows() const;
+
   // Declare the custom signal handler as a friend
   friend void ::__custom_signal_handler__( int );
 
@@ -302,6 +346,12 @@ private:
   // The collision forcer
   std::shared_ptr<const CollisionForcer> d_collision_forcer;
 
+  // The weight window mesh generator
+  std::shared_ptr<WeightWindowMeshGenerator> d_weight_window_generator;
+
+  // The DXTRAN spheres
+  std::shared_ptr<DXTRANSpheres> d_dxtran_spheres;
+
   // The weight cutoff roulette
   std::shared_ptr<StandardWeightCutoffRoulette> d_weight_roulette;
 
@@ -11,6 +11,7 @@
 #include "MonteCarlo_ParticleSimulationManagerFactory.hpp"
 #include "MonteCarlo_StandardParticleSimulationManager.hpp"
 #include "MonteCarlo_BatchedDistributedStandardParticleSimulationManager.hpp"
+#include "MonteCarlo_KEigenvalueParticleSimulationManager.hpp"
 #include "Utility_OpenMPProperties.hpp"
 #include "Utility_GlobalMPISession.hpp"
 #include "Utility_LoggingMacros.hpp"
@@ -175,6 +176,8 @@ ParticleSimulationManagerFactory::ParticleSimulationManagerFactory(
  *  <li>MonteCarlo::SimulationGeneralProperties::getNumberOfBatchesPerProcessor()</li>
  *  <li>MonteCarlo::SimulationGeneralProperties::getNumberOfSnapshotsPerBatch()</li>
  *  <li>MonteCarlo::SimulationGeneralProperties::getSimulationWallTime()</li>
+ *  <li>MonteCarlo::SimulationGeneralProperties::getNumberOfActiveCycles()
+ *      (k-eigenvalue simulations only)</li>
  * </ul>
  */
 ParticleSimulationManagerFactory::ParticleSimulationManagerFactory(
@@ -193,6 +196,12 @@ ParticleSimulationManagerFactory::ParticleSimulationManagerFactory(
   const_cast<SimulationProperties&>( *d_properties ).setNumberOfBatchesPerProcessor( updated_general_props.getNumberOfBatchesPerProcessor() );
   const_cast<SimulationProperties&>( *d_properties ).setNumberOfSnapshotsPerBatch( updated_general_props.getNumberOfSnapshotsPerBatch() );
   const_cast<SimulationProperties&>( *d_properties ).setSimulationWallTime( updated_general_props.getSimulationWallTime() );
+
+  // Only the number of active cycles of a k-eigenvalue simulation can be
+  // changed (the cached fission source depends on the other cycle props)
+  if( d_properties->isKEigenvalueModeOn() )
+    const_cast<SimulationProperties&>( *d_properties ).setNumberOfActiveCycles( updated_general_props.getNumberOfActiveCycles() );
+  
   Utility::OpenMPProperties::setNumberOfThreads( threads );
 
   // Update the completion criterion
@@ -266,6 +275,37 @@ void ParticleSimulationManagerFactory::setCollisionForcer(
   }
 }
 
+// Set the weight window mesh generator that will be used by the manager
+/*! \details The weight window mesh of the generator must be the population
+ * controller (see
+ * MonteCarlo::ParticleSimulationManagerFactory::setPopulationControl). The
+ * generator is archived with the manager so that the weight windows will
+ * continue to be generated after a restart.
+ */
+void ParticleSimulationManagerFactory::setWeightWindowMeshGenerator(
+     const std::shared_ptr<WeightWindowMeshGenerator>& weight_window_generator )
+{
+  if( weight_window_generator )
+  {
+    TEST_FOR_EXCEPTION( weight_window_generator->getWeightWindowMesh().get() !=
+                        d_population_controller.get(),
+                        std::runtime_error,
+                        "The weight window mesh generator can only be used "
+                        "if its weight window mesh is the population "
+                        "controller!" );
+
+    if( d_simulation_manager )
+    {
+      FRENSIE_LOG_TAGGED_WARNING( "ParticleSimulationManagerFactory",
+                                  "Setting a weight window mesh generator "
+                                  "after the manager has been created is "
+                                  "not allowed!" );
+    }
+    else
+      d_weight_window_generator = weight_window_generator;
+  }
+}
+
 namespace Details{
 
 //! The create model helper struct
@@ -275,7 +315,11 @@ struct ParticleSimulationManagerFactoryCreateHelper
   template<ParticleModeType mode>
   static void createManager( ParticleSimulationManagerFactory& factory )
   {
-    if( factory.d_comm->size() > 1 )
+    if( factory.d_properties->isKEigenvalueModeOn() )
+    {
+      ParticleSimulationManagerFactoryCreateHelper::createKEigenvalueManager<mode>( factory, std::integral_constant<bool,mode == NEUTRON_MODE || mode == NEUTRON_PHOTON_MODE || mode == NEUTRON_PHOTON_ELECTRON_MODE>() );
+    }
+    else if( factory.d_comm->size() > 1 )
     {
       factory.d_simulation_manager.reset(
                  new BatchedDistributedStandardParticleSimulationManager<mode>(
@@ -309,6 +353,38 @@ struct ParticleSimulationManagerFactoryCreateHelper
                                       factory.d_use_single_rendezvous_file ) );
     }
   }
+
+  //! Create the k-eigenvalue manager
+  template<ParticleModeType mode>
+  static void createKEigenvalueManager( ParticleSimulationManagerFactory& factory,
+                                        std::true_type )
+  {
+    factory.d_simulation_manager.reset(
+                 new KEigenvalueParticleSimulationManager<mode>(
+                                          factory.d_simulation_name,
+                                          factory.d_archive_type,
+                                          factory.d_model,
+                                          factory.d_source,
+                                          factory.d_event_handler,
+                                          factory.d_population_controller,
+                                          factory.d_collision_forcer,
+                                          factory.d_properties,
+                                          factory.d_next_history,
+                                          factory.d_rendezvous_number,
+                                          factory.d_use_single_rendezvous_file,
+                                          factory.d_comm,
+                                          factory.d_k_eigenvalue_cycle_state ) );
+  }
+
+  //! Create the k-eigenvalue manager (invalid particle mode)
+  template<ParticleModeType mode>
+  static void createKEigenvalueManager( ParticleSimulationManagerFactory&,
+                                        std::false_type )
+  {
+    THROW_EXCEPTION( std::runtime_error,
+                     "A k-eigenvalue simulation requires a particle mode "
+                     "that includes (forward) neutrons!" );
+  }
 };
   
 } // end Details namespace
@@ -376,6 +452,9 @@ ParticleSimulationManagerFactory::getManager()
                          ") is not supported!" );
       }
     }
+
+    if( d_weight_window_generator )
+      d_simulation_manager->setWeightWindowMeshGenerator( d_weight_window_generator );
   }
 
   return d_simulation_manager;
@@ -82,6 +82,9 @@ public:
   //! Set the collision forcer that will be used by the manager
   void setCollisionForcer( const std::shared_ptr<const CollisionForcer>& collision_forcer );
 
+  //! Set the weight window mesh generator that will be used by the manager
+  void setWeightWindowMeshGenerator( const std::shared_ptr<WeightWindowMeshGenerator>& weight_window_generator );
+
   //! Return the manager
   std::shared_ptr<ParticleSimulationManager> getManager();
 
@@ -150,6 +153,9 @@ private:
   // The collision forcer
   std::shared_ptr<const CollisionForcer> d_collision_forcer;
 
+  // The weight window mesh generator
+  std::shared_ptr<WeightWindowMeshGenerator> d_weight_window_generator;
+
   // The simulation properties
   std::shared_ptr<const SimulationProperties> d_properties;
 
@@ -162,6 +168,9 @@ private:
   // Use a single rendezvous file
   bool d_use_single_rendezvous_file;
 
+  // The k-eigenvalue cycle state (only used in k-eigenvalue mode)
+  KEigenvalueCycleState d_k_eigenvalue_cycle_state;
+
   // The communicator
   std::shared_ptr<const Utility::Communicator> d_comm;
 
@@ -184,11 +193,21 @@ void ParticleSimulationManagerFactory::serialize( Archive& ar, const unsigned ve
   ar & BOOST_SERIALIZATION_NVP( d_next_history );
   ar & BOOST_SERIALIZATION_NVP( d_rendezvous_number );
   ar & BOOST_SERIALIZATION_NVP( d_use_single_rendezvous_file );
+
+  if( version > 0 )
+    ar & BOOST_SERIALIZATION_NVP( d_k_eigenvalue_cycle_state );
+  else
+    d_k_eigenvalue_cycle_state = KEigenvalueCycleState();
+
+  if( version > 1 )
+    ar & BOOST_SERIALIZATION_NVP( d_weight_window_generator );
+  else
+    d_weight_window_generator.reset();
 }
 
 } // end MonteCarlo namespace
 
-BOOST_SERIALIZATION_CLASS_VERSION( ParticleSimulationManagerFactory, MonteCarlo, 0 );
+BOOST_SERIALIZATION_CLASS_VERSION( ParticleSimulationManagerFactory, MonteCarlo, 2 );
 EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, ParticleSimulationManagerFactory );
 
 #endif // end FRENSIE_PARTICLE_SIMULATION_MANAGER_FACTORY_HPP
@@ -79,6 +79,8 @@ struct RaySafetyHelper
                                 Geometry::Model::EntityId& surface_hit,
                                 const double )
   {
+    FRENSIE_PROFILE_TRANSPORT_STAGE( RAY_FIRE_STAGE );
+
     return particle.navigator().fireRay( surface_hit ).value();
   }
 
@@ -100,7 +102,11 @@ struct RaySafetyHelper<State,typename std::enable_if<std::is_base_of<MonteCarlo:
                                         const double remaining_track )
   {
     if ( particle.getRaySafetyDistance() < remaining_track )
+    {
+      FRENSIE_PROFILE_TRANSPORT_STAGE( RAY_FIRE_STAGE );
+
       return particle.navigator().fireRay( surface_hit ).value();
+    }
     else
       return std::numeric_limits<double>::infinity();
   }
@@ -209,7 +215,12 @@ void ParticleSimulationManager::simulateParticleImpl(
     else
     {
       // Inject first check here
-      d_population_controller->checkParticleWithPopulationController( particle, bank );
+      {
+        FRENSIE_PROFILE_TRANSPORT_STAGE( POPULATION_CONTROL_STAGE );
+
+        d_population_controller->checkParticleWithPopulationController( particle, bank );
+      }
+
       simulate_particle_track( particle,
                                bank,
                                d_transport_kernel->sampleOpticalPathLengthToNextCollisionSite(),
@@ -296,6 +307,8 @@ void ParticleSimulationManager::simulateParticleTrack(
   // particle entering cell event observers
   if( starting_from_source )
   {
+    FRENSIE_PROFILE_TRANSPORT_STAGE( PARTICLE_ENTERING_CELL_DISPATCH_STAGE );
+
     d_event_handler->updateObserversFromParticleEnteringCellEvent(
                                                 particle, particle.getCell() );
   }
@@ -306,6 +319,8 @@ void ParticleSimulationManager::simulateParticleTrack(
     // Get the total cross section for the cell
     if( !d_model->isCellVoid<State>( particle.getCell() ) )
     {
+      FRENSIE_PROFILE_TRANSPORT_STAGE( CROSS_SECTION_LOOKUP_STAGE );
+
       cell_total_macro_cross_section =
         d_model->getMacroscopicTotalForwardCrossSectionQuick( particle );
     }
@@ -321,6 +336,15 @@ void ParticleSimulationManager::simulateParticleTrack(
     }
     CATCH_LOST_PARTICLE_AND_BREAK( particle );
 
+    // The particle enters a DXTRAN sphere before it reaches the surface or
+    // the collision site
+    if( this->isParticleEnteringDXTRANSphere( particle,
+                                              distance_to_surface_hit,
+                                              cell_distance_to_collision,
+                                              track_start_point,
+                                              global_subtrack_ending_event_dispatched ) )
+      break;
+
     // Convert the distance to the surface to optical path
     op_to_surface_hit = distance_to_surface_hit*cell_total_macro_cross_section;
 
@@ -368,7 +392,9 @@ void ParticleSimulationManager::simulateParticleTrack(
                                                   particle,
                                                   cell_distance_to_collision );
 
-      this->collideWithCellMaterial( particle, bank );
+      this->collideWithCellMaterial( particle,
+                                     cell_total_macro_cross_section,
+                                     bank );
 
       // This track is finished
       break;
@@ -377,6 +403,8 @@ void ParticleSimulationManager::simulateParticleTrack(
 
   if( !global_subtrack_ending_event_dispatched )
   {
+    FRENSIE_PROFILE_TRANSPORT_STAGE( PARTICLE_SUBTRACK_ENDING_GLOBAL_DISPATCH_STAGE );
+
     d_event_handler->updateObserversFromParticleSubtrackEndingGlobalEvent(
                                                       particle,
                                                       track_start_point,
@@ -384,7 +412,11 @@ void ParticleSimulationManager::simulateParticleTrack(
   }
 
   if( !particle )
+  {
+    FRENSIE_PROFILE_TRANSPORT_STAGE( PARTICLE_GONE_GLOBAL_DISPATCH_STAGE );
+
     d_event_handler->updateObserversFromParticleGoneGlobalEvent( particle );
+  }
 }
 
 // Simulate an unresolved particle track using the "alternative" method
@@ -440,6 +472,8 @@ void ParticleSimulationManager::simulateParticleTrackAlternative(
   // particle entering cell event observers
   if( starting_from_source )
   {
+    FRENSIE_PROFILE_TRANSPORT_STAGE( PARTICLE_ENTERING_CELL_DISPATCH_STAGE );
+
     d_event_handler->updateObserversFromParticleEnteringCellEvent(
                                                 particle, particle.getCell() );
   }
@@ -449,6 +483,8 @@ void ParticleSimulationManager::simulateParticleTrackAlternative(
   {
     // Fire a ray through the cell currently containing the particle
     try{
+      FRENSIE_PROFILE_TRANSPORT_STAGE( RAY_FIRE_STAGE );
+
       distance_to_surface_hit = particle.navigator().fireRay( surface_hit ).value();
     }
     CATCH_LOST_PARTICLE_AND_BREAK( particle );
@@ -456,8 +492,12 @@ void ParticleSimulationManager::simulateParticleTrackAlternative(
     // Get the total cross section for the cell and the distance to collision
     if( !d_model->isCellVoid<State>( particle.getCell() ) )
     {
-      cell_total_macro_cross_section =
-        d_model->getMacroscopicTotalForwardCrossSectionQuick( particle );
+      {
+        FRENSIE_PROFILE_TRANSPORT_STAGE( CROSS_SECTION_LOOKUP_STAGE );
+
+        cell_total_macro_cross_section =
+          d_model->getMacroscopicTotalForwardCrossSectionQuick( particle );
+      }
 
       // Only consider a forced collision cell if the subtrack is starting from
       // the source or from a cell boundary
@@ -466,10 +506,14 @@ void ParticleSimulationManager::simulateParticleTrackAlternative(
           d_collision_forcer->isForcedCollisionCell<State>(particle.getCell()))
       {
         // This event must be dispatched before the particle weight changes
-        d_event_handler->updateObserversFromParticleSubtrackEndingGlobalEvent(
+        {
+          FRENSIE_PROFILE_TRANSPORT_STAGE( PARTICLE_SUBTRACK_ENDING_GLOBAL_DISPATCH_STAGE );
+
+          d_event_handler->updateObserversFromParticleSubtrackEndingGlobalEvent(
                                                       particle,
                                                       track_start_point,
                                                       particle.getPosition() );
+        }
 
         track_start_point[0] = particle.getXPosition();
         track_start_point[1] = particle.getYPosition();
@@ -509,6 +553,15 @@ void ParticleSimulationManager::simulateParticleTrackAlternative(
       cell_distance_to_collision = std::numeric_limits<double>::infinity();
     }
 
+    // The particle enters a DXTRAN sphere before it reaches the surface or
+    // the collision site
+    if( this->isParticleEnteringDXTRANSphere( particle,
+                                              distance_to_surface_hit,
+                                              cell_distance_to_collision,
+                                              track_start_point,
+                                              global_subtrack_ending_event_dispatched ) )
+      break;
+
     // The particle passes through this cell to the next
     if( distance_to_surface_hit < cell_distance_to_collision )
     {
@@ -549,7 +602,9 @@ void ParticleSimulationManager::simulateParticleTrackAlternative(
                                             track_start_point,
                                             global_subtrack_ending_event_dispatched );
 
-      this->collideWithCellMaterial( particle, bank );
+      this->collideWithCellMaterial( particle,
+                                     cell_total_macro_cross_section,
+                                     bank );
 
       // This track is finished
       break;
@@ -558,6 +613,8 @@ void ParticleSimulationManager::simulateParticleTrackAlternative(
 
   if( !global_subtrack_ending_event_dispatched )
   {
+    FRENSIE_PROFILE_TRANSPORT_STAGE( PARTICLE_SUBTRACK_ENDING_GLOBAL_DISPATCH_STAGE );
+
     d_event_handler->updateObserversFromParticleSubtrackEndingGlobalEvent(
                                                       particle,
                                                       track_start_point,
@@ -565,7 +622,11 @@ void ParticleSimulationManager::simulateParticleTrackAlternative(
   }
 
   if( !particle )
+  {
+    FRENSIE_PROFILE_TRANSPORT_STAGE( PARTICLE_GONE_GLOBAL_DISPATCH_STAGE );
+
     d_event_handler->updateObserversFromParticleGoneGlobalEvent( particle );
+  }
 }
 
 // Advance a particle to the cell boundary
@@ -583,31 +644,52 @@ void ParticleSimulationManager::advanceParticleToCellBoundary(
   bool reflected = particle.navigator().advanceToCellBoundary( surface_normal );
 
   // Update the observers: particle subtrack ending in cell event
-  d_event_handler->updateObserversFromParticleSubtrackEndingInCellEvent(
+  {
+    FRENSIE_PROFILE_TRANSPORT_STAGE( PARTICLE_SUBTRACK_ENDING_IN_CELL_DISPATCH_STAGE );
+
+    d_event_handler->updateObserversFromParticleSubtrackEndingInCellEvent(
                                                          particle,
                                                          start_cell,
                                                          distance_to_surface );
+  }
 
   // Update the observers: particle leaving cell event
-  d_event_handler->updateObserversFromParticleLeavingCellEvent( particle, start_cell );
+  {
+    FRENSIE_PROFILE_TRANSPORT_STAGE( PARTICLE_LEAVING_CELL_DISPATCH_STAGE );
+
+    d_event_handler->updateObserversFromParticleLeavingCellEvent( particle, start_cell );
+  }
 
   // Update the observers: particle crossing surface event
-  d_event_handler->updateObserversFromParticleCrossingSurfaceEvent(
+  {
+    FRENSIE_PROFILE_TRANSPORT_STAGE( PARTICLE_CROSSING_SURFACE_DISPATCH_STAGE );
+
+    d_event_handler->updateObserversFromParticleCrossingSurfaceEvent(
                                                               particle,
                                                               surface_to_cross,
                                                               surface_normal );
+  }
 
   if( reflected )
   {
+    FRENSIE_PROFILE_TRANSPORT_STAGE( PARTICLE_CROSSING_SURFACE_DISPATCH_STAGE );
+
     d_event_handler->updateObserversFromParticleCrossingSurfaceEvent(
                                                               particle,
                                                               surface_to_cross,
                                                               surface_normal );
 
+    // The rays to the DXTRAN spheres cannot pass through a reflecting
+    // surface so the reflected flight is not represented by DXTRAN particles
+    particle.setRepresentedByDXTRANParticles( false );
   }
 
   // Update the observers: particle entering cell event
-  d_event_handler->updateObserversFromParticleEnteringCellEvent( particle, particle.getCell() );
+  {
+    FRENSIE_PROFILE_TRANSPORT_STAGE( PARTICLE_ENTERING_CELL_DISPATCH_STAGE );
+
+    d_event_handler->updateObserversFromParticleEnteringCellEvent( particle, particle.getCell() );
+  }
 }
 
 // Advance a particle to a collision site
@@ -623,29 +705,104 @@ void ParticleSimulationManager::advanceParticleToCollisionSite(
   particle.navigator().advanceBySubstep( *Utility::reinterpretAsQuantity<Geometry::Navigator::Length>( &distance_to_collision ) );
 
   // Update the observers: particle subtrack ending in cell event
-  d_event_handler->updateObserversFromParticleSubtrackEndingInCellEvent(
+  {
+    FRENSIE_PROFILE_TRANSPORT_STAGE( PARTICLE_SUBTRACK_ENDING_IN_CELL_DISPATCH_STAGE );
+
+    d_event_handler->updateObserversFromParticleSubtrackEndingInCellEvent(
                                                        particle,
                                                        particle.getCell(),
                                                        distance_to_collision );
+  }
 
   // Update the observers: particle subtrack ending global event
-  d_event_handler->updateObserversFromParticleSubtrackEndingGlobalEvent(
+  {
+    FRENSIE_PROFILE_TRANSPORT_STAGE( PARTICLE_SUBTRACK_ENDING_GLOBAL_DISPATCH_STAGE );
+
+    d_event_handler->updateObserversFromParticleSubtrackEndingGlobalEvent(
                                                       particle,
                                                       track_start_position,
                                                       particle.getPosition() );
+  }
 
   global_subtrack_ending_event_dispatched = true;
 }
 
+// Check if a particle enters a DXTRAN sphere (the particle will be killed)
+/*! \details Only a particle whose flight is represented by DXTRAN particles
+ * will be killed when it enters a DXTRAN sphere. The particle will be
+ * advanced to the sphere before it is killed.
+ */
+template<typename State>
+bool ParticleSimulationManager::isParticleEnteringDXTRANSphere(
+                                   State& particle,
+                                   const double distance_to_surface_hit,
+                                   const double distance_to_collision_site,
+                                   const double track_start_position[3],
+                                   bool& global_subtrack_ending_event_dispatched )
+{
+  if( !particle.isRepresentedByDXTRANParticles() || !d_dxtran_spheres )
+    return false;
+
+  const double distance_to_sphere =
+    d_dxtran_spheres->getDistanceToSphereEntry( particle );
+
+  if( distance_to_sphere < distance_to_surface_hit &&
+      distance_to_sphere < distance_to_collision_site )
+  {
+    this->advanceParticleToCollisionSite( particle,
+                                          0.0,
+                                          distance_to_sphere,
+                                          track_start_position,
+                                          global_subtrack_ending_event_dispatched );
+
+    particle.setAsGone();
+
+    return true;
+  }
+  else
+    return false;
+}
+
 // Collide with the cell material
+/*! \details The particle colliding in cell event observers (e.g. cell
+ * collision flux estimators and point detectors) will be updated before the
+ * collision occurs (the observers need the pre-collision state). The DXTRAN particles of the collision are also created before the
+ * collision occurs.
+ */
 template<typename State>
-void ParticleSimulationManager::collideWithCellMaterial( State& particle,
-                                                         ParticleBank& bank )
+void ParticleSimulationManager::collideWithCellMaterial(
+                                   State& particle,
+                                   const double cell_total_macro_cross_section,
+                                   ParticleBank& bank )
 {
+  {
+    FRENSIE_PROFILE_TRANSPORT_STAGE( PARTICLE_COLLIDING_IN_CELL_DISPATCH_STAGE );
+
+    d_event_handler->updateObserversFromParticleCollidingInCellEvent(
+                                          particle,
+                                          1.0/cell_total_macro_cross_section );
+  }
+
+  // The post-collision flight will be represented by the DXTRAN particles
+  if( d_dxtran_spheres )
+  {
+    if( d_dxtran_spheres->hasSpheres( particle.getParticleType() ) )
+    {
+      d_dxtran_spheres->createDXTRANParticles(
+                                          particle,
+                                          1.0/cell_total_macro_cross_section,
+                                          bank );
+
+      particle.setRepresentedByDXTRANParticles( true );
+    }
+  }
+
   ParticleBank local_bank;
 
   // Undergo a collision with the material in the cell
   try{
+    FRENSIE_PROFILE_TRANSPORT_COLLISION( particle.getParticleType() );
+
     d_collision_kernel->collideWithCellMaterial( particle, local_bank );
   }
   CATCH_LOST_PARTICLE( particle );
@@ -655,6 +812,8 @@ void ParticleSimulationManager::collideWithCellMaterial( State& particle,
   // population manager for now. Needs to be fixed later if desired.
   if( particle )
   {
+    FRENSIE_PROFILE_TRANSPORT_STAGE( POPULATION_CONTROL_STAGE );
+
     d_population_controller->checkParticleWithPopulationController( particle, bank );
   }
 
@@ -664,6 +823,8 @@ void ParticleSimulationManager::collideWithCellMaterial( State& particle,
 
     if( local_bank.top() )
     {
+      FRENSIE_PROFILE_TRANSPORT_STAGE( POPULATION_CONTROL_STAGE );
+
       d_population_controller->checkParticleWithPopulationController( local_bank.top(),
                                                                       split_particle_bank );
     }
@@ -671,11 +832,14 @@ void ParticleSimulationManager::collideWithCellMaterial( State& particle,
     std::shared_ptr<ParticleState> local_particle;
 
     local_bank.pop( local_particle );
+    FRENSIE_COUNT_TRANSPORT_STAGE( BANK_POP_STAGE );
 
     // If the particle wasn't terminated, add it to the bank
     if( local_particle )
     {
       bank.push( local_particle );
+      FRENSIE_COUNT_TRANSPORT_STAGE( BANK_PUSH_STAGE );
+
       bank.splice( split_particle_bank );
     }
   }
@@ -0,0 +1,464 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstKEigenvalueParticleSimulationManager.cpp
+//! \author Alex Robinson
+//! \brief  The k-eigenvalue particle simulation manager unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+#include <cmath>
+
+// Boost Includes
+#include <boost/filesystem.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleSimulationManagerFactory.hpp"
+#include "MonteCarlo_KEigenvalueParticleSimulationManager.hpp"
+#include "MonteCarlo_StandardParticleSource.hpp"
+#include "MonteCarlo_StandardParticleSourceComponent.hpp"
+#include "MonteCarlo_StandardParticleDistribution.hpp"
+#include "Data_ScatteringCenterPropertiesDatabase.hpp"
+#include "Geometry_InfiniteMediumModel.hpp"
+#include "Utility_GlobalMPISession.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+#include "FRENSIE_config.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+using boost::units::si::kelvin;
+using boost::units::cgs::cubic_centimeter;
+using Utility::Units::MeV;
+
+typedef MonteCarlo::KEigenvalueParticleSimulationManager<MonteCarlo::NEUTRON_MODE> KEigenvalueManager;
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+std::string test_scattering_center_database_name;
+
+std::shared_ptr<MonteCarlo::ScatteringCenterDefinitionDatabase>
+scattering_center_definition_database;
+
+std::shared_ptr<MonteCarlo::MaterialDefinitionDatabase>
+material_definition_database;
+
+std::shared_ptr<const Geometry::Model> unfilled_model;
+
+std::shared_ptr<const MonteCarlo::ParticleDistribution> particle_distribution;
+
+int threads;
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Create the k-eigenvalue simulation properties
+std::shared_ptr<MonteCarlo::SimulationProperties> createProperties(
+                                             const uint64_t histories_per_cycle,
+                                             const uint64_t inactive_cycles,
+                                             const uint64_t active_cycles )
+{
+  std::shared_ptr<MonteCarlo::SimulationProperties> properties(
+                                        new MonteCarlo::SimulationProperties );
+  properties->setParticleMode( MonteCarlo::NEUTRON_MODE );
+  properties->setKEigenvalueModeOn();
+  properties->setNumberOfHistoriesPerCycle( histories_per_cycle );
+  properties->setNumberOfInactiveCycles( inactive_cycles );
+  properties->setNumberOfActiveCycles( active_cycles );
+
+  return properties;
+}
+
+// Create the k-eigenvalue simulation manager factory
+std::unique_ptr<MonteCarlo::ParticleSimulationManagerFactory> createFactory(
+         const std::shared_ptr<const MonteCarlo::SimulationProperties>& properties,
+         const std::string& simulation_name,
+         const unsigned number_of_threads )
+{
+  std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                               new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        unfilled_model,
+                                        false ) );
+
+  std::shared_ptr<MonteCarlo::ParticleSource> source;
+
+  {
+    std::shared_ptr<MonteCarlo::ParticleSourceComponent>
+      source_component( new MonteCarlo::StandardNeutronSourceComponent(
+                                                     0,
+                                                     1.0,
+                                                     unfilled_model,
+                                                     particle_distribution ) );
+
+    source.reset( new MonteCarlo::StandardParticleSource( {source_component} ) );
+  }
+
+  std::shared_ptr<MonteCarlo::EventHandler> event_handler(
+                                 new MonteCarlo::EventHandler( *properties ) );
+
+  return std::unique_ptr<MonteCarlo::ParticleSimulationManagerFactory>(
+            new MonteCarlo::ParticleSimulationManagerFactory( model,
+                                                              source,
+                                                              event_handler,
+                                                              properties,
+                                                              simulation_name,
+                                                              "xml",
+                                                              number_of_threads ) );
+}
+
+// Create a (serial) k-eigenvalue simulation manager on every process
+std::shared_ptr<KEigenvalueManager> createSerialManager(
+         const std::shared_ptr<const MonteCarlo::SimulationProperties>& properties,
+         const std::string& simulation_name )
+{
+  std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                               new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        unfilled_model,
+                                        false ) );
+
+  std::shared_ptr<MonteCarlo::ParticleSource> source;
+
+  {
+    std::shared_ptr<MonteCarlo::ParticleSourceComponent>
+      source_component( new MonteCarlo::StandardNeutronSourceComponent(
+                                                     0,
+                                                     1.0,
+                                                     unfilled_model,
+                                                     particle_distribution ) );
+
+    source.reset( new MonteCarlo::StandardParticleSource( {source_component} ) );
+  }
+
+  std::shared_ptr<MonteCarlo::EventHandler> event_handler(
+                                 new MonteCarlo::EventHandler( *properties ) );
+
+  // Each process gets its own communicator
+  std::shared_ptr<const Utility::Communicator> comm =
+    Utility::Communicator::getDefault();
+
+  std::shared_ptr<const Utility::Communicator> serial_comm =
+    comm->split( comm->rank() );
+
+  Utility::OpenMPProperties::setNumberOfThreads( 1 );
+
+  return std::shared_ptr<KEigenvalueManager>(
+             new KEigenvalueManager( simulation_name + "_" +
+                                     Utility::toString( comm->rank() ),
+                                     "xml",
+                                     model,
+                                     source,
+                                     event_handler,
+                                     MonteCarlo::PopulationControl::getDefault(),
+                                     MonteCarlo::CollisionForcer::getDefault(),
+                                     properties,
+                                     0,
+                                     0,
+                                     true,
+                                     serial_comm ) );
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the factory creates a k-eigenvalue manager
+FRENSIE_UNIT_TEST( KEigenvalueParticleSimulationManager, factory_create )
+{
+  std::unique_ptr<MonteCarlo::ParticleSimulationManagerFactory> factory =
+    createFactory( createProperties( 20, 1, 1 ), "test_k_sim", threads );
+
+  std::shared_ptr<KEigenvalueManager> manager =
+    std::dynamic_pointer_cast<KEigenvalueManager>( factory->getManager() );
+
+  FRENSIE_REQUIRE( manager.get() != NULL );
+  FRENSIE_CHECK_EQUAL( manager->getNumberOfCompletedCycles(), 0 );
+  FRENSIE_CHECK( manager->getCycleKEigenvalues().empty() );
+  FRENSIE_CHECK( manager->getCycleShannonEntropies().empty() );
+  FRENSIE_CHECK_EQUAL( manager->getKEigenvalue(), 0.0 );
+  FRENSIE_CHECK_EQUAL( manager->getKEigenvalueStandardDeviation(), 0.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the cycle k-eigenvalue estimates can be calculated
+FRENSIE_UNIT_TEST( KEigenvalueParticleSimulationManager, runSimulation_cycle_k )
+{
+  std::unique_ptr<MonteCarlo::ParticleSimulationManagerFactory> factory =
+    createFactory( createProperties( 100, 2, 4 ), "test_k_sim", threads );
+
+  std::shared_ptr<KEigenvalueManager> manager =
+    std::dynamic_pointer_cast<KEigenvalueManager>( factory->getManager() );
+
+  FRENSIE_REQUIRE_NO_THROW( manager->runSimulation() );
+
+  FRENSIE_REQUIRE_EQUAL( manager->getNumberOfCompletedCycles(), 6 );
+  FRENSIE_REQUIRE_EQUAL( manager->getCycleKEigenvalues().size(), 6 );
+  FRENSIE_REQUIRE_EQUAL( manager->getCycleShannonEntropies().size(), 6 );
+
+  // An infinite medium of U-238 is subcritical
+  const std::vector<double>& cycle_k = manager->getCycleKEigenvalues();
+
+  for( size_t i = 0; i < cycle_k.size(); ++i )
+  {
+    FRENSIE_CHECK_GREATER( cycle_k[i], 0.0 );
+    FRENSIE_CHECK_LESS( cycle_k[i], 1.0 );
+  }
+
+  // The mean only includes the active cycles
+  double mean = 0.0;
+
+  for( size_t i = 2; i < cycle_k.size(); ++i )
+    mean += cycle_k[i];
+
+  mean /= 4.0;
+
+  double variance = 0.0;
+
+  for( size_t i = 2; i < cycle_k.size(); ++i )
+    variance += (cycle_k[i] - mean)*(cycle_k[i] - mean);
+
+  variance /= 4.0*3.0;
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( manager->getKEigenvalue(), mean, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( manager->getKEigenvalueStandardDeviation(),
+                                   std::sqrt( variance ),
+                                   1e-12 );
+
+  // The entropy is bounded by the number of mesh elements (2^3 elements for
+  // 100 histories per cycle)
+  const std::vector<double>& cycle_entropies =
+    manager->getCycleShannonEntropies();
+
+  for( size_t i = 0; i < cycle_entropies.size(); ++i )
+  {
+    FRENSIE_CHECK_GREATER_OR_EQUAL( cycle_entropies[i], 0.0 );
+    FRENSIE_CHECK_LESS_OR_EQUAL( cycle_entropies[i], std::log2( 8.0 ) );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that the cycle results are independent of the number of threads and
+// processes (the resampled fission sites must be exchanged between the
+// processes in global history order)
+FRENSIE_UNIT_TEST( KEigenvalueParticleSimulationManager,
+                   runSimulation_reproducible )
+{
+  // Note: The number of histories per cycle is not a multiple of the number
+  //       of processes or threads so the history slices are uneven
+  std::shared_ptr<KEigenvalueManager> serial_manager =
+    createSerialManager( createProperties( 101, 1, 3 ), "test_k_serial" );
+
+  FRENSIE_REQUIRE_NO_THROW( serial_manager->runSimulation() );
+
+  std::unique_ptr<MonteCarlo::ParticleSimulationManagerFactory> factory =
+    createFactory( createProperties( 101, 1, 3 ), "test_k_sim", threads );
+
+  std::shared_ptr<KEigenvalueManager> manager =
+    std::dynamic_pointer_cast<KEigenvalueManager>( factory->getManager() );
+
+  FRENSIE_REQUIRE_NO_THROW( manager->runSimulation() );
+
+  FRENSIE_REQUIRE_EQUAL( manager->getNumberOfCompletedCycles(),
+                         serial_manager->getNumberOfCompletedCycles() );
+
+  // Only the order of the global weight summation can differ
+  FRENSIE_CHECK_FLOATING_EQUALITY( manager->getCycleKEigenvalues(),
+                                   serial_manager->getCycleKEigenvalues(),
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( manager->getCycleShannonEntropies(),
+                                   serial_manager->getCycleShannonEntropies(),
+                                   1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a k-eigenvalue simulation can be restarted at the next cycle
+FRENSIE_UNIT_TEST( KEigenvalueParticleSimulationManager, restart )
+{
+  std::vector<double> reference_cycle_k, reference_cycle_entropies;
+
+  {
+    std::unique_ptr<MonteCarlo::ParticleSimulationManagerFactory> factory =
+      createFactory( createProperties( 50, 2, 4 ), "test_k_sim", threads );
+
+    std::shared_ptr<KEigenvalueManager> manager =
+      std::dynamic_pointer_cast<KEigenvalueManager>( factory->getManager() );
+
+    FRENSIE_REQUIRE_NO_THROW( manager->runSimulation() );
+
+    reference_cycle_k = manager->getCycleKEigenvalues();
+    reference_cycle_entropies = manager->getCycleShannonEntropies();
+  }
+
+  // Only run the first two active cycles
+  {
+    std::unique_ptr<MonteCarlo::ParticleSimulationManagerFactory> factory =
+      createFactory( createProperties( 50, 2, 2 ), "test_k_restart", threads );
+
+    std::shared_ptr<KEigenvalueManager> manager =
+      std::dynamic_pointer_cast<KEigenvalueManager>( factory->getManager() );
+
+    FRENSIE_REQUIRE_NO_THROW( manager->runSimulation() );
+
+    FRENSIE_REQUIRE_EQUAL( manager->getNumberOfCompletedCycles(), 4 );
+  }
+
+  // Restart the simulation with two additional active cycles
+  MonteCarlo::SimulationGeneralProperties updated_properties;
+  updated_properties.setNumberOfActiveCycles( 4 );
+
+  std::unique_ptr<MonteCarlo::ParticleSimulationManagerFactory> factory;
+
+  FRENSIE_REQUIRE_NO_THROW( factory.reset( new MonteCarlo::ParticleSimulationManagerFactory( "test_k_restart_rendezvous.xml", updated_properties, (unsigned)threads ) ) );
+
+  std::shared_ptr<KEigenvalueManager> manager =
+    std::dynamic_pointer_cast<KEigenvalueManager>( factory->getManager() );
+
+  FRENSIE_REQUIRE( manager.get() != NULL );
+
+  // The restarted simulation resumes at the next cycle
+  FRENSIE_REQUIRE_EQUAL( manager->getNumberOfCompletedCycles(), 4 );
+
+  manager->initialize();
+
+  FRENSIE_REQUIRE_NO_THROW( manager->runSimulation() );
+
+  FRENSIE_REQUIRE_EQUAL( manager->getNumberOfCompletedCycles(), 6 );
+  FRENSIE_CHECK_EQUAL( manager->getCycleKEigenvalues(), reference_cycle_k );
+  FRENSIE_CHECK_EQUAL( manager->getCycleShannonEntropies(),
+                       reference_cycle_entropies );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a k-eigenvalue simulation can be restarted from a rendezvous
+// that was done between cycles
+FRENSIE_UNIT_TEST( KEigenvalueParticleSimulationManager, restart_mid_run )
+{
+  std::vector<double> reference_cycle_k, reference_cycle_entropies;
+
+  // Note: With 300 histories and 3 rendezvous the rendezvous batch size is
+  //       100 histories (one rendezvous every 2 cycles)
+  {
+    std::shared_ptr<MonteCarlo::SimulationProperties> properties =
+      createProperties( 50, 2, 4 );
+    properties->setMinNumberOfRendezvous( 3 );
+
+    std::unique_ptr<MonteCarlo::ParticleSimulationManagerFactory> factory =
+      createFactory( properties, "test_k_mid_run", threads );
+
+    std::shared_ptr<KEigenvalueManager> manager =
+      std::dynamic_pointer_cast<KEigenvalueManager>( factory->getManager() );
+
+    manager->useMultipleRendezvousFiles();
+
+    FRENSIE_REQUIRE_NO_THROW( manager->runSimulation() );
+
+    FRENSIE_REQUIRE_EQUAL( manager->getNumberOfCompletedCycles(), 6 );
+    FRENSIE_CHECK_EQUAL( manager->getNumberOfRendezvous(), 4 );
+
+    reference_cycle_k = manager->getCycleKEigenvalues();
+    reference_cycle_entropies = manager->getCycleShannonEntropies();
+  }
+
+  // Restart the simulation from the rendezvous after the inactive cycles
+  std::unique_ptr<MonteCarlo::ParticleSimulationManagerFactory> factory;
+
+  FRENSIE_REQUIRE_NO_THROW( factory.reset( new MonteCarlo::ParticleSimulationManagerFactory( "test_k_mid_run_rendezvous_1.xml", (unsigned)threads ) ) );
+
+  std::shared_ptr<KEigenvalueManager> manager =
+    std::dynamic_pointer_cast<KEigenvalueManager>( factory->getManager() );
+
+  FRENSIE_REQUIRE( manager.get() != NULL );
+
+  // The restarted simulation resumes at the first active cycle
+  FRENSIE_REQUIRE_EQUAL( manager->getNumberOfCompletedCycles(), 2 );
+
+  manager->initialize();
+
+  FRENSIE_REQUIRE_NO_THROW( manager->runSimulation() );
+
+  FRENSIE_REQUIRE_EQUAL( manager->getNumberOfCompletedCycles(), 6 );
+  FRENSIE_CHECK_EQUAL( manager->getCycleKEigenvalues(), reference_cycle_k );
+  FRENSIE_CHECK_EQUAL( manager->getCycleShannonEntropies(),
+                       reference_cycle_entropies );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_COMMAND_LINE_OPTIONS()
+{
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "test_database",
+                                        test_scattering_center_database_name, "",
+                                        "Test scattering center database name "
+                                        "with path" );
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "threads",
+                                        threads, 1,
+                                        "Number of threads to use" );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  {
+    // Determine the database directory
+    boost::filesystem::path database_path =
+      test_scattering_center_database_name;
+
+    // Load the database
+    const Data::ScatteringCenterPropertiesDatabase database( database_path );
+
+    const Data::NuclideProperties& u238_properties =
+      database.getNuclideProperties( 92238 );
+
+    // Set the scattering center definitions
+    scattering_center_definition_database.reset(
+                          new MonteCarlo::ScatteringCenterDefinitionDatabase );
+
+    MonteCarlo::ScatteringCenterDefinition& u_definition =
+      scattering_center_definition_database->createDefinition( "U238 @ 293.6K", 92238 );
+
+    u_definition.setNuclearDataProperties(
+          u238_properties.getSharedNuclearDataProperties(
+                                         Data::NuclearDataProperties::ACE_FILE,
+                                         7,
+                                         2.53010E-08*MeV,
+                                         true ) );
+
+    material_definition_database.reset(
+                                  new MonteCarlo::MaterialDefinitionDatabase );
+
+    material_definition_database->addDefinition( "U238 @ 293.6K", 1,
+                                                 {"U238 @ 293.6K"}, {1.0} );
+  }
+
+  unfilled_model.reset(
+           new Geometry::InfiniteMediumModel( 1, 1, -19.1/cubic_centimeter ) );
+
+  {
+    std::shared_ptr<MonteCarlo::StandardParticleDistribution>
+      tmp_particle_distribution( new MonteCarlo::StandardParticleDistribution( "test dist" ) );
+
+    // Fission source energy (above the U-238 fission threshold)
+    tmp_particle_distribution->setEnergy( 2.0 );
+
+    particle_distribution = tmp_particle_distribution;
+  }
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstKEigenvalueParticleSimulationManager.cpp
+//---------------------------------------------------------------------------//
@@ -21,6 +21,7 @@
 #include "MonteCarlo_StandardParticleSourceComponent.hpp"
 #include "MonteCarlo_StandardAdjointParticleSourceComponent.hpp"
 #include "MonteCarlo_StandardParticleDistribution.hpp"
+#include "MonteCarlo_CellCollisionFluxEstimator.hpp"
 #include "Data_ScatteringCenterPropertiesDatabase.hpp"
 #include "Geometry_InfiniteMediumModel.hpp"
 #include "Utility_UnitTestHarnessWithMain.hpp"
@@ -924,6 +925,84 @@ FRENSIE_UNIT_TEST( ParticleSimulationManager, runSimulation_history_wall )
   FRENSIE_CHECK_EQUAL( manager->getNumberOfRendezvous(), 2 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that a cell collision flux estimator scores during a simulation
+FRENSIE_UNIT_TEST( ParticleSimulationManager,
+                   runSimulation_cell_collision_estimator )
+{
+  std::shared_ptr<MonteCarlo::ParticleSimulationManager> manager;
+
+  std::shared_ptr<MonteCarlo::CellCollisionFluxEstimator<MonteCarlo::WeightMultiplier> >
+    estimator( new MonteCarlo::CellCollisionFluxEstimator<MonteCarlo::WeightMultiplier>(
+                                                 0,
+                                                 1.0,
+                                                 std::vector<Geometry::Model::EntityId>( {1} ),
+                                                 std::vector<double>( {1.0} ) ) );
+
+  estimator->setParticleTypes( std::vector<MonteCarlo::ParticleType>( {MonteCarlo::PHOTON} ) );
+
+  {
+    std::shared_ptr<MonteCarlo::SimulationProperties> properties(
+                                        new MonteCarlo::SimulationProperties );
+    properties->setParticleMode( MonteCarlo::PHOTON_MODE );
+    properties->setNumberOfHistories( 5 );
+
+    std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                               new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        unfilled_model,
+                                        false ) );
+
+    std::shared_ptr<MonteCarlo::ParticleSource> source;
+
+    {
+      std::shared_ptr<MonteCarlo::ParticleSourceComponent>
+        source_component( new MonteCarlo::StandardPhotonSourceComponent(
+                                                     0,
+                                                     1.0,
+                                                     unfilled_model,
+                                                     particle_distribution ) );
+
+      source.reset( new MonteCarlo::StandardParticleSource( {source_component} ) );
+    }
+
+    std::shared_ptr<MonteCarlo::EventHandler> event_handler(
+                                 new MonteCarlo::EventHandler( *properties ) );
+
+    event_handler->addEstimator( estimator );
+
+    std::unique_ptr<MonteCarlo::ParticleSimulationManagerFactory> factory;
+
+    factory.reset(
+            new MonteCarlo::ParticleSimulationManagerFactory( model,
+                                                              source,
+                                                              event_handler,
+                                                              properties,
+                                                              "test_sim",
+                                                              "xml",
+                                                              threads ) );
+
+    manager = factory->getManager();
+  }
+
+  FRENSIE_REQUIRE_NO_THROW( manager->runSimulation() );
+
+  // Every photon collides in the infinite medium cell
+  Utility::ArrayView<const double> first_moments =
+    estimator->getTotalBinDataFirstMoments();
+
+  FRENSIE_REQUIRE_EQUAL( first_moments.size(), 1 );
+  FRENSIE_CHECK( first_moments[0] > 0.0 );
+
+  Utility::ArrayView<const double> cell_first_moments =
+    estimator->getEntityBinDataFirstMoments( 1 );
+
+  FRENSIE_CHECK_EQUAL( cell_first_moments[0], first_moments[0] );
+}
+
 //---------------------------------------------------------------------------//
 // Check that a simulation can be run
 FRENSIE_UNIT_TEST( ParticleSimulationManager, runSimulation_wall_time )
@@ -38,10 +38,14 @@ template<class Archive> class interface_oarchive;
 namespace Utility{
 
 /*! HDF5 output archive flags
+ *
+ * When the COMPRESS_LARGE_DATA_SETS flag is used, large data sets (e.g. the
+ * estimator moment arrays) will be chunked and compressed.
  * \ingroup hdf5
  */
 enum HDF5OArchiveFlags{
-  OVERWRITE_EXISTING_ARCHIVE = 16
+  OVERWRITE_EXISTING_ARCHIVE = 16,
+  COMPRESS_LARGE_DATA_SETS = 32
 };
 
 /*! The HDF5 output archive implementation
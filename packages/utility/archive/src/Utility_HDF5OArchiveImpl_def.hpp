@@ -37,6 +37,11 @@ HDF5OArchiveImpl<Archive>::HDF5OArchiveImpl( const std::string& hdf5_filename,
 template<typename Archive>
 void HDF5OArchiveImpl<Archive>::init( unsigned flags )
 {
+  // A fast deflate level is used since the shuffle filter does most of the
+  // work for the floating point data that dominates large archives
+  if( flags & HDF5OArchiveFlags::COMPRESS_LARGE_DATA_SETS )
+    this->setDataSetCompressionLevel( 1 );
+
   // Add a header to the archive
   if( !(flags & boost::archive::no_header ) )
   {
@@ -37,6 +37,7 @@ public:
 
   //! Constructor
   OArchivableObject()
+    : d_compress_large_hdf5_data_sets( false )
   { /* ... */ }
 
   //! Destructor
@@ -50,6 +51,15 @@ public:
   void saveToFile( const boost::filesystem::path& archive_name_with_path,
                    const bool overwrite = false ) const;
 
+  //! Compress the large data sets of .h5fa archives
+  void setLargeHDF5DataSetCompressionOn();
+
+  //! Do not compress the large data sets of .h5fa archives (default)
+  void setLargeHDF5DataSetCompressionOff();
+
+  //! Check if the large data sets of .h5fa archives will be compressed
+  bool isLargeHDF5DataSetCompressionOn() const;
+
 protected:
 
   //! Archive the object (implementation)
@@ -69,6 +79,9 @@ private:
   // Archive the object using the required archive
   template<typename Archive>
   void saveToArchive( Archive& archive ) const;
+
+  // Compress the large data sets of .h5fa archives
+  bool d_compress_large_hdf5_data_sets;
 };
   
 } // end Utility namespace
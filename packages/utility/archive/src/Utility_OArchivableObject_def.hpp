@@ -25,7 +25,8 @@ namespace Utility{
 
 // Archive the object
 /*! \details The file extension will be used to determine the archive type
- * (e.g. .xml, .txt, .bin, .h5fa)
+ * (e.g. .xml, .txt, .bin, .h5fa). Large data sets in .h5fa archives will
+ * only be compressed if large HDF5 data set compression has been turned on.
  */
 template<typename DerivedType>
 void OArchivableObject<DerivedType>::saveToFile(
@@ -35,6 +36,31 @@ void OArchivableObject<DerivedType>::saveToFile(
   this->saveToFileImpl( archive_name_with_path, overwrite );
 }
 
+// Compress the large data sets of .h5fa archives
+/*! \details Compression reduces the file size of archives that contain
+ * large arrays (e.g. estimator moments) at the cost of a slower write and
+ * read. It is off by default.
+ */
+template<typename DerivedType>
+void OArchivableObject<DerivedType>::setLargeHDF5DataSetCompressionOn()
+{
+  d_compress_large_hdf5_data_sets = true;
+}
+
+// Do not compress the large data sets of .h5fa archives (default)
+template<typename DerivedType>
+void OArchivableObject<DerivedType>::setLargeHDF5DataSetCompressionOff()
+{
+  d_compress_large_hdf5_data_sets = false;
+}
+
+// Check if the large data sets of .h5fa archives will be compressed
+template<typename DerivedType>
+bool OArchivableObject<DerivedType>::isLargeHDF5DataSetCompressionOn() const
+{
+  return d_compress_large_hdf5_data_sets;
+}
+
 // Archive the object (implementation)
 /*! \details The file extension will be used to determine the archive type
  * (e.g. .xml, .txt, .bin, .h5fa)
@@ -103,8 +129,12 @@ void OArchivableObject<DerivedType>::saveToFileImpl(
 #ifdef HAVE_FRENSIE_HDF5
   else if( extension == ".h5fa" )
   {
-    Utility::HDF5OArchive archive( archive_name_with_path.string(),
-                                   Utility::HDF5OArchiveFlags::OVERWRITE_EXISTING_ARCHIVE );
+    unsigned flags = Utility::HDF5OArchiveFlags::OVERWRITE_EXISTING_ARCHIVE;
+
+    if( d_compress_large_hdf5_data_sets )
+      flags |= Utility::HDF5OArchiveFlags::COMPRESS_LARGE_DATA_SETS;
+
+    Utility::HDF5OArchive archive( archive_name_with_path.string(), flags );
 
     this->saveToArchive( archive );
   }
@@ -6,6 +6,9 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Std Lib Includes
+#include <algorithm>
+
 // FRENSIE Includes
 #include "Utility_HDF5File.hpp"
 #include "Utility_LoggingMacros.hpp"
@@ -86,6 +89,9 @@ std::string HDF5File::Exception::createErrorMessage(
 HDF5File::HDF5File( const std::string& filename,
                     const HDF5File::OpenMode mode )
   : d_filename( filename ),
+    d_compression_level( 0 ),
+    d_min_compressed_data_set_size( 16384 ),
+    d_max_data_set_chunk_size( 1048576 ),
     d_hdf5_file()
 {
 #ifdef HAVE_FRENSIE_HDF5
@@ -140,6 +146,83 @@ const std::string& HDF5File::getFilename() const throw()
   return d_filename;
 }
 
+// Set the data set compression (deflate) level (0 = no compression)
+/*! \details The compression level must be in [0,9]. Higher levels result in
+ * smaller files but slower writes. Only data sets that are created after
+ * the level has been set will be affected. If the deflate filter is not
+ * available in the HDF5 library the data sets will not be compressed.
+ */
+void HDF5File::setDataSetCompressionLevel( const unsigned compression_level )
+{
+  TEST_FOR_EXCEPTION( compression_level > 9,
+                      HDF5File::Exception,
+                      "The data set compression level must be in [0,9]!" );
+
+  d_compression_level = compression_level;
+}
+
+// Return the data set compression (deflate) level
+unsigned HDF5File::getDataSetCompressionLevel() const
+{
+  return d_compression_level;
+}
+
+// Set the min size (bytes) of a data set that will be compressed
+/*! \details Small data sets (e.g. the archive tree data) are not worth
+ * compressing since the chunk index overhead is larger than the savings.
+ */
+void HDF5File::setMinCompressedDataSetSize( const size_t min_size )
+{
+  d_min_compressed_data_set_size = min_size;
+}
+
+// Return the min size (bytes) of a data set that will be compressed
+size_t HDF5File::getMinCompressedDataSetSize() const
+{
+  return d_min_compressed_data_set_size;
+}
+
+// Set the max size (bytes) of a compressed data set chunk
+/*! \details The default max chunk size is the default size of the HDF5
+ * chunk cache (1 MB) so that a chunk never has to be reread while it is
+ * being decompressed.
+ */
+void HDF5File::setMaxDataSetChunkSize( const size_t max_chunk_size )
+{
+  TEST_FOR_EXCEPTION( max_chunk_size == 0,
+                      HDF5File::Exception,
+                      "The max data set chunk size must be greater than 0!" );
+
+  d_max_data_set_chunk_size = max_chunk_size;
+}
+
+// Return the max size (bytes) of a compressed data set chunk
+size_t HDF5File::getMaxDataSetChunkSize() const
+{
+  return d_max_data_set_chunk_size;
+}
+
+// Check if a data set is compressed
+bool HDF5File::isDataSetCompressed( const std::string& path_to_data_set ) const
+{
+#ifdef HAVE_FRENSIE_HDF5
+  std::unique_ptr<const H5::DataSet> data_set;
+
+  this->openDataSet( path_to_data_set, data_set );
+
+  try{
+    H5::DSetCreatPropList property_list = data_set->getCreatePlist();
+
+    return property_list.getLayoutType() == H5D_CHUNKED &&
+      property_list.getNfilters() > 0;
+  }
+  HDF5_EXCEPTION_CATCH( "Could not determine if data set "
+                        << path_to_data_set << " is compressed!" );
+#else
+  return false;
+#endif // end HAVE_FRENSIE_HDF5
+}
+
 // Check if the group exists
 bool HDF5File::doesGroupExist( const std::string& path_to_group ) const throw()
 {
@@ -516,6 +599,43 @@ void HDF5File::openDataSet( const std::string& path_to_data_set,
                         << path_to_data_set << "!" );
 }
 
+// Initialize the data set creation property list
+/*! \details The default property list (contiguous layout) will be used
+ * unless compression has been turned on and the data set is large enough.
+ * The shuffle filter groups the bytes of the elements by significance
+ * before they are deflated, which improves the compression of the
+ * floating point moment arrays considerably.
+ */
+void HDF5File::initializeDataSetCreationPropertyList(
+                                 const hsize_t data_set_size,
+                                 const size_t data_set_element_size,
+                                 H5::DSetCreatPropList& property_list ) const
+{
+  if( d_compression_level == 0 || data_set_size == 0 )
+    return;
+
+  if( data_set_size*data_set_element_size < d_min_compressed_data_set_size )
+    return;
+
+  // The deflate filter is optional in HDF5 builds
+  if( H5Zfilter_avail( H5Z_FILTER_DEFLATE ) <= 0 )
+    return;
+
+  hsize_t chunk_size =
+    std::max( d_max_data_set_chunk_size/data_set_element_size, (size_t)1 );
+
+  if( chunk_size > data_set_size )
+    chunk_size = data_set_size;
+
+  try{
+    property_list.setChunk( 1, &chunk_size );
+    property_list.setShuffle();
+    property_list.setDeflate( d_compression_level );
+  }
+  HDF5_EXCEPTION_CATCH( "Could not initialize the compressed data set "
+                        "creation property list!" );
+}
+
 // Open a data set attribute
 void HDF5File::openDataSetAttribute( const H5::DataSet& data_set,
                                      const std::string& path_to_data_set,
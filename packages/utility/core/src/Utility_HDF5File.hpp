@@ -28,7 +28,11 @@ namespace Utility{
  * 
  * This class wraps the H5::File object and provides a simplified interface
  * for querying file properties and for reading from and writing to files. 
- * Objects of this class cannot be copied - use smart pointers instead.
+ * Objects of this class cannot be copied - use smart pointers instead. Data
+ * sets are contiguous by default. When data set compression is turned on,
+ * data sets that are at least as large as the min compressed data set size
+ * will be chunked and compressed (shuffle and deflate filters). Compressed
+ * data sets are read transparently.
  * \ingroup hdf5
  */
 class HDF5File : private boost::noncopyable
@@ -84,6 +88,27 @@ public:
                                      const std::string& path_to_group,
                                      const std::string& attribute_name ) const;
 
+  //! Set the data set compression (deflate) level (0 = no compression)
+  void setDataSetCompressionLevel( const unsigned compression_level );
+
+  //! Return the data set compression (deflate) level
+  unsigned getDataSetCompressionLevel() const;
+
+  //! Set the min size (bytes) of a data set that will be compressed
+  void setMinCompressedDataSetSize( const size_t min_size );
+
+  //! Return the min size (bytes) of a data set that will be compressed
+  size_t getMinCompressedDataSetSize() const;
+
+  //! Set the max size (bytes) of a compressed data set chunk
+  void setMaxDataSetChunkSize( const size_t max_chunk_size );
+
+  //! Return the max size (bytes) of a compressed data set chunk
+  size_t getMaxDataSetChunkSize() const;
+
+  //! Check if a data set is compressed
+  bool isDataSetCompressed( const std::string& path_to_data_set ) const;
+
   //! Create a group
   void createGroup( const std::string& path_to_group );
 
@@ -218,6 +243,12 @@ private:
   void openDataSet( const std::string& path_to_data_set,
                     std::unique_ptr<const H5::DataSet>& data_set ) const;
 
+  // Initialize the data set creation property list
+  void initializeDataSetCreationPropertyList(
+                                 const hsize_t data_set_size,
+                                 const size_t data_set_element_size,
+                                 H5::DSetCreatPropList& property_list ) const;
+
   // Create a data set attribute
   template<typename T>
   void createDataSetAttribute( const H5::DataSet& data_set,
@@ -289,6 +320,15 @@ private:
   // The filename
   std::string d_filename;
 
+  // The data set compression (deflate) level
+  unsigned d_compression_level;
+
+  // The min size (bytes) of a data set that will be compressed
+  size_t d_min_compressed_data_set_size;
+
+  // The max size (bytes) of a compressed data set chunk
+  size_t d_max_data_set_chunk_size;
+
   // The HDF5 file object
   std::unique_ptr<HDF5_ENABLED_DISABLED_SWITCH(H5::H5File,int)> d_hdf5_file;
 };
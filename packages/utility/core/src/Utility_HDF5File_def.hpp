@@ -24,6 +24,8 @@ namespace Utility{
  * reduced or freed. While increasing it is possible, data sets that allow this
  * operation use chunked data, which can incur a large performance penalty. 
  * Furthermore, it isn't obvious how we would determine the optimal chunk size.
+ * Large data sets will only be chunked if data set compression has been
+ * turned on (the chunks are never extended).
  */ 
 template<typename T>
 void HDF5File::writeToDataSet( const std::string& path_to_data_set,
@@ -328,10 +330,18 @@ void HDF5File::createDataSet( const std::string& path_to_data_set,
     
     H5::DataSpace space( 1, &data_set_size );
 
+    H5::DSetCreatPropList property_list;
+
+    this->initializeDataSetCreationPropertyList(
+                                 data_set_size,
+                                 HDF5TypeTraits<T>::dataType().getSize(),
+                                 property_list );
+
     data_set.reset( new H5::DataSet( d_hdf5_file->createDataSet(
                                                  path_to_data_set,
                                                  HDF5TypeTraits<T>::dataType(),
-                                                 space ) ) );
+                                                 space,
+                                                 property_list ) ) );
   }
   HDF5_EXCEPTION_CATCH( "Could not create data set "
                         << path_to_data_set << "!" );
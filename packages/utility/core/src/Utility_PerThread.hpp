@@ -0,0 +1,143 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_PerThread.hpp
+//! \author Alex Robinson
+//! \brief  The per-thread storage class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_PER_THREAD_HPP
+#define UTILITY_PER_THREAD_HPP
+
+// Std Lib Includes
+#include <cstddef>
+
+namespace Utility{
+
+/*! The per-thread storage class
+ *
+ * Each thread owns a single slot. Every slot is aligned to (and padded out
+ * to a multiple of) the cache line size so that frequently updated thread
+ * data (e.g. counters) never shares a cache line with the data of another
+ * thread. When the storage is (re)sized outside of a parallel block, each
+ * slot is constructed by the thread that owns it so that the slot (and any
+ * heap memory that the stored type acquires on construction) is placed
+ * according to the first-touch policy of the system.
+ */
+template<typename T>
+class PerThread
+{
+
+public:
+
+  //! The value type
+  typedef T value_type;
+
+  //! The reference type
+  typedef T& reference;
+
+  //! The const reference type
+  typedef const T& const_reference;
+
+  //! The size type
+  typedef std::size_t size_type;
+
+  //! The assumed cache line size (bytes)
+  static constexpr size_type cache_line_size = 64;
+
+  //! Default constructor (a single slot is created)
+  PerThread();
+
+  //! Constructor
+  explicit PerThread( const size_type threads, const T& value = T() );
+
+  //! Copy constructor
+  PerThread( const PerThread<T>& other );
+
+  //! Assignment operator
+  PerThread<T>& operator=( const PerThread<T>& other );
+
+  //! Destructor
+  ~PerThread();
+
+  //! Resize the storage (existing slot values will be preserved)
+  void resize( const size_type threads, const T& value = T() );
+
+  //! Return the number of slots
+  size_type size() const;
+
+  //! Return the slot of the requested thread
+  T& operator[]( const size_type thread_id );
+
+  //! Return the slot of the requested thread
+  const T& operator[]( const size_type thread_id ) const;
+
+  //! Return the slot of the calling thread
+  T& local();
+
+  //! Return the slot of the calling thread
+  const T& local() const;
+
+  //! Return the slot of the master thread
+  T& front();
+
+  //! Return the slot of the master thread
+  const T& front() const;
+
+  //! Set the value of every slot
+  void fill( const T& value );
+
+  //! Reduce the slot values
+  template<typename BinaryOperation>
+  T reduce( const T& initial_value, BinaryOperation operation ) const;
+
+private:
+
+  // The cache line aligned slot
+  struct alignas(cache_line_size) Slot
+  {
+    Slot( const T& initial_value )
+      : value( initial_value )
+    { /* ... */ }
+
+    T value;
+  };
+
+  // Create new slot storage (each slot is constructed by its thread)
+  static void createSlots( const size_type threads,
+                           const Slot* old_slots,
+                           const size_type old_size,
+                           const T& value,
+                           char*& raw_memory,
+                           Slot*& slots );
+
+  // Destroy slot storage
+  static void destroySlots( char* raw_memory,
+                            Slot* slots,
+                            const size_type size );
+
+  // The raw memory
+  char* d_raw_memory;
+
+  // The aligned slots
+  Slot* d_slots;
+
+  // The number of slots
+  size_type d_size;
+};
+
+} // end Utility namespace
+
+//---------------------------------------------------------------------------//
+// Template includes
+//---------------------------------------------------------------------------//
+
+#include "Utility_PerThread_def.hpp"
+
+//---------------------------------------------------------------------------//
+
+#endif // end UTILITY_PER_THREAD_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_PerThread.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,298 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_PerThread_def.hpp
+//! \author Alex Robinson
+//! \brief  The per-thread storage class definition
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_PER_THREAD_DEF_HPP
+#define UTILITY_PER_THREAD_DEF_HPP
+
+// Std Lib Includes
+#include <new>
+#include <memory>
+#include <exception>
+#include <algorithm>
+
+// FRENSIE Includes
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_DesignByContract.hpp"
+#include "FRENSIE_config.hpp"
+
+namespace Utility{
+
+// The assumed cache line size (bytes)
+template<typename T>
+constexpr typename PerThread<T>::size_type PerThread<T>::cache_line_size;
+
+// Default constructor
+template<typename T>
+PerThread<T>::PerThread()
+  : PerThread( 1 )
+{ /* ... */ }
+
+// Constructor
+template<typename T>
+PerThread<T>::PerThread( const size_type threads, const T& value )
+  : d_raw_memory( NULL ),
+    d_slots( NULL ),
+    d_size( 0 )
+{
+  // Make sure that the number of threads is valid
+  testPrecondition( threads > 0 );
+
+  PerThread<T>::createSlots( threads, NULL, 0, value, d_raw_memory, d_slots );
+
+  d_size = threads;
+}
+
+// Copy constructor
+template<typename T>
+PerThread<T>::PerThread( const PerThread<T>& other )
+  : d_raw_memory( NULL ),
+    d_slots( NULL ),
+    d_size( 0 )
+{
+  PerThread<T>::createSlots( other.d_size,
+                             other.d_slots,
+                             other.d_size,
+                             T(),
+                             d_raw_memory,
+                             d_slots );
+
+  d_size = other.d_size;
+}
+
+// Assignment operator
+template<typename T>
+PerThread<T>& PerThread<T>::operator=( const PerThread<T>& other )
+{
+  if( this != &other )
+  {
+    char* new_raw_memory;
+    Slot* new_slots;
+
+    PerThread<T>::createSlots( other.d_size,
+                               other.d_slots,
+                               other.d_size,
+                               T(),
+                               new_raw_memory,
+                               new_slots );
+
+    PerThread<T>::destroySlots( d_raw_memory, d_slots, d_size );
+
+    d_raw_memory = new_raw_memory;
+    d_slots = new_slots;
+    d_size = other.d_size;
+  }
+
+  return *this;
+}
+
+// Destructor
+template<typename T>
+PerThread<T>::~PerThread()
+{
+  PerThread<T>::destroySlots( d_raw_memory, d_slots, d_size );
+}
+
+// Resize the storage (existing slot values will be preserved)
+/*! \details Only the master thread should call this method. The new slots
+ * will be initialized with the value provided.
+ */
+template<typename T>
+void PerThread<T>::resize( const size_type threads, const T& value )
+{
+  // Make sure that the number of threads is valid
+  testPrecondition( threads > 0 );
+
+  if( threads != d_size )
+  {
+    char* new_raw_memory;
+    Slot* new_slots;
+
+    PerThread<T>::createSlots( threads,
+                               d_slots,
+                               d_size,
+                               value,
+                               new_raw_memory,
+                               new_slots );
+
+    PerThread<T>::destroySlots( d_raw_memory, d_slots, d_size );
+
+    d_raw_memory = new_raw_memory;
+    d_slots = new_slots;
+    d_size = threads;
+  }
+}
+
+// Return the number of slots
+template<typename T>
+inline auto PerThread<T>::size() const -> size_type
+{
+  return d_size;
+}
+
+// Return the slot of the requested thread
+template<typename T>
+inline T& PerThread<T>::operator[]( const size_type thread_id )
+{
+  // Make sure that the thread id is valid
+  testPrecondition( thread_id < d_size );
+
+  return d_slots[thread_id].value;
+}
+
+// Return the slot of the requested thread
+template<typename T>
+inline const T& PerThread<T>::operator[]( const size_type thread_id ) const
+{
+  // Make sure that the thread id is valid
+  testPrecondition( thread_id < d_size );
+
+  return d_slots[thread_id].value;
+}
+
+// Return the slot of the calling thread
+template<typename T>
+inline T& PerThread<T>::local()
+{
+  return (*this)[OpenMPProperties::getThreadId()];
+}
+
+// Return the slot of the calling thread
+template<typename T>
+inline const T& PerThread<T>::local() const
+{
+  return (*this)[OpenMPProperties::getThreadId()];
+}
+
+// Return the slot of the master thread
+template<typename T>
+inline T& PerThread<T>::front()
+{
+  return d_slots[0].value;
+}
+
+// Return the slot of the master thread
+template<typename T>
+inline const T& PerThread<T>::front() const
+{
+  return d_slots[0].value;
+}
+
+// Set the value of every slot
+template<typename T>
+void PerThread<T>::fill( const T& value )
+{
+  for( size_type i = 0; i < d_size; ++i )
+    d_slots[i].value = value;
+}
+
+// Reduce the slot values
+template<typename T>
+template<typename BinaryOperation>
+T PerThread<T>::reduce( const T& initial_value,
+                        BinaryOperation operation ) const
+{
+  T reduced_value( initial_value );
+
+  for( size_type i = 0; i < d_size; ++i )
+    reduced_value = operation( reduced_value, d_slots[i].value );
+
+  return reduced_value;
+}
+
+// Create new slot storage (each slot is constructed by its thread)
+/*! \details If the old slots are not NULL, the first old_size new slots
+ * will be copy constructed from them. The remaining slots will be copy
+ * constructed from the value. If this method is called outside of a
+ * parallel block, slot i will be constructed by thread i.
+ */
+template<typename T>
+void PerThread<T>::createSlots( const size_type threads,
+                                const Slot* old_slots,
+                                const size_type old_size,
+                                const T& value,
+                                char*& raw_memory,
+                                Slot*& slots )
+{
+  // Over allocate so that the first slot can be placed on a cache line
+  // boundary (operator new only guarantees fundamental alignment)
+  size_type space = threads*sizeof(Slot) + cache_line_size;
+
+  raw_memory = static_cast<char*>( ::operator new( space ) );
+
+  void* aligned_memory = raw_memory;
+
+  aligned_memory =
+    std::align( cache_line_size, threads*sizeof(Slot), aligned_memory, space );
+
+  slots = static_cast<Slot*>( aligned_memory );
+
+  std::unique_ptr<bool[]> constructed( new bool[threads] );
+  std::fill( constructed.get(), constructed.get()+threads, false );
+
+  std::exception_ptr construction_exception;
+
+  #pragma omp parallel for schedule(static,1) num_threads(threads) if(threads > 1 && !omp_in_parallel())
+  for( long long i = 0; i < (long long)threads; ++i )
+  {
+    try{
+      if( old_slots && (size_type)i < old_size )
+        new (slots + i) Slot( old_slots[i].value );
+      else
+        new (slots + i) Slot( value );
+
+      constructed[i] = true;
+    }
+    catch( ... )
+    {
+      #pragma omp critical
+      {
+        construction_exception = std::current_exception();
+      }
+    }
+  }
+
+  // Clean up if a slot could not be constructed
+  if( construction_exception )
+  {
+    for( size_type i = 0; i < threads; ++i )
+    {
+      if( constructed[i] )
+        slots[i].~Slot();
+    }
+
+    ::operator delete( raw_memory );
+
+    raw_memory = NULL;
+    slots = NULL;
+
+    std::rethrow_exception( construction_exception );
+  }
+}
+
+// Destroy slot storage
+template<typename T>
+void PerThread<T>::destroySlots( char* raw_memory,
+                                 Slot* slots,
+                                 const size_type size )
+{
+  if( raw_memory )
+  {
+    for( size_type i = 0; i < size; ++i )
+      slots[i].~Slot();
+
+    ::operator delete( raw_memory );
+  }
+}
+
+} // end Utility namespace
+
+#endif // end UTILITY_PER_THREAD_DEF_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_PerThread_def.hpp
+//---------------------------------------------------------------------------//
@@ -617,6 +617,62 @@ FRENSIE_UNIT_TEST( HDF5File, createSoftLink )
   FRENSIE_REQUIRE(hdf5_file.doesDataSetExist( "/link_dir/soft_links/link_to_test_dir_int_data_set" ));
 }
 
+//---------------------------------------------------------------------------//
+// Check that large data sets can be compressed
+FRENSIE_UNIT_TEST( HDF5File, data_set_compression )
+{
+  Utility::HDF5File hdf5_file( hdf5_file_name, Utility::HDF5File::READ_WRITE  );
+
+  FRENSIE_CHECK_EQUAL( hdf5_file.getDataSetCompressionLevel(), 0 );
+  FRENSIE_CHECK_EQUAL( hdf5_file.getMinCompressedDataSetSize(), 16384 );
+  FRENSIE_CHECK_EQUAL( hdf5_file.getMaxDataSetChunkSize(), 1048576 );
+
+  FRENSIE_CHECK_THROW( hdf5_file.setDataSetCompressionLevel( 10 ),
+                       Utility::HDF5File::Exception );
+  FRENSIE_CHECK_THROW( hdf5_file.setMaxDataSetChunkSize( 0 ),
+                       Utility::HDF5File::Exception );
+
+  std::vector<double> large_data( 10000 );
+
+  for( size_t i = 0; i < large_data.size(); ++i )
+    large_data[i] = i/10.0;
+
+  std::vector<double> small_data( 10, 1.0 );
+
+  // Data sets are not compressed by default
+  hdf5_file.writeToDataSet( "/compression/uncompressed_large_data",
+                            large_data.data(),
+                            large_data.size() );
+
+  FRENSIE_CHECK( !hdf5_file.isDataSetCompressed( "/compression/uncompressed_large_data" ) );
+
+  hdf5_file.setDataSetCompressionLevel( 1 );
+  hdf5_file.setMaxDataSetChunkSize( 8192 );
+
+  FRENSIE_CHECK_EQUAL( hdf5_file.getDataSetCompressionLevel(), 1 );
+  FRENSIE_CHECK_EQUAL( hdf5_file.getMaxDataSetChunkSize(), 8192 );
+
+  hdf5_file.writeToDataSet( "/compression/large_data",
+                            large_data.data(),
+                            large_data.size() );
+
+  hdf5_file.writeToDataSet( "/compression/small_data",
+                            small_data.data(),
+                            small_data.size() );
+
+  FRENSIE_CHECK( hdf5_file.isDataSetCompressed( "/compression/large_data" ) );
+  FRENSIE_CHECK( !hdf5_file.isDataSetCompressed( "/compression/small_data" ) );
+
+  // Compressed data sets are read transparently
+  std::vector<double> large_data_copy( large_data.size() );
+
+  hdf5_file.readFromDataSet( "/compression/large_data",
+                             large_data_copy.data(),
+                             large_data_copy.size() );
+
+  FRENSIE_CHECK_EQUAL( large_data_copy, large_data );
+}
+
 #endif // end HAVE_FRENSIE_HDF5
 
 //---------------------------------------------------------------------------//
@@ -0,0 +1,149 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstPerThread.cpp
+//! \author Alex Robinson
+//! \brief  Per-thread storage unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <cstdint>
+#include <functional>
+#include <set>
+
+// Boost Includes
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+// FRENSIE Includes
+#include "Utility_PerThread.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "FRENSIE_config.hpp"
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the default constructor creates a single slot
+BOOST_AUTO_TEST_CASE( default_constructor )
+{
+  Utility::PerThread<uint64_t> counters;
+
+  BOOST_CHECK_EQUAL( counters.size(), 1 );
+  BOOST_CHECK_EQUAL( counters.front(), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the slots can be initialized
+BOOST_AUTO_TEST_CASE( constructor )
+{
+  Utility::PerThread<uint64_t> counters( 4, 3 );
+
+  BOOST_CHECK_EQUAL( counters.size(), 4 );
+
+  for( size_t i = 0; i < counters.size(); ++i )
+    BOOST_CHECK_EQUAL( counters[i], 3 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that every slot lives on its own cache line
+BOOST_AUTO_TEST_CASE( cache_line_alignment )
+{
+  Utility::PerThread<uint8_t> flags( 8 );
+
+  for( size_t i = 0; i < flags.size(); ++i )
+  {
+    uintptr_t address = reinterpret_cast<uintptr_t>( &flags[i] );
+
+    BOOST_CHECK_EQUAL( address % Utility::PerThread<uint8_t>::cache_line_size, 0 );
+  }
+
+  for( size_t i = 1; i < flags.size(); ++i )
+  {
+    uintptr_t lower_address = reinterpret_cast<uintptr_t>( &flags[i-1] );
+    uintptr_t upper_address = reinterpret_cast<uintptr_t>( &flags[i] );
+
+    BOOST_CHECK( upper_address - lower_address >=
+                 Utility::PerThread<uint8_t>::cache_line_size );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that the storage can be resized
+BOOST_AUTO_TEST_CASE( resize )
+{
+  Utility::PerThread<std::set<int> > sets( 2, std::set<int>( {1} ) );
+
+  sets[1].insert( 2 );
+
+  sets.resize( 4, std::set<int>( {3} ) );
+
+  BOOST_CHECK_EQUAL( sets.size(), 4 );
+  BOOST_CHECK( sets[0] == std::set<int>( {1} ) );
+  BOOST_CHECK( sets[1] == std::set<int>( {1, 2} ) );
+  BOOST_CHECK( sets[2] == std::set<int>( {3} ) );
+  BOOST_CHECK( sets[3] == std::set<int>( {3} ) );
+
+  sets.resize( 1 );
+
+  BOOST_CHECK_EQUAL( sets.size(), 1 );
+  BOOST_CHECK( sets[0] == std::set<int>( {1} ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the storage can be copied
+BOOST_AUTO_TEST_CASE( copy )
+{
+  Utility::PerThread<double> values( 3, 1.0 );
+  values[2] = 2.0;
+
+  Utility::PerThread<double> values_copy( values );
+
+  BOOST_CHECK_EQUAL( values_copy.size(), 3 );
+  BOOST_CHECK_EQUAL( values_copy[0], 1.0 );
+  BOOST_CHECK_EQUAL( values_copy[2], 2.0 );
+
+  Utility::PerThread<double> values_assigned;
+  values_assigned = values;
+
+  BOOST_CHECK_EQUAL( values_assigned.size(), 3 );
+  BOOST_CHECK_EQUAL( values_assigned[1], 1.0 );
+  BOOST_CHECK_EQUAL( values_assigned[2], 2.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the slots can be filled and reduced
+BOOST_AUTO_TEST_CASE( fill_reduce )
+{
+  Utility::PerThread<uint64_t> counters( 5 );
+
+  counters.fill( 2 );
+
+  BOOST_CHECK_EQUAL( counters.reduce( 0, std::plus<uint64_t>() ), 10 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that each thread can access its local slot
+BOOST_AUTO_TEST_CASE( local )
+{
+  Utility::OpenMPProperties::setNumberOfThreads( 4 );
+
+  Utility::PerThread<uint64_t> counters(
+                   Utility::OpenMPProperties::getRequestedNumberOfThreads() );
+
+  #pragma omp parallel num_threads( Utility::OpenMPProperties::getRequestedNumberOfThreads() )
+  {
+    for( size_t i = 0; i < 1000; ++i )
+      ++counters.local();
+  }
+
+  for( size_t i = 0; i < counters.size(); ++i )
+    BOOST_CHECK_EQUAL( counters[i], 1000 );
+
+  BOOST_CHECK_EQUAL( counters.reduce( 0, std::plus<uint64_t>() ),
+                     1000*counters.size() );
+}
+
+//---------------------------------------------------------------------------//
+// end tstPerThread.cpp
+//---------------------------------------------------------------------------//
@@ -196,6 +196,29 @@ public:
    max_secondary_indep_var_functor,
    const SecondaryIndepQuantity max_secondary_indep_var_value ) const override;
 
+  //! Check if correlated inverse CDF tables can be used for sampling
+  bool canUseInverseCDFTables() const;
+
+  //! Precompute the correlated inverse CDF tables used for sampling
+  void precomputeInverseCDFTables(
+                              const double cdf_error_tol = 1e-4,
+                              const size_t max_number_of_cdf_points = 4097 );
+
+  //! Clear the correlated inverse CDF tables
+  void clearInverseCDFTables();
+
+  //! Check if the correlated inverse CDF tables have been precomputed
+  bool hasInverseCDFTables() const;
+
+  //! Return the number of CDF points in each inverse CDF table
+  size_t getNumberOfInverseCDFTablePoints() const;
+
+  //! Return the max CDF error of the inverse CDF tables
+  double getInverseCDFTableCDFError() const;
+
+  //! Return the memory used by the inverse CDF tables (bytes)
+  size_t getInverseCDFTableMemoryUsage() const;
+
   //! Method for placing the object in an output stream
   virtual void toStream( std::ostream& os ) const override;
 
@@ -237,6 +260,25 @@ private:
              EvaluationMethod evaluateCDF,
              unsigned max_number_of_iterations = 500 ) const;
 
+  // Sample from the distribution using the inverse CDF tables
+  SecondaryIndepQuantity sampleWithInverseCDFTables(
+            const PrimaryIndepQuantity primary_indep_var_value,
+            const double random_number,
+            const std::function<SecondaryIndepQuantity(PrimaryIndepQuantity)>&
+            min_secondary_indep_var_functor,
+            const std::function<SecondaryIndepQuantity(PrimaryIndepQuantity)>&
+            max_secondary_indep_var_functor ) const;
+
+  // Sample from the distribution using the inverse CDF tables
+  SecondaryIndepQuantity sampleWithInverseCDFTables(
+                            const PrimaryIndepQuantity primary_indep_var_value,
+                            const double random_number ) const;
+
+  // Evaluate the inverse CDF table of a secondary distribution
+  SecondaryIndepQuantity evaluateInverseCDFTable(
+                                            const size_t primary_bin_index,
+                                            const double random_number ) const;
+
   // Save the distribution to an archive
   template<typename Archive>
   void save( Archive& ar, const unsigned version ) const;
@@ -249,6 +291,16 @@ private:
 
   // Declare the boost serialization access object as a friend
   friend class boost::serialization::access;
+
+  // The inverse CDF tables (the CDF points of each secondary distribution
+  // are stored contiguously)
+  std::vector<SecondaryIndepQuantity> d_inverse_cdf_tables;
+
+  // The number of CDF points in each inverse CDF table
+  size_t d_inverse_cdf_table_size;
+
+  // The max CDF error of the inverse CDF tables
+  double d_inverse_cdf_table_cdf_error;
 };
 
 /*! \brief The interpolated fully tabular bivariate distribution
@@ -11,6 +11,7 @@
 
 // Std Lib Includes
 #include <type_traits>
+#include <cmath>
 
 // FRENSIE Includes
 #include "Utility_TabularDistribution.hpp"
@@ -153,6 +154,13 @@ template<typename TwoDInterpPolicy>
 struct TwoDGridPolicySamplingFunctorCreationHelper<Utility::UnitBaseCorrelated<TwoDInterpPolicy> > : public TwoDGridPolicySamplingFunctorCreationCorrelatedBaseHelper
 { /* ... */ };
 
+/*! \brief Check if the TwoDGridPolicy uses correlated sampling (i.e. a single
+ * random number is used to sample from both secondary distributions)
+ */
+template<typename TwoDGridPolicy>
+struct IsTwoDGridPolicyCorrelated : public std::is_base_of<TwoDGridPolicySamplingFunctorCreationCorrelatedBaseHelper,TwoDGridPolicySamplingFunctorCreationHelper<TwoDGridPolicy> >
+{ /* ... */ };
+
 } // end Details namespace
 
 // Default constructor
@@ -161,6 +169,9 @@ template<typename TwoDGridPolicy,
          typename SecondaryIndependentUnit,
          typename DependentUnit>
 UnitAwareInterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy,PrimaryIndependentUnit,SecondaryIndependentUnit,DependentUnit>::UnitAwareInterpolatedFullyTabularBasicBivariateDistribution()
+  : d_inverse_cdf_tables(),
+    d_inverse_cdf_table_size( 0 ),
+    d_inverse_cdf_table_cdf_error( 0.0 )
 {
   BOOST_SERIALIZATION_CLASS_EXPORT_IMPLEMENT_FINALIZE( ThisType );
 }
@@ -183,7 +194,10 @@ UnitAwareInterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy,Prima
               fuzzy_boundary_tol,
               evaluate_relative_error_tol,
               evaluate_error_tol,
-              max_number_of_iterations )
+              max_number_of_iterations ),
+    d_inverse_cdf_tables(),
+    d_inverse_cdf_table_size( 0 ),
+    d_inverse_cdf_table_cdf_error( 0.0 )
 {
   BOOST_SERIALIZATION_CLASS_EXPORT_IMPLEMENT_FINALIZE( ThisType );
 }
@@ -201,6 +215,9 @@ UnitAwareInterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy,Prima
   const double evaluate_relative_error_tol,
   const double evaluate_error_tol,
   const unsigned max_number_of_iterations )
+  : d_inverse_cdf_tables(),
+    d_inverse_cdf_table_size( 0 ),
+    d_inverse_cdf_table_cdf_error( 0.0 )
 {
   TEST_FOR_EXCEPTION( primary_indep_grid.size() != secondary_indep_grids.size(),
                       Utility::BadBivariateDistributionParameter,
@@ -421,6 +438,12 @@ auto UnitAwareInterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy,
                      const PrimaryIndepQuantity primary_indep_var_value ) const
   -> SecondaryIndepQuantity
 {
+  if( this->hasInverseCDFTables() )
+  {
+    return this->sampleWithInverseCDFTables( primary_indep_var_value,
+                     Utility::RandomNumberGenerator::getRandomNumber<double>() );
+  }
+
   // Create the sampling functor
   std::function<SecondaryIndepQuantity(const BaseUnivariateDistributionType&)>
     sampling_functor = Details::TwoDGridPolicySamplingFunctorCreationHelper<TwoDGridPolicy>::template createBasicSamplingFunctor<BaseUnivariateDistributionType>();
@@ -448,6 +471,14 @@ auto UnitAwareInterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy,
             max_secondary_indep_var_functor ) const
   -> SecondaryIndepQuantity
 {
+  if( this->hasInverseCDFTables() )
+  {
+    return this->sampleWithInverseCDFTables( primary_indep_var_value,
+                     Utility::RandomNumberGenerator::getRandomNumber<double>(),
+                     min_secondary_indep_var_functor,
+                     max_secondary_indep_var_functor );
+  }
+
   // Create the sampling functor
   std::function<SecondaryIndepQuantity(const BaseUnivariateDistributionType&)>
     sampling_functor = Details::TwoDGridPolicySamplingFunctorCreationHelper<TwoDGridPolicy>::template createBasicSamplingFunctor<BaseUnivariateDistributionType>();
@@ -540,6 +571,12 @@ auto UnitAwareInterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy,
   testPrecondition( random_number >= 0.0 );
   testPrecondition( random_number <= 1.0 );
 
+  if( this->hasInverseCDFTables() )
+  {
+    return this->sampleWithInverseCDFTables( primary_indep_var_value,
+                                             random_number );
+  }
+
   // Create the sampling functor
   std::function<SecondaryIndepQuantity(const BaseUnivariateDistributionType&)>
     sampling_functor = std::bind<SecondaryIndepQuantity>(
@@ -568,6 +605,14 @@ auto UnitAwareInterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy,
   testPrecondition( random_number >= 0.0 );
   testPrecondition( random_number <= 1.0 );
 
+  if( this->hasInverseCDFTables() )
+  {
+    return this->sampleWithInverseCDFTables( primary_indep_var_value,
+                                             random_number,
+                                             min_secondary_indep_var_functor,
+                                             max_secondary_indep_var_functor );
+  }
+
   // Create the sampling functor
   std::function<SecondaryIndepQuantity(const BaseUnivariateDistributionType&)>
     sampling_functor = std::bind<SecondaryIndepQuantity>(
@@ -779,6 +824,340 @@ void UnitAwareInterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy,
                                  data... );
 }
 
+// Check if correlated inverse CDF tables can be used for sampling
+/*! \details Inverse CDF tables can only be used with correlated grid
+ * policies and continuous secondary distributions.
+ */
+template<typename TwoDGridPolicy,
+         typename PrimaryIndependentUnit,
+         typename SecondaryIndependentUnit,
+         typename DependentUnit>
+bool UnitAwareInterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy,PrimaryIndependentUnit,SecondaryIndependentUnit,DependentUnit>::canUseInverseCDFTables() const
+{
+  return Details::IsTwoDGridPolicyCorrelated<TwoDGridPolicy>::value &&
+    this->areSecondaryDistributionsContinuous();
+}
+
+// Precompute the correlated inverse CDF tables used for sampling
+/*! \details The inverse CDF of every secondary distribution will be
+ * tabulated on a uniform CDF grid. The grid is refined (by halving the CDF
+ * spacing) until the CDF of the sampled distribution, which is linear between
+ * the tabulated points, is within the CDF error tolerance of the secondary
+ * distribution CDF at every CDF bin midpoint or until the max number of CDF
+ * points would be exceeded. Once computed, sampling from the distribution
+ * only requires two table lookups and the standard correlated interpolation.
+ * The achieved CDF error and the memory used by the tables can be queried to
+ * assess the accuracy/memory trade-off. The tables are not archived - they
+ * must be precomputed again after the distribution has been loaded. Only
+ * correlated grid policies with continuous secondary distributions are
+ * supported.
+ */
+template<typename TwoDGridPolicy,
+         typename PrimaryIndependentUnit,
+         typename SecondaryIndependentUnit,
+         typename DependentUnit>
+void UnitAwareInterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy,PrimaryIndependentUnit,SecondaryIndependentUnit,DependentUnit>::precomputeInverseCDFTables(
+                                       const double cdf_error_tol,
+                                       const size_t max_number_of_cdf_points )
+{
+  // Make sure that the tolerance is valid
+  testPrecondition( cdf_error_tol > 0.0 );
+  // Make sure that the max number of cdf points is valid
+  testPrecondition( max_number_of_cdf_points >= 2 );
+
+  TEST_FOR_EXCEPTION( !Details::IsTwoDGridPolicyCorrelated<TwoDGridPolicy>::value,
+                      std::logic_error,
+                      "Inverse CDF tables can only be used with correlated "
+                      "grid policies (not " << TwoDGridPolicy::name() <<
+                      ")!" );
+
+  TEST_FOR_EXCEPTION( !this->areSecondaryDistributionsContinuous(),
+                      std::logic_error,
+                      "Inverse CDF tables can only be used with continuous "
+                      "secondary distributions!" );
+
+  const size_t number_of_distributions =
+    this->getNumberOfSecondaryDistributions();
+
+  size_t number_of_cdf_points =
+    std::min( max_number_of_cdf_points, (size_t)33 );
+
+  // Tabulate the inverse CDFs on the initial CDF grid
+  std::vector<std::vector<SecondaryIndepQuantity> >
+    tables( number_of_distributions );
+
+  for( size_t i = 0; i < number_of_distributions; ++i )
+  {
+    const BaseUnivariateDistributionType& secondary_distribution =
+      this->getSecondaryDistribution( i );
+
+    tables[i].resize( number_of_cdf_points );
+
+    for( size_t j = 0; j < number_of_cdf_points; ++j )
+    {
+      tables[i][j] = secondary_distribution.sampleWithRandomNumber(
+                                         j/(double)(number_of_cdf_points-1) );
+    }
+  }
+
+  // Refine the CDF grid until the tolerance is met
+  double max_cdf_error;
+
+  while( true )
+  {
+    max_cdf_error = 0.0;
+
+    std::vector<std::vector<SecondaryIndepQuantity> >
+      midpoints( number_of_distributions );
+
+    for( size_t i = 0; i < number_of_distributions; ++i )
+    {
+      const BaseUnivariateDistributionType& secondary_distribution =
+        this->getSecondaryDistribution( i );
+
+      midpoints[i].resize( number_of_cdf_points-1 );
+
+      for( size_t j = 0; j < number_of_cdf_points-1; ++j )
+      {
+        const double midpoint_cdf = (j+0.5)/(number_of_cdf_points-1);
+
+        midpoints[i][j] =
+          secondary_distribution.sampleWithRandomNumber( midpoint_cdf );
+
+        const double cdf_error = std::fabs(
+                  secondary_distribution.evaluateCDF( tables[i][j] +
+                                   (tables[i][j+1] - tables[i][j])*0.5 ) -
+                  midpoint_cdf );
+
+        if( cdf_error > max_cdf_error )
+          max_cdf_error = cdf_error;
+      }
+    }
+
+    if( max_cdf_error <= cdf_error_tol ||
+        2*number_of_cdf_points-1 > max_number_of_cdf_points )
+      break;
+
+    // Halve the CDF spacing (the midpoints become table points)
+    for( size_t i = 0; i < number_of_distributions; ++i )
+    {
+      std::vector<SecondaryIndepQuantity>
+        refined_table( 2*number_of_cdf_points-1 );
+
+      for( size_t j = 0; j < number_of_cdf_points-1; ++j )
+      {
+        refined_table[2*j] = tables[i][j];
+        refined_table[2*j+1] = midpoints[i][j];
+      }
+
+      refined_table.back() = tables[i].back();
+
+      tables[i].swap( refined_table );
+    }
+
+    number_of_cdf_points = 2*number_of_cdf_points-1;
+  }
+
+  // Store the tables contiguously
+  d_inverse_cdf_tables.clear();
+  d_inverse_cdf_tables.reserve( number_of_distributions*number_of_cdf_points );
+
+  for( size_t i = 0; i < number_of_distributions; ++i )
+  {
+    d_inverse_cdf_tables.insert( d_inverse_cdf_tables.end(),
+                                 tables[i].begin(),
+                                 tables[i].end() );
+  }
+
+  d_inverse_cdf_table_size = number_of_cdf_points;
+  d_inverse_cdf_table_cdf_error = max_cdf_error;
+}
+
+// Clear the correlated inverse CDF tables
+template<typename TwoDGridPolicy,
+         typename PrimaryIndependentUnit,
+         typename SecondaryIndependentUnit,
+         typename DependentUnit>
+void UnitAwareInterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy,PrimaryIndependentUnit,SecondaryIndependentUnit,DependentUnit>::clearInverseCDFTables()
+{
+  d_inverse_cdf_tables.clear();
+  d_inverse_cdf_table_size = 0;
+  d_inverse_cdf_table_cdf_error = 0.0;
+}
+
+// Check if the correlated inverse CDF tables have been precomputed
+template<typename TwoDGridPolicy,
+         typename PrimaryIndependentUnit,
+         typename SecondaryIndependentUnit,
+         typename DependentUnit>
+inline bool UnitAwareInterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy,PrimaryIndependentUnit,SecondaryIndependentUnit,DependentUnit>::hasInverseCDFTables() const
+{
+  return d_inverse_cdf_table_size > 0;
+}
+
+// Return the number of CDF points in each inverse CDF table
+template<typename TwoDGridPolicy,
+         typename PrimaryIndependentUnit,
+         typename SecondaryIndependentUnit,
+         typename DependentUnit>
+size_t UnitAwareInterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy,PrimaryIndependentUnit,SecondaryIndependentUnit,DependentUnit>::getNumberOfInverseCDFTablePoints() const
+{
+  return d_inverse_cdf_table_size;
+}
+
+// Return the max CDF error of the inverse CDF tables
+template<typename TwoDGridPolicy,
+         typename PrimaryIndependentUnit,
+         typename SecondaryIndependentUnit,
+         typename DependentUnit>
+double UnitAwareInterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy,PrimaryIndependentUnit,SecondaryIndependentUnit,DependentUnit>::getInverseCDFTableCDFError() const
+{
+  return d_inverse_cdf_table_cdf_error;
+}
+
+// Return the memory used by the inverse CDF tables (bytes)
+template<typename TwoDGridPolicy,
+         typename PrimaryIndependentUnit,
+         typename SecondaryIndependentUnit,
+         typename DependentUnit>
+size_t UnitAwareInterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy,PrimaryIndependentUnit,SecondaryIndependentUnit,DependentUnit>::getInverseCDFTableMemoryUsage() const
+{
+  return d_inverse_cdf_tables.size()*sizeof(SecondaryIndepQuantity);
+}
+
+// Sample from the distribution using the inverse CDF tables
+template<typename TwoDGridPolicy,
+         typename PrimaryIndependentUnit,
+         typename SecondaryIndependentUnit,
+         typename DependentUnit>
+auto UnitAwareInterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy,PrimaryIndependentUnit,SecondaryIndependentUnit,DependentUnit>::sampleWithInverseCDFTables(
+                     const PrimaryIndepQuantity primary_indep_var_value,
+                     const double random_number ) const
+  -> SecondaryIndepQuantity
+{
+  // Create the lower bound functor
+  std::function<SecondaryIndepQuantity(const PrimaryIndepQuantity)>
+    lower_bound_functor = std::bind<SecondaryIndepQuantity>(
+                              &ThisType::getLowerBoundOfSecondaryConditionalIndepVar,
+                              std::cref( *this ),
+                              std::placeholders::_1 );
+
+  // Create the upper bound functor
+  std::function<SecondaryIndepQuantity(const PrimaryIndepQuantity)>
+    upper_bound_functor = std::bind<SecondaryIndepQuantity>(
+                              &ThisType::getUpperBoundOfSecondaryConditionalIndepVar,
+                              std::cref( *this ),
+                              std::placeholders::_1 );
+
+  return this->sampleWithInverseCDFTables( primary_indep_var_value,
+                                           random_number,
+                                           lower_bound_functor,
+                                           upper_bound_functor );
+}
+
+// Sample from the distribution using the inverse CDF tables
+/*! \details The tabulated inverse CDFs take the place of the
+ * secondary distribution sampleWithRandomNumber method in the correlated
+ * grid policy sampling routine.
+ */
+template<typename TwoDGridPolicy,
+         typename PrimaryIndependentUnit,
+         typename SecondaryIndependentUnit,
+         typename DependentUnit>
+auto UnitAwareInterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy,PrimaryIndependentUnit,SecondaryIndependentUnit,DependentUnit>::sampleWithInverseCDFTables(
+            const PrimaryIndepQuantity primary_indep_var_value,
+            const double random_number,
+            const std::function<SecondaryIndepQuantity(PrimaryIndepQuantity)>&
+            min_secondary_indep_var_functor,
+            const std::function<SecondaryIndepQuantity(PrimaryIndepQuantity)>&
+            max_secondary_indep_var_functor ) const
+  -> SecondaryIndepQuantity
+{
+  // Find the bin boundaries
+  DistributionDataConstIterator lower_bin_boundary, upper_bin_boundary;
+
+  this->findBinBoundaries( primary_indep_var_value,
+                           lower_bin_boundary,
+                           upper_bin_boundary );
+
+  const size_t lower_bin_index = this->calculateBinIndex( lower_bin_boundary );
+
+  if( lower_bin_boundary != upper_bin_boundary )
+  {
+    const size_t upper_bin_index =
+      this->calculateBinIndex( upper_bin_boundary );
+
+    const BaseUnivariateDistributionType* lower_distribution =
+      lower_bin_boundary->second.get();
+
+    // The grid policy will only sample from the bin boundary distributions
+    auto sampling_functor =
+      [this,lower_distribution,lower_bin_index,upper_bin_index,random_number](
+                      const BaseUnivariateDistributionType& distribution )
+      {
+        return this->evaluateInverseCDFTable(
+                                        &distribution == lower_distribution ?
+                                        lower_bin_index : upper_bin_index,
+                                        random_number );
+      };
+
+    DistributionDataConstIterator sampled_bin_boundary;
+    SecondaryIndepQuantity raw_sample;
+
+    return TwoDGridPolicy::sampleDetailed( sampling_functor,
+                                           min_secondary_indep_var_functor,
+                                           max_secondary_indep_var_functor,
+                                           primary_indep_var_value,
+                                           lower_bin_boundary,
+                                           upper_bin_boundary,
+                                           sampled_bin_boundary,
+                                           raw_sample );
+  }
+  else
+  {
+    TEST_FOR_EXCEPTION( !this->arePrimaryLimitsExtended(),
+                        std::logic_error,
+                        "Sampling beyond the primary grid boundaries "
+                        "cannot be done unless the grid has been extended ("
+                        << primary_indep_var_value << " not in ["
+                        << this->getLowerBoundOfPrimaryIndepVar() << ","
+                        << this->getUpperBoundOfPrimaryIndepVar() << "])!" );
+
+    return this->evaluateInverseCDFTable( lower_bin_index, random_number );
+  }
+}
+
+// Evaluate the inverse CDF table of a secondary distribution
+template<typename TwoDGridPolicy,
+         typename PrimaryIndependentUnit,
+         typename SecondaryIndependentUnit,
+         typename DependentUnit>
+inline auto UnitAwareInterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy,PrimaryIndependentUnit,SecondaryIndependentUnit,DependentUnit>::evaluateInverseCDFTable(
+                                            const size_t primary_bin_index,
+                                            const double random_number ) const
+  -> SecondaryIndepQuantity
+{
+  // Make sure that the tables have been precomputed
+  testPrecondition( this->hasInverseCDFTables() );
+  // Make sure that the bin index is valid
+  testPrecondition( primary_bin_index <
+                    this->getNumberOfSecondaryDistributions() );
+
+  const SecondaryIndepQuantity* table = d_inverse_cdf_tables.data() +
+    primary_bin_index*d_inverse_cdf_table_size;
+
+  const double scaled_random_number =
+    random_number*(d_inverse_cdf_table_size-1);
+
+  size_t cdf_index = (size_t)scaled_random_number;
+
+  if( cdf_index >= d_inverse_cdf_table_size-1 )
+    cdf_index = d_inverse_cdf_table_size-2;
+
+  return table[cdf_index] + (table[cdf_index+1] - table[cdf_index])*
+    (scaled_random_number - cdf_index);
+}
+
 // Save the distribution to an archive
 template<typename TwoDGridPolicy,
          typename PrimaryIndependentUnit,
@@ -801,6 +1180,9 @@ void UnitAwareInterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy,
 {
   // Load the base class first
   ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( BaseType );
+
+  // The inverse CDF tables are not archived
+  this->clearInverseCDFTables();
 }
 
 } // end Utility namespace
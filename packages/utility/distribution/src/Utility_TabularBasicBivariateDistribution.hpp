@@ -127,6 +127,13 @@ protected:
   //! Calculate the index of the desired bin
   size_t calculateBinIndex( const DistributionDataConstIterator& bin_boundary ) const;
 
+  //! Return the number of secondary distributions
+  size_t getNumberOfSecondaryDistributions() const;
+
+  //! Return the secondary distribution at the desired primary grid index
+  const BaseUnivariateDistributionType& getSecondaryDistribution(
+                                                   const size_t index ) const;
+
   // Check that all secondary distributions are continuous
   bool areSecondaryDistributionsContinuous() const;
 
@@ -191,6 +191,31 @@ inline size_t UnitAwareTabularBasicBivariateDistribution<PrimaryIndependentUnit,
   return std::distance( d_distribution.begin(), bin_boundary );
 }
 
+// Return the number of secondary distributions
+template<typename PrimaryIndependentUnit,
+         typename SecondaryIndependentUnit,
+         typename DependentUnit,
+         template<typename...> class BaseUnivariateDistribution>
+inline size_t UnitAwareTabularBasicBivariateDistribution<PrimaryIndependentUnit,SecondaryIndependentUnit,DependentUnit,BaseUnivariateDistribution>::getNumberOfSecondaryDistributions() const
+{
+  return d_distribution.size();
+}
+
+// Return the secondary distribution at the desired primary grid index
+template<typename PrimaryIndependentUnit,
+         typename SecondaryIndependentUnit,
+         typename DependentUnit,
+         template<typename...> class BaseUnivariateDistribution>
+inline auto UnitAwareTabularBasicBivariateDistribution<PrimaryIndependentUnit,SecondaryIndependentUnit,DependentUnit,BaseUnivariateDistribution>::getSecondaryDistribution(
+                                                    const size_t index ) const
+  -> const BaseUnivariateDistributionType&
+{
+  // Make sure that the index is valid
+  testPrecondition( index < d_distribution.size() );
+
+  return *Utility::get<1>(d_distribution[index]);
+}
+
 // Check that all secondary distributions are continuous
 template<typename PrimaryIndependentUnit,
          typename SecondaryIndependentUnit,
@@ -1987,6 +1987,63 @@ FRENSIE_UNIT_TEST( UnitAwareInterpolatedFullyTabularBasicBivariateDistribution,
   unit_aware_tab_distribution->limitToPrimaryIndepLimits();
 }
 
+//---------------------------------------------------------------------------//
+// Check that inverse CDF tables can be precomputed and used for sampling
+FRENSIE_UNIT_TEST( InterpolatedFullyTabularBasicBivariateDistribution,
+                   precomputeInverseCDFTables )
+{
+  typedef Utility::InterpolatedFullyTabularBasicBivariateDistribution<Utility::Correlated<Utility::LinLinLin> > ConcreteTabDist;
+
+  std::shared_ptr<ConcreteTabDist> concrete_tab_distribution =
+    std::dynamic_pointer_cast<ConcreteTabDist>( tab_distribution );
+
+  FRENSIE_REQUIRE( concrete_tab_distribution.get() != NULL );
+  FRENSIE_CHECK( !concrete_tab_distribution->hasInverseCDFTables() );
+  FRENSIE_CHECK_EQUAL( concrete_tab_distribution->getInverseCDFTableMemoryUsage(), 0 );
+
+  std::vector<double> primary_values( {0.0, 0.5, 1.0, 1.5, 2.0} );
+  std::vector<double> random_numbers( {0.0, 0.1, 0.25, 0.4230769230769231, 0.5, 0.75, 0.9, 1.0-1e-15} );
+
+  std::vector<double> exact_samples;
+
+  for( size_t i = 0; i < primary_values.size(); ++i )
+  {
+    for( size_t j = 0; j < random_numbers.size(); ++j )
+    {
+      exact_samples.push_back( tab_distribution->sampleSecondaryConditionalWithRandomNumber( primary_values[i], random_numbers[j] ) );
+    }
+  }
+
+  concrete_tab_distribution->precomputeInverseCDFTables( 1e-6 );
+
+  FRENSIE_CHECK( concrete_tab_distribution->hasInverseCDFTables() );
+  FRENSIE_CHECK( concrete_tab_distribution->getNumberOfInverseCDFTablePoints() > 1 );
+  FRENSIE_CHECK( concrete_tab_distribution->getInverseCDFTableCDFError() <= 1e-6 );
+  FRENSIE_CHECK_EQUAL( concrete_tab_distribution->getInverseCDFTableMemoryUsage(),
+                       4*concrete_tab_distribution->getNumberOfInverseCDFTablePoints()*sizeof(double) );
+
+  // The tabulated inverse CDFs are accurate enough that the samples should
+  // be close to the exact samples
+  for( size_t i = 0; i < primary_values.size(); ++i )
+  {
+    for( size_t j = 0; j < random_numbers.size(); ++j )
+    {
+      double sample = tab_distribution->sampleSecondaryConditionalWithRandomNumber( primary_values[i], random_numbers[j] );
+
+      FRENSIE_CHECK_SMALL( sample - exact_samples[i*random_numbers.size()+j], 1e-5 );
+    }
+  }
+
+  // After the third bin - no extension
+  FRENSIE_CHECK_THROW( tab_distribution->sampleSecondaryConditionalWithRandomNumber( 3.0, 0.0 ),
+              std::logic_error );
+
+  concrete_tab_distribution->clearInverseCDFTables();
+
+  FRENSIE_CHECK( !concrete_tab_distribution->hasInverseCDFTables() );
+  FRENSIE_CHECK_EQUAL( concrete_tab_distribution->getInverseCDFTableMemoryUsage(), 0 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the distribution can be archived
 FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( InterpolatedFullyTabularBasicBivariateDistribution,
@@ -2089,6 +2089,51 @@ FRENSIE_UNIT_TEST( UnitAwareInterpolatedFullyTabularBasicBivariateDistribution,
   unit_aware_tab_distribution->limitToPrimaryIndepLimits();
 }
 
+//---------------------------------------------------------------------------//
+// Check that the unit base correlated sampling routine can use the inverse
+// CDF tables (the table bookkeeping is checked in the correlated tests)
+FRENSIE_UNIT_TEST( InterpolatedFullyTabularBasicBivariateDistribution,
+                   sampleSecondaryConditionalWithRandomNumber_inverse_cdf_tables )
+{
+  typedef Utility::InterpolatedFullyTabularBasicBivariateDistribution<Utility::UnitBaseCorrelated<Utility::LinLinLin> > ConcreteTabDist;
+
+  std::shared_ptr<ConcreteTabDist> concrete_tab_distribution =
+    std::dynamic_pointer_cast<ConcreteTabDist>( tab_distribution );
+
+  FRENSIE_REQUIRE( concrete_tab_distribution.get() != NULL );
+
+  std::vector<double> primary_values( {0.0, 0.5, 1.0, 1.5, 2.0} );
+  std::vector<double> random_numbers( {0.0, 0.1, 0.25, 0.4230769230769231, 0.5, 0.75, 0.9, 1.0-1e-15} );
+
+  std::vector<double> exact_samples;
+
+  for( size_t i = 0; i < primary_values.size(); ++i )
+  {
+    for( size_t j = 0; j < random_numbers.size(); ++j )
+    {
+      exact_samples.push_back( tab_distribution->sampleSecondaryConditionalWithRandomNumber( primary_values[i], random_numbers[j] ) );
+    }
+  }
+
+  concrete_tab_distribution->precomputeInverseCDFTables( 1e-6 );
+
+  FRENSIE_REQUIRE( concrete_tab_distribution->hasInverseCDFTables() );
+
+  // The tabulated inverse CDFs are accurate enough that the samples should
+  // be close to the exact samples
+  for( size_t i = 0; i < primary_values.size(); ++i )
+  {
+    for( size_t j = 0; j < random_numbers.size(); ++j )
+    {
+      double sample = tab_distribution->sampleSecondaryConditionalWithRandomNumber( primary_values[i], random_numbers[j] );
+
+      FRENSIE_CHECK_SMALL( sample - exact_samples[i*random_numbers.size()+j], 1e-5 );
+    }
+  }
+
+  concrete_tab_distribution->clearInverseCDFTables();
+}
+
 //---------------------------------------------------------------------------//
 // Check that the distribution can be archived
 FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( InterpolatedFullyTabularBasicBivariateDistribution,
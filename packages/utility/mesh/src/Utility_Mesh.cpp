@@ -29,6 +29,21 @@ void Mesh::exportData( const std::string& output_file_name ) const
                     MeshElementHandleDataMap() );
 }
 
+// Check if a point is inside of a specific mesh element
+/*! \details This default implementation does a full point location search.
+ * Derived classes should override it with a direct test of the element
+ * (it is used to validate cached mesh elements, which is only worthwhile if
+ * it is cheaper than whichElementIsPointIn).
+ */
+bool Mesh::isPointInElement( const double point[3],
+                             const ElementHandle element ) const
+{
+  if( this->isPointInMesh( point ) )
+    return this->whichElementIsPointIn( point ) == element;
+  else
+    return false;
+}
+
 // Default implementation of export method
 void Mesh::exportDataImpl( const std::string& output_file_name,
                            const TagNameSet& tag_root_names,
@@ -85,6 +85,10 @@ public:
   //! Determine the mesh element that contains a given point
   virtual ElementHandle whichElementIsPointIn( const double point[3] ) const = 0;
 
+  //! Check if a point is inside of a specific mesh element
+  virtual bool isPointInElement( const double point[3],
+                                 const ElementHandle element ) const;
+
   //! Determine the mesh elements that a line segment intersects
   virtual void computeTrackLengths(
               const double start_point[3],
@@ -0,0 +1,261 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_StructuredCylindricalMesh.hpp
+//! \author Alex Robinson
+//! \brief  Structured cylindrical mesh class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_STRUCTURED_CYLINDRICAL_MESH_HPP
+#define UTILITY_STRUCTURED_CYLINDRICAL_MESH_HPP
+
+// Std Lib Includes
+#include <utility>
+
+// Boost Includes
+#include <boost/serialization/vector.hpp>
+
+// FRENSIE Includes
+#include "Utility_Mesh.hpp"
+#include "Utility_Tuple.hpp"
+#include "Utility_Vector.hpp"
+#include "Utility_Array.hpp"
+
+namespace Utility{
+
+/*! The structured cylindrical mesh class
+ * \details The mesh is defined by a set of radial surfaces (cylinders), a set
+ * of azimuthal surfaces (half-planes bounded by the cylinder axis) and a set
+ * of axial surfaces (planes). The cylinder axis is parallel to the z-axis
+ * and passes through the mesh origin. The azimuthal surfaces are specified
+ * as angles (measured from the x-axis) in [0,2pi]. The track lengths
+ * through the mesh elements are calculated from the analytic surface
+ * crossing distances along the track and the element that contains a point
+ * is found in expected constant time.
+ */
+class StructuredCylindricalMesh : public Mesh
+{
+
+public:
+
+  //! The mesh element handle
+  typedef Mesh::ElementHandle ElementHandle;
+
+  //! The surface index
+  typedef size_t SurfaceIndex;
+
+  //! Iterator over all mesh elements
+  typedef Mesh::ElementHandleIterator ElementHandleIterator;
+
+  //! The mesh element handle, primary intersection point, track length tuple array
+  typedef Mesh::ElementHandleTrackLengthArray ElementHandleTrackLengthArray;
+
+  //! The mesh element handle, volume map
+  typedef Mesh::ElementHandleVolumeMap ElementHandleVolumeMap;
+
+  //! The mesh data tag name set
+  typedef Mesh::TagNameSet TagNameSet;
+
+  //! The mesh element handle, data map
+  typedef Mesh::MeshElementHandleDataMap MeshElementHandleDataMap;
+
+  //! Constructor
+  StructuredCylindricalMesh( const std::vector<double>& r_surfaces,
+                             const std::vector<double>& theta_surfaces,
+                             const std::vector<double>& z_surfaces );
+
+  //! Constructor (mesh origin is not the global origin)
+  StructuredCylindricalMesh( const std::array<double,3>& origin,
+                             const std::vector<double>& r_surfaces,
+                             const std::vector<double>& theta_surfaces,
+                             const std::vector<double>& z_surfaces );
+
+  //! Destructor
+  ~StructuredCylindricalMesh()
+  { /* ... */ }
+
+  //! Get the mesh type name
+  std::string getMeshTypeName() const final override;
+
+  //! Get the mesh element type name
+  std::string getMeshElementTypeName() const final override;
+
+  //! Get the start iterator of the mesh element list.
+  ElementHandleIterator getStartElementHandleIterator() const final override;
+
+  //! Get the end iterator of the mesh element list.
+  ElementHandleIterator getEndElementHandleIterator() const final override;
+
+  //! Get the number of mesh elements
+  size_t getNumberOfElements() const final override;
+
+  //! Get the mesh origin
+  const std::array<double,3>& getOrigin() const;
+
+  //! Get the number of radial surfaces
+  size_t getNumberOfRSurfaces() const;
+
+  //! Get the number of azimuthal surfaces
+  size_t getNumberOfThetaSurfaces() const;
+
+  //! Get the number of axial surfaces
+  size_t getNumberOfZSurfaces() const;
+
+  //! Get the location of a radial surface
+  double getRSurfaceLocation( SurfaceIndex i ) const;
+
+  //! Get the location of an azimuthal surface
+  double getThetaSurfaceLocation( SurfaceIndex i ) const;
+
+  //! Get the location of an axial surface
+  double getZSurfaceLocation( SurfaceIndex i ) const;
+
+  //! Deconstruct an element handle into the bin indices of each dimension
+  void getElementBinIndices( const ElementHandle element,
+                             size_t element_bin_indices[3] ) const;
+
+  //! Compute the element handle from the bin indices of each dimension
+  ElementHandle findIndex( const size_t i,
+                           const size_t j,
+                           const size_t k ) const;
+
+  //! Returns the volumes of the mesh elements for the estimator class.
+  void getElementVolumes( ElementHandleVolumeMap& element_volumes ) const final override;
+
+  //! Returns the volume of a specific mesh element
+  double getElementVolume( ElementHandle element ) const final override;
+
+  //! Returns a bool that says whether or not a point is in the mesh.
+  bool isPointInMesh( const double point[3] ) const final override;
+
+  //! Returns a bool that says whether or not a point is in a mesh element.
+  bool isPointInElement( const double point[3],
+                         const ElementHandle element ) const final override;
+
+  //! Returns the handle of the mesh element that contains a given point.
+  ElementHandle whichElementIsPointIn( const double point[3] ) const final override;
+
+  //! Returns the mesh elements and partial track lengths along a given line segment.
+  void computeTrackLengths( const double start_point[3],
+                            const double end_point[3],
+                            ElementHandleTrackLengthArray&
+                            element_track_lengths ) const final override;
+
+  //! Export the mesh to a file (type determined by suffix - e.g. mesh.vtk)
+  void exportData( const std::string& output_file_name,
+                   const TagNameSet& tag_root_names,
+                   const MeshElementHandleDataMap& mesh_tag_data ) const final override;
+
+  //! Export the mesh to a file
+  using Mesh::exportData;
+
+private:
+
+  // Default constructor
+  StructuredCylindricalMesh();
+
+  // Initialize the mesh elements and the bin lookup tables
+  void initialize();
+
+  // Convert a point to the (r,theta,z) coordinates of the mesh
+  void convertToMeshCoordinates( const double point[3],
+                                 double mesh_coordinates[3] ) const;
+
+  // Check if the mesh coordinates are in the mesh
+  bool areMeshCoordinatesInMesh( const double mesh_coordinates[3] ) const;
+
+  // Add the radial surface crossing distances along the local ray
+  void addRSurfaceCrossingDistances(
+                              const double local_start_point[3],
+                              const double direction[3],
+                              const double track_length,
+                              std::vector<double>& crossing_distances ) const;
+
+  // Add the azimuthal surface crossing distances along the local ray
+  void addThetaSurfaceCrossingDistances(
+                              const double local_start_point[3],
+                              const double direction[3],
+                              const double track_length,
+                              std::vector<double>& crossing_distances ) const;
+
+  // Add the axial surface crossing distances along the local ray
+  void addZSurfaceCrossingDistances(
+                              const double local_start_point[3],
+                              const double direction[3],
+                              const double track_length,
+                              std::vector<double>& crossing_distances ) const;
+
+  // Save the data to an archive
+  template<typename Archive>
+  void save( Archive& ar, const unsigned version ) const;
+
+  // Load the data from an archive
+  template<typename Archive>
+  void load( Archive& ar, const unsigned version );
+
+  BOOST_SERIALIZATION_SPLIT_MEMBER();
+
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+
+  // The mesh origin
+  std::array<double,3> d_origin;
+
+  // The surface location member data
+  std::vector<double> d_r_surfaces;
+  std::vector<double> d_theta_surfaces;
+  std::vector<double> d_z_surfaces;
+
+  // The mesh elements (ids)
+  std::vector<ElementHandle> d_elements;
+
+  // The bin lookup tables (not archived - recreated on load)
+  std::vector<size_t> d_r_bin_lookup_table;
+  std::vector<size_t> d_theta_bin_lookup_table;
+  std::vector<size_t> d_z_bin_lookup_table;
+
+  // The azimuthal surface (cos(theta),sin(theta)) directions (not archived)
+  std::vector<std::pair<double,double> > d_theta_surface_directions;
+};
+
+// Save the data to an archive
+template<typename Archive>
+void StructuredCylindricalMesh::save( Archive& ar, const unsigned version ) const
+{
+  // Save the base class data
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( Mesh );
+
+  // Save the local data
+  ar & BOOST_SERIALIZATION_NVP( d_origin );
+  ar & BOOST_SERIALIZATION_NVP( d_r_surfaces );
+  ar & BOOST_SERIALIZATION_NVP( d_theta_surfaces );
+  ar & BOOST_SERIALIZATION_NVP( d_z_surfaces );
+}
+
+// Load the data from an archive
+template<typename Archive>
+void StructuredCylindricalMesh::load( Archive& ar, const unsigned version )
+{
+  // Load the base class data
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( Mesh );
+
+  // Load the local data
+  ar & BOOST_SERIALIZATION_NVP( d_origin );
+  ar & BOOST_SERIALIZATION_NVP( d_r_surfaces );
+  ar & BOOST_SERIALIZATION_NVP( d_theta_surfaces );
+  ar & BOOST_SERIALIZATION_NVP( d_z_surfaces );
+
+  this->initialize();
+}
+
+} // end Utility namespace
+
+BOOST_SERIALIZATION_CLASS_VERSION( StructuredCylindricalMesh, Utility, 0 );
+BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( StructuredCylindricalMesh, Utility );
+EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( Utility, StructuredCylindricalMesh );
+
+#endif // end UTILITY_STRUCTURED_CYLINDRICAL_MESH_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_StructuredCylindricalMesh.hpp
+//---------------------------------------------------------------------------//
@@ -159,6 +159,28 @@ bool StructuredHexMesh::isPointInMesh( const double point[3] ) const
   return false;
 }
 
+// Returns a bool that says whether or not a point is in a hex element.
+/*! \details Points on a plane shared by two hex elements will be
+ * considered to be in both elements.
+ */
+bool StructuredHexMesh::isPointInElement( const double point[3],
+                                          const ElementHandle element ) const
+{
+  // Make sure that the hex index is valid
+  testPrecondition( element < d_hex_elements.size() );
+
+  size_t plane_indices[3];
+
+  this->getHexPlaneIndices( element, plane_indices );
+
+  return d_x_planes[plane_indices[0]] <= point[X_DIMENSION] &&
+    point[X_DIMENSION] <= d_x_planes[plane_indices[0]+1] &&
+    d_y_planes[plane_indices[1]] <= point[Y_DIMENSION] &&
+    point[Y_DIMENSION] <= d_y_planes[plane_indices[1]+1] &&
+    d_z_planes[plane_indices[2]] <= point[Z_DIMENSION] &&
+    point[Z_DIMENSION] <= d_z_planes[plane_indices[2]+1];
+}
+
 // Returns the index of the hex that contains a given point.
 auto StructuredHexMesh::whichElementIsPointIn( const double point[3] ) const -> ElementHandle
 {
@@ -109,6 +109,10 @@ public:
   //! Returns a bool that says whether or not a point is in the mesh.
   bool isPointInMesh( const double point[3] ) const final override;
 
+  //! Returns a bool that says whether or not a point is in a hex element.
+  bool isPointInElement( const double point[3],
+                         const ElementHandle element ) const final override;
+
   // Compute hex index from plane indices
   size_t findIndex( const size_t i, const size_t j, const size_t k ) const;
 
@@ -0,0 +1,216 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_StructuredMeshHelpers.cpp
+//! \author Alex Robinson
+//! \brief  Structured mesh helper functions
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <cmath>
+#include <algorithm>
+
+// FRENSIE Includes
+#include "Utility_StructuredMeshHelpers.hpp"
+#include "Utility_SearchAlgorithms.hpp"
+#include "Utility_SortAlgorithms.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Utility{
+
+// Create the bin index lookup table of a sorted set of mesh surfaces
+/*! \details The range of the surfaces is divided into equal width buckets
+ * (four times as many buckets as surface bins). Each bucket stores the index
+ * of the bin that contains the lower bound of the bucket so that the bin
+ * that contains a value can be found with a short linear search starting
+ * from the bucket that the value falls in (expected constant time unless the
+ * surfaces are very nonuniformly spaced).
+ */
+void createStructuredMeshBinLookupTable( const std::vector<double>& surfaces,
+                                         std::vector<size_t>& lookup_table )
+{
+  // Make sure that there is at least one bin
+  testPrecondition( surfaces.size() >= 2 );
+  // Make sure that the surfaces are sorted
+  testPrecondition( Sort::isSortedAscending( surfaces.begin(),
+                                             surfaces.end() ) );
+
+  const size_t last_bin_index = surfaces.size() - 2;
+
+  lookup_table.resize( 4*(surfaces.size() - 1) );
+
+  const double bucket_width =
+    (surfaces.back() - surfaces.front())/lookup_table.size();
+
+  for( size_t i = 0; i < lookup_table.size(); ++i )
+  {
+    const double bucket_lower_bound = surfaces.front() + i*bucket_width;
+
+    if( bucket_lower_bound >= surfaces.back() )
+      lookup_table[i] = last_bin_index;
+    else
+    {
+      lookup_table[i] =
+        std::min( (size_t)Search::binaryLowerBoundIndex( surfaces.begin(),
+                                                         surfaces.end(),
+                                                         bucket_lower_bound ),
+                  last_bin_index );
+    }
+  }
+}
+
+// Return the index of the bin that contains the value
+/*! \details Values that are on a surface shared by two bins will be
+ * considered to be in the upper bin. Values outside of the surface range
+ * will be assigned to the closest bin.
+ */
+size_t findStructuredMeshBinIndex( const double value,
+                                   const std::vector<double>& surfaces,
+                                   const std::vector<size_t>& lookup_table )
+{
+  // Make sure that the lookup table has been created
+  testPrecondition( lookup_table.size() > 0 );
+
+  const size_t last_bin_index = surfaces.size() - 2;
+
+  const double bucket = (value - surfaces.front())/
+    (surfaces.back() - surfaces.front())*lookup_table.size();
+
+  size_t bin_index;
+
+  if( bucket <= 0.0 )
+    bin_index = lookup_table.front();
+  else if( bucket >= lookup_table.size() )
+    bin_index = lookup_table.back();
+  else
+    bin_index = lookup_table[(size_t)bucket];
+
+  // Correct for values that are not in the bucket due to round-off
+  while( bin_index > 0 && surfaces[bin_index] > value )
+    --bin_index;
+
+  while( bin_index < last_bin_index && surfaces[bin_index+1] <= value )
+    ++bin_index;
+
+  return bin_index;
+}
+
+// Solve a quadratic equation (returns the number of real roots)
+/*! \details The roots will be stored in ascending order. A numerically
+ * stable form of the quadratic formula is used so that nearly degenerate
+ * equations (e.g. rays that are almost parallel to a cylinder axis) do not
+ * suffer from cancellation errors.
+ */
+unsigned solveQuadraticEquation( const double a,
+                                 const double b,
+                                 const double c,
+                                 double roots[2] )
+{
+  if( a == 0.0 )
+  {
+    if( b == 0.0 )
+      return 0u;
+    else
+    {
+      roots[0] = -c/b;
+
+      return 1u;
+    }
+  }
+
+  const double discriminant = b*b - 4.0*a*c;
+
+  if( discriminant < 0.0 )
+    return 0u;
+
+  const double q = (b < 0.0 ? -0.5*(b - std::sqrt( discriminant )) :
+                    -0.5*(b + std::sqrt( discriminant )) );
+
+  if( q == 0.0 )
+  {
+    roots[0] = 0.0;
+    roots[1] = 0.0;
+  }
+  else
+  {
+    roots[0] = q/a;
+    roots[1] = c/q;
+
+    if( roots[0] > roots[1] )
+      std::swap( roots[0], roots[1] );
+  }
+
+  return 2u;
+}
+
+// Convert the sorted surface crossing distances along a ray to track lengths
+/*! \details The crossing distances must start with zero and end with the
+ * total track length. The element that a segment between two consecutive
+ * crossings is in is determined from the midpoint of the segment, which
+ * makes the conversion insensitive to round-off in the crossing distances.
+ * Consecutive segments in the same element (e.g. due to a tangent crossing)
+ * will be combined.
+ */
+void convertSurfaceCrossingDistancesToTrackLengths(
+                        const Mesh& mesh,
+                        const double start_point[3],
+                        const double direction[3],
+                        const std::vector<double>& crossing_distances,
+                        Mesh::ElementHandleTrackLengthArray& track_lengths )
+{
+  // Make sure that the crossing distances are valid
+  testPrecondition( crossing_distances.size() >= 2 );
+  testPrecondition( Sort::isSortedAscending( crossing_distances.begin(),
+                                             crossing_distances.end() ) );
+
+  bool last_segment_in_mesh = false;
+
+  for( size_t i = 1; i < crossing_distances.size(); ++i )
+  {
+    const double segment_length =
+      crossing_distances[i] - crossing_distances[i-1];
+
+    if( segment_length <= 0.0 )
+      continue;
+
+    const double midpoint_distance =
+      0.5*(crossing_distances[i] + crossing_distances[i-1]);
+
+    const double midpoint[3] =
+      {start_point[0] + direction[0]*midpoint_distance,
+       start_point[1] + direction[1]*midpoint_distance,
+       start_point[2] + direction[2]*midpoint_distance};
+
+    if( !mesh.isPointInMesh( midpoint ) )
+    {
+      last_segment_in_mesh = false;
+
+      continue;
+    }
+
+    const Mesh::ElementHandle element = mesh.whichElementIsPointIn( midpoint );
+
+    if( last_segment_in_mesh &&
+        std::get<0>( track_lengths.back() ) == element )
+    {
+      std::get<2>( track_lengths.back() ) += segment_length;
+    }
+    else
+    {
+      track_lengths.push_back( std::make_tuple(
+             element,
+             std::array<double,3>( {start_point[0] + direction[0]*crossing_distances[i-1],
+                                    start_point[1] + direction[1]*crossing_distances[i-1],
+                                    start_point[2] + direction[2]*crossing_distances[i-1]} ),
+             segment_length ) );
+    }
+
+    last_segment_in_mesh = true;
+  }
+}
+
+} // end Utility namespace
+
+//---------------------------------------------------------------------------//
+// end Utility_StructuredMeshHelpers.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,49 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_StructuredMeshHelpers.hpp
+//! \author Alex Robinson
+//! \brief  Structured mesh helper functions
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_STRUCTURED_MESH_HELPERS_HPP
+#define UTILITY_STRUCTURED_MESH_HELPERS_HPP
+
+// Std Lib Includes
+#include <vector>
+
+// FRENSIE Includes
+#include "Utility_Mesh.hpp"
+
+namespace Utility{
+
+//! Create the bin index lookup table of a sorted set of mesh surfaces
+void createStructuredMeshBinLookupTable( const std::vector<double>& surfaces,
+                                         std::vector<size_t>& lookup_table );
+
+//! Return the index of the bin that contains the value
+size_t findStructuredMeshBinIndex( const double value,
+                                   const std::vector<double>& surfaces,
+                                   const std::vector<size_t>& lookup_table );
+
+//! Solve a quadratic equation (returns the number of real roots)
+unsigned solveQuadraticEquation( const double a,
+                                 const double b,
+                                 const double c,
+                                 double roots[2] );
+
+//! Convert the sorted surface crossing distances along a ray to track lengths
+void convertSurfaceCrossingDistancesToTrackLengths(
+                        const Mesh& mesh,
+                        const double start_point[3],
+                        const double direction[3],
+                        const std::vector<double>& crossing_distances,
+                        Mesh::ElementHandleTrackLengthArray& track_lengths );
+
+} // end Utility namespace
+
+#endif // end UTILITY_STRUCTURED_MESH_HELPERS_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_StructuredMeshHelpers.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,667 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_StructuredSphericalMesh.cpp
+//! \author Alex Robinson
+//! \brief  Structured spherical mesh class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <cmath>
+#include <algorithm>
+
+// FRENSIE Includes
+#include "FRENSIE_Archives.hpp" // This must be included first
+#include "Utility_StructuredSphericalMesh.hpp"
+#include "Utility_StructuredMeshHelpers.hpp"
+#include "Utility_MOABException.hpp"
+#include "Utility_3DCartesianVectorHelpers.hpp"
+#include "Utility_PhysicalConstants.hpp"
+#include "Utility_DesignByContract.hpp"
+#include "Utility_SortAlgorithms.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_LoggingMacros.hpp"
+#include "FRENSIE_config.hpp"
+
+// Moab Includes
+#ifdef HAVE_FRENSIE_MOAB
+#include <moab/Core.hpp>
+#include <moab/ScdInterface.hpp>
+#endif // end HAVE_FRENSIE_MOAB
+
+namespace Utility{
+
+// Default constructor
+StructuredSphericalMesh::StructuredSphericalMesh()
+{ /* ... */ }
+
+// Constructor
+StructuredSphericalMesh::StructuredSphericalMesh(
+                                     const std::vector<double>& r_surfaces,
+                                     const std::vector<double>& theta_surfaces,
+                                     const std::vector<double>& mu_surfaces )
+  : StructuredSphericalMesh( std::array<double,3>( {0.0, 0.0, 0.0} ),
+                             r_surfaces,
+                             theta_surfaces,
+                             mu_surfaces )
+{ /* ... */ }
+
+// Constructor (mesh origin is not the global origin)
+StructuredSphericalMesh::StructuredSphericalMesh(
+                                     const std::array<double,3>& origin,
+                                     const std::vector<double>& r_surfaces,
+                                     const std::vector<double>& theta_surfaces,
+                                     const std::vector<double>& mu_surfaces )
+  : d_origin( origin ),
+    d_r_surfaces( r_surfaces ),
+    d_theta_surfaces( theta_surfaces ),
+    d_mu_surfaces( mu_surfaces )
+{
+  // Test for at least 2 surfaces
+  testPrecondition( r_surfaces.size() >= 2 );
+  testPrecondition( theta_surfaces.size() >= 2 );
+  testPrecondition( mu_surfaces.size() >= 2 );
+  // Make sure that the surfaces are in increasing sequential order
+  testPrecondition( Sort::isSortedAscending( r_surfaces.begin(),
+                                             r_surfaces.end() ) );
+  testPrecondition( Sort::isSortedAscending( theta_surfaces.begin(),
+                                             theta_surfaces.end() ) );
+  testPrecondition( Sort::isSortedAscending( mu_surfaces.begin(),
+                                             mu_surfaces.end() ) );
+  // Make sure that the radial surfaces are valid
+  testPrecondition( r_surfaces.front() >= 0.0 );
+  // Make sure that the azimuthal surfaces are valid
+  testPrecondition( theta_surfaces.front() >= 0.0 );
+  testPrecondition( theta_surfaces.back() <= 2*PhysicalConstants::pi );
+  // Make sure that the polar angle cosine surfaces are valid
+  testPrecondition( mu_surfaces.front() >= -1.0 );
+  testPrecondition( mu_surfaces.back() <= 1.0 );
+
+  this->initialize();
+
+#ifndef HAVE_FRENSIE_MOAB
+  FRENSIE_LOG_TAGGED_WARNING( "StructuredSphericalMesh",
+                              "Cannot export mesh data to vtk because moab "
+                              "has not been enabled!" );
+#endif // end HAVE_FRENSIE_MOAB
+}
+
+// Initialize the mesh elements and the bin lookup tables
+void StructuredSphericalMesh::initialize()
+{
+  d_elements.resize( (d_r_surfaces.size()-1)*
+                     (d_theta_surfaces.size()-1)*
+                     (d_mu_surfaces.size()-1) );
+
+  for( size_t i = 0; i < d_elements.size(); ++i )
+    d_elements[i] = i;
+
+  createStructuredMeshBinLookupTable( d_r_surfaces, d_r_bin_lookup_table );
+  createStructuredMeshBinLookupTable( d_theta_surfaces,
+                                      d_theta_bin_lookup_table );
+  createStructuredMeshBinLookupTable( d_mu_surfaces, d_mu_bin_lookup_table );
+
+  d_theta_surface_directions.resize( d_theta_surfaces.size() );
+
+  for( size_t j = 0; j < d_theta_surfaces.size(); ++j )
+  {
+    d_theta_surface_directions[j].first = std::cos( d_theta_surfaces[j] );
+    d_theta_surface_directions[j].second = std::sin( d_theta_surfaces[j] );
+  }
+}
+
+// Get the mesh type name
+std::string StructuredSphericalMesh::getMeshTypeName() const
+{
+  return "Structured Spherical Mesh";
+}
+
+// Get the mesh element type name
+std::string StructuredSphericalMesh::getMeshElementTypeName() const
+{
+  return "Spherical Shell Sector";
+}
+
+// Get the start iterator of the mesh element list.
+auto StructuredSphericalMesh::getStartElementHandleIterator() const -> ElementHandleIterator
+{
+  return d_elements.begin();
+}
+
+// Get the end iterator of the mesh element list.
+auto StructuredSphericalMesh::getEndElementHandleIterator() const -> ElementHandleIterator
+{
+  return d_elements.end();
+}
+
+// Get the number of mesh elements
+size_t StructuredSphericalMesh::getNumberOfElements() const
+{
+  return d_elements.size();
+}
+
+// Get the mesh origin
+const std::array<double,3>& StructuredSphericalMesh::getOrigin() const
+{
+  return d_origin;
+}
+
+// Get the number of radial surfaces
+size_t StructuredSphericalMesh::getNumberOfRSurfaces() const
+{
+  return d_r_surfaces.size();
+}
+
+// Get the number of azimuthal surfaces
+size_t StructuredSphericalMesh::getNumberOfThetaSurfaces() const
+{
+  return d_theta_surfaces.size();
+}
+
+// Get the number of polar angle cosine surfaces
+size_t StructuredSphericalMesh::getNumberOfMuSurfaces() const
+{
+  return d_mu_surfaces.size();
+}
+
+// Get the location of a radial surface
+double StructuredSphericalMesh::getRSurfaceLocation( SurfaceIndex i ) const
+{
+  // Make sure that the surface index is valid
+  testPrecondition( i < d_r_surfaces.size() );
+
+  return d_r_surfaces[i];
+}
+
+// Get the location of an azimuthal surface
+double StructuredSphericalMesh::getThetaSurfaceLocation( SurfaceIndex i ) const
+{
+  // Make sure that the surface index is valid
+  testPrecondition( i < d_theta_surfaces.size() );
+
+  return d_theta_surfaces[i];
+}
+
+// Get the location of a polar angle cosine surface
+double StructuredSphericalMesh::getMuSurfaceLocation( SurfaceIndex i ) const
+{
+  // Make sure that the surface index is valid
+  testPrecondition( i < d_mu_surfaces.size() );
+
+  return d_mu_surfaces[i];
+}
+
+// Deconstruct an element handle into the bin indices of each dimension
+void StructuredSphericalMesh::getElementBinIndices(
+                                        const ElementHandle element,
+                                        size_t element_bin_indices[3] ) const
+{
+  // Make sure that the element handle is valid
+  testPrecondition( element < d_elements.size() );
+
+  const size_t r_size = d_r_surfaces.size() - 1;
+  const size_t theta_size = d_theta_surfaces.size() - 1;
+
+  element_bin_indices[2] = element/(r_size*theta_size);
+  element_bin_indices[1] =
+    (element - element_bin_indices[2]*r_size*theta_size)/r_size;
+  element_bin_indices[0] = element - element_bin_indices[1]*r_size -
+    element_bin_indices[2]*r_size*theta_size;
+}
+
+// Compute the element handle from the bin indices of each dimension
+auto StructuredSphericalMesh::findIndex( const size_t i,
+                                           const size_t j,
+                                           const size_t k ) const -> ElementHandle
+{
+  return i +
+    j*(d_r_surfaces.size()-1) +
+    k*(d_r_surfaces.size()-1)*(d_theta_surfaces.size()-1);
+}
+
+// Returns the volumes of the mesh elements for the estimator class.
+void StructuredSphericalMesh::getElementVolumes(
+                               ElementHandleVolumeMap& element_volumes ) const
+{
+  element_volumes.clear();
+
+  for( size_t i = 0; i < d_elements.size(); ++i )
+    element_volumes[d_elements[i]] = this->getElementVolume( d_elements[i] );
+}
+
+// Returns the volume of a specific mesh element
+double StructuredSphericalMesh::getElementVolume( ElementHandle element ) const
+{
+  size_t bin_indices[3];
+  this->getElementBinIndices( element, bin_indices );
+
+  const double inner_r = d_r_surfaces[bin_indices[0]];
+  const double outer_r = d_r_surfaces[bin_indices[0]+1];
+
+  return (outer_r*outer_r*outer_r - inner_r*inner_r*inner_r)/3.0*
+    (d_theta_surfaces[bin_indices[1]+1] - d_theta_surfaces[bin_indices[1]])*
+    (d_mu_surfaces[bin_indices[2]+1] - d_mu_surfaces[bin_indices[2]]);
+}
+
+// Returns a bool that says whether or not a point is in the mesh.
+bool StructuredSphericalMesh::isPointInMesh( const double point[3] ) const
+{
+  double mesh_coordinates[3];
+
+  this->convertToMeshCoordinates( point, mesh_coordinates );
+
+  return this->areMeshCoordinatesInMesh( mesh_coordinates );
+}
+
+// Returns a bool that says whether or not a point is in a mesh element.
+/*! \details Points on a surface shared by two elements will be considered
+ * to be in both elements.
+ */
+bool StructuredSphericalMesh::isPointInElement(
+                                           const double point[3],
+                                           const ElementHandle element ) const
+{
+  // Make sure that the element handle is valid
+  testPrecondition( element < d_elements.size() );
+
+  size_t bin_indices[3];
+  this->getElementBinIndices( element, bin_indices );
+
+  double mesh_coordinates[3];
+  this->convertToMeshCoordinates( point, mesh_coordinates );
+
+  return d_r_surfaces[bin_indices[0]] <= mesh_coordinates[0] &&
+    mesh_coordinates[0] <= d_r_surfaces[bin_indices[0]+1] &&
+    d_theta_surfaces[bin_indices[1]] <= mesh_coordinates[1] &&
+    mesh_coordinates[1] <= d_theta_surfaces[bin_indices[1]+1] &&
+    d_mu_surfaces[bin_indices[2]] <= mesh_coordinates[2] &&
+    mesh_coordinates[2] <= d_mu_surfaces[bin_indices[2]+1];
+}
+
+// Returns the handle of the mesh element that contains a given point.
+/*! \details The bin of each dimension is found using a lookup table so that
+ * the element can be found in expected constant time.
+ */
+auto StructuredSphericalMesh::whichElementIsPointIn( const double point[3] ) const -> ElementHandle
+{
+  // Make sure that the point is in the mesh
+  testPrecondition( this->isPointInMesh( point ) );
+
+  double mesh_coordinates[3];
+  this->convertToMeshCoordinates( point, mesh_coordinates );
+
+  return this->findIndex(
+         findStructuredMeshBinIndex( mesh_coordinates[0],
+                                     d_r_surfaces,
+                                     d_r_bin_lookup_table ),
+         findStructuredMeshBinIndex( mesh_coordinates[1],
+                                     d_theta_surfaces,
+                                     d_theta_bin_lookup_table ),
+         findStructuredMeshBinIndex( mesh_coordinates[2],
+                                     d_mu_surfaces,
+                                     d_mu_bin_lookup_table ) );
+}
+
+// Returns the mesh elements and partial track lengths along a given line segment.
+/*! \details The distances to every mesh surface that is crossed by the line
+ * segment are calculated analytically (ray-sphere, ray-half-plane and
+ * ray-cone intersections). Only the radial surfaces between the extreme
+ * radii of the segment are tested. The segments
+ * between consecutive crossings are then assigned to the mesh elements.
+ */
+void StructuredSphericalMesh::computeTrackLengths(
+                   const double start_point[3],
+                   const double end_point[3],
+                   ElementHandleTrackLengthArray& element_track_lengths ) const
+{
+  element_track_lengths.clear();
+
+  if( start_point[0] == end_point[0] &&
+      start_point[1] == end_point[1] &&
+      start_point[2] == end_point[2] )
+    return;
+
+  const double local_start_point[3] = {start_point[0] - d_origin[0],
+                                       start_point[1] - d_origin[1],
+                                       start_point[2] - d_origin[2]};
+
+  double direction[3] = {end_point[0] - start_point[0],
+                         end_point[1] - start_point[1],
+                         end_point[2] - start_point[2]};
+
+  const double track_length =
+    Utility::normalizeVectorAndReturnMagnitude( direction );
+
+  std::vector<double> crossing_distances( 1, 0.0 );
+
+  this->addRSurfaceCrossingDistances( local_start_point,
+                                      direction,
+                                      track_length,
+                                      crossing_distances );
+
+  this->addThetaSurfaceCrossingDistances( local_start_point,
+                                          direction,
+                                          track_length,
+                                          crossing_distances );
+
+  this->addMuSurfaceCrossingDistances( local_start_point,
+                                       direction,
+                                       track_length,
+                                       crossing_distances );
+
+  crossing_distances.push_back( track_length );
+
+  std::sort( crossing_distances.begin(), crossing_distances.end() );
+
+  convertSurfaceCrossingDistancesToTrackLengths( *this,
+                                                 start_point,
+                                                 direction,
+                                                 crossing_distances,
+                                                 element_track_lengths );
+}
+
+// Convert a point to the (r,theta,mu) coordinates of the mesh
+void StructuredSphericalMesh::convertToMeshCoordinates(
+                                        const double point[3],
+                                        double mesh_coordinates[3] ) const
+{
+  const double x = point[0] - d_origin[0];
+  const double y = point[1] - d_origin[1];
+  const double z = point[2] - d_origin[2];
+
+  mesh_coordinates[0] = std::sqrt( x*x + y*y + z*z );
+  mesh_coordinates[1] = std::atan2( y, x );
+
+  if( mesh_coordinates[1] < 0.0 )
+    mesh_coordinates[1] += 2*PhysicalConstants::pi;
+
+  // The polar angle cosine of the origin is arbitrarily set to zero
+  if( mesh_coordinates[0] > 0.0 )
+  {
+    mesh_coordinates[2] =
+      std::max( -1.0, std::min( z/mesh_coordinates[0], 1.0 ) );
+  }
+  else
+    mesh_coordinates[2] = 0.0;
+}
+
+// Check if the mesh coordinates are in the mesh
+bool StructuredSphericalMesh::areMeshCoordinatesInMesh(
+                                   const double mesh_coordinates[3] ) const
+{
+  return d_r_surfaces.front() <= mesh_coordinates[0] &&
+    mesh_coordinates[0] <= d_r_surfaces.back() &&
+    d_theta_surfaces.front() <= mesh_coordinates[1] &&
+    mesh_coordinates[1] <= d_theta_surfaces.back() &&
+    d_mu_surfaces.front() <= mesh_coordinates[2] &&
+    mesh_coordinates[2] <= d_mu_surfaces.back();
+}
+
+// Add the radial surface crossing distances along the local ray
+void StructuredSphericalMesh::addRSurfaceCrossingDistances(
+                               const double local_start_point[3],
+                               const double direction[3],
+                               const double track_length,
+                               std::vector<double>& crossing_distances ) const
+{
+  const double b = 2.0*(local_start_point[0]*direction[0] +
+                        local_start_point[1]*direction[1] +
+                        local_start_point[2]*direction[2]);
+
+  const double start_r_sqr =
+    local_start_point[0]*local_start_point[0] +
+    local_start_point[1]*local_start_point[1] +
+    local_start_point[2]*local_start_point[2];
+
+  const double end_r_sqr = start_r_sqr + track_length*(b + track_length);
+
+  // Find the range of radii covered by the segment
+  double min_r_sqr = std::min( start_r_sqr, end_r_sqr );
+
+  const double closest_approach_distance = -0.5*b;
+
+  if( closest_approach_distance > 0.0 &&
+      closest_approach_distance < track_length )
+    min_r_sqr = std::max( start_r_sqr - 0.25*b*b, 0.0 );
+
+  const double max_r_sqr = std::max( start_r_sqr, end_r_sqr );
+
+  const size_t lower_index =
+    findStructuredMeshBinIndex( std::sqrt( min_r_sqr ),
+                                d_r_surfaces,
+                                d_r_bin_lookup_table );
+
+  const size_t upper_index =
+    findStructuredMeshBinIndex( std::sqrt( max_r_sqr ),
+                                d_r_surfaces,
+                                d_r_bin_lookup_table ) + 1;
+
+  for( size_t i = lower_index; i <= upper_index; ++i )
+  {
+    double roots[2];
+
+    const unsigned number_of_roots =
+      solveQuadraticEquation( 1.0,
+                              b,
+                              start_r_sqr - d_r_surfaces[i]*d_r_surfaces[i],
+                              roots );
+
+    for( unsigned n = 0; n < number_of_roots; ++n )
+    {
+      if( roots[n] > 0.0 && roots[n] < track_length )
+        crossing_distances.push_back( roots[n] );
+    }
+  }
+}
+
+// Add the azimuthal surface crossing distances along the local ray
+void StructuredSphericalMesh::addThetaSurfaceCrossingDistances(
+                               const double local_start_point[3],
+                               const double direction[3],
+                               const double track_length,
+                               std::vector<double>& crossing_distances ) const
+{
+  for( size_t j = 0; j < d_theta_surface_directions.size(); ++j )
+  {
+    const double cos_theta = d_theta_surface_directions[j].first;
+    const double sin_theta = d_theta_surface_directions[j].second;
+
+    // The plane normal is (-sin(theta),cos(theta),0)
+    const double direction_dot_normal =
+      direction[1]*cos_theta - direction[0]*sin_theta;
+
+    if( direction_dot_normal == 0.0 )
+      continue;
+
+    const double distance =
+      (local_start_point[0]*sin_theta - local_start_point[1]*cos_theta)/
+      direction_dot_normal;
+
+    if( distance > 0.0 && distance < track_length )
+    {
+      // Only the half-plane on the theta side of the z-axis is a mesh surface
+      const double x = local_start_point[0] + direction[0]*distance;
+      const double y = local_start_point[1] + direction[1]*distance;
+
+      if( x*cos_theta + y*sin_theta > 0.0 )
+        crossing_distances.push_back( distance );
+    }
+  }
+}
+
+// Add the polar angle cosine surface crossing distances along the local ray
+/*! \details A polar angle cosine surface is the nappe of the cone
+ * z^2 = mu^2 r^2 on the mu side of the xy-plane (mu = 0 is the xy-plane).
+ * The surfaces at mu = -1 and mu = 1 are the z-axis, which cannot be
+ * crossed.
+ */
+void StructuredSphericalMesh::addMuSurfaceCrossingDistances(
+                               const double local_start_point[3],
+                               const double direction[3],
+                               const double track_length,
+                               std::vector<double>& crossing_distances ) const
+{
+  const double start_r_sqr =
+    local_start_point[0]*local_start_point[0] +
+    local_start_point[1]*local_start_point[1] +
+    local_start_point[2]*local_start_point[2];
+
+  const double start_dot_direction =
+    local_start_point[0]*direction[0] +
+    local_start_point[1]*direction[1] +
+    local_start_point[2]*direction[2];
+
+  for( size_t k = 0; k < d_mu_surfaces.size(); ++k )
+  {
+    const double mu = d_mu_surfaces[k];
+
+    if( mu <= -1.0 || mu >= 1.0 )
+      continue;
+
+    // The degenerate cone (xy-plane) must be handled separately - the
+    // discriminant is zero and round-off could cause the root to be missed
+    if( mu == 0.0 )
+    {
+      if( direction[2] != 0.0 )
+      {
+        const double distance = -local_start_point[2]/direction[2];
+
+        if( distance > 0.0 && distance < track_length )
+          crossing_distances.push_back( distance );
+      }
+
+      continue;
+    }
+
+    const double mu_sqr = mu*mu;
+
+    double roots[2];
+
+    const unsigned number_of_roots =
+      solveQuadraticEquation(
+         direction[2]*direction[2] - mu_sqr,
+         2.0*(local_start_point[2]*direction[2] - mu_sqr*start_dot_direction),
+         local_start_point[2]*local_start_point[2] - mu_sqr*start_r_sqr,
+         roots );
+
+    for( unsigned n = 0; n < number_of_roots; ++n )
+    {
+      if( roots[n] > 0.0 && roots[n] < track_length )
+      {
+        // Only the nappe on the mu side of the xy-plane is a mesh surface
+        const double z = local_start_point[2] + direction[2]*roots[n];
+
+        if( z*mu >= 0.0 )
+          crossing_distances.push_back( roots[n] );
+      }
+    }
+  }
+}
+
+// Export the mesh to a file (type determined by suffix)
+/*! \details The mesh is exported as a curvilinear structured hex mesh (i.e.
+ * the curved element surfaces are approximated by flat faces).
+ */
+void StructuredSphericalMesh::exportData(
+                       const std::string& output_file_name,
+                       const TagNameSet& tag_root_names,
+                       const MeshElementHandleDataMap& mesh_tag_data ) const
+{
+#ifdef HAVE_FRENSIE_MOAB
+  // Preset this value to be used with all the functions that MOAB uses
+  moab::ErrorCode rval;
+
+  // Create pointer that points to a new instance of the moab_interface
+  moab::Interface *moab_interface = new moab::Core();
+
+  // Create pointer that points to a new instance of the structured mesh
+  // interface
+  moab::ScdInterface *scdiface = new moab::ScdInterface(moab_interface);
+
+  const size_t r_coordinates_size = d_r_surfaces.size();
+  const size_t theta_coordinates_size = d_theta_surfaces.size();
+  const size_t mu_coordinates_size = d_mu_surfaces.size();
+
+  const size_t size_of_coordinates =
+    r_coordinates_size*theta_coordinates_size*mu_coordinates_size;
+
+  // This array can get very large, so allocate on the heap instead of the
+  // stack.
+  double* coordinates = new double[size_of_coordinates*3];
+
+  // Construct the interleaved (XYZXYZ) vertex coordinate array (see
+  // StructuredHexMesh::exportData for the required ordering)
+  size_t l = 0;
+  for( size_t k = 0; k < mu_coordinates_size; ++k )
+  {
+    const double sin_polar_angle =
+      std::sqrt( std::max( 1.0 - d_mu_surfaces[k]*d_mu_surfaces[k], 0.0 ) );
+
+    for( size_t j = 0; j < theta_coordinates_size; ++j )
+    {
+      for( size_t i = 0; i < r_coordinates_size; ++i )
+      {
+        coordinates[l] = d_origin[0] + d_r_surfaces[i]*sin_polar_angle*
+          d_theta_surface_directions[j].first;
+        coordinates[l + 1] = d_origin[1] + d_r_surfaces[i]*sin_polar_angle*
+          d_theta_surface_directions[j].second;
+        coordinates[l + 2] = d_origin[2] + d_r_surfaces[i]*d_mu_surfaces[k];
+        l += 3;
+      }
+    }
+  }
+
+  moab::ScdBox* box;
+  {
+    // Create the box filled with the coordinates
+    rval = scdiface->construct_box( moab::HomCoord( 0, 0, 0),
+                                    moab::HomCoord( r_coordinates_size - 1,
+                                                    theta_coordinates_size - 1,
+                                                    mu_coordinates_size - 1 ),
+                                    coordinates,
+                                    size_of_coordinates*3,
+                                    box );
+
+    TEST_FOR_EXCEPTION( rval != moab::MB_SUCCESS,
+                        Utility::MOABException,
+                        moab::ErrorCodeStr[rval] );
+  }
+  delete[] coordinates;
+
+  // Create the meshset
+  moab::EntityHandle meshset = box->box_set();
+
+  size_t bin_indices[3];
+
+  this->exportDataImpl( output_file_name,
+                        tag_root_names,
+                        mesh_tag_data,
+                        moab_interface,
+                        meshset,
+                        [&box,&bin_indices,this](const ElementHandle element) -> ElementHandle
+                        {
+                          this->getElementBinIndices( element, bin_indices );
+                          return box->get_element( bin_indices[0],
+                                                   bin_indices[1],
+                                                   bin_indices[2] );
+                        } );
+
+  // Tidy up
+  delete box;
+  delete scdiface;
+  delete moab_interface;
+#else
+  THROW_EXCEPTION( std::logic_error,
+                   "The exporting of structured spherical mesh data can "
+                   "only be done if MOAB has been enabled!" );
+#endif // end HAVE_FRENSIE_MOAB
+}
+
+} // end Utility namespace
+
+BOOST_CLASS_EXPORT_IMPLEMENT( Utility::StructuredSphericalMesh )
+EXPLICIT_CLASS_SAVE_LOAD_INST( Utility::StructuredSphericalMesh );
+
+//---------------------------------------------------------------------------//
+// end Utility_StructuredSphericalMesh.cpp
+//---------------------------------------------------------------------------//
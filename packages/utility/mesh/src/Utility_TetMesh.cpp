@@ -99,6 +99,10 @@ public:
   //! Returns the tet that contains a given point
   ElementHandle whichElementIsPointIn( const double point[3] ) const;
 
+  //! Check if a point is inside of a specific tet
+  bool isPointInElement( const double point[3],
+                         const ElementHandle element ) const;
+
   //! Determine the mesh elements that a line segment intersects
   void computeTrackLengths( const double start_point[3],
                             const double end_point[3],
@@ -592,6 +596,38 @@ bool TetMeshImpl::isPointInMesh( const double point[3] ) const
 #endif // end HAVE_FRENSIE_MOAB
 }
 
+// Check if a point is inside of a specific tet
+bool TetMesh::isPointInElement( const double point[3],
+                                const ElementHandle element ) const
+{
+  return d_impl->isPointInElement( point, element );
+}
+
+// Check if a point is inside of a specific tet
+/*! \details Only the barycentric coordinates of the tet are checked (no
+ * kd-tree search is done).
+ */
+bool TetMeshImpl::isPointInElement( const double point[3],
+                                    const ElementHandle element ) const
+{
+#ifdef HAVE_FRENSIE_MOAB
+  std::unordered_map<ElementHandle,std::pair<std::array<double,9>,std::array<double,3> > >::const_iterator
+    tet_barycentric_data_it = d_tet_barycentric_data.find( element );
+
+  if( tet_barycentric_data_it != d_tet_barycentric_data.end() )
+  {
+    return Utility::isPointInTet( point,
+                                  tet_barycentric_data_it->second.second.data(),
+                                  tet_barycentric_data_it->second.first.data(),
+                                  s_tol );
+  }
+  else
+    return false;
+#else // HAVE_FRENSIE_MOAB
+  return false;
+#endif // end HAVE_FRENSIE_MOAB
+}
+
 // Returns the tet that contains a given point
 auto TetMesh::whichElementIsPointIn( const double point[3] ) const -> ElementHandle
 {
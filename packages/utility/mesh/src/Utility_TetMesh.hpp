@@ -87,6 +87,10 @@ public:
   //! Returns the tet that contains a given point
   ElementHandle whichElementIsPointIn( const double point[3] ) const final override;
 
+  //! Check if a point is inside of a specific tet
+  bool isPointInElement( const double point[3],
+                         const ElementHandle element ) const final override;
+
   //! Determine the mesh elements that a line segment intersects
   void computeTrackLengths( const double start_point[3],
                             const double end_point[3],
@@ -251,6 +251,38 @@ FRENSIE_UNIT_TEST( StructuredHexMesh, whichElementIsPointIn )
   FRENSIE_CHECK_EQUAL( hex_mesh->whichElementIsPointIn(point11), 7);
 }
 
+//---------------------------------------------------------------------------//
+// test whether or not the point in element method works
+FRENSIE_UNIT_TEST( StructuredHexMesh, isPointInElement )
+{
+  std::vector<double> x_planes( {0.0, 0.5, 1.0} ),
+    y_planes( {0.0, 0.5, 1.0} ),
+    z_planes( {0.0, 0.5, 1.0} );
+
+  std::shared_ptr<Utility::StructuredHexMesh> hex_mesh(
+              new Utility::StructuredHexMesh( x_planes, y_planes, z_planes ) );
+
+  double point1[3] {0.25, 0.25, 0.25};
+  double point2[3] {0.75, 0.75, 0.75};
+
+  FRENSIE_CHECK( hex_mesh->isPointInElement(point1, 0) );
+  FRENSIE_CHECK( !hex_mesh->isPointInElement(point1, 1) );
+  FRENSIE_CHECK( !hex_mesh->isPointInElement(point1, 7) );
+  FRENSIE_CHECK( hex_mesh->isPointInElement(point2, 7) );
+  FRENSIE_CHECK( !hex_mesh->isPointInElement(point2, 6) );
+
+  // Points on shared planes are in every element that shares the plane
+  double point3[3] {0.5, 0.25, 0.25};
+
+  FRENSIE_CHECK( hex_mesh->isPointInElement(point3, 0) );
+  FRENSIE_CHECK( hex_mesh->isPointInElement(point3, 1) );
+
+  // Points outside of the mesh
+  double point4[3] {-1e-5, 0.25, 0.25};
+
+  FRENSIE_CHECK( !hex_mesh->isPointInElement(point4, 0) );
+}
+
 //---------------------------------------------------------------------------//
 // test simple cases of rays not interacting with mesh and computeTrackLengths
 // returning empty arrays
@@ -0,0 +1,592 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstStructuredSphericalMesh.cpp
+//! \author Alex Robinson
+//! \brief  StructuredSphericalMesh class unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+
+// FRENSIE Includes
+#include "Utility_StructuredSphericalMesh.hpp"
+#include "Utility_PhysicalConstants.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+#include "FRENSIE_config.hpp"
+#include "ArchiveTestHelpers.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+typedef TestArchiveHelper::TestArchives TestArchives;
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+const double pi = Utility::PhysicalConstants::pi;
+
+std::vector<double> r_surfaces( {0.0, 1.0, 2.0} ),
+  theta_surfaces( {0.0, pi/2, pi, 3*pi/2, 2*pi} ),
+  mu_surfaces( {-1.0, 0.0, 1.0} );
+
+std::shared_ptr<const Utility::StructuredSphericalMesh> mesh;
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the mesh can be constructed
+FRENSIE_UNIT_TEST( StructuredSphericalMesh, constructor )
+{
+  std::shared_ptr<Utility::StructuredSphericalMesh> local_mesh;
+
+  FRENSIE_CHECK_NO_THROW( local_mesh.reset(
+                         new Utility::StructuredSphericalMesh(
+                           {1.0, 2.0, 3.0}, r_surfaces, theta_surfaces, mu_surfaces ) ) );
+
+  FRENSIE_CHECK_EQUAL( local_mesh->getOrigin(),
+                       (std::array<double,3>( {1.0, 2.0, 3.0} )) );
+
+  FRENSIE_CHECK_EQUAL( local_mesh->getNumberOfRSurfaces(), 3 );
+  FRENSIE_CHECK_EQUAL( local_mesh->getRSurfaceLocation( 0 ), 0.0 );
+  FRENSIE_CHECK_EQUAL( local_mesh->getRSurfaceLocation( 1 ), 1.0 );
+  FRENSIE_CHECK_EQUAL( local_mesh->getRSurfaceLocation( 2 ), 2.0 );
+
+  FRENSIE_CHECK_EQUAL( local_mesh->getNumberOfThetaSurfaces(), 5 );
+  FRENSIE_CHECK_EQUAL( local_mesh->getThetaSurfaceLocation( 0 ), 0.0 );
+  FRENSIE_CHECK_EQUAL( local_mesh->getThetaSurfaceLocation( 1 ), pi/2 );
+  FRENSIE_CHECK_EQUAL( local_mesh->getThetaSurfaceLocation( 2 ), pi );
+  FRENSIE_CHECK_EQUAL( local_mesh->getThetaSurfaceLocation( 3 ), 3*pi/2 );
+  FRENSIE_CHECK_EQUAL( local_mesh->getThetaSurfaceLocation( 4 ), 2*pi );
+
+  FRENSIE_CHECK_EQUAL( local_mesh->getNumberOfMuSurfaces(), 3 );
+  FRENSIE_CHECK_EQUAL( local_mesh->getMuSurfaceLocation( 0 ), -1.0 );
+  FRENSIE_CHECK_EQUAL( local_mesh->getMuSurfaceLocation( 1 ), 0.0 );
+  FRENSIE_CHECK_EQUAL( local_mesh->getMuSurfaceLocation( 2 ), 1.0 );
+
+  FRENSIE_CHECK_EQUAL( local_mesh->getNumberOfElements(), 16 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the mesh type name can be returned
+FRENSIE_UNIT_TEST( StructuredSphericalMesh, getMeshTypeName )
+{
+  FRENSIE_CHECK_EQUAL( mesh->getMeshTypeName(),
+                       "Structured Spherical Mesh" );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the mesh element type name can be returned
+FRENSIE_UNIT_TEST( StructuredSphericalMesh, getMeshElementTypeName )
+{
+  FRENSIE_CHECK_EQUAL( mesh->getMeshElementTypeName(),
+                       "Spherical Shell Sector" );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the element handles can be iterated over
+FRENSIE_UNIT_TEST( StructuredSphericalMesh, getElementHandleIterators )
+{
+  Utility::StructuredSphericalMesh::ElementHandleIterator element_it =
+    mesh->getStartElementHandleIterator();
+
+  size_t number_of_elements = 0;
+
+  while( element_it != mesh->getEndElementHandleIterator() )
+  {
+    FRENSIE_CHECK_EQUAL( *element_it, number_of_elements );
+
+    ++element_it;
+    ++number_of_elements;
+  }
+
+  FRENSIE_CHECK_EQUAL( number_of_elements, 16 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the element bin indices can be found
+FRENSIE_UNIT_TEST( StructuredSphericalMesh, getElementBinIndices )
+{
+  size_t bin_indices[3];
+
+  mesh->getElementBinIndices( 0, bin_indices );
+
+  FRENSIE_CHECK_EQUAL( bin_indices[0], 0 );
+  FRENSIE_CHECK_EQUAL( bin_indices[1], 0 );
+  FRENSIE_CHECK_EQUAL( bin_indices[2], 0 );
+
+  mesh->getElementBinIndices( 15, bin_indices );
+
+  FRENSIE_CHECK_EQUAL( bin_indices[0], 1 );
+  FRENSIE_CHECK_EQUAL( bin_indices[1], 3 );
+  FRENSIE_CHECK_EQUAL( bin_indices[2], 1 );
+
+  FRENSIE_CHECK_EQUAL( mesh->findIndex( 1, 3, 1 ), 15 );
+
+  mesh->getElementBinIndices( 4, bin_indices );
+
+  FRENSIE_CHECK_EQUAL( bin_indices[0], 0 );
+  FRENSIE_CHECK_EQUAL( bin_indices[1], 2 );
+  FRENSIE_CHECK_EQUAL( bin_indices[2], 0 );
+
+  FRENSIE_CHECK_EQUAL( mesh->findIndex( 0, 2, 0 ), 4 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the element volumes can be returned
+FRENSIE_UNIT_TEST( StructuredSphericalMesh, getElementVolumes )
+{
+  Utility::StructuredSphericalMesh::ElementHandleVolumeMap volume_map;
+
+  mesh->getElementVolumes( volume_map );
+
+  FRENSIE_REQUIRE_EQUAL( volume_map.size(), 16 );
+
+  for( size_t i = 0; i < 16; i += 2 )
+  {
+    FRENSIE_CHECK_FLOATING_EQUALITY( volume_map[i], pi/6, 1e-12 );
+    FRENSIE_CHECK_FLOATING_EQUALITY( volume_map[i+1], 7*pi/6, 1e-12 );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that the volume of an element can be returned
+FRENSIE_UNIT_TEST( StructuredSphericalMesh, getElementVolume )
+{
+  FRENSIE_CHECK_FLOATING_EQUALITY( mesh->getElementVolume( 0 ),
+                                   pi/6,
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( mesh->getElementVolume( 11 ),
+                                   7*pi/6,
+                                   1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check if a point is in the mesh
+FRENSIE_UNIT_TEST( StructuredSphericalMesh, isPointInMesh )
+{
+  double point[3] = {0.0, 0.0, 0.0};
+
+  FRENSIE_CHECK( mesh->isPointInMesh( point ) );
+
+  point[0] = 1.0;
+  point[1] = 1.0;
+  point[2] = 1.0;
+
+  FRENSIE_CHECK( mesh->isPointInMesh( point ) );
+
+  point[0] = 1.5;
+  point[1] = 1.5;
+  point[2] = 0.5;
+
+  FRENSIE_CHECK( !mesh->isPointInMesh( point ) );
+
+  // Check a mesh that only covers part of a spherical shell
+  std::shared_ptr<const Utility::StructuredSphericalMesh> partial_mesh(
+                           new Utility::StructuredSphericalMesh(
+                                        {0.5, 2.0}, {0.0, pi/2}, {0.0, 1.0} ) );
+
+  point[0] = 0.5;
+  point[1] = 0.5;
+  point[2] = 0.5;
+
+  FRENSIE_CHECK( partial_mesh->isPointInMesh( point ) );
+
+  point[2] = -0.5;
+
+  FRENSIE_CHECK( !partial_mesh->isPointInMesh( point ) );
+
+  point[0] = -0.5;
+  point[2] = 0.5;
+
+  FRENSIE_CHECK( !partial_mesh->isPointInMesh( point ) );
+
+  point[0] = 0.1;
+  point[1] = 0.1;
+  point[2] = 0.1;
+
+  FRENSIE_CHECK( !partial_mesh->isPointInMesh( point ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check if a point is in a mesh element
+FRENSIE_UNIT_TEST( StructuredSphericalMesh, isPointInElement )
+{
+  double point[3] = {0.5, 0.5, 0.5};
+
+  FRENSIE_CHECK( mesh->isPointInElement( point, 8 ) );
+  FRENSIE_CHECK( !mesh->isPointInElement( point, 0 ) );
+  FRENSIE_CHECK( !mesh->isPointInElement( point, 9 ) );
+  FRENSIE_CHECK( !mesh->isPointInElement( point, 10 ) );
+
+  // Points on a shared surface are in both elements
+  point[0] = 1.0;
+  point[1] = 0.0;
+  point[2] = 0.0;
+
+  FRENSIE_CHECK( mesh->isPointInElement( point, 0 ) );
+  FRENSIE_CHECK( mesh->isPointInElement( point, 1 ) );
+  FRENSIE_CHECK( mesh->isPointInElement( point, 8 ) );
+  FRENSIE_CHECK( mesh->isPointInElement( point, 9 ) );
+  FRENSIE_CHECK( !mesh->isPointInElement( point, 2 ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the element that contains a point can be found
+FRENSIE_UNIT_TEST( StructuredSphericalMesh, whichElementIsPointIn )
+{
+  double point[3] = {0.5, 0.5, 0.5};
+
+  FRENSIE_CHECK_EQUAL( mesh->whichElementIsPointIn( point ), 8 );
+
+  point[0] = -1.0;
+  point[1] = 0.5;
+  point[2] = -1.0;
+
+  FRENSIE_CHECK_EQUAL( mesh->whichElementIsPointIn( point ), 3 );
+
+  point[0] = 0.1;
+  point[1] = -1.5;
+  point[2] = 0.5;
+
+  FRENSIE_CHECK_EQUAL( mesh->whichElementIsPointIn( point ), 15 );
+
+  point[0] = -0.5;
+  point[1] = -0.1;
+  point[2] = -0.5;
+
+  FRENSIE_CHECK_EQUAL( mesh->whichElementIsPointIn( point ), 4 );
+
+  // Points on the outer surfaces are in the outer elements
+  point[0] = 0.0;
+  point[1] = 0.0;
+  point[2] = 2.0;
+
+  FRENSIE_CHECK_EQUAL( mesh->whichElementIsPointIn( point ), 9 );
+
+  // Check a mesh with a translated origin
+  std::shared_ptr<const Utility::StructuredSphericalMesh> translated_mesh(
+                           new Utility::StructuredSphericalMesh(
+                                                      {1.0, 1.0, 1.0},
+                                                      r_surfaces,
+                                                      theta_surfaces,
+                                                      mu_surfaces ) );
+
+  point[0] = 0.0;
+  point[1] = 1.5;
+  point[2] = 0.0;
+
+  FRENSIE_CHECK_EQUAL( translated_mesh->whichElementIsPointIn( point ), 3 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the track lengths are empty when a line segment misses the mesh
+FRENSIE_UNIT_TEST( StructuredSphericalMesh, computeTrackLengths_no_intersection )
+{
+  Utility::StructuredSphericalMesh::ElementHandleTrackLengthArray
+    contribution;
+
+  // Misses the outer radial surface
+  double start_point[3] = {-3.0, 2.5, 0.0};
+  double end_point[3] = {3.0, 2.5, 0.0};
+
+  mesh->computeTrackLengths( start_point, end_point, contribution );
+
+  FRENSIE_CHECK_EQUAL( contribution.size(), 0 );
+
+  // Moves away from the mesh
+  start_point[0] = 3.0;
+  start_point[1] = 3.0;
+  start_point[2] = 3.0;
+  end_point[0] = 4.0;
+  end_point[1] = 4.0;
+  end_point[2] = 4.0;
+
+  mesh->computeTrackLengths( start_point, end_point, contribution );
+
+  FRENSIE_CHECK_EQUAL( contribution.size(), 0 );
+
+  // Ends before reaching the mesh
+  start_point[0] = -3.0;
+  start_point[1] = 0.5;
+  start_point[2] = 0.5;
+  end_point[0] = -2.5;
+  end_point[1] = 0.5;
+  end_point[2] = 0.5;
+
+  mesh->computeTrackLengths( start_point, end_point, contribution );
+
+  FRENSIE_CHECK_EQUAL( contribution.size(), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the track length in a single element can be calculated
+FRENSIE_UNIT_TEST( StructuredSphericalMesh, computeTrackLengths_one_element )
+{
+  Utility::StructuredSphericalMesh::ElementHandleTrackLengthArray
+    contribution;
+
+  double start_point[3] = {0.2, 0.1, 0.2};
+  double end_point[3] = {0.4, 0.3, 0.6};
+
+  mesh->computeTrackLengths( start_point, end_point, contribution );
+
+  FRENSIE_REQUIRE_EQUAL( contribution.size(), 1 );
+  FRENSIE_CHECK_EQUAL( Utility::get<0>( contribution[0] ), 8 );
+  FRENSIE_CHECK_EQUAL( Utility::get<1>( contribution[0] ),
+                       (std::array<double,3>( {0.2, 0.1, 0.2} )) );
+  FRENSIE_CHECK_FLOATING_EQUALITY( Utility::get<2>( contribution[0] ),
+                                   0.4898979485566356,
+                                   1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the track lengths in multiple elements can be calculated
+FRENSIE_UNIT_TEST( StructuredSphericalMesh, computeTrackLengths_multiple_elements )
+{
+  Utility::StructuredSphericalMesh::ElementHandleTrackLengthArray
+    contribution;
+
+  // Cross the xy-plane polar angle cosine surface
+  double start_point[3] = {0.5, 0.5, 0.5};
+  double end_point[3] = {0.5, 0.5, -0.5};
+
+  mesh->computeTrackLengths( start_point, end_point, contribution );
+
+  FRENSIE_REQUIRE_EQUAL( contribution.size(), 2 );
+  FRENSIE_CHECK_EQUAL( Utility::get<0>( contribution[0] ), 8 );
+  FRENSIE_CHECK_EQUAL( Utility::get<1>( contribution[0] ),
+                       (std::array<double,3>( {0.5, 0.5, 0.5} )) );
+  FRENSIE_CHECK_FLOATING_EQUALITY( Utility::get<2>( contribution[0] ),
+                                   0.5,
+                                   1e-12 );
+  FRENSIE_CHECK_EQUAL( Utility::get<0>( contribution[1] ), 0 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( Utility::get<1>( contribution[1] )[0],
+                                   0.5,
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( Utility::get<1>( contribution[1] )[1],
+                                   0.5,
+                                   1e-12 );
+  FRENSIE_CHECK_SMALL( Utility::get<1>( contribution[1] )[2], 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( Utility::get<2>( contribution[1] ),
+                                   0.5,
+                                   1e-12 );
+
+  // Cross the radial and azimuthal surfaces (start and end outside of mesh)
+  start_point[0] = -3.0;
+  start_point[2] = 0.5;
+  end_point[0] = 3.0;
+  end_point[2] = 0.5;
+
+  mesh->computeTrackLengths( start_point, end_point, contribution );
+
+  FRENSIE_REQUIRE_EQUAL( contribution.size(), 4 );
+  FRENSIE_CHECK_EQUAL( Utility::get<0>( contribution[0] ), 11 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( Utility::get<1>( contribution[0] ),
+                                   (std::array<double,3>( {-1.8708286933869707, 0.5, 0.5} )),
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( Utility::get<2>( contribution[0] ),
+                                   1.1637219122004232,
+                                   1e-12 );
+  FRENSIE_CHECK_EQUAL( Utility::get<0>( contribution[1] ), 10 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( Utility::get<1>( contribution[1] ),
+                                   (std::array<double,3>( {-0.7071067811865476, 0.5, 0.5} )),
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( Utility::get<2>( contribution[1] ),
+                                   0.7071067811865476,
+                                   1e-12 );
+  FRENSIE_CHECK_EQUAL( Utility::get<0>( contribution[2] ), 8 );
+  FRENSIE_CHECK_SMALL( Utility::get<1>( contribution[2] )[0], 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( Utility::get<1>( contribution[2] )[1],
+                                   0.5,
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( Utility::get<1>( contribution[2] )[2],
+                                   0.5,
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( Utility::get<2>( contribution[2] ),
+                                   0.7071067811865476,
+                                   1e-12 );
+  FRENSIE_CHECK_EQUAL( Utility::get<0>( contribution[3] ), 9 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( Utility::get<1>( contribution[3] ),
+                                   (std::array<double,3>( {0.7071067811865476, 0.5, 0.5} )),
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( Utility::get<2>( contribution[3] ),
+                                   1.1637219122004232,
+                                   1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the track lengths across a cone surface can be calculated
+FRENSIE_UNIT_TEST( StructuredSphericalMesh, computeTrackLengths_cone )
+{
+  std::shared_ptr<const Utility::StructuredSphericalMesh> cone_mesh(
+                           new Utility::StructuredSphericalMesh(
+                                    {0.0, 2.0}, {0.0, 2*pi}, {-1.0, 0.5, 1.0} ) );
+
+  Utility::StructuredSphericalMesh::ElementHandleTrackLengthArray
+    contribution;
+
+  double start_point[3] = {0.5, 0.0, 1.5};
+  double end_point[3] = {0.5, 0.0, -1.5};
+
+  cone_mesh->computeTrackLengths( start_point, end_point, contribution );
+
+  FRENSIE_REQUIRE_EQUAL( contribution.size(), 2 );
+  FRENSIE_CHECK_EQUAL( Utility::get<0>( contribution[0] ), 1 );
+  FRENSIE_CHECK_EQUAL( Utility::get<1>( contribution[0] ),
+                       (std::array<double,3>( {0.5, 0.0, 1.5} )) );
+  FRENSIE_CHECK_FLOATING_EQUALITY( Utility::get<2>( contribution[0] ),
+                                   1.2113248654051871,
+                                   1e-12 );
+  FRENSIE_CHECK_EQUAL( Utility::get<0>( contribution[1] ), 0 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( Utility::get<1>( contribution[1] )[0],
+                                   0.5,
+                                   1e-12 );
+  FRENSIE_CHECK_SMALL( Utility::get<1>( contribution[1] )[1], 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( Utility::get<1>( contribution[1] )[2],
+                                   0.28867513459481287,
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( Utility::get<2>( contribution[1] ),
+                                   1.7886751345948129,
+                                   1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the mesh data can be exported
+FRENSIE_UNIT_TEST( StructuredSphericalMesh, exportData )
+{
+  // Export an empty mesh
+#ifdef HAVE_FRENSIE_MOAB
+  FRENSIE_CHECK_NO_THROW( mesh->exportData( "empty_test_spherical_mesh.vtk" ) );
+#else
+  FRENSIE_CHECK_THROW( mesh->exportData( "empty_test_spherical_mesh.vtk" ),
+                       std::logic_error );
+#endif
+
+  // Export the mesh with tag data
+  Utility::StructuredSphericalMesh::TagNameSet tag_name_set( {"mean", "rel_err"} );
+
+  Utility::StructuredSphericalMesh::MeshElementHandleDataMap element_data_map;
+
+  for( size_t i = 0; i < 16; ++i )
+  {
+    element_data_map[i]["mean"] = std::vector<std::pair<std::string,double> >( {std::make_pair("b0", 0.1*i), std::make_pair("b1", 0.2*i)} );
+    element_data_map[i]["rel_err"] = std::vector<std::pair<std::string,double> >( {std::make_pair("b0", 0.01), std::make_pair("b1", 0.001)} );
+  }
+
+#ifdef HAVE_FRENSIE_MOAB
+  FRENSIE_CHECK_NO_THROW( mesh->exportData( "test_spherical_mesh.vtk",
+                                            tag_name_set,
+                                            element_data_map ) );
+#else
+  FRENSIE_CHECK_THROW( mesh->exportData( "test_spherical_mesh.vtk",
+                                         tag_name_set,
+                                         element_data_map ),
+                       std::logic_error );
+#endif
+}
+
+//---------------------------------------------------------------------------//
+// Check that a structured spherical mesh can be archived
+FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( StructuredSphericalMesh, archive, TestArchives )
+{
+  FETCH_TEMPLATE_PARAM( 0, RawOArchive );
+  FETCH_TEMPLATE_PARAM( 1, RawIArchive );
+
+  typedef typename std::remove_pointer<RawOArchive>::type OArchive;
+  typedef typename std::remove_pointer<RawIArchive>::type IArchive;
+
+  std::string archive_base_name( "test_structured_spherical_mesh" );
+  std::ostringstream archive_ostream;
+
+  {
+    std::unique_ptr<OArchive> oarchive;
+
+    createOArchive( archive_base_name, archive_ostream, oarchive );
+
+    std::unique_ptr<Utility::StructuredSphericalMesh> concrete_mesh(
+                        new Utility::StructuredSphericalMesh(
+                                                      {1.0, 1.0, 1.0},
+                                                      r_surfaces,
+                                                      theta_surfaces,
+                                                      mu_surfaces ) );
+
+    std::shared_ptr<Utility::Mesh> base_mesh(
+                        new Utility::StructuredSphericalMesh(
+                                                      r_surfaces,
+                                                      theta_surfaces,
+                                                      mu_surfaces ) );
+
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( concrete_mesh ) );
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( base_mesh ) );
+  }
+
+  // Copy the archive ostream to an istream
+  std::istringstream archive_istream( archive_ostream.str() );
+
+  // Load the archived meshes
+  std::unique_ptr<IArchive> iarchive;
+
+  createIArchive( archive_istream, iarchive );
+
+  std::unique_ptr<Utility::StructuredSphericalMesh> concrete_mesh;
+  std::shared_ptr<Utility::Mesh> base_mesh;
+
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( concrete_mesh ) );
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( base_mesh ) );
+
+  iarchive.reset();
+
+  {
+    FRENSIE_CHECK_EQUAL( concrete_mesh->getNumberOfElements(), 16 );
+    FRENSIE_CHECK_EQUAL( concrete_mesh->getOrigin(),
+                         (std::array<double,3>( {1.0, 1.0, 1.0} )) );
+    FRENSIE_CHECK_EQUAL( concrete_mesh->getNumberOfRSurfaces(), 3 );
+    FRENSIE_CHECK_EQUAL( concrete_mesh->getNumberOfThetaSurfaces(), 5 );
+    FRENSIE_CHECK_EQUAL( concrete_mesh->getNumberOfMuSurfaces(), 3 );
+
+    double point[3] = {0.0, 1.5, 0.0};
+
+    FRENSIE_CHECK_EQUAL( concrete_mesh->whichElementIsPointIn( point ), 3 );
+  }
+
+  {
+    FRENSIE_CHECK_EQUAL( base_mesh->getNumberOfElements(), 16 );
+
+    double point[3] = {-1.0, 0.5, -1.0};
+
+    FRENSIE_CHECK_EQUAL( base_mesh->whichElementIsPointIn( point ), 3 );
+
+    Utility::Mesh::ElementHandleTrackLengthArray contribution;
+
+    double start_point[3] = {0.5, 0.5, 0.5};
+    double end_point[3] = {0.5, 0.5, -0.5};
+
+    base_mesh->computeTrackLengths( start_point, end_point, contribution );
+
+    FRENSIE_REQUIRE_EQUAL( contribution.size(), 2 );
+    FRENSIE_CHECK_EQUAL( Utility::get<0>( contribution[0] ), 8 );
+    FRENSIE_CHECK_EQUAL( Utility::get<0>( contribution[1] ), 0 );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  mesh.reset( new Utility::StructuredSphericalMesh( r_surfaces,
+                                                    theta_surfaces,
+                                                    mu_surfaces ) );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstStructuredSphericalMesh.cpp
+//---------------------------------------------------------------------------//
@@ -29,6 +29,24 @@ namespace Details{
 template<size_t N, typename T, typename Enabled = void>
 struct SampleMomentCollectionDataExtractor;
 
+//! The raw score powers class (raw_score^1,...,raw_score^M)
+template<typename T, size_t M>
+class SampleMomentRawScorePowers;
+
+//! The max moment order of a sample moment collection
+template<size_t N, size_t... Ns>
+struct SampleMomentCollectionMaxOrder
+{ static const size_t value = N; };
+
+//! The max moment order of a sample moment collection
+template<size_t N, size_t M, size_t... Ms>
+struct SampleMomentCollectionMaxOrder<N,M,Ms...>
+{
+  static const size_t value =
+    (N > SampleMomentCollectionMaxOrder<M,Ms...>::value ? N :
+     SampleMomentCollectionMaxOrder<M,Ms...>::value);
+};
+
 } // end Details namespace
 
 /*! The sample moment collection
@@ -107,6 +125,16 @@ public:
   //! Add a raw score to all moments in the collection
   void addRawScore( const T& raw_score );
 
+  //! Add raw scores (batched)
+  void addRawScores( const size_t* indices,
+                     const T* raw_scores,
+                     const size_t number_of_scores );
+
+  //! Add raw scores to a contiguous range of elements (batched)
+  void addRawScoresToRange( const size_t first_index,
+                            const T* raw_scores,
+                            const size_t number_of_scores );
+
 private:
 
   // Make the data extractor class a friend
@@ -120,6 +148,18 @@ private:
   // Make the boost::serialization::access class a friend
   friend class boost::serialization::access;
 
+  // The raw score powers type (each power is only computed once per score)
+  typedef Details::SampleMomentRawScorePowers<T,Details::SampleMomentCollectionMaxOrder<N,Ns...>::value> RawScorePowers;
+
+  // Add the raw score powers to an element
+  template<typename RawScorePowersType>
+  void addRawScorePowers( const size_t i,
+                          const RawScorePowersType& raw_score_powers );
+
+  // Add the raw score powers to all elements
+  template<typename RawScorePowersType>
+  void addRawScorePowersToAll( const RawScorePowersType& raw_score_powers );
+
   // Save the collection data to an archive
   template<typename Archive>
   void save( Archive& ar, const unsigned version ) const;
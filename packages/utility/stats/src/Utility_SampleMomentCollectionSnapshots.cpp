@@ -22,6 +22,9 @@ EXPLICIT_CLASS_SAVE_LOAD_INST( Utility::SampleMomentCollectionSnapshots<double,s
 EXPLICIT_TEMPLATE_CLASS_INST( Utility::SampleMomentCollectionSnapshots<double,std::list,4,3,2,1> );
 EXPLICIT_CLASS_SAVE_LOAD_INST( Utility::SampleMomentCollectionSnapshots<double,std::list,4,3,2,1> );
 
+EXPLICIT_TEMPLATE_CLASS_INST( Utility::SampleMomentCollectionSnapshots<double,std::vector,4,3,2,1> );
+EXPLICIT_CLASS_SAVE_LOAD_INST( Utility::SampleMomentCollectionSnapshots<double,std::vector,4,3,2,1> );
+
 //---------------------------------------------------------------------------//
 // end Utility_SampleMomentCollectionSnapshots.cpp
 //---------------------------------------------------------------------------//
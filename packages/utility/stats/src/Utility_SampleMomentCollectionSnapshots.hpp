@@ -19,6 +19,7 @@
 // FRENSIE Includes
 #include "Utility_SampleMomentCollection.hpp"
 #include "Utility_List.hpp"
+#include "Utility_Vector.hpp"
 #include "Utility_SerializationHelpers.hpp"
 
 namespace Utility{
@@ -35,7 +36,10 @@ struct SampleMomentCollectionSnapshotsDataExtractor;
  * \details This represents the empty collection. It cannot be instantiated
  * directly - only the non-empty collections can instantiate it. Note that
  * this class is a variadic template class and is designed in a very similar
- * way to the std::tuple class. 
+ * way to the std::tuple class. A contiguous snapshot container (e.g.
+ * std::vector) is recommended when there are many bins. The memory used by
+ * the snapshots can be bounded with the thinSnapshots or the
+ * discardOldestSnapshots methods.
  */
 template<typename T, template<typename,typename...> class SnapshotContainer, size_t... Ns>
 class SampleMomentCollectionSnapshots;
@@ -103,6 +107,12 @@ public:
   //! Merge the snapshots
   void mergeSnapshots( const SampleMomentCollectionSnapshots& collection );
 
+  //! Thin the snapshots until no more than the max number remain
+  void thinSnapshots( const size_t max_number_of_snapshots );
+
+  //! Discard the oldest snapshots until no more than the max number remain
+  void discardOldestSnapshots( const size_t max_number_of_snapshots );
+
   //! Get the snapshot indices (summation indices)
   const SummationIndexContainerType& getSnapshotIndices() const;
 
@@ -11,6 +11,7 @@
 
 // Std Lib Includes
 #include <iterator>
+#include <utility>
 
 // Boost Includes
 #include <boost/serialization/nvp.hpp>
@@ -135,6 +136,47 @@ struct SampleMomentCollectionSnapshotsDataExtractor<N,SampleMomentCollectionSnap
                                      const size_t snapshot_index )
   { return SampleMomentCollectionSnapshotsDataExtractor<N,BaseCollectionSnapshotsType>::getMomentSnapshot( collection, i, snapshot_index ); }
 };
+
+/*! Discard every other snapshot in a snapshot container
+ * \details The last (most recent) snapshot is always kept. Because the
+ * snapshots that are kept only depend on the container size, every container
+ * of a collection that has the same size will keep the same snapshots.
+ */
+template<typename Container>
+void thinSnapshotContainer( Container& snapshots )
+{
+  const size_t size = snapshots.size();
+
+  auto kept_snapshot_it = snapshots.begin();
+  auto snapshot_it = snapshots.begin();
+
+  for( size_t i = 0; i < size; ++i, ++snapshot_it )
+  {
+    if( (size - 1 - i) % 2 == 0 )
+    {
+      if( kept_snapshot_it != snapshot_it )
+        *kept_snapshot_it = std::move( *snapshot_it );
+
+      ++kept_snapshot_it;
+    }
+  }
+
+  snapshots.erase( kept_snapshot_it, snapshots.end() );
+}
+
+//! Discard the oldest snapshots in a snapshot container
+template<typename Container>
+void discardOldestSnapshotsInContainer( Container& snapshots,
+                                        const size_t max_number_of_snapshots )
+{
+  if( snapshots.size() > max_number_of_snapshots )
+  {
+    auto end_it = snapshots.begin();
+    std::advance( end_it, snapshots.size() - max_number_of_snapshots );
+
+    snapshots.erase( snapshots.begin(), end_it );
+  }
+}
   
 } // end Details namespace
 
@@ -231,19 +273,46 @@ public:
   //! Merge the snapshots
   void mergeSnapshots( const SampleMomentCollectionSnapshots& collection )
   {
-    const typename SummationIndexContainerType::value_type& max_summation_index =
-      d_snapshot_indices.back();
+    // Note: the last values must be copied - a reference to an element of a
+    // contiguous container will dangle once the container reallocates
+    const typename SummationIndexContainerType::value_type max_summation_index =
+      (d_snapshot_indices.empty() ? 0 : d_snapshot_indices.back());
     
     for( auto&& other_summation_index : collection.d_snapshot_indices )
       d_snapshot_indices.push_back( max_summation_index + other_summation_index );
 
-    const typename SamplingTimeContainerType::value_type& max_sampling_time =
-      d_snapshot_sampling_times.back();
+    const typename SamplingTimeContainerType::value_type max_sampling_time =
+      (d_snapshot_sampling_times.empty() ? 0.0 : d_snapshot_sampling_times.back());
 
     for( auto&& other_sampling_times : collection.d_snapshot_sampling_times )
       d_snapshot_sampling_times.push_back( max_sampling_time + other_sampling_times );
   }
 
+  //! Thin the snapshots until no more than the max number remain
+  void thinSnapshots( const size_t max_number_of_snapshots )
+  {
+    // Make sure that the max number of snapshots is valid
+    testPrecondition( max_number_of_snapshots > 0 );
+    
+    while( d_snapshot_indices.size() > max_number_of_snapshots )
+    {
+      Details::thinSnapshotContainer( d_snapshot_indices );
+      Details::thinSnapshotContainer( d_snapshot_sampling_times );
+    }
+  }
+
+  //! Discard the oldest snapshots until no more than the max number remain
+  void discardOldestSnapshots( const size_t max_number_of_snapshots )
+  {
+    // Make sure that the max number of snapshots is valid
+    testPrecondition( max_number_of_snapshots > 0 );
+
+    Details::discardOldestSnapshotsInContainer( d_snapshot_indices,
+                                                max_number_of_snapshots );
+    Details::discardOldestSnapshotsInContainer( d_snapshot_sampling_times,
+                                                max_number_of_snapshots );
+  }
+
   //! Get the snapshot indices (summation indices)
   const SummationIndexContainerType& getSnapshotIndices() const
   { return d_snapshot_indices; }
@@ -392,13 +461,64 @@ void SampleMomentCollectionSnapshots<T,SnapshotContainer,N,Ns...>::mergeSnapshot
 
   for( size_t i = 0; i < d_score_snapshots.size(); ++i )
   {
-    const MomentValueType& last_score = d_score_snapshots[i].back();
+    if( d_score_snapshots[i].empty() )
+    {
+      d_score_snapshots[i] = collection.d_score_snapshots[i];
+      
+      continue;
+    }
+    
+    // Note: the last score must be copied (see the base class)
+    const MomentValueType last_score = d_score_snapshots[i].back();
 
     for( auto&& other_score : collection.d_score_snapshots[i] )
       d_score_snapshots[i].push_back( last_score + other_score );
   }
 }
 
+// Thin the snapshots until no more than the max number remain
+/*! \details Every other snapshot will be discarded (the most recent snapshot
+ * is always kept) until no more than the max number of snapshots remain.
+ * Because the snapshot data is cumulative, the snapshots that remain are
+ * still valid - they are simply spaced further apart. Repeatedly thinning the
+ * snapshots as new snapshots are taken will keep the memory used by the
+ * snapshots bounded while still covering the entire history of the
+ * simulation (with the densest coverage near the most recent snapshot).
+ */
+template<typename T, template<typename,typename...> class SnapshotContainer, size_t N, size_t... Ns>
+void SampleMomentCollectionSnapshots<T,SnapshotContainer,N,Ns...>::thinSnapshots( const size_t max_number_of_snapshots )
+{
+  // Make sure that the max number of snapshots is valid
+  testPrecondition( max_number_of_snapshots > 0 );
+  
+  BaseType::thinSnapshots( max_number_of_snapshots );
+
+  for( auto&& snapshot_container : d_score_snapshots )
+  {
+    while( snapshot_container.size() > max_number_of_snapshots )
+      Details::thinSnapshotContainer( snapshot_container );
+  }
+}
+
+// Discard the oldest snapshots until no more than the max number remain
+/*! \details Only the most recent snapshots will be kept (i.e. the snapshots
+ * will act like a ring buffer).
+ */
+template<typename T, template<typename,typename...> class SnapshotContainer, size_t N, size_t... Ns>
+void SampleMomentCollectionSnapshots<T,SnapshotContainer,N,Ns...>::discardOldestSnapshots( const size_t max_number_of_snapshots )
+{
+  // Make sure that the max number of snapshots is valid
+  testPrecondition( max_number_of_snapshots > 0 );
+  
+  BaseType::discardOldestSnapshots( max_number_of_snapshots );
+
+  for( auto&& snapshot_container : d_score_snapshots )
+  {
+    Details::discardOldestSnapshotsInContainer( snapshot_container,
+                                                max_number_of_snapshots );
+  }
+}
+
 // Get the snapshot indices (summation indices)
 template<typename T, template<typename,typename...> class SnapshotContainer, size_t N, size_t... Ns>
 auto SampleMomentCollectionSnapshots<T,SnapshotContainer,N,Ns...>::getSnapshotIndices() const -> const SummationIndexContainerType&
@@ -491,6 +611,9 @@ EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( Utility, SampleMomentCollectionSnapshots<d
 EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( Utility::SampleMomentCollectionSnapshots<double,std::list,4,3,2,1> );
 EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( Utility, SampleMomentCollectionSnapshots<double,std::list,4,3,2,1> );
 
+EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( Utility::SampleMomentCollectionSnapshots<double,std::vector,4,3,2,1> );
+EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( Utility, SampleMomentCollectionSnapshots<double,std::vector,4,3,2,1> );
+
 #endif // end UTILITY_SAMPLE_MOMENT_COLLECTION_SNAPSHOTS_DEF_HPP
 
 //---------------------------------------------------------------------------//
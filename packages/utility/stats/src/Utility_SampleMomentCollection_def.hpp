@@ -127,6 +127,42 @@ struct SampleMomentCollectionDataExtractor<N,SampleMomentCollection<T,M,Ms...>,t
   { return SampleMomentCollectionDataExtractor<N,BaseCollectionType>::getMoment( collection, i ); }
 };
 
+/*! The raw score powers class
+ * \details The powers of a raw score (raw_score^1,...,raw_score^M) are
+ * computed once (with M-1 multiplications) so that the moments of a
+ * collection do not each compute their power of the raw score from scratch.
+ */
+template<typename T, size_t M>
+class SampleMomentRawScorePowers
+{
+  // The raw type
+  typedef typename QuantityTraits<T>::RawType RawType;
+
+public:
+
+  //! Constructor
+  inline SampleMomentRawScorePowers( const T& raw_score )
+  {
+    d_powers[0] = QuantityTraits<T>::getRawQuantity( raw_score );
+
+    // raw_score^(k+1) = raw_score^a*raw_score^(k+1-a) with a = (k+1)/2
+    for( size_t k = 1; k < M; ++k )
+      d_powers[k] = d_powers[(k+1)/2-1]*d_powers[k-(k+1)/2];
+  }
+
+  //! Return raw_score^N
+  template<size_t N>
+  inline typename SampleMoment<N,T>::ValueType get() const
+  {
+    return QuantityTraits<typename SampleMoment<N,T>::ValueType>::initializeQuantity( d_powers[N-1] );
+  }
+
+private:
+
+  // The raw score powers
+  RawType d_powers[M];
+};
+
 } // end Details namespace
 
 //! The default sample moment collection
@@ -187,6 +223,18 @@ protected:
   void addRawScore( const T& raw_score )
   { /* ... */ }
 
+  //! Add raw scores (batched)
+  void addRawScores( const size_t* indices,
+                     const T* raw_scores,
+                     const size_t number_of_scores )
+  { /* ... */ }
+
+  //! Add raw scores to a contiguous range of elements (batched)
+  void addRawScoresToRange( const size_t first_index,
+                            const T* raw_scores,
+                            const size_t number_of_scores )
+  { /* ... */ }
+
 private:
 
   // Make all moment collections friend
@@ -196,6 +244,17 @@ private:
   // Make the boost::serialization::access class a friend
   friend class boost::serialization::access;
 
+  // Add the raw score powers to an element
+  template<typename RawScorePowersType>
+  void addRawScorePowers( const size_t i,
+                          const RawScorePowersType& raw_score_powers )
+  { /* ... */ }
+
+  // Add the raw score powers to all elements
+  template<typename RawScorePowersType>
+  void addRawScorePowersToAll( const RawScorePowersType& raw_score_powers )
+  { /* ... */ }
+
   // Save the collection data to an archive
   template<typename Archive>
   void save( Archive& ar, const unsigned version ) const
@@ -310,20 +369,97 @@ void SampleMomentCollection<T,N,Ns...>::addRawScore( const size_t i,
 {
   // Make sure the the index is valid
   testPrecondition( i < this->size() );
+  // Make sure the raw score is valid
+  testPrecondition( !QuantityTraits<T>::isnaninf( raw_score ) );
 
-  SampleMomentCollection<T,Ns...>::addRawScore( i, raw_score );
-
-  d_current_scores[i] += SampleMoment<N,T>::processRawScore( raw_score );
+  this->addRawScorePowers( i, RawScorePowers( raw_score ) );
 }
 
 // Add a raw score to all moments in the collection
 template<typename T, size_t N, size_t... Ns>
 void SampleMomentCollection<T,N,Ns...>::addRawScore( const T& raw_score )
 {
-  SampleMomentCollection<T,Ns...>::addRawScore( raw_score );
-  
-  ValueType processed_score = SampleMoment<N,T>::processRawScore( raw_score );
-  
+  // Make sure the raw score is valid
+  testPrecondition( !QuantityTraits<T>::isnaninf( raw_score ) );
+
+  this->addRawScorePowersToAll( RawScorePowers( raw_score ) );
+}
+
+// Add raw scores (batched)
+/*! \details The powers of each raw score are only computed once for all of
+ * the moments in the collection. The scores of a given element are
+ * accumulated in the order that they appear, which means that the results
+ * will be identical to adding each raw score individually with the
+ * addRawScore method. An index may appear more than once.
+ */
+template<typename T, size_t N, size_t... Ns>
+void SampleMomentCollection<T,N,Ns...>::addRawScores(
+                                              const size_t* indices,
+                                              const T* raw_scores,
+                                              const size_t number_of_scores )
+{
+  for( size_t j = 0; j < number_of_scores; ++j )
+  {
+    // Make sure the the index is valid
+    testPrecondition( indices[j] < this->size() );
+    // Make sure the raw score is valid
+    testPrecondition( !QuantityTraits<T>::isnaninf( raw_scores[j] ) );
+
+    this->addRawScorePowers( indices[j], RawScorePowers( raw_scores[j] ) );
+  }
+}
+
+// Add raw scores to a contiguous range of elements (batched)
+/*! \details The raw score at position j will be added to element
+ * first_index+j. Because the elements are contiguous and each one is only
+ * updated once, the updates are vectorized. The results will be identical
+ * to adding each raw score individually with the addRawScore method.
+ */
+template<typename T, size_t N, size_t... Ns>
+void SampleMomentCollection<T,N,Ns...>::addRawScoresToRange(
+                                              const size_t first_index,
+                                              const T* raw_scores,
+                                              const size_t number_of_scores )
+{
+  // Make sure the the range is valid
+  testPrecondition( first_index + number_of_scores <= this->size() );
+
+  // Make sure the raw scores are valid (this can't be done in the vectorized
+  // loop)
+  for( size_t j = 0; j < number_of_scores; ++j )
+  {
+    testPrecondition( !QuantityTraits<T>::isnaninf( raw_scores[j] ) );
+  }
+
+  #pragma omp simd
+  for( size_t j = 0; j < number_of_scores; ++j )
+  {
+    this->addRawScorePowers( first_index+j, RawScorePowers( raw_scores[j] ) );
+  }
+}
+
+// Add the raw score powers to an element
+template<typename T, size_t N, size_t... Ns>
+template<typename RawScorePowersType>
+inline void SampleMomentCollection<T,N,Ns...>::addRawScorePowers(
+                                   const size_t i,
+                                   const RawScorePowersType& raw_score_powers )
+{
+  SampleMomentCollection<T,Ns...>::addRawScorePowers( i, raw_score_powers );
+
+  d_current_scores[i] += raw_score_powers.template get<N>();
+}
+
+// Add the raw score powers to all elements
+template<typename T, size_t N, size_t... Ns>
+template<typename RawScorePowersType>
+inline void SampleMomentCollection<T,N,Ns...>::addRawScorePowersToAll(
+                                   const RawScorePowersType& raw_score_powers )
+{
+  SampleMomentCollection<T,Ns...>::addRawScorePowersToAll( raw_score_powers );
+
+  const ValueType processed_score = raw_score_powers.template get<N>();
+
   for( size_t i = 0; i < d_current_scores.size(); ++i )
     d_current_scores[i] += processed_score;
 }
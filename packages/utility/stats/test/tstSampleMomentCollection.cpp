@@ -8,6 +8,7 @@
 
 // Std Lib Includes
 #include <sstream>
+#include <vector>
 
 // Boost Includes
 #include <boost/units/quantity.hpp>
@@ -585,6 +586,95 @@ FRENSIE_UNIT_TEST_TEMPLATE( SampleMomentCollection, addRawScore, TestingTypes )
                        Utility::QuantityTraits<ValueType4>::one()*10000. );
 }
 
+//---------------------------------------------------------------------------//
+// Check that batched raw scores can be added
+FRENSIE_UNIT_TEST_TEMPLATE( SampleMomentCollection, addRawScores, TestingTypes )
+{
+  FETCH_TEMPLATE_PARAM( 0, T );
+  
+  Utility::SampleMomentCollection<T,1,2,3,4> moment_collection( 4 );
+  Utility::SampleMomentCollection<T,1,2,3,4> expected_moment_collection( 4 );
+
+  // Repeated indices are allowed
+  std::vector<size_t> indices( {2, 0, 3, 0, 2} );
+  std::vector<T> raw_scores( {Utility::QuantityTraits<T>::one()*0.1,
+                              Utility::QuantityTraits<T>::one()*1.7,
+                              Utility::QuantityTraits<T>::one()*3.3,
+                              Utility::QuantityTraits<T>::one()*0.7,
+                              Utility::QuantityTraits<T>::one()*2.9} );
+
+  moment_collection.addRawScores( indices.data(),
+                                  raw_scores.data(),
+                                  indices.size() );
+
+  for( size_t j = 0; j < indices.size(); ++j )
+    expected_moment_collection.addRawScore( indices[j], raw_scores[j] );
+
+  // The batched results must be identical to the scalar results
+  for( size_t i = 0; i < 4; ++i )
+  {
+    FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<1>( moment_collection, i ),
+                         Utility::getCurrentScore<1>( expected_moment_collection, i ) );
+    FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<2>( moment_collection, i ),
+                         Utility::getCurrentScore<2>( expected_moment_collection, i ) );
+    FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<3>( moment_collection, i ),
+                         Utility::getCurrentScore<3>( expected_moment_collection, i ) );
+    FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<4>( moment_collection, i ),
+                         Utility::getCurrentScore<4>( expected_moment_collection, i ) );
+  }
+
+  typedef typename Utility::SampleMoment<1,T>::ValueType ValueType1;
+
+  FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<1>( moment_collection, 1 ),
+                       Utility::QuantityTraits<ValueType1>::zero() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that batched raw scores can be added to a range of elements
+FRENSIE_UNIT_TEST_TEMPLATE( SampleMomentCollection, addRawScoresToRange, TestingTypes )
+{
+  FETCH_TEMPLATE_PARAM( 0, T );
+  
+  Utility::SampleMomentCollection<T,4,3,2,1> moment_collection( 20 );
+  Utility::SampleMomentCollection<T,4,3,2,1> expected_moment_collection( 20 );
+
+  std::vector<T> raw_scores( 17 );
+
+  for( size_t j = 0; j < raw_scores.size(); ++j )
+    raw_scores[j] = Utility::QuantityTraits<T>::one()*(0.3*j + 1.0/(j+1));
+
+  // Add the scores twice so that previous scores are accumulated
+  for( size_t k = 0; k < 2; ++k )
+  {
+    moment_collection.addRawScoresToRange( 2,
+                                           raw_scores.data(),
+                                           raw_scores.size() );
+
+    for( size_t j = 0; j < raw_scores.size(); ++j )
+      expected_moment_collection.addRawScore( j+2, raw_scores[j] );
+  }
+
+  // The batched results must be identical to the scalar results
+  for( size_t i = 0; i < 20; ++i )
+  {
+    FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<1>( moment_collection, i ),
+                         Utility::getCurrentScore<1>( expected_moment_collection, i ) );
+    FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<2>( moment_collection, i ),
+                         Utility::getCurrentScore<2>( expected_moment_collection, i ) );
+    FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<3>( moment_collection, i ),
+                         Utility::getCurrentScore<3>( expected_moment_collection, i ) );
+    FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<4>( moment_collection, i ),
+                         Utility::getCurrentScore<4>( expected_moment_collection, i ) );
+  }
+
+  typedef typename Utility::SampleMoment<4,T>::ValueType ValueType4;
+
+  FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<4>( moment_collection, 0 ),
+                       Utility::QuantityTraits<ValueType4>::zero() );
+  FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<4>( moment_collection, 19 ),
+                       Utility::QuantityTraits<ValueType4>::zero() );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the current score can be returned using the standalone helper
 // function
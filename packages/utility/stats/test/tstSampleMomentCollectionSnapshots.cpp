@@ -8,6 +8,8 @@
 
 // Std Lib Includes
 #include <sstream>
+#include <vector>
+#include <list>
 
 // Boost Includes
 #include <boost/units/quantity.hpp>
@@ -281,6 +283,166 @@ FRENSIE_UNIT_TEST_TEMPLATE( SampleMomentCollectionSnapshots, mergeSnapshots, Tes
   FRENSIE_CHECK_EQUAL( moment_snapshot_collection_b.getNumberOfSnapshots(), 2 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that two collection snapshots stored in contiguous containers can be
+// merged (the containers will reallocate during the merge)
+FRENSIE_UNIT_TEST_TEMPLATE( SampleMomentCollectionSnapshots, mergeSnapshots_vector, TestingTypes )
+{
+  FETCH_TEMPLATE_PARAM( 0, T );
+  typedef typename Utility::SampleMomentCollectionSnapshots<T,std::vector,1,2>::MomentValueType MomentValueType1;
+  typedef typename Utility::SampleMomentCollectionSnapshots<T,std::vector,2>::MomentValueType MomentValueType2;
+
+  Utility::SampleMomentCollectionSnapshots<T,std::vector,1,2> moment_snapshot_collection_a( 2 );
+  Utility::SampleMomentCollectionSnapshots<T,std::vector,1,2> moment_snapshot_collection_b( 2 );
+
+  Utility::SampleMomentCollection<T,1,2> moment_collection_a( 2 );
+  Utility::SampleMomentCollection<T,1,2> moment_collection_b( 2 );
+
+  moment_collection_a.addRawScore( Utility::QuantityTraits<T>::one()*10. );
+  moment_collection_b.addRawScore( Utility::QuantityTraits<T>::one()*5. );
+
+  moment_snapshot_collection_a.takeSnapshot( 1, 1.0, moment_collection_a );
+  moment_snapshot_collection_b.takeSnapshot( 1, 1.0, moment_collection_b );
+
+  moment_collection_b.addRawScore( Utility::QuantityTraits<T>::one()*3. );
+  moment_collection_b.addRawScore( Utility::QuantityTraits<T>::one()*7. );
+
+  moment_snapshot_collection_b.takeSnapshot( 2, 2.0, moment_collection_b );
+
+  FRENSIE_CHECK_EQUAL( moment_snapshot_collection_a.getNumberOfSnapshots(), 1 );
+  FRENSIE_CHECK_EQUAL( moment_snapshot_collection_b.getNumberOfSnapshots(), 2 );
+
+  moment_snapshot_collection_a.mergeSnapshots( moment_snapshot_collection_b );
+
+  FRENSIE_CHECK_EQUAL( moment_snapshot_collection_a.getNumberOfSnapshots(), 3 );
+  FRENSIE_CHECK_EQUAL( moment_snapshot_collection_a.getSnapshotIndices(),
+                       std::vector<uint64_t>({1, 2, 4}) );
+  FRENSIE_CHECK_EQUAL( moment_snapshot_collection_a.getSnapshotSamplingTimes(),
+                       std::vector<double>({1.0, 2.0, 4.0}) );
+
+  for( size_t i = 0; i < 2; ++i )
+  {
+    FRENSIE_CHECK_EQUAL( Utility::getScoreSnapshot<2>( moment_snapshot_collection_a, i, 0 ),
+                         Utility::QuantityTraits<MomentValueType2>::one()*100. );
+    FRENSIE_CHECK_EQUAL( Utility::getScoreSnapshot<2>( moment_snapshot_collection_a, i, 1 ),
+                         Utility::QuantityTraits<MomentValueType2>::one()*125. );
+    FRENSIE_CHECK_EQUAL( Utility::getScoreSnapshot<2>( moment_snapshot_collection_a, i, 2 ),
+                         Utility::QuantityTraits<MomentValueType2>::one()*183. );
+
+    FRENSIE_CHECK_EQUAL( Utility::getMomentSnapshot<1>( moment_snapshot_collection_a, i, 0 ).getCurrentScore(),
+                         Utility::QuantityTraits<MomentValueType1>::one()*10. );
+    FRENSIE_CHECK_EQUAL( Utility::getMomentSnapshot<1>( moment_snapshot_collection_a, i, 1 ).getCurrentScore(),
+                         Utility::QuantityTraits<MomentValueType1>::one()*15. );
+    FRENSIE_CHECK_EQUAL( Utility::getMomentSnapshot<1>( moment_snapshot_collection_a, i, 2 ).getCurrentScore(),
+                         Utility::QuantityTraits<MomentValueType1>::one()*25. );
+  }
+
+  // Merging into a collection without snapshots copies the snapshots
+  Utility::SampleMomentCollectionSnapshots<T,std::vector,1,2> moment_snapshot_collection_c( 2 );
+
+  moment_snapshot_collection_c.mergeSnapshots( moment_snapshot_collection_b );
+
+  FRENSIE_CHECK_EQUAL( moment_snapshot_collection_c.getSnapshotIndices(),
+                       std::vector<uint64_t>({1, 3}) );
+  FRENSIE_CHECK_EQUAL( moment_snapshot_collection_c.getSnapshotSamplingTimes(),
+                       std::vector<double>({1.0, 3.0}) );
+  FRENSIE_CHECK_EQUAL( Utility::getScoreSnapshot<2>( moment_snapshot_collection_c, 0, 1 ),
+                       Utility::QuantityTraits<MomentValueType2>::one()*83. );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the snapshots can be thinned
+FRENSIE_UNIT_TEST_TEMPLATE( SampleMomentCollectionSnapshots, thinSnapshots, TestingTypes )
+{
+  FETCH_TEMPLATE_PARAM( 0, T );
+  typedef typename Utility::SampleMomentCollectionSnapshots<T,std::vector,1,2>::MomentSnapshotContainerType MomentSnapshotContainerType1;
+  typedef typename Utility::SampleMomentCollectionSnapshots<T,std::vector,2>::MomentSnapshotContainerType MomentSnapshotContainerType2;
+  typedef typename Utility::SampleMomentCollectionSnapshots<T,std::vector,1,2>::MomentValueType MomentValueType1;
+  typedef typename Utility::SampleMomentCollectionSnapshots<T,std::vector,2>::MomentValueType MomentValueType2;
+
+  Utility::SampleMomentCollectionSnapshots<T,std::vector,1,2> moment_snapshot_collection( 2 );
+
+  Utility::SampleMomentCollection<T,1,2> moment_collection( 2 );
+
+  for( size_t i = 0; i < 5; ++i )
+  {
+    moment_collection.addRawScore( Utility::QuantityTraits<T>::one() );
+    moment_snapshot_collection.takeSnapshot( 1, 1.0, moment_collection );
+  }
+
+  // The snapshots will not be thinned if there are fewer than the max
+  moment_snapshot_collection.thinSnapshots( 5 );
+
+  FRENSIE_CHECK_EQUAL( moment_snapshot_collection.getNumberOfSnapshots(), 5 );
+
+  moment_snapshot_collection.thinSnapshots( 3 );
+
+  FRENSIE_CHECK_EQUAL( moment_snapshot_collection.getNumberOfSnapshots(), 3 );
+  FRENSIE_CHECK_EQUAL( moment_snapshot_collection.getSnapshotIndices(),
+                       std::vector<uint64_t>({1, 3, 5}) );
+  FRENSIE_CHECK_EQUAL( moment_snapshot_collection.getSnapshotSamplingTimes(),
+                       std::vector<double>({1.0, 3.0, 5.0}) );
+  FRENSIE_CHECK_EQUAL( Utility::getScoreSnapshots<1>(moment_snapshot_collection, 0),
+                       MomentSnapshotContainerType1({Utility::QuantityTraits<MomentValueType1>::one()*1.,
+                                                     Utility::QuantityTraits<MomentValueType1>::one()*3.,
+                                                     Utility::QuantityTraits<MomentValueType1>::one()*5.}) );
+  FRENSIE_CHECK_EQUAL( Utility::getScoreSnapshots<2>(moment_snapshot_collection, 1),
+                       MomentSnapshotContainerType2({Utility::QuantityTraits<MomentValueType2>::one()*1.,
+                                                     Utility::QuantityTraits<MomentValueType2>::one()*3.,
+                                                     Utility::QuantityTraits<MomentValueType2>::one()*5.}) );
+
+  // The most recent snapshot is always kept
+  moment_collection.addRawScore( Utility::QuantityTraits<T>::one() );
+  moment_snapshot_collection.takeSnapshot( 1, 1.0, moment_collection );
+  moment_snapshot_collection.thinSnapshots( 3 );
+
+  FRENSIE_CHECK_EQUAL( moment_snapshot_collection.getNumberOfSnapshots(), 2 );
+  FRENSIE_CHECK_EQUAL( moment_snapshot_collection.getSnapshotIndices(),
+                       std::vector<uint64_t>({3, 6}) );
+  FRENSIE_CHECK_EQUAL( Utility::getScoreSnapshots<1>(moment_snapshot_collection, 1),
+                       MomentSnapshotContainerType1({Utility::QuantityTraits<MomentValueType1>::one()*3.,
+                                                     Utility::QuantityTraits<MomentValueType1>::one()*6.}) );
+
+  moment_snapshot_collection.thinSnapshots( 1 );
+
+  FRENSIE_CHECK_EQUAL( moment_snapshot_collection.getNumberOfSnapshots(), 1 );
+  FRENSIE_CHECK_EQUAL( moment_snapshot_collection.getSnapshotIndices().back(), 6 );
+  FRENSIE_CHECK_EQUAL( moment_snapshot_collection.getSnapshotSamplingTimes().back(), 6.0 );
+  FRENSIE_CHECK_EQUAL( Utility::getScoreSnapshot<2>(moment_snapshot_collection, 0, 0),
+                       Utility::QuantityTraits<MomentValueType2>::one()*6. );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the oldest snapshots can be discarded
+FRENSIE_UNIT_TEST_TEMPLATE( SampleMomentCollectionSnapshots, discardOldestSnapshots, TestingTypes )
+{
+  FETCH_TEMPLATE_PARAM( 0, T );
+  typedef typename Utility::SampleMomentCollectionSnapshots<T,std::list,1,2>::MomentSnapshotContainerType MomentSnapshotContainerType1;
+  typedef typename Utility::SampleMomentCollectionSnapshots<T,std::list,1,2>::MomentValueType MomentValueType1;
+
+  Utility::SampleMomentCollectionSnapshots<T,std::list,1,2> moment_snapshot_collection( 2 );
+
+  Utility::SampleMomentCollection<T,1,2> moment_collection( 2 );
+
+  for( size_t i = 0; i < 5; ++i )
+  {
+    moment_collection.addRawScore( Utility::QuantityTraits<T>::one() );
+    moment_snapshot_collection.takeSnapshot( 1, 1.0, moment_collection );
+  }
+
+  moment_snapshot_collection.discardOldestSnapshots( 2 );
+
+  FRENSIE_CHECK_EQUAL( moment_snapshot_collection.getNumberOfSnapshots(), 2 );
+  FRENSIE_CHECK_EQUAL( moment_snapshot_collection.getSnapshotIndices(),
+                       std::list<uint64_t>({4, 5}) );
+  FRENSIE_CHECK_EQUAL( moment_snapshot_collection.getSnapshotSamplingTimes(),
+                       std::list<double>({4.0, 5.0}) );
+  FRENSIE_CHECK_EQUAL( Utility::getScoreSnapshots<1>(moment_snapshot_collection, 0),
+                       MomentSnapshotContainerType1({Utility::QuantityTraits<MomentValueType1>::one()*4.,
+                                                     Utility::QuantityTraits<MomentValueType1>::one()*5.}) );
+  FRENSIE_CHECK_EQUAL( (Utility::getScoreSnapshots<2>(moment_snapshot_collection, 1)).size(), 2 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that a moment collection can be archived
 FRENSIE_UNIT_TEST_TEMPLATE( SampleMomentCollectionSnapshots, archive, TestingTypes )
@@ -0,0 +1,495 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   cadis_timer.cpp
+//! \author Alex Robinson
+//! \brief  Main function for comparing the figure of merit of a deep
+//!         penetration photon flux tally with an analogue source and with a
+//!         CADIS biased source and weight windows
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <memory>
+#include <cmath>
+#include <cstdlib>
+
+// Boost Includes
+#include <boost/filesystem.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleSimulationManagerFactory.hpp"
+#include "MonteCarlo_StandardParticleSource.hpp"
+#include "MonteCarlo_StandardParticleSourceComponent.hpp"
+#include "MonteCarlo_StandardAdjointParticleSourceComponent.hpp"
+#include "MonteCarlo_StandardParticleDistribution.hpp"
+#include "MonteCarlo_IndependentPhaseSpaceDimensionDistribution.hpp"
+#include "MonteCarlo_MeshTrackLengthFluxEstimator.hpp"
+#include "MonteCarlo_CADISGenerator.hpp"
+#include "Data_ScatteringCenterPropertiesDatabase.hpp"
+#include "Geometry_InfiniteMediumModel.hpp"
+#include "Utility_StructuredHexMesh.hpp"
+#include "Utility_UniformDistribution.hpp"
+#include "Utility_OpenMPProperties.hpp"
+
+using boost::units::cgs::cubic_centimeter;
+
+// Create the filled infinite medium model
+std::shared_ptr<const MonteCarlo::FilledGeometryModel> createModel(
+        const boost::filesystem::path& database_path,
+        const unsigned zaid,
+        const double atom_density,
+        const std::shared_ptr<const MonteCarlo::SimulationProperties>&
+        properties,
+        std::shared_ptr<const Geometry::Model>& unfilled_model )
+{
+  const Data::ScatteringCenterPropertiesDatabase database( database_path );
+
+  const Data::AtomProperties& atom_properties =
+    database.getAtomProperties( zaid );
+
+  std::shared_ptr<MonteCarlo::ScatteringCenterDefinitionDatabase>
+    scattering_center_definition_database(
+                          new MonteCarlo::ScatteringCenterDefinitionDatabase );
+
+  MonteCarlo::ScatteringCenterDefinition& definition =
+    scattering_center_definition_database->createDefinition( "atom", zaid );
+
+  if( properties->getParticleMode() == MonteCarlo::ADJOINT_PHOTON_MODE )
+  {
+    definition.setAdjointPhotoatomicDataProperties(
+      atom_properties.getSharedAdjointPhotoatomicDataProperties(
+                Data::AdjointPhotoatomicDataProperties::Native_EPR_FILE, 0 ) );
+  }
+  else
+  {
+    definition.setPhotoatomicDataProperties(
+          atom_properties.getSharedPhotoatomicDataProperties(
+                       Data::PhotoatomicDataProperties::Native_EPR_FILE, 0 ) );
+  }
+
+  std::shared_ptr<MonteCarlo::MaterialDefinitionDatabase>
+    material_definition_database( new MonteCarlo::MaterialDefinitionDatabase );
+
+  material_definition_database->addDefinition( "atom", 1, {"atom"}, {1.0} );
+
+  unfilled_model.reset( new Geometry::InfiniteMediumModel(
+                                          1, 1, atom_density/cubic_centimeter ) );
+
+  return std::shared_ptr<const MonteCarlo::FilledGeometryModel>(
+                        new MonteCarlo::FilledGeometryModel(
+                                         database_path,
+                                         scattering_center_definition_database,
+                                         material_definition_database,
+                                         properties,
+                                         unfilled_model,
+                                         false ) );
+}
+
+// Create a particle distribution that is uniform in a box and energy range
+std::shared_ptr<MonteCarlo::StandardParticleDistribution>
+createUniformDistribution( const std::string& name,
+                           const double lower_bounds[3],
+                           const double upper_bounds[3],
+                           const double min_energy,
+                           const double max_energy )
+{
+  std::shared_ptr<MonteCarlo::StandardParticleDistribution>
+    distribution( new MonteCarlo::StandardParticleDistribution( name ) );
+
+  std::shared_ptr<MonteCarlo::PhaseSpaceDimensionDistribution>
+    dimension_distribution( new MonteCarlo::IndependentPhaseSpaceDimensionDistribution<MonteCarlo::PRIMARY_SPATIAL_DIMENSION>(
+                     std::shared_ptr<const Utility::UnivariateDistribution>(
+                          new Utility::UniformDistribution( lower_bounds[0],
+                                                            upper_bounds[0],
+                                                            1.0 ) ) ) );
+
+  distribution->setDimensionDistribution( dimension_distribution );
+
+  dimension_distribution.reset( new MonteCarlo::IndependentPhaseSpaceDimensionDistribution<MonteCarlo::SECONDARY_SPATIAL_DIMENSION>(
+                     std::shared_ptr<const Utility::UnivariateDistribution>(
+                          new Utility::UniformDistribution( lower_bounds[1],
+                                                            upper_bounds[1],
+                                                            1.0 ) ) ) );
+
+  distribution->setDimensionDistribution( dimension_distribution );
+
+  dimension_distribution.reset( new MonteCarlo::IndependentPhaseSpaceDimensionDistribution<MonteCarlo::TERTIARY_SPATIAL_DIMENSION>(
+                     std::shared_ptr<const Utility::UnivariateDistribution>(
+                          new Utility::UniformDistribution( lower_bounds[2],
+                                                            upper_bounds[2],
+                                                            1.0 ) ) ) );
+
+  distribution->setDimensionDistribution( dimension_distribution );
+
+  dimension_distribution.reset( new MonteCarlo::IndependentPhaseSpaceDimensionDistribution<MonteCarlo::ENERGY_DIMENSION>(
+                     std::shared_ptr<const Utility::UnivariateDistribution>(
+                          new Utility::UniformDistribution( min_energy,
+                                                            max_energy,
+                                                            1.0 ) ) ) );
+
+  distribution->setDimensionDistribution( dimension_distribution );
+
+  distribution->constructDimensionDistributionDependencyTree();
+
+  return distribution;
+}
+
+// Time a simulation with a mesh flux estimator
+/*! \details The population controller is only used if it is not null.
+ */
+double timeSimulation(
+    const std::shared_ptr<const MonteCarlo::FilledGeometryModel>& model,
+    const std::shared_ptr<MonteCarlo::ParticleSourceComponent>&
+    source_component,
+    const std::shared_ptr<const MonteCarlo::SimulationProperties>& properties,
+    const std::shared_ptr<MonteCarlo::WeightMultipliedMeshTrackLengthFluxEstimator>&
+    estimator,
+    const std::shared_ptr<MonteCarlo::PopulationControl>&
+    population_controller,
+    const std::string& simulation_name )
+{
+  std::shared_ptr<MonteCarlo::ParticleSource>
+    source( new MonteCarlo::StandardParticleSource( {source_component} ) );
+
+  std::shared_ptr<MonteCarlo::EventHandler> event_handler(
+                                 new MonteCarlo::EventHandler( *properties ) );
+
+  event_handler->addEstimator( estimator );
+
+  MonteCarlo::ParticleSimulationManagerFactory factory( model,
+                                                        source,
+                                                        event_handler,
+                                                        properties,
+                                                        simulation_name );
+
+  if( population_controller )
+    factory.setPopulationControl( population_controller );
+
+  std::shared_ptr<MonteCarlo::ParticleSimulationManager> manager =
+    factory.getManager();
+
+  std::shared_ptr<Utility::Timer> timer =
+    Utility::OpenMPProperties::createTimer();
+
+  timer->start();
+
+  manager->runSimulation();
+
+  timer->stop();
+
+  return timer->elapsed().count();
+}
+
+// Calculate the mean and the variance of the mean of an estimator
+void calculateMean( const MonteCarlo::Estimator& estimator,
+                    const double histories,
+                    double& mean,
+                    double& mean_variance )
+{
+  const double first_moment = estimator.getTotalBinDataFirstMoments()[0];
+  const double second_moment = estimator.getTotalBinDataSecondMoments()[0];
+
+  mean = first_moment/histories;
+
+  mean_variance = (second_moment/histories - mean*mean)/(histories - 1.0);
+}
+
+// Print the figure of merit of a simulation
+void printFigureOfMerit( const std::string& name,
+                         const double mean,
+                         const double mean_variance,
+                         const double time )
+{
+  const double relative_error_squared = mean_variance/(mean*mean);
+
+  std::cout << std::setw(12) << name
+            << std::setw(18) << mean
+            << std::setw(18) << std::sqrt( relative_error_squared )
+            << std::setw(18) << time
+            << std::setw(18) << 1.0/(relative_error_squared*time)
+            << std::endl;
+}
+
+// Main timing function
+int main( int argc, char** argv )
+{
+  if( argc < 3 )
+  {
+    std::cerr << "Usage: " << argv[0] << " database_path atom_zaid "
+              << "[histories] [atom_density (1/cm^3)] "
+              << "[shield_thickness (cm)] [shield_slabs]" << std::endl;
+
+    return 1;
+  }
+
+  uint64_t histories = 100000;
+
+  if( argc > 3 )
+    histories = std::strtoull( argv[3], NULL, 10 );
+
+  double atom_density = 1e23;
+
+  if( argc > 4 )
+    atom_density = std::atof( argv[4] );
+
+  double shield_thickness = 20.0;
+
+  if( argc > 5 )
+    shield_thickness = std::atof( argv[5] );
+
+  unsigned shield_slabs = 10;
+
+  if( argc > 6 )
+    shield_slabs = std::atoi( argv[6] );
+
+  if( shield_slabs < 2 )
+  {
+    std::cerr << "The shield must have at least two slabs!" << std::endl;
+
+    return 1;
+  }
+
+  // Photons below the min energy are not tallied or followed
+  const double min_energy = 0.01;
+
+  // The source emits photons uniformly in [0.5,1.0] MeV
+  const double min_source_energy = 0.5;
+  const double max_source_energy = 1.0;
+
+  const std::vector<double> energy_bin_boundaries(
+                              {min_energy, 0.1, min_source_energy,
+                               max_source_energy} );
+
+  // The shield is a stack of slabs along the z-axis. The photons are born in
+  // the first slab and the flux in the last slab is tallied.
+  const double slab_thickness = shield_thickness/shield_slabs;
+
+  std::vector<double> z_planes( shield_slabs+1 );
+
+  for( unsigned i = 0; i <= shield_slabs; ++i )
+    z_planes[i] = i*slab_thickness;
+
+  std::shared_ptr<const Utility::StructuredHexMesh> shield_mesh(
+                  new Utility::StructuredHexMesh(
+                                     {-shield_thickness, shield_thickness},
+                                     {-shield_thickness, shield_thickness},
+                                     z_planes ) );
+
+  const double source_lower_bounds[3] =
+    {-shield_thickness, -shield_thickness, 0.0};
+  const double source_upper_bounds[3] =
+    {shield_thickness, shield_thickness, slab_thickness};
+
+  const double detector_lower_bounds[3] =
+    {-shield_thickness, -shield_thickness, shield_thickness - slab_thickness};
+  const double detector_upper_bounds[3] =
+    {shield_thickness, shield_thickness, shield_thickness};
+
+  std::shared_ptr<const Utility::Mesh> detector_mesh(
+                  new Utility::StructuredHexMesh(
+                          {detector_lower_bounds[0], detector_upper_bounds[0]},
+                          {detector_lower_bounds[1], detector_upper_bounds[1]},
+                          {detector_lower_bounds[2], detector_upper_bounds[2]} ) );
+
+  std::cout << "Atom: " << argv[2] << "\n"
+            << "Atom density (1/cm^3): " << atom_density << "\n"
+            << "Shield thickness (cm): " << shield_thickness << "\n"
+            << "Shield slabs: " << shield_slabs << "\n"
+            << "Histories: " << histories << "\n" << std::endl;
+
+  // Forward model
+  std::shared_ptr<MonteCarlo::SimulationProperties> properties(
+                                        new MonteCarlo::SimulationProperties );
+  properties->setParticleMode( MonteCarlo::PHOTON_MODE );
+  properties->setNumberOfHistories( histories );
+  properties->setMinPhotonEnergy( min_energy );
+
+  std::shared_ptr<const Geometry::Model> unfilled_model;
+
+  std::shared_ptr<const MonteCarlo::FilledGeometryModel> model =
+    createModel( argv[1],
+                 std::atoi( argv[2] ),
+                 atom_density,
+                 properties,
+                 unfilled_model );
+
+  std::shared_ptr<const MonteCarlo::ParticleDistribution> source_distribution =
+    createUniformDistribution( "source",
+                               source_lower_bounds,
+                               source_upper_bounds,
+                               min_source_energy,
+                               max_source_energy );
+
+  // Analogue simulation
+  std::shared_ptr<MonteCarlo::WeightMultipliedMeshTrackLengthFluxEstimator>
+    analogue_estimator(
+             new MonteCarlo::WeightMultipliedMeshTrackLengthFluxEstimator(
+                                                                 0,
+                                                                 1.0,
+                                                                 detector_mesh ) );
+
+  analogue_estimator->setParticleTypes(
+              std::vector<MonteCarlo::ParticleType>( {MonteCarlo::PHOTON} ) );
+
+  double analogue_time = timeSimulation(
+         model,
+         std::shared_ptr<MonteCarlo::ParticleSourceComponent>(
+                new MonteCarlo::StandardPhotonSourceComponent(
+                                                     0,
+                                                     1.0,
+                                                     unfilled_model,
+                                                     source_distribution ) ),
+         properties,
+         analogue_estimator,
+         std::shared_ptr<MonteCarlo::PopulationControl>(),
+         "cadis_timer_analogue" );
+
+  double analogue_mean, analogue_mean_variance;
+
+  calculateMean( *analogue_estimator,
+                 histories,
+                 analogue_mean,
+                 analogue_mean_variance );
+
+  // Adjoint simulation (the adjoint source is the flux response in the
+  // detector slab)
+  std::shared_ptr<MonteCarlo::SimulationProperties> adjoint_properties(
+                                        new MonteCarlo::SimulationProperties );
+  adjoint_properties->setParticleMode( MonteCarlo::ADJOINT_PHOTON_MODE );
+  adjoint_properties->setNumberOfHistories( histories );
+  adjoint_properties->setMinAdjointPhotonEnergy( min_energy );
+  adjoint_properties->setMaxAdjointPhotonEnergy( max_source_energy );
+
+  std::shared_ptr<const Geometry::Model> adjoint_unfilled_model;
+
+  std::shared_ptr<const MonteCarlo::FilledGeometryModel> adjoint_model =
+    createModel( argv[1],
+                 std::atoi( argv[2] ),
+                 atom_density,
+                 adjoint_properties,
+                 adjoint_unfilled_model );
+
+  std::shared_ptr<const MonteCarlo::ParticleDistribution>
+    adjoint_source_distribution =
+    createUniformDistribution( "adjoint source",
+                               detector_lower_bounds,
+                               detector_upper_bounds,
+                               min_energy,
+                               max_source_energy );
+
+  std::shared_ptr<MonteCarlo::WeightMultipliedMeshTrackLengthFluxEstimator>
+    adjoint_estimator(
+             new MonteCarlo::WeightMultipliedMeshTrackLengthFluxEstimator(
+                                                                 0,
+                                                                 1.0,
+                                                                 shield_mesh ) );
+
+  adjoint_estimator->setParticleTypes(
+      std::vector<MonteCarlo::ParticleType>( {MonteCarlo::ADJOINT_PHOTON} ) );
+
+  adjoint_estimator->setDiscretization<MonteCarlo::OBSERVER_ENERGY_DIMENSION>(
+                                                       energy_bin_boundaries );
+
+  double adjoint_time = timeSimulation(
+         adjoint_model,
+         std::shared_ptr<MonteCarlo::ParticleSourceComponent>(
+                new MonteCarlo::StandardAdjointPhotonSourceComponent(
+                                               0,
+                                               1.0,
+                                               adjoint_model,
+                                               adjoint_source_distribution ) ),
+         adjoint_properties,
+         adjoint_estimator,
+         std::shared_ptr<MonteCarlo::PopulationControl>(),
+         "cadis_timer_adjoint" );
+
+  // Generate the CADIS biased source and weight windows
+  const double source_element_point[3] = {0.0, 0.0, 0.5*slab_thickness};
+
+  MonteCarlo::CADISGenerator::MeshElementBinValueMap forward_source_strengths;
+
+  forward_source_strengths[shield_mesh->whichElementIsPointIn( source_element_point )] =
+    std::vector<double>( {0.0, 0.0, 1.0} );
+
+  MonteCarlo::CADISGenerator generator( adjoint_estimator,
+                                        shield_mesh,
+                                        energy_bin_boundaries,
+                                        forward_source_strengths );
+
+  std::shared_ptr<const MonteCarlo::ParticleDistribution>
+    biased_source_distribution =
+    generator.createBiasedParticleDistribution( "biased source",
+                                                source_distribution );
+
+  std::shared_ptr<MonteCarlo::WeightWindowMesh> weight_window_mesh =
+    generator.createWeightWindowMesh();
+
+  // CADIS simulation
+  std::shared_ptr<MonteCarlo::WeightMultipliedMeshTrackLengthFluxEstimator>
+    cadis_estimator(
+             new MonteCarlo::WeightMultipliedMeshTrackLengthFluxEstimator(
+                                                                 0,
+                                                                 1.0,
+                                                                 detector_mesh ) );
+
+  cadis_estimator->setParticleTypes(
+              std::vector<MonteCarlo::ParticleType>( {MonteCarlo::PHOTON} ) );
+
+  double cadis_time = timeSimulation(
+         model,
+         std::shared_ptr<MonteCarlo::ParticleSourceComponent>(
+                new MonteCarlo::StandardPhotonSourceComponent(
+                                              0,
+                                              1.0,
+                                              unfilled_model,
+                                              biased_source_distribution ) ),
+         properties,
+         cadis_estimator,
+         weight_window_mesh,
+         "cadis_timer_cadis" );
+
+  double cadis_mean, cadis_mean_variance;
+
+  calculateMean( *cadis_estimator,
+                 histories,
+                 cadis_mean,
+                 cadis_mean_variance );
+
+  std::cout << std::setw(12) << "source"
+            << std::setw(18) << "mean flux"
+            << std::setw(18) << "rel. error"
+            << std::setw(18) << "time (s)"
+            << std::setw(18) << "fom" << std::endl;
+
+  printFigureOfMerit( "analogue",
+                      analogue_mean,
+                      analogue_mean_variance,
+                      analogue_time );
+
+  printFigureOfMerit( "CADIS",
+                      cadis_mean,
+                      cadis_mean_variance,
+                      cadis_time );
+
+  // The difference of the means should be within a few standard deviations
+  // if CADIS is unbiased. The figure of merit does not include the adjoint
+  // simulation time, which is reported separately.
+  std::cout << "\nAdjoint simulation time (s): " << adjoint_time
+            << "\nMean difference (standard deviations): "
+            << (cadis_mean - analogue_mean)/
+               std::sqrt( analogue_mean_variance + cadis_mean_variance )
+            << "\nCADIS figure of merit relative to analogue: "
+            << (analogue_mean_variance*analogue_time)/
+               (cadis_mean_variance*cadis_time)*
+               (cadis_mean*cadis_mean)/(analogue_mean*analogue_mean)
+            << std::endl;
+
+  return 0;
+}
+
+//---------------------------------------------------------------------------//
+// end cadis_timer.cpp
+//---------------------------------------------------------------------------//
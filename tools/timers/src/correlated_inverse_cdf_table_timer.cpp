@@ -0,0 +1,186 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   correlated_inverse_cdf_table_timer.cpp
+//! \author Alex Robinson
+//! \brief  Main function for timing correlated bivariate sampling with and
+//!         without precomputed inverse CDF tables
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <memory>
+#include <random>
+#include <cmath>
+#include <cstdlib>
+
+// FRENSIE Includes
+#include "Utility_InterpolatedFullyTabularBasicBivariateDistribution.hpp"
+#include "Utility_TabularDistribution.hpp"
+#include "Utility_OpenMPProperties.hpp"
+
+// Create a distribution that mimics an energy-angle scattering table
+template<typename TwoDGridPolicy>
+std::shared_ptr<Utility::InterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy> >
+createDistribution( const size_t primary_grid_size,
+                    const size_t secondary_grid_size )
+{
+  std::vector<double> primary_grid( primary_grid_size );
+  std::vector<std::shared_ptr<const Utility::TabularUnivariateDistribution> >
+    secondary_dists( primary_grid_size );
+
+  for( size_t i = 0; i < primary_grid_size; ++i )
+  {
+    primary_grid[i] = 1e-3*std::pow( 2e4, i/(primary_grid_size-1.0) );
+
+    // Forward peaking increases with the primary value
+    const double peaking = 0.1 + 10.0*i/(primary_grid_size-1.0);
+
+    std::vector<double> secondary_grid( secondary_grid_size );
+    std::vector<double> secondary_values( secondary_grid_size );
+
+    for( size_t j = 0; j < secondary_grid_size; ++j )
+    {
+      secondary_grid[j] = -1.0 + 2.0*j/(secondary_grid_size-1.0);
+      secondary_values[j] = std::exp( peaking*secondary_grid[j] );
+    }
+
+    secondary_dists[i].reset( new Utility::TabularDistribution<Utility::LinLin>( secondary_grid, secondary_values ) );
+  }
+
+  return std::make_shared<Utility::InterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy> >( primary_grid, secondary_dists );
+}
+
+// Time the sampling of the distribution
+template<typename Distribution>
+double timeSampling( const Distribution& distribution,
+                     const std::vector<double>& primary_values,
+                     const std::vector<double>& random_numbers,
+                     double& sample_sum )
+{
+  std::shared_ptr<Utility::Timer> timer =
+    Utility::OpenMPProperties::createTimer();
+
+  sample_sum = 0.0;
+
+  timer->start();
+
+  for( size_t i = 0; i < random_numbers.size(); ++i )
+  {
+    sample_sum +=
+      distribution.sampleSecondaryConditionalWithRandomNumber( primary_values[i], random_numbers[i] );
+  }
+
+  timer->stop();
+
+  return timer->elapsed().count();
+}
+
+// Time the distribution for several table tolerances
+template<typename TwoDGridPolicy>
+void timeDistribution( const std::string& policy_name,
+                       const size_t primary_grid_size,
+                       const size_t secondary_grid_size,
+                       const std::vector<double>& primary_values,
+                       const std::vector<double>& random_numbers )
+{
+  std::shared_ptr<Utility::InterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy> >
+    distribution = createDistribution<TwoDGridPolicy>( primary_grid_size,
+                                                       secondary_grid_size );
+
+  double exact_sum;
+  double exact_time = timeSampling( *distribution,
+                                    primary_values,
+                                    random_numbers,
+                                    exact_sum );
+
+  std::cout << policy_name << " (no tables): "
+            << random_numbers.size()/exact_time << " samples/s\n"
+            << std::endl;
+
+  std::cout << std::setw(12) << "tolerance"
+            << std::setw(10) << "points"
+            << std::setw(14) << "memory (B)"
+            << std::setw(14) << "CDF error"
+            << std::setw(14) << "mean bias"
+            << std::setw(16) << "samples/s"
+            << std::setw(12) << "speedup" << std::endl;
+
+  for( double tolerance : {1e-2, 1e-3, 1e-4, 1e-5} )
+  {
+    distribution->precomputeInverseCDFTables( tolerance, 65537 );
+
+    double table_sum;
+    double table_time = timeSampling( *distribution,
+                                      primary_values,
+                                      random_numbers,
+                                      table_sum );
+
+    std::cout << std::setw(12) << tolerance
+              << std::setw(10) << distribution->getNumberOfInverseCDFTablePoints()
+              << std::setw(14) << distribution->getInverseCDFTableMemoryUsage()
+              << std::setw(14) << distribution->getInverseCDFTableCDFError()
+              << std::setw(14) << std::fabs( table_sum - exact_sum )/random_numbers.size()
+              << std::setw(16) << random_numbers.size()/table_time
+              << std::setw(12) << exact_time/table_time << std::endl;
+  }
+
+  std::cout << std::endl;
+}
+
+// Main timing function
+int main( int argc, char** argv )
+{
+  size_t primary_grid_size = 100;
+  size_t secondary_grid_size = 200;
+  size_t samples = 10000000;
+
+  if( argc > 1 )
+    primary_grid_size = std::atoi( argv[1] );
+
+  if( argc > 2 )
+    secondary_grid_size = std::atoi( argv[2] );
+
+  if( argc > 3 )
+    samples = std::strtoull( argv[3], NULL, 10 );
+
+  std::cout << "Primary grid points: " << primary_grid_size << "\n"
+            << "Secondary grid points: " << secondary_grid_size << "\n"
+            << "Samples: " << samples << "\n" << std::endl;
+
+  // Pregenerate the primary values and random numbers so that only the
+  // sampling is timed
+  std::mt19937_64 generator( 1 );
+  std::uniform_real_distribution<double> uniform( 0.0, 1.0 );
+
+  std::vector<double> primary_values( samples );
+  std::vector<double> random_numbers( samples );
+
+  for( size_t i = 0; i < samples; ++i )
+  {
+    primary_values[i] = 1e-3*std::pow( 2e4, uniform( generator ) );
+    random_numbers[i] = uniform( generator );
+  }
+
+  timeDistribution<Utility::Correlated<Utility::LinLinLin> >(
+                                                         "Correlated",
+                                                         primary_grid_size,
+                                                         secondary_grid_size,
+                                                         primary_values,
+                                                         random_numbers );
+
+  timeDistribution<Utility::UnitBaseCorrelated<Utility::LinLinLin> >(
+                                                         "UnitBaseCorrelated",
+                                                         primary_grid_size,
+                                                         secondary_grid_size,
+                                                         primary_values,
+                                                         random_numbers );
+
+  return 0;
+}
+
+//---------------------------------------------------------------------------//
+// end correlated_inverse_cdf_table_timer.cpp
+//---------------------------------------------------------------------------//
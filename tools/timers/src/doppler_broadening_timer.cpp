@@ -0,0 +1,221 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   doppler_broadening_timer.cpp
+//! \author Alex Robinson
+//! \brief  Main function for comparing the number of trials per sample of
+//!         the binding energy rejection loop and the binding energy
+//!         truncated subshell tables of the complete Doppler broadened
+//!         photon energy distribution
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <memory>
+#include <random>
+#include <algorithm>
+#include <cstdlib>
+
+// FRENSIE Includes
+#include "MonteCarlo_DopplerBroadenedPhotonEnergyDistributionNativeFactory.hpp"
+#include "Data_ElectronPhotonRelaxationDataContainer.hpp"
+#include "Utility_DiscreteDistribution.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_OpenMPProperties.hpp"
+
+// Time the binding energy rejection loop
+/*! \details This is the subshell sampling loop that the complete Doppler
+ * broadened photon energy distributions used before the binding energy
+ * truncated subshell tables were added: a subshell is sampled from the full
+ * subshell occupancy distribution until one with a binding energy below the
+ * incoming energy is found.
+ */
+double timeRejectionLoop(
+                     const Utility::DiscreteDistribution& occupancy_distribution,
+                     const std::vector<double>& binding_energies,
+                     const double incoming_energy,
+                     const size_t samples,
+                     double& trials_per_sample )
+{
+  std::shared_ptr<Utility::Timer> timer =
+    Utility::OpenMPProperties::createTimer();
+
+  // Use the same random number sequence for each sampler
+  Utility::RandomNumberGenerator::initialize( 0ull );
+
+  size_t trials = 0;
+
+  timer->start();
+
+  for( size_t i = 0; i < samples; ++i )
+  {
+    while( true )
+    {
+      ++trials;
+
+      size_t subshell_index;
+
+      occupancy_distribution.sampleAndRecordBinIndex( subshell_index );
+
+      if( incoming_energy - binding_energies[subshell_index] >= 0.0 )
+        break;
+    }
+  }
+
+  timer->stop();
+
+  trials_per_sample = trials/(double)samples;
+
+  return timer->elapsed().count();
+}
+
+// Time the Doppler broadened energy sampling
+double timeDopplerBroadening(
+      const MonteCarlo::CompleteDopplerBroadenedPhotonEnergyDistribution&
+      distribution,
+      const double incoming_energy,
+      const std::vector<double>& scattering_angle_cosines,
+      double& trials_per_sample )
+{
+  std::shared_ptr<Utility::Timer> timer =
+    Utility::OpenMPProperties::createTimer();
+
+  // Use the same random number sequence for each sampler
+  Utility::RandomNumberGenerator::initialize( 0ull );
+
+  MonteCarlo::CompleteDopplerBroadenedPhotonEnergyDistribution::Counter
+    trials = 0;
+
+  timer->start();
+
+  for( size_t i = 0; i < scattering_angle_cosines.size(); ++i )
+  {
+    double outgoing_energy;
+    Data::SubshellType shell_of_interaction;
+
+    distribution.sampleAndRecordTrials( incoming_energy,
+                                        scattering_angle_cosines[i],
+                                        outgoing_energy,
+                                        shell_of_interaction,
+                                        trials );
+  }
+
+  timer->stop();
+
+  trials_per_sample = trials/(double)scattering_angle_cosines.size();
+
+  return timer->elapsed().count();
+}
+
+// Main timing function
+int main( int argc, char** argv )
+{
+  if( argc < 2 )
+  {
+    std::cerr << "Usage: " << argv[0] << " native_epr_file [samples]"
+              << std::endl;
+
+    return 1;
+  }
+
+  size_t samples = 1000000;
+
+  if( argc > 2 )
+    samples = std::strtoull( argv[2], NULL, 10 );
+
+  Data::ElectronPhotonRelaxationDataContainer data_container( argv[1] );
+
+  std::cout << "Native file: " << argv[1] << "\n"
+            << "Samples: " << samples << "\n" << std::endl;
+
+  std::shared_ptr<const MonteCarlo::CompleteDopplerBroadenedPhotonEnergyDistribution>
+    distribution;
+
+  MonteCarlo::DopplerBroadenedPhotonEnergyDistributionNativeFactory::createCoupledCompleteDistribution(
+                                                              data_container,
+                                                              distribution );
+
+  // Create the full subshell occupancy distribution (ENDF subshell order)
+  std::vector<double> subshell_indices, occupancies, binding_energies;
+
+  for( auto&& subshell : data_container.getSubshells() )
+  {
+    subshell_indices.push_back( subshell_indices.size() );
+    occupancies.push_back( data_container.getSubshellOccupancy( subshell ) );
+    binding_energies.push_back(
+                        data_container.getSubshellBindingEnergy( subshell ) );
+  }
+
+  Utility::DiscreteDistribution occupancy_distribution( subshell_indices,
+                                                        occupancies );
+
+  // The incoming energies are just below each binding energy that is above
+  // the min photon energy (the rejection loop is least efficient there) and
+  // well above every binding energy
+  std::vector<double> incoming_energies( binding_energies );
+
+  std::sort( incoming_energies.begin(), incoming_energies.end() );
+
+  incoming_energies.erase( std::unique( incoming_energies.begin(),
+                                        incoming_energies.end() ),
+                           incoming_energies.end() );
+
+  for( size_t i = 0; i < incoming_energies.size(); ++i )
+    incoming_energies[i] *= 0.99;
+
+  incoming_energies.erase( std::remove_if( incoming_energies.begin(),
+                                           incoming_energies.end(),
+                                           []( const double energy )
+                                           { return energy < 1e-3; } ),
+                           incoming_energies.end() );
+
+  incoming_energies.push_back( 1.0 );
+
+  // Pregenerate the scattering angle cosines so that only the sampling is
+  // timed
+  std::mt19937_64 generator( 1 );
+  std::uniform_real_distribution<double> uniform( -1.0, 1.0 );
+
+  std::vector<double> scattering_angle_cosines( samples );
+
+  for( size_t i = 0; i < samples; ++i )
+    scattering_angle_cosines[i] = uniform( generator );
+
+  Utility::RandomNumberGenerator::createStreams();
+
+  std::cout << std::setw(14) << "energy (MeV)"
+            << std::setw(20) << "rejection trials"
+            << std::setw(20) << "rejection loop (s)"
+            << std::setw(20) << "table trials"
+            << std::setw(20) << "Doppler samples/s" << std::endl;
+
+  for( size_t i = 0; i < incoming_energies.size(); ++i )
+  {
+    double rejection_trials, table_trials;
+
+    double rejection_time = timeRejectionLoop( occupancy_distribution,
+                                               binding_energies,
+                                               incoming_energies[i],
+                                               samples,
+                                               rejection_trials );
+
+    double table_time = timeDopplerBroadening( *distribution,
+                                               incoming_energies[i],
+                                               scattering_angle_cosines,
+                                               table_trials );
+
+    std::cout << std::setw(14) << incoming_energies[i]
+              << std::setw(20) << rejection_trials
+              << std::setw(20) << rejection_time
+              << std::setw(20) << table_trials
+              << std::setw(20) << samples/table_time << std::endl;
+  }
+
+  return 0;
+}
+
+//---------------------------------------------------------------------------//
+// end doppler_broadening_timer.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,293 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   dxtran_timer.cpp
+//! \author Alex Robinson
+//! \brief  Main function for comparing the figure of merit and the mean of
+//!         a photon flux tally with and without a DXTRAN sphere
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <memory>
+#include <cmath>
+#include <cstdlib>
+
+// Boost Includes
+#include <boost/filesystem.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleSimulationManagerFactory.hpp"
+#include "MonteCarlo_StandardParticleSource.hpp"
+#include "MonteCarlo_StandardParticleSourceComponent.hpp"
+#include "MonteCarlo_StandardParticleDistribution.hpp"
+#include "MonteCarlo_MeshTrackLengthFluxEstimator.hpp"
+#include "MonteCarlo_DXTRANSpheres.hpp"
+#include "Data_ScatteringCenterPropertiesDatabase.hpp"
+#include "Geometry_InfiniteMediumModel.hpp"
+#include "Utility_StructuredHexMesh.hpp"
+#include "Utility_OpenMPProperties.hpp"
+
+using boost::units::cgs::cubic_centimeter;
+
+// Create the filled infinite medium model
+std::shared_ptr<const MonteCarlo::FilledGeometryModel> createModel(
+        const boost::filesystem::path& database_path,
+        const unsigned zaid,
+        const double atom_density,
+        const std::shared_ptr<const MonteCarlo::SimulationProperties>&
+        properties,
+        std::shared_ptr<const Geometry::Model>& unfilled_model )
+{
+  const Data::ScatteringCenterPropertiesDatabase database( database_path );
+
+  const Data::AtomProperties& atom_properties =
+    database.getAtomProperties( zaid );
+
+  std::shared_ptr<MonteCarlo::ScatteringCenterDefinitionDatabase>
+    scattering_center_definition_database(
+                          new MonteCarlo::ScatteringCenterDefinitionDatabase );
+
+  MonteCarlo::ScatteringCenterDefinition& definition =
+    scattering_center_definition_database->createDefinition( "atom", zaid );
+
+  definition.setPhotoatomicDataProperties(
+          atom_properties.getSharedPhotoatomicDataProperties(
+                       Data::PhotoatomicDataProperties::Native_EPR_FILE, 0 ) );
+
+  std::shared_ptr<MonteCarlo::MaterialDefinitionDatabase>
+    material_definition_database( new MonteCarlo::MaterialDefinitionDatabase );
+
+  material_definition_database->addDefinition( "atom", 1, {"atom"}, {1.0} );
+
+  unfilled_model.reset( new Geometry::InfiniteMediumModel(
+                                          1, 1, atom_density/cubic_centimeter ) );
+
+  return std::shared_ptr<const MonteCarlo::FilledGeometryModel>(
+                        new MonteCarlo::FilledGeometryModel(
+                                         database_path,
+                                         scattering_center_definition_database,
+                                         material_definition_database,
+                                         properties,
+                                         unfilled_model,
+                                         false ) );
+}
+
+// Time a photon simulation of the flux in a box
+/*! \details The flux is tallied with a track length estimator on a single
+ * element mesh (a box that is inscribed in the DXTRAN sphere). The DXTRAN
+ * spheres are only used if they are not null.
+ */
+double timeSimulation(
+    const std::shared_ptr<const MonteCarlo::FilledGeometryModel>& model,
+    const std::shared_ptr<const Geometry::Model>& unfilled_model,
+    const std::shared_ptr<const MonteCarlo::SimulationProperties>& properties,
+    const std::shared_ptr<const Utility::Mesh>& mesh,
+    const std::shared_ptr<MonteCarlo::DXTRANSpheres>& dxtran_spheres,
+    const std::string& simulation_name,
+    double& mean,
+    double& mean_variance )
+{
+  // Point source at the origin (1 MeV isotropic photons)
+  std::shared_ptr<const MonteCarlo::ParticleDistribution>
+    particle_distribution(
+                  new MonteCarlo::StandardParticleDistribution( "source" ) );
+
+  std::shared_ptr<MonteCarlo::ParticleSourceComponent>
+    source_component( new MonteCarlo::StandardPhotonSourceComponent(
+                                                     0,
+                                                     1.0,
+                                                     unfilled_model,
+                                                     particle_distribution ) );
+
+  std::shared_ptr<MonteCarlo::ParticleSource>
+    source( new MonteCarlo::StandardParticleSource( {source_component} ) );
+
+  std::shared_ptr<MonteCarlo::WeightMultipliedMeshTrackLengthFluxEstimator>
+    estimator( new MonteCarlo::WeightMultipliedMeshTrackLengthFluxEstimator(
+                                                                 0,
+                                                                 1.0,
+                                                                 mesh ) );
+
+  estimator->setParticleTypes(
+              std::vector<MonteCarlo::ParticleType>( {MonteCarlo::PHOTON} ) );
+
+  std::shared_ptr<MonteCarlo::EventHandler> event_handler(
+                                 new MonteCarlo::EventHandler( *properties ) );
+
+  event_handler->addEstimator( estimator );
+
+  MonteCarlo::ParticleSimulationManagerFactory factory( model,
+                                                        source,
+                                                        event_handler,
+                                                        properties,
+                                                        simulation_name );
+
+  std::shared_ptr<MonteCarlo::ParticleSimulationManager> manager =
+    factory.getManager();
+
+  if( dxtran_spheres )
+    manager->setDXTRANSpheres( dxtran_spheres );
+
+  std::shared_ptr<Utility::Timer> timer =
+    Utility::OpenMPProperties::createTimer();
+
+  timer->start();
+
+  manager->runSimulation();
+
+  timer->stop();
+
+  const double histories = properties->getNumberOfHistories();
+
+  const double first_moment = estimator->getTotalBinDataFirstMoments()[0];
+  const double second_moment = estimator->getTotalBinDataSecondMoments()[0];
+
+  mean = first_moment/histories;
+
+  mean_variance = (second_moment/histories - mean*mean)/(histories - 1.0);
+
+  return timer->elapsed().count();
+}
+
+// Print the figure of merit of a simulation
+void printFigureOfMerit( const std::string& name,
+                         const double mean,
+                         const double mean_variance,
+                         const double time )
+{
+  const double relative_error_squared = mean_variance/(mean*mean);
+
+  std::cout << std::setw(12) << name
+            << std::setw(18) << mean
+            << std::setw(18) << std::sqrt( relative_error_squared )
+            << std::setw(18) << time
+            << std::setw(18) << 1.0/(relative_error_squared*time)
+            << std::endl;
+}
+
+// Main timing function
+int main( int argc, char** argv )
+{
+  if( argc < 3 )
+  {
+    std::cerr << "Usage: " << argv[0] << " database_path atom_zaid "
+              << "[histories] [atom_density (1/cm^3)] "
+              << "[sphere_distance (cm)] [sphere_radius (cm)]" << std::endl;
+
+    return 1;
+  }
+
+  uint64_t histories = 100000;
+
+  if( argc > 3 )
+    histories = std::strtoull( argv[3], NULL, 10 );
+
+  double atom_density = 1e23;
+
+  if( argc > 4 )
+    atom_density = std::atof( argv[4] );
+
+  double sphere_distance = 20.0;
+
+  if( argc > 5 )
+    sphere_distance = std::atof( argv[5] );
+
+  double sphere_radius = 2.0;
+
+  if( argc > 6 )
+    sphere_radius = std::atof( argv[6] );
+
+  std::shared_ptr<MonteCarlo::SimulationProperties> properties(
+                                        new MonteCarlo::SimulationProperties );
+  properties->setParticleMode( MonteCarlo::PHOTON_MODE );
+  properties->setNumberOfHistories( histories );
+
+  std::shared_ptr<const Geometry::Model> unfilled_model;
+
+  std::shared_ptr<const MonteCarlo::FilledGeometryModel> model =
+    createModel( argv[1],
+                 std::atoi( argv[2] ),
+                 atom_density,
+                 properties,
+                 unfilled_model );
+
+  // The tally box is inscribed in the DXTRAN sphere
+  const double half_width = sphere_radius/std::sqrt( 3.0 );
+
+  std::shared_ptr<const Utility::Mesh> mesh(
+         new Utility::StructuredHexMesh(
+              {-half_width, half_width},
+              {-half_width, half_width},
+              {sphere_distance - half_width, sphere_distance + half_width} ) );
+
+  std::shared_ptr<MonteCarlo::DXTRANSpheres> dxtran_spheres(
+                                      new MonteCarlo::DXTRANSpheres( model ) );
+
+  dxtran_spheres->addSphere( MonteCarlo::PHOTON,
+                             {0.0, 0.0, sphere_distance},
+                             sphere_radius );
+
+  std::cout << "Atom: " << argv[2] << "\n"
+            << "Atom density (1/cm^3): " << atom_density << "\n"
+            << "DXTRAN sphere distance (cm): " << sphere_distance << "\n"
+            << "DXTRAN sphere radius (cm): " << sphere_radius << "\n"
+            << "Histories: " << histories << "\n" << std::endl;
+
+  double analogue_mean, analogue_mean_variance;
+
+  double analogue_time = timeSimulation( model,
+                                         unfilled_model,
+                                         properties,
+                                         mesh,
+                                         std::shared_ptr<MonteCarlo::DXTRANSpheres>(),
+                                         "dxtran_timer_analogue",
+                                         analogue_mean,
+                                         analogue_mean_variance );
+
+  double dxtran_mean, dxtran_mean_variance;
+
+  double dxtran_time = timeSimulation( model,
+                                       unfilled_model,
+                                       properties,
+                                       mesh,
+                                       dxtran_spheres,
+                                       "dxtran_timer_dxtran",
+                                       dxtran_mean,
+                                       dxtran_mean_variance );
+
+  std::cout << std::setw(12) << "transport"
+            << std::setw(18) << "mean flux"
+            << std::setw(18) << "rel. error"
+            << std::setw(18) << "time (s)"
+            << std::setw(18) << "fom" << std::endl;
+
+  printFigureOfMerit( "analogue",
+                      analogue_mean,
+                      analogue_mean_variance,
+                      analogue_time );
+
+  printFigureOfMerit( "DXTRAN",
+                      dxtran_mean,
+                      dxtran_mean_variance,
+                      dxtran_time );
+
+  // The difference of the means should be within a few standard deviations
+  // if DXTRAN is unbiased
+  std::cout << "\nMean difference (standard deviations): "
+            << (dxtran_mean - analogue_mean)/
+               std::sqrt( analogue_mean_variance + dxtran_mean_variance )
+            << "\nDXTRAN figure of merit relative to analogue: "
+            << (analogue_mean_variance*analogue_time)/
+               (dxtran_mean_variance*dxtran_time)*
+               (dxtran_mean*dxtran_mean)/(analogue_mean*analogue_mean)
+            << std::endl;
+
+  return 0;
+}
+
+//---------------------------------------------------------------------------//
+// end dxtran_timer.cpp
+//---------------------------------------------------------------------------//
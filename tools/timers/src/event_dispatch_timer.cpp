@@ -0,0 +1,210 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   event_dispatch_timer.cpp
+//! \author Alex Robinson
+//! \brief  Main function for timing the dispatch of particle events through
+//!         the dense dispatcher table and through the dispatcher map
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <memory>
+#include <random>
+#include <cstdint>
+#include <cstdlib>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleSubtrackEndingInCellEventDispatcher.hpp"
+#include "MonteCarlo_ParticleSubtrackEndingInCellEventObserver.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+#include "Utility_OpenMPProperties.hpp"
+
+// The track length tally observer (mimics the cheapest cell estimator)
+class TrackLengthTally : public MonteCarlo::ParticleSubtrackEndingInCellEventObserver
+{
+
+public:
+
+  //! Constructor
+  TrackLengthTally()
+    : d_track_length( 0.0 )
+  { /* ... */ }
+
+  //! Update the observer
+  void updateFromParticleSubtrackEndingInCellEvent(
+                              const MonteCarlo::ParticleState&,
+                              const Geometry::Model::EntityId,
+                              const double track_length ) final override
+  { d_track_length += track_length; }
+
+  //! Return the tallied track length
+  double getTrackLength() const
+  { return d_track_length; }
+
+private:
+
+  // The tallied track length
+  double d_track_length;
+};
+
+// Create a dispatcher with the observers attached to each cell
+/*! \details Cells with an id that is less than 65536 are stored in the
+ * dense dispatcher table. All other cells are only stored in the dispatcher
+ * map (the unordered_map that every look-up used to go through).
+ */
+std::shared_ptr<MonteCarlo::ParticleSubtrackEndingInCellEventDispatcher>
+createDispatcher( const uint64_t first_cell_id,
+                  const size_t cells,
+                  const size_t observers_per_cell,
+                  std::vector<std::shared_ptr<TrackLengthTally> >& observers )
+{
+  std::shared_ptr<MonteCarlo::ParticleSubtrackEndingInCellEventDispatcher>
+    dispatcher( new MonteCarlo::ParticleSubtrackEndingInCellEventDispatcher );
+
+  observers.clear();
+
+  for( size_t i = 0; i < observers_per_cell; ++i )
+  {
+    observers.emplace_back( new TrackLengthTally );
+
+    for( size_t j = 0; j < cells; ++j )
+      dispatcher->attachObserver( first_cell_id + j, observers.back() );
+  }
+
+  return dispatcher;
+}
+
+// Time the event dispatches
+double timeDispatches(
+         MonteCarlo::ParticleSubtrackEndingInCellEventDispatcher& dispatcher,
+         const uint64_t first_cell_id,
+         const std::vector<size_t>& cell_indices,
+         const std::vector<std::shared_ptr<TrackLengthTally> >& observers,
+         double& track_length_sum )
+{
+  MonteCarlo::PhotonState photon( 0 );
+  photon.setEnergy( 1.0 );
+
+  std::shared_ptr<Utility::Timer> timer =
+    Utility::OpenMPProperties::createTimer();
+
+  timer->start();
+
+  for( size_t i = 0; i < cell_indices.size(); ++i )
+  {
+    dispatcher.dispatchParticleSubtrackEndingInCellEvent(
+                                             photon,
+                                             first_cell_id + cell_indices[i],
+                                             1.0 );
+  }
+
+  timer->stop();
+
+  track_length_sum = 0.0;
+
+  for( size_t i = 0; i < observers.size(); ++i )
+    track_length_sum += observers[i]->getTrackLength();
+
+  return timer->elapsed().count();
+}
+
+// Main timing function
+int main( int argc, char** argv )
+{
+  size_t cells = 10000;
+  size_t observers_per_cell = 2;
+  size_t events = 10000000;
+
+  if( argc > 1 )
+    cells = std::strtoull( argv[1], NULL, 10 );
+
+  if( argc > 2 )
+    observers_per_cell = std::strtoull( argv[2], NULL, 10 );
+
+  if( argc > 3 )
+    events = std::strtoull( argv[3], NULL, 10 );
+
+  if( cells == 0 || cells > 65535 )
+  {
+    std::cerr << "The number of cells must be in [1,65535]!" << std::endl;
+
+    return 1;
+  }
+
+  // The dense cells use ids [1,cells], the map cells use ids above the max
+  // dense entity id
+  const uint64_t dense_first_cell_id = 1;
+  const uint64_t map_first_cell_id = 1000000;
+
+  std::cout << "Cells: " << cells << "\n"
+            << "Observers per cell: " << observers_per_cell << "\n"
+            << "Events: " << events << "\n" << std::endl;
+
+  // Pregenerate the cells that the events occur in so that only the
+  // dispatches are timed
+  std::mt19937_64 generator( 1 );
+  std::uniform_int_distribution<size_t> uniform( 0, cells-1 );
+
+  std::vector<size_t> cell_indices( events );
+
+  for( size_t i = 0; i < events; ++i )
+    cell_indices[i] = uniform( generator );
+
+  std::vector<std::shared_ptr<TrackLengthTally> > dense_observers;
+
+  std::shared_ptr<MonteCarlo::ParticleSubtrackEndingInCellEventDispatcher>
+    dense_dispatcher = createDispatcher( dense_first_cell_id,
+                                         cells,
+                                         observers_per_cell,
+                                         dense_observers );
+
+  std::vector<std::shared_ptr<TrackLengthTally> > map_observers;
+
+  std::shared_ptr<MonteCarlo::ParticleSubtrackEndingInCellEventDispatcher>
+    map_dispatcher = createDispatcher( map_first_cell_id,
+                                       cells,
+                                       observers_per_cell,
+                                       map_observers );
+
+  std::cout << std::setw(20) << "dispatcher lookup"
+            << std::setw(18) << "time (s)"
+            << std::setw(18) << "events/s"
+            << std::setw(18) << "track length" << std::endl;
+
+  double map_track_length;
+
+  double map_time = timeDispatches( *map_dispatcher,
+                                    map_first_cell_id,
+                                    cell_indices,
+                                    map_observers,
+                                    map_track_length );
+
+  std::cout << std::setw(20) << "unordered_map"
+            << std::setw(18) << map_time
+            << std::setw(18) << events/map_time
+            << std::setw(18) << map_track_length << std::endl;
+
+  double dense_track_length;
+
+  double dense_time = timeDispatches( *dense_dispatcher,
+                                      dense_first_cell_id,
+                                      cell_indices,
+                                      dense_observers,
+                                      dense_track_length );
+
+  std::cout << std::setw(20) << "dense table"
+            << std::setw(18) << dense_time
+            << std::setw(18) << events/dense_time
+            << std::setw(18) << dense_track_length << std::endl;
+
+  std::cout << "\nDense table speedup: " << map_time/dense_time << std::endl;
+
+  return 0;
+}
+
+//---------------------------------------------------------------------------//
+// end event_dispatch_timer.cpp
+//---------------------------------------------------------------------------//
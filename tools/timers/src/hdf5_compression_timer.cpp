@@ -0,0 +1,181 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   hdf5_compression_timer.cpp
+//! \author Alex Robinson
+//! \brief  Main function for comparing the file size and the write and read
+//!         bandwidth of HDF5 archives with and without compressed large data
+//!         sets
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <memory>
+#include <random>
+#include <cmath>
+#include <cstdlib>
+
+// Boost Includes
+#include <boost/filesystem.hpp>
+#include <boost/serialization/nvp.hpp>
+
+// FRENSIE Includes
+#include "Utility_HDF5IArchive.hpp"
+#include "Utility_HDF5OArchive.hpp"
+#include "Utility_Vector.hpp"
+#include "Utility_OpenMPProperties.hpp"
+
+// Time the writing and reading of an archive
+void timeArchive( const std::string& archive_name,
+                  const std::vector<double>& first_moments,
+                  const std::vector<double>& second_moments,
+                  const bool compress,
+                  double& write_time,
+                  double& read_time,
+                  uintmax_t& file_size )
+{
+  std::shared_ptr<Utility::Timer> timer =
+    Utility::OpenMPProperties::createTimer();
+
+  unsigned flags = Utility::HDF5OArchiveFlags::OVERWRITE_EXISTING_ARCHIVE;
+
+  if( compress )
+    flags |= Utility::HDF5OArchiveFlags::COMPRESS_LARGE_DATA_SETS;
+
+  timer->start();
+
+  {
+    Utility::HDF5OArchive archive( archive_name, flags );
+
+    archive << boost::serialization::make_nvp( "first_moments",
+                                               first_moments );
+    archive << boost::serialization::make_nvp( "second_moments",
+                                               second_moments );
+  }
+
+  timer->stop();
+
+  write_time = timer->elapsed().count();
+
+  file_size = boost::filesystem::file_size( archive_name );
+
+  std::vector<double> extracted_first_moments, extracted_second_moments;
+
+  timer->start();
+
+  {
+    Utility::HDF5IArchive archive( archive_name );
+
+    archive >> boost::serialization::make_nvp( "first_moments",
+                                               extracted_first_moments );
+    archive >> boost::serialization::make_nvp( "second_moments",
+                                               extracted_second_moments );
+  }
+
+  timer->stop();
+
+  read_time = timer->elapsed().count();
+
+  if( extracted_first_moments != first_moments ||
+      extracted_second_moments != second_moments )
+  {
+    std::cerr << "The data extracted from " << archive_name
+              << " does not match the archived data!" << std::endl;
+  }
+
+  boost::filesystem::remove( archive_name );
+}
+
+// Main timing function
+int main( int argc, char** argv )
+{
+  size_t bins = 10000000;
+
+  if( argc > 1 )
+    bins = std::strtoull( argv[1], NULL, 10 );
+
+  // The fraction of bins that were never scored (e.g. mesh elements
+  // outside of the region of interest)
+  double zero_fraction = 0.5;
+
+  if( argc > 2 )
+    zero_fraction = std::atof( argv[2] );
+
+  std::string archive_directory = ".";
+
+  if( argc > 3 )
+    archive_directory = argv[3];
+
+  // Generate data that mimics estimator moment arrays (a smooth shape with
+  // statistical noise)
+  std::mt19937_64 generator( 1 );
+  std::uniform_real_distribution<double> uniform( 0.0, 1.0 );
+  std::normal_distribution<double> noise( 1.0, 0.05 );
+
+  std::vector<double> first_moments( bins ), second_moments( bins );
+
+  for( size_t i = 0; i < bins; ++i )
+  {
+    if( uniform( generator ) < zero_fraction )
+    {
+      first_moments[i] = 0.0;
+      second_moments[i] = 0.0;
+    }
+    else
+    {
+      const double shape = std::exp( -5.0*i/bins );
+
+      first_moments[i] = shape*noise( generator );
+      second_moments[i] = first_moments[i]*first_moments[i]*
+        noise( generator );
+    }
+  }
+
+  const double data_size_mb = 2*bins*sizeof(double)/1e6;
+
+  std::cout << "Bins: " << bins << "\n"
+            << "Zero fraction: " << zero_fraction << "\n"
+            << "Data size (MB): " << data_size_mb << "\n" << std::endl;
+
+  std::cout << std::setw(14) << "archive"
+            << std::setw(18) << "file size (MB)"
+            << std::setw(18) << "write (MB/s)"
+            << std::setw(18) << "read (MB/s)" << std::endl;
+
+  const std::string archive_names[2] =
+    {archive_directory + "/hdf5_compression_timer_uncompressed.h5fa",
+     archive_directory + "/hdf5_compression_timer_compressed.h5fa"};
+
+  const std::string labels[2] = {"uncompressed", "compressed"};
+
+  uintmax_t file_sizes[2];
+
+  for( size_t i = 0; i < 2; ++i )
+  {
+    double write_time, read_time;
+
+    timeArchive( archive_names[i],
+                 first_moments,
+                 second_moments,
+                 i == 1,
+                 write_time,
+                 read_time,
+                 file_sizes[i] );
+
+    std::cout << std::setw(14) << labels[i]
+              << std::setw(18) << file_sizes[i]/1e6
+              << std::setw(18) << data_size_mb/write_time
+              << std::setw(18) << data_size_mb/read_time << std::endl;
+  }
+
+  std::cout << "\nCompressed file size relative to uncompressed: "
+            << (double)file_sizes[1]/file_sizes[0] << std::endl;
+
+  return 0;
+}
+
+//---------------------------------------------------------------------------//
+// end hdf5_compression_timer.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,233 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   implicit_capture_timer.cpp
+//! \author Alex Robinson
+//! \brief  Main function for comparing the figure of merit of a neutron
+//!         survival estimate with analogue collisions and with implicit
+//!         capture (survival biasing) collisions
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <iomanip>
+#include <memory>
+#include <cmath>
+#include <cstdlib>
+
+// FRENSIE Includes
+#include "MonteCarlo_NuclideACEFactory.hpp"
+#include "MonteCarlo_NeutronState.hpp"
+#include "MonteCarlo_ParticleBank.hpp"
+#include "MonteCarlo_SimulationProperties.hpp"
+#include "Data_ACEFileHandler.hpp"
+#include "Data_XSSNeutronDataExtractor.hpp"
+#include "Data_ZAID.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_OpenMPProperties.hpp"
+
+// Create the nuclide
+std::shared_ptr<const MonteCarlo::Nuclide> createNuclide(
+                  const Data::ACEFileHandler& ace_file_handler,
+                  const Data::XSSNeutronDataExtractor& xss_data_extractor )
+{
+  const std::string& table_name = ace_file_handler.getTableName();
+
+  const Data::ZAID zaid( table_name.substr( 0, table_name.find( '.' ) ) );
+
+  MonteCarlo::SimulationProperties properties;
+
+  std::shared_ptr<const MonteCarlo::Nuclide> nuclide;
+
+  MonteCarlo::NuclideACEFactory::createNuclide(
+                      xss_data_extractor,
+                      table_name,
+                      zaid.atomicNumber(),
+                      zaid.atomicMassNumber(),
+                      zaid.isomerNumber(),
+                      ace_file_handler.getTableAtomicWeightRatio(),
+                      ace_file_handler.getTableTemperature().value(),
+                      properties,
+                      nuclide );
+
+  return nuclide;
+}
+
+// Time the estimate of the probability that a neutron survives collisions
+/*! \details The score of a history is the weight of the neutron after the
+ * collisions (zero if it was absorbed). Secondary neutrons are discarded.
+ */
+double timeSurvivalEstimate( const MonteCarlo::Nuclide& nuclide,
+                             const bool survival_bias,
+                             const double energy,
+                             const unsigned collisions,
+                             const unsigned long long histories,
+                             double& mean,
+                             double& mean_variance )
+{
+  std::shared_ptr<Utility::Timer> timer =
+    Utility::OpenMPProperties::createTimer();
+
+  // Use the same random number sequence for each collision mode
+  Utility::RandomNumberGenerator::initialize( 0ull );
+
+  double first_moment = 0.0;
+  double second_moment = 0.0;
+
+  MonteCarlo::ParticleBank bank;
+
+  timer->start();
+
+  for( unsigned long long i = 0; i < histories; ++i )
+  {
+    MonteCarlo::NeutronState neutron( i );
+    neutron.setDirection( 0.0, 0.0, 1.0 );
+    neutron.setEnergy( energy );
+    neutron.setWeight( 1.0 );
+
+    for( unsigned j = 0; j < collisions; ++j )
+    {
+      if( survival_bias )
+        nuclide.collideSurvivalBias( neutron, bank );
+      else
+        nuclide.collideAnalogue( neutron, bank );
+
+      // Discard any secondaries
+      while( !bank.isEmpty() )
+        bank.pop();
+
+      // Stop if the neutron has been absorbed or has left the grid
+      if( neutron.isGone() || neutron.getEnergy() <= 1e-11 )
+        break;
+    }
+
+    const double score = neutron.isGone() ? 0.0 : neutron.getWeight();
+
+    first_moment += score;
+    second_moment += score*score;
+  }
+
+  timer->stop();
+
+  mean = first_moment/histories;
+
+  mean_variance = (second_moment/histories - mean*mean)/(histories - 1.0);
+
+  return timer->elapsed().count();
+}
+
+// Print the figure of merit of an estimate
+void printFigureOfMerit( const std::string& name,
+                         const double mean,
+                         const double mean_variance,
+                         const double time )
+{
+  const double relative_error_squared = mean_variance/(mean*mean);
+
+  std::cout << std::setw(12) << name
+            << std::setw(18) << mean
+            << std::setw(18) << std::sqrt( relative_error_squared )
+            << std::setw(18) << time
+            << std::setw(18) << 1.0/(relative_error_squared*time)
+            << std::endl;
+}
+
+// Main timing function
+int main( int argc, char** argv )
+{
+  if( argc < 4 )
+  {
+    std::cerr << "Usage: " << argv[0] << " ace_file table start_line "
+              << "[histories] [energy (MeV)] [collisions]" << std::endl;
+
+    return 1;
+  }
+
+  unsigned long long histories = 1000000;
+
+  if( argc > 4 )
+    histories = std::strtoull( argv[4], NULL, 10 );
+
+  double energy = 2.53e-8;
+
+  if( argc > 5 )
+    energy = std::atof( argv[5] );
+
+  unsigned collisions = 40;
+
+  if( argc > 6 )
+    collisions = std::atoi( argv[6] );
+
+  Data::ACEFileHandler ace_file_handler( argv[1],
+                                         argv[2],
+                                         std::atoi( argv[3] ),
+                                         true );
+
+  Data::XSSNeutronDataExtractor xss_data_extractor(
+                                       ace_file_handler.getTableNXSArray(),
+                                       ace_file_handler.getTableJXSArray(),
+                                       ace_file_handler.getTableXSSArray() );
+
+  std::shared_ptr<const MonteCarlo::Nuclide> nuclide =
+    createNuclide( ace_file_handler, xss_data_extractor );
+
+  std::cout << "Table: " << argv[2] << "\n"
+            << "Incoming energy (MeV): " << energy << "\n"
+            << "Max collisions: " << collisions << "\n"
+            << "Histories: " << histories << "\n" << std::endl;
+
+  Utility::RandomNumberGenerator::createStreams();
+
+  double analogue_mean, analogue_mean_variance;
+
+  double analogue_time = timeSurvivalEstimate( *nuclide,
+                                               false,
+                                               energy,
+                                               collisions,
+                                               histories,
+                                               analogue_mean,
+                                               analogue_mean_variance );
+
+  double implicit_mean, implicit_mean_variance;
+
+  double implicit_time = timeSurvivalEstimate( *nuclide,
+                                               true,
+                                               energy,
+                                               collisions,
+                                               histories,
+                                               implicit_mean,
+                                               implicit_mean_variance );
+
+  std::cout << std::setw(12) << "collisions"
+            << std::setw(18) << "survival prob."
+            << std::setw(18) << "rel. error"
+            << std::setw(18) << "time (s)"
+            << std::setw(18) << "fom" << std::endl;
+
+  printFigureOfMerit( "analogue",
+                      analogue_mean,
+                      analogue_mean_variance,
+                      analogue_time );
+
+  printFigureOfMerit( "implicit",
+                      implicit_mean,
+                      implicit_mean_variance,
+                      implicit_time );
+
+  // The difference of the means should be within a few standard deviations
+  // since implicit capture is unbiased
+  std::cout << "\nMean difference (standard deviations): "
+            << (implicit_mean - analogue_mean)/
+               std::sqrt( analogue_mean_variance + implicit_mean_variance )
+            << "\nImplicit capture figure of merit relative to analogue: "
+            << (analogue_mean_variance*analogue_time)/
+               (implicit_mean_variance*implicit_time)*
+               (implicit_mean*implicit_mean)/(analogue_mean*analogue_mean)
+            << std::endl;
+
+  return 0;
+}
+
+//---------------------------------------------------------------------------//
+// end implicit_capture_timer.cpp
+//---------------------------------------------------------------------------//
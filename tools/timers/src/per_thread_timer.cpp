@@ -0,0 +1,95 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   per_thread_timer.cpp
+//! \author Alex Robinson
+//! \brief  Main function for timing thread-indexed counter storage
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cstdint>
+#include <cstdlib>
+
+// FRENSIE Includes
+#include "Utility_PerThread.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "FRENSIE_config.hpp"
+
+// Increment each thread's counter (mimics the source and event handler
+// counters which are incremented once per sample/history)
+template<typename CounterArray>
+double timeCounterIncrements( CounterArray& counters,
+                              const unsigned threads,
+                              const uint64_t increments_per_thread )
+{
+  std::shared_ptr<Utility::Timer> timer =
+    Utility::OpenMPProperties::createTimer();
+
+  timer->start();
+
+  #pragma omp parallel num_threads( threads )
+  {
+    uint64_t& counter = counters[Utility::OpenMPProperties::getThreadId()];
+
+    for( uint64_t i = 0; i < increments_per_thread; ++i )
+    {
+      ++counter;
+
+      // Prevent the compiler from hoisting the counter into a register
+      asm volatile( "" : : "g"(&counter) : "memory" );
+    }
+  }
+
+  timer->stop();
+
+  return timer->elapsed().count();
+}
+
+// Main timing function
+int main( int argc, char** argv )
+{
+  unsigned max_threads = 128;
+  uint64_t increments_per_thread = 10000000;
+
+  if( argc > 1 )
+    max_threads = std::atoi( argv[1] );
+
+  if( argc > 2 )
+    increments_per_thread = std::strtoull( argv[2], NULL, 10 );
+
+  std::cout << "Counter increments per thread: " << increments_per_thread
+            << "\n" << std::endl;
+
+  std::cout << std::setw(10) << "threads"
+            << std::setw(20) << "std::vector (s)"
+            << std::setw(20) << "PerThread (s)"
+            << std::setw(12) << "speedup" << std::endl;
+
+  for( unsigned threads = 1; threads <= max_threads; threads *= 2 )
+  {
+    std::vector<uint64_t> vector_counters( threads, 0 );
+    Utility::PerThread<uint64_t> per_thread_counters( threads, 0 );
+
+    double vector_time = timeCounterIncrements( vector_counters,
+                                                threads,
+                                                increments_per_thread );
+
+    double per_thread_time = timeCounterIncrements( per_thread_counters,
+                                                    threads,
+                                                    increments_per_thread );
+
+    std::cout << std::setw(10) << threads
+              << std::setw(20) << vector_time
+              << std::setw(20) << per_thread_time
+              << std::setw(12) << vector_time/per_thread_time << std::endl;
+  }
+
+  return 0;
+}
+
+//---------------------------------------------------------------------------//
+// end per_thread_timer.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,239 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   photon_angle_table_timer.cpp
+//! \author Alex Robinson
+//! \brief  Main function for comparing the throughput of the rejection
+//!         samplers and the direct (table) samplers of the photon
+//!         scattering and bremsstrahlung 2BS photon angles
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <memory>
+#include <random>
+#include <cmath>
+#include <cstdlib>
+
+// FRENSIE Includes
+#include "MonteCarlo_IncoherentPhotonScatteringDistributionNativeFactory.hpp"
+#include "MonteCarlo_CoherentScatteringDistributionNativeFactory.hpp"
+#include "MonteCarlo_BremsstrahlungElectronScatteringDistributionNativeFactory.hpp"
+#include "Data_ElectronPhotonRelaxationDataContainer.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_OpenMPProperties.hpp"
+
+// Time the sampling of the scattering angle cosine
+template<typename DistributionType>
+double timeSampling( const DistributionType& distribution,
+                     const std::vector<double>& energies,
+                     double& mean_scattering_angle_cosine,
+                     double& trials_per_sample )
+{
+  std::shared_ptr<Utility::Timer> timer =
+    Utility::OpenMPProperties::createTimer();
+
+  // Use the same random number sequence for each sampler
+  Utility::RandomNumberGenerator::initialize( 0ull );
+
+  mean_scattering_angle_cosine = 0.0;
+
+  typename DistributionType::Counter trials = 0;
+
+  timer->start();
+
+  for( size_t i = 0; i < energies.size(); ++i )
+  {
+    double outgoing_energy, scattering_angle_cosine;
+
+    distribution.sampleAndRecordTrials( energies[i],
+                                        outgoing_energy,
+                                        scattering_angle_cosine,
+                                        trials );
+
+    mean_scattering_angle_cosine += scattering_angle_cosine;
+  }
+
+  timer->stop();
+
+  mean_scattering_angle_cosine /= energies.size();
+  trials_per_sample = (double)trials/energies.size();
+
+  return timer->elapsed().count();
+}
+
+// Print the timing results of a sampler
+template<typename DistributionType>
+void printResults( const std::string& label,
+                   const DistributionType& distribution,
+                   const std::vector<double>& energies,
+                   const double setup_time )
+{
+  double mean_mu, trials_per_sample;
+
+  const double time = timeSampling( distribution,
+                                    energies,
+                                    mean_mu,
+                                    trials_per_sample );
+
+  std::cout << std::setw(22) << label
+            << std::setw(14) << setup_time
+            << std::setw(16) << energies.size()/time
+            << std::setw(16) << trials_per_sample
+            << std::setw(14) << mean_mu << std::endl;
+}
+
+// Main timing function
+int main( int argc, char** argv )
+{
+  if( argc < 2 )
+  {
+    std::cerr << "Usage: " << argv[0] << " native_epr_file "
+              << "[table_tolerance] [samples]" << std::endl;
+
+    return 1;
+  }
+
+  double table_tol = 1e-3;
+
+  if( argc > 2 )
+    table_tol = std::atof( argv[2] );
+
+  size_t samples = 1000000;
+
+  if( argc > 3 )
+    samples = std::strtoull( argv[3], NULL, 10 );
+
+  Data::ElectronPhotonRelaxationDataContainer data_container( argv[1] );
+
+  std::cout << "Native file: " << argv[1] << "\n"
+            << "Table tolerance: " << table_tol << "\n"
+            << "Samples: " << samples << "\n" << std::endl;
+
+  // Pregenerate the incoming energies (log uniform) so that only the
+  // sampling is timed
+  const double min_energy = 1e-3;
+  const double max_energy = 20.0;
+
+  std::mt19937_64 generator( 1 );
+  std::uniform_real_distribution<double> uniform( 0.0, 1.0 );
+
+  std::vector<double> energies( samples );
+
+  for( size_t i = 0; i < samples; ++i )
+  {
+    energies[i] = min_energy*std::pow( max_energy/min_energy,
+                                       uniform( generator ) );
+  }
+
+  Utility::RandomNumberGenerator::createStreams();
+
+  std::shared_ptr<Utility::Timer> timer =
+    Utility::OpenMPProperties::createTimer();
+
+  // Create the rejection and table samplers
+  std::shared_ptr<const MonteCarlo::IncoherentPhotonScatteringDistribution>
+    incoherent_rejection, incoherent_table;
+
+  MonteCarlo::IncoherentPhotonScatteringDistributionNativeFactory::createDistribution(
+                                               data_container,
+                                               incoherent_rejection,
+                                               MonteCarlo::WH_INCOHERENT_MODEL,
+                                               3.0 );
+
+  timer->start();
+
+  MonteCarlo::IncoherentPhotonScatteringDistributionNativeFactory::createDistribution(
+                                               data_container,
+                                               incoherent_table,
+                                               MonteCarlo::WH_INCOHERENT_MODEL,
+                                               3.0,
+                                               0u,
+                                               table_tol );
+
+  timer->stop();
+
+  const double incoherent_setup_time = timer->elapsed().count();
+
+  std::shared_ptr<const MonteCarlo::CoherentScatteringDistribution>
+    coherent_rejection, coherent_table;
+
+  MonteCarlo::CoherentScatteringDistributionNativeFactory::createEfficientCoherentDistribution(
+                                                          data_container,
+                                                          coherent_rejection );
+
+  timer->start();
+
+  MonteCarlo::CoherentScatteringDistributionNativeFactory::createEfficientCoherentDistribution(
+                                                          data_container,
+                                                          coherent_table,
+                                                          table_tol );
+
+  timer->stop();
+
+  const double coherent_setup_time = timer->elapsed().count();
+
+  std::shared_ptr<const MonteCarlo::BremsstrahlungElectronScatteringDistribution>
+    bremsstrahlung_rejection, bremsstrahlung_table;
+
+  timer->start();
+
+  MonteCarlo::BremsstrahlungElectronScatteringDistributionNativeFactory::createBremsstrahlungDistribution(
+                                        data_container,
+                                        data_container.getAtomicNumber(),
+                                        bremsstrahlung_rejection );
+
+  timer->stop();
+
+  const double bremsstrahlung_rejection_setup_time = timer->elapsed().count();
+
+  timer->start();
+
+  MonteCarlo::BremsstrahlungElectronScatteringDistributionNativeFactory::createBremsstrahlungDistribution(
+                                        data_container,
+                                        data_container.getAtomicNumber(),
+                                        bremsstrahlung_table,
+                                        1e-7,
+                                        500,
+                                        0.0,
+                                        table_tol );
+
+  timer->stop();
+
+  // Both samplers create the energy loss function - only report the
+  // additional time needed to create the 2BS angle table
+  const double bremsstrahlung_setup_time =
+    timer->elapsed().count() - bremsstrahlung_rejection_setup_time;
+
+  std::cout << std::setw(22) << "sampler"
+            << std::setw(14) << "setup (s)"
+            << std::setw(16) << "samples/s"
+            << std::setw(16) << "trials/sample"
+            << std::setw(14) << "mean mu" << std::endl;
+
+  printResults( "incoherent rejection", *incoherent_rejection, energies, 0.0 );
+  printResults( "incoherent table",
+                *incoherent_table,
+                energies,
+                incoherent_setup_time );
+
+  printResults( "coherent rejection", *coherent_rejection, energies, 0.0 );
+  printResults( "coherent table",
+                *coherent_table,
+                energies,
+                coherent_setup_time );
+
+  printResults( "2BS rejection", *bremsstrahlung_rejection, energies, 0.0 );
+  printResults( "2BS table",
+                *bremsstrahlung_table,
+                energies,
+                bremsstrahlung_setup_time );
+
+  return 0;
+}
+
+//---------------------------------------------------------------------------//
+// end photon_angle_table_timer.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,282 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   point_detector_timer.cpp
+//! \author Alex Robinson
+//! \brief  Main function for comparing the figure of merit of the point
+//!         detector flux estimator with the cell flux estimators
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <memory>
+#include <cmath>
+#include <cstdlib>
+
+// Boost Includes
+#include <boost/filesystem.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleSimulationManagerFactory.hpp"
+#include "MonteCarlo_StandardParticleSource.hpp"
+#include "MonteCarlo_StandardParticleSourceComponent.hpp"
+#include "MonteCarlo_StandardParticleDistribution.hpp"
+#include "MonteCarlo_PointDetectorFluxEstimator.hpp"
+#include "MonteCarlo_CellCollisionFluxEstimator.hpp"
+#include "MonteCarlo_CellTrackLengthFluxEstimator.hpp"
+#include "Data_ScatteringCenterPropertiesDatabase.hpp"
+#include "Geometry_InfiniteMediumModel.hpp"
+#include "Utility_OpenMPProperties.hpp"
+
+using boost::units::cgs::cubic_centimeter;
+
+// Create the filled infinite medium model
+std::shared_ptr<const MonteCarlo::FilledGeometryModel> createModel(
+        const boost::filesystem::path& database_path,
+        const unsigned zaid,
+        const double atom_density,
+        const std::shared_ptr<const MonteCarlo::SimulationProperties>&
+        properties,
+        std::shared_ptr<const Geometry::Model>& unfilled_model )
+{
+  const Data::ScatteringCenterPropertiesDatabase database( database_path );
+
+  const Data::AtomProperties& atom_properties =
+    database.getAtomProperties( zaid );
+
+  std::shared_ptr<MonteCarlo::ScatteringCenterDefinitionDatabase>
+    scattering_center_definition_database(
+                          new MonteCarlo::ScatteringCenterDefinitionDatabase );
+
+  MonteCarlo::ScatteringCenterDefinition& definition =
+    scattering_center_definition_database->createDefinition( "atom", zaid );
+
+  definition.setPhotoatomicDataProperties(
+          atom_properties.getSharedPhotoatomicDataProperties(
+                       Data::PhotoatomicDataProperties::Native_EPR_FILE, 0 ) );
+
+  std::shared_ptr<MonteCarlo::MaterialDefinitionDatabase>
+    material_definition_database( new MonteCarlo::MaterialDefinitionDatabase );
+
+  material_definition_database->addDefinition( "atom", 1, {"atom"}, {1.0} );
+
+  unfilled_model.reset( new Geometry::InfiniteMediumModel(
+                                          1, 1, atom_density/cubic_centimeter ) );
+
+  return std::shared_ptr<const MonteCarlo::FilledGeometryModel>(
+                        new MonteCarlo::FilledGeometryModel(
+                                         database_path,
+                                         scattering_center_definition_database,
+                                         material_definition_database,
+                                         properties,
+                                         unfilled_model,
+                                         false ) );
+}
+
+// Time a photon simulation with the estimators
+double timeSimulation(
+    const std::shared_ptr<const MonteCarlo::FilledGeometryModel>& model,
+    const std::shared_ptr<const Geometry::Model>& unfilled_model,
+    const std::shared_ptr<const MonteCarlo::SimulationProperties>& properties,
+    const std::shared_ptr<MonteCarlo::EventHandler>& event_handler,
+    const std::string& simulation_name )
+{
+  // Point source at the origin (1 MeV isotropic photons)
+  std::shared_ptr<const MonteCarlo::ParticleDistribution>
+    particle_distribution(
+                  new MonteCarlo::StandardParticleDistribution( "source" ) );
+
+  std::shared_ptr<MonteCarlo::ParticleSourceComponent>
+    source_component( new MonteCarlo::StandardPhotonSourceComponent(
+                                                     0,
+                                                     1.0,
+                                                     unfilled_model,
+                                                     particle_distribution ) );
+
+  std::shared_ptr<MonteCarlo::ParticleSource>
+    source( new MonteCarlo::StandardParticleSource( {source_component} ) );
+
+  MonteCarlo::ParticleSimulationManagerFactory factory( model,
+                                                        source,
+                                                        event_handler,
+                                                        properties,
+                                                        simulation_name );
+
+  std::shared_ptr<MonteCarlo::ParticleSimulationManager> manager =
+    factory.getManager();
+
+  std::shared_ptr<Utility::Timer> timer =
+    Utility::OpenMPProperties::createTimer();
+
+  timer->start();
+
+  manager->runSimulation();
+
+  timer->stop();
+
+  return timer->elapsed().count();
+}
+
+// Print the figure of merit of an estimator
+void printFigureOfMerit( const std::string& name,
+                         const MonteCarlo::Estimator& estimator,
+                         const double histories,
+                         const double time )
+{
+  const double first_moment = estimator.getTotalBinDataFirstMoments()[0];
+  const double second_moment = estimator.getTotalBinDataSecondMoments()[0];
+
+  const double mean = first_moment/histories;
+
+  const double mean_variance =
+    (second_moment/histories - mean*mean)/(histories - 1.0);
+
+  const double relative_error_squared = mean_variance/(mean*mean);
+
+  std::cout << std::setw(20) << name
+            << std::setw(18) << mean
+            << std::setw(18) << std::sqrt( relative_error_squared )
+            << std::setw(18) << time
+            << std::setw(18) << 1.0/(relative_error_squared*time)
+            << std::endl;
+}
+
+// Main timing function
+int main( int argc, char** argv )
+{
+  if( argc < 3 )
+  {
+    std::cerr << "Usage: " << argv[0] << " database_path atom_zaid "
+              << "[histories] [atom_density (1/cm^3)] "
+              << "[detector_distance (cm)]" << std::endl;
+
+    return 1;
+  }
+
+  uint64_t histories = 100000;
+
+  if( argc > 3 )
+    histories = std::strtoull( argv[3], NULL, 10 );
+
+  double atom_density = 1e23;
+
+  if( argc > 4 )
+    atom_density = std::atof( argv[4] );
+
+  double detector_distance = 10.0;
+
+  if( argc > 5 )
+    detector_distance = std::atof( argv[5] );
+
+  std::shared_ptr<MonteCarlo::SimulationProperties> properties(
+                                        new MonteCarlo::SimulationProperties );
+  properties->setParticleMode( MonteCarlo::PHOTON_MODE );
+  properties->setNumberOfHistories( histories );
+
+  std::shared_ptr<const Geometry::Model> unfilled_model;
+
+  std::shared_ptr<const MonteCarlo::FilledGeometryModel> model =
+    createModel( argv[1],
+                 std::atoi( argv[2] ),
+                 atom_density,
+                 properties,
+                 unfilled_model );
+
+  std::cout << "Atom: " << argv[2] << "\n"
+            << "Atom density (1/cm^3): " << atom_density << "\n"
+            << "Detector distance (cm): " << detector_distance << "\n"
+            << "Histories: " << histories << "\n" << std::endl;
+
+  const std::vector<MonteCarlo::ParticleType> particle_types( {MonteCarlo::PHOTON} );
+
+  // The cell estimators score the flux in the infinite medium cell (unit
+  // volume) - they are run together since they share the same tracks
+  std::shared_ptr<MonteCarlo::WeightMultipliedCellCollisionFluxEstimator>
+    collision_estimator(
+                new MonteCarlo::WeightMultipliedCellCollisionFluxEstimator(
+                                       0,
+                                       1.0,
+                                       std::vector<Geometry::Model::EntityId>( {1} ),
+                                       std::vector<double>( {1.0} ) ) );
+
+  collision_estimator->setParticleTypes( particle_types );
+
+  std::shared_ptr<MonteCarlo::WeightMultipliedCellTrackLengthFluxEstimator>
+    track_length_estimator(
+              new MonteCarlo::WeightMultipliedCellTrackLengthFluxEstimator(
+                                       1,
+                                       1.0,
+                                       std::vector<Geometry::Model::EntityId>( {1} ),
+                                       std::vector<double>( {1.0} ) ) );
+
+  track_length_estimator->setParticleTypes( particle_types );
+
+  std::shared_ptr<MonteCarlo::EventHandler> event_handler(
+                                 new MonteCarlo::EventHandler( *properties ) );
+
+  event_handler->addEstimator( collision_estimator );
+  event_handler->addEstimator( track_length_estimator );
+
+  double cell_time = timeSimulation( model,
+                                     unfilled_model,
+                                     properties,
+                                     event_handler,
+                                     "point_detector_timer_cell" );
+
+  // The point detector scores the flux at a single point
+  std::vector<std::array<double,3> > detector_positions( 1 );
+  detector_positions[0] = {0.0, 0.0, detector_distance};
+
+  std::shared_ptr<MonteCarlo::WeightMultipliedPointDetectorFluxEstimator>
+    point_detector_estimator(
+                new MonteCarlo::WeightMultipliedPointDetectorFluxEstimator(
+                                 2,
+                                 1.0,
+                                 std::vector<MonteCarlo::Estimator::EntityId>( {0} ),
+                                 detector_positions,
+                                 model ) );
+
+  point_detector_estimator->setParticleTypes( particle_types );
+
+  event_handler.reset( new MonteCarlo::EventHandler( *properties ) );
+
+  event_handler->addEstimator( point_detector_estimator );
+
+  double point_detector_time = timeSimulation( model,
+                                               unfilled_model,
+                                               properties,
+                                               event_handler,
+                                               "point_detector_timer_point" );
+
+  std::cout << std::setw(20) << "estimator"
+            << std::setw(18) << "mean"
+            << std::setw(18) << "rel. error"
+            << std::setw(18) << "time (s)"
+            << std::setw(18) << "fom" << std::endl;
+
+  printFigureOfMerit( "cell collision",
+                      *collision_estimator,
+                      histories,
+                      cell_time );
+
+  printFigureOfMerit( "cell track length",
+                      *track_length_estimator,
+                      histories,
+                      cell_time );
+
+  printFigureOfMerit( "point detector",
+                      *point_detector_estimator,
+                      histories,
+                      point_detector_time );
+
+  std::cout << "\nPoint detector run time relative to the cell estimators: "
+            << point_detector_time/cell_time << std::endl;
+
+  return 0;
+}
+
+//---------------------------------------------------------------------------//
+// end point_detector_timer.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,160 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   relaxation_cascade_timer.cpp
+//! \author Alex Robinson
+//! \brief  Main function for timing the atomic relaxation cascades of
+//!         high-Z atoms (e.g. Pb, W and U)
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <iomanip>
+#include <memory>
+#include <cstdlib>
+
+// FRENSIE Includes
+#include "MonteCarlo_AtomicRelaxationModelFactory.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+#include "MonteCarlo_ParticleBank.hpp"
+#include "MonteCarlo_SimulationPhotonProperties.hpp"
+#include "MonteCarlo_SimulationElectronProperties.hpp"
+#include "Data_ElectronPhotonRelaxationDataContainer.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_OpenMPProperties.hpp"
+
+// Time the relaxation cascades that follow a vacancy in a subshell
+/*! \details The emitted particles are removed from the bank after every
+ * cascade (as is done when the particles are transported) so that the
+ * bank does not grow during the timing.
+ */
+double timeCascades( const MonteCarlo::AtomicRelaxationModel& model,
+                     const Data::SubshellType vacancy_shell,
+                     const size_t cascades,
+                     double& mean_photons,
+                     double& mean_electrons )
+{
+  std::shared_ptr<Utility::Timer> timer =
+    Utility::OpenMPProperties::createTimer();
+
+  // Use the same random number sequence for each atom
+  Utility::RandomNumberGenerator::initialize( 0ull );
+
+  size_t photons = 0;
+  size_t electrons = 0;
+
+  MonteCarlo::ParticleBank bank;
+
+  timer->start();
+
+  for( size_t i = 0; i < cascades; ++i )
+  {
+    MonteCarlo::PhotonState photon( i );
+    photon.setEnergy( 1.0 );
+    photon.setDirection( 0.0, 0.0, 1.0 );
+
+    model.relaxAtom( vacancy_shell, photon, bank );
+
+    while( !bank.isEmpty() )
+    {
+      if( bank.top().getParticleType() == MonteCarlo::PHOTON )
+        ++photons;
+      else
+        ++electrons;
+
+      bank.pop();
+    }
+  }
+
+  timer->stop();
+
+  mean_photons = photons/(double)cascades;
+  mean_electrons = electrons/(double)cascades;
+
+  return timer->elapsed().count();
+}
+
+// Main timing function
+int main( int argc, char** argv )
+{
+  if( argc < 3 )
+  {
+    std::cerr << "Usage: " << argv[0] << " cascades epr_file "
+              << "[epr_file ...]" << std::endl;
+
+    return 1;
+  }
+
+  const size_t cascades = std::strtoull( argv[1], NULL, 10 );
+
+  // Use the lowest cutoffs so that every particle in the cascade is
+  // followed (this is the most expensive case)
+  const double min_photon_energy =
+    MonteCarlo::SimulationPhotonProperties::getAbsoluteMinPhotonEnergy();
+
+  const double min_electron_energy =
+    MonteCarlo::SimulationElectronProperties::getAbsoluteMinElectronEnergy();
+
+  std::cout << "Cascades: " << cascades << "\n"
+            << "Min photon energy (MeV): " << min_photon_energy << "\n"
+            << "Min electron energy (MeV): " << min_electron_energy << "\n"
+            << std::endl;
+
+  Utility::RandomNumberGenerator::createStreams();
+
+  std::cout << std::setw(8) << "Z"
+            << std::setw(10) << "vacancy"
+            << std::setw(18) << "time (s)"
+            << std::setw(18) << "cascades/s"
+            << std::setw(18) << "photons/cascade"
+            << std::setw(18) << "electrons/cascade" << std::endl;
+
+  for( int i = 2; i < argc; ++i )
+  {
+    const Data::ElectronPhotonRelaxationDataContainer data( argv[i] );
+
+    if( !data.hasRelaxationData() )
+    {
+      std::cerr << "File " << argv[i] << " does not have relaxation data!"
+                << std::endl;
+
+      return 1;
+    }
+
+    std::shared_ptr<const MonteCarlo::AtomicRelaxationModel> model;
+
+    MonteCarlo::AtomicRelaxationModelFactory::createAtomicRelaxationModel(
+                                                         data,
+                                                         model,
+                                                         min_photon_energy,
+                                                         min_electron_energy,
+                                                         true );
+
+    // A K shell vacancy (e.g. from a photoelectric absorption above the
+    // K edge) gives the longest cascades. An L3 vacancy gives the most
+    // common cascades.
+    for( auto&& vacancy_shell : {Data::K_SUBSHELL, Data::L3_SUBSHELL} )
+    {
+      double mean_photons, mean_electrons;
+
+      double time = timeCascades( *model,
+                                  vacancy_shell,
+                                  cascades,
+                                  mean_photons,
+                                  mean_electrons );
+
+      std::cout << std::setw(8) << data.getAtomicNumber()
+                << std::setw(10) << vacancy_shell
+                << std::setw(18) << time
+                << std::setw(18) << cascades/time
+                << std::setw(18) << mean_photons
+                << std::setw(18) << mean_electrons << std::endl;
+    }
+  }
+
+  return 0;
+}
+
+//---------------------------------------------------------------------------//
+// end relaxation_cascade_timer.cpp
+//---------------------------------------------------------------------------//
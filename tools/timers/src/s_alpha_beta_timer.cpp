@@ -0,0 +1,268 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   s_alpha_beta_timer.cpp
+//! \author Alex Robinson
+//! \brief  Main function for timing thermal neutron collisions with the
+//!         free gas model (target velocity rejection sampling) and with
+//!         S(alpha,beta) thermal scattering data
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <memory>
+#include <random>
+#include <cmath>
+#include <cstdlib>
+
+// FRENSIE Includes
+#include "MonteCarlo_NuclideACEFactory.hpp"
+#include "MonteCarlo_SAlphaBetaACEFactory.hpp"
+#include "MonteCarlo_NeutronState.hpp"
+#include "MonteCarlo_ParticleBank.hpp"
+#include "MonteCarlo_SimulationProperties.hpp"
+#include "Data_ACEFileHandler.hpp"
+#include "Data_XSSNeutronDataExtractor.hpp"
+#include "Data_XSSSabDataExtractor.hpp"
+#include "Data_ZAID.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_OpenMPProperties.hpp"
+
+// Create the nuclide (free gas if the S(alpha,beta) data is null)
+std::shared_ptr<const MonteCarlo::Nuclide> createNuclide(
+        const Data::ACEFileHandler& ace_file_handler,
+        const MonteCarlo::SimulationProperties& properties,
+        const std::shared_ptr<const MonteCarlo::SAlphaBeta>& s_alpha_beta )
+{
+  Data::XSSNeutronDataExtractor xss_data_extractor(
+                                       ace_file_handler.getTableNXSArray(),
+                                       ace_file_handler.getTableJXSArray(),
+                                       ace_file_handler.getTableXSSArray() );
+
+  const std::string& table_name = ace_file_handler.getTableName();
+
+  const Data::ZAID zaid( table_name.substr( 0, table_name.find( '.' ) ) );
+
+  std::shared_ptr<const MonteCarlo::Nuclide> nuclide;
+
+  MonteCarlo::NuclideACEFactory::createNuclide(
+                      xss_data_extractor,
+                      table_name,
+                      zaid.atomicNumber(),
+                      zaid.atomicMassNumber(),
+                      zaid.isomerNumber(),
+                      ace_file_handler.getTableAtomicWeightRatio(),
+                      ace_file_handler.getTableTemperature().value(),
+                      properties,
+                      s_alpha_beta,
+                      nuclide );
+
+  return nuclide;
+}
+
+// Time the total cross section evaluations
+double timeCrossSectionEvaluations( const MonteCarlo::Nuclide& nuclide,
+                                    const std::vector<double>& energies,
+                                    double& cross_section_sum )
+{
+  std::shared_ptr<Utility::Timer> timer =
+    Utility::OpenMPProperties::createTimer();
+
+  cross_section_sum = 0.0;
+
+  timer->start();
+
+  for( size_t i = 0; i < energies.size(); ++i )
+    cross_section_sum += nuclide.getTotalCrossSection( energies[i] );
+
+  timer->stop();
+
+  return timer->elapsed().count();
+}
+
+// Time the analogue collisions
+double timeCollisions( const MonteCarlo::Nuclide& nuclide,
+                       const std::vector<double>& energies,
+                       double& mean_outgoing_energy,
+                       double& mean_scattering_angle_cosine )
+{
+  std::shared_ptr<Utility::Timer> timer =
+    Utility::OpenMPProperties::createTimer();
+
+  // Use the same random number sequence for each nuclide
+  Utility::RandomNumberGenerator::initialize( 0ull );
+
+  mean_outgoing_energy = 0.0;
+  mean_scattering_angle_cosine = 0.0;
+
+  size_t scattering_events = 0;
+
+  MonteCarlo::ParticleBank bank;
+
+  timer->start();
+
+  for( size_t i = 0; i < energies.size(); ++i )
+  {
+    MonteCarlo::NeutronState neutron( i );
+    neutron.setEnergy( energies[i] );
+    neutron.setDirection( 0.0, 0.0, 1.0 );
+
+    nuclide.collideAnalogue( neutron, bank );
+
+    if( !neutron.isGone() )
+    {
+      mean_outgoing_energy += neutron.getEnergy();
+      mean_scattering_angle_cosine += neutron.getZDirection();
+
+      ++scattering_events;
+    }
+
+    // Discard any secondaries
+    while( !bank.isEmpty() )
+      bank.pop();
+  }
+
+  timer->stop();
+
+  if( scattering_events > 0 )
+  {
+    mean_outgoing_energy /= scattering_events;
+    mean_scattering_angle_cosine /= scattering_events;
+  }
+
+  return timer->elapsed().count();
+}
+
+// Main timing function
+int main( int argc, char** argv )
+{
+  if( argc < 7 )
+  {
+    std::cerr << "Usage: " << argv[0] << " nuclide_ace_file nuclide_table "
+              << "nuclide_start_line sab_ace_file sab_table sab_start_line "
+              << "[samples]" << std::endl;
+
+    return 1;
+  }
+
+  size_t samples = 1000000;
+
+  if( argc > 7 )
+    samples = std::strtoull( argv[7], NULL, 10 );
+
+  Data::ACEFileHandler nuclide_ace_file_handler( argv[1],
+                                                 argv[2],
+                                                 std::atoi( argv[3] ),
+                                                 true );
+
+  Data::ACEFileHandler sab_ace_file_handler( argv[4],
+                                             argv[5],
+                                             std::atoi( argv[6] ),
+                                             true );
+
+  MonteCarlo::SimulationProperties properties;
+
+  // Create the S(alpha,beta) data
+  Data::XSSSabDataExtractor xss_sab_data_extractor(
+                                   sab_ace_file_handler.getTableNXSArray(),
+                                   sab_ace_file_handler.getTableJXSArray(),
+                                   sab_ace_file_handler.getTableXSSArray() );
+
+  std::shared_ptr<const MonteCarlo::SAlphaBeta> s_alpha_beta;
+
+  MonteCarlo::SAlphaBetaACEFactory::createSAlphaBeta(
+                          xss_sab_data_extractor,
+                          nuclide_ace_file_handler.getTableAtomicWeightRatio(),
+                          properties,
+                          s_alpha_beta );
+
+  std::shared_ptr<const MonteCarlo::Nuclide> free_gas_nuclide =
+    createNuclide( nuclide_ace_file_handler,
+                   properties,
+                   std::shared_ptr<const MonteCarlo::SAlphaBeta>() );
+
+  std::shared_ptr<const MonteCarlo::Nuclide> s_alpha_beta_nuclide =
+    createNuclide( nuclide_ace_file_handler, properties, s_alpha_beta );
+
+  std::cout << "Nuclide table: " << argv[2] << "\n"
+            << "S(alpha,beta) table: " << argv[5] << "\n"
+            << "S(alpha,beta) upper energy limit (MeV): "
+            << s_alpha_beta->getUpperEnergyLimit() << "\n"
+            << "Samples: " << samples << "\n" << std::endl;
+
+  // Pregenerate the incoming energies (log uniform over the thermal range)
+  // so that only the cross section evaluations and collisions are timed
+  const double min_energy = 1e-11;
+  const double max_energy = s_alpha_beta->getUpperEnergyLimit();
+
+  std::mt19937_64 generator( 1 );
+  std::uniform_real_distribution<double> uniform( 0.0, 1.0 );
+
+  std::vector<double> energies( samples );
+
+  for( size_t i = 0; i < samples; ++i )
+  {
+    energies[i] = min_energy*std::pow( max_energy/min_energy,
+                                       uniform( generator ) );
+  }
+
+  Utility::RandomNumberGenerator::createStreams();
+
+  std::cout << std::setw(16) << "model"
+            << std::setw(18) << "xs evals/s"
+            << std::setw(18) << "collisions/s"
+            << std::setw(18) << "mean sigma_t (b)"
+            << std::setw(18) << "mean E' (MeV)"
+            << std::setw(14) << "mean mu" << std::endl;
+
+  double free_gas_xs_sum, free_gas_energy, free_gas_mu;
+
+  double free_gas_xs_time = timeCrossSectionEvaluations( *free_gas_nuclide,
+                                                         energies,
+                                                         free_gas_xs_sum );
+
+  double free_gas_collision_time = timeCollisions( *free_gas_nuclide,
+                                                   energies,
+                                                   free_gas_energy,
+                                                   free_gas_mu );
+
+  std::cout << std::setw(16) << "free gas"
+            << std::setw(18) << samples/free_gas_xs_time
+            << std::setw(18) << samples/free_gas_collision_time
+            << std::setw(18) << free_gas_xs_sum/samples
+            << std::setw(18) << free_gas_energy
+            << std::setw(14) << free_gas_mu << std::endl;
+
+  double sab_xs_sum, sab_energy, sab_mu;
+
+  double sab_xs_time = timeCrossSectionEvaluations( *s_alpha_beta_nuclide,
+                                                    energies,
+                                                    sab_xs_sum );
+
+  double sab_collision_time = timeCollisions( *s_alpha_beta_nuclide,
+                                              energies,
+                                              sab_energy,
+                                              sab_mu );
+
+  std::cout << std::setw(16) << "S(alpha,beta)"
+            << std::setw(18) << samples/sab_xs_time
+            << std::setw(18) << samples/sab_collision_time
+            << std::setw(18) << sab_xs_sum/samples
+            << std::setw(18) << sab_energy
+            << std::setw(14) << sab_mu << std::endl;
+
+  // The free gas collisions sample the target velocity with rejection
+  // sampling while the S(alpha,beta) collisions use a fixed number of
+  // random numbers
+  std::cout << "\nS(alpha,beta) collision time relative to free gas "
+            << "(target velocity rejection sampling): "
+            << sab_collision_time/free_gas_collision_time << std::endl;
+
+  return 0;
+}
+
+//---------------------------------------------------------------------------//
+// end s_alpha_beta_timer.cpp
+//---------------------------------------------------------------------------//
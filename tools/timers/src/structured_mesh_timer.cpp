@@ -0,0 +1,222 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   structured_mesh_timer.cpp
+//! \author Alex Robinson
+//! \brief  Main function for timing point location and track length
+//!         calculations with the structured hex, cylindrical and spherical
+//!         meshes
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <array>
+#include <memory>
+#include <random>
+#include <cmath>
+#include <cstdlib>
+
+// FRENSIE Includes
+#include "Utility_StructuredHexMesh.hpp"
+#include "Utility_StructuredCylindricalMesh.hpp"
+#include "Utility_StructuredSphericalMesh.hpp"
+#include "Utility_PhysicalConstants.hpp"
+#include "Utility_OpenMPProperties.hpp"
+
+// Create evenly spaced surfaces
+std::vector<double> createSurfaces( const double min_value,
+                                    const double max_value,
+                                    const size_t bins )
+{
+  std::vector<double> surfaces( bins+1 );
+
+  for( size_t i = 0; i <= bins; ++i )
+    surfaces[i] = min_value + (max_value - min_value)*i/bins;
+
+  // Remove roundoff error from the last surface
+  surfaces.back() = max_value;
+
+  return surfaces;
+}
+
+// Time the point location
+double timePointLocation( const Utility::Mesh& mesh,
+                          const std::vector<std::array<double,3> >& points,
+                          size_t& element_sum )
+{
+  std::shared_ptr<Utility::Timer> timer =
+    Utility::OpenMPProperties::createTimer();
+
+  element_sum = 0;
+
+  timer->start();
+
+  for( size_t i = 0; i < points.size(); ++i )
+    element_sum += mesh.whichElementIsPointIn( points[i].data() );
+
+  timer->stop();
+
+  return timer->elapsed().count();
+}
+
+// Time the track length calculations
+double timeTrackLengths( const Utility::Mesh& mesh,
+                         const std::vector<std::array<double,3> >& start_points,
+                         const std::vector<std::array<double,3> >& end_points,
+                         double& mean_elements_crossed,
+                         double& mean_track_length )
+{
+  std::shared_ptr<Utility::Timer> timer =
+    Utility::OpenMPProperties::createTimer();
+
+  Utility::Mesh::ElementHandleTrackLengthArray element_track_lengths;
+
+  mean_elements_crossed = 0.0;
+  mean_track_length = 0.0;
+
+  timer->start();
+
+  for( size_t i = 0; i < start_points.size(); ++i )
+  {
+    element_track_lengths.clear();
+
+    mesh.computeTrackLengths( start_points[i].data(),
+                              end_points[i].data(),
+                              element_track_lengths );
+
+    mean_elements_crossed += element_track_lengths.size();
+
+    for( size_t j = 0; j < element_track_lengths.size(); ++j )
+      mean_track_length += std::get<2>( element_track_lengths[j] );
+  }
+
+  timer->stop();
+
+  mean_elements_crossed /= start_points.size();
+  mean_track_length /= start_points.size();
+
+  return timer->elapsed().count();
+}
+
+// Time a mesh and print the results
+void timeMesh( const std::string& name,
+               const Utility::Mesh& mesh,
+               const std::vector<std::array<double,3> >& start_points,
+               const std::vector<std::array<double,3> >& end_points )
+{
+  size_t element_sum;
+
+  double point_time = timePointLocation( mesh, start_points, element_sum );
+
+  double mean_elements_crossed, mean_track_length;
+
+  double track_time = timeTrackLengths( mesh,
+                                        start_points,
+                                        end_points,
+                                        mean_elements_crossed,
+                                        mean_track_length );
+
+  std::cout << std::setw(14) << name
+            << std::setw(12) << mesh.getNumberOfElements()
+            << std::setw(18) << start_points.size()/point_time
+            << std::setw(18) << start_points.size()/track_time
+            << std::setw(18) << start_points.size()*mean_elements_crossed/
+                                track_time
+            << std::setw(16) << mean_elements_crossed
+            << std::setw(16) << mean_track_length << std::endl;
+}
+
+// Main timing function
+int main( int argc, char** argv )
+{
+  size_t bins = 20;
+
+  if( argc > 1 )
+    bins = std::strtoull( argv[1], NULL, 10 );
+
+  size_t samples = 1000000;
+
+  if( argc > 2 )
+    samples = std::strtoull( argv[2], NULL, 10 );
+
+  double mean_track_length = 2.0;
+
+  if( argc > 3 )
+    mean_track_length = std::atof( argv[3] );
+
+  // Every mesh has bins^3 elements and contains the sphere of radius 10
+  const double radius = 10.0;
+  const double two_pi = 2*Utility::PhysicalConstants::pi;
+
+  Utility::StructuredHexMesh
+    hex_mesh( createSurfaces( -radius, radius, bins ),
+              createSurfaces( -radius, radius, bins ),
+              createSurfaces( -radius, radius, bins ) );
+
+  Utility::StructuredCylindricalMesh
+    cylindrical_mesh( createSurfaces( 0.0, radius, bins ),
+                      createSurfaces( 0.0, two_pi, bins ),
+                      createSurfaces( -radius, radius, bins ) );
+
+  Utility::StructuredSphericalMesh
+    spherical_mesh( createSurfaces( 0.0, radius, bins ),
+                    createSurfaces( 0.0, two_pi, bins ),
+                    createSurfaces( -1.0, 1.0, bins ) );
+
+  std::cout << "Bins per dimension: " << bins << "\n"
+            << "Samples: " << samples << "\n"
+            << "Mean track length (cm): " << mean_track_length << "\n"
+            << std::endl;
+
+  // Pregenerate the tracks (start points uniform in the sphere, isotropic
+  // directions, exponential lengths) so that only the mesh is timed
+  std::mt19937_64 generator( 1 );
+  std::uniform_real_distribution<double> uniform( 0.0, 1.0 );
+
+  std::vector<std::array<double,3> > start_points( samples );
+  std::vector<std::array<double,3> > end_points( samples );
+
+  for( size_t i = 0; i < samples; ++i )
+  {
+    const double r = radius*std::cbrt( uniform( generator ) );
+    const double mu = 2.0*uniform( generator ) - 1.0;
+    const double phi = two_pi*uniform( generator );
+
+    start_points[i] = {r*std::sqrt( 1.0 - mu*mu )*std::cos( phi ),
+                       r*std::sqrt( 1.0 - mu*mu )*std::sin( phi ),
+                       r*mu};
+
+    const double direction_mu = 2.0*uniform( generator ) - 1.0;
+    const double direction_phi = two_pi*uniform( generator );
+    const double length =
+      -mean_track_length*std::log( 1.0 - uniform( generator ) );
+
+    end_points[i] = {start_points[i][0] +
+                     length*std::sqrt( 1.0 - direction_mu*direction_mu )*
+                     std::cos( direction_phi ),
+                     start_points[i][1] +
+                     length*std::sqrt( 1.0 - direction_mu*direction_mu )*
+                     std::sin( direction_phi ),
+                     start_points[i][2] + length*direction_mu};
+  }
+
+  std::cout << std::setw(14) << "mesh"
+            << std::setw(12) << "elements"
+            << std::setw(18) << "locations/s"
+            << std::setw(18) << "tracks/s"
+            << std::setw(18) << "crossings/s"
+            << std::setw(16) << "crossed/track"
+            << std::setw(16) << "length/track" << std::endl;
+
+  timeMesh( "hex", hex_mesh, start_points, end_points );
+  timeMesh( "cylindrical", cylindrical_mesh, start_points, end_points );
+  timeMesh( "spherical", spherical_mesh, start_points, end_points );
+
+  return 0;
+}
+
+//---------------------------------------------------------------------------//
+// end structured_mesh_timer.cpp
+//---------------------------------------------------------------------------//
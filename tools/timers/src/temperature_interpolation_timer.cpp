@@ -0,0 +1,277 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   temperature_interpolation_timer.cpp
+//! \author Alex Robinson
+//! \brief  Main function for comparing the cost of neutron cross section
+//!         lookups and collisions in a material with a single temperature
+//!         nuclide and with a temperature interpolated nuclide
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <memory>
+#include <random>
+#include <cmath>
+#include <cstdlib>
+
+// FRENSIE Includes
+#include "MonteCarlo_NuclideACEFactory.hpp"
+#include "MonteCarlo_NeutronMaterial.hpp"
+#include "MonteCarlo_NeutronState.hpp"
+#include "MonteCarlo_ParticleBank.hpp"
+#include "MonteCarlo_SimulationProperties.hpp"
+#include "Data_ACEFileHandler.hpp"
+#include "Data_XSSNeutronDataExtractor.hpp"
+#include "Data_ZAID.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_OpenMPProperties.hpp"
+
+// Create the nuclide
+std::shared_ptr<const MonteCarlo::Nuclide> createNuclide(
+                                            const std::string& ace_file,
+                                            const std::string& table_name,
+                                            const size_t table_start_line,
+                                            double& temperature )
+{
+  Data::ACEFileHandler ace_file_handler( ace_file,
+                                         table_name,
+                                         table_start_line,
+                                         true );
+
+  Data::XSSNeutronDataExtractor xss_data_extractor(
+                                       ace_file_handler.getTableNXSArray(),
+                                       ace_file_handler.getTableJXSArray(),
+                                       ace_file_handler.getTableXSSArray() );
+
+  const Data::ZAID zaid( table_name.substr( 0, table_name.find( '.' ) ) );
+
+  temperature = ace_file_handler.getTableTemperature().value();
+
+  MonteCarlo::SimulationProperties properties;
+
+  std::shared_ptr<const MonteCarlo::Nuclide> nuclide;
+
+  MonteCarlo::NuclideACEFactory::createNuclide(
+                      xss_data_extractor,
+                      table_name,
+                      zaid.atomicNumber(),
+                      zaid.atomicMassNumber(),
+                      zaid.isomerNumber(),
+                      ace_file_handler.getTableAtomicWeightRatio(),
+                      temperature,
+                      properties,
+                      nuclide );
+
+  return nuclide;
+}
+
+// Time the macroscopic total cross section evaluations
+double timeCrossSectionEvaluations( const MonteCarlo::NeutronMaterial& material,
+                                    const std::vector<double>& energies,
+                                    double& cross_section_sum )
+{
+  std::shared_ptr<Utility::Timer> timer =
+    Utility::OpenMPProperties::createTimer();
+
+  cross_section_sum = 0.0;
+
+  timer->start();
+
+  for( size_t i = 0; i < energies.size(); ++i )
+    cross_section_sum += material.getMacroscopicTotalCrossSection( energies[i] );
+
+  timer->stop();
+
+  return timer->elapsed().count();
+}
+
+// Time the analogue collisions
+/*! \details The nuclide that is collided with is sampled by the material
+ * (the table that is used with the temperature interpolated nuclide is
+ * sampled with the interpolation fraction).
+ */
+double timeCollisions( const MonteCarlo::NeutronMaterial& material,
+                       const std::vector<double>& energies,
+                       double& mean_outgoing_energy )
+{
+  std::shared_ptr<Utility::Timer> timer =
+    Utility::OpenMPProperties::createTimer();
+
+  // Use the same random number sequence for each material
+  Utility::RandomNumberGenerator::initialize( 0ull );
+
+  mean_outgoing_energy = 0.0;
+
+  size_t scattering_events = 0;
+
+  MonteCarlo::ParticleBank bank;
+
+  timer->start();
+
+  for( size_t i = 0; i < energies.size(); ++i )
+  {
+    MonteCarlo::NeutronState neutron( i );
+    neutron.setEnergy( energies[i] );
+    neutron.setDirection( 0.0, 0.0, 1.0 );
+
+    material.collideAnalogue( neutron, bank );
+
+    if( !neutron.isGone() )
+    {
+      mean_outgoing_energy += neutron.getEnergy();
+
+      ++scattering_events;
+    }
+
+    // Discard any secondaries
+    while( !bank.isEmpty() )
+      bank.pop();
+  }
+
+  timer->stop();
+
+  if( scattering_events > 0 )
+    mean_outgoing_energy /= scattering_events;
+
+  return timer->elapsed().count();
+}
+
+// Main timing function
+int main( int argc, char** argv )
+{
+  if( argc < 7 )
+  {
+    std::cerr << "Usage: " << argv[0] << " lower_ace_file lower_table "
+              << "lower_start_line upper_ace_file upper_table "
+              << "upper_start_line [interp_fraction] [samples]" << std::endl;
+
+    return 1;
+  }
+
+  double interp_fraction = 0.5;
+
+  if( argc > 7 )
+    interp_fraction = std::atof( argv[7] );
+
+  size_t samples = 1000000;
+
+  if( argc > 8 )
+    samples = std::strtoull( argv[8], NULL, 10 );
+
+  if( interp_fraction < 0.0 || interp_fraction > 1.0 )
+  {
+    std::cerr << "The interpolation fraction must be in [0,1]!" << std::endl;
+
+    return 1;
+  }
+
+  double lower_temperature, upper_temperature;
+
+  MonteCarlo::NeutronMaterial::NuclideNameMap nuclide_name_map;
+
+  nuclide_name_map["lower"] = createNuclide( argv[1],
+                                             argv[2],
+                                             std::atoi( argv[3] ),
+                                             lower_temperature );
+
+  nuclide_name_map["upper"] = createNuclide( argv[4],
+                                             argv[5],
+                                             std::atoi( argv[6] ),
+                                             upper_temperature );
+
+  // The temperature interpolated nuclide is replaced by its bracketing
+  // tables in the material (this is done by the filled neutron geometry
+  // model)
+  MonteCarlo::NeutronMaterial single_temperature_material(
+                                             1,
+                                             0.1,
+                                             nuclide_name_map,
+                                             std::vector<double>( {1.0} ),
+                                             {"lower"} );
+
+  MonteCarlo::NeutronMaterial interpolated_material(
+                 2,
+                 0.1,
+                 nuclide_name_map,
+                 std::vector<double>( {1.0-interp_fraction, interp_fraction} ),
+                 {"lower", "upper"} );
+
+  std::cout << "Lower table: " << argv[2] << " (" << lower_temperature
+            << " MeV)\n"
+            << "Upper table: " << argv[5] << " (" << upper_temperature
+            << " MeV)\n"
+            << "Interpolation fraction: " << interp_fraction << "\n"
+            << "Samples: " << samples << "\n" << std::endl;
+
+  // Pregenerate the incoming energies (log uniform) so that only the cross
+  // section evaluations and collisions are timed
+  const double min_energy = 1e-11;
+  const double max_energy = 20.0;
+
+  std::mt19937_64 generator( 1 );
+  std::uniform_real_distribution<double> uniform( 0.0, 1.0 );
+
+  std::vector<double> energies( samples );
+
+  for( size_t i = 0; i < samples; ++i )
+  {
+    energies[i] = min_energy*std::pow( max_energy/min_energy,
+                                       uniform( generator ) );
+  }
+
+  Utility::RandomNumberGenerator::createStreams();
+
+  std::cout << std::setw(20) << "material"
+            << std::setw(18) << "xs evals/s"
+            << std::setw(18) << "collisions/s"
+            << std::setw(18) << "mean Sigma_t"
+            << std::setw(18) << "mean E' (MeV)" << std::endl;
+
+  double single_xs_sum, single_energy;
+
+  double single_xs_time =
+    timeCrossSectionEvaluations( single_temperature_material,
+                                 energies,
+                                 single_xs_sum );
+
+  double single_collision_time = timeCollisions( single_temperature_material,
+                                                 energies,
+                                                 single_energy );
+
+  std::cout << std::setw(20) << "single temperature"
+            << std::setw(18) << samples/single_xs_time
+            << std::setw(18) << samples/single_collision_time
+            << std::setw(18) << single_xs_sum/samples
+            << std::setw(18) << single_energy << std::endl;
+
+  double interp_xs_sum, interp_energy;
+
+  double interp_xs_time = timeCrossSectionEvaluations( interpolated_material,
+                                                       energies,
+                                                       interp_xs_sum );
+
+  double interp_collision_time = timeCollisions( interpolated_material,
+                                                 energies,
+                                                 interp_energy );
+
+  std::cout << std::setw(20) << "interpolated"
+            << std::setw(18) << samples/interp_xs_time
+            << std::setw(18) << samples/interp_collision_time
+            << std::setw(18) << interp_xs_sum/samples
+            << std::setw(18) << interp_energy << std::endl;
+
+  std::cout << "\nInterpolated lookup time relative to single temperature: "
+            << interp_xs_time/single_xs_time
+            << "\nInterpolated collision time relative to single "
+            << "temperature: " << interp_collision_time/single_collision_time
+            << std::endl;
+
+  return 0;
+}
+
+//---------------------------------------------------------------------------//
+// end temperature_interpolation_timer.cpp
+//---------------------------------------------------------------------------//
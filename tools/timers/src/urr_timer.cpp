@@ -0,0 +1,271 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   urr_timer.cpp
+//! \author Alex Robinson
+//! \brief  Main function for timing neutron cross section lookups and
+//!         collisions in the unresolved resonance range with the smooth
+//!         cross sections and with the probability tables
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <memory>
+#include <random>
+#include <cmath>
+#include <cstdlib>
+
+// FRENSIE Includes
+#include "MonteCarlo_NuclideACEFactory.hpp"
+#include "MonteCarlo_UnresolvedResonanceProbabilityTable.hpp"
+#include "MonteCarlo_NeutronState.hpp"
+#include "MonteCarlo_ParticleBank.hpp"
+#include "MonteCarlo_SimulationProperties.hpp"
+#include "Data_ACEFileHandler.hpp"
+#include "Data_XSSNeutronDataExtractor.hpp"
+#include "Data_ZAID.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_OpenMPProperties.hpp"
+
+// Create the nuclide
+std::shared_ptr<const MonteCarlo::Nuclide> createNuclide(
+                  const Data::ACEFileHandler& ace_file_handler,
+                  const Data::XSSNeutronDataExtractor& xss_data_extractor,
+                  const MonteCarlo::SimulationProperties& properties )
+{
+  const std::string& table_name = ace_file_handler.getTableName();
+
+  const Data::ZAID zaid( table_name.substr( 0, table_name.find( '.' ) ) );
+
+  std::shared_ptr<const MonteCarlo::Nuclide> nuclide;
+
+  MonteCarlo::NuclideACEFactory::createNuclide(
+                      xss_data_extractor,
+                      table_name,
+                      zaid.atomicNumber(),
+                      zaid.atomicMassNumber(),
+                      zaid.isomerNumber(),
+                      ace_file_handler.getTableAtomicWeightRatio(),
+                      ace_file_handler.getTableTemperature().value(),
+                      properties,
+                      nuclide );
+
+  return nuclide;
+}
+
+// Time the total cross section evaluations
+/*! \details A new band random number is used for every evaluation (as is
+ * done after every collision) so that the cost of the band search is
+ * included.
+ */
+double timeCrossSectionEvaluations( const MonteCarlo::Nuclide& nuclide,
+                                    const std::vector<double>& energies,
+                                    double& cross_section_sum )
+{
+  std::shared_ptr<Utility::Timer> timer =
+    Utility::OpenMPProperties::createTimer();
+
+  // Use the same random number sequence for each nuclide
+  Utility::RandomNumberGenerator::initialize( 0ull );
+
+  cross_section_sum = 0.0;
+
+  timer->start();
+
+  for( size_t i = 0; i < energies.size(); ++i )
+  {
+    MonteCarlo::UnresolvedResonanceProbabilityTable::resetBandRandomNumber();
+
+    cross_section_sum += nuclide.getTotalCrossSection( energies[i] );
+  }
+
+  timer->stop();
+
+  return timer->elapsed().count();
+}
+
+// Time the analogue collisions
+double timeCollisions( const MonteCarlo::Nuclide& nuclide,
+                       const std::vector<double>& energies,
+                       double& absorption_fraction,
+                       double& mean_outgoing_energy )
+{
+  std::shared_ptr<Utility::Timer> timer =
+    Utility::OpenMPProperties::createTimer();
+
+  // Use the same random number sequence for each nuclide
+  Utility::RandomNumberGenerator::initialize( 0ull );
+
+  absorption_fraction = 0.0;
+  mean_outgoing_energy = 0.0;
+
+  size_t scattering_events = 0;
+
+  MonteCarlo::ParticleBank bank;
+
+  timer->start();
+
+  for( size_t i = 0; i < energies.size(); ++i )
+  {
+    MonteCarlo::NeutronState neutron( i );
+    neutron.setEnergy( energies[i] );
+    neutron.setDirection( 0.0, 0.0, 1.0 );
+
+    nuclide.collideAnalogue( neutron, bank );
+
+    if( !neutron.isGone() )
+    {
+      mean_outgoing_energy += neutron.getEnergy();
+
+      ++scattering_events;
+    }
+
+    // Discard any secondaries
+    while( !bank.isEmpty() )
+      bank.pop();
+  }
+
+  timer->stop();
+
+  absorption_fraction =
+    (energies.size() - scattering_events)/(double)energies.size();
+
+  if( scattering_events > 0 )
+    mean_outgoing_energy /= scattering_events;
+
+  return timer->elapsed().count();
+}
+
+// Main timing function
+int main( int argc, char** argv )
+{
+  if( argc < 4 )
+  {
+    std::cerr << "Usage: " << argv[0] << " ace_file table start_line "
+              << "[samples]" << std::endl;
+
+    return 1;
+  }
+
+  size_t samples = 1000000;
+
+  if( argc > 4 )
+    samples = std::strtoull( argv[4], NULL, 10 );
+
+  Data::ACEFileHandler ace_file_handler( argv[1],
+                                         argv[2],
+                                         std::atoi( argv[3] ),
+                                         true );
+
+  Data::XSSNeutronDataExtractor xss_data_extractor(
+                                       ace_file_handler.getTableNXSArray(),
+                                       ace_file_handler.getTableJXSArray(),
+                                       ace_file_handler.getTableXSSArray() );
+
+  if( !xss_data_extractor.hasUnresolvedResonanceData() )
+  {
+    std::cerr << "Table " << argv[2] << " does not have unresolved "
+              << "resonance data!" << std::endl;
+
+    return 1;
+  }
+
+  // The unresolved resonance range is stored after the table parameters
+  Utility::ArrayView<const double> unr_block =
+    xss_data_extractor.extractUNRBlock();
+
+  const size_t number_of_energies = (size_t)unr_block[0];
+
+  const double min_energy = unr_block[6];
+  const double max_energy = unr_block[5+number_of_energies];
+
+  MonteCarlo::SimulationProperties properties;
+
+  properties.setUnresolvedResonanceProbabilityTableModeOff();
+
+  std::shared_ptr<const MonteCarlo::Nuclide> smooth_nuclide =
+    createNuclide( ace_file_handler, xss_data_extractor, properties );
+
+  properties.setUnresolvedResonanceProbabilityTableModeOn();
+
+  std::shared_ptr<const MonteCarlo::Nuclide> urr_nuclide =
+    createNuclide( ace_file_handler, xss_data_extractor, properties );
+
+  std::cout << "Table: " << argv[2] << "\n"
+            << "Unresolved resonance range (MeV): [" << min_energy << ","
+            << max_energy << "]\n"
+            << "Bands: " << (size_t)unr_block[1] << "\n"
+            << "Samples: " << samples << "\n" << std::endl;
+
+  // Pregenerate the incoming energies (log uniform over the unresolved
+  // resonance range) so that only the cross section evaluations and
+  // collisions are timed
+  std::mt19937_64 generator( 1 );
+  std::uniform_real_distribution<double> uniform( 0.0, 1.0 );
+
+  std::vector<double> energies( samples );
+
+  for( size_t i = 0; i < samples; ++i )
+  {
+    energies[i] = min_energy*std::pow( max_energy/min_energy,
+                                       uniform( generator ) );
+  }
+
+  Utility::RandomNumberGenerator::createStreams();
+
+  std::cout << std::setw(20) << "model"
+            << std::setw(18) << "xs evals/s"
+            << std::setw(18) << "collisions/s"
+            << std::setw(18) << "mean sigma_t (b)"
+            << std::setw(18) << "absorption frac"
+            << std::setw(18) << "mean E' (MeV)" << std::endl;
+
+  double smooth_xs_sum, smooth_absorption, smooth_energy;
+
+  double smooth_xs_time = timeCrossSectionEvaluations( *smooth_nuclide,
+                                                       energies,
+                                                       smooth_xs_sum );
+
+  double smooth_collision_time = timeCollisions( *smooth_nuclide,
+                                                 energies,
+                                                 smooth_absorption,
+                                                 smooth_energy );
+
+  std::cout << std::setw(20) << "smooth"
+            << std::setw(18) << samples/smooth_xs_time
+            << std::setw(18) << samples/smooth_collision_time
+            << std::setw(18) << smooth_xs_sum/samples
+            << std::setw(18) << smooth_absorption
+            << std::setw(18) << smooth_energy << std::endl;
+
+  double urr_xs_sum, urr_absorption, urr_energy;
+
+  double urr_xs_time = timeCrossSectionEvaluations( *urr_nuclide,
+                                                    energies,
+                                                    urr_xs_sum );
+
+  double urr_collision_time = timeCollisions( *urr_nuclide,
+                                              energies,
+                                              urr_absorption,
+                                              urr_energy );
+
+  std::cout << std::setw(20) << "probability tables"
+            << std::setw(18) << samples/urr_xs_time
+            << std::setw(18) << samples/urr_collision_time
+            << std::setw(18) << urr_xs_sum/samples
+            << std::setw(18) << urr_absorption
+            << std::setw(18) << urr_energy << std::endl;
+
+  std::cout << "\nProbability table lookup time relative to smooth: "
+            << urr_xs_time/smooth_xs_time
+            << "\nProbability table collision time relative to smooth: "
+            << urr_collision_time/smooth_collision_time << std::endl;
+
+  return 0;
+}
+
+//---------------------------------------------------------------------------//
+// end urr_timer.cpp
+//---------------------------------------------------------------------------//